@@ -0,0 +1,491 @@
+#!/usr/bin/env python
+#
+# Codelet generator for ckfft.
+#
+# Emits straight-line DFT kernels ("codelets") for small power-of-2 sizes, in the
+# spirit of FFTW's genfft.  Each codelet is built as an expression DAG of real
+# arithmetic using a split-radix decomposition with constant twiddle factors;
+# trivial multiplications are folded away and common subexpressions are shared
+# before the code is written out.
+#
+# Two backends are generated:
+#   fft_codelets_default.cpp: scalar codelets, one transform per call.
+#   fft_codelets_neon.cpp:    NEON codelets, four interleaved transforms per call,
+#                             as needed by the radix-4 recursion in fft_neon.
+#
+# The output is checked in; rerun etc/gen_codelets.sh after changing this script.
+#
+# usage: gen_codelets.py <output dir>
+
+import math
+import os
+import sys
+
+SIZES = [8, 16, 32, 64]
+
+
+################################################################################
+# expression DAG
+
+class Node(object):
+    def __init__(self, op, args, value=None):
+        self.op = op        # 'in', 'const', 'add', 'sub', 'mul', 'neg'
+        self.args = args
+        self.value = value  # constant value, or (index, part) for inputs
+        self.id = -1
+        self.uses = 0
+
+
+class Dag(object):
+    def __init__(self):
+        self.nodes = []
+        self.table = {}
+        self.zero = self.const(0.0)
+
+    def _make(self, op, args, value=None):
+        key = (op, tuple(a.id for a in args), value)
+        node = self.table.get(key)
+        if node is None:
+            node = Node(op, args, value)
+            node.id = len(self.nodes)
+            self.nodes.append(node)
+            self.table[key] = node
+        return node
+
+    def input(self, index, part):
+        return self._make('in', [], (index, part))
+
+    def const(self, value):
+        return self._make('const', [], float(value))
+
+    def is_const(self, a, value=None):
+        return a.op == 'const' and (value is None or a.value == value)
+
+    def neg(self, a):
+        if a.op == 'neg':
+            return a.args[0]
+        if a.op == 'const':
+            return self.const(-a.value)
+        return self._make('neg', [a])
+
+    def add(self, a, b):
+        if self.is_const(a, 0.0):
+            return b
+        if self.is_const(b, 0.0):
+            return a
+        if a.op == 'neg' and b.op == 'neg':
+            return self.neg(self.add(a.args[0], b.args[0]))
+        if b.op == 'neg':
+            return self.sub(a, b.args[0])
+        if a.op == 'neg':
+            return self.sub(b, a.args[0])
+        if a.id > b.id:
+            a, b = b, a
+        return self._make('add', [a, b])
+
+    def sub(self, a, b):
+        if self.is_const(b, 0.0):
+            return a
+        if self.is_const(a, 0.0):
+            return self.neg(b)
+        if b.op == 'neg':
+            return self.add(a, b.args[0])
+        if a.op == 'neg':
+            return self.neg(self.add(a.args[0], b))
+        # share a - b and b - a as one node
+        if a.id > b.id:
+            return self.neg(self._make('sub', [b, a]))
+        return self._make('sub', [a, b])
+
+    def mul(self, c, a):
+        # c is a python float; a is a node
+        if c == 0.0:
+            return self.zero
+        if c == 1.0:
+            return a
+        if c == -1.0:
+            return self.neg(a)
+        if a.op == 'neg':
+            return self.neg(self.mul(c, a.args[0]))
+        if c < 0.0:
+            return self.neg(self.mul(-c, a))
+        return self._make('mul', [self.const(c), a])
+
+
+################################################################################
+# complex helpers (complex values are (real, imag) node pairs)
+
+def cadd(d, x, y):
+    return (d.add(x[0], y[0]), d.add(x[1], y[1]))
+
+def csub(d, x, y):
+    return (d.sub(x[0], y[0]), d.sub(x[1], y[1]))
+
+def cmul_i(d, x):
+    # i*x
+    return (d.neg(x[1]), x[0])
+
+def cmul_neg_i(d, x):
+    # -i*x
+    return (x[1], d.neg(x[0]))
+
+def twiddle(n, k, sign):
+    # exp(sign*2*pi*i*k/n), exact for multiples of pi/4
+    k %= n
+    if (8 * k) % n == 0:
+        r = math.sqrt(0.5)
+        table = [(1.0, 0.0), (r, r), (0.0, 1.0), (-r, r), (-1.0, 0.0), (-r, -r), (0.0, -1.0), (r, -r)]
+        c, s = table[8 * k // n]
+    else:
+        theta = 2.0 * math.pi * k / n
+        c, s = math.cos(theta), math.sin(theta)
+    return (c, sign * s)
+
+def cmul_const(d, x, w):
+    c, s = w
+    a, b = x
+    if abs(c) == abs(s):
+        # (a + ib)(c + is) with |c| == |s|: one multiply per component
+        if c == s:
+            return (d.mul(c, d.sub(a, b)), d.mul(c, d.add(a, b)))
+        return (d.mul(c, d.add(a, b)), d.mul(c, d.sub(b, a)))
+    re = d.sub(d.mul(c, a), d.mul(s, b))
+    im = d.add(d.mul(s, a), d.mul(c, b))
+    return (re, im)
+
+
+################################################################################
+# split-radix DFT
+
+def dft(d, x, sign):
+    n = len(x)
+    if n == 1:
+        return [x[0]]
+    if n == 2:
+        return [cadd(d, x[0], x[1]), csub(d, x[0], x[1])]
+
+    u = dft(d, x[0::2], sign)
+    z = dft(d, x[1::4], sign)
+    z3 = dft(d, x[3::4], sign)
+
+    n2 = n // 2
+    n4 = n // 4
+    out = [None] * n
+    for k in range(n4):
+        t1 = cmul_const(d, z[k], twiddle(n, k, sign))
+        t3 = cmul_const(d, z3[k], twiddle(n, 3 * k, sign))
+        s = cadd(d, t1, t3)
+        diff = csub(d, t1, t3)
+        out[k] = cadd(d, u[k], s)
+        out[k + n2] = csub(d, u[k], s)
+        # forward (sign = -1): X[k+n/4] = U[k+n/4] - i*diff
+        if sign < 0:
+            idiff = cmul_neg_i(d, diff)
+        else:
+            idiff = cmul_i(d, diff)
+        out[k + n4] = cadd(d, u[k + n4], idiff)
+        out[k + 3 * n4] = csub(d, u[k + n4], idiff)
+    return out
+
+
+def build(n, inverse):
+    d = Dag()
+    x = [(d.input(k, 'real'), d.input(k, 'imag')) for k in range(n)]
+    y = dft(d, x, 1 if inverse else -1)
+    return d, y
+
+
+################################################################################
+# scheduling
+
+def schedule(d, outputs):
+    # depth-first from outputs, so that temporaries are defined close to their use
+    order = []
+    seen = set()
+    def visit(node):
+        if node.id in seen:
+            return
+        seen.add(node.id)
+        for a in node.args:
+            visit(a)
+        order.append(node)
+    for re, im in outputs:
+        visit(re)
+        visit(im)
+    for node in order:
+        for a in node.args:
+            a.uses += 1
+    return order
+
+
+def count_ops(order):
+    adds = len([n for n in order if n.op in ('add', 'sub')])
+    muls = len([n for n in order if n.op == 'mul'])
+    return adds, muls
+
+
+def fmt_const(c):
+    return '%.9ff' % c
+
+
+################################################################################
+# scalar backend
+
+def emit_scalar(n, inverse):
+    d, y = build(n, inverse)
+    order = schedule(d, y)
+    adds, muls = count_ops(order)
+
+    name = 'codelet_%d_%s' % (n, 'inv' if inverse else 'fwd')
+    lines = []
+    lines.append('// %d additions, %d multiplications' % (adds, muls))
+    lines.append('void %s(const CkFftComplex* input, CkFftComplex* output, CkFftSize stride)' % name)
+    lines.append('{')
+
+    names = {}
+    for node in order:
+        if node.op == 'const':
+            names[node.id] = fmt_const(node.value)
+            continue
+        var = 't%d' % node.id
+        if node.op == 'in':
+            index, part = node.value
+            if part == 'real':
+                lines.append('    const CkFftComplex* in%d = input + %d*stride;' % (index, index))
+            var = 'x%d%s' % (index, 'r' if part == 'real' else 'i')
+            expr = 'in%d->%s' % (index, part)
+        elif node.op == 'neg':
+            expr = '-%s' % names[node.args[0].id]
+        elif node.op == 'mul':
+            expr = '%s * %s' % (names[node.args[0].id], names[node.args[1].id])
+        else:
+            op = '+' if node.op == 'add' else '-'
+            expr = '%s %s %s' % (names[node.args[0].id], op, names[node.args[1].id])
+        names[node.id] = var
+        lines.append('    const float %s = %s;' % (var, expr))
+
+    for k, (re, im) in enumerate(y):
+        lines.append('    output[%d].real = %s;' % (k, names[re.id]))
+        lines.append('    output[%d].imag = %s;' % (k, names[im.id]))
+    lines.append('}')
+    return name, lines
+
+
+################################################################################
+# NEON backend
+#
+# Computes four transforms of size n at once, as required by a radix-4 step of
+# size 4*n: transform j reads input + j*stride with element stride 4*stride, and
+# writes n contiguous values to output + j*n.
+
+def emit_neon(n, inverse):
+    d, y = build(n, inverse)
+    order = schedule(d, y)
+    adds, muls = count_ops(order)
+
+    name = 'codelet_%d_%s_x4' % (n, 'inv' if inverse else 'fwd')
+    lines = []
+    lines.append('// %d additions, %d multiplications (x4)' % (adds, muls))
+    lines.append('void %s(const CkFftComplex* input, CkFftComplex* output, CkFftSize stride)' % name)
+    lines.append('{')
+    lines.append('    CkFftSize stride4 = stride * 4;')
+
+    names = {}
+    for node in order:
+        if node.op == 'const':
+            names[node.id] = fmt_const(node.value)
+            continue
+        var = 't%d' % node.id
+        if node.op == 'in':
+            index, part = node.value
+            if part == 'real':
+                lines.append('    const float32x4x2_t x%d = load4(input + %d*stride4, stride);' % (index, index))
+            expr = None
+            var = 'x%d.val[%d]' % (index, 0 if part == 'real' else 1)
+        elif node.op == 'neg':
+            expr = 'vnegq_f32(%s)' % names[node.args[0].id]
+        elif node.op == 'mul':
+            expr = 'vmulq_n_f32(%s, %s)' % (names[node.args[1].id], names[node.args[0].id])
+        elif node.op == 'add':
+            expr = 'vaddq_f32(%s, %s)' % (names[node.args[0].id], names[node.args[1].id])
+        else:
+            expr = 'vsubq_f32(%s, %s)' % (names[node.args[0].id], names[node.args[1].id])
+        names[node.id] = var
+        if expr:
+            lines.append('    const float32x4_t %s = %s;' % (var, expr))
+
+    for k in range(0, n, 4):
+        args = []
+        for j in range(4):
+            re, im = y[k + j]
+            args.append(names[re.id])
+            args.append(names[im.id])
+        lines.append('    store4(output + %d, %d, %s);' % (k, n, ', '.join(args)))
+    lines.append('}')
+    return name, lines
+
+
+################################################################################
+# output
+
+HEADER = '''\
+// Generated by etc/codelets/gen_codelets.py; do not edit.
+'''
+
+NEON_HELPERS = '''\
+// load element from each of 4 transforms (transform j at p + j*stride)
+inline float32x4x2_t load4(const CkFftComplex* p, CkFftSize stride)
+{
+    float32x4x2_t v;
+    if (stride == 1)
+    {
+        v = vld2q_f32((const float32_t*) p);
+    }
+    else
+    {
+        v = vld2q_lane_f32((const float32_t*) p, v, 0);
+        p += stride;
+        v = vld2q_lane_f32((const float32_t*) p, v, 1);
+        p += stride;
+        v = vld2q_lane_f32((const float32_t*) p, v, 2);
+        p += stride;
+        v = vld2q_lane_f32((const float32_t*) p, v, 3);
+    }
+    return v;
+}
+
+// transpose 4 consecutive elements of 4 transforms, and store each transform's
+// elements contiguously (transform j at p + j*n)
+inline void store4(CkFftComplex* p, CkFftSize n,
+        float32x4_t r0, float32x4_t i0,
+        float32x4_t r1, float32x4_t i1,
+        float32x4_t r2, float32x4_t i2,
+        float32x4_t r3, float32x4_t i3)
+{
+    float32x4x2_t r01 = vtrnq_f32(r0, r1);
+    float32x4x2_t r23 = vtrnq_f32(r2, r3);
+    float32x4x2_t i01 = vtrnq_f32(i0, i1);
+    float32x4x2_t i23 = vtrnq_f32(i2, i3);
+
+    float32x4x2_t v;
+    v.val[0] = vcombine_f32(vget_low_f32(r01.val[0]), vget_low_f32(r23.val[0]));
+    v.val[1] = vcombine_f32(vget_low_f32(i01.val[0]), vget_low_f32(i23.val[0]));
+    vst2q_f32((float32_t*) p, v);
+    p += n;
+    v.val[0] = vcombine_f32(vget_low_f32(r01.val[1]), vget_low_f32(r23.val[1]));
+    v.val[1] = vcombine_f32(vget_low_f32(i01.val[1]), vget_low_f32(i23.val[1]));
+    vst2q_f32((float32_t*) p, v);
+    p += n;
+    v.val[0] = vcombine_f32(vget_high_f32(r01.val[0]), vget_high_f32(r23.val[0]));
+    v.val[1] = vcombine_f32(vget_high_f32(i01.val[0]), vget_high_f32(i23.val[0]));
+    vst2q_f32((float32_t*) p, v);
+    p += n;
+    v.val[0] = vcombine_f32(vget_high_f32(r01.val[1]), vget_high_f32(r23.val[1]));
+    v.val[1] = vcombine_f32(vget_high_f32(i01.val[1]), vget_high_f32(i23.val[1]));
+    vst2q_f32((float32_t*) p, v);
+}
+'''
+
+
+def dispatch(fname, suffix, params, args):
+    lines = []
+    lines.append('bool %s(%s)' % (fname, params))
+    lines.append('{')
+    lines.append('    switch (count)')
+    lines.append('    {')
+    for n in SIZES:
+        lines.append('        case %d:' % n)
+        lines.append('            if (inverse)')
+        lines.append('            {')
+        lines.append('                codelet_%d_inv%s(%s);' % (n, suffix, args))
+        lines.append('            }')
+        lines.append('            else')
+        lines.append('            {')
+        lines.append('                codelet_%d_fwd%s(%s);' % (n, suffix, args))
+        lines.append('            }')
+        lines.append('            return true;')
+        lines.append('')
+    lines.append('        default:')
+    lines.append('            return false;')
+    lines.append('    }')
+    lines.append('}')
+    return lines
+
+
+def write_default(path):
+    out = [HEADER]
+    out.append('#include "ckfft/platform.h"')
+    out.append('#include "ckfft/fft_codelets_default.h"')
+    out.append('')
+    out.append('namespace ckfft')
+    out.append('{')
+    out.append('')
+    out.append('namespace')
+    out.append('{')
+    out.append('')
+    for n in SIZES:
+        for inverse in (False, True):
+            name, lines = emit_scalar(n, inverse)
+            out.extend(lines)
+            out.append('')
+    out.append('} // anonymous namespace')
+    out.append('')
+    out.extend(dispatch('fft_codelet_default', '',
+        'const CkFftComplex* input, CkFftComplex* output, CkFftSize count, bool inverse, CkFftSize stride',
+        'input, output, stride'))
+    out.append('')
+    out.append('} // namespace ckfft')
+    out.append('')
+    open(path, 'w').write('\n'.join(out))
+
+
+def write_neon(path):
+    out = [HEADER]
+    out.append('#include "ckfft/platform.h"')
+    out.append('#include "ckfft/fft_codelets_neon.h"')
+    out.append('')
+    out.append('#if CKFFT_ARM_NEON')
+    out.append('#  include <arm_neon.h>')
+    out.append('#endif')
+    out.append('')
+    out.append('namespace ckfft')
+    out.append('{')
+    out.append('')
+    out.append('#if CKFFT_ARM_NEON')
+    out.append('')
+    out.append('namespace')
+    out.append('{')
+    out.append('')
+    out.append(NEON_HELPERS)
+    for n in SIZES:
+        for inverse in (False, True):
+            name, lines = emit_neon(n, inverse)
+            out.extend(lines)
+            out.append('')
+    out.append('} // anonymous namespace')
+    out.append('')
+    out.extend(dispatch('fft_codelet_neon_x4', '_x4',
+        'const CkFftComplex* input, CkFftComplex* output, CkFftSize count, bool inverse, CkFftSize stride',
+        'input, output, stride'))
+    out.append('')
+    out.append('#else // CKFFT_ARM_NEON')
+    out.append('')
+    out.append('bool fft_codelet_neon_x4(const CkFftComplex* input, CkFftComplex* output, CkFftSize count, bool inverse, CkFftSize stride)')
+    out.append('{')
+    out.append('    return false;')
+    out.append('}')
+    out.append('')
+    out.append('#endif // CKFFT_ARM_NEON')
+    out.append('')
+    out.append('} // namespace ckfft')
+    out.append('')
+    open(path, 'w').write('\n'.join(out))
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 2:
+        sys.stderr.write('usage: %s <output dir>\n' % sys.argv[0])
+        sys.exit(1)
+    outDir = sys.argv[1]
+    write_default(os.path.join(outDir, 'fft_codelets_default.cpp'))
+    write_neon(os.path.join(outDir, 'fft_codelets_neon.cpp'))
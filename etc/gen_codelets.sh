@@ -0,0 +1,12 @@
+#!/bin/bash
+
+# Regenerate the straight-line codelets in src/ckfft from etc/codelets/gen_codelets.py.
+
+set -o nounset
+set -o errexit
+
+cd `dirname $0`
+CKFFT_ROOT_DIR=..
+
+python codelets/gen_codelets.py $CKFFT_ROOT_DIR/src/ckfft
+echo "generated codelets in $CKFFT_ROOT_DIR/src/ckfft"
@@ -1,5 +1,6 @@
 #pragma once
 #include <stdlib.h>
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C"
@@ -7,6 +8,11 @@ extern "C"
 #endif
 
 
+// The size of an FFT, or an index or stride within its data: a signed integer the
+// size of a pointer, so 64 bits on 64-bit platforms.
+typedef ptrdiff_t CkFftSize;
+
+
 typedef struct
 {
     float real;
@@ -15,7 +21,57 @@ typedef struct
 CkFftComplex;
 
 
+// Complex value for double-precision FFTs.
+typedef struct
+{
+    double real;
+    double imag;
+}
+CkFftComplexD;
+
+
+// A 16-bit floating-point value (IEEE 754 half precision, or bfloat16; see 
+// CkFftHalfFormat), used for storage only.
+typedef unsigned short CkFftHalf;
+
+
+typedef enum
+{
+    kCkFftHalfFormat_Float16,  // IEEE 754 half precision (fp16)
+    kCkFftHalfFormat_BFloat16  // bfloat16 (upper 16 bits of a float)
+}
+CkFftHalfFormat;
+
+
+// Complex fixed-point values: Q15 values are 16-bit integers representing 
+// multiples of 2^-15, and Q31 values are 32-bit integers representing multiples
+// of 2^-31.
+typedef struct
+{
+    short real;
+    short imag;
+}
+CkFftComplexQ15;
+
+typedef struct
+{
+    int real;
+    int imag;
+}
+CkFftComplexQ31;
+
+
 typedef struct _CkFftContext CkFftContext;
+typedef struct _CkFftContextD CkFftContextD;
+typedef struct _CkFftContextQ15 CkFftContextQ15;
+typedef struct _CkFftContextQ31 CkFftContextQ31;
+typedef struct _CkFftStft CkFftStft;
+typedef struct _CkFftIstft CkFftIstft;
+typedef struct _CkFftConvolver CkFftConvolver;
+typedef struct _CkFftPartitionedConvolver CkFftPartitionedConvolver;
+typedef struct _CkFftConvolverMatrix CkFftConvolverMatrix;
+typedef struct _CkFftCorrelator CkFftCorrelator;
+typedef struct _CkFftMelFeatures CkFftMelFeatures;
 
 
 typedef enum 
@@ -27,6 +83,87 @@ typedef enum
 CkFftDirection;
 
 
+typedef enum
+{
+    kCkFftScale_None,       // no scaling (other than the scale factor)
+    kCkFftScale_1OverN,     // scale by 1/n
+    kCkFftScale_1OverSqrtN  // scale by 1/sqrt(n)
+}
+CkFftScaleMode;
+
+
+// Window functions for CkFftWindow().
+typedef enum
+{
+    kCkFftWindow_Rectangular,
+    kCkFftWindow_Hann,
+    kCkFftWindow_Hamming,
+    kCkFftWindow_Blackman
+}
+CkFftWindowType;
+
+
+// Weightings of the cross-spectrum for CkFftCorrelatorInit().
+typedef enum
+{
+    kCkFftWeighting_None,   // plain cross-correlation
+    kCkFftWeighting_Phat,   // phase transform: each bin divided by its magnitude
+    kCkFftWeighting_Scot    // smoothed coherence transform: divided by the geometric
+                            // mean of the smoothed power spectra of the signals
+}
+CkFftWeighting;
+
+
+// Memory allocation functions (see CkFftSetAllocator()).
+typedef void* (*CkFftAllocFunc)(size_t size, void* userData);
+typedef void (*CkFftFreeFunc)(void* ptr, void* userData);
+
+
+// Set the functions used to allocate and free memory.
+//
+// Parameters:
+//   allocFunc: Function that allocates size bytes, or returns NULL on failure.
+//   freeFunc:  Function that frees memory returned by allocFunc.
+//   userData:  Value passed to allocFunc and freeFunc.
+//
+// By default, memory is allocated with malloc() and freed with free().  Pass NULL 
+// for both functions to restore the defaults.  The allocator applies to all memory
+// allocated by the library after this call; memory is always freed with the 
+// functions it was allocated with, so contexts created earlier can still be shut 
+// down.  Memory the library allocates does not need to be aligned (the library 
+// aligns it itself).
+//
+// This should not be called while other threads may be creating contexts.
+//
+// Returns 1 if the allocator could be set, or 0 if only one of the functions was NULL.
+//
+int CkFftSetAllocator(CkFftAllocFunc allocFunc, CkFftFreeFunc freeFunc, void* userData);
+
+
+
+// Set whether large contexts are allocated with huge pages.
+//
+// Parameters:
+//   enable:  Nonzero to use huge pages, or 0 to use normal allocation (the default).
+//
+// Large FFTs read twiddle factors at large strides, touching a different memory 
+// page for nearly every one, which can make TLB misses a significant cost.  With 
+// this enabled, contexts and other buffers of 4 MB or more (for example, contexts 
+// for both directions with nMax of 2^19 or more) are allocated with 2 MB pages: 
+// explicit huge pages (MAP_HUGETLB) if any are reserved, otherwise transparent huge 
+// pages (madvise(MADV_HUGEPAGE)) on Android; superpages on macOS; or large pages on 
+// Windows (which requires the "lock pages in memory" privilege).  If huge pages 
+// can't be allocated, normal allocation is used instead.  Huge pages are not used 
+// if an allocator has been set with CkFftSetAllocator().
+//
+// This should not be called while other threads may be creating contexts.
+//
+// Returns 1 if huge pages are supported on this platform, or 0 if not.
+//
+int CkFftSetHugePages(int enable);
+
+
+
 // Create an FFT context.
 //
 // Parameters:
@@ -40,8 +177,8 @@ CkFftDirection;
 // The context does not contain state, so contexts can be used simultaneously on 
 // different threads.
 //
-// If you are content to let CkFftInit() allocate its own memory, pass in NULL for
-// both buf and bufSize.  
+// If you are content to let CkFftInit() allocate its own memory (see 
+// CkFftSetAllocator()), pass in NULL for both buf and bufSize.  
 //
 // If buf is not NULL, and the value pointed to by bufSize is large enough, then
 // then the FFT will use the buffer for the context.  If the value pointed by bufSize 
@@ -54,9 +191,112 @@ CkFftDirection;
 //   void* mem = malloc(memSize);
 //   CkFftContext* context = CkFftInit(nMax, kCkFftDirection_Forward, mem, &memSize);
 //
+// The context and its tables are aligned to 64 bytes within the buffer; the buffer 
+// itself does not need to be aligned (the size includes room for aligning it).
+//
+// On 64-bit platforms, nMax may be 2^31 or more.  The context holds a table of nMax
+// complex values for each direction, so it takes 8*nMax bytes per direction; nMax 
+// is limited only by the memory available (and CkFftInit() returns NULL if the 
+// size would not fit in a size_t).
+//
 // Returns a context pointer if one could be created, or NULL if not.
 //
-CkFftContext* CkFftInit(int nMax, CkFftDirection direction, void* buf, size_t* bufSize);
+CkFftContext* CkFftInit(CkFftSize nMax, CkFftDirection direction, void* buf, size_t* bufSize);
+
+
+
+// Keep a copy of a context's tables on each NUMA node.
+//
+// Parameters:
+//   context:   A context pointer from CkFftInit().
+//
+// On a multi-socket system, threads on one node that share a context allocated on
+// another read its twiddle factors over the interconnect.  After this call, each
+// FFT performed with the context uses a copy of its tables local to the node of 
+// the calling thread.  The copy for each node is made (by the usual first-touch 
+// policy, in that node's memory) the first time the context is used on that node, 
+// with the current allocator (see CkFftSetAllocator()), even if the context itself
+// is in a user buffer; copies are freed by CkFftShutdown().
+//
+// This should be called before the context is used on other threads.  Nodes are 
+// detected only on Android and Windows, the platforms with NUMA support; this 
+// library does not build for other Linux systems, so multi-socket Linux servers
+// are not supported.
+//
+// Returns 1 if the context will use per-node tables, or 0 if not (if the system
+// has only one NUMA node, or memory could not be allocated, or the context was 
+// invalid).
+//
+int CkFftEnableNumaReplicas(CkFftContext* context);
+
+
+
+// Reserve temporary buffers in a context, for FFTs that need them.
+//
+// Parameters:
+//   context:     A context pointer from CkFftInit().
+//   threadCount: The number of threads that may use the context at the same time.
+//
+// Some functions take a tmpBuf parameter for intermediate results, such as 
+// CkFftRealInverse() and CkFftRealInverseStrided().  If tmpBuf is NULL, these use 
+// one of the buffers reserved with this function instead, so callers don't have 
+// to manage temporary buffers of their own.  Each buffer holds nMax complex values, 
+// enough for any FFT that can be performed with the context; a thread takes the 
+// first buffer that is not in use by another thread, so a thread that has the 
+// context to itself uses the same buffer each time, and it stays in the cache.
+//
+// If no buffers were reserved, functions that need one allocate it for each call
+// with the current allocator (see CkFftSetAllocator()), so memory is allocated on
+// the thread performing the FFT, which may be a real-time audio thread; call this 
+// if FFTs must not allocate memory.  Once buffers are reserved, FFTs never 
+// allocate them: if all of them are in use (because more than threadCount threads
+// are using the context at once), functions that need one fail, returning 0.
+//
+// The buffers are allocated with the current allocator, even if the context itself
+// is in a user buffer, and are freed by CkFftShutdown().  This should be called 
+// before the context is used.  Calling it again with a larger threadCount reserves
+// a new set of buffers for later calls; it may be called while other threads are
+// performing FFTs, so the old buffers are kept until CkFftShutdown().
+//
+// Returns 1 if the buffers could be reserved, or 0 if memory could not be 
+// allocated or one of the parameters was invalid.
+//
+int CkFftReserveScratch(CkFftContext* context, int threadCount);
+
+
+
+// Set the scaling applied to the output of FFTs performed with a context.
+//
+// Parameters:
+//   context:   A context pointer from CkFftInit().
+//   direction: Direction(s) of the FFTs to which the scaling applies.
+//   mode:      Scaling that depends on the FFT size n:
+//                kCkFftScale_None:       none
+//                kCkFftScale_1OverN:     1/n
+//                kCkFftScale_1OverSqrtN: 1/sqrt(n)
+//   factor:    Constant factor, applied in addition to the scaling for the mode.
+//
+// The scaling is folded into the last step of each FFT (or into the pre- or post-
+// processing of real FFTs), so it does not require a separate pass over the data.
+// For example, to get the original data back from a forward FFT followed by an
+// inverse FFT:
+//   CkFftSetScale(context, kCkFftDirection_Inverse, kCkFftScale_1OverN, 1.0f);
+// or, to make both directions unitary:
+//   CkFftSetScale(context, kCkFftDirection_Both, kCkFftScale_1OverSqrtN, 1.0f);
+// 
+// Real FFTs of size n are scaled as if they were complex FFTs of size 2*n, which 
+// cancels their extra factor of 2, so the examples above work for both real and 
+// complex FFTs.  kCkFftScale_1OverN on the forward real FFT gives the same spectrum 
+// as kCkFftScale_1OverN on a forward complex FFT of the same data.
+//
+// The default for both directions is kCkFftScale_None with a factor of 1.
+// The scaling is a property of the context, so it should be set before the context 
+// is used for FFTs on other threads.  It does not apply to CkFftComplexMultiply() 
+// and the other spectral arithmetic functions.
+//
+// Returns 1 if the scaling could be set, or 0 if one of the parameters was invalid.
+//
+int CkFftSetScale(CkFftContext* context, CkFftDirection direction, CkFftScaleMode mode, float factor);
 
 
 
@@ -74,15 +314,18 @@ CkFftContext* CkFftInit(int nMax, CkFftDirection direction, void* buf, size_t* b
 //   output[i].real = output[n-i].real
 //   output[i].imag = -output[n-i].imag
 //
-// The FFT is NOT performed in-place, so input and output must be different buffers.
+// The FFT can be performed in-place, by passing the same buffer for input and output;
+// the buffer must then be large enough for the output (n/2+1 complex elements).
+// Otherwise, input and output must not overlap.
 // 
-// No scaling is applied to the results of either the forward or inverse FFT, so if you 
+// By default, no scaling is applied to the results of either the forward or inverse 
+// FFT (see CkFftSetScale()), so if you 
 // apply a forward FFT followed by an inverse FFT to a set of real data, the result is
 // the original data, scaled by 2*n.
 // 
 // Returns 1 if the FFT could be performed, or 0 if one of the parameters was invalid.
 //
-int CkFftRealForward(CkFftContext* context, int n, const float* input, CkFftComplex* output);
+int CkFftRealForward(CkFftContext* context, CkFftSize n, const float* input, CkFftComplex* output);
 
 
 
@@ -95,17 +338,183 @@ int CkFftRealForward(CkFftContext* context, int n, const float* input, CkFftComp
 //   input:   Complex input data, containing n/2+1 elements. This should be data that
 //            was obtained by a call to CkFftRealForward().
 //   output:  Buffer for real output data, containing n float elements.  
-//   tmpBuf:  A temporary buffer, containing n/2+1 complex elements.
+//   tmpBuf:  Optional temporary buffer, containing n/2+1 complex elements.
 // 
-// The FFT is NOT performed in-place, so input and output must be different buffers.
+// The FFT can be performed in-place, by passing the same buffer for input and output.
+// Otherwise, input and output must not overlap.
+//
+// If tmpBuf is NULL, a buffer reserved with CkFftReserveScratch() is used if one is
+// free; otherwise the intermediate results are computed in the output buffer, so
+// no extra memory is needed, though this is a little slower for out-of-place FFTs.
 // 
-// No scaling is applied to the results of either the forward or inverse FFT, so if you 
+// By default, no scaling is applied to the results of either the forward or inverse 
+// FFT (see CkFftSetScale()), so if you 
 // apply a forward FFT followed by an inverse FFT to a set of real data, the result is
 // the original data, scaled by 2*n.
 // 
 // Returns 1 if the FFT could be performed, or 0 if one of the parameters was invalid.
 //
-int CkFftRealInverse(CkFftContext* context, int n, const CkFftComplex* input, float* output, CkFftComplex* tmpBuf);
+int CkFftRealInverse(CkFftContext* context, CkFftSize n, const CkFftComplex* input, float* output, CkFftComplex* tmpBuf);
+
+
+
+// Compute the power spectrum, the magnitude spectrum, or the power spectrum in 
+// decibels, of real data.
+//
+// Parameters:
+//   context: A context pointer from CkFftInit().
+//   n:       The size of the FFT.  This must be a power of 2 and must not be greater
+//            than the value of nMax specified when the context was created.
+//   input:   Real input data, containing n float elements.
+//   output:  Buffer for output data, containing n/2+1 float elements; it may be the
+//            same buffer as input.
+//   tmpBuf:  Optional temporary buffer, containing n/2 complex elements.
+// 
+// These give the squared magnitude |X|^2 (CkFftRealPowerSpectrum()), the magnitude
+// |X| (CkFftRealMagnitude()), or 10*log10(|X|^2) (CkFftRealPowerSpectrumDb(), 
+// which gives -200 for values smaller than that) of each element X of the 
+// spectrum that CkFftRealForward() would give, including its scaling (see 
+// CkFftSetScale()).  The values are computed in the last step of the FFT, so the 
+// complex spectrum is never stored, and the memory traffic is much less than 
+// that of CkFftRealForward() followed by a separate pass over the spectrum.  
+//
+// If tmpBuf is NULL, a buffer reserved with CkFftReserveScratch() is used, or, if
+// none were reserved, one is allocated for the call.
+// 
+// Returns 1 if the spectrum could be computed, or 0 if one of the parameters was 
+// invalid or a temporary buffer could not be allocated.
+//
+int CkFftRealPowerSpectrum(CkFftContext* context, CkFftSize n, const float* input, float* output, CkFftComplex* tmpBuf);
+int CkFftRealMagnitude(CkFftContext* context, CkFftSize n, const float* input, float* output, CkFftComplex* tmpBuf);
+int CkFftRealPowerSpectrumDb(CkFftContext* context, CkFftSize n, const float* input, float* output, CkFftComplex* tmpBuf);
+
+
+
+// Perform a forward FFT on real data, with output in packed format.
+//
+// Parameters:
+//   context: A context pointer from CkFftInit().
+//   n:       The size of the FFT.  This must be a power of 2, at least 2, and must 
+//            not be greater than the value of nMax specified when the context was 
+//            created.
+//   input:   Real input data, containing n elements.
+//   output:  Buffer for complex output data, containing n/2 elements.  
+//
+// This is the same as CkFftRealForward(), except that the output has n/2 elements 
+// rather than n/2+1.  The DC value (output[0]) and the Nyquist value (output[n/2]) 
+// of the unpacked spectrum are both real, so they are stored together in output[0]:
+//   output[0].real = DC value
+//   output[0].imag = Nyquist value
+// The other elements are the same as in the unpacked spectrum.  (This is the same 
+// convention as vDSP_fft_zrip() in Apple's Accelerate framework.)  Keeping the 
+// spectrum a power of 2 in size makes it easier to keep multiple spectra contiguous 
+// and aligned.
+//
+// The FFT can be performed in-place, by passing the same buffer for input and output.
+// Otherwise, input and output must not overlap.
+// 
+// Returns 1 if the FFT could be performed, or 0 if one of the parameters was invalid.
+//
+int CkFftRealForwardPacked(CkFftContext* context, CkFftSize n, const float* input, CkFftComplex* output);
+
+
+
+// Perform an inverse FFT on a real spectrum in packed format.
+//
+// Parameters:
+//   context: A context pointer from CkFftInit().
+//   n:       The size of the FFT.  This must be a power of 2, at least 2, and must 
+//            not be greater than the value of nMax specified when the context was 
+//            created.
+//   input:   Complex input data in packed format, containing n/2 elements (see 
+//            CkFftRealForwardPacked()).
+//   output:  Buffer for real output data, containing n float elements.  
+//   tmpBuf:  Optional temporary buffer, containing n/2 complex elements.
+// 
+// This is the same as CkFftRealInverse(), except for the format of the input.
+// 
+// Returns 1 if the FFT could be performed, or 0 if one of the parameters was invalid.
+//
+int CkFftRealInversePacked(CkFftContext* context, CkFftSize n, const CkFftComplex* input, float* output, CkFftComplex* tmpBuf);
+
+
+
+// Perform a forward FFT on real data that is not contiguous, such as one channel of
+// interleaved multichannel audio.
+//
+// Parameters:
+//   context:     A context pointer from CkFftInit().
+//   n:           The size of the FFT.  This must be a power of 2 and must not be 
+//                greater than the value of nMax specified when the context was created.
+//   input:       Real input data, containing n elements, inputStride floats apart 
+//                (that is, input[0], input[inputStride], input[2*inputStride], ...).
+//   inputStride: Distance between input elements, in floats; must be at least 1.
+//   output:      Buffer for complex output data, containing n/2+1 elements.  
+//
+// This is the same as CkFftRealForward(), except for the layout of the input.  The
+// input is read directly by the first step of the FFT, so there is no need to copy 
+// it to a contiguous buffer first.  For example, for channel c of 8-channel 
+// interleaved data:
+//   CkFftRealForwardStrided(context, n, data + c, 8, output);
+//
+// Input and output must not overlap.
+// 
+// Returns 1 if the FFT could be performed, or 0 if one of the parameters was invalid.
+//
+int CkFftRealForwardStrided(CkFftContext* context, CkFftSize n, const float* input, CkFftSize inputStride, CkFftComplex* output);
+
+
+
+// Perform an inverse FFT on the result of a forward FFT on real data, writing output
+// that is not contiguous, such as one channel of interleaved multichannel audio.
+//
+// Parameters:
+//   context:      A context pointer from CkFftInit().
+//   n:            The size of the FFT.  This must be a power of 2 and must not be 
+//                 greater than the value of nMax specified when the context was created.
+//   input:        Complex input data, containing n/2+1 elements.
+//   output:       Buffer for real output data, containing n elements, outputStride 
+//                 floats apart.
+//   outputStride: Distance between output elements, in floats; must be at least 1.
+//   tmpBuf:       Optional temporary buffer, containing n/2+1 complex elements.  
+//                 If this is NULL and outputStride is not 1, a buffer reserved with
+//                 CkFftReserveScratch() is used, or, if none were reserved, one is
+//                 allocated for the call.
+//
+// This is the same as CkFftRealInverse(), except for the layout of the output.  
+// Other values in the output buffer (such as other channels) are not modified.
+// 
+// Input and output must not overlap.
+//
+// Returns 1 if the FFT could be performed, or 0 if one of the parameters was invalid
+// or a temporary buffer could not be allocated.
+//
+int CkFftRealInverseStrided(CkFftContext* context, CkFftSize n, const CkFftComplex* input, float* output, CkFftSize outputStride, CkFftComplex* tmpBuf);
+
+
+
+// Perform a forward FFT on real 16-bit integer data, such as PCM audio samples.
+//
+// Parameters:
+//   context:    A context pointer from CkFftInit().
+//   n:          The size of the FFT.  This must be a power of 2 and must not be 
+//               greater than the value of nMax specified when the context was created.
+//   input:      Real input data, containing n elements.
+//   inputScale: Factor by which the input values are multiplied when they are 
+//               converted to floating-point (for example, 1.0f/32768.0f to convert 
+//               to the range [-1, 1)).
+//   output:     Buffer for complex output data, containing n/2+1 elements.  
+//
+// This is the same as CkFftRealForward() on the input multiplied by inputScale.  The 
+// input is converted as it is read by the first radix-2 or radix-4 step of the FFT,
+// which also takes the place of the reordering step, so there is no separate 
+// conversion pass and no floating-point copy of the input.
+//
+// Input and output must not overlap.
+// 
+// Returns 1 if the FFT could be performed, or 0 if one of the parameters was invalid.
+//
+int CkFftRealForwardInt16(CkFftContext* context, CkFftSize n, const short* input, float inputScale, CkFftComplex* output);
 
 
 
@@ -118,15 +527,44 @@ int CkFftRealInverse(CkFftContext* context, int n, const CkFftComplex* input, fl
 //   input:   Complex input data, containing n elements.
 //   output:  Buffer for complex output data, containing n elements.
 //
-// The FFT is NOT performed in-place, so input and output must be different buffers.
+// The FFT can be performed in-place, by passing the same buffer for input and output;
+// this is a little slower than an out-of-place FFT.  Otherwise, input and output must 
+// not overlap.
 // 
-// No scaling is applied to the results of either the forward or inverse FFT, so if you 
+// By default, no scaling is applied to the results of either the forward or inverse 
+// FFT (see CkFftSetScale()), so if you 
 // apply a forward FFT followed by an inverse FFT to a set of data, the result is
 // the original data, scaled by n.
 // 
 // Returns 1 if the FFT could be performed, or 0 if one of the parameters was invalid.
 //
-int CkFftComplexForward(CkFftContext* context, int n, const CkFftComplex* input, CkFftComplex* output);
+int CkFftComplexForward(CkFftContext* context, CkFftSize n, const CkFftComplex* input, CkFftComplex* output);
+
+
+
+// Perform a forward FFT on complex integer data, such as IQ samples.
+//
+// Parameters:
+//   context:    A context pointer from CkFftInit().
+//   n:          The size of the FFT.  This must be a power of 2 and must not be 
+//               greater than the value of nMax specified when the context was created.
+//   input:      Complex input data, containing n elements, each stored as a pair of
+//               integers (real, then imaginary), so 2*n integers in all.
+//   inputScale: Factor by which the input values are multiplied when they are 
+//               converted to floating-point.
+//   output:     Buffer for complex output data, containing n elements.
+//
+// These are the same as CkFftComplexForward() on the input multiplied by inputScale.
+// The input is converted as it is read by the first radix-2 or radix-4 step of the 
+// FFT, which also takes the place of the reordering step, so there is no separate 
+// conversion pass and no floating-point copy of the input.
+//
+// Input and output must not overlap.
+// 
+// Returns 1 if the FFT could be performed, or 0 if one of the parameters was invalid.
+//
+int CkFftComplexForwardInt16(CkFftContext* context, CkFftSize n, const short* input, float inputScale, CkFftComplex* output);
+int CkFftComplexForwardInt8(CkFftContext* context, CkFftSize n, const signed char* input, float inputScale, CkFftComplex* output);
 
 
 
@@ -139,23 +577,1132 @@ int CkFftComplexForward(CkFftContext* context, int n, const CkFftComplex* input,
 //   input:   Complex input data, containing n elements.
 //   output:  Buffer for complex output data, containing n elements.
 //
-// The FFT is NOT performed in-place, so input and output must be different buffers.
+// The FFT can be performed in-place, by passing the same buffer for input and output;
+// this is a little slower than an out-of-place FFT.  Otherwise, input and output must 
+// not overlap.
 // 
-// No scaling is applied to the results of either the forward or inverse FFT, so if you 
+// By default, no scaling is applied to the results of either the forward or inverse 
+// FFT (see CkFftSetScale()), so if you 
 // apply a forward FFT followed by an inverse FFT to a set of data, the result is
 // the original data, scaled by n.
 // 
 // Returns 1 if the FFT could be performed, or 0 if one of the parameters was invalid.
 //
-int CkFftComplexInverse(CkFftContext* context, int n, const CkFftComplex* input, CkFftComplex* output);
+int CkFftComplexInverse(CkFftContext* context, CkFftSize n, const CkFftComplex* input, CkFftComplex* output);
 
 
 
-// Destroy an FFT context.
+// Perform FFTs on data stored in a 16-bit floating-point format.
 //
-// If you let CkFftInit() allocate its own memory buffer, then this will free that buffer.
+// Parameters:
+//   context: A context pointer from CkFftInit().
+//   n:       The size of the FFT.  This must be a power of 2 and must not be greater
+//            than the value of nMax specified when the context was created.
+//   format:  The format of the input and output values.
+//   input:   Input data.  Complex values are stored as pairs of CkFftHalf values
+//            (real, then imaginary), so the number of CkFftHalf values is:
+//              CkFftComplexForwardHalf(), CkFftComplexInverseHalf(): 2*n
+//              CkFftRealForwardHalf():                                n
+//              CkFftRealInverseHalf():                                n+2 (n/2+1 complex)
+//   output:  Buffer for output data, in the same format; the number of CkFftHalf 
+//            values is:
+//              CkFftComplexForwardHalf(), CkFftComplexInverseHalf(): 2*n
+//              CkFftRealForwardHalf():                                n+2 (n/2+1 complex)
+//              CkFftRealInverseHalf():                                n
+//   tmpBuf:  Optional temporary buffer, in which the FFT is computed in 32-bit 
+//            floating-point; it must contain n complex elements for complex FFTs, 
+//            or n/2+1 complex elements for real FFTs.  If this is NULL, a buffer 
+//            reserved with CkFftReserveScratch() is used, or, if none were 
+//            reserved, one is allocated for the call.
 //
-void CkFftShutdown(CkFftContext*);
+// These are the same as CkFftComplexForward(), CkFftComplexInverse(), 
+// CkFftRealForward(), and CkFftRealInverse(), except for the storage format, and 
+// give the same results, rounded to the nearest 16-bit value.  The input is 
+// converted as it is read by the first step of the FFT; for forward FFTs, this 
+// takes the place of the reordering step, so the conversion costs no extra pass.
+//
+// The FFTs can be performed in-place, by passing the same buffer for input and output.
+// Otherwise, input and output must not overlap.  tmpBuf must not overlap either.
+//
+// Returns 1 if the FFT could be performed, or 0 if one of the parameters was invalid
+// or a temporary buffer could not be allocated.
+//
+int CkFftComplexForwardHalf(CkFftContext* context, CkFftSize n, CkFftHalfFormat format, const CkFftHalf* input, CkFftHalf* output, CkFftComplex* tmpBuf);
+int CkFftComplexInverseHalf(CkFftContext* context, CkFftSize n, CkFftHalfFormat format, const CkFftHalf* input, CkFftHalf* output, CkFftComplex* tmpBuf);
+int CkFftRealForwardHalf(CkFftContext* context, CkFftSize n, CkFftHalfFormat format, const CkFftHalf* input, CkFftHalf* output, CkFftComplex* tmpBuf);
+int CkFftRealInverseHalf(CkFftContext* context, CkFftSize n, CkFftHalfFormat format, const CkFftHalf* input, CkFftHalf* output, CkFftComplex* tmpBuf);
+
+
+
+// Perform a forward FFT on complex data, with output in bit-reversed order.
+//
+// Parameters:
+//   context: A context pointer from CkFftInit().
+//   n:       The size of the FFT.  This must be a power of 2 and must not be greater
+//            than the value of nMax specified when the context was created.
+//   input:   Complex input data, containing n elements, in natural order.
+//   output:  Buffer for complex output data, containing n elements.
+//
+// This is the same as CkFftComplexForward(), except that the output is not reordered:
+// the value for frequency bin k is stored at output[CkFftUnorderedIndex(n, k)].
+// Skipping the reordering makes this faster than an ordered FFT, which is useful 
+// when the spectrum is only going to be processed pointwise and transformed back,
+// as in fast convolution:
+//
+//   CkFftComplexForwardUnordered(context, n, x, x);
+//   CkFftComplexForwardUnordered(context, n, h, h);
+//   CkFftComplexMultiply(context, n, x, h, x);
+//   CkFftComplexInverseUnordered(context, n, x, x);  // x is now n times (x conv h)
+//
+// The FFT can be performed in-place, by passing the same buffer for input and output.
+// Otherwise, input and output must not overlap.
+// 
+// Returns 1 if the FFT could be performed, or 0 if one of the parameters was invalid.
+//
+int CkFftComplexForwardUnordered(CkFftContext* context, CkFftSize n, const CkFftComplex* input, CkFftComplex* output);
+
+
+
+// Perform an inverse FFT on complex data in bit-reversed order.
+//
+// Parameters:
+//   context: A context pointer from CkFftInit().
+//   n:       The size of the FFT.  This must be a power of 2 and must not be greater
+//            than the value of nMax specified when the context was created.
+//   input:   Complex input data, containing n elements, in bit-reversed order (such 
+//            as the output of CkFftComplexForwardUnordered()).
+//   output:  Buffer for complex output data, containing n elements, in natural order.
+//
+// The FFT can be performed in-place, by passing the same buffer for input and output.
+// Otherwise, input and output must not overlap.
+// 
+// As with the ordered FFTs, no scaling is applied, so a forward FFT followed by an
+// inverse FFT returns the original data, scaled by n.
+// 
+// Returns 1 if the FFT could be performed, or 0 if one of the parameters was invalid.
+//
+int CkFftComplexInverseUnordered(CkFftContext* context, CkFftSize n, const CkFftComplex* input, CkFftComplex* output);
+
+
+
+// Return the position of frequency bin k in the output of an unordered FFT of size n;
+// this is k with its log2(n) bits reversed.  (Since bit reversal is its own inverse,
+// this is also the frequency bin of the value at position k.)
+//
+// Returns -1 if n is not a power of 2 or k is not in the range [0, n).
+//
+CkFftSize CkFftUnorderedIndex(CkFftSize n, CkFftSize k);
+
+
+
+// Perform a forward FFT on complex data, computing only some of the output bins 
+// (an output-pruned FFT), of input that may be zero-padded (an input-pruned FFT).
+//
+// Parameters:
+//   context:    A context pointer from CkFftInit().
+//   n:          The size of the FFT.  This must be a power of 2 and must not be 
+//               greater than the value of nMax specified when the context was 
+//               created.
+//   input:      Complex input data, containing inputCount elements.
+//   inputCount: The number of input values that may be nonzero, from 1 to n; the 
+//               other n - inputCount values are taken to be zero, and are not read.
+//   firstBin:   The first frequency bin to compute, from 0 to n-1.
+//   binCount:   The number of bins to compute, from 0 to n.
+//   output:     Buffer for the bins, containing binCount elements; output[i] is 
+//               bin (firstBin + i) mod n, so the range may wrap around to include
+//               negative frequencies.  It must not overlap the input.
+//   tmpBuf:     Optional temporary buffer, containing m complex values, where m is 
+//               the smallest power of 2 that is at least inputCount.
+//
+// The output is the same as the corresponding bins of CkFftComplexForward() of the
+// input padded with zeros to n values (including the scaling of the context; see
+// CkFftSetScale()), but only the work that contributes to them is done.  With m 
+// as above, the first log2(n/m) steps of the FFT would only multiply the nonzero
+// inputs by twiddle factors and copy them into n/m FFTs of size m, each of which 
+// gives the bins k for which k mod n/m is the same; so those steps are done in one
+// pass, and only the FFTs of size m that give requested bins are performed.  For 
+// example, 256 samples zero-padded to 8192, with 400 bins requested, take 32 FFTs 
+// of size 256 rather than one of size 8192.  Each FFT of size m also skips the 
+// work for outputs outside the range: its last steps compute only the bins that 
+// are requested.  When few bins are requested, each is computed separately with 
+// the Goertzel algorithm instead, if that takes fewer operations.
+//
+// If tmpBuf is NULL and FFTs are needed, a buffer is taken from those reserved in
+// the context with CkFftReserveScratch(), or, if none were reserved, allocated for
+// the call.
+//
+// Returns 1 if the FFT could be performed, or 0 if one of the parameters was 
+// invalid or a temporary buffer could not be allocated.
+//
+int CkFftComplexForwardPruned(CkFftContext* context, CkFftSize n, const CkFftComplex* input, CkFftSize inputCount, CkFftSize firstBin, CkFftSize binCount, CkFftComplex* output, CkFftComplex* tmpBuf);
+
+
+
+// Perform a forward FFT on complex data, computing only a list of output bins.
+//
+// Parameters:
+//   bins:      The frequency bins to compute, containing binCount elements, each 
+//              from 0 to n-1, in any order.
+//   binCount:  The number of bins to compute; may be 0.
+//   output:    Buffer for the bins, containing binCount elements; output[i] is bin 
+//              bins[i].  It must not overlap the input.
+//
+// The other parameters are as for CkFftComplexForwardPruned(), which this works 
+// the same as.  Each of the FFTs of size m (as described there) is performed only 
+// if a bin in the list needs it, but in full; the list is scanned for each, so it
+// should be short compared to n.
+//
+// Returns 1 if the FFT could be performed, or 0 if one of the parameters was 
+// invalid or a temporary buffer could not be allocated.
+//
+int CkFftComplexForwardPrunedBins(CkFftContext* context, CkFftSize n, const CkFftComplex* input, CkFftSize inputCount, const CkFftSize* bins, CkFftSize binCount, CkFftComplex* output, CkFftComplex* tmpBuf);
+
+
+
+// Perform an inverse FFT on complex data, computing only some of the output values.
+//
+// These work the same as CkFftComplexForwardPruned() and 
+// CkFftComplexForwardPrunedBins(), but give the corresponding values of 
+// CkFftComplexInverse() of the zero-padded input.
+//
+int CkFftComplexInversePruned(CkFftContext* context, CkFftSize n, const CkFftComplex* input, CkFftSize inputCount, CkFftSize firstBin, CkFftSize binCount, CkFftComplex* output, CkFftComplex* tmpBuf);
+int CkFftComplexInversePrunedBins(CkFftContext* context, CkFftSize n, const CkFftComplex* input, CkFftSize inputCount, const CkFftSize* bins, CkFftSize binCount, CkFftComplex* output, CkFftComplex* tmpBuf);
+
+
+
+// Multiply two arrays of complex values, element by element.
+//
+// Parameters:
+//   context: A context pointer from CkFftInit().
+//   n:       The number of elements.
+//   a:       First input, containing n elements.
+//   b:       Second input, containing n elements.
+//   output:  Buffer for output, containing n elements; output[i] = a[i] * b[i].
+//
+// This is the spectral product used for fast convolution; it works the same for 
+// spectra in natural order and in bit-reversed order (as long as both inputs are 
+// in the same order).  The output may be the same buffer as either input.
+//
+// Returns 1 if the multiplication could be performed, or 0 if one of the parameters 
+// was invalid.
+//
+int CkFftComplexMultiply(CkFftContext* context, CkFftSize n, const CkFftComplex* a, const CkFftComplex* b, CkFftComplex* output);
+
+
+
+// These work the same as CkFftComplexMultiply(), except for the operation on each
+// element:
+//
+//   CkFftComplexMultiplyAdd():           output[i] += a[i] * b[i]
+//   CkFftComplexConjugateMultiply():     output[i] = a[i] * conj(b[i])
+//   CkFftComplexConjugateMultiplyAdd():  output[i] += a[i] * conj(b[i])
+//
+// The multiply-add functions sum products in the frequency domain, such as for 
+// partitioned convolution or mixing several filtered signals; the conjugate 
+// product is the cross-spectrum used for correlation.  They use NEON when it is 
+// available, as the FFTs do.  The output may be the same buffer as either input.
+//
+// Returns 1 if the operation could be performed, or 0 if one of the parameters 
+// was invalid.
+//
+int CkFftComplexMultiplyAdd(CkFftContext* context, CkFftSize n, const CkFftComplex* a, const CkFftComplex* b, CkFftComplex* output);
+int CkFftComplexConjugateMultiply(CkFftContext* context, CkFftSize n, const CkFftComplex* a, const CkFftComplex* b, CkFftComplex* output);
+int CkFftComplexConjugateMultiplyAdd(CkFftContext* context, CkFftSize n, const CkFftComplex* a, const CkFftComplex* b, CkFftComplex* output);
+
+
+
+// Multiply an array of complex values by a real scale factor.
+//
+// Parameters:
+//   context: A context pointer from CkFftInit().
+//   n:       The number of elements.
+//   input:   Input, containing n elements.
+//   scale:   The scale factor.
+//   output:  Buffer for output, containing n elements; output[i] = input[i] * scale.
+//            It may be the same buffer as input.
+//
+// This works the same for packed real spectra.
+//
+// Returns 1 if the scaling could be performed, or 0 if one of the parameters was 
+// invalid.
+//
+int CkFftComplexScale(CkFftContext* context, CkFftSize n, const CkFftComplex* input, float scale, CkFftComplex* output);
+
+
+
+// These work the same as CkFftComplexMultiply(), CkFftComplexMultiplyAdd(),
+// CkFftComplexConjugateMultiply(), and CkFftComplexConjugateMultiplyAdd(), but on 
+// packed real spectra, as output by CkFftRealForwardPacked(): n is the number of 
+// elements (half the FFT size), and the real and imaginary parts of the first 
+// element, which are the real values of the DC and Nyquist bins, are multiplied 
+// separately.
+//
+// Returns 1 if the operation could be performed, or 0 if one of the parameters 
+// was invalid.
+//
+int CkFftPackedMultiply(CkFftContext* context, CkFftSize n, const CkFftComplex* a, const CkFftComplex* b, CkFftComplex* output);
+int CkFftPackedMultiplyAdd(CkFftContext* context, CkFftSize n, const CkFftComplex* a, const CkFftComplex* b, CkFftComplex* output);
+int CkFftPackedConjugateMultiply(CkFftContext* context, CkFftSize n, const CkFftComplex* a, const CkFftComplex* b, CkFftComplex* output);
+int CkFftPackedConjugateMultiplyAdd(CkFftContext* context, CkFftSize n, const CkFftComplex* a, const CkFftComplex* b, CkFftComplex* output);
+
+
+
+// Destroy an FFT context.
+//
+// If you let CkFftInit() allocate its own memory buffer, then this will free that buffer.
+//
+void CkFftShutdown(CkFftContext*);
+
+
+
+// Fill a buffer with a window function, for use with CkFftStftInit().
+//
+// Parameters:
+//   type:    The window function.
+//   n:       The number of values; must be at least 1.
+//   window:  Buffer for the window, containing n floats.
+//
+// The windows are periodic (that is, they are the first n values of a window of
+// size n+1), which is what spectral analysis needs: copies of a Hann or Hamming 
+// window spaced n/2 or n/4 apart, or of a Blackman window spaced n/4 apart, sum 
+// to a constant.
+//
+// Returns 1 if the window could be created, or 0 if one of the parameters was 
+// invalid.
+//
+int CkFftWindow(CkFftWindowType type, CkFftSize n, float* window);
+
+
+
+// Create an object for a streaming short-time Fourier transform (STFT), which 
+// divides a stream of real samples into overlapping frames and outputs the 
+// spectrum of each.
+//
+// Parameters:
+//   context:    A context pointer from CkFftInit(), for the forward direction.
+//   frameSize:  The number of samples in each frame, which is the size of each 
+//               real FFT.  This must be a power of 2 and must not be greater than
+//               the value of nMax specified when the context was created.
+//   hopSize:    The number of samples between the starts of successive frames;
+//               must be at least 1 and no greater than frameSize.
+//   window:     Optional window, containing frameSize values, by which each frame 
+//               is multiplied (see CkFftWindow()); it is copied.  If this is NULL, 
+//               a rectangular window is used.
+//   buf:        Optional memory buffer in which to allocate the object.
+//   bufSize:    Optional pointer to size of memory buffer, in bytes.
+//
+// Samples are passed to CkFftStftProcess() in blocks of any size; the last 
+// frameSize samples are kept in the object, and each time another hopSize samples
+// have been received, the spectrum of the last frameSize samples is output.  The 
+// stream is treated as if it were preceded by silence, so the first frame is 
+// output after hopSize samples, and frame i contains the samples up to 
+// (i+1)*hopSize - 1.  The window is applied as the frame is read by the first step 
+// of the FFT, so there is no separate pass over the frame.
+//
+// Memory is allocated as for CkFftInit(), and the context must not be destroyed
+// before the STFT object.  The object contains the state of the stream, so it must
+// not be used on more than one thread at once.
+//
+// Returns a pointer to the object if one could be created, or NULL if not.
+//
+CkFftStft* CkFftStftInit(CkFftContext* context, CkFftSize frameSize, CkFftSize hopSize, const float* window, void* buf, size_t* bufSize);
+
+
+
+// Get the number of frames that passing a number of samples to CkFftStftProcess()
+// will output.
+//
+// Parameters:
+//   stft:   A pointer from CkFftStftInit().
+//   count:  The number of samples.
+//
+// Returns the number of frames, or 0 if one of the parameters was invalid.
+//
+CkFftSize CkFftStftGetFrameCount(CkFftStft* stft, CkFftSize count);
+
+
+
+// Add samples to the stream of an STFT, and output the spectrum of each frame 
+// completed.
+//
+// Parameters:
+//   stft:       A pointer from CkFftStftInit().
+//   input:      Real input samples, containing count elements.
+//   count:      The number of samples; may be 0.
+//   output:     Buffer for the spectra of the frames, each of frameSize/2+1 complex
+//               values, one after another; it must be large enough for the number 
+//               of frames given by CkFftStftGetFrameCount().
+//   frameCount: Optional pointer to the number of frames written to output.
+//
+// The spectra are the same as CkFftRealForward() gives for each windowed frame,
+// including the scaling of the context (see CkFftSetScale()).
+//
+// Returns 1 if the samples could be processed, or 0 if one of the parameters was
+// invalid.
+//
+int CkFftStftProcess(CkFftStft* stft, const float* input, CkFftSize count, CkFftComplex* output, CkFftSize* frameCount);
+
+
+
+// Clear the samples kept by an STFT, so it can start a new stream.
+//
+// Returns 1 if the object could be reset, or 0 if it was invalid.
+//
+int CkFftStftReset(CkFftStft* stft);
+
+
+
+// Destroy an STFT object.
+//
+// If you let CkFftStftInit() allocate its own memory buffer, then this will free 
+// that buffer.
+//
+void CkFftStftShutdown(CkFftStft* stft);
+
+
+
+// Create an object for a streaming inverse short-time Fourier transform (ISTFT),
+// which resynthesizes a stream of real samples from the spectra of overlapping 
+// frames, such as those output by CkFftStftProcess().
+//
+// Parameters:
+//   context:         A context pointer from CkFftInit(), for the inverse direction.
+//   frameSize:       The number of samples in each frame, which is the size of 
+//                    each real FFT.  This must be a power of 2 and must not be 
+//                    greater than the value of nMax specified when the context was
+//                    created.
+//   hopSize:         The number of samples between the starts of successive 
+//                    frames; must be at least 1 and no greater than frameSize.
+//   analysisWindow:  Optional window, containing frameSize values, that was applied
+//                    to the frames before the forward FFTs; NULL for a rectangular
+//                    window.  It is used only for normalization.
+//   synthesisWindow: Optional window, containing frameSize values, by which the 
+//                    result of each inverse FFT is multiplied; it is copied.  If 
+//                    this is NULL, a rectangular window is used.
+//   buf:             Optional memory buffer in which to allocate the object.
+//   bufSize:         Optional pointer to size of memory buffer, in bytes.
+//
+// Each frame passed to CkFftIstftProcess() is transformed with an inverse real FFT,
+// multiplied by the synthesis window, and added to the frames before it, hopSize 
+// samples later than the previous frame.  The last step of the inverse FFT is 
+// followed directly by the multiplication and addition into the object's output 
+// buffer, with no copy of the frame in between.  Once no more frames overlap a
+// sample, it can be read with CkFftIstftRead(); it is divided by the sum of the 
+// products of the analysis and synthesis windows of the frames that overlap it, 
+// so the output is the original stream, as long as the windows do not both go 
+// to zero at the same point.  
+//
+// Frames are placed as CkFftStftProcess() outputs them: frame i contains samples 
+// up to (i+1)*hopSize - 1, and the part of the first frames before the start of 
+// the stream is discarded.  So sample j can be read once frame 
+// (j + frameSize)/hopSize - 1 has been added; when an STFT is followed by an 
+// ISTFT, each sample can be read frameSize - hopSize samples after it was input.
+//
+// The inverse FFTs are scaled as set with CkFftSetScale(); by default they are not 
+// scaled, so the output is the original stream multiplied by 2*frameSize.  To get 
+// the original stream, set the inverse scale of the context to kCkFftScale_1OverN.
+//
+// Each inverse FFT needs a temporary buffer; reserve buffers in the context with
+// CkFftReserveScratch() (which lets many streams share a few buffers), or one will
+// be allocated for each call to CkFftIstftProcess().  Otherwise, memory is 
+// allocated as for CkFftInit(), and the context must not be destroyed before the 
+// ISTFT object.  The object contains the state of the stream, so it must not be 
+// used on more than one thread at once.
+//
+// Returns a pointer to the object if one could be created, or NULL if not.
+//
+CkFftIstft* CkFftIstftInit(CkFftContext* context, CkFftSize frameSize, CkFftSize hopSize, const float* analysisWindow, const float* synthesisWindow, void* buf, size_t* bufSize);
+
+
+
+// Add the spectra of frames to an ISTFT.
+//
+// Parameters:
+//   istft:       A pointer from CkFftIstftInit().
+//   input:       The spectra of the frames, each of frameSize/2+1 complex values, 
+//                one after another, as output by CkFftStftProcess().
+//   frameCount:  The number of frames; may be 0.
+//   processed:   Optional pointer to the number of frames added.
+//
+// The object holds up to frameSize samples that have not been read; frames are 
+// added only while there is room for them, so fewer than frameCount frames may be
+// added.  In that case, read the output with CkFftIstftRead() and pass the rest 
+// of the frames again.  Adding one frame at a time, and reading all the samples 
+// available after each, never runs out of room.
+//
+// Returns 1 if the frames could be processed, or 0 if one of the parameters was 
+// invalid or a temporary buffer could not be allocated.
+//
+int CkFftIstftProcess(CkFftIstft* istft, const CkFftComplex* input, CkFftSize frameCount, CkFftSize* processed);
+
+
+
+// Read samples from an ISTFT.
+//
+// Parameters:
+//   istft:      A pointer from CkFftIstftInit().
+//   output:     Buffer for output samples, containing count elements.
+//   count:      The maximum number of samples to read.
+//   readCount:  Optional pointer to the number of samples read.
+//
+// Only samples that no more frames will overlap can be read, so fewer than count 
+// samples may be read.
+//
+// Returns 1 if the samples could be read, or 0 if one of the parameters was 
+// invalid.
+//
+int CkFftIstftRead(CkFftIstft* istft, float* output, CkFftSize count, CkFftSize* readCount);
+
+
+
+// Clear the state of an ISTFT, so it can start a new stream.
+//
+// Returns 1 if the object could be reset, or 0 if it was invalid.
+//
+int CkFftIstftReset(CkFftIstft* istft);
+
+
+
+// Destroy an ISTFT object.
+//
+// If you let CkFftIstftInit() allocate its own memory buffer, then this will free 
+// that buffer.
+//
+void CkFftIstftShutdown(CkFftIstft* istft);
+
+
+
+// Create an object for filtering streams of real samples with a fixed FIR filter,
+// using fast convolution.
+//
+// Parameters:
+//   context:      A context pointer from CkFftInit(), for both directions.
+//   filter:       The impulse response of the filter, containing filterSize 
+//                 values; it is used only to compute the filter's spectrum.
+//   filterSize:   The number of values in the impulse response; must be at least 1.
+//   blockSize:    The number of samples passed to each call to 
+//                 CkFftConvolverProcess(); must be at least 1.
+//   channelCount: The number of streams to be filtered; must be at least 1.
+//   buf:          Optional memory buffer in which to allocate the object.
+//   bufSize:      Optional pointer to size of memory buffer, in bytes.
+//
+// The filter uses the overlap-save method, with real FFTs of size fftSize, the 
+// smallest power of 2 that is at least filterSize + blockSize - 1; this must not 
+// be greater than the value of nMax specified when the context was created.  The
+// spectrum of the filter is computed once, here.  Then for each block, the last 
+// fftSize samples of the channel are transformed, multiplied by the filter's 
+// spectrum, and transformed back, and the last blockSize results are the output.
+// So the output of each block is available as soon as its input is, with no 
+// latency.  Blocks of about the size of the filter are the most efficient.
+//
+// The channels share the filter spectrum, and each keeps its last fftSize samples.
+// The output does not depend on the scale set with CkFftSetScale().
+//
+// Each block needs a temporary buffer; reserve buffers in the context with 
+// CkFftReserveScratch(), or one will be allocated for each call to 
+// CkFftConvolverProcess().  Otherwise, memory is allocated as for CkFftInit(), and
+// the context must not be destroyed before the convolver.  Different channels 
+// can be processed on different threads at once, but each channel must not be 
+// used on more than one thread at once.
+//
+// Returns a pointer to the object if one could be created, or NULL if not.
+//
+CkFftConvolver* CkFftConvolverInit(CkFftContext* context, const float* filter, CkFftSize filterSize, CkFftSize blockSize, int channelCount, void* buf, size_t* bufSize);
+
+
+
+// Filter a block of samples of one channel of a convolver.
+//
+// Parameters:
+//   conv:     A pointer from CkFftConvolverInit().
+//   channel:  The index of the channel, from 0 to channelCount-1.
+//   input:    Real input samples, containing blockSize elements.
+//   output:   Buffer for the filtered samples, containing blockSize elements; it 
+//             may be the same buffer as input.
+//
+// Output sample j is the sum of filter[k] * x[j-k] for k from 0 to filterSize-1, 
+// where x is the stream of samples passed to this channel, preceded by silence.
+//
+// Returns 1 if the block could be filtered, or 0 if one of the parameters was 
+// invalid or a temporary buffer could not be allocated.
+//
+int CkFftConvolverProcess(CkFftConvolver* conv, int channel, const float* input, float* output);
+
+
+
+// Clear the samples kept by all the channels of a convolver, so they can start new
+// streams.
+//
+// Returns 1 if the object could be reset, or 0 if it was invalid.
+//
+int CkFftConvolverReset(CkFftConvolver* conv);
+
+
+
+// Destroy a convolver.
+//
+// If you let CkFftConvolverInit() allocate its own memory buffer, then this will 
+// free that buffer.
+//
+void CkFftConvolverShutdown(CkFftConvolver* conv);
+
+
+
+// Create an object for filtering a stream of real samples with a long FIR filter 
+// (such as the impulse response of a reverb) at low latency, using non-uniform 
+// partitioned convolution.
+//
+// Parameters:
+//   context:          A context pointer from CkFftInit(), for both directions.
+//   filter:           The impulse response of the filter, containing filterSize 
+//                     values; it is used only to compute the spectra of its 
+//                     partitions.
+//   filterSize:       The number of values in the impulse response; must be at 
+//                     least 1.
+//   blockSize:        The number of samples passed to each call to 
+//                     CkFftPartitionedConvolverProcess(); must be a power of 2.
+//   maxPartitionSize: The largest partition size; must be a power of 2, at least
+//                     blockSize.  2*maxPartitionSize must not be greater than the 
+//                     value of nMax specified when the context was created.
+//   buf:              Optional memory buffer in which to allocate the object.
+//   bufSize:          Optional pointer to size of memory buffer, in bytes.
+//
+// The filter is divided into partitions, each filtered with the overlap-save 
+// method, using real FFTs of twice the partition size.  The spectra of the 
+// partitions are computed once, here, and the spectrum of each block of input is 
+// kept in a frequency-domain delay line, so it is computed once for all the
+// partitions of its size.  The first partitions are of blockSize samples, and are
+// computed in CkFftPartitionedConvolverProcess(), so the output of each block is
+// available as soon as its input is, with no latency.  Later partitions are 4 
+// times the size of the ones before, up to maxPartitionSize, and each size starts
+// at twice the partition size into the filter, so that its output for a block of 
+// input is not needed until one block later.  Those "tail" tasks can be run on a 
+// worker thread in the meantime, with CkFftPartitionedConvolverRunTail().  For
+// example, for a 3 s reverb at 48 kHz, with a blockSize of 64 and a 
+// maxPartitionSize of 8192, the audio thread computes 8 partitions of 64 samples
+// for each block, and the rest of the filter is computed in 6 partitions each of 
+// 256 and 1024 samples, 2 of 4096 samples, and 16 of 8192 samples, spread over 
+// the time between deadlines.
+//
+// If a tail task has not been finished when its output is needed, 
+// CkFftPartitionedConvolverProcess() runs it (or, if another thread is running 
+// it, waits for it), so the output is always complete; 
+// CkFftPartitionedConvolverGetMissedDeadlines() gives the number of times this
+// has happened.  If no worker thread is used, all tasks are run this way.
+//
+// The output does not depend on the scale set with CkFftSetScale().  Memory is 
+// allocated as for CkFftInit(), and the context must not be destroyed before the 
+// convolver.
+//
+// Returns a pointer to the object if one could be created, or NULL if not.
+//
+CkFftPartitionedConvolver* CkFftPartitionedConvolverInit(CkFftContext* context, const float* filter, CkFftSize filterSize, CkFftSize blockSize, CkFftSize maxPartitionSize, void* buf, size_t* bufSize);
+
+
+
+// Filter a block of samples with a partitioned convolver.
+//
+// Parameters:
+//   conv:     A pointer from CkFftPartitionedConvolverInit().
+//   input:    Real input samples, containing blockSize elements.
+//   output:   Buffer for the filtered samples, containing blockSize elements; it 
+//             may be the same buffer as input.
+//
+// Output sample j is the sum of filter[k] * x[j-k] for k from 0 to filterSize-1, 
+// where x is the stream of samples passed to the convolver, preceded by silence.
+// Each block may make tail tasks ready to run (see 
+// CkFftPartitionedConvolverRunTail()).  This must not be called on more than one
+// thread at once.
+//
+// Returns 1 if the block could be filtered, or 0 if one of the parameters was 
+// invalid.
+//
+int CkFftPartitionedConvolverProcess(CkFftPartitionedConvolver* conv, const float* input, float* output);
+
+
+
+// Run the tail tasks of a partitioned convolver that are ready.
+//
+// Parameters:
+//   conv:       A pointer from CkFftPartitionedConvolverInit().
+//   taskCount:  Optional pointer to the number of tasks run.
+//
+// Call this from a worker thread, for example when signalled after each call to 
+// CkFftPartitionedConvolverProcess(); it runs the tasks that are ready and that 
+// no other thread has started, earliest deadline first, until there are none left.
+// It may be called on several threads at once, and at the same time as 
+// CkFftPartitionedConvolverProcess().  Each task must be finished within the 
+// time it takes to process partition-size samples of input, or the audio thread 
+// will have to wait for it.
+//
+// Returns 1 if the tasks could be run, or 0 if the object was invalid.
+//
+int CkFftPartitionedConvolverRunTail(CkFftPartitionedConvolver* conv, int* taskCount);
+
+
+
+// Get the number of tail tasks that were not finished by the time their output 
+// was needed, since the convolver was created or reset.
+//
+// Returns the number of tasks, or 0 if the object was invalid.
+//
+CkFftSize CkFftPartitionedConvolverGetMissedDeadlines(CkFftPartitionedConvolver* conv);
+
+
+
+// Clear the samples kept by a partitioned convolver, so it can start a new stream.
+// This must not be called while any thread is using the object.
+//
+// Returns 1 if the object could be reset, or 0 if it was invalid.
+//
+int CkFftPartitionedConvolverReset(CkFftPartitionedConvolver* conv);
+
+
+
+// Destroy a partitioned convolver.
+//
+// If you let CkFftPartitionedConvolverInit() allocate its own memory buffer, then
+// this will free that buffer.
+//
+void CkFftPartitionedConvolverShutdown(CkFftPartitionedConvolver* conv);
+
+
+
+// Create an object for filtering several streams of real samples with a matrix of
+// FIR filters, giving several output streams, such as for binaural or ambisonic 
+// rendering.
+//
+// Parameters:
+//   context:      A context pointer from CkFftInit(), for both directions.
+//   filters:      The impulse responses of the filters, inputCount*outputCount 
+//                 pointers, each to filterSize values; the filter from input i to 
+//                 output o is filters[o*inputCount + i].  A NULL pointer means 
+//                 that input does not contribute to that output.  They are used 
+//                 only to compute the filters' spectra.
+//   filterSize:   The number of values in each impulse response; must be at least 1.
+//   inputCount:   The number of input streams; must be at least 1.
+//   outputCount:  The number of output streams; must be at least 1.
+//   blockSize:    The number of samples of each stream passed to each call to 
+//                 CkFftConvolverMatrixProcess(); must be at least 1.
+//   buf:          Optional memory buffer in which to allocate the object.
+//   bufSize:      Optional pointer to size of memory buffer, in bytes.
+//
+// Output o is the sum over i of input i filtered with filters[o*inputCount + i], 
+// computed as by CkFftConvolverInit() with the same filterSize and blockSize, so 
+// the FFT size is the same, and must not be greater than the value of nMax 
+// specified when the context was created.  But each input is transformed only 
+// once per block, the products of the input and filter spectra are summed in the 
+// frequency domain, and only one inverse FFT is needed for each output.  The sums
+// are computed a few hundred frequency bins at a time, so the inputs' spectra for 
+// those bins stay in the cache while they are used for every output.
+//
+// The output does not depend on the scale set with CkFftSetScale().  Memory is
+// allocated as for CkFftInit(), and the context must not be destroyed before the 
+// object.  The object contains the state of the streams, so it must not be used 
+// on more than one thread at once.
+//
+// Returns a pointer to the object if one could be created, or NULL if not.
+//
+CkFftConvolverMatrix* CkFftConvolverMatrixInit(CkFftContext* context, const float* const* filters, CkFftSize filterSize, int inputCount, int outputCount, CkFftSize blockSize, void* buf, size_t* bufSize);
+
+
+
+// Filter a block of samples of each input of a convolver matrix.
+//
+// Parameters:
+//   matrix:   A pointer from CkFftConvolverMatrixInit().
+//   inputs:   inputCount pointers, each to blockSize real input samples.
+//   outputs:  outputCount pointers, each to a buffer for blockSize filtered 
+//             samples; they may be the same buffers as the inputs.
+//
+// Returns 1 if the block could be filtered, or 0 if one of the parameters was 
+// invalid.
+//
+int CkFftConvolverMatrixProcess(CkFftConvolverMatrix* matrix, const float* const* inputs, float* const* outputs);
+
+
+
+// Clear the samples kept for the inputs of a convolver matrix, so it can start new
+// streams.
+//
+// Returns 1 if the object could be reset, or 0 if it was invalid.
+//
+int CkFftConvolverMatrixReset(CkFftConvolverMatrix* matrix);
+
+
+
+// Destroy a convolver matrix.
+//
+// If you let CkFftConvolverMatrixInit() allocate its own memory buffer, then this 
+// will free that buffer.
+//
+void CkFftConvolverMatrixShutdown(CkFftConvolverMatrix* matrix);
+
+
+
+// Create an object for estimating the delay between two signals by generalized
+// cross-correlation, such as for acoustic source localization.
+//
+// Parameters:
+//   context:    A context pointer from CkFftInit(), for both directions.
+//   n:          The size of the FFTs.  This must be a power of 2, at least 2, and 
+//               must not be greater than the value of nMax specified when the 
+//               context was created.
+//   weighting:  The weighting of the cross-spectrum.
+//   smoothing:  For kCkFftWeighting_Scot, the factor by which the power spectra 
+//               kept by the object are multiplied for each frame before the new 
+//               frame's power spectra, multiplied by 1 - smoothing, are added 
+//               (the first frame's are used as they are); must be at least 0 
+//               and less than 1.  It is not used for other weightings.
+//   buf:        Optional memory buffer in which to allocate the object.
+//   bufSize:    Optional pointer to size of memory buffer, in bytes.
+//
+// For each frame, the cross-spectrum X*conj(Y) of the two signals is weighted, 
+// and transformed back into the correlation of the signals at each lag.  The 
+// weighting and the scaling, and the rotation that puts lag 0 in the middle of 
+// the output, are done in one pass over the spectra, with NEON when it is 
+// available.  With kCkFftWeighting_None, the output is the plain cross-correlation:
+// the value for lag k is the sum of x[i+k]*y[i] over all i.  With 
+// kCkFftWeighting_Phat, each bin of the cross-spectrum is divided by its magnitude,
+// which sharpens the peak and makes it less sensitive to reverberation; a pure 
+// delay gives a peak of 1.  kCkFftWeighting_Scot divides each bin by the geometric
+// mean of the power spectra of the two signals, smoothed over frames; with a 
+// smoothing of 0, this is the same as kCkFftWeighting_Phat.  The output does not 
+// depend on the scale set with CkFftSetScale().
+//
+// Memory is allocated as for CkFftInit(), and the context must not be destroyed 
+// before the object.  The object contains buffers and the smoothed spectra, so it
+// must not be used on more than one thread at once.
+//
+// Returns a pointer to the object if one could be created, or NULL if not.
+//
+CkFftCorrelator* CkFftCorrelatorInit(CkFftContext* context, CkFftSize n, CkFftWeighting weighting, float smoothing, void* buf, size_t* bufSize);
+
+
+
+// Compute the correlation of two signals.
+//
+// Parameters:
+//   corr:    A pointer from CkFftCorrelatorInit().
+//   x:       First signal, containing count elements.
+//   y:       Second signal, containing count elements.
+//   count:   The number of samples of each signal; must be at least 1, and no more 
+//            than n/2, so that the correlation doesn't wrap around.
+//   output:  Buffer for the correlation, containing n elements; the value for lag k,
+//            from -n/2 to n/2 - 1, is output[n/2 + k].  A positive lag means x is 
+//            later than y.
+//
+// The signals are zero-padded to n samples.
+//
+// Returns 1 if the correlation could be computed, or 0 if one of the parameters 
+// was invalid.
+//
+int CkFftCorrelatorProcess(CkFftCorrelator* corr, const float* x, const float* y, CkFftSize count, float* output);
+
+
+
+// Compute the correlation of two signals from their spectra.
+//
+// Parameters:
+//   corr:    A pointer from CkFftCorrelatorInit().
+//   x:       Spectrum of the first signal, containing n/2+1 elements.
+//   y:       Spectrum of the second signal, containing n/2+1 elements.
+//   output:  Buffer for the correlation, containing n elements, as for 
+//            CkFftCorrelatorProcess().
+//
+// This is the same as CkFftCorrelatorProcess(), but takes spectra from 
+// CkFftRealForward() (of size n, with the same context), so when each signal is 
+// correlated with several others, such as for every pair of an array of 
+// microphones, each is transformed only once.  Use one object for each pair, 
+// since the smoothed spectra are kept for the pair.
+//
+// Returns 1 if the correlation could be computed, or 0 if one of the parameters 
+// was invalid.
+//
+int CkFftCorrelatorProcessSpectra(CkFftCorrelator* corr, const CkFftComplex* x, const CkFftComplex* y, float* output);
+
+
+
+// Find the peak of a correlation.
+//
+// Parameters:
+//   corr:         A pointer from CkFftCorrelatorInit().
+//   correlation:  The output of CkFftCorrelatorProcess() or 
+//                 CkFftCorrelatorProcessSpectra(), containing n elements.
+//   maxLag:       The largest lag to search, in either direction; must be at least 0.
+//   lag:          Optional pointer to the lag of the peak, in samples.
+//   value:        Optional pointer to the value of the peak.
+//
+// The largest value from lag -maxLag to maxLag is found, and a parabola is fitted
+// to it and the values on either side, giving the lag and the value of the peak to
+// a fraction of a sample.
+//
+// Returns 1 if the peak could be found, or 0 if one of the parameters was invalid.
+//
+int CkFftCorrelatorFindPeak(CkFftCorrelator* corr, const float* correlation, CkFftSize maxLag, float* lag, float* value);
+
+
+
+// Clear the smoothed spectra of a correlator, so it can start on new signals.
+//
+// Returns 1 if the object could be reset, or 0 if it was invalid.
+//
+int CkFftCorrelatorReset(CkFftCorrelator* corr);
+
+
+
+// Destroy a correlator.
+//
+// If you let CkFftCorrelatorInit() allocate its own memory buffer, then this will 
+// free that buffer.
+//
+void CkFftCorrelatorShutdown(CkFftCorrelator* corr);
+
+
+
+// Create an object for computing log-mel spectrograms or mel-frequency cepstral
+// coefficients (MFCCs) of streams of real samples, such as features for speech 
+// recognition.
+//
+// Parameters:
+//   context:      A context pointer from CkFftInit(), for the forward direction.
+//   frameSize:    The number of samples in each frame, which is the size of each 
+//                 real FFT.  This must be a power of 2 and must not be greater 
+//                 than the value of nMax specified when the context was created.
+//   hopSize:      The number of samples between the starts of successive frames;
+//                 must be at least 1 and no greater than frameSize.
+//   window:       Optional window, containing frameSize values, by which each 
+//                 frame is multiplied (see CkFftWindow()); it is copied.  If this 
+//                 is NULL, a rectangular window is used.
+//   sampleRate:   The sample rate of the streams, in Hz.
+//   bandCount:    The number of mel bands; must be at least 1 and no greater than
+//                 frameSize/2.
+//   minFreq:      The lower edge of the lowest band, in Hz; must be at least 0.
+//   maxFreq:      The upper edge of the highest band, in Hz; must be greater than 
+//                 minFreq and no greater than sampleRate/2.
+//   coeffCount:   The number of cepstral coefficients to output for each frame, 
+//                 no greater than bandCount; or 0 to output the log-mel energies 
+//                 of the bands.
+//   channelCount: The number of streams; must be at least 1.
+//   buf:          Optional memory buffer in which to allocate the object.
+//   bufSize:      Optional pointer to size of memory buffer, in bytes.
+//
+// For each frame, the power spectrum is computed as CkFftRealPowerSpectrum() 
+// gives it (including the scaling of the context; see CkFftSetScale()), with the
+// window applied as the FFT reads the frame.  It is passed through a bank of 
+// triangular filters, evenly spaced on the mel scale (2595*log10(1 + f/700)), 
+// each with a peak of 1 and overlapping half of the ones next to it, as in HTK.  
+// The filterbank is computed once, here, and only the nonzero weights of each 
+// filter are stored, so each band is a short dot product.  The natural log of 
+// each band's energy (limited to log(1e-10), so silence doesn't give -infinity)
+// is taken; if coeffCount is not 0, the first coeffCount values of the 
+// orthonormal DCT-II of the log energies are the MFCCs.  So each frame gives 
+// bandCount values, or coeffCount values if it is not 0.
+//
+// The channels share the window, filterbank and DCT, and each keeps its last
+// frameSize samples, so many streams can be processed with one object.  Each 
+// frame needs a temporary buffer; reserve buffers in the context with 
+// CkFftReserveScratch(), or one will be allocated for each call.  Otherwise,
+// memory is allocated as for CkFftInit(), and the context must not be destroyed
+// before the object.  Different channels can be processed on different threads 
+// at once, but each channel must not be used on more than one thread at once.
+//
+// Returns a pointer to the object if one could be created, or NULL if not.
+//
+CkFftMelFeatures* CkFftMelFeaturesInit(CkFftContext* context, CkFftSize frameSize, CkFftSize hopSize, const float* window, float sampleRate, int bandCount, float minFreq, float maxFreq, int coeffCount, int channelCount, void* buf, size_t* bufSize);
+
+
+
+// Get the number of frames that passing a number of samples to 
+// CkFftMelFeaturesProcess() for one channel will output.
+//
+// Parameters:
+//   mel:      A pointer from CkFftMelFeaturesInit().
+//   channel:  The index of the channel, from 0 to channelCount-1.
+//   count:    The number of samples.
+//
+// Returns the number of frames, or 0 if one of the parameters was invalid.
+//
+CkFftSize CkFftMelFeaturesGetFrameCount(CkFftMelFeatures* mel, int channel, CkFftSize count);
+
+
+
+// Add samples to the stream of one channel, and output the features of each frame
+// completed.
+//
+// Parameters:
+//   mel:        A pointer from CkFftMelFeaturesInit().
+//   channel:    The index of the channel, from 0 to channelCount-1.
+//   input:      Real input samples, containing count elements.
+//   count:      The number of samples; may be 0.
+//   output:     Buffer for the features of the frames, each of bandCount values 
+//               (or coeffCount, if it is not 0), one after another; it must be 
+//               large enough for the number of frames given by 
+//               CkFftMelFeaturesGetFrameCount().
+//   frameCount: Optional pointer to the number of frames written to output.
+//
+// Frames are divided as by CkFftStftProcess(): the stream is treated as if it 
+// were preceded by silence, so the first frame is output after hopSize samples, 
+// and frame i contains the samples up to (i+1)*hopSize - 1.
+//
+// Returns 1 if the samples could be processed, or 0 if one of the parameters was
+// invalid or a temporary buffer could not be allocated (in which case the samples
+// are not added).
+//
+int CkFftMelFeaturesProcess(CkFftMelFeatures* mel, int channel, const float* input, CkFftSize count, float* output, CkFftSize* frameCount);
+
+
+
+// Compute the features of frames of a whole signal at once.
+//
+// Parameters:
+//   mel:        A pointer from CkFftMelFeaturesInit().
+//   input:      Real input samples, containing (frameCount-1)*hopSize + frameSize
+//               elements.
+//   frameCount: The number of frames; may be 0.
+//   output:     Buffer for the features of the frames, each of bandCount values 
+//               (or coeffCount, if it is not 0), one after another.
+//
+// Frame i is the frameSize samples starting at input[i*hopSize].  This does not
+// use or change the state of any channel, so it can be called on several threads 
+// at once.
+//
+// Returns 1 if the frames could be processed, or 0 if one of the parameters was 
+// invalid or a temporary buffer could not be allocated.
+//
+int CkFftMelFeaturesProcessFrames(CkFftMelFeatures* mel, const float* input, CkFftSize frameCount, float* output);
+
+
+
+// Clear the samples kept by all the channels, so they can start new streams.
+//
+// Returns 1 if the object could be reset, or 0 if it was invalid.
+//
+int CkFftMelFeaturesReset(CkFftMelFeatures* mel);
+
+
+
+// Destroy a mel features object.
+//
+// If you let CkFftMelFeaturesInit() allocate its own memory buffer, then this will
+// free that buffer.
+//
+void CkFftMelFeaturesShutdown(CkFftMelFeatures* mel);
+
+
+
+// Create a context for double-precision FFTs.
+//
+// Parameters:
+//   nMax:       Maximum number of elements in the FFTs to be performed with this 
+//               context; must be a power of 2.
+//   direction:  Direction of the FFTs to be performed with this context.
+//   buf:        Optional memory buffer in which to allocate the context.
+//   bufSize:    Optional pointer to size of memory buffer, in bytes.
+//
+// This works the same as CkFftInit(), but the context holds double-precision 
+// twiddle factors, so it takes twice as much memory.
+//
+// Returns a context pointer if one could be created, or NULL if not.
+//
+CkFftContextD* CkFftInitD(int nMax, CkFftDirection direction, void* buf, size_t* bufSize);
+
+
+
+// Perform FFTs on double-precision data.
+//
+// Parameters:
+//   context: A context pointer from CkFftInitD().
+//   n:       The size of the FFT.  This must be a power of 2 and must not be greater
+//            than the value of nMax specified when the context was created.
+//   input:   Input data, as for the corresponding float functions.
+//   output:  Buffer for output data, as for the corresponding float functions.
+//   tmpBuf:  Optional temporary buffer, as for CkFftRealInverse().
+//
+// These work the same as CkFftComplexForward(), CkFftComplexInverse(), 
+// CkFftRealForward(), and CkFftRealInverse(), and compute the same radix-4 steps,
+// but in double precision throughout.  They can be performed in-place, with the 
+// same buffer sizes as the float versions.  No scaling is applied (so, as with the
+// float versions, the output of CkFftRealForwardD() is scaled by 2).
+//
+// Returns 1 if the FFT could be performed, or 0 if one of the parameters was invalid.
+//
+int CkFftComplexForwardD(CkFftContextD* context, int n, const CkFftComplexD* input, CkFftComplexD* output);
+int CkFftComplexInverseD(CkFftContextD* context, int n, const CkFftComplexD* input, CkFftComplexD* output);
+int CkFftRealForwardD(CkFftContextD* context, int n, const double* input, CkFftComplexD* output);
+int CkFftRealInverseD(CkFftContextD* context, int n, const CkFftComplexD* input, double* output, CkFftComplexD* tmpBuf);
+
+
+
+// Destroy a double-precision FFT context.
+//
+// If you let CkFftInitD() allocate its own memory buffer, then this will free that buffer.
+//
+void CkFftShutdownD(CkFftContextD*);
+
+
+
+// Create a context for fixed-point FFTs.
+//
+// Parameters:
+//   nMax:       Maximum number of elements in the FFTs to be performed with this 
+//               context; must be a power of 2.
+//   buf:        Optional memory buffer in which to allocate the context.
+//   bufSize:    Optional pointer to size of memory buffer, in bytes.
+//
+// These work the same as CkFftInit(), except that the context holds fixed-point 
+// twiddle factors, and can be used for FFTs in either direction.  A Q15 context
+// takes a quarter of the memory of a float context for both directions.
+//
+// Returns a context pointer if one could be created, or NULL if not.
+//
+CkFftContextQ15* CkFftInitQ15(int nMax, void* buf, size_t* bufSize);
+CkFftContextQ31* CkFftInitQ31(int nMax, void* buf, size_t* bufSize);
+
+
+
+// Perform a forward or inverse FFT on complex fixed-point data.
+//
+// Parameters:
+//   context:  A context pointer from CkFftInitQ15() or CkFftInitQ31().
+//   n:        The size of the FFT.  This must be a power of 2 and must not be 
+//             greater than the value of nMax specified when the context was created.
+//   input:    Complex input data, containing n elements.
+//   output:   Buffer for complex output data, containing n elements.
+//   exponent: Pointer to an integer that receives the block exponent of the output.
+//
+// The FFTs use block floating point: before each stage, the data is shifted so 
+// that it uses as much of the range of the data type as possible without 
+// overflowing, and the shifts are totalled in *exponent.  The result of the FFT 
+// (which, as with CkFftComplexForward(), is not scaled by 1/n) is 
+//   output[i] * 2^(*exponent)
+// in the same units as the input.  The exponent can be negative if the input is 
+// small.  For example, an exponent of 3 means the output values must be multiplied
+// by 8 to give the spectrum of the input.
+//
+// Each butterfly is computed with headroom for its worst case, using saturating 
+// arithmetic on NEON.  The RMS error of Q15 FFTs is about 0.1% of the RMS output 
+// (about 55 dB below it for n = 4096); Q31 FFTs are about as accurate as float FFTs.
+//
+// The FFT can be performed in-place, by passing the same buffer for input and output.
+// Otherwise, input and output must not overlap.
+//
+// Returns 1 if the FFT could be performed, or 0 if one of the parameters was invalid.
+//
+int CkFftComplexForwardQ15(CkFftContextQ15* context, int n, const CkFftComplexQ15* input, CkFftComplexQ15* output, int* exponent);
+int CkFftComplexInverseQ15(CkFftContextQ15* context, int n, const CkFftComplexQ15* input, CkFftComplexQ15* output, int* exponent);
+int CkFftComplexForwardQ31(CkFftContextQ31* context, int n, const CkFftComplexQ31* input, CkFftComplexQ31* output, int* exponent);
+int CkFftComplexInverseQ31(CkFftContextQ31* context, int n, const CkFftComplexQ31* input, CkFftComplexQ31* output, int* exponent);
+
+
+
+// Destroy a fixed-point FFT context.
+//
+// If you let CkFftInitQ15() or CkFftInitQ31() allocate its own memory buffer, then 
+// this will free that buffer.
+//
+void CkFftShutdownQ15(CkFftContextQ15*);
+void CkFftShutdownQ31(CkFftContextQ31*);
 
 
 
@@ -0,0 +1,249 @@
+#include "ckfft/platform.h"
+#include "ckfft/debug.h"
+#include "ckfft/alloc.h"
+#include <stdlib.h>
+#include <assert.h>
+
+#if CKFFT_PLATFORM_WIN
+#  include <windows.h>
+#elif CKFFT_PLATFORM_ANDROID || CKFFT_PLATFORM_MACOS
+#  include <sys/mman.h>
+#endif
+
+#if CKFFT_PLATFORM_MACOS
+#  include <mach/vm_statistics.h>
+#endif
+
+
+namespace ckfft
+{
+
+namespace
+{
+
+void* defaultAlloc(size_t size, void*)
+{
+    return malloc(size);
+}
+
+void defaultFree(void* p, void*)
+{
+    ::free(p);
+}
+
+Allocator g_allocator = { defaultAlloc, defaultFree, NULL };
+
+////////////////////////////////////////
+// huge pages
+
+// Buffers at least this large are allocated with huge pages, if enabled.
+const size_t k_hugePageThreshold = 4 * 1024 * 1024;
+
+bool g_hugePages = false;
+
+// size of huge pages, or 0 if they are not supported
+size_t getHugePageSize()
+{
+#if CKFFT_PLATFORM_ANDROID
+    return 2 * 1024 * 1024;
+#elif CKFFT_PLATFORM_MACOS && defined(VM_FLAGS_SUPERPAGE_SIZE_2MB)
+    return 2 * 1024 * 1024;
+#elif CKFFT_PLATFORM_WIN
+    return GetLargePageMinimum();
+#else
+    return 0;
+#endif
+}
+
+// Huge-page allocations start with this header, in the first k_alignment bytes.
+struct PageHeader
+{
+    void* base;  // start of mapping
+    size_t size; // size of mapping
+};
+
+void unmapPages(void* base, size_t size)
+{
+#if CKFFT_PLATFORM_ANDROID || CKFFT_PLATFORM_MACOS
+    munmap(base, size);
+#elif CKFFT_PLATFORM_WIN
+    VirtualFree(base, 0, MEM_RELEASE);
+#endif
+}
+
+// Allocate memory backed by huge pages; returns NULL if that is not possible.
+void* hugePageAlloc(size_t size, void*)
+{
+    size_t pageSize = getHugePageSize();
+    if (!pageSize)
+    {
+        return NULL;
+    }
+    size_t mapSize = (size + k_alignment + pageSize - 1) / pageSize * pageSize;
+    void* base = NULL;
+    char* start = NULL;
+
+#if CKFFT_PLATFORM_ANDROID
+#  ifdef MAP_HUGETLB
+    // explicit huge pages; this fails if none have been reserved
+    base = mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (base != MAP_FAILED)
+    {
+        start = (char*) base;
+    }
+#  endif
+    if (!start)
+    {
+        // transparent huge pages; map an extra page so the start can be aligned to
+        // a huge page boundary
+        mapSize += pageSize;
+        base = mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED)
+        {
+            return NULL;
+        }
+        start = (char*) (((size_t) base + pageSize - 1) / pageSize * pageSize);
+#  ifdef MADV_HUGEPAGE
+        // (just advice; if transparent huge pages are disabled, this fails and we 
+        // get normal pages)
+        madvise(start, mapSize - (start - (char*) base), MADV_HUGEPAGE);
+#  endif
+    }
+#elif CKFFT_PLATFORM_MACOS && defined(VM_FLAGS_SUPERPAGE_SIZE_2MB)
+    base = mmap(NULL, mapSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, VM_FLAGS_SUPERPAGE_SIZE_2MB, 0);
+    if (base == MAP_FAILED)
+    {
+        return NULL;
+    }
+    start = (char*) base;
+#elif CKFFT_PLATFORM_WIN
+    // requires the "lock pages in memory" privilege
+    base = VirtualAlloc(NULL, mapSize, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+    if (!base)
+    {
+        return NULL;
+    }
+    start = (char*) base;
+#endif
+
+    if (!start)
+    {
+        return NULL;
+    }
+
+    PageHeader* header = (PageHeader*) start;
+    header->base = base;
+    header->size = mapSize;
+    return start + k_alignment;
+}
+
+void hugePageFree(void* p, void*)
+{
+    PageHeader* header = (PageHeader*) ((char*) p - k_alignment);
+    unmapPages(header->base, header->size);
+}
+
+}
+
+void* Allocator::allocate(size_t size) const
+{
+    return allocFunc(size, userData);
+}
+
+void Allocator::free(void* p) const
+{
+    if (p)
+    {
+        freeFunc(p, userData);
+    }
+}
+
+Allocator getAllocator()
+{
+    return g_allocator;
+}
+
+void setAllocator(CkFftAllocFunc allocFunc, CkFftFreeFunc freeFunc, void* userData)
+{
+    if (allocFunc && freeFunc)
+    {
+        g_allocator.allocFunc = allocFunc;
+        g_allocator.freeFunc = freeFunc;
+        g_allocator.userData = userData;
+    }
+    else
+    {
+        g_allocator.allocFunc = defaultAlloc;
+        g_allocator.freeFunc = defaultFree;
+        g_allocator.userData = NULL;
+    }
+}
+
+bool setHugePages(bool enable)
+{
+    g_hugePages = enable;
+    return (getHugePageSize() != 0);
+}
+
+////////////////////////////////////////
+
+AlignedBuf::AlignedBuf(size_t objectSize) :
+    m_reqSize(alignSize(objectSize)),
+    m_numTables(0),
+    m_start(NULL),
+    m_allocBuf(NULL),
+    m_allocator(ckfft::getAllocator())
+{}
+
+void AlignedBuf::addTable(size_t size)
+{
+    assert(m_numTables < k_maxTables);
+    m_tableOffsets[m_numTables++] = m_reqSize;
+    m_reqSize += alignSize(size);
+}
+
+size_t AlignedBuf::getRequiredSize() const
+{
+    // slack for aligning the start of the buffer
+    return m_reqSize + k_alignment - 1;
+}
+
+void* AlignedBuf::allocate(void* userBuf)
+{
+    void* buf = userBuf;
+    if (!buf)
+    {
+        size_t size = getRequiredSize();
+
+        // large buffers may use huge pages, unless the user has set an allocator
+        if (g_hugePages && m_allocator.allocFunc == defaultAlloc && size >= k_hugePageThreshold)
+        {
+            Allocator pageAllocator = { hugePageAlloc, hugePageFree, NULL };
+            buf = pageAllocator.allocate(size);
+            if (buf)
+            {
+                m_allocator = pageAllocator;
+            }
+        }
+
+        if (!buf)
+        {
+            buf = m_allocator.allocate(size);
+            if (!buf)
+            {
+                return NULL;
+            }
+        }
+        m_allocBuf = buf;
+    }
+    m_start = (char*) alignPointer(buf);
+    return m_start;
+}
+
+void* AlignedBuf::getTable(int i) const
+{
+    assert(m_start && i < m_numTables);
+    return m_start + m_tableOffsets[i];
+}
+
+}
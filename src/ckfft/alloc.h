@@ -0,0 +1,79 @@
+#pragma once
+#include "ckfft/ckfft.h"
+#include <stddef.h>
+
+
+namespace ckfft
+{
+
+// Alignment of contexts and their tables, in bytes (a cache line, and enough for
+// any SIMD loads).
+const size_t k_alignment = 64;
+
+inline size_t alignSize(size_t size)
+{
+    return (size + k_alignment - 1) & ~(k_alignment - 1);
+}
+
+inline void* alignPointer(void* p)
+{
+    return (void*) alignSize((size_t) p);
+}
+
+// The allocation functions set with CkFftSetAllocator(), or malloc() and free().
+// Memory is freed with the allocator it was allocated with, so objects keep a copy.
+struct Allocator
+{
+    CkFftAllocFunc allocFunc;
+    CkFftFreeFunc freeFunc;
+    void* userData;
+
+    void* allocate(size_t size) const;
+    void free(void* p) const;
+};
+
+// Get or set the current allocator; NULL functions select malloc() and free().
+Allocator getAllocator();
+void setAllocator(CkFftAllocFunc allocFunc, CkFftFreeFunc freeFunc, void* userData);
+
+// Set whether large buffers allocated with the default allocator use huge pages;
+// returns true if huge pages are supported on this platform.
+bool setHugePages(bool enable);
+
+// Memory for an object followed by tables, each starting on a k_alignment boundary.
+// The buffer is the user's buffer, if one is given, or is allocated with the 
+// current allocator (or with huge pages; see setHugePages()); either way it 
+// includes slack for aligning its start.
+class AlignedBuf
+{
+public:
+    // sizes of the object and each table, in bytes
+    explicit AlignedBuf(size_t objectSize);
+    void addTable(size_t size);
+
+    // size of buffer needed, in bytes
+    size_t getRequiredSize() const;
+
+    // Allocate the buffer, or use the user's buffer if it is not NULL; returns the
+    // aligned start of the buffer, or NULL if allocation failed.
+    void* allocate(void* userBuf);
+
+    // pointer to the ith table, after allocate() 
+    void* getTable(int i) const;
+
+    // memory to free with allocator (NULL if the user's buffer was used)
+    void* getAllocatedBuf() const { return m_allocBuf; }
+    const Allocator& getAllocator() const { return m_allocator; }
+
+    enum { k_maxTables = 4 };
+
+private:
+    size_t m_reqSize;
+    size_t m_tableOffsets[k_maxTables];
+    int m_numTables;
+    char* m_start;
+    void* m_allocBuf;
+    Allocator m_allocator;
+};
+
+}
@@ -13,16 +13,46 @@ LOCAL_SRC_FILES := \
     ../../fft.cpp \
     ../../fft_default.cpp \
     ../../fft_real.cpp \
-    ../../fft_real_default.cpp 
+    ../../fft_real_default.cpp \
+    ../../fft_codelets_default.cpp \
+    ../../spectral.cpp \
+    ../../spectral_default.cpp \
+    ../../convert.cpp \
+    ../../fft_half.cpp \
+    ../../context_fixed.cpp \
+    ../../fft_fixed.cpp \
+    ../../fft_fixed_default.cpp \
+    ../../context_double.cpp \
+    ../../fft_double.cpp \
+    ../../alloc.cpp \
+    ../../numa.cpp \
+    ../../scratch.cpp \
+    ../../stft.cpp \
+    ../../window.cpp \
+    ../../istft.cpp \
+    ../../convolver.cpp \
+    ../../partitioned_convolver.cpp \
+    ../../convolver_matrix.cpp \
+    ../../correlator.cpp \
+    ../../mel_features.cpp \
+    ../../fft_pruned.cpp 
 
 ifeq ($(TARGET_ARCH_ABI),armeabi-v7a)
 LOCAL_SRC_FILES += \
     ../../fft_neon.cpp.neon \
-    ../../fft_real_neon.cpp.neon
+    ../../fft_real_neon.cpp.neon \
+    ../../fft_codelets_neon.cpp.neon \
+    ../../spectral_neon.cpp.neon \
+    ../../convert_neon.cpp.neon \
+    ../../fft_fixed_neon.cpp.neon
 else
 LOCAL_SRC_FILES += \
     ../../fft_neon.cpp \
-    ../../fft_real_neon.cpp
+    ../../fft_real_neon.cpp \
+    ../../fft_codelets_neon.cpp \
+    ../../spectral_neon.cpp \
+    ../../convert_neon.cpp \
+    ../../fft_fixed_neon.cpp
 endif
 LOCAL_C_INCLUDES := $(LOCAL_PATH)/../../../../inc $(LOCAL_PATH)/../../../../src
 LOCAL_EXPORT_C_INCLUDES := $(LOCAL_PATH)/../../../../inc
@@ -3,15 +3,50 @@
 #include "ckfft/ckfft.h"
 #include "ckfft/fft.h"
 #include "ckfft/fft_real.h"
+#include "ckfft/fft_half.h"
+#include "ckfft/fft_fixed.h"
+#include "ckfft/fft_double.h"
+#include "ckfft/fft_pruned.h"
+#include "ckfft/spectral.h"
 #include "ckfft/context.h"
+#include "ckfft/context_fixed.h"
+#include "ckfft/context_double.h"
+#include "ckfft/alloc.h"
+#include "ckfft/numa.h"
+#include "ckfft/scratch.h"
+#include "ckfft/stft.h"
+#include "ckfft/istft.h"
+#include "ckfft/convolver.h"
+#include "ckfft/partitioned_convolver.h"
+#include "ckfft/convolver_matrix.h"
+#include "ckfft/correlator.h"
+#include "ckfft/mel_features.h"
+#include "ckfft/window.h"
 #include "ckfft/math_util.h"
+#include <limits.h>
 
 using namespace ckfft;
 
 extern "C"
 {
 
-CkFftContext* CkFftInit(int maxCount, CkFftDirection direction, void* userBuf, size_t* userBufSize) 
+int CkFftSetAllocator(CkFftAllocFunc allocFunc, CkFftFreeFunc freeFunc, void* userData)
+{
+    if (!allocFunc != !freeFunc)
+    {
+        return 0;
+    }
+
+    setAllocator(allocFunc, freeFunc, userData);
+    return 1;
+}
+
+int CkFftSetHugePages(int enable)
+{
+    return setHugePages(enable != 0) ? 1 : 0;
+}
+
+CkFftContext* CkFftInit(CkFftSize maxCount, CkFftDirection direction, void* userBuf, size_t* userBufSize) 
 {
     if (maxCount <= 0)
     {
@@ -33,7 +68,275 @@ CkFftContext* CkFftInit(int maxCount, CkFftDirection direction, void* userBuf, s
     return (CkFftContext*) CkFftContext::create(maxCount, direction, userBuf, userBufSize);
 }
 
-int CkFftRealForward(CkFftContext* context, int count, const float* input, CkFftComplex* output)
+int CkFftEnableNumaReplicas(CkFftContext* context)
+{
+    if (!context)
+    {
+        return 0;
+    }
+
+    return context->enableNumaReplicas(getNumaNodeCount()) ? 1 : 0;
+}
+
+int CkFftReserveScratch(CkFftContext* context, int threadCount)
+{
+    if (!context || threadCount < 1)
+    {
+        return 0;
+    }
+
+    return context->reserveScratch(threadCount) ? 1 : 0;
+}
+
+int CkFftSetScale(CkFftContext* context, CkFftDirection direction, CkFftScaleMode mode, float factor)
+{
+    if (!context)
+    {
+        return 0;
+    }
+    if (direction != kCkFftDirection_Forward && direction != kCkFftDirection_Inverse && direction != kCkFftDirection_Both)
+    {
+        return 0;
+    }
+    if (mode != kCkFftScale_None && mode != kCkFftScale_1OverN && mode != kCkFftScale_1OverSqrtN)
+    {
+        return 0;
+    }
+
+    if (direction & kCkFftDirection_Forward)
+    {
+        context->fwdScaleMode = mode;
+        context->fwdScaleFactor = factor;
+    }
+    if (direction & kCkFftDirection_Inverse)
+    {
+        context->invScaleMode = mode;
+        context->invScaleFactor = factor;
+    }
+    return 1;
+}
+
+int CkFftRealForward(CkFftContext* context, CkFftSize count, const float* input, CkFftComplex* output)
+{
+    if (!context || !context->fwdExpTable)
+    {
+        return 0;
+    }
+    if (!isPowerOfTwo(count) || count > context->maxCount)
+    {
+        return 0;
+    }
+    if (!input || !output)
+    {
+        return 0;
+    }
+
+    LocalContext local(context);
+    fft_real(local, input, 1, output, count, false);
+    return 1;
+}
+
+int CkFftRealInverse(CkFftContext* context, CkFftSize count, const CkFftComplex* input, float* output, CkFftComplex* tmpBuf)
+{
+    if (!context || !context->invExpTable)
+    {
+        return 0;
+    }
+    if (!isPowerOfTwo(count) || count > context->maxCount)
+    {
+        return 0;
+    }
+    if (!input || !output)
+    {
+        return 0;
+    }
+
+    ScratchBuf scratch(context, tmpBuf, count/2+1, false);
+    LocalContext local(context);
+    fft_real_inverse(local, input, output, 1, count, scratch.get(), false);
+    return 1;
+}
+
+namespace
+{
+    int realPower(CkFftContext* context, CkFftSize count, const float* input, float* output, CkFftComplex* tmpBuf, SpectrumType type)
+    {
+        if (!context || !context->fwdExpTable)
+        {
+            return 0;
+        }
+        if (!isPowerOfTwo(count) || count > context->maxCount)
+        {
+            return 0;
+        }
+        if (!input || !output)
+        {
+            return 0;
+        }
+
+        ScratchBuf scratch(context, tmpBuf, count/2);
+        if (!scratch.get())
+        {
+            return 0;
+        }
+
+        LocalContext local(context);
+        fft_real_power(local, input, NULL, output, count, type, scratch.get());
+        return 1;
+    }
+}
+
+int CkFftRealPowerSpectrum(CkFftContext* context, CkFftSize count, const float* input, float* output, CkFftComplex* tmpBuf)
+{
+    return realPower(context, count, input, output, tmpBuf, k_spectrumPower);
+}
+
+int CkFftRealMagnitude(CkFftContext* context, CkFftSize count, const float* input, float* output, CkFftComplex* tmpBuf)
+{
+    return realPower(context, count, input, output, tmpBuf, k_spectrumMagnitude);
+}
+
+int CkFftRealPowerSpectrumDb(CkFftContext* context, CkFftSize count, const float* input, float* output, CkFftComplex* tmpBuf)
+{
+    return realPower(context, count, input, output, tmpBuf, k_spectrumDecibels);
+}
+
+int CkFftRealForwardPacked(CkFftContext* context, CkFftSize count, const float* input, CkFftComplex* output)
+{
+    if (!context || !context->fwdExpTable)
+    {
+        return 0;
+    }
+    if (!isPowerOfTwo(count) || count < 2 || count > context->maxCount)
+    {
+        return 0;
+    }
+    if (!input || !output)
+    {
+        return 0;
+    }
+
+    LocalContext local(context);
+    fft_real(local, input, 1, output, count, true);
+    return 1;
+}
+
+int CkFftRealInversePacked(CkFftContext* context, CkFftSize count, const CkFftComplex* input, float* output, CkFftComplex* tmpBuf)
+{
+    if (!context || !context->invExpTable)
+    {
+        return 0;
+    }
+    if (!isPowerOfTwo(count) || count < 2 || count > context->maxCount)
+    {
+        return 0;
+    }
+    if (!input || !output)
+    {
+        return 0;
+    }
+
+    ScratchBuf scratch(context, tmpBuf, count/2, false);
+    LocalContext local(context);
+    fft_real_inverse(local, input, output, 1, count, scratch.get(), true);
+    return 1;
+}
+
+int CkFftRealForwardStrided(CkFftContext* context, CkFftSize count, const float* input, CkFftSize inputStride, CkFftComplex* output)
+{
+    if (!context || !context->fwdExpTable)
+    {
+        return 0;
+    }
+    if (!isPowerOfTwo(count) || count > context->maxCount)
+    {
+        return 0;
+    }
+    if (!input || !output || inputStride < 1)
+    {
+        return 0;
+    }
+
+    LocalContext local(context);
+    fft_real(local, input, inputStride, output, count, false);
+    return 1;
+}
+
+int CkFftRealInverseStrided(CkFftContext* context, CkFftSize count, const CkFftComplex* input, float* output, CkFftSize outputStride, CkFftComplex* tmpBuf)
+{
+    if (!context || !context->invExpTable)
+    {
+        return 0;
+    }
+    if (!isPowerOfTwo(count) || count > context->maxCount)
+    {
+        return 0;
+    }
+    if (!input || !output || outputStride < 1)
+    {
+        return 0;
+    }
+
+    // the intermediate results can't be computed in the output buffer
+    ScratchBuf scratch(context, tmpBuf, count/2+1, (outputStride != 1));
+    if (outputStride != 1 && !scratch.get())
+    {
+        return 0;
+    }
+
+    LocalContext local(context);
+    fft_real_inverse(local, input, output, outputStride, count, scratch.get(), false);
+    return 1;
+}
+
+int CkFftRealForwardInt16(CkFftContext* context, CkFftSize count, const short* input, float inputScale, CkFftComplex* output)
+{
+    if (!context || !context->fwdExpTable)
+    {
+        return 0;
+    }
+    if (!isPowerOfTwo(count) || count > context->maxCount)
+    {
+        return 0;
+    }
+    if (!input || !output)
+    {
+        return 0;
+    }
+
+    LocalContext local(context);
+    fft_real_int16(local, input, inputScale, output, count);
+    return 1;
+}
+
+int CkFftComplexForward(CkFftContext* context, CkFftSize count, const CkFftComplex* input, CkFftComplex* output)
+{
+    if (!context || !context->fwdExpTable)
+    {
+        return 0;
+    }
+    if (!isPowerOfTwo(count) || count > context->maxCount)
+    {
+        return 0;
+    }
+    if (!input || !output)
+    {
+        return 0;
+    }
+
+    LocalContext local(context);
+    if (input == output)
+    {
+        fft_inplace(local, output, count, false);
+    }
+    else
+    {
+        fft(local, input, output, count, false);
+    }
+    return 1;
+}
+
+int CkFftComplexForwardInt16(CkFftContext* context, CkFftSize count, const short* input, float inputScale, CkFftComplex* output)
 {
     if (!context || !context->fwdExpTable)
     {
@@ -43,21 +346,38 @@ int CkFftRealForward(CkFftContext* context, int count, const float* input, CkFft
     {
         return 0;
     }
-    if (!input || !output || (void*) input == (void*) output)
+    if (!input || !output)
     {
         return 0;
     }
 
-    fft_real(context, input, output, count);
+    LocalContext local(context);
+    fft_int16(local, input, inputScale, output, count, false);
     return 1;
 }
 
-int CkFftRealInverse(CkFftContext* context, int count, const CkFftComplex* input, float* output, CkFftComplex* tmpBuf)
+int CkFftComplexForwardInt8(CkFftContext* context, CkFftSize count, const signed char* input, float inputScale, CkFftComplex* output)
 {
-    if (!tmpBuf)
+    if (!context || !context->fwdExpTable)
+    {
+        return 0;
+    }
+    if (!isPowerOfTwo(count) || count > context->maxCount)
+    {
+        return 0;
+    }
+    if (!input || !output)
     {
         return 0;
     }
+
+    LocalContext local(context);
+    fft_int8(local, input, inputScale, output, count, false);
+    return 1;
+}
+
+int CkFftComplexInverse(CkFftContext* context, CkFftSize count, const CkFftComplex* input, CkFftComplex* output)
+{
     if (!context || !context->invExpTable)
     {
         return 0;
@@ -66,16 +386,24 @@ int CkFftRealInverse(CkFftContext* context, int count, const CkFftComplex* input
     {
         return 0;
     }
-    if (!input || !output || (void*) input == (void*) output)
+    if (!input || !output)
     {
         return 0;
     }
 
-    fft_real_inverse(context, input, output, count, tmpBuf);
+    LocalContext local(context);
+    if (input == output)
+    {
+        fft_inplace(local, output, count, true);
+    }
+    else
+    {
+        fft(local, input, output, count, true);
+    }
     return 1;
 }
 
-int CkFftComplexForward(CkFftContext* context, int count, const CkFftComplex* input, CkFftComplex* output)
+int CkFftComplexForwardHalf(CkFftContext* context, CkFftSize count, CkFftHalfFormat format, const CkFftHalf* input, CkFftHalf* output, CkFftComplex* tmpBuf)
 {
     if (!context || !context->fwdExpTable)
     {
@@ -85,16 +413,27 @@ int CkFftComplexForward(CkFftContext* context, int count, const CkFftComplex* in
     {
         return 0;
     }
-    if (!input || !output || input == output)
+    if (format != kCkFftHalfFormat_Float16 && format != kCkFftHalfFormat_BFloat16)
+    {
+        return 0;
+    }
+    if (!input || !output)
+    {
+        return 0;
+    }
+
+    ScratchBuf scratch(context, tmpBuf, count);
+    if (!scratch.get())
     {
         return 0;
     }
 
-    fft(context, input, output, count, false);
+    LocalContext local(context);
+    fft_half(local, input, output, count, false, (format == kCkFftHalfFormat_BFloat16), scratch.get());
     return 1;
 }
 
-int CkFftComplexInverse(CkFftContext* context, int count, const CkFftComplex* input, CkFftComplex* output)
+int CkFftComplexInverseHalf(CkFftContext* context, CkFftSize count, CkFftHalfFormat format, const CkFftHalf* input, CkFftHalf* output, CkFftComplex* tmpBuf)
 {
     if (!context || !context->invExpTable)
     {
@@ -104,18 +443,1185 @@ int CkFftComplexInverse(CkFftContext* context, int count, const CkFftComplex* in
     {
         return 0;
     }
-    if (!input || !output || input == output)
+    if (format != kCkFftHalfFormat_Float16 && format != kCkFftHalfFormat_BFloat16)
+    {
+        return 0;
+    }
+    if (!input || !output)
+    {
+        return 0;
+    }
+
+    ScratchBuf scratch(context, tmpBuf, count);
+    if (!scratch.get())
+    {
+        return 0;
+    }
+
+    LocalContext local(context);
+    fft_half(local, input, output, count, true, (format == kCkFftHalfFormat_BFloat16), scratch.get());
+    return 1;
+}
+
+int CkFftRealForwardHalf(CkFftContext* context, CkFftSize count, CkFftHalfFormat format, const CkFftHalf* input, CkFftHalf* output, CkFftComplex* tmpBuf)
+{
+    if (!context || !context->fwdExpTable)
+    {
+        return 0;
+    }
+    if (!isPowerOfTwo(count) || count > context->maxCount)
+    {
+        return 0;
+    }
+    if (format != kCkFftHalfFormat_Float16 && format != kCkFftHalfFormat_BFloat16)
+    {
+        return 0;
+    }
+    if (!input || !output)
+    {
+        return 0;
+    }
+
+    ScratchBuf scratch(context, tmpBuf, count/2+1);
+    if (!scratch.get())
     {
         return 0;
     }
 
-    fft(context, input, output, count, true);
+    LocalContext local(context);
+    fft_real_half(local, input, output, count, (format == kCkFftHalfFormat_BFloat16), scratch.get());
     return 1;
 }
 
-void CkFftShutdown(CkFftContext* context)  
+int CkFftRealInverseHalf(CkFftContext* context, CkFftSize count, CkFftHalfFormat format, const CkFftHalf* input, CkFftHalf* output, CkFftComplex* tmpBuf)
 {
-    CkFftContext::destroy(context);
+    if (!context || !context->invExpTable)
+    {
+        return 0;
+    }
+    if (!isPowerOfTwo(count) || count > context->maxCount)
+    {
+        return 0;
+    }
+    if (format != kCkFftHalfFormat_Float16 && format != kCkFftHalfFormat_BFloat16)
+    {
+        return 0;
+    }
+    if (!input || !output)
+    {
+        return 0;
+    }
+
+    ScratchBuf scratch(context, tmpBuf, count/2+1);
+    if (!scratch.get())
+    {
+        return 0;
+    }
+
+    LocalContext local(context);
+    fft_real_inverse_half(local, input, output, count, (format == kCkFftHalfFormat_BFloat16), scratch.get());
+    return 1;
+}
+
+int CkFftComplexForwardUnordered(CkFftContext* context, CkFftSize count, const CkFftComplex* input, CkFftComplex* output)
+{
+    if (!context || !context->fwdExpTable)
+    {
+        return 0;
+    }
+    if (!isPowerOfTwo(count) || count > context->maxCount)
+    {
+        return 0;
+    }
+    if (!input || !output)
+    {
+        return 0;
+    }
+
+    LocalContext local(context);
+    fft_dif(local, input, output, count, false);
+    return 1;
+}
+
+int CkFftComplexInverseUnordered(CkFftContext* context, CkFftSize count, const CkFftComplex* input, CkFftComplex* output)
+{
+    if (!context || !context->invExpTable)
+    {
+        return 0;
+    }
+    if (!isPowerOfTwo(count) || count > context->maxCount)
+    {
+        return 0;
+    }
+    if (!input || !output)
+    {
+        return 0;
+    }
+
+    LocalContext local(context);
+    fft_dit(local, input, output, count, true);
+    return 1;
+}
+
+CkFftSize CkFftUnorderedIndex(CkFftSize count, CkFftSize k)
+{
+    if (!isPowerOfTwo(count) || k < 0 || k >= count)
+    {
+        return -1;
+    }
+
+    CkFftSize index = 0;
+    for (CkFftSize bit = 1; bit < count; bit <<= 1)
+    {
+        index <<= 1;
+        if (k & bit)
+        {
+            index |= 1;
+        }
+    }
+    return index;
+}
+
+namespace
+{
+    int complexPruned(CkFftContext* context, CkFftSize count, const CkFftComplex* input, CkFftSize inputCount, CkFftSize firstBin, const CkFftSize* bins, CkFftSize binCount, CkFftComplex* output, CkFftComplex* tmpBuf, bool inverse)
+    {
+        if (!context || !(inverse ? context->invExpTable : context->fwdExpTable))
+        {
+            return 0;
+        }
+        if (!isPowerOfTwo(count) || count > context->maxCount)
+        {
+            return 0;
+        }
+        if (inputCount < 1 || inputCount > count || binCount < 0 || binCount > count)
+        {
+            return 0;
+        }
+        if (binCount == 0)
+        {
+            return 1;
+        }
+        if (!input || !output)
+        {
+            return 0;
+        }
+        if (bins)
+        {
+            for (CkFftSize i = 0; i < binCount; ++i)
+            {
+                if (bins[i] < 0 || bins[i] >= count)
+                {
+                    return 0;
+                }
+            }
+        }
+        else if (firstBin < 0 || firstBin >= count)
+        {
+            return 0;
+        }
+
+        // a temporary buffer is needed only for FFTs
+        bool needBuf = !fft_pruned_goertzel(count, inputCount, binCount);
+        ScratchBuf scratch(context, tmpBuf, fft_pruned_buf_count(inputCount), needBuf);
+        if (needBuf && !scratch.get())
+        {
+            return 0;
+        }
+
+        LocalContext local(context);
+        fft_pruned(local, input, inputCount, count, firstBin, bins, binCount, output, inverse, scratch.get());
+        return 1;
+    }
+}
+
+int CkFftComplexForwardPruned(CkFftContext* context, CkFftSize count, const CkFftComplex* input, CkFftSize inputCount, CkFftSize firstBin, CkFftSize binCount, CkFftComplex* output, CkFftComplex* tmpBuf)
+{
+    return complexPruned(context, count, input, inputCount, firstBin, NULL, binCount, output, tmpBuf, false);
+}
+
+int CkFftComplexForwardPrunedBins(CkFftContext* context, CkFftSize count, const CkFftComplex* input, CkFftSize inputCount, const CkFftSize* bins, CkFftSize binCount, CkFftComplex* output, CkFftComplex* tmpBuf)
+{
+    if (!bins && binCount > 0)
+    {
+        return 0;
+    }
+    return complexPruned(context, count, input, inputCount, 0, bins, binCount, output, tmpBuf, false);
+}
+
+int CkFftComplexInversePruned(CkFftContext* context, CkFftSize count, const CkFftComplex* input, CkFftSize inputCount, CkFftSize firstBin, CkFftSize binCount, CkFftComplex* output, CkFftComplex* tmpBuf)
+{
+    return complexPruned(context, count, input, inputCount, firstBin, NULL, binCount, output, tmpBuf, true);
+}
+
+int CkFftComplexInversePrunedBins(CkFftContext* context, CkFftSize count, const CkFftComplex* input, CkFftSize inputCount, const CkFftSize* bins, CkFftSize binCount, CkFftComplex* output, CkFftComplex* tmpBuf)
+{
+    if (!bins && binCount > 0)
+    {
+        return 0;
+    }
+    return complexPruned(context, count, input, inputCount, 0, bins, binCount, output, tmpBuf, true);
+}
+
+int CkFftComplexMultiply(CkFftContext* context, CkFftSize count, const CkFftComplex* a, const CkFftComplex* b, CkFftComplex* output)
+{
+    if (!context)
+    {
+        return 0;
+    }
+    if (count < 0)
+    {
+        return 0;
+    }
+    if (!a || !b || !output)
+    {
+        return 0;
+    }
+
+    spectral_multiply(context, a, b, output, count, false);
+    return 1;
+}
+
+int CkFftComplexMultiplyAdd(CkFftContext* context, CkFftSize count, const CkFftComplex* a, const CkFftComplex* b, CkFftComplex* output)
+{
+    if (!context)
+    {
+        return 0;
+    }
+    if (count < 0)
+    {
+        return 0;
+    }
+    if (!a || !b || !output)
+    {
+        return 0;
+    }
+
+    spectral_multiply_add(context, a, b, output, count, false);
+    return 1;
+}
+
+int CkFftComplexConjugateMultiply(CkFftContext* context, CkFftSize count, const CkFftComplex* a, const CkFftComplex* b, CkFftComplex* output)
+{
+    if (!context)
+    {
+        return 0;
+    }
+    if (count < 0)
+    {
+        return 0;
+    }
+    if (!a || !b || !output)
+    {
+        return 0;
+    }
+
+    spectral_conjugate_multiply(context, a, b, output, count, false);
+    return 1;
+}
+
+int CkFftComplexConjugateMultiplyAdd(CkFftContext* context, CkFftSize count, const CkFftComplex* a, const CkFftComplex* b, CkFftComplex* output)
+{
+    if (!context)
+    {
+        return 0;
+    }
+    if (count < 0)
+    {
+        return 0;
+    }
+    if (!a || !b || !output)
+    {
+        return 0;
+    }
+
+    spectral_conjugate_multiply_add(context, a, b, output, count, false);
+    return 1;
+}
+
+int CkFftComplexScale(CkFftContext* context, CkFftSize count, const CkFftComplex* input, float scale, CkFftComplex* output)
+{
+    if (!context)
+    {
+        return 0;
+    }
+    if (count < 0)
+    {
+        return 0;
+    }
+    if (!input || !output)
+    {
+        return 0;
+    }
+
+    spectral_scale(context, input, scale, output, count);
+    return 1;
+}
+
+int CkFftPackedMultiply(CkFftContext* context, CkFftSize count, const CkFftComplex* a, const CkFftComplex* b, CkFftComplex* output)
+{
+    if (!context)
+    {
+        return 0;
+    }
+    if (count < 0)
+    {
+        return 0;
+    }
+    if (!a || !b || !output)
+    {
+        return 0;
+    }
+
+    spectral_multiply(context, a, b, output, count, true);
+    return 1;
+}
+
+int CkFftPackedMultiplyAdd(CkFftContext* context, CkFftSize count, const CkFftComplex* a, const CkFftComplex* b, CkFftComplex* output)
+{
+    if (!context)
+    {
+        return 0;
+    }
+    if (count < 0)
+    {
+        return 0;
+    }
+    if (!a || !b || !output)
+    {
+        return 0;
+    }
+
+    spectral_multiply_add(context, a, b, output, count, true);
+    return 1;
+}
+
+int CkFftPackedConjugateMultiply(CkFftContext* context, CkFftSize count, const CkFftComplex* a, const CkFftComplex* b, CkFftComplex* output)
+{
+    if (!context)
+    {
+        return 0;
+    }
+    if (count < 0)
+    {
+        return 0;
+    }
+    if (!a || !b || !output)
+    {
+        return 0;
+    }
+
+    spectral_conjugate_multiply(context, a, b, output, count, true);
+    return 1;
+}
+
+int CkFftPackedConjugateMultiplyAdd(CkFftContext* context, CkFftSize count, const CkFftComplex* a, const CkFftComplex* b, CkFftComplex* output)
+{
+    if (!context)
+    {
+        return 0;
+    }
+    if (count < 0)
+    {
+        return 0;
+    }
+    if (!a || !b || !output)
+    {
+        return 0;
+    }
+
+    spectral_conjugate_multiply_add(context, a, b, output, count, true);
+    return 1;
+}
+
+void CkFftShutdown(CkFftContext* context)  
+{
+    CkFftContext::destroy(context);
+}
+
+int CkFftWindow(CkFftWindowType type, CkFftSize count, float* window)
+{
+    if (type != kCkFftWindow_Rectangular && type != kCkFftWindow_Hann && 
+        type != kCkFftWindow_Hamming && type != kCkFftWindow_Blackman)
+    {
+        return 0;
+    }
+    if (count < 1 || !window)
+    {
+        return 0;
+    }
+
+    makeWindow(type, count, window);
+    return 1;
+}
+
+CkFftStft* CkFftStftInit(CkFftContext* context, CkFftSize frameSize, CkFftSize hopSize, const float* window, void* userBuf, size_t* userBufSize)
+{
+    if (!context || !context->fwdExpTable)
+    {
+        return NULL;
+    }
+    if (!isPowerOfTwo(frameSize) || frameSize > context->maxCount)
+    {
+        return NULL;
+    }
+    if (hopSize < 1 || hopSize > frameSize)
+    {
+        return NULL;
+    }
+    if (userBuf && !userBufSize)
+    {
+        return NULL;
+    }
+
+    return CkFftStft::create(context, frameSize, hopSize, window, userBuf, userBufSize);
+}
+
+CkFftSize CkFftStftGetFrameCount(CkFftStft* stft, CkFftSize count)
+{
+    if (!stft || count < 0)
+    {
+        return 0;
+    }
+
+    return stft->getFrameCount(count);
+}
+
+int CkFftStftProcess(CkFftStft* stft, const float* input, CkFftSize count, CkFftComplex* output, CkFftSize* frameCount)
+{
+    if (!stft || count < 0)
+    {
+        return 0;
+    }
+    if (count > 0 && !input)
+    {
+        return 0;
+    }
+    if (!output && stft->getFrameCount(count) > 0)
+    {
+        return 0;
+    }
+
+    CkFftSize frames = stft->process(input, count, output);
+    if (frameCount)
+    {
+        *frameCount = frames;
+    }
+    return 1;
+}
+
+int CkFftStftReset(CkFftStft* stft)
+{
+    if (!stft)
+    {
+        return 0;
+    }
+
+    stft->reset();
+    return 1;
+}
+
+void CkFftStftShutdown(CkFftStft* stft)
+{
+    CkFftStft::destroy(stft);
+}
+
+CkFftIstft* CkFftIstftInit(CkFftContext* context, CkFftSize frameSize, CkFftSize hopSize, const float* analysisWindow, const float* synthesisWindow, void* userBuf, size_t* userBufSize)
+{
+    if (!context || !context->invExpTable)
+    {
+        return NULL;
+    }
+    if (!isPowerOfTwo(frameSize) || frameSize > context->maxCount)
+    {
+        return NULL;
+    }
+    if (hopSize < 1 || hopSize > frameSize)
+    {
+        return NULL;
+    }
+    if (userBuf && !userBufSize)
+    {
+        return NULL;
+    }
+
+    return CkFftIstft::create(context, frameSize, hopSize, analysisWindow, synthesisWindow, userBuf, userBufSize);
+}
+
+int CkFftIstftProcess(CkFftIstft* istft, const CkFftComplex* input, CkFftSize frameCount, CkFftSize* processed)
+{
+    if (!istft || frameCount < 0)
+    {
+        return 0;
+    }
+    if (frameCount > 0 && !input)
+    {
+        return 0;
+    }
+
+    CkFftSize frames = istft->process(input, frameCount);
+    if (frames < 0)
+    {
+        return 0;
+    }
+    if (processed)
+    {
+        *processed = frames;
+    }
+    return 1;
+}
+
+int CkFftIstftRead(CkFftIstft* istft, float* output, CkFftSize count, CkFftSize* readCount)
+{
+    if (!istft || count < 0)
+    {
+        return 0;
+    }
+    if (count > 0 && !output)
+    {
+        return 0;
+    }
+
+    CkFftSize samples = istft->read(output, count);
+    if (readCount)
+    {
+        *readCount = samples;
+    }
+    return 1;
+}
+
+int CkFftIstftReset(CkFftIstft* istft)
+{
+    if (!istft)
+    {
+        return 0;
+    }
+
+    istft->reset();
+    return 1;
+}
+
+void CkFftIstftShutdown(CkFftIstft* istft)
+{
+    CkFftIstft::destroy(istft);
+}
+
+CkFftConvolver* CkFftConvolverInit(CkFftContext* context, const float* filter, CkFftSize filterSize, CkFftSize blockSize, int channelCount, void* userBuf, size_t* userBufSize)
+{
+    if (!context || !context->fwdExpTable || !context->invExpTable)
+    {
+        return NULL;
+    }
+    if (!filter || filterSize < 1 || filterSize > context->maxCount)
+    {
+        return NULL;
+    }
+    if (blockSize < 1 || blockSize > context->maxCount)
+    {
+        return NULL;
+    }
+    if (CkFftConvolver::getFftSize(filterSize, blockSize) > context->maxCount)
+    {
+        return NULL;
+    }
+    if (channelCount < 1)
+    {
+        return NULL;
+    }
+    if (userBuf && !userBufSize)
+    {
+        return NULL;
+    }
+
+    return CkFftConvolver::create(context, filter, filterSize, blockSize, channelCount, userBuf, userBufSize);
+}
+
+int CkFftConvolverProcess(CkFftConvolver* conv, int channel, const float* input, float* output)
+{
+    if (!conv || channel < 0 || channel >= conv->channelCount)
+    {
+        return 0;
+    }
+    if (!input || !output)
+    {
+        return 0;
+    }
+
+    return conv->process(channel, input, output) ? 1 : 0;
+}
+
+int CkFftConvolverReset(CkFftConvolver* conv)
+{
+    if (!conv)
+    {
+        return 0;
+    }
+
+    conv->reset();
+    return 1;
+}
+
+void CkFftConvolverShutdown(CkFftConvolver* conv)
+{
+    CkFftConvolver::destroy(conv);
+}
+
+CkFftPartitionedConvolver* CkFftPartitionedConvolverInit(CkFftContext* context, const float* filter, CkFftSize filterSize, CkFftSize blockSize, CkFftSize maxPartitionSize, void* userBuf, size_t* userBufSize)
+{
+    if (!context || !context->fwdExpTable || !context->invExpTable)
+    {
+        return NULL;
+    }
+    if (!filter || filterSize < 1)
+    {
+        return NULL;
+    }
+    if (!isPowerOfTwo(blockSize) || !isPowerOfTwo(maxPartitionSize) || maxPartitionSize < blockSize)
+    {
+        return NULL;
+    }
+    if (maxPartitionSize > context->maxCount / 2)
+    {
+        return NULL;
+    }
+    if (userBuf && !userBufSize)
+    {
+        return NULL;
+    }
+
+    return CkFftPartitionedConvolver::create(context, filter, filterSize, blockSize, maxPartitionSize, userBuf, userBufSize);
+}
+
+int CkFftPartitionedConvolverProcess(CkFftPartitionedConvolver* conv, const float* input, float* output)
+{
+    if (!conv || !input || !output)
+    {
+        return 0;
+    }
+
+    conv->process(input, output);
+    return 1;
+}
+
+int CkFftPartitionedConvolverRunTail(CkFftPartitionedConvolver* conv, int* taskCount)
+{
+    if (!conv)
+    {
+        return 0;
+    }
+
+    int tasks = conv->runTail();
+    if (taskCount)
+    {
+        *taskCount = tasks;
+    }
+    return 1;
+}
+
+CkFftSize CkFftPartitionedConvolverGetMissedDeadlines(CkFftPartitionedConvolver* conv)
+{
+    if (!conv)
+    {
+        return 0;
+    }
+
+    return conv->missedDeadlines;
+}
+
+int CkFftPartitionedConvolverReset(CkFftPartitionedConvolver* conv)
+{
+    if (!conv)
+    {
+        return 0;
+    }
+
+    conv->reset();
+    return 1;
+}
+
+void CkFftPartitionedConvolverShutdown(CkFftPartitionedConvolver* conv)
+{
+    CkFftPartitionedConvolver::destroy(conv);
+}
+
+CkFftConvolverMatrix* CkFftConvolverMatrixInit(CkFftContext* context, const float* const* filters, CkFftSize filterSize, int inputCount, int outputCount, CkFftSize blockSize, void* userBuf, size_t* userBufSize)
+{
+    if (!context || !context->fwdExpTable || !context->invExpTable)
+    {
+        return NULL;
+    }
+    if (!filters || filterSize < 1 || filterSize > context->maxCount)
+    {
+        return NULL;
+    }
+    if (blockSize < 1 || blockSize > context->maxCount)
+    {
+        return NULL;
+    }
+    if (CkFftConvolver::getFftSize(filterSize, blockSize) > context->maxCount)
+    {
+        return NULL;
+    }
+    if (inputCount < 1 || outputCount < 1 || inputCount > INT_MAX / outputCount)
+    {
+        return NULL;
+    }
+    if (userBuf && !userBufSize)
+    {
+        return NULL;
+    }
+
+    return CkFftConvolverMatrix::create(context, filters, filterSize, inputCount, outputCount, blockSize, userBuf, userBufSize);
+}
+
+int CkFftConvolverMatrixProcess(CkFftConvolverMatrix* matrix, const float* const* inputs, float* const* outputs)
+{
+    if (!matrix || !inputs || !outputs)
+    {
+        return 0;
+    }
+    for (int i = 0; i < matrix->inputCount; ++i)
+    {
+        if (!inputs[i])
+        {
+            return 0;
+        }
+    }
+    for (int i = 0; i < matrix->outputCount; ++i)
+    {
+        if (!outputs[i])
+        {
+            return 0;
+        }
+    }
+
+    matrix->process(inputs, outputs);
+    return 1;
+}
+
+int CkFftConvolverMatrixReset(CkFftConvolverMatrix* matrix)
+{
+    if (!matrix)
+    {
+        return 0;
+    }
+
+    matrix->reset();
+    return 1;
+}
+
+void CkFftConvolverMatrixShutdown(CkFftConvolverMatrix* matrix)
+{
+    CkFftConvolverMatrix::destroy(matrix);
+}
+
+CkFftCorrelator* CkFftCorrelatorInit(CkFftContext* context, CkFftSize count, CkFftWeighting weighting, float smoothing, void* userBuf, size_t* userBufSize)
+{
+    if (!context || !context->fwdExpTable || !context->invExpTable)
+    {
+        return NULL;
+    }
+    if (count < 2 || !isPowerOfTwo(count) || count > context->maxCount)
+    {
+        return NULL;
+    }
+    if (weighting != kCkFftWeighting_None && weighting != kCkFftWeighting_Phat && weighting != kCkFftWeighting_Scot)
+    {
+        return NULL;
+    }
+    if (!(smoothing >= 0.0f && smoothing < 1.0f))
+    {
+        return NULL;
+    }
+    if (userBuf && !userBufSize)
+    {
+        return NULL;
+    }
+
+    return CkFftCorrelator::create(context, count, weighting, smoothing, userBuf, userBufSize);
+}
+
+int CkFftCorrelatorProcess(CkFftCorrelator* corr, const float* x, const float* y, CkFftSize count, float* output)
+{
+    if (!corr || count < 1 || count > corr->size/2)
+    {
+        return 0;
+    }
+    if (!x || !y || !output)
+    {
+        return 0;
+    }
+
+    corr->process(x, y, count, output);
+    return 1;
+}
+
+int CkFftCorrelatorProcessSpectra(CkFftCorrelator* corr, const CkFftComplex* x, const CkFftComplex* y, float* output)
+{
+    if (!corr || !x || !y || !output)
+    {
+        return 0;
+    }
+
+    corr->processSpectra(x, y, output);
+    return 1;
+}
+
+int CkFftCorrelatorFindPeak(CkFftCorrelator* corr, const float* correlation, CkFftSize maxLag, float* lag, float* value)
+{
+    if (!corr || !correlation || maxLag < 0)
+    {
+        return 0;
+    }
+
+    corr->findPeak(correlation, maxLag, lag, value);
+    return 1;
+}
+
+int CkFftCorrelatorReset(CkFftCorrelator* corr)
+{
+    if (!corr)
+    {
+        return 0;
+    }
+
+    corr->reset();
+    return 1;
+}
+
+void CkFftCorrelatorShutdown(CkFftCorrelator* corr)
+{
+    CkFftCorrelator::destroy(corr);
+}
+
+CkFftMelFeatures* CkFftMelFeaturesInit(CkFftContext* context, CkFftSize frameSize, CkFftSize hopSize, const float* window, float sampleRate, int bandCount, float minFreq, float maxFreq, int coeffCount, int channelCount, void* userBuf, size_t* userBufSize)
+{
+    if (!context || !context->fwdExpTable)
+    {
+        return NULL;
+    }
+    if (!isPowerOfTwo(frameSize) || frameSize > context->maxCount)
+    {
+        return NULL;
+    }
+    if (hopSize < 1 || hopSize > frameSize)
+    {
+        return NULL;
+    }
+    if (bandCount < 1 || bandCount > frameSize/2 || coeffCount < 0 || coeffCount > bandCount)
+    {
+        return NULL;
+    }
+    if (!(sampleRate > 0.0f && minFreq >= 0.0f && minFreq < maxFreq && maxFreq <= sampleRate * 0.5f))
+    {
+        return NULL;
+    }
+    if (channelCount < 1)
+    {
+        return NULL;
+    }
+    if (userBuf && !userBufSize)
+    {
+        return NULL;
+    }
+
+    return CkFftMelFeatures::create(context, frameSize, hopSize, window, sampleRate, bandCount, minFreq, maxFreq, coeffCount, channelCount, userBuf, userBufSize);
+}
+
+CkFftSize CkFftMelFeaturesGetFrameCount(CkFftMelFeatures* mel, int channel, CkFftSize count)
+{
+    if (!mel || channel < 0 || channel >= mel->channelCount || count < 0)
+    {
+        return 0;
+    }
+
+    return mel->getFrameCount(channel, count);
+}
+
+int CkFftMelFeaturesProcess(CkFftMelFeatures* mel, int channel, const float* input, CkFftSize count, float* output, CkFftSize* frameCount)
+{
+    if (!mel || channel < 0 || channel >= mel->channelCount || count < 0)
+    {
+        return 0;
+    }
+    if (count > 0 && !input)
+    {
+        return 0;
+    }
+    if (!output && mel->getFrameCount(channel, count) > 0)
+    {
+        return 0;
+    }
+
+    CkFftSize frames = 0;
+    if (!mel->process(channel, input, count, output, &frames))
+    {
+        return 0;
+    }
+    if (frameCount)
+    {
+        *frameCount = frames;
+    }
+    return 1;
+}
+
+int CkFftMelFeaturesProcessFrames(CkFftMelFeatures* mel, const float* input, CkFftSize frameCount, float* output)
+{
+    if (!mel || frameCount < 0)
+    {
+        return 0;
+    }
+    if (frameCount == 0)
+    {
+        return 1;
+    }
+    if (!input || !output)
+    {
+        return 0;
+    }
+
+    return mel->processFrames(input, frameCount, output) ? 1 : 0;
+}
+
+int CkFftMelFeaturesReset(CkFftMelFeatures* mel)
+{
+    if (!mel)
+    {
+        return 0;
+    }
+
+    mel->reset();
+    return 1;
+}
+
+void CkFftMelFeaturesShutdown(CkFftMelFeatures* mel)
+{
+    CkFftMelFeatures::destroy(mel);
+}
+
+CkFftContextD* CkFftInitD(int maxCount, CkFftDirection direction, void* userBuf, size_t* userBufSize) 
+{
+    if (maxCount <= 0)
+    {
+        return NULL;
+    }
+    if (!isPowerOfTwo(maxCount))
+    {
+        return NULL;
+    }
+    if (direction != kCkFftDirection_Forward && direction != kCkFftDirection_Inverse && direction != kCkFftDirection_Both)
+    {
+        return NULL;
+    }
+    if (userBuf && !userBufSize)
+    {
+        return NULL;
+    }
+
+    return CkFftContextD::create(maxCount, direction, userBuf, userBufSize);
+}
+
+int CkFftComplexForwardD(CkFftContextD* context, int count, const CkFftComplexD* input, CkFftComplexD* output)
+{
+    if (!context || !context->fwdExpTable)
+    {
+        return 0;
+    }
+    if (!isPowerOfTwo(count) || count > context->maxCount)
+    {
+        return 0;
+    }
+    if (!input || !output)
+    {
+        return 0;
+    }
+
+    fft_double(context, input, output, count, false);
+    return 1;
+}
+
+int CkFftComplexInverseD(CkFftContextD* context, int count, const CkFftComplexD* input, CkFftComplexD* output)
+{
+    if (!context || !context->invExpTable)
+    {
+        return 0;
+    }
+    if (!isPowerOfTwo(count) || count > context->maxCount)
+    {
+        return 0;
+    }
+    if (!input || !output)
+    {
+        return 0;
+    }
+
+    fft_double(context, input, output, count, true);
+    return 1;
+}
+
+int CkFftRealForwardD(CkFftContextD* context, int count, const double* input, CkFftComplexD* output)
+{
+    if (!context || !context->fwdExpTable)
+    {
+        return 0;
+    }
+    if (!isPowerOfTwo(count) || count > context->maxCount)
+    {
+        return 0;
+    }
+    if (!input || !output)
+    {
+        return 0;
+    }
+
+    fft_real_double(context, input, output, count);
+    return 1;
+}
+
+int CkFftRealInverseD(CkFftContextD* context, int count, const CkFftComplexD* input, double* output, CkFftComplexD* tmpBuf)
+{
+    if (!context || !context->invExpTable)
+    {
+        return 0;
+    }
+    if (!isPowerOfTwo(count) || count > context->maxCount)
+    {
+        return 0;
+    }
+    if (!input || !output)
+    {
+        return 0;
+    }
+
+    fft_real_inverse_double(context, input, output, count, tmpBuf);
+    return 1;
+}
+
+void CkFftShutdownD(CkFftContextD* context)  
+{
+    CkFftContextD::destroy(context);
+}
+
+CkFftContextQ15* CkFftInitQ15(int maxCount, void* userBuf, size_t* userBufSize) 
+{
+    if (maxCount <= 0)
+    {
+        return NULL;
+    }
+    if (!isPowerOfTwo(maxCount))
+    {
+        return NULL;
+    }
+    if (userBuf && !userBufSize)
+    {
+        return NULL;
+    }
+
+    return CkFftContextQ15::create(maxCount, userBuf, userBufSize);
+}
+
+int CkFftComplexForwardQ15(CkFftContextQ15* context, int count, const CkFftComplexQ15* input, CkFftComplexQ15* output, int* exponent)
+{
+    if (!context)
+    {
+        return 0;
+    }
+    if (!isPowerOfTwo(count) || count > context->maxCount)
+    {
+        return 0;
+    }
+    if (!input || !output || !exponent)
+    {
+        return 0;
+    }
+
+    fft_fixed(context, input, output, count, false, exponent);
+    return 1;
+}
+
+int CkFftComplexInverseQ15(CkFftContextQ15* context, int count, const CkFftComplexQ15* input, CkFftComplexQ15* output, int* exponent)
+{
+    if (!context)
+    {
+        return 0;
+    }
+    if (!isPowerOfTwo(count) || count > context->maxCount)
+    {
+        return 0;
+    }
+    if (!input || !output || !exponent)
+    {
+        return 0;
+    }
+
+    fft_fixed(context, input, output, count, true, exponent);
+    return 1;
+}
+
+void CkFftShutdownQ15(CkFftContextQ15* context)  
+{
+    CkFftContextQ15::destroy(context);
+}
+
+CkFftContextQ31* CkFftInitQ31(int maxCount, void* userBuf, size_t* userBufSize) 
+{
+    if (maxCount <= 0)
+    {
+        return NULL;
+    }
+    if (!isPowerOfTwo(maxCount))
+    {
+        return NULL;
+    }
+    if (userBuf && !userBufSize)
+    {
+        return NULL;
+    }
+
+    return CkFftContextQ31::create(maxCount, userBuf, userBufSize);
+}
+
+int CkFftComplexForwardQ31(CkFftContextQ31* context, int count, const CkFftComplexQ31* input, CkFftComplexQ31* output, int* exponent)
+{
+    if (!context)
+    {
+        return 0;
+    }
+    if (!isPowerOfTwo(count) || count > context->maxCount)
+    {
+        return 0;
+    }
+    if (!input || !output || !exponent)
+    {
+        return 0;
+    }
+
+    fft_fixed(context, input, output, count, false, exponent);
+    return 1;
+}
+
+int CkFftComplexInverseQ31(CkFftContextQ31* context, int count, const CkFftComplexQ31* input, CkFftComplexQ31* output, int* exponent)
+{
+    if (!context)
+    {
+        return 0;
+    }
+    if (!isPowerOfTwo(count) || count > context->maxCount)
+    {
+        return 0;
+    }
+    if (!input || !output || !exponent)
+    {
+        return 0;
+    }
+
+    fft_fixed(context, input, output, count, true, exponent);
+    return 1;
+}
+
+void CkFftShutdownQ31(CkFftContextQ31* context)  
+{
+    CkFftContextQ31::destroy(context);
 }
 
 } // extern "C"
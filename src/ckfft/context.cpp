@@ -1,6 +1,8 @@
 #include "ckfft/platform.h"
 #include "ckfft/debug.h"
 #include "ckfft/context.h"
+#include "ckfft/numa.h"
+#include "ckfft/scratch.h"
 
 #if CKFFT_PLATFORM_WIN
 #  define _USE_MATH_DEFINES
@@ -8,62 +10,75 @@
 
 #include <math.h>
 #include <new>
+#include <string.h>
 
 #if CKFFT_PLATFORM_ANDROID
 #  include <cpu-features.h>
 #endif
 
+using namespace ckfft;
+
+namespace
+{
+
+// copy of the tables for one NUMA node, followed by the tables themselves
+struct NumaReplica
+{
+    void* allocBuf;
+    Allocator allocator;
+    const CkFftComplex* fwdExpTable;
+    const CkFftComplex* invExpTable;
+};
+
+}
+
 _CkFftContext::_CkFftContext() :
     neon(false),
     maxCount(0),
     fwdExpTable(NULL),
     invExpTable(NULL),
-    ownBuf(false)
+    allocBuf(NULL),
+    fwdScaleMode(kCkFftScale_None),
+    invScaleMode(kCkFftScale_None),
+    fwdScaleFactor(1.0f),
+    invScaleFactor(1.0f),
+    numaReplicas(NULL),
+    numaNodeCount(0),
+    scratchPool(NULL)
 {}
 
-_CkFftContext* _CkFftContext::create(int maxCount, CkFftDirection direction, void* userBuf, size_t* userBufSize)
+_CkFftContext* _CkFftContext::create(CkFftSize maxCount, CkFftDirection direction, void* userBuf, size_t* userBufSize)
 {
-    // size of context object
-    int contextSize = sizeof(_CkFftContext);
-    if (contextSize % sizeof(CkFftComplex))
+    // the buffer size must not overflow size_t (which may be only 32 bits)
+    if ((size_t) maxCount > ((size_t) -1) / (4 * sizeof(CkFftComplex)))
     {
-        // alignment XXX
-        contextSize += sizeof(CkFftComplex) - (contextSize % sizeof(CkFftComplex));
+        return NULL;
     }
 
-    int reqBufSize = contextSize;
-
-    // size of lookup table(s)
-    int expTableSize = maxCount * sizeof(CkFftComplex);
+    // context object, followed by lookup table(s), all aligned
+    ckfft::AlignedBuf alignedBuf(sizeof(_CkFftContext));
+    size_t expTableSize = maxCount * sizeof(CkFftComplex);
     if (direction & kCkFftDirection_Forward)
     {
-        reqBufSize += expTableSize;
+        alignedBuf.addTable(expTableSize);
     }
     if (direction & kCkFftDirection_Inverse)
     {
-        reqBufSize += expTableSize;
+        alignedBuf.addTable(expTableSize);
     }
 
-    if (userBufSize && (!userBuf || (int) *userBufSize < reqBufSize))
+    size_t reqBufSize = alignedBuf.getRequiredSize();
+    if (userBufSize && (!userBuf || *userBufSize < reqBufSize))
     {
         *userBufSize = reqBufSize;
         return NULL;
     }
 
     // allocate buffer if needed
-    void* buf = NULL;
-    if (userBuf)
-    {
-        buf = userBuf;
-    }
-    else
+    void* buf = alignedBuf.allocate(userBuf);
+    if (!buf)
     {
-        // allocate buffer
-        buf = malloc(reqBufSize);
-        if (!buf)
-        {
-            return NULL;
-        }
+        return NULL;
     }
 
     // initialize
@@ -72,26 +87,27 @@ _CkFftContext* _CkFftContext::create(int maxCount, CkFftDirection direction, voi
     // lookup table(s)
     CkFftComplex* fwdExpBuf = NULL;
     CkFftComplex* invExpBuf = NULL;
-    CkFftComplex* expBuf = (CkFftComplex*) ((char*) buf + contextSize);
     if (direction == kCkFftDirection_Forward)
     {
-        fwdExpBuf = expBuf;
+        fwdExpBuf = (CkFftComplex*) alignedBuf.getTable(0);
     }
     else if (direction == kCkFftDirection_Inverse)
     {
-        invExpBuf = expBuf;
+        invExpBuf = (CkFftComplex*) alignedBuf.getTable(0);
     }
     else if (direction == kCkFftDirection_Both)
     {
-        fwdExpBuf = expBuf;
-        invExpBuf = expBuf + maxCount;
+        fwdExpBuf = (CkFftComplex*) alignedBuf.getTable(0);
+        invExpBuf = (CkFftComplex*) alignedBuf.getTable(1);
     }
 
-    for (int i = 0; i < maxCount; ++i)
+    // (computed in double precision, since i can't be represented exactly as a 
+    // float for large tables)
+    for (CkFftSize i = 0; i < maxCount; ++i)
     {
-        float theta = -2.0f * (float) M_PI * i / maxCount;
-        float c = cosf(theta);
-        float s = sinf(theta);
+        double theta = -2.0 * M_PI * (double) i / (double) maxCount;
+        float c = (float) cos(theta);
+        float s = (float) sin(theta);
         if (fwdExpBuf)
         {
             fwdExpBuf[i].real = c;
@@ -108,19 +124,172 @@ _CkFftContext* _CkFftContext::create(int maxCount, CkFftDirection direction, voi
     context->maxCount = maxCount;
     context->fwdExpTable = fwdExpBuf;
     context->invExpTable = invExpBuf;
-    context->ownBuf = (userBuf == NULL);
+    context->allocBuf = alignedBuf.getAllocatedBuf();
+    context->allocator = alignedBuf.getAllocator();
 
     return context;
 }
 
 void _CkFftContext::destroy(_CkFftContext* context)
 {
-    if (context && context->ownBuf)
+    if (context && context->numaReplicas)
+    {
+        for (int i = 0; i < context->numaNodeCount; ++i)
+        {
+            NumaReplica* replica = (NumaReplica*) context->numaReplicas[i];
+            if (replica)
+            {
+                replica->allocator.free(replica->allocBuf);
+            }
+        }
+        context->allocator.free((void*) context->numaReplicas);
+    }
+    if (context)
     {
-        free(context);
+        ScratchPool::destroy(context->scratchPool);
+        context->allocator.free(context->allocBuf);
     }
 }
 
+bool _CkFftContext::enableNumaReplicas(int nodeCount)
+{
+    if (numaReplicas || nodeCount <= 1)
+    {
+        return (numaReplicas != NULL);
+    }
+
+    // (the array is freed with the context's allocator, even if the context is in
+    // the user's buffer)
+    void* volatile* replicas = (void* volatile*) allocator.allocate(nodeCount * sizeof(void*));
+    if (!replicas)
+    {
+        return false;
+    }
+    for (int i = 0; i < nodeCount; ++i)
+    {
+        replicas[i] = NULL;
+    }
+    numaNodeCount = nodeCount;
+    numaReplicas = replicas;
+    return true;
+}
+
+bool _CkFftContext::reserveScratch(int threadCount)
+{
+    ScratchPool* oldPool = scratchPool;
+    if (oldPool && oldPool->count >= threadCount)
+    {
+        return true;
+    }
+
+    ScratchPool* pool = ScratchPool::create(threadCount, maxCount);
+    if (!pool)
+    {
+        return false;
+    }
+
+    // Other threads may still be using buffers from the old pool, so it is kept 
+    // until the context is destroyed, rather than freed here.
+    pool->prev = oldPool;
+    if (!compareAndSwap((void* volatile*) &scratchPool, oldPool, pool))
+    {
+        // another thread replaced the pool first
+        pool->prev = NULL;
+        ScratchPool::destroy(pool);
+        return reserveScratch(threadCount);
+    }
+    return true;
+}
+
+void _CkFftContext::getLocalTables(const CkFftComplex*& fwdTable, const CkFftComplex*& invTable)
+{
+    fwdTable = fwdExpTable;
+    invTable = invExpTable;
+    if (numaReplicas)
+    {
+        int node = getNumaNode();
+        if (node < numaNodeCount)
+        {
+            NumaReplica* replica = (NumaReplica*) numaReplicas[node];
+            if (!replica)
+            {
+                replica = (NumaReplica*) createNumaReplica(node);
+            }
+            if (replica)
+            {
+                fwdTable = replica->fwdExpTable;
+                invTable = replica->invExpTable;
+            }
+        }
+    }
+}
+
+void* _CkFftContext::createNumaReplica(int node)
+{
+    // The copy is made by the current thread, so its pages are allocated on the 
+    // current node (by the usual first-touch policy).
+    ckfft::AlignedBuf alignedBuf(sizeof(NumaReplica));
+    size_t expTableSize = maxCount * sizeof(CkFftComplex);
+    int fwdIndex = -1;
+    int invIndex = -1;
+    int numTables = 0;
+    if (fwdExpTable)
+    {
+        alignedBuf.addTable(expTableSize);
+        fwdIndex = numTables++;
+    }
+    if (invExpTable)
+    {
+        alignedBuf.addTable(expTableSize);
+        invIndex = numTables++;
+    }
+
+    NumaReplica* replica = (NumaReplica*) alignedBuf.allocate(NULL);
+    if (!replica)
+    {
+        return NULL;
+    }
+    replica->allocBuf = alignedBuf.getAllocatedBuf();
+    replica->allocator = alignedBuf.getAllocator();
+    replica->fwdExpTable = NULL;
+    replica->invExpTable = NULL;
+    if (fwdIndex >= 0)
+    {
+        CkFftComplex* table = (CkFftComplex*) alignedBuf.getTable(fwdIndex);
+        memcpy(table, fwdExpTable, expTableSize);
+        replica->fwdExpTable = table;
+    }
+    if (invIndex >= 0)
+    {
+        CkFftComplex* table = (CkFftComplex*) alignedBuf.getTable(invIndex);
+        memcpy(table, invExpTable, expTableSize);
+        replica->invExpTable = table;
+    }
+
+    // another thread on the same node may have got there first
+    if (!compareAndSwap(&numaReplicas[node], NULL, replica))
+    {
+        replica->allocator.free(replica->allocBuf);
+        replica = (NumaReplica*) numaReplicas[node];
+    }
+    return replica;
+}
+
+float _CkFftContext::getScale(CkFftSize count, bool inverse) const
+{
+    CkFftScaleMode mode = (inverse ? invScaleMode : fwdScaleMode);
+    float scale = (inverse ? invScaleFactor : fwdScaleFactor);
+    if (mode == kCkFftScale_1OverN)
+    {
+        scale /= (float) count;
+    }
+    else if (mode == kCkFftScale_1OverSqrtN)
+    {
+        scale /= sqrtf((float) count);
+    }
+    return scale;
+}
+
 bool _CkFftContext::isNeonSupported()
 {
     bool neon = false;
@@ -136,3 +305,22 @@ bool _CkFftContext::isNeonSupported()
 
     return neon;
 }
+
+////////////////////////////////////////
+
+namespace ckfft
+{
+
+LocalContext::LocalContext(CkFftContext* context) :
+    m_context(context)
+{
+    if (context->numaReplicas)
+    {
+        // (the context has no destructor, so the copy needs no cleanup)
+        CkFftContext* copy = new (m_copyBuf) CkFftContext(*context);
+        context->getLocalTables(copy->fwdExpTable, copy->invExpTable);
+        m_context = copy;
+    }
+}
+
+}
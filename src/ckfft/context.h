@@ -1,21 +1,78 @@
 #pragma once
 #include "ckfft/ckfft.h"
+#include "ckfft/alloc.h"
+#include "ckfft/scratch.h"
 
 struct _CkFftContext
 {
     bool neon;
-    int maxCount;
+    CkFftSize maxCount;
     const CkFftComplex* fwdExpTable;
     const CkFftComplex* invExpTable;
-    bool ownBuf; // true if memory was allocated by us, rather than user
+    void* allocBuf; // memory allocated by us (NULL if the user's buffer was used)
+    ckfft::Allocator allocator; // allocator for allocBuf
+    CkFftScaleMode fwdScaleMode;
+    CkFftScaleMode invScaleMode;
+    float fwdScaleFactor;
+    float invScaleFactor;
 
-    static _CkFftContext* create(int maxCount, CkFftDirection, void* buf, size_t* bufSize);
+    // copies of the tables for each NUMA node, each created the first time the 
+    // context is used from that node; NULL unless enabled (see 
+    // CkFftEnableNumaReplicas())
+    void* volatile* numaReplicas;
+    int numaNodeCount;
+
+    // temporary buffers for FFTs that need them; NULL unless reserved (see 
+    // CkFftReserveScratch())
+    ckfft::ScratchPool* volatile scratchPool;
+
+    bool enableNumaReplicas(int nodeCount);
+    bool reserveScratch(int threadCount);
+
+    // get the tables to use on the current thread
+    void getLocalTables(const CkFftComplex*& fwdTable, const CkFftComplex*& invTable);
+
+    // scale to apply to the output of an FFT of size count (see CkFftSetScale());
+    // real FFTs of size n should pass 2*n.
+    float getScale(CkFftSize count, bool inverse) const;
+
+    static _CkFftContext* create(CkFftSize maxCount, CkFftDirection, void* buf, size_t* bufSize);
     static void destroy(_CkFftContext*);
 
     static bool isNeonSupported();
 
 private:
     _CkFftContext();
+
+    void* createNumaReplica(int node);
 };
 
 
+namespace ckfft
+{
+
+// The context passed in, or, if it has NUMA replicas, a copy of it that uses the 
+// tables for the current thread's NUMA node; FFT entry points use this in place 
+// of the context passed in.
+class LocalContext
+{
+public:
+    explicit LocalContext(CkFftContext* context);
+
+    operator CkFftContext*() { return m_context; }
+
+private:
+    CkFftContext* m_context;
+
+    // storage for the copy, which is only constructed if it is needed
+    union
+    {
+        void* m_align;
+        double m_alignDouble;
+        char m_copyBuf[sizeof(CkFftContext)];
+    };
+};
+
+}
+
+
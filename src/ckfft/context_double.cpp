@@ -0,0 +1,99 @@
+#include "ckfft/platform.h"
+#include "ckfft/debug.h"
+#include "ckfft/context_double.h"
+
+#if CKFFT_PLATFORM_WIN
+#  define _USE_MATH_DEFINES
+#endif
+
+#include <math.h>
+#include <new>
+
+_CkFftContextD::_CkFftContextD() :
+    maxCount(0),
+    fwdExpTable(NULL),
+    invExpTable(NULL),
+    allocBuf(NULL)
+{}
+
+_CkFftContextD* _CkFftContextD::create(int maxCount, CkFftDirection direction, void* userBuf, size_t* userBufSize)
+{
+    // context object, followed by lookup table(s), all aligned
+    ckfft::AlignedBuf alignedBuf(sizeof(_CkFftContextD));
+    size_t expTableSize = maxCount * sizeof(CkFftComplexD);
+    if (direction & kCkFftDirection_Forward)
+    {
+        alignedBuf.addTable(expTableSize);
+    }
+    if (direction & kCkFftDirection_Inverse)
+    {
+        alignedBuf.addTable(expTableSize);
+    }
+
+    size_t reqBufSize = alignedBuf.getRequiredSize();
+    if (userBufSize && (!userBuf || *userBufSize < reqBufSize))
+    {
+        *userBufSize = reqBufSize;
+        return NULL;
+    }
+
+    // allocate buffer if needed
+    void* buf = alignedBuf.allocate(userBuf);
+    if (!buf)
+    {
+        return NULL;
+    }
+
+    // initialize
+    _CkFftContextD* context = new (buf) _CkFftContextD();
+
+    // lookup table(s)
+    CkFftComplexD* fwdExpBuf = NULL;
+    CkFftComplexD* invExpBuf = NULL;
+    if (direction == kCkFftDirection_Forward)
+    {
+        fwdExpBuf = (CkFftComplexD*) alignedBuf.getTable(0);
+    }
+    else if (direction == kCkFftDirection_Inverse)
+    {
+        invExpBuf = (CkFftComplexD*) alignedBuf.getTable(0);
+    }
+    else if (direction == kCkFftDirection_Both)
+    {
+        fwdExpBuf = (CkFftComplexD*) alignedBuf.getTable(0);
+        invExpBuf = (CkFftComplexD*) alignedBuf.getTable(1);
+    }
+
+    for (int i = 0; i < maxCount; ++i)
+    {
+        double theta = -2.0 * M_PI * i / maxCount;
+        double c = cos(theta);
+        double s = sin(theta);
+        if (fwdExpBuf)
+        {
+            fwdExpBuf[i].real = c;
+            fwdExpBuf[i].imag = s;
+        }
+        if (invExpBuf)
+        {
+            invExpBuf[i].real = c;
+            invExpBuf[i].imag = -s;
+        }
+    }
+
+    context->maxCount = maxCount;
+    context->fwdExpTable = fwdExpBuf;
+    context->invExpTable = invExpBuf;
+    context->allocBuf = alignedBuf.getAllocatedBuf();
+    context->allocator = alignedBuf.getAllocator();
+
+    return context;
+}
+
+void _CkFftContextD::destroy(_CkFftContextD* context)
+{
+    if (context)
+    {
+        context->allocator.free(context->allocBuf);
+    }
+}
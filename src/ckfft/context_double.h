@@ -0,0 +1,23 @@
+#pragma once
+#include "ckfft/ckfft.h"
+#include "ckfft/alloc.h"
+
+// Context for double-precision FFTs; the same as _CkFftContext, but with double 
+// twiddle factors.
+
+struct _CkFftContextD
+{
+    int maxCount;
+    const CkFftComplexD* fwdExpTable;
+    const CkFftComplexD* invExpTable;
+    void* allocBuf; // memory allocated by us (NULL if the user's buffer was used)
+    ckfft::Allocator allocator; // allocator for allocBuf
+
+    static _CkFftContextD* create(int maxCount, CkFftDirection, void* buf, size_t* bufSize);
+    static void destroy(_CkFftContextD*);
+
+private:
+    _CkFftContextD();
+};
+
+
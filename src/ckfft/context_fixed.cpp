@@ -0,0 +1,102 @@
+#include "ckfft/platform.h"
+#include "ckfft/debug.h"
+#include "ckfft/context_fixed.h"
+#include "ckfft/context.h"
+
+#if CKFFT_PLATFORM_WIN
+#  define _USE_MATH_DEFINES
+#endif
+
+#include <math.h>
+#include <new>
+
+namespace
+{
+
+// Convert a twiddle factor component to a fixed-point value with the given number
+// of fractional bits, saturating at 1.0.
+template <typename T>
+T toFixed(double x, int bits)
+{
+    double one = (double) (1LL << bits);
+    double value = floor(x * one + 0.5);
+    if (value > one - 1.0)
+    {
+        value = one - 1.0;
+    }
+    else if (value < -one)
+    {
+        value = -one;
+    }
+    return (T) value;
+}
+
+template <typename Context, typename Complex, typename T>
+Context* createFixed(int maxCount, void* userBuf, size_t* userBufSize, int bits)
+{
+    // context object, followed by lookup table, aligned
+    ckfft::AlignedBuf alignedBuf(sizeof(Context));
+    alignedBuf.addTable(maxCount * sizeof(Complex));
+
+    size_t reqBufSize = alignedBuf.getRequiredSize();
+    if (userBufSize && (!userBuf || *userBufSize < reqBufSize))
+    {
+        *userBufSize = reqBufSize;
+        return NULL;
+    }
+
+    // allocate buffer if needed
+    void* buf = alignedBuf.allocate(userBuf);
+    if (!buf)
+    {
+        return NULL;
+    }
+
+    // initialize
+    Context* context = new (buf) Context();
+
+    // lookup table; computed in double so the Q31 values are accurate to the last bit
+    Complex* expBuf = (Complex*) alignedBuf.getTable(0);
+    for (int i = 0; i < maxCount; ++i)
+    {
+        double theta = -2.0 * M_PI * i / maxCount;
+        expBuf[i].real = toFixed<T>(cos(theta), bits);
+        expBuf[i].imag = toFixed<T>(sin(theta), bits);
+    }
+
+    context->neon = _CkFftContext::isNeonSupported();
+    context->maxCount = maxCount;
+    context->expTable = expBuf;
+    context->allocBuf = alignedBuf.getAllocatedBuf();
+    context->allocator = alignedBuf.getAllocator();
+
+    return context;
+}
+
+}
+
+_CkFftContextQ15* _CkFftContextQ15::create(int maxCount, void* userBuf, size_t* userBufSize)
+{
+    return createFixed<_CkFftContextQ15, CkFftComplexQ15, short>(maxCount, userBuf, userBufSize, 15);
+}
+
+void _CkFftContextQ15::destroy(_CkFftContextQ15* context)
+{
+    if (context)
+    {
+        context->allocator.free(context->allocBuf);
+    }
+}
+
+_CkFftContextQ31* _CkFftContextQ31::create(int maxCount, void* userBuf, size_t* userBufSize)
+{
+    return createFixed<_CkFftContextQ31, CkFftComplexQ31, int>(maxCount, userBuf, userBufSize, 31);
+}
+
+void _CkFftContextQ31::destroy(_CkFftContextQ31* context)
+{
+    if (context)
+    {
+        context->allocator.free(context->allocBuf);
+    }
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include "ckfft/ckfft.h"
+#include "ckfft/alloc.h"
+
+// Contexts for fixed-point FFTs.  There is one table of forward twiddle factors, 
+// in the same format as the data; inverse FFTs use their conjugates.
+
+struct _CkFftContextQ15
+{
+    bool neon;
+    int maxCount;
+    const CkFftComplexQ15* expTable;
+    void* allocBuf; // memory allocated by us (NULL if the user's buffer was used)
+    ckfft::Allocator allocator; // allocator for allocBuf
+
+    static _CkFftContextQ15* create(int maxCount, void* buf, size_t* bufSize);
+    static void destroy(_CkFftContextQ15*);
+};
+
+struct _CkFftContextQ31
+{
+    bool neon;
+    int maxCount;
+    const CkFftComplexQ31* expTable;
+    void* allocBuf; // memory allocated by us (NULL if the user's buffer was used)
+    ckfft::Allocator allocator; // allocator for allocBuf
+
+    static _CkFftContextQ31* create(int maxCount, void* buf, size_t* bufSize);
+    static void destroy(_CkFftContextQ31*);
+};
+
+
@@ -0,0 +1,248 @@
+#include "ckfft/platform.h"
+#include "ckfft/debug.h"
+#include "ckfft/convert.h"
+#include "ckfft/half.h"
+#include "ckfft/math_util.h"
+
+
+namespace ckfft
+{
+
+namespace
+{
+
+// Convert the complex value at index i of input, stored as a pair of integers.
+template <typename T>
+inline void load(const T* input, CkFftSize i, float scale, CkFftComplex& out)
+{
+    out.real = input[i*2] * scale;
+    out.imag = input[i*2 + 1] * scale;
+}
+
+template <typename T>
+CkFftSize convertFirstStep(
+        const T* input, 
+        float scale, 
+        CkFftComplex* output, 
+        CkFftSize count,
+        bool inverse)
+{
+    if (count == 1)
+    {
+        load(input, 0, scale, output[0]);
+        return 1;
+    }
+
+    // j is the input index of the first value of each block of the output, in 
+    // bit-reversed order
+    CkFftComplex* out = output;
+    CkFftSize j = 0;
+    if (isPowerOfFour(count))
+    {
+        // Radix-4 step with sub-DFTs of size 1 (so with no twiddle factors): in
+        // bit-reversed order, each block of 4 values would be inputs j, j+2q, j+q,
+        // and j+3q (where q = count/4), which are F0, F2, F1, F3 (see radix4() in
+        // fft_default.cpp).
+        CkFftSize q = count / 4;
+        CkFftComplex f0, f1, f2, f3;
+        CkFftComplex sum02, diff02, sum13, diff13;
+        for (CkFftSize b = 0; b < q; ++b)
+        {
+            load(input, j, scale, f0);
+            load(input, j + q, scale, f1);
+            load(input, j + 2*q, scale, f2);
+            load(input, j + 3*q, scale, f3);
+
+            add(f0, f2, sum02);
+            subtract(f0, f2, diff02);
+            add(f1, f3, sum13);
+            subtract(f1, f3, diff13);
+
+            add(sum02, sum13, out[0]);
+            subtract(sum02, sum13, out[2]);
+            if (inverse)
+            {
+                out[1].real = diff02.real - diff13.imag;
+                out[1].imag = diff02.imag + diff13.real;
+                out[3].real = diff02.real + diff13.imag;
+                out[3].imag = diff02.imag - diff13.real;
+            }
+            else
+            {
+                out[1].real = diff02.real + diff13.imag;
+                out[1].imag = diff02.imag - diff13.real;
+                out[3].real = diff02.real - diff13.imag;
+                out[3].imag = diff02.imag + diff13.real;
+            }
+            out += 4;
+
+            // increment j in bit-reversed order
+            CkFftSize bit = q >> 1;
+            while (j & bit)
+            {
+                j ^= bit;
+                bit >>= 1;
+            }
+            j |= bit;
+        }
+        return 4;
+    }
+    else
+    {
+        // radix-2 step: each pair would be inputs j and j+h (where h = count/2)
+        CkFftSize h = count / 2;
+        CkFftComplex a, b;
+        for (CkFftSize i = 0; i < h; ++i)
+        {
+            load(input, j, scale, a);
+            load(input, j + h, scale, b);
+            add(a, b, out[0]);
+            subtract(a, b, out[1]);
+            out += 2;
+
+            // increment j in bit-reversed order
+            CkFftSize bit = h >> 1;
+            while (j & bit)
+            {
+                j ^= bit;
+                bit >>= 1;
+            }
+            j |= bit;
+        }
+        return 2;
+    }
+}
+
+}
+
+CkFftSize convert_int16(
+        const short* input, 
+        float scale, 
+        CkFftComplex* output, 
+        CkFftSize count,
+        bool inverse)
+{
+    return convertFirstStep(input, scale, output, count, inverse);
+}
+
+CkFftSize convert_int8(
+        const signed char* input, 
+        float scale, 
+        CkFftComplex* output, 
+        CkFftSize count,
+        bool inverse)
+{
+    return convertFirstStep(input, scale, output, count, inverse);
+}
+
+void convert_windowed(
+        const float* input, 
+        const float* window, 
+        CkFftComplex* output, 
+        CkFftSize count)
+{
+    const float* in = input;
+    const float* w = window;
+    CkFftSize j = 0;
+    for (CkFftSize i = 0; i < count; ++i)
+    {
+        output[j].real = in[0] * w[0];
+        output[j].imag = in[1] * w[1];
+        in += 2;
+        w += 2;
+
+        // increment j in bit-reversed order
+        CkFftSize bit = count >> 1;
+        while (j & bit)
+        {
+            j ^= bit;
+            bit >>= 1;
+        }
+        j |= bit;
+    }
+}
+
+void convert_half(
+        const CkFftHalf* input, 
+        bool bfloat16, 
+        CkFftComplex* output, 
+        CkFftSize count)
+{
+    const CkFftHalf* in = input;
+    CkFftSize j = 0;
+    for (CkFftSize i = 0; i < count; ++i)
+    {
+        if (bfloat16)
+        {
+            output[j].real = bfloat16ToFloat(in[0]);
+            output[j].imag = bfloat16ToFloat(in[1]);
+        }
+        else
+        {
+            output[j].real = halfToFloat(in[0]);
+            output[j].imag = halfToFloat(in[1]);
+        }
+        in += 2;
+
+        // increment j in bit-reversed order
+        CkFftSize bit = count >> 1;
+        while (j & bit)
+        {
+            j ^= bit;
+            bit >>= 1;
+        }
+        j |= bit;
+    }
+}
+
+void convert_from_half_default(
+        const CkFftHalf* input, 
+        bool bfloat16, 
+        float* output, 
+        CkFftSize count)
+{
+    const CkFftHalf* in = input;
+    const CkFftHalf* inEnd = input + count;
+    float* out = output;
+    if (bfloat16)
+    {
+        while (in < inEnd)
+        {
+            *out++ = bfloat16ToFloat(*in++);
+        }
+    }
+    else
+    {
+        while (in < inEnd)
+        {
+            *out++ = halfToFloat(*in++);
+        }
+    }
+}
+
+void convert_to_half_default(
+        const float* input, 
+        bool bfloat16, 
+        CkFftHalf* output, 
+        CkFftSize count)
+{
+    const float* in = input;
+    const float* inEnd = input + count;
+    CkFftHalf* out = output;
+    if (bfloat16)
+    {
+        while (in < inEnd)
+        {
+            *out++ = floatToBfloat16(*in++);
+        }
+    }
+    else
+    {
+        while (in < inEnd)
+        {
+            *out++ = floatToHalf(*in++);
+        }
+    }
+}
+
+} // namespace ckfft
@@ -0,0 +1,59 @@
+#pragma once
+#include "ckfft/ckfft.h"
+
+
+namespace ckfft
+{
+
+// Convert count complex values, stored as interleaved pairs of integers, to 
+// floating-point, multiply them by scale, and perform the first step of a
+// decimation-in-time FFT on them as they are read: the output is the sub-DFTs of
+// the size returned (4 if count is a power of 4, otherwise 2, or 1 if count is 1),
+// to be combined with fft_dit_steps_default().  This takes the place of both the
+// bit-reversal step and the first step of an in-place FFT.
+
+CkFftSize convert_int16(
+        const short* input, 
+        float scale, 
+        CkFftComplex* output, 
+        CkFftSize count,
+        bool inverse);
+
+CkFftSize convert_int8(
+        const signed char* input, 
+        float scale, 
+        CkFftComplex* output, 
+        CkFftSize count,
+        bool inverse);
+
+// Convert count complex values formed from pairs of real values, each multiplied
+// by the corresponding value of window (which has 2*count values), and store them
+// in bit-reversed order.  This takes the place of the bit-reversal step of an 
+// in-place FFT.
+void convert_windowed(
+        const float* input, 
+        const float* window, 
+        CkFftComplex* output, 
+        CkFftSize count);
+
+// Same for values stored as pairs of fp16 or bfloat16 values (without scaling).
+void convert_half(
+        const CkFftHalf* input, 
+        bool bfloat16, 
+        CkFftComplex* output, 
+        CkFftSize count);
+
+// Convert count values between float and fp16 or bfloat16, in order.
+void convert_from_half_default(
+        const CkFftHalf* input, 
+        bool bfloat16, 
+        float* output, 
+        CkFftSize count);
+
+void convert_to_half_default(
+        const float* input, 
+        bool bfloat16, 
+        CkFftHalf* output, 
+        CkFftSize count);
+
+}
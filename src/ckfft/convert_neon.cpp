@@ -0,0 +1,132 @@
+#include "ckfft/platform.h"
+#include "ckfft/debug.h"
+#include "ckfft/convert_neon.h"
+#include "ckfft/convert.h"
+
+#if CKFFT_ARM_NEON
+#  include <arm_neon.h>
+#endif 
+
+namespace ckfft
+{
+
+#if CKFFT_ARM_NEON
+
+void convert_from_half_neon(
+        const CkFftHalf* input, 
+        bool bfloat16, 
+        float* output, 
+        CkFftSize count)
+{
+    const CkFftHalf* in = input;
+    const CkFftHalf* inEnd = input + (count & ~3);
+    float* out = output;
+    if (bfloat16)
+    {
+        // bfloat16 values are the high 16 bits of floats
+        while (in < inEnd)
+        {
+            uint16x4_t in_v = vld1_u16((const uint16_t*) in);
+            uint32x4_t bits_v = vshll_n_u16(in_v, 16);
+            vst1q_f32((float32_t*) out, vreinterpretq_f32_u32(bits_v));
+            in += 4;
+            out += 4;
+        }
+    }
+#if CKFFT_ARM_NEON_FP16
+    else
+    {
+        while (in < inEnd)
+        {
+            float16x4_t in_v = vreinterpret_f16_u16(vld1_u16((const uint16_t*) in));
+            vst1q_f32((float32_t*) out, vcvt_f32_f16(in_v));
+            in += 4;
+            out += 4;
+        }
+    }
+#else
+    else
+    {
+        // no half-precision conversion instructions
+        convert_from_half_default(input, bfloat16, output, count);
+        return;
+    }
+#endif
+
+    // remaining values
+    convert_from_half_default(in, bfloat16, out, count & 3);
+}
+
+void convert_to_half_neon(
+        const float* input, 
+        bool bfloat16, 
+        CkFftHalf* output, 
+        CkFftSize count)
+{
+    const float* in = input;
+    const float* inEnd = input + (count & ~3);
+    CkFftHalf* out = output;
+    if (bfloat16)
+    {
+        // round to nearest even, then take the high 16 bits; NaNs are handled 
+        // separately, so they don't round to infinity
+        uint32x4_t round_v = vdupq_n_u32(0x7fff);
+        uint32x4_t one_v = vdupq_n_u32(1);
+        uint32x4_t inf_v = vdupq_n_u32(0x7f800000);
+        uint32x4_t abs_v = vdupq_n_u32(0x7fffffff);
+        uint32x4_t quiet_v = vdupq_n_u32(0x00400000);
+        while (in < inEnd)
+        {
+            uint32x4_t bits_v = vreinterpretq_u32_f32(vld1q_f32((const float32_t*) in));
+            uint32x4_t nan_v = vcgtq_u32(vandq_u32(bits_v, abs_v), inf_v);
+            uint32x4_t lsb_v = vandq_u32(vshrq_n_u32(bits_v, 16), one_v);
+            uint32x4_t rounded_v = vaddq_u32(bits_v, vaddq_u32(round_v, lsb_v));
+            bits_v = vbslq_u32(nan_v, vorrq_u32(bits_v, quiet_v), rounded_v);
+            vst1_u16((uint16_t*) out, vshrn_n_u32(bits_v, 16));
+            in += 4;
+            out += 4;
+        }
+    }
+#if CKFFT_ARM_NEON_FP16
+    else
+    {
+        while (in < inEnd)
+        {
+            float16x4_t out_v = vcvt_f16_f32(vld1q_f32((const float32_t*) in));
+            vst1_u16((uint16_t*) out, vreinterpret_u16_f16(out_v));
+            in += 4;
+            out += 4;
+        }
+    }
+#else
+    else
+    {
+        // no half-precision conversion instructions
+        convert_to_half_default(input, bfloat16, output, count);
+        return;
+    }
+#endif
+
+    // remaining values
+    convert_to_half_default(in, bfloat16, out, count & 3);
+}
+
+#else // CKFFT_ARM_NEON
+
+void convert_from_half_neon(
+        const CkFftHalf* input, 
+        bool bfloat16, 
+        float* output, 
+        CkFftSize count)
+{}
+
+void convert_to_half_neon(
+        const float* input, 
+        bool bfloat16, 
+        CkFftHalf* output, 
+        CkFftSize count)
+{}
+
+#endif // CKFFT_ARM_NEON
+
+} // namespace ckfft
@@ -0,0 +1,22 @@
+#pragma once
+#include "ckfft/ckfft.h"
+
+
+namespace ckfft
+{
+
+// see convert_from_half_default(), convert_to_half_default()
+
+void convert_from_half_neon(
+        const CkFftHalf* input, 
+        bool bfloat16, 
+        float* output, 
+        CkFftSize count);
+
+void convert_to_half_neon(
+        const float* input, 
+        bool bfloat16, 
+        CkFftHalf* output, 
+        CkFftSize count);
+
+}
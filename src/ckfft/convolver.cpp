@@ -0,0 +1,167 @@
+#include "ckfft/platform.h"
+#include "ckfft/debug.h"
+#include "ckfft/convolver.h"
+#include "ckfft/context.h"
+#include "ckfft/fft_real.h"
+#include "ckfft/spectral.h"
+#include "ckfft/scratch.h"
+#include <new>
+#include <string.h>
+
+using namespace ckfft;
+
+_CkFftConvolver::_CkFftConvolver() :
+    context(NULL),
+    filterSize(0),
+    blockSize(0),
+    fftSize(0),
+    channelCount(0),
+    filterSpectrum(NULL),
+    rings(NULL),
+    ringPos(NULL),
+    allocBuf(NULL)
+{}
+
+CkFftSize _CkFftConvolver::getFftSize(CkFftSize filterSize, CkFftSize blockSize)
+{
+    // each FFT gives blockSize output samples, from blockSize new input samples 
+    // and the filterSize - 1 before them
+    CkFftSize fftSize = 1;
+    while (fftSize < filterSize + blockSize - 1)
+    {
+        fftSize *= 2;
+    }
+    return fftSize;
+}
+
+_CkFftConvolver* _CkFftConvolver::create(CkFftContext* context, const float* filter, CkFftSize filterSize, CkFftSize blockSize, int channelCount, void* userBuf, size_t* userBufSize)
+{
+    CkFftSize fftSize = getFftSize(filterSize, blockSize);
+    CkFftSize spectrumSize = fftSize/2 + 1;
+    if ((size_t) channelCount > ((size_t) -1) / (fftSize * 2 * sizeof(float)))
+    {
+        return NULL;
+    }
+
+    // object, followed by the filter spectrum, the rings and their positions, 
+    // all aligned
+    AlignedBuf alignedBuf(sizeof(_CkFftConvolver));
+    alignedBuf.addTable(spectrumSize * sizeof(CkFftComplex));
+    alignedBuf.addTable(channelCount * fftSize * 2 * sizeof(float));
+    alignedBuf.addTable(channelCount * sizeof(CkFftSize));
+
+    size_t reqBufSize = alignedBuf.getRequiredSize();
+    if (userBufSize && (!userBuf || *userBufSize < reqBufSize))
+    {
+        *userBufSize = reqBufSize;
+        return NULL;
+    }
+
+    // allocate buffer if needed
+    void* buf = alignedBuf.allocate(userBuf);
+    if (!buf)
+    {
+        return NULL;
+    }
+
+    // initialize
+    _CkFftConvolver* conv = new (buf) _CkFftConvolver();
+    conv->context = context;
+    conv->filterSize = filterSize;
+    conv->blockSize = blockSize;
+    conv->fftSize = fftSize;
+    conv->channelCount = channelCount;
+    conv->rings = (float*) alignedBuf.getTable(1);
+    conv->ringPos = (CkFftSize*) alignedBuf.getTable(2);
+    conv->allocBuf = alignedBuf.getAllocatedBuf();
+    conv->allocator = alignedBuf.getAllocator();
+
+    // filter spectrum, computed in place from the zero-padded filter
+    CkFftComplex* spectrum = (CkFftComplex*) alignedBuf.getTable(0);
+    float* padded = (float*) spectrum;
+    memcpy(padded, filter, filterSize * sizeof(float));
+    memset(padded + filterSize, 0, (fftSize - filterSize) * sizeof(float));
+    LocalContext local(context);
+    fft_real(local, padded, 1, spectrum, fftSize, false);
+
+    // The real forward FFT gives 2*fwdScale*DFT(x), and the inverse gives 
+    // fftSize*invScale*IDFT(X) (where IDFT includes 1/fftSize), so without this 
+    // the output would be scaled by 4*fftSize*fwdScale^2*invScale.
+    float fwdScale = context->getScale(fftSize * 2, false);
+    float invScale = context->getScale(fftSize * 2, true);
+    float scale = 1.0f / (4.0f * (float) fftSize * fwdScale * fwdScale * invScale);
+    for (CkFftSize i = 0; i < spectrumSize; ++i)
+    {
+        spectrum[i].real *= scale;
+        spectrum[i].imag *= scale;
+    }
+    conv->filterSpectrum = spectrum;
+
+    conv->reset();
+    return conv;
+}
+
+void _CkFftConvolver::destroy(_CkFftConvolver* conv)
+{
+    if (conv)
+    {
+        conv->allocator.free(conv->allocBuf);
+    }
+}
+
+void _CkFftConvolver::reset()
+{
+    // each channel starts as if it were preceded by silence
+    memset(rings, 0, channelCount * fftSize * 2 * sizeof(float));
+    for (int i = 0; i < channelCount; ++i)
+    {
+        ringPos[i] = 0;
+    }
+}
+
+bool _CkFftConvolver::process(int channel, const float* input, float* output)
+{
+    ScratchBuf scratch(context, NULL, fftSize/2 + 1);
+    if (!scratch.get())
+    {
+        return false;
+    }
+
+    // add the input to the ring, wrapping around at the end
+    float* ring = rings + channel * fftSize * 2;
+    CkFftSize pos = ringPos[channel];
+    const float* in = input;
+    CkFftSize remaining = blockSize;
+    while (remaining > 0)
+    {
+        CkFftSize n = fftSize - pos;
+        if (n > remaining)
+        {
+            n = remaining;
+        }
+        memcpy(ring + pos, in, n * sizeof(float));
+        memcpy(ring + pos + fftSize, in, n * sizeof(float));
+        in += n;
+        remaining -= n;
+        pos += n;
+        if (pos == fftSize)
+        {
+            pos = 0;
+        }
+    }
+    ringPos[channel] = pos;
+
+    // Transform the last fftSize samples, multiply by the filter spectrum, and 
+    // transform back in place; the last blockSize values are the output (the 
+    // others are wrapped around by the circular convolution, and are discarded).
+    LocalContext local(context);
+    CkFftComplex* spectrum = scratch.get();
+    float* result = (float*) spectrum;
+    fft_real(local, ring + pos, 1, spectrum, fftSize, false);
+    spectral_multiply(local, spectrum, filterSpectrum, spectrum, fftSize/2 + 1, false);
+    fft_real_inverse(local, spectrum, result, 1, fftSize, NULL, false);
+    memcpy(output, result + fftSize - blockSize, blockSize * sizeof(float));
+
+    return true;
+}
+
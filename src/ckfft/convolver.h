@@ -0,0 +1,44 @@
+#pragma once
+#include "ckfft/ckfft.h"
+#include "ckfft/alloc.h"
+
+// Overlap-save FIR filter (see CkFftConvolverInit()).
+
+struct _CkFftConvolver
+{
+    CkFftContext* context;
+    CkFftSize filterSize;
+    CkFftSize blockSize;
+    CkFftSize fftSize;
+    int channelCount;
+
+    // spectrum of the filter, fftSize/2+1 values, scaled so that the output of 
+    // the inverse FFT needs no scaling
+    const CkFftComplex* filterSpectrum;
+
+    // For each channel, the last fftSize input samples, each stored twice (at i 
+    // and i + fftSize) so that they are contiguous; channel c's ring starts at 
+    // rings + c*2*fftSize.
+    float* rings;
+    CkFftSize* ringPos;  // for each channel, position of the oldest sample 
+
+    void* allocBuf; // memory allocated by us (NULL if the user's buffer was used)
+    ckfft::Allocator allocator; // allocator for allocBuf
+
+    // filter blockSize samples of one channel; returns false if a temporary 
+    // buffer couldn't be allocated
+    bool process(int channel, const float* input, float* output);
+
+    void reset();
+
+    static _CkFftConvolver* create(CkFftContext* context, const float* filter, CkFftSize filterSize, CkFftSize blockSize, int channelCount, void* buf, size_t* bufSize);
+    static void destroy(_CkFftConvolver*);
+
+    // size of the FFTs used for a filter and block size
+    static CkFftSize getFftSize(CkFftSize filterSize, CkFftSize blockSize);
+
+private:
+    _CkFftConvolver();
+};
+
+
@@ -0,0 +1,220 @@
+#include "ckfft/platform.h"
+#include "ckfft/debug.h"
+#include "ckfft/convolver_matrix.h"
+#include "ckfft/convolver.h"
+#include "ckfft/context.h"
+#include "ckfft/fft_real.h"
+#include "ckfft/spectral.h"
+#include "ckfft/math_util.h"
+#include <new>
+#include <string.h>
+
+using namespace ckfft;
+
+namespace
+{
+    // Number of frequency bins multiplied and added at a time; the inputs' values
+    // for a tile stay in the cache while they are used for each output.
+    const CkFftSize k_tileSize = 256;
+}
+
+_CkFftConvolverMatrix::_CkFftConvolverMatrix() :
+    context(NULL),
+    filterSize(0),
+    blockSize(0),
+    fftSize(0),
+    inputCount(0),
+    outputCount(0),
+    spectrumStride(0),
+    filterSpectra(NULL),
+    paths(NULL),
+    spectra(NULL),
+    rings(NULL),
+    ringPos(0),
+    allocBuf(NULL)
+{}
+
+_CkFftConvolverMatrix* _CkFftConvolverMatrix::create(CkFftContext* context, const float* const* filters, CkFftSize filterSize, int inputCount, int outputCount, CkFftSize blockSize, void* userBuf, size_t* userBufSize)
+{
+    CkFftSize fftSize = CkFftConvolver::getFftSize(filterSize, blockSize);
+    CkFftSize spectrumSize = fftSize/2 + 1;
+    size_t spectrumBytes = alignSize(spectrumSize * sizeof(CkFftComplex));
+
+    int pathCount = 0;
+    for (int i = 0; i < inputCount * outputCount; ++i)
+    {
+        if (filters[i])
+        {
+            ++pathCount;
+        }
+    }
+
+    size_t maxCount = ((size_t) -1) / 4 / spectrumBytes;
+    if ((size_t) pathCount > maxCount || (size_t) inputCount + outputCount > maxCount)
+    {
+        return NULL;
+    }
+
+    // object, followed by the filter spectra, the paths, the input and output 
+    // spectra, and the rings, all aligned
+    AlignedBuf alignedBuf(sizeof(_CkFftConvolverMatrix));
+    alignedBuf.addTable(pathCount * spectrumBytes);
+    alignedBuf.addTable(inputCount * outputCount * sizeof(CkFftSize));
+    alignedBuf.addTable((inputCount + outputCount) * spectrumBytes);
+    alignedBuf.addTable(inputCount * fftSize * 2 * sizeof(float));
+
+    size_t reqBufSize = alignedBuf.getRequiredSize();
+    if (userBufSize && (!userBuf || *userBufSize < reqBufSize))
+    {
+        *userBufSize = reqBufSize;
+        return NULL;
+    }
+
+    // allocate buffer if needed
+    void* buf = alignedBuf.allocate(userBuf);
+    if (!buf)
+    {
+        return NULL;
+    }
+
+    // initialize
+    _CkFftConvolverMatrix* matrix = new (buf) _CkFftConvolverMatrix();
+    matrix->context = context;
+    matrix->filterSize = filterSize;
+    matrix->blockSize = blockSize;
+    matrix->fftSize = fftSize;
+    matrix->inputCount = inputCount;
+    matrix->outputCount = outputCount;
+    matrix->spectrumStride = (CkFftSize) (spectrumBytes / sizeof(CkFftComplex));
+    matrix->spectra = (CkFftComplex*) alignedBuf.getTable(2);
+    matrix->rings = (float*) alignedBuf.getTable(3);
+    matrix->allocBuf = alignedBuf.getAllocatedBuf();
+    matrix->allocator = alignedBuf.getAllocator();
+
+    // filter spectra, each computed in place from the zero-padded filter, and 
+    // scaled as for CkFftConvolver
+    float fwdScale = context->getScale(fftSize * 2, false);
+    float invScale = context->getScale(fftSize * 2, true);
+    float scale = 1.0f / (4.0f * (float) fftSize * fwdScale * fwdScale * invScale);
+    LocalContext local(context);
+    CkFftComplex* filterSpectra = (CkFftComplex*) alignedBuf.getTable(0);
+    CkFftSize* paths = (CkFftSize*) alignedBuf.getTable(1);
+    CkFftSize path = 0;
+    for (int i = 0; i < inputCount * outputCount; ++i)
+    {
+        if (filters[i])
+        {
+            CkFftComplex* spectrum = filterSpectra + path * matrix->spectrumStride;
+            float* padded = (float*) spectrum;
+            memcpy(padded, filters[i], filterSize * sizeof(float));
+            memset(padded + filterSize, 0, (fftSize - filterSize) * sizeof(float));
+            fft_real(local, padded, 1, spectrum, fftSize, false);
+            applyScale(spectrum, spectrumSize, scale);
+            paths[i] = path++;
+        }
+        else
+        {
+            paths[i] = -1;
+        }
+    }
+    matrix->filterSpectra = filterSpectra;
+    matrix->paths = paths;
+
+    matrix->reset();
+    return matrix;
+}
+
+void _CkFftConvolverMatrix::destroy(_CkFftConvolverMatrix* matrix)
+{
+    if (matrix)
+    {
+        matrix->allocator.free(matrix->allocBuf);
+    }
+}
+
+void _CkFftConvolverMatrix::reset()
+{
+    // each input starts as if it were preceded by silence
+    memset(rings, 0, inputCount * fftSize * 2 * sizeof(float));
+    ringPos = 0;
+}
+
+void _CkFftConvolverMatrix::process(const float* const* inputs, float* const* outputs)
+{
+    LocalContext local(context);
+    CkFftSize spectrumSize = fftSize/2 + 1;
+
+    // add each input to its ring (in at most 2 pieces, since the block is smaller
+    // than the ring), and transform its last fftSize samples
+    CkFftSize count = fftSize - ringPos;
+    if (count > blockSize)
+    {
+        count = blockSize;
+    }
+    CkFftSize pos = (ringPos + blockSize) & (fftSize - 1);
+    for (int i = 0; i < inputCount; ++i)
+    {
+        float* ring = rings + i * fftSize * 2;
+        const float* input = inputs[i];
+        memcpy(ring + ringPos, input, count * sizeof(float));
+        memcpy(ring + ringPos + fftSize, input, count * sizeof(float));
+        memcpy(ring, input + count, (blockSize - count) * sizeof(float));
+        memcpy(ring + fftSize, input + count, (blockSize - count) * sizeof(float));
+
+        fft_real(local, ring + pos, 1, spectra + i * spectrumStride, fftSize, false);
+    }
+    ringPos = pos;
+
+    // Sum the products of the input spectra and the filter spectra for each 
+    // output, a tile of bins at a time, so each input's tile is read from memory
+    // once.
+    CkFftComplex* sums = spectra + inputCount * spectrumStride;
+    for (CkFftSize start = 0; start < spectrumSize; start += k_tileSize)
+    {
+        CkFftSize tileSize = spectrumSize - start;
+        if (tileSize > k_tileSize)
+        {
+            tileSize = k_tileSize;
+        }
+        for (int o = 0; o < outputCount; ++o)
+        {
+            CkFftComplex* sum = sums + o * spectrumStride + start;
+            const CkFftSize* outputPaths = paths + o * inputCount;
+            bool first = true;
+            for (int i = 0; i < inputCount; ++i)
+            {
+                if (outputPaths[i] >= 0)
+                {
+                    const CkFftComplex* inputSpectrum = spectra + i * spectrumStride + start;
+                    const CkFftComplex* filterSpectrum = filterSpectra + outputPaths[i] * spectrumStride + start;
+                    if (first)
+                    {
+                        spectral_multiply(local, inputSpectrum, filterSpectrum, sum, tileSize, false);
+                        first = false;
+                    }
+                    else
+                    {
+                        spectral_multiply_add(local, inputSpectrum, filterSpectrum, sum, tileSize, false);
+                    }
+                }
+            }
+            if (first)
+            {
+                // no filters to this output
+                memset(sum, 0, tileSize * sizeof(CkFftComplex));
+            }
+        }
+    }
+
+    // Transform each output's sum back in place; the last blockSize values are
+    // the output (the others are wrapped around by the circular convolution, and
+    // are discarded).
+    for (int o = 0; o < outputCount; ++o)
+    {
+        CkFftComplex* sum = sums + o * spectrumStride;
+        float* result = (float*) sum;
+        fft_real_inverse(local, sum, result, 1, fftSize, NULL, false);
+        memcpy(outputs[o], result + fftSize - blockSize, blockSize * sizeof(float));
+    }
+}
+
@@ -0,0 +1,51 @@
+#pragma once
+#include "ckfft/ckfft.h"
+#include "ckfft/alloc.h"
+
+// Convolution of several inputs with a matrix of FIR filters, giving several 
+// outputs (see CkFftConvolverMatrixInit()).
+
+struct _CkFftConvolverMatrix
+{
+    CkFftContext* context;
+    CkFftSize filterSize;
+    CkFftSize blockSize;
+    CkFftSize fftSize;
+    int inputCount;
+    int outputCount;
+
+    // Spectra are fftSize/2+1 values, spectrumStride apart so each is aligned.
+    CkFftSize spectrumStride;
+
+    // spectrum of the filter from input i to output o is filterSpectra + 
+    // paths[o*inputCount + i]*spectrumStride, or there is none if the path is -1; 
+    // scaled as for CkFftConvolver
+    const CkFftComplex* filterSpectra;
+    const CkFftSize* paths;
+
+    // spectra of the inputs' last blocks (inputCount), followed by the sums for 
+    // each output (outputCount)
+    CkFftComplex* spectra;
+
+    // For each input, the last fftSize samples, each stored twice (at i and 
+    // i + fftSize) so that they are contiguous; input i's ring starts at 
+    // rings + i*2*fftSize.  All the inputs are at the same position.
+    float* rings;
+    CkFftSize ringPos;
+
+    void* allocBuf; // memory allocated by us (NULL if the user's buffer was used)
+    ckfft::Allocator allocator; // allocator for allocBuf
+
+    // filter blockSize samples of each input
+    void process(const float* const* inputs, float* const* outputs);
+
+    void reset();
+
+    static _CkFftConvolverMatrix* create(CkFftContext* context, const float* const* filters, CkFftSize filterSize, int inputCount, int outputCount, CkFftSize blockSize, void* buf, size_t* bufSize);
+    static void destroy(_CkFftConvolverMatrix*);
+
+private:
+    _CkFftConvolverMatrix();
+};
+
+
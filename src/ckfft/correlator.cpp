@@ -0,0 +1,162 @@
+#include "ckfft/platform.h"
+#include "ckfft/debug.h"
+#include "ckfft/correlator.h"
+#include "ckfft/context.h"
+#include "ckfft/fft_real.h"
+#include "ckfft/spectral.h"
+#include <new>
+#include <string.h>
+
+using namespace ckfft;
+
+_CkFftCorrelator::_CkFftCorrelator() :
+    context(NULL),
+    size(0),
+    weighting(kCkFftWeighting_None),
+    smoothing(0.0f),
+    powerX(NULL),
+    powerY(NULL),
+    first(true),
+    spectrumX(NULL),
+    spectrumY(NULL),
+    allocBuf(NULL)
+{}
+
+_CkFftCorrelator* _CkFftCorrelator::create(CkFftContext* context, CkFftSize size, CkFftWeighting weighting, float smoothing, void* userBuf, size_t* userBufSize)
+{
+    CkFftSize spectrumSize = size/2 + 1;
+
+    // object, followed by the power spectra and the spectra, all aligned
+    AlignedBuf alignedBuf(sizeof(_CkFftCorrelator));
+    alignedBuf.addTable(spectrumSize * sizeof(float));
+    alignedBuf.addTable(spectrumSize * sizeof(float));
+    alignedBuf.addTable(spectrumSize * sizeof(CkFftComplex));
+    alignedBuf.addTable(spectrumSize * sizeof(CkFftComplex));
+
+    size_t reqBufSize = alignedBuf.getRequiredSize();
+    if (userBufSize && (!userBuf || *userBufSize < reqBufSize))
+    {
+        *userBufSize = reqBufSize;
+        return NULL;
+    }
+
+    // allocate buffer if needed
+    void* buf = alignedBuf.allocate(userBuf);
+    if (!buf)
+    {
+        return NULL;
+    }
+
+    // initialize
+    _CkFftCorrelator* corr = new (buf) _CkFftCorrelator();
+    corr->context = context;
+    corr->size = size;
+    corr->weighting = weighting;
+    corr->smoothing = smoothing;
+    corr->powerX = (float*) alignedBuf.getTable(0);
+    corr->powerY = (float*) alignedBuf.getTable(1);
+    corr->spectrumX = (CkFftComplex*) alignedBuf.getTable(2);
+    corr->spectrumY = (CkFftComplex*) alignedBuf.getTable(3);
+    corr->allocBuf = alignedBuf.getAllocatedBuf();
+    corr->allocator = alignedBuf.getAllocator();
+
+    corr->reset();
+    return corr;
+}
+
+void _CkFftCorrelator::destroy(_CkFftCorrelator* corr)
+{
+    if (corr)
+    {
+        corr->allocator.free(corr->allocBuf);
+    }
+}
+
+void _CkFftCorrelator::reset()
+{
+    CkFftSize spectrumSize = size/2 + 1;
+    memset(powerX, 0, spectrumSize * sizeof(float));
+    memset(powerY, 0, spectrumSize * sizeof(float));
+    first = true;
+}
+
+void _CkFftCorrelator::process(const float* x, const float* y, CkFftSize count, float* output)
+{
+    // transform the zero-padded signals in place
+    LocalContext local(context);
+    float* paddedX = (float*) spectrumX;
+    memcpy(paddedX, x, count * sizeof(float));
+    memset(paddedX + count, 0, (size - count) * sizeof(float));
+    fft_real(local, paddedX, 1, spectrumX, size, false);
+
+    float* paddedY = (float*) spectrumY;
+    memcpy(paddedY, y, count * sizeof(float));
+    memset(paddedY + count, 0, (size - count) * sizeof(float));
+    fft_real(local, paddedY, 1, spectrumY, size, false);
+
+    processSpectra(spectrumX, spectrumY, output);
+}
+
+void _CkFftCorrelator::processSpectra(const CkFftComplex* x, const CkFftComplex* y, float* output)
+{
+    // The real forward FFT gives 2*fwdScale*DFT(x), and the inverse gives 
+    // size*invScale*IDFT(X) (where IDFT includes 1/size), so the plain 
+    // cross-spectrum is scaled by 4*size*fwdScale^2*invScale.  The weighted 
+    // cross-spectra don't depend on the forward scale.
+    LocalContext local(context);
+    float fwdScale = context->getScale(size * 2, false);
+    float invScale = context->getScale(size * 2, true);
+    float scale = 1.0f / ((float) size * invScale);
+    if (weighting == kCkFftWeighting_None)
+    {
+        scale /= 4.0f * fwdScale * fwdScale;
+    }
+
+    // weighted cross-spectrum into spectrumX (which may be x), then the inverse FFT,
+    // using spectrumY (which may be y, but is no longer needed) as a temporary buffer
+    spectral_correlate(local, x, y, weighting, powerX, powerY, (first ? 0.0f : smoothing), scale, spectrumX, size/2 + 1);
+    first = false;
+    fft_real_inverse(local, spectrumX, output, 1, size, spectrumY, false);
+}
+
+void _CkFftCorrelator::findPeak(const float* correlation, CkFftSize maxLag, float* lag, float* value) const
+{
+    // lag 0 is in the middle
+    CkFftSize center = size/2;
+    CkFftSize start = (maxLag < center ? center - maxLag : 0);
+    CkFftSize end = (maxLag < center ? center + maxLag : size - 1);
+
+    CkFftSize peak = start;
+    for (CkFftSize i = start + 1; i <= end; ++i)
+    {
+        if (correlation[i] > correlation[peak])
+        {
+            peak = i;
+        }
+    }
+
+    // fit a parabola to the peak and its neighbours
+    float offset = 0.0f;
+    float peakValue = correlation[peak];
+    if (peak > 0 && peak < size - 1)
+    {
+        float prev = correlation[peak - 1];
+        float next = correlation[peak + 1];
+        float curvature = prev - 2.0f * peakValue + next;
+        if (curvature < 0.0f)
+        {
+            offset = 0.5f * (prev - next) / curvature;
+            peakValue -= 0.25f * (prev - next) * offset;
+        }
+    }
+
+    if (lag)
+    {
+        *lag = (float) (peak - center) + offset;
+    }
+    if (value)
+    {
+        *value = peakValue;
+    }
+}
+
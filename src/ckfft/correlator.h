@@ -0,0 +1,45 @@
+#pragma once
+#include "ckfft/ckfft.h"
+#include "ckfft/alloc.h"
+
+// Generalized cross-correlation (see CkFftCorrelatorInit()).
+
+struct _CkFftCorrelator
+{
+    CkFftContext* context;
+    CkFftSize size;     // FFT size
+    CkFftWeighting weighting;
+    float smoothing;
+
+    // smoothed power spectra of x and y (for kCkFftWeighting_Scot), size/2+1 values each
+    float* powerX;
+    float* powerY;
+    bool first;  // no frames since reset; the power spectra are set, not smoothed
+
+    // spectra of x and y, size/2+1 values each
+    CkFftComplex* spectrumX;
+    CkFftComplex* spectrumY;
+
+    void* allocBuf; // memory allocated by us (NULL if the user's buffer was used)
+    ckfft::Allocator allocator; // allocator for allocBuf
+
+    // correlation of count samples of x and y, zero-padded to size
+    void process(const float* x, const float* y, CkFftSize count, float* output);
+
+    // correlation of the spectra of x and y
+    void processSpectra(const CkFftComplex* x, const CkFftComplex* y, float* output);
+
+    // Find the largest value of the correlation for lags from -maxLag to maxLag, 
+    // with parabolic interpolation.
+    void findPeak(const float* correlation, CkFftSize maxLag, float* lag, float* value) const;
+
+    void reset();
+
+    static _CkFftCorrelator* create(CkFftContext* context, CkFftSize size, CkFftWeighting weighting, float smoothing, void* buf, size_t* bufSize);
+    static void destroy(_CkFftCorrelator*);
+
+private:
+    _CkFftCorrelator();
+};
+
+
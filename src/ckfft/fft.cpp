@@ -5,6 +5,7 @@
 #include "ckfft/fft_default.h"
 #include "ckfft/math_util.h"
 #include "ckfft/context.h"
+#include "ckfft/convert.h"
 
 
 namespace ckfft
@@ -13,37 +14,201 @@ namespace ckfft
 void fft(CkFftContext* context, 
          const CkFftComplex* input, 
          CkFftComplex* output, 
-         int count,
+         CkFftSize count,
          bool inverse)
 {
     // handle trivial cases here, so we don't have to check for them in fft_default
+    float scale = context->getScale(count, inverse);
     if (count == 1)
     {
-        *output = *input;
+        multiply(*input, scale, *output);
     }
     else if (count == 2)
     {
         // radix-2 
         // output[0] = input[0] + input[stride];
         // output[1] = input[0] - input[stride];
-        add(input[0], input[1], output[0]);
-        subtract(input[0], input[1], output[1]);
+        CkFftComplex in0, in1;
+        multiply(input[0], scale, in0);
+        multiply(input[1], scale, in1);
+        add(in0, in1, output[0]);
+        subtract(in0, in1, output[1]);
     }
     else
     {
         const CkFftComplex* expTable = (inverse ? context->invExpTable : context->fwdExpTable);
-        int expTableStride = context->maxCount / count;
+        CkFftSize expTableStride = context->maxCount / count;
 
         if (context->neon)
         {
-            fft_neon(context, input, output, count, inverse, 1, expTable, expTableStride);
+            fft_neon(context, input, output, count, inverse, 1, expTable, expTableStride, scale);
         }
         else
         {
-            fft_default(context, input, output, count, inverse, 1, expTable, expTableStride);
+            fft_default(context, input, output, count, inverse, 1, expTable, expTableStride, scale);
         }
     }
 }
 
+void fft_inplace(CkFftContext* context, 
+         CkFftComplex* data, 
+         CkFftSize count,
+         bool inverse)
+{
+    // handle trivial cases here, so we don't have to check for them in fft_inplace_default
+    float scale = context->getScale(count, inverse);
+    if (count == 1)
+    {
+        multiply(*data, scale, *data);
+    }
+    else if (count == 2)
+    {
+        // radix-2 
+        CkFftComplex in0, in1;
+        multiply(data[0], scale, in0);
+        multiply(data[1], scale, in1);
+        add(in0, in1, data[0]);
+        subtract(in0, in1, data[1]);
+    }
+    else
+    {
+        const CkFftComplex* expTable = (inverse ? context->invExpTable : context->fwdExpTable);
+        CkFftSize expTableStride = context->maxCount / count;
+
+        if (context->neon)
+        {
+            fft_inplace_neon(context, data, count, inverse, expTable, expTableStride, scale);
+        }
+        else
+        {
+            fft_inplace_default(context, data, count, inverse, expTable, expTableStride, scale);
+        }
+    }
+}
+
+void fft_dif(CkFftContext* context, 
+         const CkFftComplex* input, 
+         CkFftComplex* output, 
+         CkFftSize count,
+         bool inverse)
+{
+    // handle trivial cases here (bit-reversed order is the same as natural order)
+    float scale = context->getScale(count, inverse);
+    if (count == 1)
+    {
+        multiply(*input, scale, *output);
+    }
+    else if (count == 2)
+    {
+        CkFftComplex in0, in1;
+        multiply(input[0], scale, in0);
+        multiply(input[1], scale, in1);
+        add(in0, in1, output[0]);
+        subtract(in0, in1, output[1]);
+    }
+    else
+    {
+        const CkFftComplex* expTable = (inverse ? context->invExpTable : context->fwdExpTable);
+        CkFftSize expTableStride = context->maxCount / count;
+
+        if (context->neon)
+        {
+            fft_dif_neon(context, input, output, count, inverse, expTable, expTableStride, scale);
+        }
+        else
+        {
+            fft_dif_default(context, input, output, count, inverse, expTable, expTableStride, scale);
+        }
+    }
+}
+
+void fft_dit(CkFftContext* context, 
+         const CkFftComplex* input, 
+         CkFftComplex* output, 
+         CkFftSize count,
+         bool inverse)
+{
+    // handle trivial cases here (bit-reversed order is the same as natural order)
+    float scale = context->getScale(count, inverse);
+    if (count == 1)
+    {
+        multiply(*input, scale, *output);
+    }
+    else if (count == 2)
+    {
+        CkFftComplex in0, in1;
+        multiply(input[0], scale, in0);
+        multiply(input[1], scale, in1);
+        add(in0, in1, output[0]);
+        subtract(in0, in1, output[1]);
+    }
+    else
+    {
+        const CkFftComplex* expTable = (inverse ? context->invExpTable : context->fwdExpTable);
+        CkFftSize expTableStride = context->maxCount / count;
+
+        if (context->neon)
+        {
+            fft_dit_neon(context, input, output, count, inverse, expTable, expTableStride, scale);
+        }
+        else
+        {
+            fft_dit_default(context, input, output, count, inverse, expTable, expTableStride, scale);
+        }
+    }
+}
+
+namespace
+{
+
+// The steps of a decimation-in-time FFT after the first, which has produced 
+// sub-DFTs of size n in data (see convert_int16()), without scaling.
+void ditSteps(CkFftContext* context, 
+         CkFftComplex* data, 
+         CkFftSize count,
+         CkFftSize n,
+         bool inverse)
+{
+    const CkFftComplex* expTable = (inverse ? context->invExpTable : context->fwdExpTable);
+    CkFftSize expTableStride = context->maxCount / count;
+    if (context->neon)
+    {
+        fft_dit_steps_neon(context, data, count, n, inverse, expTable, expTableStride, 1.0f);
+    }
+    else
+    {
+        fft_dit_steps_default(context, data, count, n, inverse, expTable, expTableStride, 1.0f);
+    }
+}
+
+}
+
+void fft_int16(CkFftContext* context, 
+         const short* input, 
+         float inputScale,
+         CkFftComplex* output, 
+         CkFftSize count,
+         bool inverse)
+{
+    // the first step of the FFT reads and converts the input, in place of the 
+    // bit-reversal step of an in-place FFT; the FFT's scale is applied with the 
+    // input scale
+    float scale = inputScale * context->getScale(count, inverse);
+    CkFftSize n = convert_int16(input, scale, output, count, inverse);
+    ditSteps(context, output, count, n, inverse);
+}
+
+void fft_int8(CkFftContext* context, 
+         const signed char* input, 
+         float inputScale,
+         CkFftComplex* output, 
+         CkFftSize count,
+         bool inverse)
+{
+    float scale = inputScale * context->getScale(count, inverse);
+    CkFftSize n = convert_int8(input, scale, output, count, inverse);
+    ditSteps(context, output, count, n, inverse);
+}
+
 } // namespace ckfft
 
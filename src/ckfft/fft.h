@@ -9,7 +9,47 @@ void fft(
         CkFftContext* context, 
         const CkFftComplex* input, 
         CkFftComplex* output, 
-        int count, 
+        CkFftSize count, 
+        bool inverse);
+
+void fft_inplace(
+        CkFftContext* context, 
+        CkFftComplex* data, 
+        CkFftSize count, 
+        bool inverse);
+
+// Decimation-in-frequency FFT; output is in bit-reversed order.
+void fft_dif(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        CkFftComplex* output, 
+        CkFftSize count, 
+        bool inverse);
+
+// Decimation-in-time FFT; input is in bit-reversed order.
+void fft_dit(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        CkFftComplex* output, 
+        CkFftSize count, 
+        bool inverse);
+
+// FFTs of complex values stored as interleaved pairs of 16-bit or 8-bit integers,
+// multiplied by inputScale.
+void fft_int16(
+        CkFftContext* context, 
+        const short* input, 
+        float inputScale,
+        CkFftComplex* output, 
+        CkFftSize count, 
+        bool inverse);
+
+void fft_int8(
+        CkFftContext* context, 
+        const signed char* input, 
+        float inputScale,
+        CkFftComplex* output, 
+        CkFftSize count, 
         bool inverse);
 
 }
@@ -0,0 +1,4987 @@
+// Generated by etc/codelets/gen_codelets.py; do not edit.
+
+#include "ckfft/platform.h"
+#include "ckfft/fft_codelets_default.h"
+
+namespace ckfft
+{
+
+namespace
+{
+
+// 52 additions, 4 multiplications
+void codelet_8_fwd(const CkFftComplex* input, CkFftComplex* output, CkFftSize stride)
+{
+    const CkFftComplex* in0 = input + 0*stride;
+    const float x0r = in0->real;
+    const CkFftComplex* in4 = input + 4*stride;
+    const float x4r = in4->real;
+    const float t17 = x0r + x4r;
+    const CkFftComplex* in2 = input + 2*stride;
+    const float x2r = in2->real;
+    const CkFftComplex* in6 = input + 6*stride;
+    const float x6r = in6->real;
+    const float t21 = x2r + x6r;
+    const float t25 = t17 + t21;
+    const CkFftComplex* in1 = input + 1*stride;
+    const float x1r = in1->real;
+    const CkFftComplex* in5 = input + 5*stride;
+    const float x5r = in5->real;
+    const float t34 = x1r + x5r;
+    const CkFftComplex* in3 = input + 3*stride;
+    const float x3r = in3->real;
+    const CkFftComplex* in7 = input + 7*stride;
+    const float x7r = in7->real;
+    const float t38 = x3r + x7r;
+    const float t42 = t34 + t38;
+    const float t46 = t25 + t42;
+    const float x0i = in0->imag;
+    const float x4i = in4->imag;
+    const float t18 = x0i + x4i;
+    const float x2i = in2->imag;
+    const float x6i = in6->imag;
+    const float t22 = x2i + x6i;
+    const float t26 = t18 + t22;
+    const float x1i = in1->imag;
+    const float x5i = in5->imag;
+    const float t35 = x1i + x5i;
+    const float x3i = in3->imag;
+    const float x7i = in7->imag;
+    const float t39 = x3i + x7i;
+    const float t43 = t35 + t39;
+    const float t47 = t26 + t43;
+    const float t19 = x0r - x4r;
+    const float t24 = x2i - x6i;
+    const float t30 = t19 + t24;
+    const float t36 = x1r - x5r;
+    const float t37 = x1i - x5i;
+    const float t55 = t36 + t37;
+    const float t57 = 0.707106781f * t55;
+    const float t40 = x3r - x7r;
+    const float t41 = x3i - x7i;
+    const float t62 = t40 - t41;
+    const float t63 = 0.707106781f * t62;
+    const float t68 = t57 - t63;
+    const float t74 = t30 + t68;
+    const float t20 = x0i - x4i;
+    const float t23 = x2r - x6r;
+    const float t31 = t20 - t23;
+    const float t58 = t36 - t37;
+    const float t60 = 0.707106781f * t58;
+    const float t65 = t40 + t41;
+    const float t66 = 0.707106781f * t65;
+    const float t69 = t60 + t66;
+    const float t75 = t31 - t69;
+    const float t27 = t17 - t21;
+    const float t45 = t35 - t39;
+    const float t51 = t27 + t45;
+    const float t28 = t18 - t22;
+    const float t44 = t34 - t38;
+    const float t52 = t28 - t44;
+    const float t32 = t19 - t24;
+    const float t72 = t60 - t66;
+    const float t79 = t32 - t72;
+    const float t33 = t20 + t23;
+    const float t71 = t57 + t63;
+    const float t80 = t33 - t71;
+    const float t48 = t25 - t42;
+    const float t49 = t26 - t43;
+    const float t76 = t30 - t68;
+    const float t77 = t31 + t69;
+    const float t53 = t27 - t45;
+    const float t54 = t28 + t44;
+    const float t81 = t32 + t72;
+    const float t82 = t33 + t71;
+    output[0].real = t46;
+    output[0].imag = t47;
+    output[1].real = t74;
+    output[1].imag = t75;
+    output[2].real = t51;
+    output[2].imag = t52;
+    output[3].real = t79;
+    output[3].imag = t80;
+    output[4].real = t48;
+    output[4].imag = t49;
+    output[5].real = t76;
+    output[5].imag = t77;
+    output[6].real = t53;
+    output[6].imag = t54;
+    output[7].real = t81;
+    output[7].imag = t82;
+}
+
+// 52 additions, 4 multiplications
+void codelet_8_inv(const CkFftComplex* input, CkFftComplex* output, CkFftSize stride)
+{
+    const CkFftComplex* in0 = input + 0*stride;
+    const float x0r = in0->real;
+    const CkFftComplex* in4 = input + 4*stride;
+    const float x4r = in4->real;
+    const float t17 = x0r + x4r;
+    const CkFftComplex* in2 = input + 2*stride;
+    const float x2r = in2->real;
+    const CkFftComplex* in6 = input + 6*stride;
+    const float x6r = in6->real;
+    const float t21 = x2r + x6r;
+    const float t25 = t17 + t21;
+    const CkFftComplex* in1 = input + 1*stride;
+    const float x1r = in1->real;
+    const CkFftComplex* in5 = input + 5*stride;
+    const float x5r = in5->real;
+    const float t34 = x1r + x5r;
+    const CkFftComplex* in3 = input + 3*stride;
+    const float x3r = in3->real;
+    const CkFftComplex* in7 = input + 7*stride;
+    const float x7r = in7->real;
+    const float t38 = x3r + x7r;
+    const float t42 = t34 + t38;
+    const float t46 = t25 + t42;
+    const float x0i = in0->imag;
+    const float x4i = in4->imag;
+    const float t18 = x0i + x4i;
+    const float x2i = in2->imag;
+    const float x6i = in6->imag;
+    const float t22 = x2i + x6i;
+    const float t26 = t18 + t22;
+    const float x1i = in1->imag;
+    const float x5i = in5->imag;
+    const float t35 = x1i + x5i;
+    const float x3i = in3->imag;
+    const float x7i = in7->imag;
+    const float t39 = x3i + x7i;
+    const float t43 = t35 + t39;
+    const float t47 = t26 + t43;
+    const float t19 = x0r - x4r;
+    const float t24 = x2i - x6i;
+    const float t30 = t19 - t24;
+    const float t36 = x1r - x5r;
+    const float t37 = x1i - x5i;
+    const float t55 = t36 - t37;
+    const float t57 = 0.707106781f * t55;
+    const float t40 = x3r - x7r;
+    const float t41 = x3i - x7i;
+    const float t60 = t40 + t41;
+    const float t61 = 0.707106781f * t60;
+    const float t67 = t57 - t61;
+    const float t71 = t30 + t67;
+    const float t20 = x0i - x4i;
+    const float t23 = x2r - x6r;
+    const float t31 = t20 + t23;
+    const float t58 = t36 + t37;
+    const float t59 = 0.707106781f * t58;
+    const float t63 = t40 - t41;
+    const float t65 = 0.707106781f * t63;
+    const float t68 = t59 + t65;
+    const float t72 = t31 + t68;
+    const float t27 = t17 - t21;
+    const float t45 = t35 - t39;
+    const float t51 = t27 - t45;
+    const float t28 = t18 - t22;
+    const float t44 = t34 - t38;
+    const float t52 = t28 + t44;
+    const float t32 = t19 + t24;
+    const float t70 = t59 - t65;
+    const float t76 = t32 - t70;
+    const float t33 = t20 - t23;
+    const float t69 = t57 + t61;
+    const float t77 = t33 + t69;
+    const float t48 = t25 - t42;
+    const float t49 = t26 - t43;
+    const float t73 = t30 - t67;
+    const float t74 = t31 - t68;
+    const float t53 = t27 + t45;
+    const float t54 = t28 - t44;
+    const float t78 = t32 + t70;
+    const float t79 = t33 - t69;
+    output[0].real = t46;
+    output[0].imag = t47;
+    output[1].real = t71;
+    output[1].imag = t72;
+    output[2].real = t51;
+    output[2].imag = t52;
+    output[3].real = t76;
+    output[3].imag = t77;
+    output[4].real = t48;
+    output[4].imag = t49;
+    output[5].real = t73;
+    output[5].imag = t74;
+    output[6].real = t53;
+    output[6].imag = t54;
+    output[7].real = t78;
+    output[7].imag = t79;
+}
+
+// 144 additions, 24 multiplications
+void codelet_16_fwd(const CkFftComplex* input, CkFftComplex* output, CkFftSize stride)
+{
+    const CkFftComplex* in0 = input + 0*stride;
+    const float x0r = in0->real;
+    const CkFftComplex* in8 = input + 8*stride;
+    const float x8r = in8->real;
+    const float t33 = x0r + x8r;
+    const CkFftComplex* in4 = input + 4*stride;
+    const float x4r = in4->real;
+    const CkFftComplex* in12 = input + 12*stride;
+    const float x12r = in12->real;
+    const float t37 = x4r + x12r;
+    const float t41 = t33 + t37;
+    const CkFftComplex* in2 = input + 2*stride;
+    const float x2r = in2->real;
+    const CkFftComplex* in10 = input + 10*stride;
+    const float x10r = in10->real;
+    const float t50 = x2r + x10r;
+    const CkFftComplex* in6 = input + 6*stride;
+    const float x6r = in6->real;
+    const CkFftComplex* in14 = input + 14*stride;
+    const float x14r = in14->real;
+    const float t54 = x6r + x14r;
+    const float t58 = t50 + t54;
+    const float t62 = t41 + t58;
+    const CkFftComplex* in1 = input + 1*stride;
+    const float x1r = in1->real;
+    const CkFftComplex* in9 = input + 9*stride;
+    const float x9r = in9->real;
+    const float t99 = x1r + x9r;
+    const CkFftComplex* in5 = input + 5*stride;
+    const float x5r = in5->real;
+    const CkFftComplex* in13 = input + 13*stride;
+    const float x13r = in13->real;
+    const float t103 = x5r + x13r;
+    const float t107 = t99 + t103;
+    const CkFftComplex* in3 = input + 3*stride;
+    const float x3r = in3->real;
+    const CkFftComplex* in11 = input + 11*stride;
+    const float x11r = in11->real;
+    const float t116 = x3r + x11r;
+    const CkFftComplex* in7 = input + 7*stride;
+    const float x7r = in7->real;
+    const CkFftComplex* in15 = input + 15*stride;
+    const float x15r = in15->real;
+    const float t120 = x7r + x15r;
+    const float t124 = t116 + t120;
+    const float t133 = t107 + t124;
+    const float t137 = t62 + t133;
+    const float x0i = in0->imag;
+    const float x8i = in8->imag;
+    const float t34 = x0i + x8i;
+    const float x4i = in4->imag;
+    const float x12i = in12->imag;
+    const float t38 = x4i + x12i;
+    const float t42 = t34 + t38;
+    const float x2i = in2->imag;
+    const float x10i = in10->imag;
+    const float t51 = x2i + x10i;
+    const float x6i = in6->imag;
+    const float x14i = in14->imag;
+    const float t55 = x6i + x14i;
+    const float t59 = t51 + t55;
+    const float t63 = t42 + t59;
+    const float x1i = in1->imag;
+    const float x9i = in9->imag;
+    const float t100 = x1i + x9i;
+    const float x5i = in5->imag;
+    const float x13i = in13->imag;
+    const float t104 = x5i + x13i;
+    const float t108 = t100 + t104;
+    const float x3i = in3->imag;
+    const float x11i = in11->imag;
+    const float t117 = x3i + x11i;
+    const float x7i = in7->imag;
+    const float x15i = in15->imag;
+    const float t121 = x7i + x15i;
+    const float t125 = t117 + t121;
+    const float t134 = t108 + t125;
+    const float t138 = t63 + t134;
+    const float t35 = x0r - x8r;
+    const float t40 = x4i - x12i;
+    const float t46 = t35 + t40;
+    const float t52 = x2r - x10r;
+    const float t53 = x2i - x10i;
+    const float t71 = t52 + t53;
+    const float t73 = 0.707106781f * t71;
+    const float t56 = x6r - x14r;
+    const float t57 = x6i - x14i;
+    const float t78 = t56 - t57;
+    const float t79 = 0.707106781f * t78;
+    const float t84 = t73 - t79;
+    const float t90 = t46 + t84;
+    const float t101 = x1r - x9r;
+    const float t106 = x5i - x13i;
+    const float t112 = t101 + t106;
+    const float t147 = 0.923879533f * t112;
+    const float t102 = x1i - x9i;
+    const float t105 = x5r - x13r;
+    const float t113 = t102 - t105;
+    const float t149 = 0.382683432f * t113;
+    const float t151 = t147 + t149;
+    const float t118 = x3r - x11r;
+    const float t123 = x7i - x15i;
+    const float t129 = t118 + t123;
+    const float t158 = 0.382683432f * t129;
+    const float t119 = x3i - x11i;
+    const float t122 = x7r - x15r;
+    const float t130 = t119 - t122;
+    const float t159 = 0.923879533f * t130;
+    const float t161 = t158 + t159;
+    const float t167 = t151 + t161;
+    const float t173 = t90 + t167;
+    const float t36 = x0i - x8i;
+    const float t39 = x4r - x12r;
+    const float t47 = t36 - t39;
+    const float t74 = t52 - t53;
+    const float t76 = 0.707106781f * t74;
+    const float t81 = t56 + t57;
+    const float t82 = 0.707106781f * t81;
+    const float t85 = t76 + t82;
+    const float t91 = t47 - t85;
+    const float t152 = 0.382683432f * t112;
+    const float t154 = 0.923879533f * t113;
+    const float t155 = t152 - t154;
+    const float t162 = 0.923879533f * t129;
+    const float t164 = 0.382683432f * t130;
+    const float t165 = t162 - t164;
+    const float t168 = t155 + t165;
+    const float t174 = t91 - t168;
+    const float t43 = t33 - t37;
+    const float t61 = t51 - t55;
+    const float t67 = t43 + t61;
+    const float t109 = t99 - t103;
+    const float t110 = t100 - t104;
+    const float t182 = t109 + t110;
+    const float t183 = 0.707106781f * t182;
+    const float t126 = t116 - t120;
+    const float t127 = t117 - t121;
+    const float t188 = t126 - t127;
+    const float t189 = 0.707106781f * t188;
+    const float t194 = t183 - t189;
+    const float t200 = t67 + t194;
+    const float t44 = t34 - t38;
+    const float t60 = t50 - t54;
+    const float t68 = t44 - t60;
+    const float t184 = t109 - t110;
+    const float t186 = 0.707106781f * t184;
+    const float t191 = t126 + t127;
+    const float t192 = 0.707106781f * t191;
+    const float t195 = t186 + t192;
+    const float t201 = t68 - t195;
+    const float t48 = t35 - t40;
+    const float t88 = t76 - t82;
+    const float t95 = t48 - t88;
+    const float t114 = t101 - t106;
+    const float t209 = 0.382683432f * t114;
+    const float t115 = t102 + t105;
+    const float t210 = 0.923879533f * t115;
+    const float t212 = t209 + t210;
+    const float t131 = t118 - t123;
+    const float t219 = 0.923879533f * t131;
+    const float t132 = t119 + t122;
+    const float t222 = 0.382683432f * t132;
+    const float t223 = t219 + t222;
+    const float t229 = t212 - t223;
+    const float t235 = t95 + t229;
+    const float t49 = t36 + t39;
+    const float t87 = t73 + t79;
+    const float t96 = t49 - t87;
+    const float t213 = 0.923879533f * t114;
+    const float t215 = 0.382683432f * t115;
+    const float t216 = t213 - t215;
+    const float t225 = 0.382683432f * t131;
+    const float t226 = 0.923879533f * t132;
+    const float t228 = t225 - t226;
+    const float t230 = t216 - t228;
+    const float t236 = t96 - t230;
+    const float t64 = t41 - t58;
+    const float t136 = t108 - t125;
+    const float t142 = t64 + t136;
+    const float t65 = t42 - t59;
+    const float t135 = t107 - t124;
+    const float t143 = t65 - t135;
+    const float t92 = t46 - t84;
+    const float t171 = t155 - t165;
+    const float t178 = t92 - t171;
+    const float t93 = t47 + t85;
+    const float t170 = t151 - t161;
+    const float t179 = t93 - t170;
+    const float t69 = t43 - t61;
+    const float t198 = t186 - t192;
+    const float t205 = t69 - t198;
+    const float t70 = t44 + t60;
+    const float t197 = t183 + t189;
+    const float t206 = t70 - t197;
+    const float t97 = t48 + t88;
+    const float t233 = t216 + t228;
+    const float t240 = t97 - t233;
+    const float t98 = t49 + t87;
+    const float t232 = t212 + t223;
+    const float t241 = t98 - t232;
+    const float t139 = t62 - t133;
+    const float t140 = t63 - t134;
+    const float t175 = t90 - t167;
+    const float t176 = t91 + t168;
+    const float t202 = t67 - t194;
+    const float t203 = t68 + t195;
+    const float t237 = t95 - t229;
+    const float t238 = t96 + t230;
+    const float t144 = t64 - t136;
+    const float t145 = t65 + t135;
+    const float t180 = t92 + t171;
+    const float t181 = t93 + t170;
+    const float t207 = t69 + t198;
+    const float t208 = t70 + t197;
+    const float t242 = t97 + t233;
+    const float t243 = t98 + t232;
+    output[0].real = t137;
+    output[0].imag = t138;
+    output[1].real = t173;
+    output[1].imag = t174;
+    output[2].real = t200;
+    output[2].imag = t201;
+    output[3].real = t235;
+    output[3].imag = t236;
+    output[4].real = t142;
+    output[4].imag = t143;
+    output[5].real = t178;
+    output[5].imag = t179;
+    output[6].real = t205;
+    output[6].imag = t206;
+    output[7].real = t240;
+    output[7].imag = t241;
+    output[8].real = t139;
+    output[8].imag = t140;
+    output[9].real = t175;
+    output[9].imag = t176;
+    output[10].real = t202;
+    output[10].imag = t203;
+    output[11].real = t237;
+    output[11].imag = t238;
+    output[12].real = t144;
+    output[12].imag = t145;
+    output[13].real = t180;
+    output[13].imag = t181;
+    output[14].real = t207;
+    output[14].imag = t208;
+    output[15].real = t242;
+    output[15].imag = t243;
+}
+
+// 144 additions, 24 multiplications
+void codelet_16_inv(const CkFftComplex* input, CkFftComplex* output, CkFftSize stride)
+{
+    const CkFftComplex* in0 = input + 0*stride;
+    const float x0r = in0->real;
+    const CkFftComplex* in8 = input + 8*stride;
+    const float x8r = in8->real;
+    const float t33 = x0r + x8r;
+    const CkFftComplex* in4 = input + 4*stride;
+    const float x4r = in4->real;
+    const CkFftComplex* in12 = input + 12*stride;
+    const float x12r = in12->real;
+    const float t37 = x4r + x12r;
+    const float t41 = t33 + t37;
+    const CkFftComplex* in2 = input + 2*stride;
+    const float x2r = in2->real;
+    const CkFftComplex* in10 = input + 10*stride;
+    const float x10r = in10->real;
+    const float t50 = x2r + x10r;
+    const CkFftComplex* in6 = input + 6*stride;
+    const float x6r = in6->real;
+    const CkFftComplex* in14 = input + 14*stride;
+    const float x14r = in14->real;
+    const float t54 = x6r + x14r;
+    const float t58 = t50 + t54;
+    const float t62 = t41 + t58;
+    const CkFftComplex* in1 = input + 1*stride;
+    const float x1r = in1->real;
+    const CkFftComplex* in9 = input + 9*stride;
+    const float x9r = in9->real;
+    const float t96 = x1r + x9r;
+    const CkFftComplex* in5 = input + 5*stride;
+    const float x5r = in5->real;
+    const CkFftComplex* in13 = input + 13*stride;
+    const float x13r = in13->real;
+    const float t100 = x5r + x13r;
+    const float t104 = t96 + t100;
+    const CkFftComplex* in3 = input + 3*stride;
+    const float x3r = in3->real;
+    const CkFftComplex* in11 = input + 11*stride;
+    const float x11r = in11->real;
+    const float t113 = x3r + x11r;
+    const CkFftComplex* in7 = input + 7*stride;
+    const float x7r = in7->real;
+    const CkFftComplex* in15 = input + 15*stride;
+    const float x15r = in15->real;
+    const float t117 = x7r + x15r;
+    const float t121 = t113 + t117;
+    const float t130 = t104 + t121;
+    const float t134 = t62 + t130;
+    const float x0i = in0->imag;
+    const float x8i = in8->imag;
+    const float t34 = x0i + x8i;
+    const float x4i = in4->imag;
+    const float x12i = in12->imag;
+    const float t38 = x4i + x12i;
+    const float t42 = t34 + t38;
+    const float x2i = in2->imag;
+    const float x10i = in10->imag;
+    const float t51 = x2i + x10i;
+    const float x6i = in6->imag;
+    const float x14i = in14->imag;
+    const float t55 = x6i + x14i;
+    const float t59 = t51 + t55;
+    const float t63 = t42 + t59;
+    const float x1i = in1->imag;
+    const float x9i = in9->imag;
+    const float t97 = x1i + x9i;
+    const float x5i = in5->imag;
+    const float x13i = in13->imag;
+    const float t101 = x5i + x13i;
+    const float t105 = t97 + t101;
+    const float x3i = in3->imag;
+    const float x11i = in11->imag;
+    const float t114 = x3i + x11i;
+    const float x7i = in7->imag;
+    const float x15i = in15->imag;
+    const float t118 = x7i + x15i;
+    const float t122 = t114 + t118;
+    const float t131 = t105 + t122;
+    const float t135 = t63 + t131;
+    const float t35 = x0r - x8r;
+    const float t40 = x4i - x12i;
+    const float t46 = t35 - t40;
+    const float t52 = x2r - x10r;
+    const float t53 = x2i - x10i;
+    const float t71 = t52 - t53;
+    const float t73 = 0.707106781f * t71;
+    const float t56 = x6r - x14r;
+    const float t57 = x6i - x14i;
+    const float t76 = t56 + t57;
+    const float t77 = 0.707106781f * t76;
+    const float t83 = t73 - t77;
+    const float t87 = t46 + t83;
+    const float t98 = x1r - x9r;
+    const float t103 = x5i - x13i;
+    const float t109 = t98 - t103;
+    const float t144 = 0.923879533f * t109;
+    const float t99 = x1i - x9i;
+    const float t102 = x5r - x13r;
+    const float t110 = t99 + t102;
+    const float t146 = 0.382683432f * t110;
+    const float t147 = t144 - t146;
+    const float t115 = x3r - x11r;
+    const float t120 = x7i - x15i;
+    const float t126 = t115 - t120;
+    const float t152 = 0.382683432f * t126;
+    const float t116 = x3i - x11i;
+    const float t119 = x7r - x15r;
+    const float t127 = t116 + t119;
+    const float t153 = 0.923879533f * t127;
+    const float t154 = t152 - t153;
+    const float t158 = t147 + t154;
+    const float t162 = t87 + t158;
+    const float t36 = x0i - x8i;
+    const float t39 = x4r - x12r;
+    const float t47 = t36 + t39;
+    const float t74 = t52 + t53;
+    const float t75 = 0.707106781f * t74;
+    const float t79 = t56 - t57;
+    const float t81 = 0.707106781f * t79;
+    const float t84 = t75 + t81;
+    const float t88 = t47 + t84;
+    const float t148 = 0.382683432f * t109;
+    const float t149 = 0.923879533f * t110;
+    const float t150 = t148 + t149;
+    const float t155 = 0.923879533f * t126;
+    const float t156 = 0.382683432f * t127;
+    const float t157 = t155 + t156;
+    const float t159 = t150 + t157;
+    const float t163 = t88 + t159;
+    const float t43 = t33 - t37;
+    const float t61 = t51 - t55;
+    const float t67 = t43 - t61;
+    const float t106 = t96 - t100;
+    const float t107 = t97 - t101;
+    const float t171 = t106 - t107;
+    const float t172 = 0.707106781f * t171;
+    const float t123 = t113 - t117;
+    const float t124 = t114 - t118;
+    const float t175 = t123 + t124;
+    const float t176 = 0.707106781f * t175;
+    const float t182 = t172 - t176;
+    const float t186 = t67 + t182;
+    const float t44 = t34 - t38;
+    const float t60 = t50 - t54;
+    const float t68 = t44 + t60;
+    const float t173 = t106 + t107;
+    const float t174 = 0.707106781f * t173;
+    const float t178 = t123 - t124;
+    const float t180 = 0.707106781f * t178;
+    const float t183 = t174 + t180;
+    const float t187 = t68 + t183;
+    const float t48 = t35 + t40;
+    const float t86 = t75 - t81;
+    const float t92 = t48 - t86;
+    const float t111 = t98 + t103;
+    const float t195 = 0.382683432f * t111;
+    const float t112 = t99 - t102;
+    const float t196 = 0.923879533f * t112;
+    const float t197 = t195 - t196;
+    const float t128 = t115 + t120;
+    const float t202 = 0.923879533f * t128;
+    const float t129 = t116 - t119;
+    const float t205 = 0.382683432f * t129;
+    const float t207 = t202 - t205;
+    const float t215 = t197 - t207;
+    const float t219 = t92 + t215;
+    const float t49 = t36 - t39;
+    const float t85 = t73 + t77;
+    const float t93 = t49 + t85;
+    const float t198 = 0.923879533f * t111;
+    const float t199 = 0.382683432f * t112;
+    const float t200 = t198 + t199;
+    const float t209 = 0.382683432f * t128;
+    const float t211 = 0.923879533f * t129;
+    const float t213 = t209 + t211;
+    const float t216 = t200 - t213;
+    const float t220 = t93 + t216;
+    const float t64 = t41 - t58;
+    const float t133 = t105 - t122;
+    const float t139 = t64 - t133;
+    const float t65 = t42 - t59;
+    const float t132 = t104 - t121;
+    const float t140 = t65 + t132;
+    const float t89 = t46 - t83;
+    const float t161 = t150 - t157;
+    const float t167 = t89 - t161;
+    const float t90 = t47 - t84;
+    const float t160 = t147 - t154;
+    const float t168 = t90 + t160;
+    const float t69 = t43 + t61;
+    const float t185 = t174 - t180;
+    const float t191 = t69 - t185;
+    const float t70 = t44 - t60;
+    const float t184 = t172 + t176;
+    const float t192 = t70 + t184;
+    const float t94 = t48 + t86;
+    const float t218 = t200 + t213;
+    const float t224 = t94 - t218;
+    const float t95 = t49 - t85;
+    const float t217 = t197 + t207;
+    const float t225 = t95 + t217;
+    const float t136 = t62 - t130;
+    const float t137 = t63 - t131;
+    const float t164 = t87 - t158;
+    const float t165 = t88 - t159;
+    const float t188 = t67 - t182;
+    const float t189 = t68 - t183;
+    const float t221 = t92 - t215;
+    const float t222 = t93 - t216;
+    const float t141 = t64 + t133;
+    const float t142 = t65 - t132;
+    const float t169 = t89 + t161;
+    const float t170 = t90 - t160;
+    const float t193 = t69 + t185;
+    const float t194 = t70 - t184;
+    const float t226 = t94 + t218;
+    const float t227 = t95 - t217;
+    output[0].real = t134;
+    output[0].imag = t135;
+    output[1].real = t162;
+    output[1].imag = t163;
+    output[2].real = t186;
+    output[2].imag = t187;
+    output[3].real = t219;
+    output[3].imag = t220;
+    output[4].real = t139;
+    output[4].imag = t140;
+    output[5].real = t167;
+    output[5].imag = t168;
+    output[6].real = t191;
+    output[6].imag = t192;
+    output[7].real = t224;
+    output[7].imag = t225;
+    output[8].real = t136;
+    output[8].imag = t137;
+    output[9].real = t164;
+    output[9].imag = t165;
+    output[10].real = t188;
+    output[10].imag = t189;
+    output[11].real = t221;
+    output[11].imag = t222;
+    output[12].real = t141;
+    output[12].imag = t142;
+    output[13].real = t169;
+    output[13].imag = t170;
+    output[14].real = t193;
+    output[14].imag = t194;
+    output[15].real = t226;
+    output[15].imag = t227;
+}
+
+// 372 additions, 84 multiplications
+void codelet_32_fwd(const CkFftComplex* input, CkFftComplex* output, CkFftSize stride)
+{
+    const CkFftComplex* in0 = input + 0*stride;
+    const float x0r = in0->real;
+    const CkFftComplex* in16 = input + 16*stride;
+    const float x16r = in16->real;
+    const float t65 = x0r + x16r;
+    const CkFftComplex* in8 = input + 8*stride;
+    const float x8r = in8->real;
+    const CkFftComplex* in24 = input + 24*stride;
+    const float x24r = in24->real;
+    const float t69 = x8r + x24r;
+    const float t73 = t65 + t69;
+    const CkFftComplex* in4 = input + 4*stride;
+    const float x4r = in4->real;
+    const CkFftComplex* in20 = input + 20*stride;
+    const float x20r = in20->real;
+    const float t82 = x4r + x20r;
+    const CkFftComplex* in12 = input + 12*stride;
+    const float x12r = in12->real;
+    const CkFftComplex* in28 = input + 28*stride;
+    const float x28r = in28->real;
+    const float t86 = x12r + x28r;
+    const float t90 = t82 + t86;
+    const float t94 = t73 + t90;
+    const CkFftComplex* in2 = input + 2*stride;
+    const float x2r = in2->real;
+    const CkFftComplex* in18 = input + 18*stride;
+    const float x18r = in18->real;
+    const float t131 = x2r + x18r;
+    const CkFftComplex* in10 = input + 10*stride;
+    const float x10r = in10->real;
+    const CkFftComplex* in26 = input + 26*stride;
+    const float x26r = in26->real;
+    const float t135 = x10r + x26r;
+    const float t139 = t131 + t135;
+    const CkFftComplex* in6 = input + 6*stride;
+    const float x6r = in6->real;
+    const CkFftComplex* in22 = input + 22*stride;
+    const float x22r = in22->real;
+    const float t148 = x6r + x22r;
+    const CkFftComplex* in14 = input + 14*stride;
+    const float x14r = in14->real;
+    const CkFftComplex* in30 = input + 30*stride;
+    const float x30r = in30->real;
+    const float t152 = x14r + x30r;
+    const float t156 = t148 + t152;
+    const float t165 = t139 + t156;
+    const float t169 = t94 + t165;
+    const CkFftComplex* in1 = input + 1*stride;
+    const float x1r = in1->real;
+    const CkFftComplex* in17 = input + 17*stride;
+    const float x17r = in17->real;
+    const float t276 = x1r + x17r;
+    const CkFftComplex* in9 = input + 9*stride;
+    const float x9r = in9->real;
+    const CkFftComplex* in25 = input + 25*stride;
+    const float x25r = in25->real;
+    const float t280 = x9r + x25r;
+    const float t284 = t276 + t280;
+    const CkFftComplex* in5 = input + 5*stride;
+    const float x5r = in5->real;
+    const CkFftComplex* in21 = input + 21*stride;
+    const float x21r = in21->real;
+    const float t293 = x5r + x21r;
+    const CkFftComplex* in13 = input + 13*stride;
+    const float x13r = in13->real;
+    const CkFftComplex* in29 = input + 29*stride;
+    const float x29r = in29->real;
+    const float t297 = x13r + x29r;
+    const float t301 = t293 + t297;
+    const float t305 = t284 + t301;
+    const CkFftComplex* in3 = input + 3*stride;
+    const float x3r = in3->real;
+    const CkFftComplex* in19 = input + 19*stride;
+    const float x19r = in19->real;
+    const float t341 = x3r + x19r;
+    const CkFftComplex* in11 = input + 11*stride;
+    const float x11r = in11->real;
+    const CkFftComplex* in27 = input + 27*stride;
+    const float x27r = in27->real;
+    const float t345 = x11r + x27r;
+    const float t349 = t341 + t345;
+    const CkFftComplex* in7 = input + 7*stride;
+    const float x7r = in7->real;
+    const CkFftComplex* in23 = input + 23*stride;
+    const float x23r = in23->real;
+    const float t358 = x7r + x23r;
+    const CkFftComplex* in15 = input + 15*stride;
+    const float x15r = in15->real;
+    const CkFftComplex* in31 = input + 31*stride;
+    const float x31r = in31->real;
+    const float t362 = x15r + x31r;
+    const float t366 = t358 + t362;
+    const float t370 = t349 + t366;
+    const float t406 = t305 + t370;
+    const float t410 = t169 + t406;
+    const float x0i = in0->imag;
+    const float x16i = in16->imag;
+    const float t66 = x0i + x16i;
+    const float x8i = in8->imag;
+    const float x24i = in24->imag;
+    const float t70 = x8i + x24i;
+    const float t74 = t66 + t70;
+    const float x4i = in4->imag;
+    const float x20i = in20->imag;
+    const float t83 = x4i + x20i;
+    const float x12i = in12->imag;
+    const float x28i = in28->imag;
+    const float t87 = x12i + x28i;
+    const float t91 = t83 + t87;
+    const float t95 = t74 + t91;
+    const float x2i = in2->imag;
+    const float x18i = in18->imag;
+    const float t132 = x2i + x18i;
+    const float x10i = in10->imag;
+    const float x26i = in26->imag;
+    const float t136 = x10i + x26i;
+    const float t140 = t132 + t136;
+    const float x6i = in6->imag;
+    const float x22i = in22->imag;
+    const float t149 = x6i + x22i;
+    const float x14i = in14->imag;
+    const float x30i = in30->imag;
+    const float t153 = x14i + x30i;
+    const float t157 = t149 + t153;
+    const float t166 = t140 + t157;
+    const float t170 = t95 + t166;
+    const float x1i = in1->imag;
+    const float x17i = in17->imag;
+    const float t277 = x1i + x17i;
+    const float x9i = in9->imag;
+    const float x25i = in25->imag;
+    const float t281 = x9i + x25i;
+    const float t285 = t277 + t281;
+    const float x5i = in5->imag;
+    const float x21i = in21->imag;
+    const float t294 = x5i + x21i;
+    const float x13i = in13->imag;
+    const float x29i = in29->imag;
+    const float t298 = x13i + x29i;
+    const float t302 = t294 + t298;
+    const float t306 = t285 + t302;
+    const float x3i = in3->imag;
+    const float x19i = in19->imag;
+    const float t342 = x3i + x19i;
+    const float x11i = in11->imag;
+    const float x27i = in27->imag;
+    const float t346 = x11i + x27i;
+    const float t350 = t342 + t346;
+    const float x7i = in7->imag;
+    const float x23i = in23->imag;
+    const float t359 = x7i + x23i;
+    const float x15i = in15->imag;
+    const float x31i = in31->imag;
+    const float t363 = x15i + x31i;
+    const float t367 = t359 + t363;
+    const float t371 = t350 + t367;
+    const float t407 = t306 + t371;
+    const float t411 = t170 + t407;
+    const float t67 = x0r - x16r;
+    const float t72 = x8i - x24i;
+    const float t78 = t67 + t72;
+    const float t84 = x4r - x20r;
+    const float t85 = x4i - x20i;
+    const float t103 = t84 + t85;
+    const float t105 = 0.707106781f * t103;
+    const float t88 = x12r - x28r;
+    const float t89 = x12i - x28i;
+    const float t110 = t88 - t89;
+    const float t111 = 0.707106781f * t110;
+    const float t116 = t105 - t111;
+    const float t122 = t78 + t116;
+    const float t133 = x2r - x18r;
+    const float t138 = x10i - x26i;
+    const float t144 = t133 + t138;
+    const float t179 = 0.923879533f * t144;
+    const float t134 = x2i - x18i;
+    const float t137 = x10r - x26r;
+    const float t145 = t134 - t137;
+    const float t181 = 0.382683432f * t145;
+    const float t183 = t179 + t181;
+    const float t150 = x6r - x22r;
+    const float t155 = x14i - x30i;
+    const float t161 = t150 + t155;
+    const float t190 = 0.382683432f * t161;
+    const float t151 = x6i - x22i;
+    const float t154 = x14r - x30r;
+    const float t162 = t151 - t154;
+    const float t191 = 0.923879533f * t162;
+    const float t193 = t190 + t191;
+    const float t199 = t183 + t193;
+    const float t205 = t122 + t199;
+    const float t278 = x1r - x17r;
+    const float t283 = x9i - x25i;
+    const float t289 = t278 + t283;
+    const float t295 = x5r - x21r;
+    const float t296 = x5i - x21i;
+    const float t314 = t295 + t296;
+    const float t315 = 0.707106781f * t314;
+    const float t299 = x13r - x29r;
+    const float t300 = x13i - x29i;
+    const float t320 = t299 - t300;
+    const float t321 = 0.707106781f * t320;
+    const float t326 = t315 - t321;
+    const float t332 = t289 + t326;
+    const float t420 = 0.980785280f * t332;
+    const float t279 = x1i - x17i;
+    const float t282 = x9r - x25r;
+    const float t290 = t279 - t282;
+    const float t316 = t295 - t296;
+    const float t318 = 0.707106781f * t316;
+    const float t323 = t299 + t300;
+    const float t324 = 0.707106781f * t323;
+    const float t327 = t318 + t324;
+    const float t333 = t290 - t327;
+    const float t422 = 0.195090322f * t333;
+    const float t424 = t420 + t422;
+    const float t343 = x3r - x19r;
+    const float t348 = x11i - x27i;
+    const float t354 = t343 + t348;
+    const float t360 = x7r - x23r;
+    const float t361 = x7i - x23i;
+    const float t379 = t360 + t361;
+    const float t380 = 0.707106781f * t379;
+    const float t364 = x15r - x31r;
+    const float t365 = x15i - x31i;
+    const float t385 = t364 - t365;
+    const float t386 = 0.707106781f * t385;
+    const float t391 = t380 - t386;
+    const float t397 = t354 + t391;
+    const float t431 = 0.831469612f * t397;
+    const float t344 = x3i - x19i;
+    const float t347 = x11r - x27r;
+    const float t355 = t344 - t347;
+    const float t381 = t360 - t361;
+    const float t383 = 0.707106781f * t381;
+    const float t388 = t364 + t365;
+    const float t389 = 0.707106781f * t388;
+    const float t392 = t383 + t389;
+    const float t398 = t355 - t392;
+    const float t433 = 0.555570233f * t398;
+    const float t435 = t431 + t433;
+    const float t441 = t424 + t435;
+    const float t447 = t205 + t441;
+    const float t68 = x0i - x16i;
+    const float t71 = x8r - x24r;
+    const float t79 = t68 - t71;
+    const float t106 = t84 - t85;
+    const float t108 = 0.707106781f * t106;
+    const float t113 = t88 + t89;
+    const float t114 = 0.707106781f * t113;
+    const float t117 = t108 + t114;
+    const float t123 = t79 - t117;
+    const float t184 = 0.382683432f * t144;
+    const float t186 = 0.923879533f * t145;
+    const float t187 = t184 - t186;
+    const float t194 = 0.923879533f * t161;
+    const float t196 = 0.382683432f * t162;
+    const float t197 = t194 - t196;
+    const float t200 = t187 + t197;
+    const float t206 = t123 - t200;
+    const float t425 = 0.195090322f * t332;
+    const float t427 = 0.980785280f * t333;
+    const float t428 = t425 - t427;
+    const float t436 = 0.555570233f * t397;
+    const float t438 = 0.831469612f * t398;
+    const float t439 = t436 - t438;
+    const float t442 = t428 + t439;
+    const float t448 = t206 - t442;
+    const float t75 = t65 - t69;
+    const float t93 = t83 - t87;
+    const float t99 = t75 + t93;
+    const float t141 = t131 - t135;
+    const float t142 = t132 - t136;
+    const float t214 = t141 + t142;
+    const float t215 = 0.707106781f * t214;
+    const float t158 = t148 - t152;
+    const float t159 = t149 - t153;
+    const float t220 = t158 - t159;
+    const float t221 = 0.707106781f * t220;
+    const float t226 = t215 - t221;
+    const float t232 = t99 + t226;
+    const float t286 = t276 - t280;
+    const float t304 = t294 - t298;
+    const float t310 = t286 + t304;
+    const float t456 = 0.923879533f * t310;
+    const float t287 = t277 - t281;
+    const float t303 = t293 - t297;
+    const float t311 = t287 - t303;
+    const float t457 = 0.382683432f * t311;
+    const float t459 = t456 + t457;
+    const float t351 = t341 - t345;
+    const float t369 = t359 - t363;
+    const float t375 = t351 + t369;
+    const float t465 = 0.382683432f * t375;
+    const float t352 = t342 - t346;
+    const float t368 = t358 - t362;
+    const float t376 = t352 - t368;
+    const float t466 = 0.923879533f * t376;
+    const float t468 = t465 + t466;
+    const float t474 = t459 + t468;
+    const float t480 = t232 + t474;
+    const float t76 = t66 - t70;
+    const float t92 = t82 - t86;
+    const float t100 = t76 - t92;
+    const float t216 = t141 - t142;
+    const float t218 = 0.707106781f * t216;
+    const float t223 = t158 + t159;
+    const float t224 = 0.707106781f * t223;
+    const float t227 = t218 + t224;
+    const float t233 = t100 - t227;
+    const float t460 = 0.382683432f * t310;
+    const float t462 = 0.923879533f * t311;
+    const float t463 = t460 - t462;
+    const float t469 = 0.923879533f * t375;
+    const float t471 = 0.382683432f * t376;
+    const float t472 = t469 - t471;
+    const float t475 = t463 + t472;
+    const float t481 = t233 - t475;
+    const float t80 = t67 - t72;
+    const float t120 = t108 - t114;
+    const float t127 = t80 - t120;
+    const float t146 = t133 - t138;
+    const float t241 = 0.382683432f * t146;
+    const float t147 = t134 + t137;
+    const float t242 = 0.923879533f * t147;
+    const float t244 = t241 + t242;
+    const float t163 = t150 - t155;
+    const float t251 = 0.923879533f * t163;
+    const float t164 = t151 + t154;
+    const float t254 = 0.382683432f * t164;
+    const float t255 = t251 + t254;
+    const float t261 = t244 - t255;
+    const float t267 = t127 + t261;
+    const float t291 = t278 - t283;
+    const float t330 = t318 - t324;
+    const float t337 = t291 - t330;
+    const float t489 = 0.831469612f * t337;
+    const float t292 = t279 + t282;
+    const float t329 = t315 + t321;
+    const float t338 = t292 - t329;
+    const float t490 = 0.555570233f * t338;
+    const float t492 = t489 + t490;
+    const float t356 = t343 - t348;
+    const float t395 = t383 - t389;
+    const float t402 = t356 - t395;
+    const float t499 = 0.195090322f * t402;
+    const float t357 = t344 + t347;
+    const float t394 = t380 + t386;
+    const float t403 = t357 - t394;
+    const float t501 = 0.980785280f * t403;
+    const float t503 = t499 - t501;
+    const float t511 = t492 - t503;
+    const float t517 = t267 + t511;
+    const float t81 = t68 + t71;
+    const float t119 = t105 + t111;
+    const float t128 = t81 - t119;
+    const float t245 = 0.923879533f * t146;
+    const float t247 = 0.382683432f * t147;
+    const float t248 = t245 - t247;
+    const float t257 = 0.382683432f * t163;
+    const float t258 = 0.923879533f * t164;
+    const float t260 = t257 - t258;
+    const float t262 = t248 - t260;
+    const float t268 = t128 - t262;
+    const float t493 = 0.555570233f * t337;
+    const float t495 = 0.831469612f * t338;
+    const float t496 = t493 - t495;
+    const float t505 = 0.980785280f * t402;
+    const float t507 = 0.195090322f * t403;
+    const float t509 = t505 + t507;
+    const float t512 = t496 + t509;
+    const float t518 = t268 - t512;
+    const float t96 = t73 - t90;
+    const float t168 = t140 - t157;
+    const float t174 = t96 + t168;
+    const float t307 = t284 - t301;
+    const float t308 = t285 - t302;
+    const float t526 = t307 + t308;
+    const float t527 = 0.707106781f * t526;
+    const float t372 = t349 - t366;
+    const float t373 = t350 - t367;
+    const float t532 = t372 - t373;
+    const float t533 = 0.707106781f * t532;
+    const float t538 = t527 - t533;
+    const float t544 = t174 + t538;
+    const float t97 = t74 - t91;
+    const float t167 = t139 - t156;
+    const float t175 = t97 - t167;
+    const float t528 = t307 - t308;
+    const float t530 = 0.707106781f * t528;
+    const float t535 = t372 + t373;
+    const float t536 = 0.707106781f * t535;
+    const float t539 = t530 + t536;
+    const float t545 = t175 - t539;
+    const float t124 = t78 - t116;
+    const float t203 = t187 - t197;
+    const float t210 = t124 - t203;
+    const float t334 = t289 - t326;
+    const float t554 = 0.555570233f * t334;
+    const float t335 = t290 + t327;
+    const float t555 = 0.831469612f * t335;
+    const float t557 = t554 + t555;
+    const float t399 = t354 - t391;
+    const float t563 = 0.980785280f * t399;
+    const float t400 = t355 + t392;
+    const float t566 = 0.195090322f * t400;
+    const float t568 = t563 - t566;
+    const float t576 = t557 - t568;
+    const float t582 = t210 + t576;
+    const float t125 = t79 + t117;
+    const float t202 = t183 - t193;
+    const float t211 = t125 - t202;
+    const float t558 = 0.831469612f * t334;
+    const float t560 = 0.555570233f * t335;
+    const float t561 = t558 - t560;
+    const float t570 = 0.195090322f * t399;
+    const float t572 = 0.980785280f * t400;
+    const float t574 = t570 + t572;
+    const float t577 = t561 + t574;
+    const float t583 = t211 - t577;
+    const float t101 = t75 - t93;
+    const float t230 = t218 - t224;
+    const float t237 = t101 - t230;
+    const float t312 = t286 - t304;
+    const float t591 = 0.382683432f * t312;
+    const float t313 = t287 + t303;
+    const float t592 = 0.923879533f * t313;
+    const float t594 = t591 + t592;
+    const float t377 = t351 - t369;
+    const float t600 = 0.923879533f * t377;
+    const float t378 = t352 + t368;
+    const float t602 = 0.382683432f * t378;
+    const float t603 = t600 + t602;
+    const float t609 = t594 - t603;
+    const float t615 = t237 + t609;
+    const float t102 = t76 + t92;
+    const float t229 = t215 + t221;
+    const float t238 = t102 - t229;
+    const float t595 = 0.923879533f * t312;
+    const float t597 = 0.382683432f * t313;
+    const float t598 = t595 - t597;
+    const float t605 = 0.382683432f * t377;
+    const float t606 = 0.923879533f * t378;
+    const float t608 = t605 - t606;
+    const float t610 = t598 - t608;
+    const float t616 = t238 - t610;
+    const float t129 = t80 + t120;
+    const float t265 = t248 + t260;
+    const float t272 = t129 - t265;
+    const float t339 = t291 + t330;
+    const float t625 = 0.195090322f * t339;
+    const float t340 = t292 + t329;
+    const float t626 = 0.980785280f * t340;
+    const float t628 = t625 + t626;
+    const float t404 = t356 + t395;
+    const float t634 = 0.555570233f * t404;
+    const float t405 = t357 + t394;
+    const float t636 = 0.831469612f * t405;
+    const float t637 = t634 + t636;
+    const float t643 = t628 - t637;
+    const float t649 = t272 + t643;
+    const float t130 = t81 + t119;
+    const float t264 = t244 + t255;
+    const float t273 = t130 - t264;
+    const float t629 = 0.980785280f * t339;
+    const float t631 = 0.195090322f * t340;
+    const float t632 = t629 - t631;
+    const float t639 = 0.831469612f * t404;
+    const float t640 = 0.555570233f * t405;
+    const float t642 = t639 - t640;
+    const float t644 = t632 - t642;
+    const float t650 = t273 - t644;
+    const float t171 = t94 - t165;
+    const float t409 = t306 - t371;
+    const float t415 = t171 + t409;
+    const float t172 = t95 - t166;
+    const float t408 = t305 - t370;
+    const float t416 = t172 - t408;
+    const float t207 = t122 - t199;
+    const float t445 = t428 - t439;
+    const float t452 = t207 - t445;
+    const float t208 = t123 + t200;
+    const float t444 = t424 - t435;
+    const float t453 = t208 - t444;
+    const float t234 = t99 - t226;
+    const float t478 = t463 - t472;
+    const float t485 = t234 - t478;
+    const float t235 = t100 + t227;
+    const float t477 = t459 - t468;
+    const float t486 = t235 - t477;
+    const float t269 = t127 - t261;
+    const float t515 = t496 - t509;
+    const float t522 = t269 - t515;
+    const float t270 = t128 + t262;
+    const float t514 = t492 + t503;
+    const float t523 = t270 - t514;
+    const float t176 = t96 - t168;
+    const float t542 = t530 - t536;
+    const float t549 = t176 - t542;
+    const float t177 = t97 + t167;
+    const float t541 = t527 + t533;
+    const float t550 = t177 - t541;
+    const float t212 = t124 + t203;
+    const float t580 = t561 - t574;
+    const float t587 = t212 - t580;
+    const float t213 = t125 + t202;
+    const float t579 = t557 + t568;
+    const float t588 = t213 - t579;
+    const float t239 = t101 + t230;
+    const float t613 = t598 + t608;
+    const float t620 = t239 - t613;
+    const float t240 = t102 + t229;
+    const float t612 = t594 + t603;
+    const float t621 = t240 - t612;
+    const float t274 = t129 + t265;
+    const float t647 = t632 + t642;
+    const float t654 = t274 - t647;
+    const float t275 = t130 + t264;
+    const float t646 = t628 + t637;
+    const float t655 = t275 - t646;
+    const float t412 = t169 - t406;
+    const float t413 = t170 - t407;
+    const float t449 = t205 - t441;
+    const float t450 = t206 + t442;
+    const float t482 = t232 - t474;
+    const float t483 = t233 + t475;
+    const float t519 = t267 - t511;
+    const float t520 = t268 + t512;
+    const float t546 = t174 - t538;
+    const float t547 = t175 + t539;
+    const float t584 = t210 - t576;
+    const float t585 = t211 + t577;
+    const float t617 = t237 - t609;
+    const float t618 = t238 + t610;
+    const float t651 = t272 - t643;
+    const float t652 = t273 + t644;
+    const float t417 = t171 - t409;
+    const float t418 = t172 + t408;
+    const float t454 = t207 + t445;
+    const float t455 = t208 + t444;
+    const float t487 = t234 + t478;
+    const float t488 = t235 + t477;
+    const float t524 = t269 + t515;
+    const float t525 = t270 + t514;
+    const float t551 = t176 + t542;
+    const float t552 = t177 + t541;
+    const float t589 = t212 + t580;
+    const float t590 = t213 + t579;
+    const float t622 = t239 + t613;
+    const float t623 = t240 + t612;
+    const float t656 = t274 + t647;
+    const float t657 = t275 + t646;
+    output[0].real = t410;
+    output[0].imag = t411;
+    output[1].real = t447;
+    output[1].imag = t448;
+    output[2].real = t480;
+    output[2].imag = t481;
+    output[3].real = t517;
+    output[3].imag = t518;
+    output[4].real = t544;
+    output[4].imag = t545;
+    output[5].real = t582;
+    output[5].imag = t583;
+    output[6].real = t615;
+    output[6].imag = t616;
+    output[7].real = t649;
+    output[7].imag = t650;
+    output[8].real = t415;
+    output[8].imag = t416;
+    output[9].real = t452;
+    output[9].imag = t453;
+    output[10].real = t485;
+    output[10].imag = t486;
+    output[11].real = t522;
+    output[11].imag = t523;
+    output[12].real = t549;
+    output[12].imag = t550;
+    output[13].real = t587;
+    output[13].imag = t588;
+    output[14].real = t620;
+    output[14].imag = t621;
+    output[15].real = t654;
+    output[15].imag = t655;
+    output[16].real = t412;
+    output[16].imag = t413;
+    output[17].real = t449;
+    output[17].imag = t450;
+    output[18].real = t482;
+    output[18].imag = t483;
+    output[19].real = t519;
+    output[19].imag = t520;
+    output[20].real = t546;
+    output[20].imag = t547;
+    output[21].real = t584;
+    output[21].imag = t585;
+    output[22].real = t617;
+    output[22].imag = t618;
+    output[23].real = t651;
+    output[23].imag = t652;
+    output[24].real = t417;
+    output[24].imag = t418;
+    output[25].real = t454;
+    output[25].imag = t455;
+    output[26].real = t487;
+    output[26].imag = t488;
+    output[27].real = t524;
+    output[27].imag = t525;
+    output[28].real = t551;
+    output[28].imag = t552;
+    output[29].real = t589;
+    output[29].imag = t590;
+    output[30].real = t622;
+    output[30].imag = t623;
+    output[31].real = t656;
+    output[31].imag = t657;
+}
+
+// 372 additions, 84 multiplications
+void codelet_32_inv(const CkFftComplex* input, CkFftComplex* output, CkFftSize stride)
+{
+    const CkFftComplex* in0 = input + 0*stride;
+    const float x0r = in0->real;
+    const CkFftComplex* in16 = input + 16*stride;
+    const float x16r = in16->real;
+    const float t65 = x0r + x16r;
+    const CkFftComplex* in8 = input + 8*stride;
+    const float x8r = in8->real;
+    const CkFftComplex* in24 = input + 24*stride;
+    const float x24r = in24->real;
+    const float t69 = x8r + x24r;
+    const float t73 = t65 + t69;
+    const CkFftComplex* in4 = input + 4*stride;
+    const float x4r = in4->real;
+    const CkFftComplex* in20 = input + 20*stride;
+    const float x20r = in20->real;
+    const float t82 = x4r + x20r;
+    const CkFftComplex* in12 = input + 12*stride;
+    const float x12r = in12->real;
+    const CkFftComplex* in28 = input + 28*stride;
+    const float x28r = in28->real;
+    const float t86 = x12r + x28r;
+    const float t90 = t82 + t86;
+    const float t94 = t73 + t90;
+    const CkFftComplex* in2 = input + 2*stride;
+    const float x2r = in2->real;
+    const CkFftComplex* in18 = input + 18*stride;
+    const float x18r = in18->real;
+    const float t128 = x2r + x18r;
+    const CkFftComplex* in10 = input + 10*stride;
+    const float x10r = in10->real;
+    const CkFftComplex* in26 = input + 26*stride;
+    const float x26r = in26->real;
+    const float t132 = x10r + x26r;
+    const float t136 = t128 + t132;
+    const CkFftComplex* in6 = input + 6*stride;
+    const float x6r = in6->real;
+    const CkFftComplex* in22 = input + 22*stride;
+    const float x22r = in22->real;
+    const float t145 = x6r + x22r;
+    const CkFftComplex* in14 = input + 14*stride;
+    const float x14r = in14->real;
+    const CkFftComplex* in30 = input + 30*stride;
+    const float x30r = in30->real;
+    const float t149 = x14r + x30r;
+    const float t153 = t145 + t149;
+    const float t162 = t136 + t153;
+    const float t166 = t94 + t162;
+    const CkFftComplex* in1 = input + 1*stride;
+    const float x1r = in1->real;
+    const CkFftComplex* in17 = input + 17*stride;
+    const float x17r = in17->real;
+    const float t260 = x1r + x17r;
+    const CkFftComplex* in9 = input + 9*stride;
+    const float x9r = in9->real;
+    const CkFftComplex* in25 = input + 25*stride;
+    const float x25r = in25->real;
+    const float t264 = x9r + x25r;
+    const float t268 = t260 + t264;
+    const CkFftComplex* in5 = input + 5*stride;
+    const float x5r = in5->real;
+    const CkFftComplex* in21 = input + 21*stride;
+    const float x21r = in21->real;
+    const float t277 = x5r + x21r;
+    const CkFftComplex* in13 = input + 13*stride;
+    const float x13r = in13->real;
+    const CkFftComplex* in29 = input + 29*stride;
+    const float x29r = in29->real;
+    const float t281 = x13r + x29r;
+    const float t285 = t277 + t281;
+    const float t289 = t268 + t285;
+    const CkFftComplex* in3 = input + 3*stride;
+    const float x3r = in3->real;
+    const CkFftComplex* in19 = input + 19*stride;
+    const float x19r = in19->real;
+    const float t322 = x3r + x19r;
+    const CkFftComplex* in11 = input + 11*stride;
+    const float x11r = in11->real;
+    const CkFftComplex* in27 = input + 27*stride;
+    const float x27r = in27->real;
+    const float t326 = x11r + x27r;
+    const float t330 = t322 + t326;
+    const CkFftComplex* in7 = input + 7*stride;
+    const float x7r = in7->real;
+    const CkFftComplex* in23 = input + 23*stride;
+    const float x23r = in23->real;
+    const float t339 = x7r + x23r;
+    const CkFftComplex* in15 = input + 15*stride;
+    const float x15r = in15->real;
+    const CkFftComplex* in31 = input + 31*stride;
+    const float x31r = in31->real;
+    const float t343 = x15r + x31r;
+    const float t347 = t339 + t343;
+    const float t351 = t330 + t347;
+    const float t384 = t289 + t351;
+    const float t388 = t166 + t384;
+    const float x0i = in0->imag;
+    const float x16i = in16->imag;
+    const float t66 = x0i + x16i;
+    const float x8i = in8->imag;
+    const float x24i = in24->imag;
+    const float t70 = x8i + x24i;
+    const float t74 = t66 + t70;
+    const float x4i = in4->imag;
+    const float x20i = in20->imag;
+    const float t83 = x4i + x20i;
+    const float x12i = in12->imag;
+    const float x28i = in28->imag;
+    const float t87 = x12i + x28i;
+    const float t91 = t83 + t87;
+    const float t95 = t74 + t91;
+    const float x2i = in2->imag;
+    const float x18i = in18->imag;
+    const float t129 = x2i + x18i;
+    const float x10i = in10->imag;
+    const float x26i = in26->imag;
+    const float t133 = x10i + x26i;
+    const float t137 = t129 + t133;
+    const float x6i = in6->imag;
+    const float x22i = in22->imag;
+    const float t146 = x6i + x22i;
+    const float x14i = in14->imag;
+    const float x30i = in30->imag;
+    const float t150 = x14i + x30i;
+    const float t154 = t146 + t150;
+    const float t163 = t137 + t154;
+    const float t167 = t95 + t163;
+    const float x1i = in1->imag;
+    const float x17i = in17->imag;
+    const float t261 = x1i + x17i;
+    const float x9i = in9->imag;
+    const float x25i = in25->imag;
+    const float t265 = x9i + x25i;
+    const float t269 = t261 + t265;
+    const float x5i = in5->imag;
+    const float x21i = in21->imag;
+    const float t278 = x5i + x21i;
+    const float x13i = in13->imag;
+    const float x29i = in29->imag;
+    const float t282 = x13i + x29i;
+    const float t286 = t278 + t282;
+    const float t290 = t269 + t286;
+    const float x3i = in3->imag;
+    const float x19i = in19->imag;
+    const float t323 = x3i + x19i;
+    const float x11i = in11->imag;
+    const float x27i = in27->imag;
+    const float t327 = x11i + x27i;
+    const float t331 = t323 + t327;
+    const float x7i = in7->imag;
+    const float x23i = in23->imag;
+    const float t340 = x7i + x23i;
+    const float x15i = in15->imag;
+    const float x31i = in31->imag;
+    const float t344 = x15i + x31i;
+    const float t348 = t340 + t344;
+    const float t352 = t331 + t348;
+    const float t385 = t290 + t352;
+    const float t389 = t167 + t385;
+    const float t67 = x0r - x16r;
+    const float t72 = x8i - x24i;
+    const float t78 = t67 - t72;
+    const float t84 = x4r - x20r;
+    const float t85 = x4i - x20i;
+    const float t103 = t84 - t85;
+    const float t105 = 0.707106781f * t103;
+    const float t88 = x12r - x28r;
+    const float t89 = x12i - x28i;
+    const float t108 = t88 + t89;
+    const float t109 = 0.707106781f * t108;
+    const float t115 = t105 - t109;
+    const float t119 = t78 + t115;
+    const float t130 = x2r - x18r;
+    const float t135 = x10i - x26i;
+    const float t141 = t130 - t135;
+    const float t176 = 0.923879533f * t141;
+    const float t131 = x2i - x18i;
+    const float t134 = x10r - x26r;
+    const float t142 = t131 + t134;
+    const float t178 = 0.382683432f * t142;
+    const float t179 = t176 - t178;
+    const float t147 = x6r - x22r;
+    const float t152 = x14i - x30i;
+    const float t158 = t147 - t152;
+    const float t184 = 0.382683432f * t158;
+    const float t148 = x6i - x22i;
+    const float t151 = x14r - x30r;
+    const float t159 = t148 + t151;
+    const float t185 = 0.923879533f * t159;
+    const float t186 = t184 - t185;
+    const float t190 = t179 + t186;
+    const float t194 = t119 + t190;
+    const float t262 = x1r - x17r;
+    const float t267 = x9i - x25i;
+    const float t273 = t262 - t267;
+    const float t279 = x5r - x21r;
+    const float t280 = x5i - x21i;
+    const float t298 = t279 - t280;
+    const float t299 = 0.707106781f * t298;
+    const float t283 = x13r - x29r;
+    const float t284 = x13i - x29i;
+    const float t302 = t283 + t284;
+    const float t303 = 0.707106781f * t302;
+    const float t309 = t299 - t303;
+    const float t313 = t273 + t309;
+    const float t398 = 0.980785280f * t313;
+    const float t263 = x1i - x17i;
+    const float t266 = x9r - x25r;
+    const float t274 = t263 + t266;
+    const float t300 = t279 + t280;
+    const float t301 = 0.707106781f * t300;
+    const float t305 = t283 - t284;
+    const float t307 = 0.707106781f * t305;
+    const float t310 = t301 + t307;
+    const float t314 = t274 + t310;
+    const float t400 = 0.195090322f * t314;
+    const float t401 = t398 - t400;
+    const float t324 = x3r - x19r;
+    const float t329 = x11i - x27i;
+    const float t335 = t324 - t329;
+    const float t341 = x7r - x23r;
+    const float t342 = x7i - x23i;
+    const float t360 = t341 - t342;
+    const float t361 = 0.707106781f * t360;
+    const float t345 = x15r - x31r;
+    const float t346 = x15i - x31i;
+    const float t364 = t345 + t346;
+    const float t365 = 0.707106781f * t364;
+    const float t371 = t361 - t365;
+    const float t375 = t335 + t371;
+    const float t406 = 0.831469612f * t375;
+    const float t325 = x3i - x19i;
+    const float t328 = x11r - x27r;
+    const float t336 = t325 + t328;
+    const float t362 = t341 + t342;
+    const float t363 = 0.707106781f * t362;
+    const float t367 = t345 - t346;
+    const float t369 = 0.707106781f * t367;
+    const float t372 = t363 + t369;
+    const float t376 = t336 + t372;
+    const float t408 = 0.555570233f * t376;
+    const float t409 = t406 - t408;
+    const float t413 = t401 + t409;
+    const float t417 = t194 + t413;
+    const float t68 = x0i - x16i;
+    const float t71 = x8r - x24r;
+    const float t79 = t68 + t71;
+    const float t106 = t84 + t85;
+    const float t107 = 0.707106781f * t106;
+    const float t111 = t88 - t89;
+    const float t113 = 0.707106781f * t111;
+    const float t116 = t107 + t113;
+    const float t120 = t79 + t116;
+    const float t180 = 0.382683432f * t141;
+    const float t181 = 0.923879533f * t142;
+    const float t182 = t180 + t181;
+    const float t187 = 0.923879533f * t158;
+    const float t188 = 0.382683432f * t159;
+    const float t189 = t187 + t188;
+    const float t191 = t182 + t189;
+    const float t195 = t120 + t191;
+    const float t402 = 0.195090322f * t313;
+    const float t403 = 0.980785280f * t314;
+    const float t404 = t402 + t403;
+    const float t410 = 0.555570233f * t375;
+    const float t411 = 0.831469612f * t376;
+    const float t412 = t410 + t411;
+    const float t414 = t404 + t412;
+    const float t418 = t195 + t414;
+    const float t75 = t65 - t69;
+    const float t93 = t83 - t87;
+    const float t99 = t75 - t93;
+    const float t138 = t128 - t132;
+    const float t139 = t129 - t133;
+    const float t203 = t138 - t139;
+    const float t204 = 0.707106781f * t203;
+    const float t155 = t145 - t149;
+    const float t156 = t146 - t150;
+    const float t207 = t155 + t156;
+    const float t208 = 0.707106781f * t207;
+    const float t214 = t204 - t208;
+    const float t218 = t99 + t214;
+    const float t270 = t260 - t264;
+    const float t288 = t278 - t282;
+    const float t294 = t270 - t288;
+    const float t426 = 0.923879533f * t294;
+    const float t271 = t261 - t265;
+    const float t287 = t277 - t281;
+    const float t295 = t271 + t287;
+    const float t427 = 0.382683432f * t295;
+    const float t428 = t426 - t427;
+    const float t332 = t322 - t326;
+    const float t350 = t340 - t344;
+    const float t356 = t332 - t350;
+    const float t432 = 0.382683432f * t356;
+    const float t333 = t323 - t327;
+    const float t349 = t339 - t343;
+    const float t357 = t333 + t349;
+    const float t433 = 0.923879533f * t357;
+    const float t434 = t432 - t433;
+    const float t438 = t428 + t434;
+    const float t442 = t218 + t438;
+    const float t76 = t66 - t70;
+    const float t92 = t82 - t86;
+    const float t100 = t76 + t92;
+    const float t205 = t138 + t139;
+    const float t206 = 0.707106781f * t205;
+    const float t210 = t155 - t156;
+    const float t212 = 0.707106781f * t210;
+    const float t215 = t206 + t212;
+    const float t219 = t100 + t215;
+    const float t429 = 0.382683432f * t294;
+    const float t430 = 0.923879533f * t295;
+    const float t431 = t429 + t430;
+    const float t435 = 0.923879533f * t356;
+    const float t436 = 0.382683432f * t357;
+    const float t437 = t435 + t436;
+    const float t439 = t431 + t437;
+    const float t443 = t219 + t439;
+    const float t80 = t67 + t72;
+    const float t118 = t107 - t113;
+    const float t124 = t80 - t118;
+    const float t143 = t130 + t135;
+    const float t227 = 0.382683432f * t143;
+    const float t144 = t131 - t134;
+    const float t228 = 0.923879533f * t144;
+    const float t229 = t227 - t228;
+    const float t160 = t147 + t152;
+    const float t234 = 0.923879533f * t160;
+    const float t161 = t148 - t151;
+    const float t237 = 0.382683432f * t161;
+    const float t239 = t234 - t237;
+    const float t247 = t229 - t239;
+    const float t251 = t124 + t247;
+    const float t275 = t262 + t267;
+    const float t312 = t301 - t307;
+    const float t318 = t275 - t312;
+    const float t451 = 0.831469612f * t318;
+    const float t276 = t263 - t266;
+    const float t311 = t299 + t303;
+    const float t319 = t276 + t311;
+    const float t452 = 0.555570233f * t319;
+    const float t453 = t451 - t452;
+    const float t337 = t324 + t329;
+    const float t374 = t363 - t369;
+    const float t380 = t337 - t374;
+    const float t458 = 0.195090322f * t380;
+    const float t338 = t325 - t328;
+    const float t373 = t361 + t365;
+    const float t381 = t338 + t373;
+    const float t460 = 0.980785280f * t381;
+    const float t461 = t458 + t460;
+    const float t467 = t453 - t461;
+    const float t471 = t251 + t467;
+    const float t81 = t68 - t71;
+    const float t117 = t105 + t109;
+    const float t125 = t81 + t117;
+    const float t230 = 0.923879533f * t143;
+    const float t231 = 0.382683432f * t144;
+    const float t232 = t230 + t231;
+    const float t241 = 0.382683432f * t160;
+    const float t243 = 0.923879533f * t161;
+    const float t245 = t241 + t243;
+    const float t248 = t232 - t245;
+    const float t252 = t125 + t248;
+    const float t454 = 0.555570233f * t318;
+    const float t455 = 0.831469612f * t319;
+    const float t456 = t454 + t455;
+    const float t463 = 0.980785280f * t380;
+    const float t464 = 0.195090322f * t381;
+    const float t466 = t463 - t464;
+    const float t468 = t456 + t466;
+    const float t472 = t252 + t468;
+    const float t96 = t73 - t90;
+    const float t165 = t137 - t154;
+    const float t171 = t96 - t165;
+    const float t291 = t268 - t285;
+    const float t292 = t269 - t286;
+    const float t480 = t291 - t292;
+    const float t481 = 0.707106781f * t480;
+    const float t353 = t330 - t347;
+    const float t354 = t331 - t348;
+    const float t484 = t353 + t354;
+    const float t485 = 0.707106781f * t484;
+    const float t491 = t481 - t485;
+    const float t495 = t171 + t491;
+    const float t97 = t74 - t91;
+    const float t164 = t136 - t153;
+    const float t172 = t97 + t164;
+    const float t482 = t291 + t292;
+    const float t483 = 0.707106781f * t482;
+    const float t487 = t353 - t354;
+    const float t489 = 0.707106781f * t487;
+    const float t492 = t483 + t489;
+    const float t496 = t172 + t492;
+    const float t121 = t78 - t115;
+    const float t193 = t182 - t189;
+    const float t199 = t121 - t193;
+    const float t315 = t273 - t309;
+    const float t505 = 0.555570233f * t315;
+    const float t316 = t274 - t310;
+    const float t506 = 0.831469612f * t316;
+    const float t507 = t505 - t506;
+    const float t377 = t335 - t371;
+    const float t511 = 0.980785280f * t377;
+    const float t378 = t336 - t372;
+    const float t514 = 0.195090322f * t378;
+    const float t515 = t511 + t514;
+    const float t521 = t507 - t515;
+    const float t525 = t199 + t521;
+    const float t122 = t79 - t116;
+    const float t192 = t179 - t186;
+    const float t200 = t122 + t192;
+    const float t508 = 0.831469612f * t315;
+    const float t509 = 0.555570233f * t316;
+    const float t510 = t508 + t509;
+    const float t517 = 0.195090322f * t377;
+    const float t518 = 0.980785280f * t378;
+    const float t520 = t517 - t518;
+    const float t522 = t510 + t520;
+    const float t526 = t200 + t522;
+    const float t101 = t75 + t93;
+    const float t217 = t206 - t212;
+    const float t223 = t101 - t217;
+    const float t296 = t270 + t288;
+    const float t534 = 0.382683432f * t296;
+    const float t297 = t271 - t287;
+    const float t535 = 0.923879533f * t297;
+    const float t536 = t534 - t535;
+    const float t358 = t332 + t350;
+    const float t540 = 0.923879533f * t358;
+    const float t359 = t333 - t349;
+    const float t542 = 0.382683432f * t359;
+    const float t544 = t540 - t542;
+    const float t552 = t536 - t544;
+    const float t556 = t223 + t552;
+    const float t102 = t76 - t92;
+    const float t216 = t204 + t208;
+    const float t224 = t102 + t216;
+    const float t537 = 0.923879533f * t296;
+    const float t538 = 0.382683432f * t297;
+    const float t539 = t537 + t538;
+    const float t546 = 0.382683432f * t358;
+    const float t548 = 0.923879533f * t359;
+    const float t550 = t546 + t548;
+    const float t553 = t539 - t550;
+    const float t557 = t224 + t553;
+    const float t126 = t80 + t118;
+    const float t250 = t232 + t245;
+    const float t256 = t126 - t250;
+    const float t320 = t275 + t312;
+    const float t566 = 0.195090322f * t320;
+    const float t321 = t276 - t311;
+    const float t567 = 0.980785280f * t321;
+    const float t568 = t566 - t567;
+    const float t382 = t337 + t374;
+    const float t572 = 0.555570233f * t382;
+    const float t383 = t338 - t373;
+    const float t574 = 0.831469612f * t383;
+    const float t576 = t572 - t574;
+    const float t584 = t568 - t576;
+    const float t588 = t256 + t584;
+    const float t127 = t81 - t117;
+    const float t249 = t229 + t239;
+    const float t257 = t127 + t249;
+    const float t569 = 0.980785280f * t320;
+    const float t570 = 0.195090322f * t321;
+    const float t571 = t569 + t570;
+    const float t578 = 0.831469612f * t382;
+    const float t580 = 0.555570233f * t383;
+    const float t582 = t578 + t580;
+    const float t585 = t571 - t582;
+    const float t589 = t257 + t585;
+    const float t168 = t94 - t162;
+    const float t387 = t290 - t352;
+    const float t393 = t168 - t387;
+    const float t169 = t95 - t163;
+    const float t386 = t289 - t351;
+    const float t394 = t169 + t386;
+    const float t196 = t119 - t190;
+    const float t416 = t404 - t412;
+    const float t422 = t196 - t416;
+    const float t197 = t120 - t191;
+    const float t415 = t401 - t409;
+    const float t423 = t197 + t415;
+    const float t220 = t99 - t214;
+    const float t441 = t431 - t437;
+    const float t447 = t220 - t441;
+    const float t221 = t100 - t215;
+    const float t440 = t428 - t434;
+    const float t448 = t221 + t440;
+    const float t253 = t124 - t247;
+    const float t470 = t456 - t466;
+    const float t476 = t253 - t470;
+    const float t254 = t125 - t248;
+    const float t469 = t453 + t461;
+    const float t477 = t254 + t469;
+    const float t173 = t96 + t165;
+    const float t494 = t483 - t489;
+    const float t500 = t173 - t494;
+    const float t174 = t97 - t164;
+    const float t493 = t481 + t485;
+    const float t501 = t174 + t493;
+    const float t201 = t121 + t193;
+    const float t524 = t510 - t520;
+    const float t530 = t201 - t524;
+    const float t202 = t122 - t192;
+    const float t523 = t507 + t515;
+    const float t531 = t202 + t523;
+    const float t225 = t101 + t217;
+    const float t555 = t539 + t550;
+    const float t561 = t225 - t555;
+    const float t226 = t102 - t216;
+    const float t554 = t536 + t544;
+    const float t562 = t226 + t554;
+    const float t258 = t126 + t250;
+    const float t587 = t571 + t582;
+    const float t593 = t258 - t587;
+    const float t259 = t127 - t249;
+    const float t586 = t568 + t576;
+    const float t594 = t259 + t586;
+    const float t390 = t166 - t384;
+    const float t391 = t167 - t385;
+    const float t419 = t194 - t413;
+    const float t420 = t195 - t414;
+    const float t444 = t218 - t438;
+    const float t445 = t219 - t439;
+    const float t473 = t251 - t467;
+    const float t474 = t252 - t468;
+    const float t497 = t171 - t491;
+    const float t498 = t172 - t492;
+    const float t527 = t199 - t521;
+    const float t528 = t200 - t522;
+    const float t558 = t223 - t552;
+    const float t559 = t224 - t553;
+    const float t590 = t256 - t584;
+    const float t591 = t257 - t585;
+    const float t395 = t168 + t387;
+    const float t396 = t169 - t386;
+    const float t424 = t196 + t416;
+    const float t425 = t197 - t415;
+    const float t449 = t220 + t441;
+    const float t450 = t221 - t440;
+    const float t478 = t253 + t470;
+    const float t479 = t254 - t469;
+    const float t502 = t173 + t494;
+    const float t503 = t174 - t493;
+    const float t532 = t201 + t524;
+    const float t533 = t202 - t523;
+    const float t563 = t225 + t555;
+    const float t564 = t226 - t554;
+    const float t595 = t258 + t587;
+    const float t596 = t259 - t586;
+    output[0].real = t388;
+    output[0].imag = t389;
+    output[1].real = t417;
+    output[1].imag = t418;
+    output[2].real = t442;
+    output[2].imag = t443;
+    output[3].real = t471;
+    output[3].imag = t472;
+    output[4].real = t495;
+    output[4].imag = t496;
+    output[5].real = t525;
+    output[5].imag = t526;
+    output[6].real = t556;
+    output[6].imag = t557;
+    output[7].real = t588;
+    output[7].imag = t589;
+    output[8].real = t393;
+    output[8].imag = t394;
+    output[9].real = t422;
+    output[9].imag = t423;
+    output[10].real = t447;
+    output[10].imag = t448;
+    output[11].real = t476;
+    output[11].imag = t477;
+    output[12].real = t500;
+    output[12].imag = t501;
+    output[13].real = t530;
+    output[13].imag = t531;
+    output[14].real = t561;
+    output[14].imag = t562;
+    output[15].real = t593;
+    output[15].imag = t594;
+    output[16].real = t390;
+    output[16].imag = t391;
+    output[17].real = t419;
+    output[17].imag = t420;
+    output[18].real = t444;
+    output[18].imag = t445;
+    output[19].real = t473;
+    output[19].imag = t474;
+    output[20].real = t497;
+    output[20].imag = t498;
+    output[21].real = t527;
+    output[21].imag = t528;
+    output[22].real = t558;
+    output[22].imag = t559;
+    output[23].real = t590;
+    output[23].imag = t591;
+    output[24].real = t395;
+    output[24].imag = t396;
+    output[25].real = t424;
+    output[25].imag = t425;
+    output[26].real = t449;
+    output[26].imag = t450;
+    output[27].real = t478;
+    output[27].imag = t479;
+    output[28].real = t502;
+    output[28].imag = t503;
+    output[29].real = t532;
+    output[29].imag = t533;
+    output[30].real = t563;
+    output[30].imag = t564;
+    output[31].real = t595;
+    output[31].imag = t596;
+}
+
+// 912 additions, 248 multiplications
+void codelet_64_fwd(const CkFftComplex* input, CkFftComplex* output, CkFftSize stride)
+{
+    const CkFftComplex* in0 = input + 0*stride;
+    const float x0r = in0->real;
+    const CkFftComplex* in32 = input + 32*stride;
+    const float x32r = in32->real;
+    const float t129 = x0r + x32r;
+    const CkFftComplex* in16 = input + 16*stride;
+    const float x16r = in16->real;
+    const CkFftComplex* in48 = input + 48*stride;
+    const float x48r = in48->real;
+    const float t133 = x16r + x48r;
+    const float t137 = t129 + t133;
+    const CkFftComplex* in8 = input + 8*stride;
+    const float x8r = in8->real;
+    const CkFftComplex* in40 = input + 40*stride;
+    const float x40r = in40->real;
+    const float t146 = x8r + x40r;
+    const CkFftComplex* in24 = input + 24*stride;
+    const float x24r = in24->real;
+    const CkFftComplex* in56 = input + 56*stride;
+    const float x56r = in56->real;
+    const float t150 = x24r + x56r;
+    const float t154 = t146 + t150;
+    const float t158 = t137 + t154;
+    const CkFftComplex* in4 = input + 4*stride;
+    const float x4r = in4->real;
+    const CkFftComplex* in36 = input + 36*stride;
+    const float x36r = in36->real;
+    const float t195 = x4r + x36r;
+    const CkFftComplex* in20 = input + 20*stride;
+    const float x20r = in20->real;
+    const CkFftComplex* in52 = input + 52*stride;
+    const float x52r = in52->real;
+    const float t199 = x20r + x52r;
+    const float t203 = t195 + t199;
+    const CkFftComplex* in12 = input + 12*stride;
+    const float x12r = in12->real;
+    const CkFftComplex* in44 = input + 44*stride;
+    const float x44r = in44->real;
+    const float t212 = x12r + x44r;
+    const CkFftComplex* in28 = input + 28*stride;
+    const float x28r = in28->real;
+    const CkFftComplex* in60 = input + 60*stride;
+    const float x60r = in60->real;
+    const float t216 = x28r + x60r;
+    const float t220 = t212 + t216;
+    const float t229 = t203 + t220;
+    const float t233 = t158 + t229;
+    const CkFftComplex* in2 = input + 2*stride;
+    const float x2r = in2->real;
+    const CkFftComplex* in34 = input + 34*stride;
+    const float x34r = in34->real;
+    const float t340 = x2r + x34r;
+    const CkFftComplex* in18 = input + 18*stride;
+    const float x18r = in18->real;
+    const CkFftComplex* in50 = input + 50*stride;
+    const float x50r = in50->real;
+    const float t344 = x18r + x50r;
+    const float t348 = t340 + t344;
+    const CkFftComplex* in10 = input + 10*stride;
+    const float x10r = in10->real;
+    const CkFftComplex* in42 = input + 42*stride;
+    const float x42r = in42->real;
+    const float t357 = x10r + x42r;
+    const CkFftComplex* in26 = input + 26*stride;
+    const float x26r = in26->real;
+    const CkFftComplex* in58 = input + 58*stride;
+    const float x58r = in58->real;
+    const float t361 = x26r + x58r;
+    const float t365 = t357 + t361;
+    const float t369 = t348 + t365;
+    const CkFftComplex* in6 = input + 6*stride;
+    const float x6r = in6->real;
+    const CkFftComplex* in38 = input + 38*stride;
+    const float x38r = in38->real;
+    const float t405 = x6r + x38r;
+    const CkFftComplex* in22 = input + 22*stride;
+    const float x22r = in22->real;
+    const CkFftComplex* in54 = input + 54*stride;
+    const float x54r = in54->real;
+    const float t409 = x22r + x54r;
+    const float t413 = t405 + t409;
+    const CkFftComplex* in14 = input + 14*stride;
+    const float x14r = in14->real;
+    const CkFftComplex* in46 = input + 46*stride;
+    const float x46r = in46->real;
+    const float t422 = x14r + x46r;
+    const CkFftComplex* in30 = input + 30*stride;
+    const float x30r = in30->real;
+    const CkFftComplex* in62 = input + 62*stride;
+    const float x62r = in62->real;
+    const float t426 = x30r + x62r;
+    const float t430 = t422 + t426;
+    const float t434 = t413 + t430;
+    const float t470 = t369 + t434;
+    const float t474 = t233 + t470;
+    const CkFftComplex* in1 = input + 1*stride;
+    const float x1r = in1->real;
+    const CkFftComplex* in33 = input + 33*stride;
+    const float x33r = in33->real;
+    const float t722 = x1r + x33r;
+    const CkFftComplex* in17 = input + 17*stride;
+    const float x17r = in17->real;
+    const CkFftComplex* in49 = input + 49*stride;
+    const float x49r = in49->real;
+    const float t726 = x17r + x49r;
+    const float t730 = t722 + t726;
+    const CkFftComplex* in9 = input + 9*stride;
+    const float x9r = in9->real;
+    const CkFftComplex* in41 = input + 41*stride;
+    const float x41r = in41->real;
+    const float t739 = x9r + x41r;
+    const CkFftComplex* in25 = input + 25*stride;
+    const float x25r = in25->real;
+    const CkFftComplex* in57 = input + 57*stride;
+    const float x57r = in57->real;
+    const float t743 = x25r + x57r;
+    const float t747 = t739 + t743;
+    const float t751 = t730 + t747;
+    const CkFftComplex* in5 = input + 5*stride;
+    const float x5r = in5->real;
+    const CkFftComplex* in37 = input + 37*stride;
+    const float x37r = in37->real;
+    const float t787 = x5r + x37r;
+    const CkFftComplex* in21 = input + 21*stride;
+    const float x21r = in21->real;
+    const CkFftComplex* in53 = input + 53*stride;
+    const float x53r = in53->real;
+    const float t791 = x21r + x53r;
+    const float t795 = t787 + t791;
+    const CkFftComplex* in13 = input + 13*stride;
+    const float x13r = in13->real;
+    const CkFftComplex* in45 = input + 45*stride;
+    const float x45r = in45->real;
+    const float t804 = x13r + x45r;
+    const CkFftComplex* in29 = input + 29*stride;
+    const float x29r = in29->real;
+    const CkFftComplex* in61 = input + 61*stride;
+    const float x61r = in61->real;
+    const float t808 = x29r + x61r;
+    const float t812 = t804 + t808;
+    const float t821 = t795 + t812;
+    const float t825 = t751 + t821;
+    const CkFftComplex* in3 = input + 3*stride;
+    const float x3r = in3->real;
+    const CkFftComplex* in35 = input + 35*stride;
+    const float x35r = in35->real;
+    const float t927 = x3r + x35r;
+    const CkFftComplex* in19 = input + 19*stride;
+    const float x19r = in19->real;
+    const CkFftComplex* in51 = input + 51*stride;
+    const float x51r = in51->real;
+    const float t931 = x19r + x51r;
+    const float t935 = t927 + t931;
+    const CkFftComplex* in11 = input + 11*stride;
+    const float x11r = in11->real;
+    const CkFftComplex* in43 = input + 43*stride;
+    const float x43r = in43->real;
+    const float t944 = x11r + x43r;
+    const CkFftComplex* in27 = input + 27*stride;
+    const float x27r = in27->real;
+    const CkFftComplex* in59 = input + 59*stride;
+    const float x59r = in59->real;
+    const float t948 = x27r + x59r;
+    const float t952 = t944 + t948;
+    const float t956 = t935 + t952;
+    const CkFftComplex* in7 = input + 7*stride;
+    const float x7r = in7->real;
+    const CkFftComplex* in39 = input + 39*stride;
+    const float x39r = in39->real;
+    const float t992 = x7r + x39r;
+    const CkFftComplex* in23 = input + 23*stride;
+    const float x23r = in23->real;
+    const CkFftComplex* in55 = input + 55*stride;
+    const float x55r = in55->real;
+    const float t996 = x23r + x55r;
+    const float t1000 = t992 + t996;
+    const CkFftComplex* in15 = input + 15*stride;
+    const float x15r = in15->real;
+    const CkFftComplex* in47 = input + 47*stride;
+    const float x47r = in47->real;
+    const float t1009 = x15r + x47r;
+    const CkFftComplex* in31 = input + 31*stride;
+    const float x31r = in31->real;
+    const CkFftComplex* in63 = input + 63*stride;
+    const float x63r = in63->real;
+    const float t1013 = x31r + x63r;
+    const float t1017 = t1009 + t1013;
+    const float t1026 = t1000 + t1017;
+    const float t1030 = t956 + t1026;
+    const float t1132 = t825 + t1030;
+    const float t1136 = t474 + t1132;
+    const float x0i = in0->imag;
+    const float x32i = in32->imag;
+    const float t130 = x0i + x32i;
+    const float x16i = in16->imag;
+    const float x48i = in48->imag;
+    const float t134 = x16i + x48i;
+    const float t138 = t130 + t134;
+    const float x8i = in8->imag;
+    const float x40i = in40->imag;
+    const float t147 = x8i + x40i;
+    const float x24i = in24->imag;
+    const float x56i = in56->imag;
+    const float t151 = x24i + x56i;
+    const float t155 = t147 + t151;
+    const float t159 = t138 + t155;
+    const float x4i = in4->imag;
+    const float x36i = in36->imag;
+    const float t196 = x4i + x36i;
+    const float x20i = in20->imag;
+    const float x52i = in52->imag;
+    const float t200 = x20i + x52i;
+    const float t204 = t196 + t200;
+    const float x12i = in12->imag;
+    const float x44i = in44->imag;
+    const float t213 = x12i + x44i;
+    const float x28i = in28->imag;
+    const float x60i = in60->imag;
+    const float t217 = x28i + x60i;
+    const float t221 = t213 + t217;
+    const float t230 = t204 + t221;
+    const float t234 = t159 + t230;
+    const float x2i = in2->imag;
+    const float x34i = in34->imag;
+    const float t341 = x2i + x34i;
+    const float x18i = in18->imag;
+    const float x50i = in50->imag;
+    const float t345 = x18i + x50i;
+    const float t349 = t341 + t345;
+    const float x10i = in10->imag;
+    const float x42i = in42->imag;
+    const float t358 = x10i + x42i;
+    const float x26i = in26->imag;
+    const float x58i = in58->imag;
+    const float t362 = x26i + x58i;
+    const float t366 = t358 + t362;
+    const float t370 = t349 + t366;
+    const float x6i = in6->imag;
+    const float x38i = in38->imag;
+    const float t406 = x6i + x38i;
+    const float x22i = in22->imag;
+    const float x54i = in54->imag;
+    const float t410 = x22i + x54i;
+    const float t414 = t406 + t410;
+    const float x14i = in14->imag;
+    const float x46i = in46->imag;
+    const float t423 = x14i + x46i;
+    const float x30i = in30->imag;
+    const float x62i = in62->imag;
+    const float t427 = x30i + x62i;
+    const float t431 = t423 + t427;
+    const float t435 = t414 + t431;
+    const float t471 = t370 + t435;
+    const float t475 = t234 + t471;
+    const float x1i = in1->imag;
+    const float x33i = in33->imag;
+    const float t723 = x1i + x33i;
+    const float x17i = in17->imag;
+    const float x49i = in49->imag;
+    const float t727 = x17i + x49i;
+    const float t731 = t723 + t727;
+    const float x9i = in9->imag;
+    const float x41i = in41->imag;
+    const float t740 = x9i + x41i;
+    const float x25i = in25->imag;
+    const float x57i = in57->imag;
+    const float t744 = x25i + x57i;
+    const float t748 = t740 + t744;
+    const float t752 = t731 + t748;
+    const float x5i = in5->imag;
+    const float x37i = in37->imag;
+    const float t788 = x5i + x37i;
+    const float x21i = in21->imag;
+    const float x53i = in53->imag;
+    const float t792 = x21i + x53i;
+    const float t796 = t788 + t792;
+    const float x13i = in13->imag;
+    const float x45i = in45->imag;
+    const float t805 = x13i + x45i;
+    const float x29i = in29->imag;
+    const float x61i = in61->imag;
+    const float t809 = x29i + x61i;
+    const float t813 = t805 + t809;
+    const float t822 = t796 + t813;
+    const float t826 = t752 + t822;
+    const float x3i = in3->imag;
+    const float x35i = in35->imag;
+    const float t928 = x3i + x35i;
+    const float x19i = in19->imag;
+    const float x51i = in51->imag;
+    const float t932 = x19i + x51i;
+    const float t936 = t928 + t932;
+    const float x11i = in11->imag;
+    const float x43i = in43->imag;
+    const float t945 = x11i + x43i;
+    const float x27i = in27->imag;
+    const float x59i = in59->imag;
+    const float t949 = x27i + x59i;
+    const float t953 = t945 + t949;
+    const float t957 = t936 + t953;
+    const float x7i = in7->imag;
+    const float x39i = in39->imag;
+    const float t993 = x7i + x39i;
+    const float x23i = in23->imag;
+    const float x55i = in55->imag;
+    const float t997 = x23i + x55i;
+    const float t1001 = t993 + t997;
+    const float x15i = in15->imag;
+    const float x47i = in47->imag;
+    const float t1010 = x15i + x47i;
+    const float x31i = in31->imag;
+    const float x63i = in63->imag;
+    const float t1014 = x31i + x63i;
+    const float t1018 = t1010 + t1014;
+    const float t1027 = t1001 + t1018;
+    const float t1031 = t957 + t1027;
+    const float t1133 = t826 + t1031;
+    const float t1137 = t475 + t1133;
+    const float t131 = x0r - x32r;
+    const float t136 = x16i - x48i;
+    const float t142 = t131 + t136;
+    const float t148 = x8r - x40r;
+    const float t149 = x8i - x40i;
+    const float t167 = t148 + t149;
+    const float t169 = 0.707106781f * t167;
+    const float t152 = x24r - x56r;
+    const float t153 = x24i - x56i;
+    const float t174 = t152 - t153;
+    const float t175 = 0.707106781f * t174;
+    const float t180 = t169 - t175;
+    const float t186 = t142 + t180;
+    const float t197 = x4r - x36r;
+    const float t202 = x20i - x52i;
+    const float t208 = t197 + t202;
+    const float t243 = 0.923879533f * t208;
+    const float t198 = x4i - x36i;
+    const float t201 = x20r - x52r;
+    const float t209 = t198 - t201;
+    const float t245 = 0.382683432f * t209;
+    const float t247 = t243 + t245;
+    const float t214 = x12r - x44r;
+    const float t219 = x28i - x60i;
+    const float t225 = t214 + t219;
+    const float t254 = 0.382683432f * t225;
+    const float t215 = x12i - x44i;
+    const float t218 = x28r - x60r;
+    const float t226 = t215 - t218;
+    const float t255 = 0.923879533f * t226;
+    const float t257 = t254 + t255;
+    const float t263 = t247 + t257;
+    const float t269 = t186 + t263;
+    const float t342 = x2r - x34r;
+    const float t347 = x18i - x50i;
+    const float t353 = t342 + t347;
+    const float t359 = x10r - x42r;
+    const float t360 = x10i - x42i;
+    const float t378 = t359 + t360;
+    const float t379 = 0.707106781f * t378;
+    const float t363 = x26r - x58r;
+    const float t364 = x26i - x58i;
+    const float t384 = t363 - t364;
+    const float t385 = 0.707106781f * t384;
+    const float t390 = t379 - t385;
+    const float t396 = t353 + t390;
+    const float t484 = 0.980785280f * t396;
+    const float t343 = x2i - x34i;
+    const float t346 = x18r - x50r;
+    const float t354 = t343 - t346;
+    const float t380 = t359 - t360;
+    const float t382 = 0.707106781f * t380;
+    const float t387 = t363 + t364;
+    const float t388 = 0.707106781f * t387;
+    const float t391 = t382 + t388;
+    const float t397 = t354 - t391;
+    const float t486 = 0.195090322f * t397;
+    const float t488 = t484 + t486;
+    const float t407 = x6r - x38r;
+    const float t412 = x22i - x54i;
+    const float t418 = t407 + t412;
+    const float t424 = x14r - x46r;
+    const float t425 = x14i - x46i;
+    const float t443 = t424 + t425;
+    const float t444 = 0.707106781f * t443;
+    const float t428 = x30r - x62r;
+    const float t429 = x30i - x62i;
+    const float t449 = t428 - t429;
+    const float t450 = 0.707106781f * t449;
+    const float t455 = t444 - t450;
+    const float t461 = t418 + t455;
+    const float t495 = 0.831469612f * t461;
+    const float t408 = x6i - x38i;
+    const float t411 = x22r - x54r;
+    const float t419 = t408 - t411;
+    const float t445 = t424 - t425;
+    const float t447 = 0.707106781f * t445;
+    const float t452 = t428 + t429;
+    const float t453 = 0.707106781f * t452;
+    const float t456 = t447 + t453;
+    const float t462 = t419 - t456;
+    const float t497 = 0.555570233f * t462;
+    const float t499 = t495 + t497;
+    const float t505 = t488 + t499;
+    const float t511 = t269 + t505;
+    const float t724 = x1r - x33r;
+    const float t729 = x17i - x49i;
+    const float t735 = t724 + t729;
+    const float t741 = x9r - x41r;
+    const float t742 = x9i - x41i;
+    const float t760 = t741 + t742;
+    const float t761 = 0.707106781f * t760;
+    const float t745 = x25r - x57r;
+    const float t746 = x25i - x57i;
+    const float t766 = t745 - t746;
+    const float t767 = 0.707106781f * t766;
+    const float t772 = t761 - t767;
+    const float t778 = t735 + t772;
+    const float t789 = x5r - x37r;
+    const float t794 = x21i - x53i;
+    const float t800 = t789 + t794;
+    const float t834 = 0.923879533f * t800;
+    const float t790 = x5i - x37i;
+    const float t793 = x21r - x53r;
+    const float t801 = t790 - t793;
+    const float t835 = 0.382683432f * t801;
+    const float t837 = t834 + t835;
+    const float t806 = x13r - x45r;
+    const float t811 = x29i - x61i;
+    const float t817 = t806 + t811;
+    const float t843 = 0.382683432f * t817;
+    const float t807 = x13i - x45i;
+    const float t810 = x29r - x61r;
+    const float t818 = t807 - t810;
+    const float t844 = 0.923879533f * t818;
+    const float t846 = t843 + t844;
+    const float t852 = t837 + t846;
+    const float t858 = t778 + t852;
+    const float t1146 = 0.995184727f * t858;
+    const float t725 = x1i - x33i;
+    const float t728 = x17r - x49r;
+    const float t736 = t725 - t728;
+    const float t762 = t741 - t742;
+    const float t764 = 0.707106781f * t762;
+    const float t769 = t745 + t746;
+    const float t770 = 0.707106781f * t769;
+    const float t773 = t764 + t770;
+    const float t779 = t736 - t773;
+    const float t838 = 0.382683432f * t800;
+    const float t840 = 0.923879533f * t801;
+    const float t841 = t838 - t840;
+    const float t847 = 0.923879533f * t817;
+    const float t849 = 0.382683432f * t818;
+    const float t850 = t847 - t849;
+    const float t853 = t841 + t850;
+    const float t859 = t779 - t853;
+    const float t1148 = 0.098017140f * t859;
+    const float t1150 = t1146 + t1148;
+    const float t929 = x3r - x35r;
+    const float t934 = x19i - x51i;
+    const float t940 = t929 + t934;
+    const float t946 = x11r - x43r;
+    const float t947 = x11i - x43i;
+    const float t965 = t946 + t947;
+    const float t966 = 0.707106781f * t965;
+    const float t950 = x27r - x59r;
+    const float t951 = x27i - x59i;
+    const float t971 = t950 - t951;
+    const float t972 = 0.707106781f * t971;
+    const float t977 = t966 - t972;
+    const float t983 = t940 + t977;
+    const float t994 = x7r - x39r;
+    const float t999 = x23i - x55i;
+    const float t1005 = t994 + t999;
+    const float t1039 = 0.923879533f * t1005;
+    const float t995 = x7i - x39i;
+    const float t998 = x23r - x55r;
+    const float t1006 = t995 - t998;
+    const float t1040 = 0.382683432f * t1006;
+    const float t1042 = t1039 + t1040;
+    const float t1011 = x15r - x47r;
+    const float t1016 = x31i - x63i;
+    const float t1022 = t1011 + t1016;
+    const float t1048 = 0.382683432f * t1022;
+    const float t1012 = x15i - x47i;
+    const float t1015 = x31r - x63r;
+    const float t1023 = t1012 - t1015;
+    const float t1049 = 0.923879533f * t1023;
+    const float t1051 = t1048 + t1049;
+    const float t1057 = t1042 + t1051;
+    const float t1063 = t983 + t1057;
+    const float t1157 = 0.956940336f * t1063;
+    const float t930 = x3i - x35i;
+    const float t933 = x19r - x51r;
+    const float t941 = t930 - t933;
+    const float t967 = t946 - t947;
+    const float t969 = 0.707106781f * t967;
+    const float t974 = t950 + t951;
+    const float t975 = 0.707106781f * t974;
+    const float t978 = t969 + t975;
+    const float t984 = t941 - t978;
+    const float t1043 = 0.382683432f * t1005;
+    const float t1045 = 0.923879533f * t1006;
+    const float t1046 = t1043 - t1045;
+    const float t1052 = 0.923879533f * t1022;
+    const float t1054 = 0.382683432f * t1023;
+    const float t1055 = t1052 - t1054;
+    const float t1058 = t1046 + t1055;
+    const float t1064 = t984 - t1058;
+    const float t1159 = 0.290284677f * t1064;
+    const float t1161 = t1157 + t1159;
+    const float t1167 = t1150 + t1161;
+    const float t1173 = t511 + t1167;
+    const float t132 = x0i - x32i;
+    const float t135 = x16r - x48r;
+    const float t143 = t132 - t135;
+    const float t170 = t148 - t149;
+    const float t172 = 0.707106781f * t170;
+    const float t177 = t152 + t153;
+    const float t178 = 0.707106781f * t177;
+    const float t181 = t172 + t178;
+    const float t187 = t143 - t181;
+    const float t248 = 0.382683432f * t208;
+    const float t250 = 0.923879533f * t209;
+    const float t251 = t248 - t250;
+    const float t258 = 0.923879533f * t225;
+    const float t260 = 0.382683432f * t226;
+    const float t261 = t258 - t260;
+    const float t264 = t251 + t261;
+    const float t270 = t187 - t264;
+    const float t489 = 0.195090322f * t396;
+    const float t491 = 0.980785280f * t397;
+    const float t492 = t489 - t491;
+    const float t500 = 0.555570233f * t461;
+    const float t502 = 0.831469612f * t462;
+    const float t503 = t500 - t502;
+    const float t506 = t492 + t503;
+    const float t512 = t270 - t506;
+    const float t1151 = 0.098017140f * t858;
+    const float t1153 = 0.995184727f * t859;
+    const float t1154 = t1151 - t1153;
+    const float t1162 = 0.290284677f * t1063;
+    const float t1164 = 0.956940336f * t1064;
+    const float t1165 = t1162 - t1164;
+    const float t1168 = t1154 + t1165;
+    const float t1174 = t512 - t1168;
+    const float t139 = t129 - t133;
+    const float t157 = t147 - t151;
+    const float t163 = t139 + t157;
+    const float t205 = t195 - t199;
+    const float t206 = t196 - t200;
+    const float t278 = t205 + t206;
+    const float t279 = 0.707106781f * t278;
+    const float t222 = t212 - t216;
+    const float t223 = t213 - t217;
+    const float t284 = t222 - t223;
+    const float t285 = 0.707106781f * t284;
+    const float t290 = t279 - t285;
+    const float t296 = t163 + t290;
+    const float t350 = t340 - t344;
+    const float t368 = t358 - t362;
+    const float t374 = t350 + t368;
+    const float t520 = 0.923879533f * t374;
+    const float t351 = t341 - t345;
+    const float t367 = t357 - t361;
+    const float t375 = t351 - t367;
+    const float t521 = 0.382683432f * t375;
+    const float t523 = t520 + t521;
+    const float t415 = t405 - t409;
+    const float t433 = t423 - t427;
+    const float t439 = t415 + t433;
+    const float t529 = 0.382683432f * t439;
+    const float t416 = t406 - t410;
+    const float t432 = t422 - t426;
+    const float t440 = t416 - t432;
+    const float t530 = 0.923879533f * t440;
+    const float t532 = t529 + t530;
+    const float t538 = t523 + t532;
+    const float t544 = t296 + t538;
+    const float t732 = t722 - t726;
+    const float t750 = t740 - t744;
+    const float t756 = t732 + t750;
+    const float t797 = t787 - t791;
+    const float t798 = t788 - t792;
+    const float t867 = t797 + t798;
+    const float t868 = 0.707106781f * t867;
+    const float t814 = t804 - t808;
+    const float t815 = t805 - t809;
+    const float t873 = t814 - t815;
+    const float t874 = 0.707106781f * t873;
+    const float t879 = t868 - t874;
+    const float t885 = t756 + t879;
+    const float t1182 = 0.980785280f * t885;
+    const float t733 = t723 - t727;
+    const float t749 = t739 - t743;
+    const float t757 = t733 - t749;
+    const float t869 = t797 - t798;
+    const float t871 = 0.707106781f * t869;
+    const float t876 = t814 + t815;
+    const float t877 = 0.707106781f * t876;
+    const float t880 = t871 + t877;
+    const float t886 = t757 - t880;
+    const float t1183 = 0.195090322f * t886;
+    const float t1185 = t1182 + t1183;
+    const float t937 = t927 - t931;
+    const float t955 = t945 - t949;
+    const float t961 = t937 + t955;
+    const float t1002 = t992 - t996;
+    const float t1003 = t993 - t997;
+    const float t1072 = t1002 + t1003;
+    const float t1073 = 0.707106781f * t1072;
+    const float t1019 = t1009 - t1013;
+    const float t1020 = t1010 - t1014;
+    const float t1078 = t1019 - t1020;
+    const float t1079 = 0.707106781f * t1078;
+    const float t1084 = t1073 - t1079;
+    const float t1090 = t961 + t1084;
+    const float t1191 = 0.831469612f * t1090;
+    const float t938 = t928 - t932;
+    const float t954 = t944 - t948;
+    const float t962 = t938 - t954;
+    const float t1074 = t1002 - t1003;
+    const float t1076 = 0.707106781f * t1074;
+    const float t1081 = t1019 + t1020;
+    const float t1082 = 0.707106781f * t1081;
+    const float t1085 = t1076 + t1082;
+    const float t1091 = t962 - t1085;
+    const float t1192 = 0.555570233f * t1091;
+    const float t1194 = t1191 + t1192;
+    const float t1200 = t1185 + t1194;
+    const float t1206 = t544 + t1200;
+    const float t140 = t130 - t134;
+    const float t156 = t146 - t150;
+    const float t164 = t140 - t156;
+    const float t280 = t205 - t206;
+    const float t282 = 0.707106781f * t280;
+    const float t287 = t222 + t223;
+    const float t288 = 0.707106781f * t287;
+    const float t291 = t282 + t288;
+    const float t297 = t164 - t291;
+    const float t524 = 0.382683432f * t374;
+    const float t526 = 0.923879533f * t375;
+    const float t527 = t524 - t526;
+    const float t533 = 0.923879533f * t439;
+    const float t535 = 0.382683432f * t440;
+    const float t536 = t533 - t535;
+    const float t539 = t527 + t536;
+    const float t545 = t297 - t539;
+    const float t1186 = 0.195090322f * t885;
+    const float t1188 = 0.980785280f * t886;
+    const float t1189 = t1186 - t1188;
+    const float t1195 = 0.555570233f * t1090;
+    const float t1197 = 0.831469612f * t1091;
+    const float t1198 = t1195 - t1197;
+    const float t1201 = t1189 + t1198;
+    const float t1207 = t545 - t1201;
+    const float t144 = t131 - t136;
+    const float t184 = t172 - t178;
+    const float t191 = t144 - t184;
+    const float t210 = t197 - t202;
+    const float t305 = 0.382683432f * t210;
+    const float t211 = t198 + t201;
+    const float t306 = 0.923879533f * t211;
+    const float t308 = t305 + t306;
+    const float t227 = t214 - t219;
+    const float t315 = 0.923879533f * t227;
+    const float t228 = t215 + t218;
+    const float t318 = 0.382683432f * t228;
+    const float t319 = t315 + t318;
+    const float t325 = t308 - t319;
+    const float t331 = t191 + t325;
+    const float t355 = t342 - t347;
+    const float t394 = t382 - t388;
+    const float t401 = t355 - t394;
+    const float t553 = 0.831469612f * t401;
+    const float t356 = t343 + t346;
+    const float t393 = t379 + t385;
+    const float t402 = t356 - t393;
+    const float t554 = 0.555570233f * t402;
+    const float t556 = t553 + t554;
+    const float t420 = t407 - t412;
+    const float t459 = t447 - t453;
+    const float t466 = t420 - t459;
+    const float t563 = 0.195090322f * t466;
+    const float t421 = t408 + t411;
+    const float t458 = t444 + t450;
+    const float t467 = t421 - t458;
+    const float t565 = 0.980785280f * t467;
+    const float t567 = t563 - t565;
+    const float t575 = t556 - t567;
+    const float t581 = t331 + t575;
+    const float t737 = t724 - t729;
+    const float t776 = t764 - t770;
+    const float t783 = t737 - t776;
+    const float t802 = t789 - t794;
+    const float t894 = 0.382683432f * t802;
+    const float t803 = t790 + t793;
+    const float t895 = 0.923879533f * t803;
+    const float t897 = t894 + t895;
+    const float t819 = t806 - t811;
+    const float t903 = 0.923879533f * t819;
+    const float t820 = t807 + t810;
+    const float t905 = 0.382683432f * t820;
+    const float t906 = t903 + t905;
+    const float t912 = t897 - t906;
+    const float t918 = t783 + t912;
+    const float t1215 = 0.956940336f * t918;
+    const float t738 = t725 + t728;
+    const float t775 = t761 + t767;
+    const float t784 = t738 - t775;
+    const float t898 = 0.923879533f * t802;
+    const float t900 = 0.382683432f * t803;
+    const float t901 = t898 - t900;
+    const float t908 = 0.382683432f * t819;
+    const float t909 = 0.923879533f * t820;
+    const float t911 = t908 - t909;
+    const float t913 = t901 - t911;
+    const float t919 = t784 - t913;
+    const float t1216 = 0.290284677f * t919;
+    const float t1218 = t1215 + t1216;
+    const float t942 = t929 - t934;
+    const float t981 = t969 - t975;
+    const float t988 = t942 - t981;
+    const float t1007 = t994 - t999;
+    const float t1099 = 0.382683432f * t1007;
+    const float t1008 = t995 + t998;
+    const float t1100 = 0.923879533f * t1008;
+    const float t1102 = t1099 + t1100;
+    const float t1024 = t1011 - t1016;
+    const float t1108 = 0.923879533f * t1024;
+    const float t1025 = t1012 + t1015;
+    const float t1110 = 0.382683432f * t1025;
+    const float t1111 = t1108 + t1110;
+    const float t1117 = t1102 - t1111;
+    const float t1123 = t988 + t1117;
+    const float t1225 = 0.634393284f * t1123;
+    const float t943 = t930 + t933;
+    const float t980 = t966 + t972;
+    const float t989 = t943 - t980;
+    const float t1103 = 0.923879533f * t1007;
+    const float t1105 = 0.382683432f * t1008;
+    const float t1106 = t1103 - t1105;
+    const float t1113 = 0.382683432f * t1024;
+    const float t1114 = 0.923879533f * t1025;
+    const float t1116 = t1113 - t1114;
+    const float t1118 = t1106 - t1116;
+    const float t1124 = t989 - t1118;
+    const float t1227 = 0.773010453f * t1124;
+    const float t1229 = t1225 + t1227;
+    const float t1235 = t1218 + t1229;
+    const float t1241 = t581 + t1235;
+    const float t145 = t132 + t135;
+    const float t183 = t169 + t175;
+    const float t192 = t145 - t183;
+    const float t309 = 0.923879533f * t210;
+    const float t311 = 0.382683432f * t211;
+    const float t312 = t309 - t311;
+    const float t321 = 0.382683432f * t227;
+    const float t322 = 0.923879533f * t228;
+    const float t324 = t321 - t322;
+    const float t326 = t312 - t324;
+    const float t332 = t192 - t326;
+    const float t557 = 0.555570233f * t401;
+    const float t559 = 0.831469612f * t402;
+    const float t560 = t557 - t559;
+    const float t569 = 0.980785280f * t466;
+    const float t571 = 0.195090322f * t467;
+    const float t573 = t569 + t571;
+    const float t576 = t560 + t573;
+    const float t582 = t332 - t576;
+    const float t1219 = 0.290284677f * t918;
+    const float t1221 = 0.956940336f * t919;
+    const float t1222 = t1219 - t1221;
+    const float t1230 = 0.773010453f * t1123;
+    const float t1232 = 0.634393284f * t1124;
+    const float t1233 = t1230 - t1232;
+    const float t1236 = t1222 + t1233;
+    const float t1242 = t582 - t1236;
+    const float t160 = t137 - t154;
+    const float t232 = t204 - t221;
+    const float t238 = t160 + t232;
+    const float t371 = t348 - t365;
+    const float t372 = t349 - t366;
+    const float t590 = t371 + t372;
+    const float t591 = 0.707106781f * t590;
+    const float t436 = t413 - t430;
+    const float t437 = t414 - t431;
+    const float t596 = t436 - t437;
+    const float t597 = 0.707106781f * t596;
+    const float t602 = t591 - t597;
+    const float t608 = t238 + t602;
+    const float t753 = t730 - t747;
+    const float t824 = t796 - t813;
+    const float t830 = t753 + t824;
+    const float t1250 = 0.923879533f * t830;
+    const float t754 = t731 - t748;
+    const float t823 = t795 - t812;
+    const float t831 = t754 - t823;
+    const float t1251 = 0.382683432f * t831;
+    const float t1253 = t1250 + t1251;
+    const float t958 = t935 - t952;
+    const float t1029 = t1001 - t1018;
+    const float t1035 = t958 + t1029;
+    const float t1259 = 0.382683432f * t1035;
+    const float t959 = t936 - t953;
+    const float t1028 = t1000 - t1017;
+    const float t1036 = t959 - t1028;
+    const float t1260 = 0.923879533f * t1036;
+    const float t1262 = t1259 + t1260;
+    const float t1268 = t1253 + t1262;
+    const float t1274 = t608 + t1268;
+    const float t161 = t138 - t155;
+    const float t231 = t203 - t220;
+    const float t239 = t161 - t231;
+    const float t592 = t371 - t372;
+    const float t594 = 0.707106781f * t592;
+    const float t599 = t436 + t437;
+    const float t600 = 0.707106781f * t599;
+    const float t603 = t594 + t600;
+    const float t609 = t239 - t603;
+    const float t1254 = 0.382683432f * t830;
+    const float t1256 = 0.923879533f * t831;
+    const float t1257 = t1254 - t1256;
+    const float t1263 = 0.923879533f * t1035;
+    const float t1265 = 0.382683432f * t1036;
+    const float t1266 = t1263 - t1265;
+    const float t1269 = t1257 + t1266;
+    const float t1275 = t609 - t1269;
+    const float t188 = t142 - t180;
+    const float t267 = t251 - t261;
+    const float t274 = t188 - t267;
+    const float t398 = t353 - t390;
+    const float t618 = 0.555570233f * t398;
+    const float t399 = t354 + t391;
+    const float t619 = 0.831469612f * t399;
+    const float t621 = t618 + t619;
+    const float t463 = t418 - t455;
+    const float t627 = 0.980785280f * t463;
+    const float t464 = t419 + t456;
+    const float t630 = 0.195090322f * t464;
+    const float t632 = t627 - t630;
+    const float t640 = t621 - t632;
+    const float t646 = t274 + t640;
+    const float t780 = t735 - t772;
+    const float t856 = t841 - t850;
+    const float t863 = t780 - t856;
+    const float t1284 = 0.881921264f * t863;
+    const float t781 = t736 + t773;
+    const float t855 = t837 - t846;
+    const float t864 = t781 - t855;
+    const float t1286 = 0.471396737f * t864;
+    const float t1288 = t1284 + t1286;
+    const float t985 = t940 - t977;
+    const float t1061 = t1046 - t1055;
+    const float t1068 = t985 - t1061;
+    const float t1295 = 0.098017140f * t1068;
+    const float t986 = t941 + t978;
+    const float t1060 = t1042 - t1051;
+    const float t1069 = t986 - t1060;
+    const float t1297 = 0.995184727f * t1069;
+    const float t1299 = t1295 + t1297;
+    const float t1305 = t1288 + t1299;
+    const float t1311 = t646 + t1305;
+    const float t189 = t143 + t181;
+    const float t266 = t247 - t257;
+    const float t275 = t189 - t266;
+    const float t622 = 0.831469612f * t398;
+    const float t624 = 0.555570233f * t399;
+    const float t625 = t622 - t624;
+    const float t634 = 0.195090322f * t463;
+    const float t636 = 0.980785280f * t464;
+    const float t638 = t634 + t636;
+    const float t641 = t625 + t638;
+    const float t647 = t275 - t641;
+    const float t1289 = 0.471396737f * t863;
+    const float t1291 = 0.881921264f * t864;
+    const float t1292 = t1289 - t1291;
+    const float t1300 = 0.995184727f * t1068;
+    const float t1302 = 0.098017140f * t1069;
+    const float t1303 = t1300 - t1302;
+    const float t1306 = t1292 + t1303;
+    const float t1312 = t647 - t1306;
+    const float t165 = t139 - t157;
+    const float t294 = t282 - t288;
+    const float t301 = t165 - t294;
+    const float t376 = t350 - t368;
+    const float t655 = 0.382683432f * t376;
+    const float t377 = t351 + t367;
+    const float t656 = 0.923879533f * t377;
+    const float t658 = t655 + t656;
+    const float t441 = t415 - t433;
+    const float t664 = 0.923879533f * t441;
+    const float t442 = t416 + t432;
+    const float t666 = 0.382683432f * t442;
+    const float t667 = t664 + t666;
+    const float t673 = t658 - t667;
+    const float t679 = t301 + t673;
+    const float t758 = t732 - t750;
+    const float t883 = t871 - t877;
+    const float t890 = t758 - t883;
+    const float t1320 = 0.831469612f * t890;
+    const float t759 = t733 + t749;
+    const float t882 = t868 + t874;
+    const float t891 = t759 - t882;
+    const float t1321 = 0.555570233f * t891;
+    const float t1323 = t1320 + t1321;
+    const float t963 = t937 - t955;
+    const float t1088 = t1076 - t1082;
+    const float t1095 = t963 - t1088;
+    const float t1329 = 0.195090322f * t1095;
+    const float t964 = t938 + t954;
+    const float t1087 = t1073 + t1079;
+    const float t1096 = t964 - t1087;
+    const float t1331 = 0.980785280f * t1096;
+    const float t1333 = t1329 - t1331;
+    const float t1341 = t1323 - t1333;
+    const float t1347 = t679 + t1341;
+    const float t166 = t140 + t156;
+    const float t293 = t279 + t285;
+    const float t302 = t166 - t293;
+    const float t659 = 0.923879533f * t376;
+    const float t661 = 0.382683432f * t377;
+    const float t662 = t659 - t661;
+    const float t669 = 0.382683432f * t441;
+    const float t670 = 0.923879533f * t442;
+    const float t672 = t669 - t670;
+    const float t674 = t662 - t672;
+    const float t680 = t302 - t674;
+    const float t1324 = 0.555570233f * t890;
+    const float t1326 = 0.831469612f * t891;
+    const float t1327 = t1324 - t1326;
+    const float t1335 = 0.980785280f * t1095;
+    const float t1337 = 0.195090322f * t1096;
+    const float t1339 = t1335 + t1337;
+    const float t1342 = t1327 + t1339;
+    const float t1348 = t680 - t1342;
+    const float t193 = t144 + t184;
+    const float t329 = t312 + t324;
+    const float t336 = t193 - t329;
+    const float t403 = t355 + t394;
+    const float t689 = 0.195090322f * t403;
+    const float t404 = t356 + t393;
+    const float t690 = 0.980785280f * t404;
+    const float t692 = t689 + t690;
+    const float t468 = t420 + t459;
+    const float t698 = 0.555570233f * t468;
+    const float t469 = t421 + t458;
+    const float t700 = 0.831469612f * t469;
+    const float t701 = t698 + t700;
+    const float t707 = t692 - t701;
+    const float t713 = t336 + t707;
+    const float t785 = t737 + t776;
+    const float t916 = t901 + t911;
+    const float t923 = t785 - t916;
+    const float t1356 = 0.773010453f * t923;
+    const float t786 = t738 + t775;
+    const float t915 = t897 + t906;
+    const float t924 = t786 - t915;
+    const float t1357 = 0.634393284f * t924;
+    const float t1359 = t1356 + t1357;
+    const float t990 = t942 + t981;
+    const float t1121 = t1106 + t1116;
+    const float t1128 = t990 - t1121;
+    const float t1366 = 0.471396737f * t1128;
+    const float t991 = t943 + t980;
+    const float t1120 = t1102 + t1111;
+    const float t1129 = t991 - t1120;
+    const float t1368 = 0.881921264f * t1129;
+    const float t1370 = t1366 - t1368;
+    const float t1378 = t1359 - t1370;
+    const float t1384 = t713 + t1378;
+    const float t194 = t145 + t183;
+    const float t328 = t308 + t319;
+    const float t337 = t194 - t328;
+    const float t693 = 0.980785280f * t403;
+    const float t695 = 0.195090322f * t404;
+    const float t696 = t693 - t695;
+    const float t703 = 0.831469612f * t468;
+    const float t704 = 0.555570233f * t469;
+    const float t706 = t703 - t704;
+    const float t708 = t696 - t706;
+    const float t714 = t337 - t708;
+    const float t1360 = 0.634393284f * t923;
+    const float t1362 = 0.773010453f * t924;
+    const float t1363 = t1360 - t1362;
+    const float t1372 = 0.881921264f * t1128;
+    const float t1374 = 0.471396737f * t1129;
+    const float t1376 = t1372 + t1374;
+    const float t1379 = t1363 + t1376;
+    const float t1385 = t714 - t1379;
+    const float t235 = t158 - t229;
+    const float t473 = t370 - t435;
+    const float t479 = t235 + t473;
+    const float t827 = t751 - t821;
+    const float t828 = t752 - t822;
+    const float t1393 = t827 + t828;
+    const float t1394 = 0.707106781f * t1393;
+    const float t1032 = t956 - t1026;
+    const float t1033 = t957 - t1027;
+    const float t1399 = t1032 - t1033;
+    const float t1400 = 0.707106781f * t1399;
+    const float t1405 = t1394 - t1400;
+    const float t1411 = t479 + t1405;
+    const float t236 = t159 - t230;
+    const float t472 = t369 - t434;
+    const float t480 = t236 - t472;
+    const float t1395 = t827 - t828;
+    const float t1397 = 0.707106781f * t1395;
+    const float t1402 = t1032 + t1033;
+    const float t1403 = 0.707106781f * t1402;
+    const float t1406 = t1397 + t1403;
+    const float t1412 = t480 - t1406;
+    const float t271 = t186 - t263;
+    const float t509 = t492 - t503;
+    const float t516 = t271 - t509;
+    const float t860 = t778 - t852;
+    const float t1420 = 0.634393284f * t860;
+    const float t861 = t779 + t853;
+    const float t1421 = 0.773010453f * t861;
+    const float t1423 = t1420 + t1421;
+    const float t1065 = t983 - t1057;
+    const float t1430 = 0.881921264f * t1065;
+    const float t1066 = t984 + t1058;
+    const float t1433 = 0.471396737f * t1066;
+    const float t1435 = t1430 - t1433;
+    const float t1443 = t1423 - t1435;
+    const float t1449 = t516 + t1443;
+    const float t272 = t187 + t264;
+    const float t508 = t488 - t499;
+    const float t517 = t272 - t508;
+    const float t1424 = 0.773010453f * t860;
+    const float t1426 = 0.634393284f * t861;
+    const float t1427 = t1424 - t1426;
+    const float t1437 = 0.471396737f * t1065;
+    const float t1439 = 0.881921264f * t1066;
+    const float t1441 = t1437 + t1439;
+    const float t1444 = t1427 + t1441;
+    const float t1450 = t517 - t1444;
+    const float t298 = t163 - t290;
+    const float t542 = t527 - t536;
+    const float t549 = t298 - t542;
+    const float t887 = t756 - t879;
+    const float t1458 = 0.555570233f * t887;
+    const float t888 = t757 + t880;
+    const float t1459 = 0.831469612f * t888;
+    const float t1461 = t1458 + t1459;
+    const float t1092 = t961 - t1084;
+    const float t1467 = 0.980785280f * t1092;
+    const float t1093 = t962 + t1085;
+    const float t1469 = 0.195090322f * t1093;
+    const float t1471 = t1467 - t1469;
+    const float t1479 = t1461 - t1471;
+    const float t1485 = t549 + t1479;
+    const float t299 = t164 + t291;
+    const float t541 = t523 - t532;
+    const float t550 = t299 - t541;
+    const float t1462 = 0.831469612f * t887;
+    const float t1464 = 0.555570233f * t888;
+    const float t1465 = t1462 - t1464;
+    const float t1473 = 0.195090322f * t1092;
+    const float t1475 = 0.980785280f * t1093;
+    const float t1477 = t1473 + t1475;
+    const float t1480 = t1465 + t1477;
+    const float t1486 = t550 - t1480;
+    const float t333 = t191 - t325;
+    const float t579 = t560 - t573;
+    const float t586 = t333 - t579;
+    const float t920 = t783 - t912;
+    const float t1495 = 0.471396737f * t920;
+    const float t921 = t784 + t913;
+    const float t1496 = 0.881921264f * t921;
+    const float t1498 = t1495 + t1496;
+    const float t1125 = t988 - t1117;
+    const float t1504 = 0.995184727f * t1125;
+    const float t1126 = t989 + t1118;
+    const float t1507 = 0.098017140f * t1126;
+    const float t1508 = t1504 + t1507;
+    const float t1514 = t1498 - t1508;
+    const float t1520 = t586 + t1514;
+    const float t334 = t192 + t326;
+    const float t578 = t556 + t567;
+    const float t587 = t334 - t578;
+    const float t1499 = 0.881921264f * t920;
+    const float t1501 = 0.471396737f * t921;
+    const float t1502 = t1499 - t1501;
+    const float t1510 = 0.098017140f * t1125;
+    const float t1511 = 0.995184727f * t1126;
+    const float t1513 = t1510 - t1511;
+    const float t1515 = t1502 - t1513;
+    const float t1521 = t587 - t1515;
+    const float t240 = t160 - t232;
+    const float t606 = t594 - t600;
+    const float t613 = t240 - t606;
+    const float t832 = t753 - t824;
+    const float t1529 = 0.382683432f * t832;
+    const float t833 = t754 + t823;
+    const float t1530 = 0.923879533f * t833;
+    const float t1532 = t1529 + t1530;
+    const float t1037 = t958 - t1029;
+    const float t1538 = 0.923879533f * t1037;
+    const float t1038 = t959 + t1028;
+    const float t1540 = 0.382683432f * t1038;
+    const float t1541 = t1538 + t1540;
+    const float t1547 = t1532 - t1541;
+    const float t1553 = t613 + t1547;
+    const float t241 = t161 + t231;
+    const float t605 = t591 + t597;
+    const float t614 = t241 - t605;
+    const float t1533 = 0.923879533f * t832;
+    const float t1535 = 0.382683432f * t833;
+    const float t1536 = t1533 - t1535;
+    const float t1543 = 0.382683432f * t1037;
+    const float t1544 = 0.923879533f * t1038;
+    const float t1546 = t1543 - t1544;
+    const float t1548 = t1536 - t1546;
+    const float t1554 = t614 - t1548;
+    const float t276 = t188 + t267;
+    const float t644 = t625 - t638;
+    const float t651 = t276 - t644;
+    const float t865 = t780 + t856;
+    const float t1562 = 0.290284677f * t865;
+    const float t866 = t781 + t855;
+    const float t1564 = 0.956940336f * t866;
+    const float t1566 = t1562 + t1564;
+    const float t1070 = t985 + t1061;
+    const float t1573 = 0.773010453f * t1070;
+    const float t1071 = t986 + t1060;
+    const float t1576 = 0.634393284f * t1071;
+    const float t1577 = t1573 + t1576;
+    const float t1583 = t1566 - t1577;
+    const float t1589 = t651 + t1583;
+    const float t277 = t189 + t266;
+    const float t643 = t621 + t632;
+    const float t652 = t277 - t643;
+    const float t1567 = 0.956940336f * t865;
+    const float t1569 = 0.290284677f * t866;
+    const float t1570 = t1567 - t1569;
+    const float t1579 = 0.634393284f * t1070;
+    const float t1580 = 0.773010453f * t1071;
+    const float t1582 = t1579 - t1580;
+    const float t1584 = t1570 - t1582;
+    const float t1590 = t652 - t1584;
+    const float t303 = t165 + t294;
+    const float t677 = t662 + t672;
+    const float t684 = t303 - t677;
+    const float t892 = t758 + t883;
+    const float t1598 = 0.195090322f * t892;
+    const float t893 = t759 + t882;
+    const float t1599 = 0.980785280f * t893;
+    const float t1601 = t1598 + t1599;
+    const float t1097 = t963 + t1088;
+    const float t1607 = 0.555570233f * t1097;
+    const float t1098 = t964 + t1087;
+    const float t1609 = 0.831469612f * t1098;
+    const float t1610 = t1607 + t1609;
+    const float t1616 = t1601 - t1610;
+    const float t1622 = t684 + t1616;
+    const float t304 = t166 + t293;
+    const float t676 = t658 + t667;
+    const float t685 = t304 - t676;
+    const float t1602 = 0.980785280f * t892;
+    const float t1604 = 0.195090322f * t893;
+    const float t1605 = t1602 - t1604;
+    const float t1612 = 0.831469612f * t1097;
+    const float t1613 = 0.555570233f * t1098;
+    const float t1615 = t1612 - t1613;
+    const float t1617 = t1605 - t1615;
+    const float t1623 = t685 - t1617;
+    const float t338 = t193 + t329;
+    const float t711 = t696 + t706;
+    const float t718 = t338 - t711;
+    const float t925 = t785 + t916;
+    const float t1631 = 0.098017140f * t925;
+    const float t926 = t786 + t915;
+    const float t1632 = 0.995184727f * t926;
+    const float t1634 = t1631 + t1632;
+    const float t1130 = t990 + t1121;
+    const float t1641 = 0.290284677f * t1130;
+    const float t1131 = t991 + t1120;
+    const float t1643 = 0.956940336f * t1131;
+    const float t1644 = t1641 + t1643;
+    const float t1650 = t1634 - t1644;
+    const float t1656 = t718 + t1650;
+    const float t339 = t194 + t328;
+    const float t710 = t692 + t701;
+    const float t719 = t339 - t710;
+    const float t1635 = 0.995184727f * t925;
+    const float t1637 = 0.098017140f * t926;
+    const float t1638 = t1635 - t1637;
+    const float t1646 = 0.956940336f * t1130;
+    const float t1647 = 0.290284677f * t1131;
+    const float t1649 = t1646 - t1647;
+    const float t1651 = t1638 - t1649;
+    const float t1657 = t719 - t1651;
+    const float t476 = t233 - t470;
+    const float t1135 = t826 - t1031;
+    const float t1141 = t476 + t1135;
+    const float t477 = t234 - t471;
+    const float t1134 = t825 - t1030;
+    const float t1142 = t477 - t1134;
+    const float t513 = t269 - t505;
+    const float t1171 = t1154 - t1165;
+    const float t1178 = t513 - t1171;
+    const float t514 = t270 + t506;
+    const float t1170 = t1150 - t1161;
+    const float t1179 = t514 - t1170;
+    const float t546 = t296 - t538;
+    const float t1204 = t1189 - t1198;
+    const float t1211 = t546 - t1204;
+    const float t547 = t297 + t539;
+    const float t1203 = t1185 - t1194;
+    const float t1212 = t547 - t1203;
+    const float t583 = t331 - t575;
+    const float t1239 = t1222 - t1233;
+    const float t1246 = t583 - t1239;
+    const float t584 = t332 + t576;
+    const float t1238 = t1218 - t1229;
+    const float t1247 = t584 - t1238;
+    const float t610 = t238 - t602;
+    const float t1272 = t1257 - t1266;
+    const float t1279 = t610 - t1272;
+    const float t611 = t239 + t603;
+    const float t1271 = t1253 - t1262;
+    const float t1280 = t611 - t1271;
+    const float t648 = t274 - t640;
+    const float t1309 = t1292 - t1303;
+    const float t1316 = t648 - t1309;
+    const float t649 = t275 + t641;
+    const float t1308 = t1288 - t1299;
+    const float t1317 = t649 - t1308;
+    const float t681 = t301 - t673;
+    const float t1345 = t1327 - t1339;
+    const float t1352 = t681 - t1345;
+    const float t682 = t302 + t674;
+    const float t1344 = t1323 + t1333;
+    const float t1353 = t682 - t1344;
+    const float t715 = t336 - t707;
+    const float t1382 = t1363 - t1376;
+    const float t1389 = t715 - t1382;
+    const float t716 = t337 + t708;
+    const float t1381 = t1359 + t1370;
+    const float t1390 = t716 - t1381;
+    const float t481 = t235 - t473;
+    const float t1409 = t1397 - t1403;
+    const float t1416 = t481 - t1409;
+    const float t482 = t236 + t472;
+    const float t1408 = t1394 + t1400;
+    const float t1417 = t482 - t1408;
+    const float t518 = t271 + t509;
+    const float t1447 = t1427 - t1441;
+    const float t1454 = t518 - t1447;
+    const float t519 = t272 + t508;
+    const float t1446 = t1423 + t1435;
+    const float t1455 = t519 - t1446;
+    const float t551 = t298 + t542;
+    const float t1483 = t1465 - t1477;
+    const float t1490 = t551 - t1483;
+    const float t552 = t299 + t541;
+    const float t1482 = t1461 + t1471;
+    const float t1491 = t552 - t1482;
+    const float t588 = t333 + t579;
+    const float t1518 = t1502 + t1513;
+    const float t1525 = t588 - t1518;
+    const float t589 = t334 + t578;
+    const float t1517 = t1498 + t1508;
+    const float t1526 = t589 - t1517;
+    const float t615 = t240 + t606;
+    const float t1551 = t1536 + t1546;
+    const float t1558 = t615 - t1551;
+    const float t616 = t241 + t605;
+    const float t1550 = t1532 + t1541;
+    const float t1559 = t616 - t1550;
+    const float t653 = t276 + t644;
+    const float t1587 = t1570 + t1582;
+    const float t1594 = t653 - t1587;
+    const float t654 = t277 + t643;
+    const float t1586 = t1566 + t1577;
+    const float t1595 = t654 - t1586;
+    const float t686 = t303 + t677;
+    const float t1620 = t1605 + t1615;
+    const float t1627 = t686 - t1620;
+    const float t687 = t304 + t676;
+    const float t1619 = t1601 + t1610;
+    const float t1628 = t687 - t1619;
+    const float t720 = t338 + t711;
+    const float t1654 = t1638 + t1649;
+    const float t1661 = t720 - t1654;
+    const float t721 = t339 + t710;
+    const float t1653 = t1634 + t1644;
+    const float t1662 = t721 - t1653;
+    const float t1138 = t474 - t1132;
+    const float t1139 = t475 - t1133;
+    const float t1175 = t511 - t1167;
+    const float t1176 = t512 + t1168;
+    const float t1208 = t544 - t1200;
+    const float t1209 = t545 + t1201;
+    const float t1243 = t581 - t1235;
+    const float t1244 = t582 + t1236;
+    const float t1276 = t608 - t1268;
+    const float t1277 = t609 + t1269;
+    const float t1313 = t646 - t1305;
+    const float t1314 = t647 + t1306;
+    const float t1349 = t679 - t1341;
+    const float t1350 = t680 + t1342;
+    const float t1386 = t713 - t1378;
+    const float t1387 = t714 + t1379;
+    const float t1413 = t479 - t1405;
+    const float t1414 = t480 + t1406;
+    const float t1451 = t516 - t1443;
+    const float t1452 = t517 + t1444;
+    const float t1487 = t549 - t1479;
+    const float t1488 = t550 + t1480;
+    const float t1522 = t586 - t1514;
+    const float t1523 = t587 + t1515;
+    const float t1555 = t613 - t1547;
+    const float t1556 = t614 + t1548;
+    const float t1591 = t651 - t1583;
+    const float t1592 = t652 + t1584;
+    const float t1624 = t684 - t1616;
+    const float t1625 = t685 + t1617;
+    const float t1658 = t718 - t1650;
+    const float t1659 = t719 + t1651;
+    const float t1143 = t476 - t1135;
+    const float t1144 = t477 + t1134;
+    const float t1180 = t513 + t1171;
+    const float t1181 = t514 + t1170;
+    const float t1213 = t546 + t1204;
+    const float t1214 = t547 + t1203;
+    const float t1248 = t583 + t1239;
+    const float t1249 = t584 + t1238;
+    const float t1281 = t610 + t1272;
+    const float t1282 = t611 + t1271;
+    const float t1318 = t648 + t1309;
+    const float t1319 = t649 + t1308;
+    const float t1354 = t681 + t1345;
+    const float t1355 = t682 + t1344;
+    const float t1391 = t715 + t1382;
+    const float t1392 = t716 + t1381;
+    const float t1418 = t481 + t1409;
+    const float t1419 = t482 + t1408;
+    const float t1456 = t518 + t1447;
+    const float t1457 = t519 + t1446;
+    const float t1492 = t551 + t1483;
+    const float t1493 = t552 + t1482;
+    const float t1527 = t588 + t1518;
+    const float t1528 = t589 + t1517;
+    const float t1560 = t615 + t1551;
+    const float t1561 = t616 + t1550;
+    const float t1596 = t653 + t1587;
+    const float t1597 = t654 + t1586;
+    const float t1629 = t686 + t1620;
+    const float t1630 = t687 + t1619;
+    const float t1663 = t720 + t1654;
+    const float t1664 = t721 + t1653;
+    output[0].real = t1136;
+    output[0].imag = t1137;
+    output[1].real = t1173;
+    output[1].imag = t1174;
+    output[2].real = t1206;
+    output[2].imag = t1207;
+    output[3].real = t1241;
+    output[3].imag = t1242;
+    output[4].real = t1274;
+    output[4].imag = t1275;
+    output[5].real = t1311;
+    output[5].imag = t1312;
+    output[6].real = t1347;
+    output[6].imag = t1348;
+    output[7].real = t1384;
+    output[7].imag = t1385;
+    output[8].real = t1411;
+    output[8].imag = t1412;
+    output[9].real = t1449;
+    output[9].imag = t1450;
+    output[10].real = t1485;
+    output[10].imag = t1486;
+    output[11].real = t1520;
+    output[11].imag = t1521;
+    output[12].real = t1553;
+    output[12].imag = t1554;
+    output[13].real = t1589;
+    output[13].imag = t1590;
+    output[14].real = t1622;
+    output[14].imag = t1623;
+    output[15].real = t1656;
+    output[15].imag = t1657;
+    output[16].real = t1141;
+    output[16].imag = t1142;
+    output[17].real = t1178;
+    output[17].imag = t1179;
+    output[18].real = t1211;
+    output[18].imag = t1212;
+    output[19].real = t1246;
+    output[19].imag = t1247;
+    output[20].real = t1279;
+    output[20].imag = t1280;
+    output[21].real = t1316;
+    output[21].imag = t1317;
+    output[22].real = t1352;
+    output[22].imag = t1353;
+    output[23].real = t1389;
+    output[23].imag = t1390;
+    output[24].real = t1416;
+    output[24].imag = t1417;
+    output[25].real = t1454;
+    output[25].imag = t1455;
+    output[26].real = t1490;
+    output[26].imag = t1491;
+    output[27].real = t1525;
+    output[27].imag = t1526;
+    output[28].real = t1558;
+    output[28].imag = t1559;
+    output[29].real = t1594;
+    output[29].imag = t1595;
+    output[30].real = t1627;
+    output[30].imag = t1628;
+    output[31].real = t1661;
+    output[31].imag = t1662;
+    output[32].real = t1138;
+    output[32].imag = t1139;
+    output[33].real = t1175;
+    output[33].imag = t1176;
+    output[34].real = t1208;
+    output[34].imag = t1209;
+    output[35].real = t1243;
+    output[35].imag = t1244;
+    output[36].real = t1276;
+    output[36].imag = t1277;
+    output[37].real = t1313;
+    output[37].imag = t1314;
+    output[38].real = t1349;
+    output[38].imag = t1350;
+    output[39].real = t1386;
+    output[39].imag = t1387;
+    output[40].real = t1413;
+    output[40].imag = t1414;
+    output[41].real = t1451;
+    output[41].imag = t1452;
+    output[42].real = t1487;
+    output[42].imag = t1488;
+    output[43].real = t1522;
+    output[43].imag = t1523;
+    output[44].real = t1555;
+    output[44].imag = t1556;
+    output[45].real = t1591;
+    output[45].imag = t1592;
+    output[46].real = t1624;
+    output[46].imag = t1625;
+    output[47].real = t1658;
+    output[47].imag = t1659;
+    output[48].real = t1143;
+    output[48].imag = t1144;
+    output[49].real = t1180;
+    output[49].imag = t1181;
+    output[50].real = t1213;
+    output[50].imag = t1214;
+    output[51].real = t1248;
+    output[51].imag = t1249;
+    output[52].real = t1281;
+    output[52].imag = t1282;
+    output[53].real = t1318;
+    output[53].imag = t1319;
+    output[54].real = t1354;
+    output[54].imag = t1355;
+    output[55].real = t1391;
+    output[55].imag = t1392;
+    output[56].real = t1418;
+    output[56].imag = t1419;
+    output[57].real = t1456;
+    output[57].imag = t1457;
+    output[58].real = t1492;
+    output[58].imag = t1493;
+    output[59].real = t1527;
+    output[59].imag = t1528;
+    output[60].real = t1560;
+    output[60].imag = t1561;
+    output[61].real = t1596;
+    output[61].imag = t1597;
+    output[62].real = t1629;
+    output[62].imag = t1630;
+    output[63].real = t1663;
+    output[63].imag = t1664;
+}
+
+// 912 additions, 248 multiplications
+void codelet_64_inv(const CkFftComplex* input, CkFftComplex* output, CkFftSize stride)
+{
+    const CkFftComplex* in0 = input + 0*stride;
+    const float x0r = in0->real;
+    const CkFftComplex* in32 = input + 32*stride;
+    const float x32r = in32->real;
+    const float t129 = x0r + x32r;
+    const CkFftComplex* in16 = input + 16*stride;
+    const float x16r = in16->real;
+    const CkFftComplex* in48 = input + 48*stride;
+    const float x48r = in48->real;
+    const float t133 = x16r + x48r;
+    const float t137 = t129 + t133;
+    const CkFftComplex* in8 = input + 8*stride;
+    const float x8r = in8->real;
+    const CkFftComplex* in40 = input + 40*stride;
+    const float x40r = in40->real;
+    const float t146 = x8r + x40r;
+    const CkFftComplex* in24 = input + 24*stride;
+    const float x24r = in24->real;
+    const CkFftComplex* in56 = input + 56*stride;
+    const float x56r = in56->real;
+    const float t150 = x24r + x56r;
+    const float t154 = t146 + t150;
+    const float t158 = t137 + t154;
+    const CkFftComplex* in4 = input + 4*stride;
+    const float x4r = in4->real;
+    const CkFftComplex* in36 = input + 36*stride;
+    const float x36r = in36->real;
+    const float t192 = x4r + x36r;
+    const CkFftComplex* in20 = input + 20*stride;
+    const float x20r = in20->real;
+    const CkFftComplex* in52 = input + 52*stride;
+    const float x52r = in52->real;
+    const float t196 = x20r + x52r;
+    const float t200 = t192 + t196;
+    const CkFftComplex* in12 = input + 12*stride;
+    const float x12r = in12->real;
+    const CkFftComplex* in44 = input + 44*stride;
+    const float x44r = in44->real;
+    const float t209 = x12r + x44r;
+    const CkFftComplex* in28 = input + 28*stride;
+    const float x28r = in28->real;
+    const CkFftComplex* in60 = input + 60*stride;
+    const float x60r = in60->real;
+    const float t213 = x28r + x60r;
+    const float t217 = t209 + t213;
+    const float t226 = t200 + t217;
+    const float t230 = t158 + t226;
+    const CkFftComplex* in2 = input + 2*stride;
+    const float x2r = in2->real;
+    const CkFftComplex* in34 = input + 34*stride;
+    const float x34r = in34->real;
+    const float t324 = x2r + x34r;
+    const CkFftComplex* in18 = input + 18*stride;
+    const float x18r = in18->real;
+    const CkFftComplex* in50 = input + 50*stride;
+    const float x50r = in50->real;
+    const float t328 = x18r + x50r;
+    const float t332 = t324 + t328;
+    const CkFftComplex* in10 = input + 10*stride;
+    const float x10r = in10->real;
+    const CkFftComplex* in42 = input + 42*stride;
+    const float x42r = in42->real;
+    const float t341 = x10r + x42r;
+    const CkFftComplex* in26 = input + 26*stride;
+    const float x26r = in26->real;
+    const CkFftComplex* in58 = input + 58*stride;
+    const float x58r = in58->real;
+    const float t345 = x26r + x58r;
+    const float t349 = t341 + t345;
+    const float t353 = t332 + t349;
+    const CkFftComplex* in6 = input + 6*stride;
+    const float x6r = in6->real;
+    const CkFftComplex* in38 = input + 38*stride;
+    const float x38r = in38->real;
+    const float t386 = x6r + x38r;
+    const CkFftComplex* in22 = input + 22*stride;
+    const float x22r = in22->real;
+    const CkFftComplex* in54 = input + 54*stride;
+    const float x54r = in54->real;
+    const float t390 = x22r + x54r;
+    const float t394 = t386 + t390;
+    const CkFftComplex* in14 = input + 14*stride;
+    const float x14r = in14->real;
+    const CkFftComplex* in46 = input + 46*stride;
+    const float x46r = in46->real;
+    const float t403 = x14r + x46r;
+    const CkFftComplex* in30 = input + 30*stride;
+    const float x30r = in30->real;
+    const CkFftComplex* in62 = input + 62*stride;
+    const float x62r = in62->real;
+    const float t407 = x30r + x62r;
+    const float t411 = t403 + t407;
+    const float t415 = t394 + t411;
+    const float t448 = t353 + t415;
+    const float t452 = t230 + t448;
+    const CkFftComplex* in1 = input + 1*stride;
+    const float x1r = in1->real;
+    const CkFftComplex* in33 = input + 33*stride;
+    const float x33r = in33->real;
+    const float t661 = x1r + x33r;
+    const CkFftComplex* in17 = input + 17*stride;
+    const float x17r = in17->real;
+    const CkFftComplex* in49 = input + 49*stride;
+    const float x49r = in49->real;
+    const float t665 = x17r + x49r;
+    const float t669 = t661 + t665;
+    const CkFftComplex* in9 = input + 9*stride;
+    const float x9r = in9->real;
+    const CkFftComplex* in41 = input + 41*stride;
+    const float x41r = in41->real;
+    const float t678 = x9r + x41r;
+    const CkFftComplex* in25 = input + 25*stride;
+    const float x25r = in25->real;
+    const CkFftComplex* in57 = input + 57*stride;
+    const float x57r = in57->real;
+    const float t682 = x25r + x57r;
+    const float t686 = t678 + t682;
+    const float t690 = t669 + t686;
+    const CkFftComplex* in5 = input + 5*stride;
+    const float x5r = in5->real;
+    const CkFftComplex* in37 = input + 37*stride;
+    const float x37r = in37->real;
+    const float t723 = x5r + x37r;
+    const CkFftComplex* in21 = input + 21*stride;
+    const float x21r = in21->real;
+    const CkFftComplex* in53 = input + 53*stride;
+    const float x53r = in53->real;
+    const float t727 = x21r + x53r;
+    const float t731 = t723 + t727;
+    const CkFftComplex* in13 = input + 13*stride;
+    const float x13r = in13->real;
+    const CkFftComplex* in45 = input + 45*stride;
+    const float x45r = in45->real;
+    const float t740 = x13r + x45r;
+    const CkFftComplex* in29 = input + 29*stride;
+    const float x29r = in29->real;
+    const CkFftComplex* in61 = input + 61*stride;
+    const float x61r = in61->real;
+    const float t744 = x29r + x61r;
+    const float t748 = t740 + t744;
+    const float t757 = t731 + t748;
+    const float t761 = t690 + t757;
+    const CkFftComplex* in3 = input + 3*stride;
+    const float x3r = in3->real;
+    const CkFftComplex* in35 = input + 35*stride;
+    const float x35r = in35->real;
+    const float t850 = x3r + x35r;
+    const CkFftComplex* in19 = input + 19*stride;
+    const float x19r = in19->real;
+    const CkFftComplex* in51 = input + 51*stride;
+    const float x51r = in51->real;
+    const float t854 = x19r + x51r;
+    const float t858 = t850 + t854;
+    const CkFftComplex* in11 = input + 11*stride;
+    const float x11r = in11->real;
+    const CkFftComplex* in43 = input + 43*stride;
+    const float x43r = in43->real;
+    const float t867 = x11r + x43r;
+    const CkFftComplex* in27 = input + 27*stride;
+    const float x27r = in27->real;
+    const CkFftComplex* in59 = input + 59*stride;
+    const float x59r = in59->real;
+    const float t871 = x27r + x59r;
+    const float t875 = t867 + t871;
+    const float t879 = t858 + t875;
+    const CkFftComplex* in7 = input + 7*stride;
+    const float x7r = in7->real;
+    const CkFftComplex* in39 = input + 39*stride;
+    const float x39r = in39->real;
+    const float t912 = x7r + x39r;
+    const CkFftComplex* in23 = input + 23*stride;
+    const float x23r = in23->real;
+    const CkFftComplex* in55 = input + 55*stride;
+    const float x55r = in55->real;
+    const float t916 = x23r + x55r;
+    const float t920 = t912 + t916;
+    const CkFftComplex* in15 = input + 15*stride;
+    const float x15r = in15->real;
+    const CkFftComplex* in47 = input + 47*stride;
+    const float x47r = in47->real;
+    const float t929 = x15r + x47r;
+    const CkFftComplex* in31 = input + 31*stride;
+    const float x31r = in31->real;
+    const CkFftComplex* in63 = input + 63*stride;
+    const float x63r = in63->real;
+    const float t933 = x31r + x63r;
+    const float t937 = t929 + t933;
+    const float t946 = t920 + t937;
+    const float t950 = t879 + t946;
+    const float t1039 = t761 + t950;
+    const float t1043 = t452 + t1039;
+    const float x0i = in0->imag;
+    const float x32i = in32->imag;
+    const float t130 = x0i + x32i;
+    const float x16i = in16->imag;
+    const float x48i = in48->imag;
+    const float t134 = x16i + x48i;
+    const float t138 = t130 + t134;
+    const float x8i = in8->imag;
+    const float x40i = in40->imag;
+    const float t147 = x8i + x40i;
+    const float x24i = in24->imag;
+    const float x56i = in56->imag;
+    const float t151 = x24i + x56i;
+    const float t155 = t147 + t151;
+    const float t159 = t138 + t155;
+    const float x4i = in4->imag;
+    const float x36i = in36->imag;
+    const float t193 = x4i + x36i;
+    const float x20i = in20->imag;
+    const float x52i = in52->imag;
+    const float t197 = x20i + x52i;
+    const float t201 = t193 + t197;
+    const float x12i = in12->imag;
+    const float x44i = in44->imag;
+    const float t210 = x12i + x44i;
+    const float x28i = in28->imag;
+    const float x60i = in60->imag;
+    const float t214 = x28i + x60i;
+    const float t218 = t210 + t214;
+    const float t227 = t201 + t218;
+    const float t231 = t159 + t227;
+    const float x2i = in2->imag;
+    const float x34i = in34->imag;
+    const float t325 = x2i + x34i;
+    const float x18i = in18->imag;
+    const float x50i = in50->imag;
+    const float t329 = x18i + x50i;
+    const float t333 = t325 + t329;
+    const float x10i = in10->imag;
+    const float x42i = in42->imag;
+    const float t342 = x10i + x42i;
+    const float x26i = in26->imag;
+    const float x58i = in58->imag;
+    const float t346 = x26i + x58i;
+    const float t350 = t342 + t346;
+    const float t354 = t333 + t350;
+    const float x6i = in6->imag;
+    const float x38i = in38->imag;
+    const float t387 = x6i + x38i;
+    const float x22i = in22->imag;
+    const float x54i = in54->imag;
+    const float t391 = x22i + x54i;
+    const float t395 = t387 + t391;
+    const float x14i = in14->imag;
+    const float x46i = in46->imag;
+    const float t404 = x14i + x46i;
+    const float x30i = in30->imag;
+    const float x62i = in62->imag;
+    const float t408 = x30i + x62i;
+    const float t412 = t404 + t408;
+    const float t416 = t395 + t412;
+    const float t449 = t354 + t416;
+    const float t453 = t231 + t449;
+    const float x1i = in1->imag;
+    const float x33i = in33->imag;
+    const float t662 = x1i + x33i;
+    const float x17i = in17->imag;
+    const float x49i = in49->imag;
+    const float t666 = x17i + x49i;
+    const float t670 = t662 + t666;
+    const float x9i = in9->imag;
+    const float x41i = in41->imag;
+    const float t679 = x9i + x41i;
+    const float x25i = in25->imag;
+    const float x57i = in57->imag;
+    const float t683 = x25i + x57i;
+    const float t687 = t679 + t683;
+    const float t691 = t670 + t687;
+    const float x5i = in5->imag;
+    const float x37i = in37->imag;
+    const float t724 = x5i + x37i;
+    const float x21i = in21->imag;
+    const float x53i = in53->imag;
+    const float t728 = x21i + x53i;
+    const float t732 = t724 + t728;
+    const float x13i = in13->imag;
+    const float x45i = in45->imag;
+    const float t741 = x13i + x45i;
+    const float x29i = in29->imag;
+    const float x61i = in61->imag;
+    const float t745 = x29i + x61i;
+    const float t749 = t741 + t745;
+    const float t758 = t732 + t749;
+    const float t762 = t691 + t758;
+    const float x3i = in3->imag;
+    const float x35i = in35->imag;
+    const float t851 = x3i + x35i;
+    const float x19i = in19->imag;
+    const float x51i = in51->imag;
+    const float t855 = x19i + x51i;
+    const float t859 = t851 + t855;
+    const float x11i = in11->imag;
+    const float x43i = in43->imag;
+    const float t868 = x11i + x43i;
+    const float x27i = in27->imag;
+    const float x59i = in59->imag;
+    const float t872 = x27i + x59i;
+    const float t876 = t868 + t872;
+    const float t880 = t859 + t876;
+    const float x7i = in7->imag;
+    const float x39i = in39->imag;
+    const float t913 = x7i + x39i;
+    const float x23i = in23->imag;
+    const float x55i = in55->imag;
+    const float t917 = x23i + x55i;
+    const float t921 = t913 + t917;
+    const float x15i = in15->imag;
+    const float x47i = in47->imag;
+    const float t930 = x15i + x47i;
+    const float x31i = in31->imag;
+    const float x63i = in63->imag;
+    const float t934 = x31i + x63i;
+    const float t938 = t930 + t934;
+    const float t947 = t921 + t938;
+    const float t951 = t880 + t947;
+    const float t1040 = t762 + t951;
+    const float t1044 = t453 + t1040;
+    const float t131 = x0r - x32r;
+    const float t136 = x16i - x48i;
+    const float t142 = t131 - t136;
+    const float t148 = x8r - x40r;
+    const float t149 = x8i - x40i;
+    const float t167 = t148 - t149;
+    const float t169 = 0.707106781f * t167;
+    const float t152 = x24r - x56r;
+    const float t153 = x24i - x56i;
+    const float t172 = t152 + t153;
+    const float t173 = 0.707106781f * t172;
+    const float t179 = t169 - t173;
+    const float t183 = t142 + t179;
+    const float t194 = x4r - x36r;
+    const float t199 = x20i - x52i;
+    const float t205 = t194 - t199;
+    const float t240 = 0.923879533f * t205;
+    const float t195 = x4i - x36i;
+    const float t198 = x20r - x52r;
+    const float t206 = t195 + t198;
+    const float t242 = 0.382683432f * t206;
+    const float t243 = t240 - t242;
+    const float t211 = x12r - x44r;
+    const float t216 = x28i - x60i;
+    const float t222 = t211 - t216;
+    const float t248 = 0.382683432f * t222;
+    const float t212 = x12i - x44i;
+    const float t215 = x28r - x60r;
+    const float t223 = t212 + t215;
+    const float t249 = 0.923879533f * t223;
+    const float t250 = t248 - t249;
+    const float t254 = t243 + t250;
+    const float t258 = t183 + t254;
+    const float t326 = x2r - x34r;
+    const float t331 = x18i - x50i;
+    const float t337 = t326 - t331;
+    const float t343 = x10r - x42r;
+    const float t344 = x10i - x42i;
+    const float t362 = t343 - t344;
+    const float t363 = 0.707106781f * t362;
+    const float t347 = x26r - x58r;
+    const float t348 = x26i - x58i;
+    const float t366 = t347 + t348;
+    const float t367 = 0.707106781f * t366;
+    const float t373 = t363 - t367;
+    const float t377 = t337 + t373;
+    const float t462 = 0.980785280f * t377;
+    const float t327 = x2i - x34i;
+    const float t330 = x18r - x50r;
+    const float t338 = t327 + t330;
+    const float t364 = t343 + t344;
+    const float t365 = 0.707106781f * t364;
+    const float t369 = t347 - t348;
+    const float t371 = 0.707106781f * t369;
+    const float t374 = t365 + t371;
+    const float t378 = t338 + t374;
+    const float t464 = 0.195090322f * t378;
+    const float t465 = t462 - t464;
+    const float t388 = x6r - x38r;
+    const float t393 = x22i - x54i;
+    const float t399 = t388 - t393;
+    const float t405 = x14r - x46r;
+    const float t406 = x14i - x46i;
+    const float t424 = t405 - t406;
+    const float t425 = 0.707106781f * t424;
+    const float t409 = x30r - x62r;
+    const float t410 = x30i - x62i;
+    const float t428 = t409 + t410;
+    const float t429 = 0.707106781f * t428;
+    const float t435 = t425 - t429;
+    const float t439 = t399 + t435;
+    const float t470 = 0.831469612f * t439;
+    const float t389 = x6i - x38i;
+    const float t392 = x22r - x54r;
+    const float t400 = t389 + t392;
+    const float t426 = t405 + t406;
+    const float t427 = 0.707106781f * t426;
+    const float t431 = t409 - t410;
+    const float t433 = 0.707106781f * t431;
+    const float t436 = t427 + t433;
+    const float t440 = t400 + t436;
+    const float t472 = 0.555570233f * t440;
+    const float t473 = t470 - t472;
+    const float t477 = t465 + t473;
+    const float t481 = t258 + t477;
+    const float t663 = x1r - x33r;
+    const float t668 = x17i - x49i;
+    const float t674 = t663 - t668;
+    const float t680 = x9r - x41r;
+    const float t681 = x9i - x41i;
+    const float t699 = t680 - t681;
+    const float t700 = 0.707106781f * t699;
+    const float t684 = x25r - x57r;
+    const float t685 = x25i - x57i;
+    const float t703 = t684 + t685;
+    const float t704 = 0.707106781f * t703;
+    const float t710 = t700 - t704;
+    const float t714 = t674 + t710;
+    const float t725 = x5r - x37r;
+    const float t730 = x21i - x53i;
+    const float t736 = t725 - t730;
+    const float t770 = 0.923879533f * t736;
+    const float t726 = x5i - x37i;
+    const float t729 = x21r - x53r;
+    const float t737 = t726 + t729;
+    const float t771 = 0.382683432f * t737;
+    const float t772 = t770 - t771;
+    const float t742 = x13r - x45r;
+    const float t747 = x29i - x61i;
+    const float t753 = t742 - t747;
+    const float t776 = 0.382683432f * t753;
+    const float t743 = x13i - x45i;
+    const float t746 = x29r - x61r;
+    const float t754 = t743 + t746;
+    const float t777 = 0.923879533f * t754;
+    const float t778 = t776 - t777;
+    const float t782 = t772 + t778;
+    const float t786 = t714 + t782;
+    const float t1053 = 0.995184727f * t786;
+    const float t664 = x1i - x33i;
+    const float t667 = x17r - x49r;
+    const float t675 = t664 + t667;
+    const float t701 = t680 + t681;
+    const float t702 = 0.707106781f * t701;
+    const float t706 = t684 - t685;
+    const float t708 = 0.707106781f * t706;
+    const float t711 = t702 + t708;
+    const float t715 = t675 + t711;
+    const float t773 = 0.382683432f * t736;
+    const float t774 = 0.923879533f * t737;
+    const float t775 = t773 + t774;
+    const float t779 = 0.923879533f * t753;
+    const float t780 = 0.382683432f * t754;
+    const float t781 = t779 + t780;
+    const float t783 = t775 + t781;
+    const float t787 = t715 + t783;
+    const float t1055 = 0.098017140f * t787;
+    const float t1056 = t1053 - t1055;
+    const float t852 = x3r - x35r;
+    const float t857 = x19i - x51i;
+    const float t863 = t852 - t857;
+    const float t869 = x11r - x43r;
+    const float t870 = x11i - x43i;
+    const float t888 = t869 - t870;
+    const float t889 = 0.707106781f * t888;
+    const float t873 = x27r - x59r;
+    const float t874 = x27i - x59i;
+    const float t892 = t873 + t874;
+    const float t893 = 0.707106781f * t892;
+    const float t899 = t889 - t893;
+    const float t903 = t863 + t899;
+    const float t914 = x7r - x39r;
+    const float t919 = x23i - x55i;
+    const float t925 = t914 - t919;
+    const float t959 = 0.923879533f * t925;
+    const float t915 = x7i - x39i;
+    const float t918 = x23r - x55r;
+    const float t926 = t915 + t918;
+    const float t960 = 0.382683432f * t926;
+    const float t961 = t959 - t960;
+    const float t931 = x15r - x47r;
+    const float t936 = x31i - x63i;
+    const float t942 = t931 - t936;
+    const float t965 = 0.382683432f * t942;
+    const float t932 = x15i - x47i;
+    const float t935 = x31r - x63r;
+    const float t943 = t932 + t935;
+    const float t966 = 0.923879533f * t943;
+    const float t967 = t965 - t966;
+    const float t971 = t961 + t967;
+    const float t975 = t903 + t971;
+    const float t1061 = 0.956940336f * t975;
+    const float t853 = x3i - x35i;
+    const float t856 = x19r - x51r;
+    const float t864 = t853 + t856;
+    const float t890 = t869 + t870;
+    const float t891 = 0.707106781f * t890;
+    const float t895 = t873 - t874;
+    const float t897 = 0.707106781f * t895;
+    const float t900 = t891 + t897;
+    const float t904 = t864 + t900;
+    const float t962 = 0.382683432f * t925;
+    const float t963 = 0.923879533f * t926;
+    const float t964 = t962 + t963;
+    const float t968 = 0.923879533f * t942;
+    const float t969 = 0.382683432f * t943;
+    const float t970 = t968 + t969;
+    const float t972 = t964 + t970;
+    const float t976 = t904 + t972;
+    const float t1063 = 0.290284677f * t976;
+    const float t1064 = t1061 - t1063;
+    const float t1068 = t1056 + t1064;
+    const float t1072 = t481 + t1068;
+    const float t132 = x0i - x32i;
+    const float t135 = x16r - x48r;
+    const float t143 = t132 + t135;
+    const float t170 = t148 + t149;
+    const float t171 = 0.707106781f * t170;
+    const float t175 = t152 - t153;
+    const float t177 = 0.707106781f * t175;
+    const float t180 = t171 + t177;
+    const float t184 = t143 + t180;
+    const float t244 = 0.382683432f * t205;
+    const float t245 = 0.923879533f * t206;
+    const float t246 = t244 + t245;
+    const float t251 = 0.923879533f * t222;
+    const float t252 = 0.382683432f * t223;
+    const float t253 = t251 + t252;
+    const float t255 = t246 + t253;
+    const float t259 = t184 + t255;
+    const float t466 = 0.195090322f * t377;
+    const float t467 = 0.980785280f * t378;
+    const float t468 = t466 + t467;
+    const float t474 = 0.555570233f * t439;
+    const float t475 = 0.831469612f * t440;
+    const float t476 = t474 + t475;
+    const float t478 = t468 + t476;
+    const float t482 = t259 + t478;
+    const float t1057 = 0.098017140f * t786;
+    const float t1058 = 0.995184727f * t787;
+    const float t1059 = t1057 + t1058;
+    const float t1065 = 0.290284677f * t975;
+    const float t1066 = 0.956940336f * t976;
+    const float t1067 = t1065 + t1066;
+    const float t1069 = t1059 + t1067;
+    const float t1073 = t482 + t1069;
+    const float t139 = t129 - t133;
+    const float t157 = t147 - t151;
+    const float t163 = t139 - t157;
+    const float t202 = t192 - t196;
+    const float t203 = t193 - t197;
+    const float t267 = t202 - t203;
+    const float t268 = 0.707106781f * t267;
+    const float t219 = t209 - t213;
+    const float t220 = t210 - t214;
+    const float t271 = t219 + t220;
+    const float t272 = 0.707106781f * t271;
+    const float t278 = t268 - t272;
+    const float t282 = t163 + t278;
+    const float t334 = t324 - t328;
+    const float t352 = t342 - t346;
+    const float t358 = t334 - t352;
+    const float t490 = 0.923879533f * t358;
+    const float t335 = t325 - t329;
+    const float t351 = t341 - t345;
+    const float t359 = t335 + t351;
+    const float t491 = 0.382683432f * t359;
+    const float t492 = t490 - t491;
+    const float t396 = t386 - t390;
+    const float t414 = t404 - t408;
+    const float t420 = t396 - t414;
+    const float t496 = 0.382683432f * t420;
+    const float t397 = t387 - t391;
+    const float t413 = t403 - t407;
+    const float t421 = t397 + t413;
+    const float t497 = 0.923879533f * t421;
+    const float t498 = t496 - t497;
+    const float t502 = t492 + t498;
+    const float t506 = t282 + t502;
+    const float t671 = t661 - t665;
+    const float t689 = t679 - t683;
+    const float t695 = t671 - t689;
+    const float t733 = t723 - t727;
+    const float t734 = t724 - t728;
+    const float t795 = t733 - t734;
+    const float t796 = 0.707106781f * t795;
+    const float t750 = t740 - t744;
+    const float t751 = t741 - t745;
+    const float t799 = t750 + t751;
+    const float t800 = 0.707106781f * t799;
+    const float t806 = t796 - t800;
+    const float t810 = t695 + t806;
+    const float t1081 = 0.980785280f * t810;
+    const float t672 = t662 - t666;
+    const float t688 = t678 - t682;
+    const float t696 = t672 + t688;
+    const float t797 = t733 + t734;
+    const float t798 = 0.707106781f * t797;
+    const float t802 = t750 - t751;
+    const float t804 = 0.707106781f * t802;
+    const float t807 = t798 + t804;
+    const float t811 = t696 + t807;
+    const float t1082 = 0.195090322f * t811;
+    const float t1083 = t1081 - t1082;
+    const float t860 = t850 - t854;
+    const float t878 = t868 - t872;
+    const float t884 = t860 - t878;
+    const float t922 = t912 - t916;
+    const float t923 = t913 - t917;
+    const float t984 = t922 - t923;
+    const float t985 = 0.707106781f * t984;
+    const float t939 = t929 - t933;
+    const float t940 = t930 - t934;
+    const float t988 = t939 + t940;
+    const float t989 = 0.707106781f * t988;
+    const float t995 = t985 - t989;
+    const float t999 = t884 + t995;
+    const float t1087 = 0.831469612f * t999;
+    const float t861 = t851 - t855;
+    const float t877 = t867 - t871;
+    const float t885 = t861 + t877;
+    const float t986 = t922 + t923;
+    const float t987 = 0.707106781f * t986;
+    const float t991 = t939 - t940;
+    const float t993 = 0.707106781f * t991;
+    const float t996 = t987 + t993;
+    const float t1000 = t885 + t996;
+    const float t1088 = 0.555570233f * t1000;
+    const float t1089 = t1087 - t1088;
+    const float t1093 = t1083 + t1089;
+    const float t1097 = t506 + t1093;
+    const float t140 = t130 - t134;
+    const float t156 = t146 - t150;
+    const float t164 = t140 + t156;
+    const float t269 = t202 + t203;
+    const float t270 = 0.707106781f * t269;
+    const float t274 = t219 - t220;
+    const float t276 = 0.707106781f * t274;
+    const float t279 = t270 + t276;
+    const float t283 = t164 + t279;
+    const float t493 = 0.382683432f * t358;
+    const float t494 = 0.923879533f * t359;
+    const float t495 = t493 + t494;
+    const float t499 = 0.923879533f * t420;
+    const float t500 = 0.382683432f * t421;
+    const float t501 = t499 + t500;
+    const float t503 = t495 + t501;
+    const float t507 = t283 + t503;
+    const float t1084 = 0.195090322f * t810;
+    const float t1085 = 0.980785280f * t811;
+    const float t1086 = t1084 + t1085;
+    const float t1090 = 0.555570233f * t999;
+    const float t1091 = 0.831469612f * t1000;
+    const float t1092 = t1090 + t1091;
+    const float t1094 = t1086 + t1092;
+    const float t1098 = t507 + t1094;
+    const float t144 = t131 + t136;
+    const float t182 = t171 - t177;
+    const float t188 = t144 - t182;
+    const float t207 = t194 + t199;
+    const float t291 = 0.382683432f * t207;
+    const float t208 = t195 - t198;
+    const float t292 = 0.923879533f * t208;
+    const float t293 = t291 - t292;
+    const float t224 = t211 + t216;
+    const float t298 = 0.923879533f * t224;
+    const float t225 = t212 - t215;
+    const float t301 = 0.382683432f * t225;
+    const float t303 = t298 - t301;
+    const float t311 = t293 - t303;
+    const float t315 = t188 + t311;
+    const float t339 = t326 + t331;
+    const float t376 = t365 - t371;
+    const float t382 = t339 - t376;
+    const float t515 = 0.831469612f * t382;
+    const float t340 = t327 - t330;
+    const float t375 = t363 + t367;
+    const float t383 = t340 + t375;
+    const float t516 = 0.555570233f * t383;
+    const float t517 = t515 - t516;
+    const float t401 = t388 + t393;
+    const float t438 = t427 - t433;
+    const float t444 = t401 - t438;
+    const float t522 = 0.195090322f * t444;
+    const float t402 = t389 - t392;
+    const float t437 = t425 + t429;
+    const float t445 = t402 + t437;
+    const float t524 = 0.980785280f * t445;
+    const float t525 = t522 + t524;
+    const float t531 = t517 - t525;
+    const float t535 = t315 + t531;
+    const float t676 = t663 + t668;
+    const float t713 = t702 - t708;
+    const float t719 = t676 - t713;
+    const float t738 = t725 + t730;
+    const float t819 = 0.382683432f * t738;
+    const float t739 = t726 - t729;
+    const float t820 = 0.923879533f * t739;
+    const float t821 = t819 - t820;
+    const float t755 = t742 + t747;
+    const float t825 = 0.923879533f * t755;
+    const float t756 = t743 - t746;
+    const float t827 = 0.382683432f * t756;
+    const float t829 = t825 - t827;
+    const float t837 = t821 - t829;
+    const float t841 = t719 + t837;
+    const float t1106 = 0.956940336f * t841;
+    const float t677 = t664 - t667;
+    const float t712 = t700 + t704;
+    const float t720 = t677 + t712;
+    const float t822 = 0.923879533f * t738;
+    const float t823 = 0.382683432f * t739;
+    const float t824 = t822 + t823;
+    const float t831 = 0.382683432f * t755;
+    const float t833 = 0.923879533f * t756;
+    const float t835 = t831 + t833;
+    const float t838 = t824 - t835;
+    const float t842 = t720 + t838;
+    const float t1107 = 0.290284677f * t842;
+    const float t1108 = t1106 - t1107;
+    const float t865 = t852 + t857;
+    const float t902 = t891 - t897;
+    const float t908 = t865 - t902;
+    const float t927 = t914 + t919;
+    const float t1008 = 0.382683432f * t927;
+    const float t928 = t915 - t918;
+    const float t1009 = 0.923879533f * t928;
+    const float t1010 = t1008 - t1009;
+    const float t944 = t931 + t936;
+    const float t1014 = 0.923879533f * t944;
+    const float t945 = t932 - t935;
+    const float t1016 = 0.382683432f * t945;
+    const float t1018 = t1014 - t1016;
+    const float t1026 = t1010 - t1018;
+    const float t1030 = t908 + t1026;
+    const float t1113 = 0.634393284f * t1030;
+    const float t866 = t853 - t856;
+    const float t901 = t889 + t893;
+    const float t909 = t866 + t901;
+    const float t1011 = 0.923879533f * t927;
+    const float t1012 = 0.382683432f * t928;
+    const float t1013 = t1011 + t1012;
+    const float t1020 = 0.382683432f * t944;
+    const float t1022 = 0.923879533f * t945;
+    const float t1024 = t1020 + t1022;
+    const float t1027 = t1013 - t1024;
+    const float t1031 = t909 + t1027;
+    const float t1115 = 0.773010453f * t1031;
+    const float t1116 = t1113 - t1115;
+    const float t1120 = t1108 + t1116;
+    const float t1124 = t535 + t1120;
+    const float t145 = t132 - t135;
+    const float t181 = t169 + t173;
+    const float t189 = t145 + t181;
+    const float t294 = 0.923879533f * t207;
+    const float t295 = 0.382683432f * t208;
+    const float t296 = t294 + t295;
+    const float t305 = 0.382683432f * t224;
+    const float t307 = 0.923879533f * t225;
+    const float t309 = t305 + t307;
+    const float t312 = t296 - t309;
+    const float t316 = t189 + t312;
+    const float t518 = 0.555570233f * t382;
+    const float t519 = 0.831469612f * t383;
+    const float t520 = t518 + t519;
+    const float t527 = 0.980785280f * t444;
+    const float t528 = 0.195090322f * t445;
+    const float t530 = t527 - t528;
+    const float t532 = t520 + t530;
+    const float t536 = t316 + t532;
+    const float t1109 = 0.290284677f * t841;
+    const float t1110 = 0.956940336f * t842;
+    const float t1111 = t1109 + t1110;
+    const float t1117 = 0.773010453f * t1030;
+    const float t1118 = 0.634393284f * t1031;
+    const float t1119 = t1117 + t1118;
+    const float t1121 = t1111 + t1119;
+    const float t1125 = t536 + t1121;
+    const float t160 = t137 - t154;
+    const float t229 = t201 - t218;
+    const float t235 = t160 - t229;
+    const float t355 = t332 - t349;
+    const float t356 = t333 - t350;
+    const float t544 = t355 - t356;
+    const float t545 = 0.707106781f * t544;
+    const float t417 = t394 - t411;
+    const float t418 = t395 - t412;
+    const float t548 = t417 + t418;
+    const float t549 = 0.707106781f * t548;
+    const float t555 = t545 - t549;
+    const float t559 = t235 + t555;
+    const float t692 = t669 - t686;
+    const float t760 = t732 - t749;
+    const float t766 = t692 - t760;
+    const float t1133 = 0.923879533f * t766;
+    const float t693 = t670 - t687;
+    const float t759 = t731 - t748;
+    const float t767 = t693 + t759;
+    const float t1134 = 0.382683432f * t767;
+    const float t1135 = t1133 - t1134;
+    const float t881 = t858 - t875;
+    const float t949 = t921 - t938;
+    const float t955 = t881 - t949;
+    const float t1139 = 0.382683432f * t955;
+    const float t882 = t859 - t876;
+    const float t948 = t920 - t937;
+    const float t956 = t882 + t948;
+    const float t1140 = 0.923879533f * t956;
+    const float t1141 = t1139 - t1140;
+    const float t1145 = t1135 + t1141;
+    const float t1149 = t559 + t1145;
+    const float t161 = t138 - t155;
+    const float t228 = t200 - t217;
+    const float t236 = t161 + t228;
+    const float t546 = t355 + t356;
+    const float t547 = 0.707106781f * t546;
+    const float t551 = t417 - t418;
+    const float t553 = 0.707106781f * t551;
+    const float t556 = t547 + t553;
+    const float t560 = t236 + t556;
+    const float t1136 = 0.382683432f * t766;
+    const float t1137 = 0.923879533f * t767;
+    const float t1138 = t1136 + t1137;
+    const float t1142 = 0.923879533f * t955;
+    const float t1143 = 0.382683432f * t956;
+    const float t1144 = t1142 + t1143;
+    const float t1146 = t1138 + t1144;
+    const float t1150 = t560 + t1146;
+    const float t185 = t142 - t179;
+    const float t257 = t246 - t253;
+    const float t263 = t185 - t257;
+    const float t379 = t337 - t373;
+    const float t569 = 0.555570233f * t379;
+    const float t380 = t338 - t374;
+    const float t570 = 0.831469612f * t380;
+    const float t571 = t569 - t570;
+    const float t441 = t399 - t435;
+    const float t575 = 0.980785280f * t441;
+    const float t442 = t400 - t436;
+    const float t578 = 0.195090322f * t442;
+    const float t579 = t575 + t578;
+    const float t585 = t571 - t579;
+    const float t589 = t263 + t585;
+    const float t716 = t674 - t710;
+    const float t785 = t775 - t781;
+    const float t791 = t716 - t785;
+    const float t1159 = 0.881921264f * t791;
+    const float t717 = t675 - t711;
+    const float t784 = t772 - t778;
+    const float t792 = t717 + t784;
+    const float t1161 = 0.471396737f * t792;
+    const float t1162 = t1159 - t1161;
+    const float t905 = t863 - t899;
+    const float t974 = t964 - t970;
+    const float t980 = t905 - t974;
+    const float t1167 = 0.098017140f * t980;
+    const float t906 = t864 - t900;
+    const float t973 = t961 - t967;
+    const float t981 = t906 + t973;
+    const float t1169 = 0.995184727f * t981;
+    const float t1170 = t1167 - t1169;
+    const float t1174 = t1162 + t1170;
+    const float t1178 = t589 + t1174;
+    const float t186 = t143 - t180;
+    const float t256 = t243 - t250;
+    const float t264 = t186 + t256;
+    const float t572 = 0.831469612f * t379;
+    const float t573 = 0.555570233f * t380;
+    const float t574 = t572 + t573;
+    const float t581 = 0.195090322f * t441;
+    const float t582 = 0.980785280f * t442;
+    const float t584 = t581 - t582;
+    const float t586 = t574 + t584;
+    const float t590 = t264 + t586;
+    const float t1163 = 0.471396737f * t791;
+    const float t1164 = 0.881921264f * t792;
+    const float t1165 = t1163 + t1164;
+    const float t1171 = 0.995184727f * t980;
+    const float t1172 = 0.098017140f * t981;
+    const float t1173 = t1171 + t1172;
+    const float t1175 = t1165 + t1173;
+    const float t1179 = t590 + t1175;
+    const float t165 = t139 + t157;
+    const float t281 = t270 - t276;
+    const float t287 = t165 - t281;
+    const float t360 = t334 + t352;
+    const float t598 = 0.382683432f * t360;
+    const float t361 = t335 - t351;
+    const float t599 = 0.923879533f * t361;
+    const float t600 = t598 - t599;
+    const float t422 = t396 + t414;
+    const float t604 = 0.923879533f * t422;
+    const float t423 = t397 - t413;
+    const float t606 = 0.382683432f * t423;
+    const float t608 = t604 - t606;
+    const float t616 = t600 - t608;
+    const float t620 = t287 + t616;
+    const float t697 = t671 + t689;
+    const float t809 = t798 - t804;
+    const float t815 = t697 - t809;
+    const float t1187 = 0.831469612f * t815;
+    const float t698 = t672 - t688;
+    const float t808 = t796 + t800;
+    const float t816 = t698 + t808;
+    const float t1188 = 0.555570233f * t816;
+    const float t1189 = t1187 - t1188;
+    const float t886 = t860 + t878;
+    const float t998 = t987 - t993;
+    const float t1004 = t886 - t998;
+    const float t1193 = 0.195090322f * t1004;
+    const float t887 = t861 - t877;
+    const float t997 = t985 + t989;
+    const float t1005 = t887 + t997;
+    const float t1195 = 0.980785280f * t1005;
+    const float t1196 = t1193 + t1195;
+    const float t1202 = t1189 - t1196;
+    const float t1206 = t620 + t1202;
+    const float t166 = t140 - t156;
+    const float t280 = t268 + t272;
+    const float t288 = t166 + t280;
+    const float t601 = 0.923879533f * t360;
+    const float t602 = 0.382683432f * t361;
+    const float t603 = t601 + t602;
+    const float t610 = 0.382683432f * t422;
+    const float t612 = 0.923879533f * t423;
+    const float t614 = t610 + t612;
+    const float t617 = t603 - t614;
+    const float t621 = t288 + t617;
+    const float t1190 = 0.555570233f * t815;
+    const float t1191 = 0.831469612f * t816;
+    const float t1192 = t1190 + t1191;
+    const float t1198 = 0.980785280f * t1004;
+    const float t1199 = 0.195090322f * t1005;
+    const float t1201 = t1198 - t1199;
+    const float t1203 = t1192 + t1201;
+    const float t1207 = t621 + t1203;
+    const float t190 = t144 + t182;
+    const float t314 = t296 + t309;
+    const float t320 = t190 - t314;
+    const float t384 = t339 + t376;
+    const float t630 = 0.195090322f * t384;
+    const float t385 = t340 - t375;
+    const float t631 = 0.980785280f * t385;
+    const float t632 = t630 - t631;
+    const float t446 = t401 + t438;
+    const float t636 = 0.555570233f * t446;
+    const float t447 = t402 - t437;
+    const float t638 = 0.831469612f * t447;
+    const float t640 = t636 - t638;
+    const float t648 = t632 - t640;
+    const float t652 = t320 + t648;
+    const float t721 = t676 + t713;
+    const float t840 = t824 + t835;
+    const float t846 = t721 - t840;
+    const float t1215 = 0.773010453f * t846;
+    const float t722 = t677 - t712;
+    const float t839 = t821 + t829;
+    const float t847 = t722 + t839;
+    const float t1216 = 0.634393284f * t847;
+    const float t1217 = t1215 - t1216;
+    const float t910 = t865 + t902;
+    const float t1029 = t1013 + t1024;
+    const float t1035 = t910 - t1029;
+    const float t1222 = 0.471396737f * t1035;
+    const float t911 = t866 - t901;
+    const float t1028 = t1010 + t1018;
+    const float t1036 = t911 + t1028;
+    const float t1224 = 0.881921264f * t1036;
+    const float t1225 = t1222 + t1224;
+    const float t1231 = t1217 - t1225;
+    const float t1235 = t652 + t1231;
+    const float t191 = t145 - t181;
+    const float t313 = t293 + t303;
+    const float t321 = t191 + t313;
+    const float t633 = 0.980785280f * t384;
+    const float t634 = 0.195090322f * t385;
+    const float t635 = t633 + t634;
+    const float t642 = 0.831469612f * t446;
+    const float t644 = 0.555570233f * t447;
+    const float t646 = t642 + t644;
+    const float t649 = t635 - t646;
+    const float t653 = t321 + t649;
+    const float t1218 = 0.634393284f * t846;
+    const float t1219 = 0.773010453f * t847;
+    const float t1220 = t1218 + t1219;
+    const float t1227 = 0.881921264f * t1035;
+    const float t1228 = 0.471396737f * t1036;
+    const float t1230 = t1227 - t1228;
+    const float t1232 = t1220 + t1230;
+    const float t1236 = t653 + t1232;
+    const float t232 = t158 - t226;
+    const float t451 = t354 - t416;
+    const float t457 = t232 - t451;
+    const float t763 = t690 - t757;
+    const float t764 = t691 - t758;
+    const float t1244 = t763 - t764;
+    const float t1245 = 0.707106781f * t1244;
+    const float t952 = t879 - t946;
+    const float t953 = t880 - t947;
+    const float t1248 = t952 + t953;
+    const float t1249 = 0.707106781f * t1248;
+    const float t1255 = t1245 - t1249;
+    const float t1259 = t457 + t1255;
+    const float t233 = t159 - t227;
+    const float t450 = t353 - t415;
+    const float t458 = t233 + t450;
+    const float t1246 = t763 + t764;
+    const float t1247 = 0.707106781f * t1246;
+    const float t1251 = t952 - t953;
+    const float t1253 = 0.707106781f * t1251;
+    const float t1256 = t1247 + t1253;
+    const float t1260 = t458 + t1256;
+    const float t260 = t183 - t254;
+    const float t480 = t468 - t476;
+    const float t486 = t260 - t480;
+    const float t788 = t714 - t782;
+    const float t1268 = 0.634393284f * t788;
+    const float t789 = t715 - t783;
+    const float t1269 = 0.773010453f * t789;
+    const float t1270 = t1268 - t1269;
+    const float t977 = t903 - t971;
+    const float t1275 = 0.881921264f * t977;
+    const float t978 = t904 - t972;
+    const float t1278 = 0.471396737f * t978;
+    const float t1279 = t1275 + t1278;
+    const float t1285 = t1270 - t1279;
+    const float t1289 = t486 + t1285;
+    const float t261 = t184 - t255;
+    const float t479 = t465 - t473;
+    const float t487 = t261 + t479;
+    const float t1271 = 0.773010453f * t788;
+    const float t1272 = 0.634393284f * t789;
+    const float t1273 = t1271 + t1272;
+    const float t1281 = 0.471396737f * t977;
+    const float t1282 = 0.881921264f * t978;
+    const float t1284 = t1281 - t1282;
+    const float t1286 = t1273 + t1284;
+    const float t1290 = t487 + t1286;
+    const float t284 = t163 - t278;
+    const float t505 = t495 - t501;
+    const float t511 = t284 - t505;
+    const float t812 = t695 - t806;
+    const float t1298 = 0.555570233f * t812;
+    const float t813 = t696 - t807;
+    const float t1299 = 0.831469612f * t813;
+    const float t1300 = t1298 - t1299;
+    const float t1001 = t884 - t995;
+    const float t1304 = 0.980785280f * t1001;
+    const float t1002 = t885 - t996;
+    const float t1306 = 0.195090322f * t1002;
+    const float t1307 = t1304 + t1306;
+    const float t1313 = t1300 - t1307;
+    const float t1317 = t511 + t1313;
+    const float t285 = t164 - t279;
+    const float t504 = t492 - t498;
+    const float t512 = t285 + t504;
+    const float t1301 = 0.831469612f * t812;
+    const float t1302 = 0.555570233f * t813;
+    const float t1303 = t1301 + t1302;
+    const float t1309 = 0.195090322f * t1001;
+    const float t1310 = 0.980785280f * t1002;
+    const float t1312 = t1309 - t1310;
+    const float t1314 = t1303 + t1312;
+    const float t1318 = t512 + t1314;
+    const float t317 = t188 - t311;
+    const float t534 = t520 - t530;
+    const float t540 = t317 - t534;
+    const float t843 = t719 - t837;
+    const float t1327 = 0.471396737f * t843;
+    const float t844 = t720 - t838;
+    const float t1328 = 0.881921264f * t844;
+    const float t1329 = t1327 - t1328;
+    const float t1032 = t908 - t1026;
+    const float t1333 = 0.995184727f * t1032;
+    const float t1033 = t909 - t1027;
+    const float t1336 = 0.098017140f * t1033;
+    const float t1338 = t1333 - t1336;
+    const float t1346 = t1329 - t1338;
+    const float t1350 = t540 + t1346;
+    const float t318 = t189 - t312;
+    const float t533 = t517 + t525;
+    const float t541 = t318 + t533;
+    const float t1330 = 0.881921264f * t843;
+    const float t1331 = 0.471396737f * t844;
+    const float t1332 = t1330 + t1331;
+    const float t1340 = 0.098017140f * t1032;
+    const float t1342 = 0.995184727f * t1033;
+    const float t1344 = t1340 + t1342;
+    const float t1347 = t1332 - t1344;
+    const float t1351 = t541 + t1347;
+    const float t237 = t160 + t229;
+    const float t558 = t547 - t553;
+    const float t564 = t237 - t558;
+    const float t768 = t692 + t760;
+    const float t1359 = 0.382683432f * t768;
+    const float t769 = t693 - t759;
+    const float t1360 = 0.923879533f * t769;
+    const float t1361 = t1359 - t1360;
+    const float t957 = t881 + t949;
+    const float t1365 = 0.923879533f * t957;
+    const float t958 = t882 - t948;
+    const float t1367 = 0.382683432f * t958;
+    const float t1369 = t1365 - t1367;
+    const float t1377 = t1361 - t1369;
+    const float t1381 = t564 + t1377;
+    const float t238 = t161 - t228;
+    const float t557 = t545 + t549;
+    const float t565 = t238 + t557;
+    const float t1362 = 0.923879533f * t768;
+    const float t1363 = 0.382683432f * t769;
+    const float t1364 = t1362 + t1363;
+    const float t1371 = 0.382683432f * t957;
+    const float t1373 = 0.923879533f * t958;
+    const float t1375 = t1371 + t1373;
+    const float t1378 = t1364 - t1375;
+    const float t1382 = t565 + t1378;
+    const float t265 = t185 + t257;
+    const float t588 = t574 - t584;
+    const float t594 = t265 - t588;
+    const float t793 = t716 + t785;
+    const float t1390 = 0.290284677f * t793;
+    const float t794 = t717 - t784;
+    const float t1392 = 0.956940336f * t794;
+    const float t1393 = t1390 - t1392;
+    const float t982 = t905 + t974;
+    const float t1398 = 0.773010453f * t982;
+    const float t983 = t906 - t973;
+    const float t1401 = 0.634393284f * t983;
+    const float t1403 = t1398 - t1401;
+    const float t1411 = t1393 - t1403;
+    const float t1415 = t594 + t1411;
+    const float t266 = t186 - t256;
+    const float t587 = t571 + t579;
+    const float t595 = t266 + t587;
+    const float t1394 = 0.956940336f * t793;
+    const float t1395 = 0.290284677f * t794;
+    const float t1396 = t1394 + t1395;
+    const float t1405 = 0.634393284f * t982;
+    const float t1407 = 0.773010453f * t983;
+    const float t1409 = t1405 + t1407;
+    const float t1412 = t1396 - t1409;
+    const float t1416 = t595 + t1412;
+    const float t289 = t165 + t281;
+    const float t619 = t603 + t614;
+    const float t625 = t289 - t619;
+    const float t817 = t697 + t809;
+    const float t1424 = 0.195090322f * t817;
+    const float t818 = t698 - t808;
+    const float t1425 = 0.980785280f * t818;
+    const float t1426 = t1424 - t1425;
+    const float t1006 = t886 + t998;
+    const float t1430 = 0.555570233f * t1006;
+    const float t1007 = t887 - t997;
+    const float t1432 = 0.831469612f * t1007;
+    const float t1434 = t1430 - t1432;
+    const float t1442 = t1426 - t1434;
+    const float t1446 = t625 + t1442;
+    const float t290 = t166 - t280;
+    const float t618 = t600 + t608;
+    const float t626 = t290 + t618;
+    const float t1427 = 0.980785280f * t817;
+    const float t1428 = 0.195090322f * t818;
+    const float t1429 = t1427 + t1428;
+    const float t1436 = 0.831469612f * t1006;
+    const float t1438 = 0.555570233f * t1007;
+    const float t1440 = t1436 + t1438;
+    const float t1443 = t1429 - t1440;
+    const float t1447 = t626 + t1443;
+    const float t322 = t190 + t314;
+    const float t651 = t635 + t646;
+    const float t657 = t322 - t651;
+    const float t848 = t721 + t840;
+    const float t1455 = 0.098017140f * t848;
+    const float t849 = t722 - t839;
+    const float t1456 = 0.995184727f * t849;
+    const float t1457 = t1455 - t1456;
+    const float t1037 = t910 + t1029;
+    const float t1462 = 0.290284677f * t1037;
+    const float t1038 = t911 - t1028;
+    const float t1464 = 0.956940336f * t1038;
+    const float t1466 = t1462 - t1464;
+    const float t1474 = t1457 - t1466;
+    const float t1478 = t657 + t1474;
+    const float t323 = t191 - t313;
+    const float t650 = t632 + t640;
+    const float t658 = t323 + t650;
+    const float t1458 = 0.995184727f * t848;
+    const float t1459 = 0.098017140f * t849;
+    const float t1460 = t1458 + t1459;
+    const float t1468 = 0.956940336f * t1037;
+    const float t1470 = 0.290284677f * t1038;
+    const float t1472 = t1468 + t1470;
+    const float t1475 = t1460 - t1472;
+    const float t1479 = t658 + t1475;
+    const float t454 = t230 - t448;
+    const float t1042 = t762 - t951;
+    const float t1048 = t454 - t1042;
+    const float t455 = t231 - t449;
+    const float t1041 = t761 - t950;
+    const float t1049 = t455 + t1041;
+    const float t483 = t258 - t477;
+    const float t1071 = t1059 - t1067;
+    const float t1077 = t483 - t1071;
+    const float t484 = t259 - t478;
+    const float t1070 = t1056 - t1064;
+    const float t1078 = t484 + t1070;
+    const float t508 = t282 - t502;
+    const float t1096 = t1086 - t1092;
+    const float t1102 = t508 - t1096;
+    const float t509 = t283 - t503;
+    const float t1095 = t1083 - t1089;
+    const float t1103 = t509 + t1095;
+    const float t537 = t315 - t531;
+    const float t1123 = t1111 - t1119;
+    const float t1129 = t537 - t1123;
+    const float t538 = t316 - t532;
+    const float t1122 = t1108 - t1116;
+    const float t1130 = t538 + t1122;
+    const float t561 = t235 - t555;
+    const float t1148 = t1138 - t1144;
+    const float t1154 = t561 - t1148;
+    const float t562 = t236 - t556;
+    const float t1147 = t1135 - t1141;
+    const float t1155 = t562 + t1147;
+    const float t591 = t263 - t585;
+    const float t1177 = t1165 - t1173;
+    const float t1183 = t591 - t1177;
+    const float t592 = t264 - t586;
+    const float t1176 = t1162 - t1170;
+    const float t1184 = t592 + t1176;
+    const float t622 = t287 - t616;
+    const float t1205 = t1192 - t1201;
+    const float t1211 = t622 - t1205;
+    const float t623 = t288 - t617;
+    const float t1204 = t1189 + t1196;
+    const float t1212 = t623 + t1204;
+    const float t654 = t320 - t648;
+    const float t1234 = t1220 - t1230;
+    const float t1240 = t654 - t1234;
+    const float t655 = t321 - t649;
+    const float t1233 = t1217 + t1225;
+    const float t1241 = t655 + t1233;
+    const float t459 = t232 + t451;
+    const float t1258 = t1247 - t1253;
+    const float t1264 = t459 - t1258;
+    const float t460 = t233 - t450;
+    const float t1257 = t1245 + t1249;
+    const float t1265 = t460 + t1257;
+    const float t488 = t260 + t480;
+    const float t1288 = t1273 - t1284;
+    const float t1294 = t488 - t1288;
+    const float t489 = t261 - t479;
+    const float t1287 = t1270 + t1279;
+    const float t1295 = t489 + t1287;
+    const float t513 = t284 + t505;
+    const float t1316 = t1303 - t1312;
+    const float t1322 = t513 - t1316;
+    const float t514 = t285 - t504;
+    const float t1315 = t1300 + t1307;
+    const float t1323 = t514 + t1315;
+    const float t542 = t317 + t534;
+    const float t1349 = t1332 + t1344;
+    const float t1355 = t542 - t1349;
+    const float t543 = t318 - t533;
+    const float t1348 = t1329 + t1338;
+    const float t1356 = t543 + t1348;
+    const float t566 = t237 + t558;
+    const float t1380 = t1364 + t1375;
+    const float t1386 = t566 - t1380;
+    const float t567 = t238 - t557;
+    const float t1379 = t1361 + t1369;
+    const float t1387 = t567 + t1379;
+    const float t596 = t265 + t588;
+    const float t1414 = t1396 + t1409;
+    const float t1420 = t596 - t1414;
+    const float t597 = t266 - t587;
+    const float t1413 = t1393 + t1403;
+    const float t1421 = t597 + t1413;
+    const float t627 = t289 + t619;
+    const float t1445 = t1429 + t1440;
+    const float t1451 = t627 - t1445;
+    const float t628 = t290 - t618;
+    const float t1444 = t1426 + t1434;
+    const float t1452 = t628 + t1444;
+    const float t659 = t322 + t651;
+    const float t1477 = t1460 + t1472;
+    const float t1483 = t659 - t1477;
+    const float t660 = t323 - t650;
+    const float t1476 = t1457 + t1466;
+    const float t1484 = t660 + t1476;
+    const float t1045 = t452 - t1039;
+    const float t1046 = t453 - t1040;
+    const float t1074 = t481 - t1068;
+    const float t1075 = t482 - t1069;
+    const float t1099 = t506 - t1093;
+    const float t1100 = t507 - t1094;
+    const float t1126 = t535 - t1120;
+    const float t1127 = t536 - t1121;
+    const float t1151 = t559 - t1145;
+    const float t1152 = t560 - t1146;
+    const float t1180 = t589 - t1174;
+    const float t1181 = t590 - t1175;
+    const float t1208 = t620 - t1202;
+    const float t1209 = t621 - t1203;
+    const float t1237 = t652 - t1231;
+    const float t1238 = t653 - t1232;
+    const float t1261 = t457 - t1255;
+    const float t1262 = t458 - t1256;
+    const float t1291 = t486 - t1285;
+    const float t1292 = t487 - t1286;
+    const float t1319 = t511 - t1313;
+    const float t1320 = t512 - t1314;
+    const float t1352 = t540 - t1346;
+    const float t1353 = t541 - t1347;
+    const float t1383 = t564 - t1377;
+    const float t1384 = t565 - t1378;
+    const float t1417 = t594 - t1411;
+    const float t1418 = t595 - t1412;
+    const float t1448 = t625 - t1442;
+    const float t1449 = t626 - t1443;
+    const float t1480 = t657 - t1474;
+    const float t1481 = t658 - t1475;
+    const float t1050 = t454 + t1042;
+    const float t1051 = t455 - t1041;
+    const float t1079 = t483 + t1071;
+    const float t1080 = t484 - t1070;
+    const float t1104 = t508 + t1096;
+    const float t1105 = t509 - t1095;
+    const float t1131 = t537 + t1123;
+    const float t1132 = t538 - t1122;
+    const float t1156 = t561 + t1148;
+    const float t1157 = t562 - t1147;
+    const float t1185 = t591 + t1177;
+    const float t1186 = t592 - t1176;
+    const float t1213 = t622 + t1205;
+    const float t1214 = t623 - t1204;
+    const float t1242 = t654 + t1234;
+    const float t1243 = t655 - t1233;
+    const float t1266 = t459 + t1258;
+    const float t1267 = t460 - t1257;
+    const float t1296 = t488 + t1288;
+    const float t1297 = t489 - t1287;
+    const float t1324 = t513 + t1316;
+    const float t1325 = t514 - t1315;
+    const float t1357 = t542 + t1349;
+    const float t1358 = t543 - t1348;
+    const float t1388 = t566 + t1380;
+    const float t1389 = t567 - t1379;
+    const float t1422 = t596 + t1414;
+    const float t1423 = t597 - t1413;
+    const float t1453 = t627 + t1445;
+    const float t1454 = t628 - t1444;
+    const float t1485 = t659 + t1477;
+    const float t1486 = t660 - t1476;
+    output[0].real = t1043;
+    output[0].imag = t1044;
+    output[1].real = t1072;
+    output[1].imag = t1073;
+    output[2].real = t1097;
+    output[2].imag = t1098;
+    output[3].real = t1124;
+    output[3].imag = t1125;
+    output[4].real = t1149;
+    output[4].imag = t1150;
+    output[5].real = t1178;
+    output[5].imag = t1179;
+    output[6].real = t1206;
+    output[6].imag = t1207;
+    output[7].real = t1235;
+    output[7].imag = t1236;
+    output[8].real = t1259;
+    output[8].imag = t1260;
+    output[9].real = t1289;
+    output[9].imag = t1290;
+    output[10].real = t1317;
+    output[10].imag = t1318;
+    output[11].real = t1350;
+    output[11].imag = t1351;
+    output[12].real = t1381;
+    output[12].imag = t1382;
+    output[13].real = t1415;
+    output[13].imag = t1416;
+    output[14].real = t1446;
+    output[14].imag = t1447;
+    output[15].real = t1478;
+    output[15].imag = t1479;
+    output[16].real = t1048;
+    output[16].imag = t1049;
+    output[17].real = t1077;
+    output[17].imag = t1078;
+    output[18].real = t1102;
+    output[18].imag = t1103;
+    output[19].real = t1129;
+    output[19].imag = t1130;
+    output[20].real = t1154;
+    output[20].imag = t1155;
+    output[21].real = t1183;
+    output[21].imag = t1184;
+    output[22].real = t1211;
+    output[22].imag = t1212;
+    output[23].real = t1240;
+    output[23].imag = t1241;
+    output[24].real = t1264;
+    output[24].imag = t1265;
+    output[25].real = t1294;
+    output[25].imag = t1295;
+    output[26].real = t1322;
+    output[26].imag = t1323;
+    output[27].real = t1355;
+    output[27].imag = t1356;
+    output[28].real = t1386;
+    output[28].imag = t1387;
+    output[29].real = t1420;
+    output[29].imag = t1421;
+    output[30].real = t1451;
+    output[30].imag = t1452;
+    output[31].real = t1483;
+    output[31].imag = t1484;
+    output[32].real = t1045;
+    output[32].imag = t1046;
+    output[33].real = t1074;
+    output[33].imag = t1075;
+    output[34].real = t1099;
+    output[34].imag = t1100;
+    output[35].real = t1126;
+    output[35].imag = t1127;
+    output[36].real = t1151;
+    output[36].imag = t1152;
+    output[37].real = t1180;
+    output[37].imag = t1181;
+    output[38].real = t1208;
+    output[38].imag = t1209;
+    output[39].real = t1237;
+    output[39].imag = t1238;
+    output[40].real = t1261;
+    output[40].imag = t1262;
+    output[41].real = t1291;
+    output[41].imag = t1292;
+    output[42].real = t1319;
+    output[42].imag = t1320;
+    output[43].real = t1352;
+    output[43].imag = t1353;
+    output[44].real = t1383;
+    output[44].imag = t1384;
+    output[45].real = t1417;
+    output[45].imag = t1418;
+    output[46].real = t1448;
+    output[46].imag = t1449;
+    output[47].real = t1480;
+    output[47].imag = t1481;
+    output[48].real = t1050;
+    output[48].imag = t1051;
+    output[49].real = t1079;
+    output[49].imag = t1080;
+    output[50].real = t1104;
+    output[50].imag = t1105;
+    output[51].real = t1131;
+    output[51].imag = t1132;
+    output[52].real = t1156;
+    output[52].imag = t1157;
+    output[53].real = t1185;
+    output[53].imag = t1186;
+    output[54].real = t1213;
+    output[54].imag = t1214;
+    output[55].real = t1242;
+    output[55].imag = t1243;
+    output[56].real = t1266;
+    output[56].imag = t1267;
+    output[57].real = t1296;
+    output[57].imag = t1297;
+    output[58].real = t1324;
+    output[58].imag = t1325;
+    output[59].real = t1357;
+    output[59].imag = t1358;
+    output[60].real = t1388;
+    output[60].imag = t1389;
+    output[61].real = t1422;
+    output[61].imag = t1423;
+    output[62].real = t1453;
+    output[62].imag = t1454;
+    output[63].real = t1485;
+    output[63].imag = t1486;
+}
+
+} // anonymous namespace
+
+bool fft_codelet_default(const CkFftComplex* input, CkFftComplex* output, CkFftSize count, bool inverse, CkFftSize stride)
+{
+    switch (count)
+    {
+        case 8:
+            if (inverse)
+            {
+                codelet_8_inv(input, output, stride);
+            }
+            else
+            {
+                codelet_8_fwd(input, output, stride);
+            }
+            return true;
+
+        case 16:
+            if (inverse)
+            {
+                codelet_16_inv(input, output, stride);
+            }
+            else
+            {
+                codelet_16_fwd(input, output, stride);
+            }
+            return true;
+
+        case 32:
+            if (inverse)
+            {
+                codelet_32_inv(input, output, stride);
+            }
+            else
+            {
+                codelet_32_fwd(input, output, stride);
+            }
+            return true;
+
+        case 64:
+            if (inverse)
+            {
+                codelet_64_inv(input, output, stride);
+            }
+            else
+            {
+                codelet_64_fwd(input, output, stride);
+            }
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+} // namespace ckfft
@@ -0,0 +1,22 @@
+#pragma once
+#include "ckfft/ckfft.h"
+
+
+namespace ckfft
+{
+
+// Straight-line DFT of size count (8, 16, 32 or 64), reading input with the
+// given stride and writing count contiguous output values.
+// Returns false if there is no codelet for this size.
+//
+// Generated by etc/codelets/gen_codelets.py.
+bool fft_codelet_default(
+        const CkFftComplex* input, 
+        CkFftComplex* output, 
+        CkFftSize count, 
+        bool inverse,
+        CkFftSize stride);
+
+}
+
+
@@ -0,0 +1,4162 @@
+// Generated by etc/codelets/gen_codelets.py; do not edit.
+
+#include "ckfft/platform.h"
+#include "ckfft/fft_codelets_neon.h"
+
+#if CKFFT_ARM_NEON
+#  include <arm_neon.h>
+#endif
+
+namespace ckfft
+{
+
+#if CKFFT_ARM_NEON
+
+namespace
+{
+
+// load element from each of 4 transforms (transform j at p + j*stride)
+inline float32x4x2_t load4(const CkFftComplex* p, CkFftSize stride)
+{
+    float32x4x2_t v;
+    if (stride == 1)
+    {
+        v = vld2q_f32((const float32_t*) p);
+    }
+    else
+    {
+        v = vld2q_lane_f32((const float32_t*) p, v, 0);
+        p += stride;
+        v = vld2q_lane_f32((const float32_t*) p, v, 1);
+        p += stride;
+        v = vld2q_lane_f32((const float32_t*) p, v, 2);
+        p += stride;
+        v = vld2q_lane_f32((const float32_t*) p, v, 3);
+    }
+    return v;
+}
+
+// transpose 4 consecutive elements of 4 transforms, and store each transform's
+// elements contiguously (transform j at p + j*n)
+inline void store4(CkFftComplex* p, CkFftSize n,
+        float32x4_t r0, float32x4_t i0,
+        float32x4_t r1, float32x4_t i1,
+        float32x4_t r2, float32x4_t i2,
+        float32x4_t r3, float32x4_t i3)
+{
+    float32x4x2_t r01 = vtrnq_f32(r0, r1);
+    float32x4x2_t r23 = vtrnq_f32(r2, r3);
+    float32x4x2_t i01 = vtrnq_f32(i0, i1);
+    float32x4x2_t i23 = vtrnq_f32(i2, i3);
+
+    float32x4x2_t v;
+    v.val[0] = vcombine_f32(vget_low_f32(r01.val[0]), vget_low_f32(r23.val[0]));
+    v.val[1] = vcombine_f32(vget_low_f32(i01.val[0]), vget_low_f32(i23.val[0]));
+    vst2q_f32((float32_t*) p, v);
+    p += n;
+    v.val[0] = vcombine_f32(vget_low_f32(r01.val[1]), vget_low_f32(r23.val[1]));
+    v.val[1] = vcombine_f32(vget_low_f32(i01.val[1]), vget_low_f32(i23.val[1]));
+    vst2q_f32((float32_t*) p, v);
+    p += n;
+    v.val[0] = vcombine_f32(vget_high_f32(r01.val[0]), vget_high_f32(r23.val[0]));
+    v.val[1] = vcombine_f32(vget_high_f32(i01.val[0]), vget_high_f32(i23.val[0]));
+    vst2q_f32((float32_t*) p, v);
+    p += n;
+    v.val[0] = vcombine_f32(vget_high_f32(r01.val[1]), vget_high_f32(r23.val[1]));
+    v.val[1] = vcombine_f32(vget_high_f32(i01.val[1]), vget_high_f32(i23.val[1]));
+    vst2q_f32((float32_t*) p, v);
+}
+
+// 52 additions, 4 multiplications (x4)
+void codelet_8_fwd_x4(const CkFftComplex* input, CkFftComplex* output, CkFftSize stride)
+{
+    CkFftSize stride4 = stride * 4;
+    const float32x4x2_t x0 = load4(input + 0*stride4, stride);
+    const float32x4x2_t x4 = load4(input + 4*stride4, stride);
+    const float32x4_t t17 = vaddq_f32(x0.val[0], x4.val[0]);
+    const float32x4x2_t x2 = load4(input + 2*stride4, stride);
+    const float32x4x2_t x6 = load4(input + 6*stride4, stride);
+    const float32x4_t t21 = vaddq_f32(x2.val[0], x6.val[0]);
+    const float32x4_t t25 = vaddq_f32(t17, t21);
+    const float32x4x2_t x1 = load4(input + 1*stride4, stride);
+    const float32x4x2_t x5 = load4(input + 5*stride4, stride);
+    const float32x4_t t34 = vaddq_f32(x1.val[0], x5.val[0]);
+    const float32x4x2_t x3 = load4(input + 3*stride4, stride);
+    const float32x4x2_t x7 = load4(input + 7*stride4, stride);
+    const float32x4_t t38 = vaddq_f32(x3.val[0], x7.val[0]);
+    const float32x4_t t42 = vaddq_f32(t34, t38);
+    const float32x4_t t46 = vaddq_f32(t25, t42);
+    const float32x4_t t18 = vaddq_f32(x0.val[1], x4.val[1]);
+    const float32x4_t t22 = vaddq_f32(x2.val[1], x6.val[1]);
+    const float32x4_t t26 = vaddq_f32(t18, t22);
+    const float32x4_t t35 = vaddq_f32(x1.val[1], x5.val[1]);
+    const float32x4_t t39 = vaddq_f32(x3.val[1], x7.val[1]);
+    const float32x4_t t43 = vaddq_f32(t35, t39);
+    const float32x4_t t47 = vaddq_f32(t26, t43);
+    const float32x4_t t19 = vsubq_f32(x0.val[0], x4.val[0]);
+    const float32x4_t t24 = vsubq_f32(x2.val[1], x6.val[1]);
+    const float32x4_t t30 = vaddq_f32(t19, t24);
+    const float32x4_t t36 = vsubq_f32(x1.val[0], x5.val[0]);
+    const float32x4_t t37 = vsubq_f32(x1.val[1], x5.val[1]);
+    const float32x4_t t55 = vaddq_f32(t36, t37);
+    const float32x4_t t57 = vmulq_n_f32(t55, 0.707106781f);
+    const float32x4_t t40 = vsubq_f32(x3.val[0], x7.val[0]);
+    const float32x4_t t41 = vsubq_f32(x3.val[1], x7.val[1]);
+    const float32x4_t t62 = vsubq_f32(t40, t41);
+    const float32x4_t t63 = vmulq_n_f32(t62, 0.707106781f);
+    const float32x4_t t68 = vsubq_f32(t57, t63);
+    const float32x4_t t74 = vaddq_f32(t30, t68);
+    const float32x4_t t20 = vsubq_f32(x0.val[1], x4.val[1]);
+    const float32x4_t t23 = vsubq_f32(x2.val[0], x6.val[0]);
+    const float32x4_t t31 = vsubq_f32(t20, t23);
+    const float32x4_t t58 = vsubq_f32(t36, t37);
+    const float32x4_t t60 = vmulq_n_f32(t58, 0.707106781f);
+    const float32x4_t t65 = vaddq_f32(t40, t41);
+    const float32x4_t t66 = vmulq_n_f32(t65, 0.707106781f);
+    const float32x4_t t69 = vaddq_f32(t60, t66);
+    const float32x4_t t75 = vsubq_f32(t31, t69);
+    const float32x4_t t27 = vsubq_f32(t17, t21);
+    const float32x4_t t45 = vsubq_f32(t35, t39);
+    const float32x4_t t51 = vaddq_f32(t27, t45);
+    const float32x4_t t28 = vsubq_f32(t18, t22);
+    const float32x4_t t44 = vsubq_f32(t34, t38);
+    const float32x4_t t52 = vsubq_f32(t28, t44);
+    const float32x4_t t32 = vsubq_f32(t19, t24);
+    const float32x4_t t72 = vsubq_f32(t60, t66);
+    const float32x4_t t79 = vsubq_f32(t32, t72);
+    const float32x4_t t33 = vaddq_f32(t20, t23);
+    const float32x4_t t71 = vaddq_f32(t57, t63);
+    const float32x4_t t80 = vsubq_f32(t33, t71);
+    const float32x4_t t48 = vsubq_f32(t25, t42);
+    const float32x4_t t49 = vsubq_f32(t26, t43);
+    const float32x4_t t76 = vsubq_f32(t30, t68);
+    const float32x4_t t77 = vaddq_f32(t31, t69);
+    const float32x4_t t53 = vsubq_f32(t27, t45);
+    const float32x4_t t54 = vaddq_f32(t28, t44);
+    const float32x4_t t81 = vaddq_f32(t32, t72);
+    const float32x4_t t82 = vaddq_f32(t33, t71);
+    store4(output + 0, 8, t46, t47, t74, t75, t51, t52, t79, t80);
+    store4(output + 4, 8, t48, t49, t76, t77, t53, t54, t81, t82);
+}
+
+// 52 additions, 4 multiplications (x4)
+void codelet_8_inv_x4(const CkFftComplex* input, CkFftComplex* output, CkFftSize stride)
+{
+    CkFftSize stride4 = stride * 4;
+    const float32x4x2_t x0 = load4(input + 0*stride4, stride);
+    const float32x4x2_t x4 = load4(input + 4*stride4, stride);
+    const float32x4_t t17 = vaddq_f32(x0.val[0], x4.val[0]);
+    const float32x4x2_t x2 = load4(input + 2*stride4, stride);
+    const float32x4x2_t x6 = load4(input + 6*stride4, stride);
+    const float32x4_t t21 = vaddq_f32(x2.val[0], x6.val[0]);
+    const float32x4_t t25 = vaddq_f32(t17, t21);
+    const float32x4x2_t x1 = load4(input + 1*stride4, stride);
+    const float32x4x2_t x5 = load4(input + 5*stride4, stride);
+    const float32x4_t t34 = vaddq_f32(x1.val[0], x5.val[0]);
+    const float32x4x2_t x3 = load4(input + 3*stride4, stride);
+    const float32x4x2_t x7 = load4(input + 7*stride4, stride);
+    const float32x4_t t38 = vaddq_f32(x3.val[0], x7.val[0]);
+    const float32x4_t t42 = vaddq_f32(t34, t38);
+    const float32x4_t t46 = vaddq_f32(t25, t42);
+    const float32x4_t t18 = vaddq_f32(x0.val[1], x4.val[1]);
+    const float32x4_t t22 = vaddq_f32(x2.val[1], x6.val[1]);
+    const float32x4_t t26 = vaddq_f32(t18, t22);
+    const float32x4_t t35 = vaddq_f32(x1.val[1], x5.val[1]);
+    const float32x4_t t39 = vaddq_f32(x3.val[1], x7.val[1]);
+    const float32x4_t t43 = vaddq_f32(t35, t39);
+    const float32x4_t t47 = vaddq_f32(t26, t43);
+    const float32x4_t t19 = vsubq_f32(x0.val[0], x4.val[0]);
+    const float32x4_t t24 = vsubq_f32(x2.val[1], x6.val[1]);
+    const float32x4_t t30 = vsubq_f32(t19, t24);
+    const float32x4_t t36 = vsubq_f32(x1.val[0], x5.val[0]);
+    const float32x4_t t37 = vsubq_f32(x1.val[1], x5.val[1]);
+    const float32x4_t t55 = vsubq_f32(t36, t37);
+    const float32x4_t t57 = vmulq_n_f32(t55, 0.707106781f);
+    const float32x4_t t40 = vsubq_f32(x3.val[0], x7.val[0]);
+    const float32x4_t t41 = vsubq_f32(x3.val[1], x7.val[1]);
+    const float32x4_t t60 = vaddq_f32(t40, t41);
+    const float32x4_t t61 = vmulq_n_f32(t60, 0.707106781f);
+    const float32x4_t t67 = vsubq_f32(t57, t61);
+    const float32x4_t t71 = vaddq_f32(t30, t67);
+    const float32x4_t t20 = vsubq_f32(x0.val[1], x4.val[1]);
+    const float32x4_t t23 = vsubq_f32(x2.val[0], x6.val[0]);
+    const float32x4_t t31 = vaddq_f32(t20, t23);
+    const float32x4_t t58 = vaddq_f32(t36, t37);
+    const float32x4_t t59 = vmulq_n_f32(t58, 0.707106781f);
+    const float32x4_t t63 = vsubq_f32(t40, t41);
+    const float32x4_t t65 = vmulq_n_f32(t63, 0.707106781f);
+    const float32x4_t t68 = vaddq_f32(t59, t65);
+    const float32x4_t t72 = vaddq_f32(t31, t68);
+    const float32x4_t t27 = vsubq_f32(t17, t21);
+    const float32x4_t t45 = vsubq_f32(t35, t39);
+    const float32x4_t t51 = vsubq_f32(t27, t45);
+    const float32x4_t t28 = vsubq_f32(t18, t22);
+    const float32x4_t t44 = vsubq_f32(t34, t38);
+    const float32x4_t t52 = vaddq_f32(t28, t44);
+    const float32x4_t t32 = vaddq_f32(t19, t24);
+    const float32x4_t t70 = vsubq_f32(t59, t65);
+    const float32x4_t t76 = vsubq_f32(t32, t70);
+    const float32x4_t t33 = vsubq_f32(t20, t23);
+    const float32x4_t t69 = vaddq_f32(t57, t61);
+    const float32x4_t t77 = vaddq_f32(t33, t69);
+    const float32x4_t t48 = vsubq_f32(t25, t42);
+    const float32x4_t t49 = vsubq_f32(t26, t43);
+    const float32x4_t t73 = vsubq_f32(t30, t67);
+    const float32x4_t t74 = vsubq_f32(t31, t68);
+    const float32x4_t t53 = vaddq_f32(t27, t45);
+    const float32x4_t t54 = vsubq_f32(t28, t44);
+    const float32x4_t t78 = vaddq_f32(t32, t70);
+    const float32x4_t t79 = vsubq_f32(t33, t69);
+    store4(output + 0, 8, t46, t47, t71, t72, t51, t52, t76, t77);
+    store4(output + 4, 8, t48, t49, t73, t74, t53, t54, t78, t79);
+}
+
+// 144 additions, 24 multiplications (x4)
+void codelet_16_fwd_x4(const CkFftComplex* input, CkFftComplex* output, CkFftSize stride)
+{
+    CkFftSize stride4 = stride * 4;
+    const float32x4x2_t x0 = load4(input + 0*stride4, stride);
+    const float32x4x2_t x8 = load4(input + 8*stride4, stride);
+    const float32x4_t t33 = vaddq_f32(x0.val[0], x8.val[0]);
+    const float32x4x2_t x4 = load4(input + 4*stride4, stride);
+    const float32x4x2_t x12 = load4(input + 12*stride4, stride);
+    const float32x4_t t37 = vaddq_f32(x4.val[0], x12.val[0]);
+    const float32x4_t t41 = vaddq_f32(t33, t37);
+    const float32x4x2_t x2 = load4(input + 2*stride4, stride);
+    const float32x4x2_t x10 = load4(input + 10*stride4, stride);
+    const float32x4_t t50 = vaddq_f32(x2.val[0], x10.val[0]);
+    const float32x4x2_t x6 = load4(input + 6*stride4, stride);
+    const float32x4x2_t x14 = load4(input + 14*stride4, stride);
+    const float32x4_t t54 = vaddq_f32(x6.val[0], x14.val[0]);
+    const float32x4_t t58 = vaddq_f32(t50, t54);
+    const float32x4_t t62 = vaddq_f32(t41, t58);
+    const float32x4x2_t x1 = load4(input + 1*stride4, stride);
+    const float32x4x2_t x9 = load4(input + 9*stride4, stride);
+    const float32x4_t t99 = vaddq_f32(x1.val[0], x9.val[0]);
+    const float32x4x2_t x5 = load4(input + 5*stride4, stride);
+    const float32x4x2_t x13 = load4(input + 13*stride4, stride);
+    const float32x4_t t103 = vaddq_f32(x5.val[0], x13.val[0]);
+    const float32x4_t t107 = vaddq_f32(t99, t103);
+    const float32x4x2_t x3 = load4(input + 3*stride4, stride);
+    const float32x4x2_t x11 = load4(input + 11*stride4, stride);
+    const float32x4_t t116 = vaddq_f32(x3.val[0], x11.val[0]);
+    const float32x4x2_t x7 = load4(input + 7*stride4, stride);
+    const float32x4x2_t x15 = load4(input + 15*stride4, stride);
+    const float32x4_t t120 = vaddq_f32(x7.val[0], x15.val[0]);
+    const float32x4_t t124 = vaddq_f32(t116, t120);
+    const float32x4_t t133 = vaddq_f32(t107, t124);
+    const float32x4_t t137 = vaddq_f32(t62, t133);
+    const float32x4_t t34 = vaddq_f32(x0.val[1], x8.val[1]);
+    const float32x4_t t38 = vaddq_f32(x4.val[1], x12.val[1]);
+    const float32x4_t t42 = vaddq_f32(t34, t38);
+    const float32x4_t t51 = vaddq_f32(x2.val[1], x10.val[1]);
+    const float32x4_t t55 = vaddq_f32(x6.val[1], x14.val[1]);
+    const float32x4_t t59 = vaddq_f32(t51, t55);
+    const float32x4_t t63 = vaddq_f32(t42, t59);
+    const float32x4_t t100 = vaddq_f32(x1.val[1], x9.val[1]);
+    const float32x4_t t104 = vaddq_f32(x5.val[1], x13.val[1]);
+    const float32x4_t t108 = vaddq_f32(t100, t104);
+    const float32x4_t t117 = vaddq_f32(x3.val[1], x11.val[1]);
+    const float32x4_t t121 = vaddq_f32(x7.val[1], x15.val[1]);
+    const float32x4_t t125 = vaddq_f32(t117, t121);
+    const float32x4_t t134 = vaddq_f32(t108, t125);
+    const float32x4_t t138 = vaddq_f32(t63, t134);
+    const float32x4_t t35 = vsubq_f32(x0.val[0], x8.val[0]);
+    const float32x4_t t40 = vsubq_f32(x4.val[1], x12.val[1]);
+    const float32x4_t t46 = vaddq_f32(t35, t40);
+    const float32x4_t t52 = vsubq_f32(x2.val[0], x10.val[0]);
+    const float32x4_t t53 = vsubq_f32(x2.val[1], x10.val[1]);
+    const float32x4_t t71 = vaddq_f32(t52, t53);
+    const float32x4_t t73 = vmulq_n_f32(t71, 0.707106781f);
+    const float32x4_t t56 = vsubq_f32(x6.val[0], x14.val[0]);
+    const float32x4_t t57 = vsubq_f32(x6.val[1], x14.val[1]);
+    const float32x4_t t78 = vsubq_f32(t56, t57);
+    const float32x4_t t79 = vmulq_n_f32(t78, 0.707106781f);
+    const float32x4_t t84 = vsubq_f32(t73, t79);
+    const float32x4_t t90 = vaddq_f32(t46, t84);
+    const float32x4_t t101 = vsubq_f32(x1.val[0], x9.val[0]);
+    const float32x4_t t106 = vsubq_f32(x5.val[1], x13.val[1]);
+    const float32x4_t t112 = vaddq_f32(t101, t106);
+    const float32x4_t t147 = vmulq_n_f32(t112, 0.923879533f);
+    const float32x4_t t102 = vsubq_f32(x1.val[1], x9.val[1]);
+    const float32x4_t t105 = vsubq_f32(x5.val[0], x13.val[0]);
+    const float32x4_t t113 = vsubq_f32(t102, t105);
+    const float32x4_t t149 = vmulq_n_f32(t113, 0.382683432f);
+    const float32x4_t t151 = vaddq_f32(t147, t149);
+    const float32x4_t t118 = vsubq_f32(x3.val[0], x11.val[0]);
+    const float32x4_t t123 = vsubq_f32(x7.val[1], x15.val[1]);
+    const float32x4_t t129 = vaddq_f32(t118, t123);
+    const float32x4_t t158 = vmulq_n_f32(t129, 0.382683432f);
+    const float32x4_t t119 = vsubq_f32(x3.val[1], x11.val[1]);
+    const float32x4_t t122 = vsubq_f32(x7.val[0], x15.val[0]);
+    const float32x4_t t130 = vsubq_f32(t119, t122);
+    const float32x4_t t159 = vmulq_n_f32(t130, 0.923879533f);
+    const float32x4_t t161 = vaddq_f32(t158, t159);
+    const float32x4_t t167 = vaddq_f32(t151, t161);
+    const float32x4_t t173 = vaddq_f32(t90, t167);
+    const float32x4_t t36 = vsubq_f32(x0.val[1], x8.val[1]);
+    const float32x4_t t39 = vsubq_f32(x4.val[0], x12.val[0]);
+    const float32x4_t t47 = vsubq_f32(t36, t39);
+    const float32x4_t t74 = vsubq_f32(t52, t53);
+    const float32x4_t t76 = vmulq_n_f32(t74, 0.707106781f);
+    const float32x4_t t81 = vaddq_f32(t56, t57);
+    const float32x4_t t82 = vmulq_n_f32(t81, 0.707106781f);
+    const float32x4_t t85 = vaddq_f32(t76, t82);
+    const float32x4_t t91 = vsubq_f32(t47, t85);
+    const float32x4_t t152 = vmulq_n_f32(t112, 0.382683432f);
+    const float32x4_t t154 = vmulq_n_f32(t113, 0.923879533f);
+    const float32x4_t t155 = vsubq_f32(t152, t154);
+    const float32x4_t t162 = vmulq_n_f32(t129, 0.923879533f);
+    const float32x4_t t164 = vmulq_n_f32(t130, 0.382683432f);
+    const float32x4_t t165 = vsubq_f32(t162, t164);
+    const float32x4_t t168 = vaddq_f32(t155, t165);
+    const float32x4_t t174 = vsubq_f32(t91, t168);
+    const float32x4_t t43 = vsubq_f32(t33, t37);
+    const float32x4_t t61 = vsubq_f32(t51, t55);
+    const float32x4_t t67 = vaddq_f32(t43, t61);
+    const float32x4_t t109 = vsubq_f32(t99, t103);
+    const float32x4_t t110 = vsubq_f32(t100, t104);
+    const float32x4_t t182 = vaddq_f32(t109, t110);
+    const float32x4_t t183 = vmulq_n_f32(t182, 0.707106781f);
+    const float32x4_t t126 = vsubq_f32(t116, t120);
+    const float32x4_t t127 = vsubq_f32(t117, t121);
+    const float32x4_t t188 = vsubq_f32(t126, t127);
+    const float32x4_t t189 = vmulq_n_f32(t188, 0.707106781f);
+    const float32x4_t t194 = vsubq_f32(t183, t189);
+    const float32x4_t t200 = vaddq_f32(t67, t194);
+    const float32x4_t t44 = vsubq_f32(t34, t38);
+    const float32x4_t t60 = vsubq_f32(t50, t54);
+    const float32x4_t t68 = vsubq_f32(t44, t60);
+    const float32x4_t t184 = vsubq_f32(t109, t110);
+    const float32x4_t t186 = vmulq_n_f32(t184, 0.707106781f);
+    const float32x4_t t191 = vaddq_f32(t126, t127);
+    const float32x4_t t192 = vmulq_n_f32(t191, 0.707106781f);
+    const float32x4_t t195 = vaddq_f32(t186, t192);
+    const float32x4_t t201 = vsubq_f32(t68, t195);
+    const float32x4_t t48 = vsubq_f32(t35, t40);
+    const float32x4_t t88 = vsubq_f32(t76, t82);
+    const float32x4_t t95 = vsubq_f32(t48, t88);
+    const float32x4_t t114 = vsubq_f32(t101, t106);
+    const float32x4_t t209 = vmulq_n_f32(t114, 0.382683432f);
+    const float32x4_t t115 = vaddq_f32(t102, t105);
+    const float32x4_t t210 = vmulq_n_f32(t115, 0.923879533f);
+    const float32x4_t t212 = vaddq_f32(t209, t210);
+    const float32x4_t t131 = vsubq_f32(t118, t123);
+    const float32x4_t t219 = vmulq_n_f32(t131, 0.923879533f);
+    const float32x4_t t132 = vaddq_f32(t119, t122);
+    const float32x4_t t222 = vmulq_n_f32(t132, 0.382683432f);
+    const float32x4_t t223 = vaddq_f32(t219, t222);
+    const float32x4_t t229 = vsubq_f32(t212, t223);
+    const float32x4_t t235 = vaddq_f32(t95, t229);
+    const float32x4_t t49 = vaddq_f32(t36, t39);
+    const float32x4_t t87 = vaddq_f32(t73, t79);
+    const float32x4_t t96 = vsubq_f32(t49, t87);
+    const float32x4_t t213 = vmulq_n_f32(t114, 0.923879533f);
+    const float32x4_t t215 = vmulq_n_f32(t115, 0.382683432f);
+    const float32x4_t t216 = vsubq_f32(t213, t215);
+    const float32x4_t t225 = vmulq_n_f32(t131, 0.382683432f);
+    const float32x4_t t226 = vmulq_n_f32(t132, 0.923879533f);
+    const float32x4_t t228 = vsubq_f32(t225, t226);
+    const float32x4_t t230 = vsubq_f32(t216, t228);
+    const float32x4_t t236 = vsubq_f32(t96, t230);
+    const float32x4_t t64 = vsubq_f32(t41, t58);
+    const float32x4_t t136 = vsubq_f32(t108, t125);
+    const float32x4_t t142 = vaddq_f32(t64, t136);
+    const float32x4_t t65 = vsubq_f32(t42, t59);
+    const float32x4_t t135 = vsubq_f32(t107, t124);
+    const float32x4_t t143 = vsubq_f32(t65, t135);
+    const float32x4_t t92 = vsubq_f32(t46, t84);
+    const float32x4_t t171 = vsubq_f32(t155, t165);
+    const float32x4_t t178 = vsubq_f32(t92, t171);
+    const float32x4_t t93 = vaddq_f32(t47, t85);
+    const float32x4_t t170 = vsubq_f32(t151, t161);
+    const float32x4_t t179 = vsubq_f32(t93, t170);
+    const float32x4_t t69 = vsubq_f32(t43, t61);
+    const float32x4_t t198 = vsubq_f32(t186, t192);
+    const float32x4_t t205 = vsubq_f32(t69, t198);
+    const float32x4_t t70 = vaddq_f32(t44, t60);
+    const float32x4_t t197 = vaddq_f32(t183, t189);
+    const float32x4_t t206 = vsubq_f32(t70, t197);
+    const float32x4_t t97 = vaddq_f32(t48, t88);
+    const float32x4_t t233 = vaddq_f32(t216, t228);
+    const float32x4_t t240 = vsubq_f32(t97, t233);
+    const float32x4_t t98 = vaddq_f32(t49, t87);
+    const float32x4_t t232 = vaddq_f32(t212, t223);
+    const float32x4_t t241 = vsubq_f32(t98, t232);
+    const float32x4_t t139 = vsubq_f32(t62, t133);
+    const float32x4_t t140 = vsubq_f32(t63, t134);
+    const float32x4_t t175 = vsubq_f32(t90, t167);
+    const float32x4_t t176 = vaddq_f32(t91, t168);
+    const float32x4_t t202 = vsubq_f32(t67, t194);
+    const float32x4_t t203 = vaddq_f32(t68, t195);
+    const float32x4_t t237 = vsubq_f32(t95, t229);
+    const float32x4_t t238 = vaddq_f32(t96, t230);
+    const float32x4_t t144 = vsubq_f32(t64, t136);
+    const float32x4_t t145 = vaddq_f32(t65, t135);
+    const float32x4_t t180 = vaddq_f32(t92, t171);
+    const float32x4_t t181 = vaddq_f32(t93, t170);
+    const float32x4_t t207 = vaddq_f32(t69, t198);
+    const float32x4_t t208 = vaddq_f32(t70, t197);
+    const float32x4_t t242 = vaddq_f32(t97, t233);
+    const float32x4_t t243 = vaddq_f32(t98, t232);
+    store4(output + 0, 16, t137, t138, t173, t174, t200, t201, t235, t236);
+    store4(output + 4, 16, t142, t143, t178, t179, t205, t206, t240, t241);
+    store4(output + 8, 16, t139, t140, t175, t176, t202, t203, t237, t238);
+    store4(output + 12, 16, t144, t145, t180, t181, t207, t208, t242, t243);
+}
+
+// 144 additions, 24 multiplications (x4)
+void codelet_16_inv_x4(const CkFftComplex* input, CkFftComplex* output, CkFftSize stride)
+{
+    CkFftSize stride4 = stride * 4;
+    const float32x4x2_t x0 = load4(input + 0*stride4, stride);
+    const float32x4x2_t x8 = load4(input + 8*stride4, stride);
+    const float32x4_t t33 = vaddq_f32(x0.val[0], x8.val[0]);
+    const float32x4x2_t x4 = load4(input + 4*stride4, stride);
+    const float32x4x2_t x12 = load4(input + 12*stride4, stride);
+    const float32x4_t t37 = vaddq_f32(x4.val[0], x12.val[0]);
+    const float32x4_t t41 = vaddq_f32(t33, t37);
+    const float32x4x2_t x2 = load4(input + 2*stride4, stride);
+    const float32x4x2_t x10 = load4(input + 10*stride4, stride);
+    const float32x4_t t50 = vaddq_f32(x2.val[0], x10.val[0]);
+    const float32x4x2_t x6 = load4(input + 6*stride4, stride);
+    const float32x4x2_t x14 = load4(input + 14*stride4, stride);
+    const float32x4_t t54 = vaddq_f32(x6.val[0], x14.val[0]);
+    const float32x4_t t58 = vaddq_f32(t50, t54);
+    const float32x4_t t62 = vaddq_f32(t41, t58);
+    const float32x4x2_t x1 = load4(input + 1*stride4, stride);
+    const float32x4x2_t x9 = load4(input + 9*stride4, stride);
+    const float32x4_t t96 = vaddq_f32(x1.val[0], x9.val[0]);
+    const float32x4x2_t x5 = load4(input + 5*stride4, stride);
+    const float32x4x2_t x13 = load4(input + 13*stride4, stride);
+    const float32x4_t t100 = vaddq_f32(x5.val[0], x13.val[0]);
+    const float32x4_t t104 = vaddq_f32(t96, t100);
+    const float32x4x2_t x3 = load4(input + 3*stride4, stride);
+    const float32x4x2_t x11 = load4(input + 11*stride4, stride);
+    const float32x4_t t113 = vaddq_f32(x3.val[0], x11.val[0]);
+    const float32x4x2_t x7 = load4(input + 7*stride4, stride);
+    const float32x4x2_t x15 = load4(input + 15*stride4, stride);
+    const float32x4_t t117 = vaddq_f32(x7.val[0], x15.val[0]);
+    const float32x4_t t121 = vaddq_f32(t113, t117);
+    const float32x4_t t130 = vaddq_f32(t104, t121);
+    const float32x4_t t134 = vaddq_f32(t62, t130);
+    const float32x4_t t34 = vaddq_f32(x0.val[1], x8.val[1]);
+    const float32x4_t t38 = vaddq_f32(x4.val[1], x12.val[1]);
+    const float32x4_t t42 = vaddq_f32(t34, t38);
+    const float32x4_t t51 = vaddq_f32(x2.val[1], x10.val[1]);
+    const float32x4_t t55 = vaddq_f32(x6.val[1], x14.val[1]);
+    const float32x4_t t59 = vaddq_f32(t51, t55);
+    const float32x4_t t63 = vaddq_f32(t42, t59);
+    const float32x4_t t97 = vaddq_f32(x1.val[1], x9.val[1]);
+    const float32x4_t t101 = vaddq_f32(x5.val[1], x13.val[1]);
+    const float32x4_t t105 = vaddq_f32(t97, t101);
+    const float32x4_t t114 = vaddq_f32(x3.val[1], x11.val[1]);
+    const float32x4_t t118 = vaddq_f32(x7.val[1], x15.val[1]);
+    const float32x4_t t122 = vaddq_f32(t114, t118);
+    const float32x4_t t131 = vaddq_f32(t105, t122);
+    const float32x4_t t135 = vaddq_f32(t63, t131);
+    const float32x4_t t35 = vsubq_f32(x0.val[0], x8.val[0]);
+    const float32x4_t t40 = vsubq_f32(x4.val[1], x12.val[1]);
+    const float32x4_t t46 = vsubq_f32(t35, t40);
+    const float32x4_t t52 = vsubq_f32(x2.val[0], x10.val[0]);
+    const float32x4_t t53 = vsubq_f32(x2.val[1], x10.val[1]);
+    const float32x4_t t71 = vsubq_f32(t52, t53);
+    const float32x4_t t73 = vmulq_n_f32(t71, 0.707106781f);
+    const float32x4_t t56 = vsubq_f32(x6.val[0], x14.val[0]);
+    const float32x4_t t57 = vsubq_f32(x6.val[1], x14.val[1]);
+    const float32x4_t t76 = vaddq_f32(t56, t57);
+    const float32x4_t t77 = vmulq_n_f32(t76, 0.707106781f);
+    const float32x4_t t83 = vsubq_f32(t73, t77);
+    const float32x4_t t87 = vaddq_f32(t46, t83);
+    const float32x4_t t98 = vsubq_f32(x1.val[0], x9.val[0]);
+    const float32x4_t t103 = vsubq_f32(x5.val[1], x13.val[1]);
+    const float32x4_t t109 = vsubq_f32(t98, t103);
+    const float32x4_t t144 = vmulq_n_f32(t109, 0.923879533f);
+    const float32x4_t t99 = vsubq_f32(x1.val[1], x9.val[1]);
+    const float32x4_t t102 = vsubq_f32(x5.val[0], x13.val[0]);
+    const float32x4_t t110 = vaddq_f32(t99, t102);
+    const float32x4_t t146 = vmulq_n_f32(t110, 0.382683432f);
+    const float32x4_t t147 = vsubq_f32(t144, t146);
+    const float32x4_t t115 = vsubq_f32(x3.val[0], x11.val[0]);
+    const float32x4_t t120 = vsubq_f32(x7.val[1], x15.val[1]);
+    const float32x4_t t126 = vsubq_f32(t115, t120);
+    const float32x4_t t152 = vmulq_n_f32(t126, 0.382683432f);
+    const float32x4_t t116 = vsubq_f32(x3.val[1], x11.val[1]);
+    const float32x4_t t119 = vsubq_f32(x7.val[0], x15.val[0]);
+    const float32x4_t t127 = vaddq_f32(t116, t119);
+    const float32x4_t t153 = vmulq_n_f32(t127, 0.923879533f);
+    const float32x4_t t154 = vsubq_f32(t152, t153);
+    const float32x4_t t158 = vaddq_f32(t147, t154);
+    const float32x4_t t162 = vaddq_f32(t87, t158);
+    const float32x4_t t36 = vsubq_f32(x0.val[1], x8.val[1]);
+    const float32x4_t t39 = vsubq_f32(x4.val[0], x12.val[0]);
+    const float32x4_t t47 = vaddq_f32(t36, t39);
+    const float32x4_t t74 = vaddq_f32(t52, t53);
+    const float32x4_t t75 = vmulq_n_f32(t74, 0.707106781f);
+    const float32x4_t t79 = vsubq_f32(t56, t57);
+    const float32x4_t t81 = vmulq_n_f32(t79, 0.707106781f);
+    const float32x4_t t84 = vaddq_f32(t75, t81);
+    const float32x4_t t88 = vaddq_f32(t47, t84);
+    const float32x4_t t148 = vmulq_n_f32(t109, 0.382683432f);
+    const float32x4_t t149 = vmulq_n_f32(t110, 0.923879533f);
+    const float32x4_t t150 = vaddq_f32(t148, t149);
+    const float32x4_t t155 = vmulq_n_f32(t126, 0.923879533f);
+    const float32x4_t t156 = vmulq_n_f32(t127, 0.382683432f);
+    const float32x4_t t157 = vaddq_f32(t155, t156);
+    const float32x4_t t159 = vaddq_f32(t150, t157);
+    const float32x4_t t163 = vaddq_f32(t88, t159);
+    const float32x4_t t43 = vsubq_f32(t33, t37);
+    const float32x4_t t61 = vsubq_f32(t51, t55);
+    const float32x4_t t67 = vsubq_f32(t43, t61);
+    const float32x4_t t106 = vsubq_f32(t96, t100);
+    const float32x4_t t107 = vsubq_f32(t97, t101);
+    const float32x4_t t171 = vsubq_f32(t106, t107);
+    const float32x4_t t172 = vmulq_n_f32(t171, 0.707106781f);
+    const float32x4_t t123 = vsubq_f32(t113, t117);
+    const float32x4_t t124 = vsubq_f32(t114, t118);
+    const float32x4_t t175 = vaddq_f32(t123, t124);
+    const float32x4_t t176 = vmulq_n_f32(t175, 0.707106781f);
+    const float32x4_t t182 = vsubq_f32(t172, t176);
+    const float32x4_t t186 = vaddq_f32(t67, t182);
+    const float32x4_t t44 = vsubq_f32(t34, t38);
+    const float32x4_t t60 = vsubq_f32(t50, t54);
+    const float32x4_t t68 = vaddq_f32(t44, t60);
+    const float32x4_t t173 = vaddq_f32(t106, t107);
+    const float32x4_t t174 = vmulq_n_f32(t173, 0.707106781f);
+    const float32x4_t t178 = vsubq_f32(t123, t124);
+    const float32x4_t t180 = vmulq_n_f32(t178, 0.707106781f);
+    const float32x4_t t183 = vaddq_f32(t174, t180);
+    const float32x4_t t187 = vaddq_f32(t68, t183);
+    const float32x4_t t48 = vaddq_f32(t35, t40);
+    const float32x4_t t86 = vsubq_f32(t75, t81);
+    const float32x4_t t92 = vsubq_f32(t48, t86);
+    const float32x4_t t111 = vaddq_f32(t98, t103);
+    const float32x4_t t195 = vmulq_n_f32(t111, 0.382683432f);
+    const float32x4_t t112 = vsubq_f32(t99, t102);
+    const float32x4_t t196 = vmulq_n_f32(t112, 0.923879533f);
+    const float32x4_t t197 = vsubq_f32(t195, t196);
+    const float32x4_t t128 = vaddq_f32(t115, t120);
+    const float32x4_t t202 = vmulq_n_f32(t128, 0.923879533f);
+    const float32x4_t t129 = vsubq_f32(t116, t119);
+    const float32x4_t t205 = vmulq_n_f32(t129, 0.382683432f);
+    const float32x4_t t207 = vsubq_f32(t202, t205);
+    const float32x4_t t215 = vsubq_f32(t197, t207);
+    const float32x4_t t219 = vaddq_f32(t92, t215);
+    const float32x4_t t49 = vsubq_f32(t36, t39);
+    const float32x4_t t85 = vaddq_f32(t73, t77);
+    const float32x4_t t93 = vaddq_f32(t49, t85);
+    const float32x4_t t198 = vmulq_n_f32(t111, 0.923879533f);
+    const float32x4_t t199 = vmulq_n_f32(t112, 0.382683432f);
+    const float32x4_t t200 = vaddq_f32(t198, t199);
+    const float32x4_t t209 = vmulq_n_f32(t128, 0.382683432f);
+    const float32x4_t t211 = vmulq_n_f32(t129, 0.923879533f);
+    const float32x4_t t213 = vaddq_f32(t209, t211);
+    const float32x4_t t216 = vsubq_f32(t200, t213);
+    const float32x4_t t220 = vaddq_f32(t93, t216);
+    const float32x4_t t64 = vsubq_f32(t41, t58);
+    const float32x4_t t133 = vsubq_f32(t105, t122);
+    const float32x4_t t139 = vsubq_f32(t64, t133);
+    const float32x4_t t65 = vsubq_f32(t42, t59);
+    const float32x4_t t132 = vsubq_f32(t104, t121);
+    const float32x4_t t140 = vaddq_f32(t65, t132);
+    const float32x4_t t89 = vsubq_f32(t46, t83);
+    const float32x4_t t161 = vsubq_f32(t150, t157);
+    const float32x4_t t167 = vsubq_f32(t89, t161);
+    const float32x4_t t90 = vsubq_f32(t47, t84);
+    const float32x4_t t160 = vsubq_f32(t147, t154);
+    const float32x4_t t168 = vaddq_f32(t90, t160);
+    const float32x4_t t69 = vaddq_f32(t43, t61);
+    const float32x4_t t185 = vsubq_f32(t174, t180);
+    const float32x4_t t191 = vsubq_f32(t69, t185);
+    const float32x4_t t70 = vsubq_f32(t44, t60);
+    const float32x4_t t184 = vaddq_f32(t172, t176);
+    const float32x4_t t192 = vaddq_f32(t70, t184);
+    const float32x4_t t94 = vaddq_f32(t48, t86);
+    const float32x4_t t218 = vaddq_f32(t200, t213);
+    const float32x4_t t224 = vsubq_f32(t94, t218);
+    const float32x4_t t95 = vsubq_f32(t49, t85);
+    const float32x4_t t217 = vaddq_f32(t197, t207);
+    const float32x4_t t225 = vaddq_f32(t95, t217);
+    const float32x4_t t136 = vsubq_f32(t62, t130);
+    const float32x4_t t137 = vsubq_f32(t63, t131);
+    const float32x4_t t164 = vsubq_f32(t87, t158);
+    const float32x4_t t165 = vsubq_f32(t88, t159);
+    const float32x4_t t188 = vsubq_f32(t67, t182);
+    const float32x4_t t189 = vsubq_f32(t68, t183);
+    const float32x4_t t221 = vsubq_f32(t92, t215);
+    const float32x4_t t222 = vsubq_f32(t93, t216);
+    const float32x4_t t141 = vaddq_f32(t64, t133);
+    const float32x4_t t142 = vsubq_f32(t65, t132);
+    const float32x4_t t169 = vaddq_f32(t89, t161);
+    const float32x4_t t170 = vsubq_f32(t90, t160);
+    const float32x4_t t193 = vaddq_f32(t69, t185);
+    const float32x4_t t194 = vsubq_f32(t70, t184);
+    const float32x4_t t226 = vaddq_f32(t94, t218);
+    const float32x4_t t227 = vsubq_f32(t95, t217);
+    store4(output + 0, 16, t134, t135, t162, t163, t186, t187, t219, t220);
+    store4(output + 4, 16, t139, t140, t167, t168, t191, t192, t224, t225);
+    store4(output + 8, 16, t136, t137, t164, t165, t188, t189, t221, t222);
+    store4(output + 12, 16, t141, t142, t169, t170, t193, t194, t226, t227);
+}
+
+// 372 additions, 84 multiplications (x4)
+void codelet_32_fwd_x4(const CkFftComplex* input, CkFftComplex* output, CkFftSize stride)
+{
+    CkFftSize stride4 = stride * 4;
+    const float32x4x2_t x0 = load4(input + 0*stride4, stride);
+    const float32x4x2_t x16 = load4(input + 16*stride4, stride);
+    const float32x4_t t65 = vaddq_f32(x0.val[0], x16.val[0]);
+    const float32x4x2_t x8 = load4(input + 8*stride4, stride);
+    const float32x4x2_t x24 = load4(input + 24*stride4, stride);
+    const float32x4_t t69 = vaddq_f32(x8.val[0], x24.val[0]);
+    const float32x4_t t73 = vaddq_f32(t65, t69);
+    const float32x4x2_t x4 = load4(input + 4*stride4, stride);
+    const float32x4x2_t x20 = load4(input + 20*stride4, stride);
+    const float32x4_t t82 = vaddq_f32(x4.val[0], x20.val[0]);
+    const float32x4x2_t x12 = load4(input + 12*stride4, stride);
+    const float32x4x2_t x28 = load4(input + 28*stride4, stride);
+    const float32x4_t t86 = vaddq_f32(x12.val[0], x28.val[0]);
+    const float32x4_t t90 = vaddq_f32(t82, t86);
+    const float32x4_t t94 = vaddq_f32(t73, t90);
+    const float32x4x2_t x2 = load4(input + 2*stride4, stride);
+    const float32x4x2_t x18 = load4(input + 18*stride4, stride);
+    const float32x4_t t131 = vaddq_f32(x2.val[0], x18.val[0]);
+    const float32x4x2_t x10 = load4(input + 10*stride4, stride);
+    const float32x4x2_t x26 = load4(input + 26*stride4, stride);
+    const float32x4_t t135 = vaddq_f32(x10.val[0], x26.val[0]);
+    const float32x4_t t139 = vaddq_f32(t131, t135);
+    const float32x4x2_t x6 = load4(input + 6*stride4, stride);
+    const float32x4x2_t x22 = load4(input + 22*stride4, stride);
+    const float32x4_t t148 = vaddq_f32(x6.val[0], x22.val[0]);
+    const float32x4x2_t x14 = load4(input + 14*stride4, stride);
+    const float32x4x2_t x30 = load4(input + 30*stride4, stride);
+    const float32x4_t t152 = vaddq_f32(x14.val[0], x30.val[0]);
+    const float32x4_t t156 = vaddq_f32(t148, t152);
+    const float32x4_t t165 = vaddq_f32(t139, t156);
+    const float32x4_t t169 = vaddq_f32(t94, t165);
+    const float32x4x2_t x1 = load4(input + 1*stride4, stride);
+    const float32x4x2_t x17 = load4(input + 17*stride4, stride);
+    const float32x4_t t276 = vaddq_f32(x1.val[0], x17.val[0]);
+    const float32x4x2_t x9 = load4(input + 9*stride4, stride);
+    const float32x4x2_t x25 = load4(input + 25*stride4, stride);
+    const float32x4_t t280 = vaddq_f32(x9.val[0], x25.val[0]);
+    const float32x4_t t284 = vaddq_f32(t276, t280);
+    const float32x4x2_t x5 = load4(input + 5*stride4, stride);
+    const float32x4x2_t x21 = load4(input + 21*stride4, stride);
+    const float32x4_t t293 = vaddq_f32(x5.val[0], x21.val[0]);
+    const float32x4x2_t x13 = load4(input + 13*stride4, stride);
+    const float32x4x2_t x29 = load4(input + 29*stride4, stride);
+    const float32x4_t t297 = vaddq_f32(x13.val[0], x29.val[0]);
+    const float32x4_t t301 = vaddq_f32(t293, t297);
+    const float32x4_t t305 = vaddq_f32(t284, t301);
+    const float32x4x2_t x3 = load4(input + 3*stride4, stride);
+    const float32x4x2_t x19 = load4(input + 19*stride4, stride);
+    const float32x4_t t341 = vaddq_f32(x3.val[0], x19.val[0]);
+    const float32x4x2_t x11 = load4(input + 11*stride4, stride);
+    const float32x4x2_t x27 = load4(input + 27*stride4, stride);
+    const float32x4_t t345 = vaddq_f32(x11.val[0], x27.val[0]);
+    const float32x4_t t349 = vaddq_f32(t341, t345);
+    const float32x4x2_t x7 = load4(input + 7*stride4, stride);
+    const float32x4x2_t x23 = load4(input + 23*stride4, stride);
+    const float32x4_t t358 = vaddq_f32(x7.val[0], x23.val[0]);
+    const float32x4x2_t x15 = load4(input + 15*stride4, stride);
+    const float32x4x2_t x31 = load4(input + 31*stride4, stride);
+    const float32x4_t t362 = vaddq_f32(x15.val[0], x31.val[0]);
+    const float32x4_t t366 = vaddq_f32(t358, t362);
+    const float32x4_t t370 = vaddq_f32(t349, t366);
+    const float32x4_t t406 = vaddq_f32(t305, t370);
+    const float32x4_t t410 = vaddq_f32(t169, t406);
+    const float32x4_t t66 = vaddq_f32(x0.val[1], x16.val[1]);
+    const float32x4_t t70 = vaddq_f32(x8.val[1], x24.val[1]);
+    const float32x4_t t74 = vaddq_f32(t66, t70);
+    const float32x4_t t83 = vaddq_f32(x4.val[1], x20.val[1]);
+    const float32x4_t t87 = vaddq_f32(x12.val[1], x28.val[1]);
+    const float32x4_t t91 = vaddq_f32(t83, t87);
+    const float32x4_t t95 = vaddq_f32(t74, t91);
+    const float32x4_t t132 = vaddq_f32(x2.val[1], x18.val[1]);
+    const float32x4_t t136 = vaddq_f32(x10.val[1], x26.val[1]);
+    const float32x4_t t140 = vaddq_f32(t132, t136);
+    const float32x4_t t149 = vaddq_f32(x6.val[1], x22.val[1]);
+    const float32x4_t t153 = vaddq_f32(x14.val[1], x30.val[1]);
+    const float32x4_t t157 = vaddq_f32(t149, t153);
+    const float32x4_t t166 = vaddq_f32(t140, t157);
+    const float32x4_t t170 = vaddq_f32(t95, t166);
+    const float32x4_t t277 = vaddq_f32(x1.val[1], x17.val[1]);
+    const float32x4_t t281 = vaddq_f32(x9.val[1], x25.val[1]);
+    const float32x4_t t285 = vaddq_f32(t277, t281);
+    const float32x4_t t294 = vaddq_f32(x5.val[1], x21.val[1]);
+    const float32x4_t t298 = vaddq_f32(x13.val[1], x29.val[1]);
+    const float32x4_t t302 = vaddq_f32(t294, t298);
+    const float32x4_t t306 = vaddq_f32(t285, t302);
+    const float32x4_t t342 = vaddq_f32(x3.val[1], x19.val[1]);
+    const float32x4_t t346 = vaddq_f32(x11.val[1], x27.val[1]);
+    const float32x4_t t350 = vaddq_f32(t342, t346);
+    const float32x4_t t359 = vaddq_f32(x7.val[1], x23.val[1]);
+    const float32x4_t t363 = vaddq_f32(x15.val[1], x31.val[1]);
+    const float32x4_t t367 = vaddq_f32(t359, t363);
+    const float32x4_t t371 = vaddq_f32(t350, t367);
+    const float32x4_t t407 = vaddq_f32(t306, t371);
+    const float32x4_t t411 = vaddq_f32(t170, t407);
+    const float32x4_t t67 = vsubq_f32(x0.val[0], x16.val[0]);
+    const float32x4_t t72 = vsubq_f32(x8.val[1], x24.val[1]);
+    const float32x4_t t78 = vaddq_f32(t67, t72);
+    const float32x4_t t84 = vsubq_f32(x4.val[0], x20.val[0]);
+    const float32x4_t t85 = vsubq_f32(x4.val[1], x20.val[1]);
+    const float32x4_t t103 = vaddq_f32(t84, t85);
+    const float32x4_t t105 = vmulq_n_f32(t103, 0.707106781f);
+    const float32x4_t t88 = vsubq_f32(x12.val[0], x28.val[0]);
+    const float32x4_t t89 = vsubq_f32(x12.val[1], x28.val[1]);
+    const float32x4_t t110 = vsubq_f32(t88, t89);
+    const float32x4_t t111 = vmulq_n_f32(t110, 0.707106781f);
+    const float32x4_t t116 = vsubq_f32(t105, t111);
+    const float32x4_t t122 = vaddq_f32(t78, t116);
+    const float32x4_t t133 = vsubq_f32(x2.val[0], x18.val[0]);
+    const float32x4_t t138 = vsubq_f32(x10.val[1], x26.val[1]);
+    const float32x4_t t144 = vaddq_f32(t133, t138);
+    const float32x4_t t179 = vmulq_n_f32(t144, 0.923879533f);
+    const float32x4_t t134 = vsubq_f32(x2.val[1], x18.val[1]);
+    const float32x4_t t137 = vsubq_f32(x10.val[0], x26.val[0]);
+    const float32x4_t t145 = vsubq_f32(t134, t137);
+    const float32x4_t t181 = vmulq_n_f32(t145, 0.382683432f);
+    const float32x4_t t183 = vaddq_f32(t179, t181);
+    const float32x4_t t150 = vsubq_f32(x6.val[0], x22.val[0]);
+    const float32x4_t t155 = vsubq_f32(x14.val[1], x30.val[1]);
+    const float32x4_t t161 = vaddq_f32(t150, t155);
+    const float32x4_t t190 = vmulq_n_f32(t161, 0.382683432f);
+    const float32x4_t t151 = vsubq_f32(x6.val[1], x22.val[1]);
+    const float32x4_t t154 = vsubq_f32(x14.val[0], x30.val[0]);
+    const float32x4_t t162 = vsubq_f32(t151, t154);
+    const float32x4_t t191 = vmulq_n_f32(t162, 0.923879533f);
+    const float32x4_t t193 = vaddq_f32(t190, t191);
+    const float32x4_t t199 = vaddq_f32(t183, t193);
+    const float32x4_t t205 = vaddq_f32(t122, t199);
+    const float32x4_t t278 = vsubq_f32(x1.val[0], x17.val[0]);
+    const float32x4_t t283 = vsubq_f32(x9.val[1], x25.val[1]);
+    const float32x4_t t289 = vaddq_f32(t278, t283);
+    const float32x4_t t295 = vsubq_f32(x5.val[0], x21.val[0]);
+    const float32x4_t t296 = vsubq_f32(x5.val[1], x21.val[1]);
+    const float32x4_t t314 = vaddq_f32(t295, t296);
+    const float32x4_t t315 = vmulq_n_f32(t314, 0.707106781f);
+    const float32x4_t t299 = vsubq_f32(x13.val[0], x29.val[0]);
+    const float32x4_t t300 = vsubq_f32(x13.val[1], x29.val[1]);
+    const float32x4_t t320 = vsubq_f32(t299, t300);
+    const float32x4_t t321 = vmulq_n_f32(t320, 0.707106781f);
+    const float32x4_t t326 = vsubq_f32(t315, t321);
+    const float32x4_t t332 = vaddq_f32(t289, t326);
+    const float32x4_t t420 = vmulq_n_f32(t332, 0.980785280f);
+    const float32x4_t t279 = vsubq_f32(x1.val[1], x17.val[1]);
+    const float32x4_t t282 = vsubq_f32(x9.val[0], x25.val[0]);
+    const float32x4_t t290 = vsubq_f32(t279, t282);
+    const float32x4_t t316 = vsubq_f32(t295, t296);
+    const float32x4_t t318 = vmulq_n_f32(t316, 0.707106781f);
+    const float32x4_t t323 = vaddq_f32(t299, t300);
+    const float32x4_t t324 = vmulq_n_f32(t323, 0.707106781f);
+    const float32x4_t t327 = vaddq_f32(t318, t324);
+    const float32x4_t t333 = vsubq_f32(t290, t327);
+    const float32x4_t t422 = vmulq_n_f32(t333, 0.195090322f);
+    const float32x4_t t424 = vaddq_f32(t420, t422);
+    const float32x4_t t343 = vsubq_f32(x3.val[0], x19.val[0]);
+    const float32x4_t t348 = vsubq_f32(x11.val[1], x27.val[1]);
+    const float32x4_t t354 = vaddq_f32(t343, t348);
+    const float32x4_t t360 = vsubq_f32(x7.val[0], x23.val[0]);
+    const float32x4_t t361 = vsubq_f32(x7.val[1], x23.val[1]);
+    const float32x4_t t379 = vaddq_f32(t360, t361);
+    const float32x4_t t380 = vmulq_n_f32(t379, 0.707106781f);
+    const float32x4_t t364 = vsubq_f32(x15.val[0], x31.val[0]);
+    const float32x4_t t365 = vsubq_f32(x15.val[1], x31.val[1]);
+    const float32x4_t t385 = vsubq_f32(t364, t365);
+    const float32x4_t t386 = vmulq_n_f32(t385, 0.707106781f);
+    const float32x4_t t391 = vsubq_f32(t380, t386);
+    const float32x4_t t397 = vaddq_f32(t354, t391);
+    const float32x4_t t431 = vmulq_n_f32(t397, 0.831469612f);
+    const float32x4_t t344 = vsubq_f32(x3.val[1], x19.val[1]);
+    const float32x4_t t347 = vsubq_f32(x11.val[0], x27.val[0]);
+    const float32x4_t t355 = vsubq_f32(t344, t347);
+    const float32x4_t t381 = vsubq_f32(t360, t361);
+    const float32x4_t t383 = vmulq_n_f32(t381, 0.707106781f);
+    const float32x4_t t388 = vaddq_f32(t364, t365);
+    const float32x4_t t389 = vmulq_n_f32(t388, 0.707106781f);
+    const float32x4_t t392 = vaddq_f32(t383, t389);
+    const float32x4_t t398 = vsubq_f32(t355, t392);
+    const float32x4_t t433 = vmulq_n_f32(t398, 0.555570233f);
+    const float32x4_t t435 = vaddq_f32(t431, t433);
+    const float32x4_t t441 = vaddq_f32(t424, t435);
+    const float32x4_t t447 = vaddq_f32(t205, t441);
+    const float32x4_t t68 = vsubq_f32(x0.val[1], x16.val[1]);
+    const float32x4_t t71 = vsubq_f32(x8.val[0], x24.val[0]);
+    const float32x4_t t79 = vsubq_f32(t68, t71);
+    const float32x4_t t106 = vsubq_f32(t84, t85);
+    const float32x4_t t108 = vmulq_n_f32(t106, 0.707106781f);
+    const float32x4_t t113 = vaddq_f32(t88, t89);
+    const float32x4_t t114 = vmulq_n_f32(t113, 0.707106781f);
+    const float32x4_t t117 = vaddq_f32(t108, t114);
+    const float32x4_t t123 = vsubq_f32(t79, t117);
+    const float32x4_t t184 = vmulq_n_f32(t144, 0.382683432f);
+    const float32x4_t t186 = vmulq_n_f32(t145, 0.923879533f);
+    const float32x4_t t187 = vsubq_f32(t184, t186);
+    const float32x4_t t194 = vmulq_n_f32(t161, 0.923879533f);
+    const float32x4_t t196 = vmulq_n_f32(t162, 0.382683432f);
+    const float32x4_t t197 = vsubq_f32(t194, t196);
+    const float32x4_t t200 = vaddq_f32(t187, t197);
+    const float32x4_t t206 = vsubq_f32(t123, t200);
+    const float32x4_t t425 = vmulq_n_f32(t332, 0.195090322f);
+    const float32x4_t t427 = vmulq_n_f32(t333, 0.980785280f);
+    const float32x4_t t428 = vsubq_f32(t425, t427);
+    const float32x4_t t436 = vmulq_n_f32(t397, 0.555570233f);
+    const float32x4_t t438 = vmulq_n_f32(t398, 0.831469612f);
+    const float32x4_t t439 = vsubq_f32(t436, t438);
+    const float32x4_t t442 = vaddq_f32(t428, t439);
+    const float32x4_t t448 = vsubq_f32(t206, t442);
+    const float32x4_t t75 = vsubq_f32(t65, t69);
+    const float32x4_t t93 = vsubq_f32(t83, t87);
+    const float32x4_t t99 = vaddq_f32(t75, t93);
+    const float32x4_t t141 = vsubq_f32(t131, t135);
+    const float32x4_t t142 = vsubq_f32(t132, t136);
+    const float32x4_t t214 = vaddq_f32(t141, t142);
+    const float32x4_t t215 = vmulq_n_f32(t214, 0.707106781f);
+    const float32x4_t t158 = vsubq_f32(t148, t152);
+    const float32x4_t t159 = vsubq_f32(t149, t153);
+    const float32x4_t t220 = vsubq_f32(t158, t159);
+    const float32x4_t t221 = vmulq_n_f32(t220, 0.707106781f);
+    const float32x4_t t226 = vsubq_f32(t215, t221);
+    const float32x4_t t232 = vaddq_f32(t99, t226);
+    const float32x4_t t286 = vsubq_f32(t276, t280);
+    const float32x4_t t304 = vsubq_f32(t294, t298);
+    const float32x4_t t310 = vaddq_f32(t286, t304);
+    const float32x4_t t456 = vmulq_n_f32(t310, 0.923879533f);
+    const float32x4_t t287 = vsubq_f32(t277, t281);
+    const float32x4_t t303 = vsubq_f32(t293, t297);
+    const float32x4_t t311 = vsubq_f32(t287, t303);
+    const float32x4_t t457 = vmulq_n_f32(t311, 0.382683432f);
+    const float32x4_t t459 = vaddq_f32(t456, t457);
+    const float32x4_t t351 = vsubq_f32(t341, t345);
+    const float32x4_t t369 = vsubq_f32(t359, t363);
+    const float32x4_t t375 = vaddq_f32(t351, t369);
+    const float32x4_t t465 = vmulq_n_f32(t375, 0.382683432f);
+    const float32x4_t t352 = vsubq_f32(t342, t346);
+    const float32x4_t t368 = vsubq_f32(t358, t362);
+    const float32x4_t t376 = vsubq_f32(t352, t368);
+    const float32x4_t t466 = vmulq_n_f32(t376, 0.923879533f);
+    const float32x4_t t468 = vaddq_f32(t465, t466);
+    const float32x4_t t474 = vaddq_f32(t459, t468);
+    const float32x4_t t480 = vaddq_f32(t232, t474);
+    const float32x4_t t76 = vsubq_f32(t66, t70);
+    const float32x4_t t92 = vsubq_f32(t82, t86);
+    const float32x4_t t100 = vsubq_f32(t76, t92);
+    const float32x4_t t216 = vsubq_f32(t141, t142);
+    const float32x4_t t218 = vmulq_n_f32(t216, 0.707106781f);
+    const float32x4_t t223 = vaddq_f32(t158, t159);
+    const float32x4_t t224 = vmulq_n_f32(t223, 0.707106781f);
+    const float32x4_t t227 = vaddq_f32(t218, t224);
+    const float32x4_t t233 = vsubq_f32(t100, t227);
+    const float32x4_t t460 = vmulq_n_f32(t310, 0.382683432f);
+    const float32x4_t t462 = vmulq_n_f32(t311, 0.923879533f);
+    const float32x4_t t463 = vsubq_f32(t460, t462);
+    const float32x4_t t469 = vmulq_n_f32(t375, 0.923879533f);
+    const float32x4_t t471 = vmulq_n_f32(t376, 0.382683432f);
+    const float32x4_t t472 = vsubq_f32(t469, t471);
+    const float32x4_t t475 = vaddq_f32(t463, t472);
+    const float32x4_t t481 = vsubq_f32(t233, t475);
+    const float32x4_t t80 = vsubq_f32(t67, t72);
+    const float32x4_t t120 = vsubq_f32(t108, t114);
+    const float32x4_t t127 = vsubq_f32(t80, t120);
+    const float32x4_t t146 = vsubq_f32(t133, t138);
+    const float32x4_t t241 = vmulq_n_f32(t146, 0.382683432f);
+    const float32x4_t t147 = vaddq_f32(t134, t137);
+    const float32x4_t t242 = vmulq_n_f32(t147, 0.923879533f);
+    const float32x4_t t244 = vaddq_f32(t241, t242);
+    const float32x4_t t163 = vsubq_f32(t150, t155);
+    const float32x4_t t251 = vmulq_n_f32(t163, 0.923879533f);
+    const float32x4_t t164 = vaddq_f32(t151, t154);
+    const float32x4_t t254 = vmulq_n_f32(t164, 0.382683432f);
+    const float32x4_t t255 = vaddq_f32(t251, t254);
+    const float32x4_t t261 = vsubq_f32(t244, t255);
+    const float32x4_t t267 = vaddq_f32(t127, t261);
+    const float32x4_t t291 = vsubq_f32(t278, t283);
+    const float32x4_t t330 = vsubq_f32(t318, t324);
+    const float32x4_t t337 = vsubq_f32(t291, t330);
+    const float32x4_t t489 = vmulq_n_f32(t337, 0.831469612f);
+    const float32x4_t t292 = vaddq_f32(t279, t282);
+    const float32x4_t t329 = vaddq_f32(t315, t321);
+    const float32x4_t t338 = vsubq_f32(t292, t329);
+    const float32x4_t t490 = vmulq_n_f32(t338, 0.555570233f);
+    const float32x4_t t492 = vaddq_f32(t489, t490);
+    const float32x4_t t356 = vsubq_f32(t343, t348);
+    const float32x4_t t395 = vsubq_f32(t383, t389);
+    const float32x4_t t402 = vsubq_f32(t356, t395);
+    const float32x4_t t499 = vmulq_n_f32(t402, 0.195090322f);
+    const float32x4_t t357 = vaddq_f32(t344, t347);
+    const float32x4_t t394 = vaddq_f32(t380, t386);
+    const float32x4_t t403 = vsubq_f32(t357, t394);
+    const float32x4_t t501 = vmulq_n_f32(t403, 0.980785280f);
+    const float32x4_t t503 = vsubq_f32(t499, t501);
+    const float32x4_t t511 = vsubq_f32(t492, t503);
+    const float32x4_t t517 = vaddq_f32(t267, t511);
+    const float32x4_t t81 = vaddq_f32(t68, t71);
+    const float32x4_t t119 = vaddq_f32(t105, t111);
+    const float32x4_t t128 = vsubq_f32(t81, t119);
+    const float32x4_t t245 = vmulq_n_f32(t146, 0.923879533f);
+    const float32x4_t t247 = vmulq_n_f32(t147, 0.382683432f);
+    const float32x4_t t248 = vsubq_f32(t245, t247);
+    const float32x4_t t257 = vmulq_n_f32(t163, 0.382683432f);
+    const float32x4_t t258 = vmulq_n_f32(t164, 0.923879533f);
+    const float32x4_t t260 = vsubq_f32(t257, t258);
+    const float32x4_t t262 = vsubq_f32(t248, t260);
+    const float32x4_t t268 = vsubq_f32(t128, t262);
+    const float32x4_t t493 = vmulq_n_f32(t337, 0.555570233f);
+    const float32x4_t t495 = vmulq_n_f32(t338, 0.831469612f);
+    const float32x4_t t496 = vsubq_f32(t493, t495);
+    const float32x4_t t505 = vmulq_n_f32(t402, 0.980785280f);
+    const float32x4_t t507 = vmulq_n_f32(t403, 0.195090322f);
+    const float32x4_t t509 = vaddq_f32(t505, t507);
+    const float32x4_t t512 = vaddq_f32(t496, t509);
+    const float32x4_t t518 = vsubq_f32(t268, t512);
+    const float32x4_t t96 = vsubq_f32(t73, t90);
+    const float32x4_t t168 = vsubq_f32(t140, t157);
+    const float32x4_t t174 = vaddq_f32(t96, t168);
+    const float32x4_t t307 = vsubq_f32(t284, t301);
+    const float32x4_t t308 = vsubq_f32(t285, t302);
+    const float32x4_t t526 = vaddq_f32(t307, t308);
+    const float32x4_t t527 = vmulq_n_f32(t526, 0.707106781f);
+    const float32x4_t t372 = vsubq_f32(t349, t366);
+    const float32x4_t t373 = vsubq_f32(t350, t367);
+    const float32x4_t t532 = vsubq_f32(t372, t373);
+    const float32x4_t t533 = vmulq_n_f32(t532, 0.707106781f);
+    const float32x4_t t538 = vsubq_f32(t527, t533);
+    const float32x4_t t544 = vaddq_f32(t174, t538);
+    const float32x4_t t97 = vsubq_f32(t74, t91);
+    const float32x4_t t167 = vsubq_f32(t139, t156);
+    const float32x4_t t175 = vsubq_f32(t97, t167);
+    const float32x4_t t528 = vsubq_f32(t307, t308);
+    const float32x4_t t530 = vmulq_n_f32(t528, 0.707106781f);
+    const float32x4_t t535 = vaddq_f32(t372, t373);
+    const float32x4_t t536 = vmulq_n_f32(t535, 0.707106781f);
+    const float32x4_t t539 = vaddq_f32(t530, t536);
+    const float32x4_t t545 = vsubq_f32(t175, t539);
+    const float32x4_t t124 = vsubq_f32(t78, t116);
+    const float32x4_t t203 = vsubq_f32(t187, t197);
+    const float32x4_t t210 = vsubq_f32(t124, t203);
+    const float32x4_t t334 = vsubq_f32(t289, t326);
+    const float32x4_t t554 = vmulq_n_f32(t334, 0.555570233f);
+    const float32x4_t t335 = vaddq_f32(t290, t327);
+    const float32x4_t t555 = vmulq_n_f32(t335, 0.831469612f);
+    const float32x4_t t557 = vaddq_f32(t554, t555);
+    const float32x4_t t399 = vsubq_f32(t354, t391);
+    const float32x4_t t563 = vmulq_n_f32(t399, 0.980785280f);
+    const float32x4_t t400 = vaddq_f32(t355, t392);
+    const float32x4_t t566 = vmulq_n_f32(t400, 0.195090322f);
+    const float32x4_t t568 = vsubq_f32(t563, t566);
+    const float32x4_t t576 = vsubq_f32(t557, t568);
+    const float32x4_t t582 = vaddq_f32(t210, t576);
+    const float32x4_t t125 = vaddq_f32(t79, t117);
+    const float32x4_t t202 = vsubq_f32(t183, t193);
+    const float32x4_t t211 = vsubq_f32(t125, t202);
+    const float32x4_t t558 = vmulq_n_f32(t334, 0.831469612f);
+    const float32x4_t t560 = vmulq_n_f32(t335, 0.555570233f);
+    const float32x4_t t561 = vsubq_f32(t558, t560);
+    const float32x4_t t570 = vmulq_n_f32(t399, 0.195090322f);
+    const float32x4_t t572 = vmulq_n_f32(t400, 0.980785280f);
+    const float32x4_t t574 = vaddq_f32(t570, t572);
+    const float32x4_t t577 = vaddq_f32(t561, t574);
+    const float32x4_t t583 = vsubq_f32(t211, t577);
+    const float32x4_t t101 = vsubq_f32(t75, t93);
+    const float32x4_t t230 = vsubq_f32(t218, t224);
+    const float32x4_t t237 = vsubq_f32(t101, t230);
+    const float32x4_t t312 = vsubq_f32(t286, t304);
+    const float32x4_t t591 = vmulq_n_f32(t312, 0.382683432f);
+    const float32x4_t t313 = vaddq_f32(t287, t303);
+    const float32x4_t t592 = vmulq_n_f32(t313, 0.923879533f);
+    const float32x4_t t594 = vaddq_f32(t591, t592);
+    const float32x4_t t377 = vsubq_f32(t351, t369);
+    const float32x4_t t600 = vmulq_n_f32(t377, 0.923879533f);
+    const float32x4_t t378 = vaddq_f32(t352, t368);
+    const float32x4_t t602 = vmulq_n_f32(t378, 0.382683432f);
+    const float32x4_t t603 = vaddq_f32(t600, t602);
+    const float32x4_t t609 = vsubq_f32(t594, t603);
+    const float32x4_t t615 = vaddq_f32(t237, t609);
+    const float32x4_t t102 = vaddq_f32(t76, t92);
+    const float32x4_t t229 = vaddq_f32(t215, t221);
+    const float32x4_t t238 = vsubq_f32(t102, t229);
+    const float32x4_t t595 = vmulq_n_f32(t312, 0.923879533f);
+    const float32x4_t t597 = vmulq_n_f32(t313, 0.382683432f);
+    const float32x4_t t598 = vsubq_f32(t595, t597);
+    const float32x4_t t605 = vmulq_n_f32(t377, 0.382683432f);
+    const float32x4_t t606 = vmulq_n_f32(t378, 0.923879533f);
+    const float32x4_t t608 = vsubq_f32(t605, t606);
+    const float32x4_t t610 = vsubq_f32(t598, t608);
+    const float32x4_t t616 = vsubq_f32(t238, t610);
+    const float32x4_t t129 = vaddq_f32(t80, t120);
+    const float32x4_t t265 = vaddq_f32(t248, t260);
+    const float32x4_t t272 = vsubq_f32(t129, t265);
+    const float32x4_t t339 = vaddq_f32(t291, t330);
+    const float32x4_t t625 = vmulq_n_f32(t339, 0.195090322f);
+    const float32x4_t t340 = vaddq_f32(t292, t329);
+    const float32x4_t t626 = vmulq_n_f32(t340, 0.980785280f);
+    const float32x4_t t628 = vaddq_f32(t625, t626);
+    const float32x4_t t404 = vaddq_f32(t356, t395);
+    const float32x4_t t634 = vmulq_n_f32(t404, 0.555570233f);
+    const float32x4_t t405 = vaddq_f32(t357, t394);
+    const float32x4_t t636 = vmulq_n_f32(t405, 0.831469612f);
+    const float32x4_t t637 = vaddq_f32(t634, t636);
+    const float32x4_t t643 = vsubq_f32(t628, t637);
+    const float32x4_t t649 = vaddq_f32(t272, t643);
+    const float32x4_t t130 = vaddq_f32(t81, t119);
+    const float32x4_t t264 = vaddq_f32(t244, t255);
+    const float32x4_t t273 = vsubq_f32(t130, t264);
+    const float32x4_t t629 = vmulq_n_f32(t339, 0.980785280f);
+    const float32x4_t t631 = vmulq_n_f32(t340, 0.195090322f);
+    const float32x4_t t632 = vsubq_f32(t629, t631);
+    const float32x4_t t639 = vmulq_n_f32(t404, 0.831469612f);
+    const float32x4_t t640 = vmulq_n_f32(t405, 0.555570233f);
+    const float32x4_t t642 = vsubq_f32(t639, t640);
+    const float32x4_t t644 = vsubq_f32(t632, t642);
+    const float32x4_t t650 = vsubq_f32(t273, t644);
+    const float32x4_t t171 = vsubq_f32(t94, t165);
+    const float32x4_t t409 = vsubq_f32(t306, t371);
+    const float32x4_t t415 = vaddq_f32(t171, t409);
+    const float32x4_t t172 = vsubq_f32(t95, t166);
+    const float32x4_t t408 = vsubq_f32(t305, t370);
+    const float32x4_t t416 = vsubq_f32(t172, t408);
+    const float32x4_t t207 = vsubq_f32(t122, t199);
+    const float32x4_t t445 = vsubq_f32(t428, t439);
+    const float32x4_t t452 = vsubq_f32(t207, t445);
+    const float32x4_t t208 = vaddq_f32(t123, t200);
+    const float32x4_t t444 = vsubq_f32(t424, t435);
+    const float32x4_t t453 = vsubq_f32(t208, t444);
+    const float32x4_t t234 = vsubq_f32(t99, t226);
+    const float32x4_t t478 = vsubq_f32(t463, t472);
+    const float32x4_t t485 = vsubq_f32(t234, t478);
+    const float32x4_t t235 = vaddq_f32(t100, t227);
+    const float32x4_t t477 = vsubq_f32(t459, t468);
+    const float32x4_t t486 = vsubq_f32(t235, t477);
+    const float32x4_t t269 = vsubq_f32(t127, t261);
+    const float32x4_t t515 = vsubq_f32(t496, t509);
+    const float32x4_t t522 = vsubq_f32(t269, t515);
+    const float32x4_t t270 = vaddq_f32(t128, t262);
+    const float32x4_t t514 = vaddq_f32(t492, t503);
+    const float32x4_t t523 = vsubq_f32(t270, t514);
+    const float32x4_t t176 = vsubq_f32(t96, t168);
+    const float32x4_t t542 = vsubq_f32(t530, t536);
+    const float32x4_t t549 = vsubq_f32(t176, t542);
+    const float32x4_t t177 = vaddq_f32(t97, t167);
+    const float32x4_t t541 = vaddq_f32(t527, t533);
+    const float32x4_t t550 = vsubq_f32(t177, t541);
+    const float32x4_t t212 = vaddq_f32(t124, t203);
+    const float32x4_t t580 = vsubq_f32(t561, t574);
+    const float32x4_t t587 = vsubq_f32(t212, t580);
+    const float32x4_t t213 = vaddq_f32(t125, t202);
+    const float32x4_t t579 = vaddq_f32(t557, t568);
+    const float32x4_t t588 = vsubq_f32(t213, t579);
+    const float32x4_t t239 = vaddq_f32(t101, t230);
+    const float32x4_t t613 = vaddq_f32(t598, t608);
+    const float32x4_t t620 = vsubq_f32(t239, t613);
+    const float32x4_t t240 = vaddq_f32(t102, t229);
+    const float32x4_t t612 = vaddq_f32(t594, t603);
+    const float32x4_t t621 = vsubq_f32(t240, t612);
+    const float32x4_t t274 = vaddq_f32(t129, t265);
+    const float32x4_t t647 = vaddq_f32(t632, t642);
+    const float32x4_t t654 = vsubq_f32(t274, t647);
+    const float32x4_t t275 = vaddq_f32(t130, t264);
+    const float32x4_t t646 = vaddq_f32(t628, t637);
+    const float32x4_t t655 = vsubq_f32(t275, t646);
+    const float32x4_t t412 = vsubq_f32(t169, t406);
+    const float32x4_t t413 = vsubq_f32(t170, t407);
+    const float32x4_t t449 = vsubq_f32(t205, t441);
+    const float32x4_t t450 = vaddq_f32(t206, t442);
+    const float32x4_t t482 = vsubq_f32(t232, t474);
+    const float32x4_t t483 = vaddq_f32(t233, t475);
+    const float32x4_t t519 = vsubq_f32(t267, t511);
+    const float32x4_t t520 = vaddq_f32(t268, t512);
+    const float32x4_t t546 = vsubq_f32(t174, t538);
+    const float32x4_t t547 = vaddq_f32(t175, t539);
+    const float32x4_t t584 = vsubq_f32(t210, t576);
+    const float32x4_t t585 = vaddq_f32(t211, t577);
+    const float32x4_t t617 = vsubq_f32(t237, t609);
+    const float32x4_t t618 = vaddq_f32(t238, t610);
+    const float32x4_t t651 = vsubq_f32(t272, t643);
+    const float32x4_t t652 = vaddq_f32(t273, t644);
+    const float32x4_t t417 = vsubq_f32(t171, t409);
+    const float32x4_t t418 = vaddq_f32(t172, t408);
+    const float32x4_t t454 = vaddq_f32(t207, t445);
+    const float32x4_t t455 = vaddq_f32(t208, t444);
+    const float32x4_t t487 = vaddq_f32(t234, t478);
+    const float32x4_t t488 = vaddq_f32(t235, t477);
+    const float32x4_t t524 = vaddq_f32(t269, t515);
+    const float32x4_t t525 = vaddq_f32(t270, t514);
+    const float32x4_t t551 = vaddq_f32(t176, t542);
+    const float32x4_t t552 = vaddq_f32(t177, t541);
+    const float32x4_t t589 = vaddq_f32(t212, t580);
+    const float32x4_t t590 = vaddq_f32(t213, t579);
+    const float32x4_t t622 = vaddq_f32(t239, t613);
+    const float32x4_t t623 = vaddq_f32(t240, t612);
+    const float32x4_t t656 = vaddq_f32(t274, t647);
+    const float32x4_t t657 = vaddq_f32(t275, t646);
+    store4(output + 0, 32, t410, t411, t447, t448, t480, t481, t517, t518);
+    store4(output + 4, 32, t544, t545, t582, t583, t615, t616, t649, t650);
+    store4(output + 8, 32, t415, t416, t452, t453, t485, t486, t522, t523);
+    store4(output + 12, 32, t549, t550, t587, t588, t620, t621, t654, t655);
+    store4(output + 16, 32, t412, t413, t449, t450, t482, t483, t519, t520);
+    store4(output + 20, 32, t546, t547, t584, t585, t617, t618, t651, t652);
+    store4(output + 24, 32, t417, t418, t454, t455, t487, t488, t524, t525);
+    store4(output + 28, 32, t551, t552, t589, t590, t622, t623, t656, t657);
+}
+
+// 372 additions, 84 multiplications (x4)
+void codelet_32_inv_x4(const CkFftComplex* input, CkFftComplex* output, CkFftSize stride)
+{
+    CkFftSize stride4 = stride * 4;
+    const float32x4x2_t x0 = load4(input + 0*stride4, stride);
+    const float32x4x2_t x16 = load4(input + 16*stride4, stride);
+    const float32x4_t t65 = vaddq_f32(x0.val[0], x16.val[0]);
+    const float32x4x2_t x8 = load4(input + 8*stride4, stride);
+    const float32x4x2_t x24 = load4(input + 24*stride4, stride);
+    const float32x4_t t69 = vaddq_f32(x8.val[0], x24.val[0]);
+    const float32x4_t t73 = vaddq_f32(t65, t69);
+    const float32x4x2_t x4 = load4(input + 4*stride4, stride);
+    const float32x4x2_t x20 = load4(input + 20*stride4, stride);
+    const float32x4_t t82 = vaddq_f32(x4.val[0], x20.val[0]);
+    const float32x4x2_t x12 = load4(input + 12*stride4, stride);
+    const float32x4x2_t x28 = load4(input + 28*stride4, stride);
+    const float32x4_t t86 = vaddq_f32(x12.val[0], x28.val[0]);
+    const float32x4_t t90 = vaddq_f32(t82, t86);
+    const float32x4_t t94 = vaddq_f32(t73, t90);
+    const float32x4x2_t x2 = load4(input + 2*stride4, stride);
+    const float32x4x2_t x18 = load4(input + 18*stride4, stride);
+    const float32x4_t t128 = vaddq_f32(x2.val[0], x18.val[0]);
+    const float32x4x2_t x10 = load4(input + 10*stride4, stride);
+    const float32x4x2_t x26 = load4(input + 26*stride4, stride);
+    const float32x4_t t132 = vaddq_f32(x10.val[0], x26.val[0]);
+    const float32x4_t t136 = vaddq_f32(t128, t132);
+    const float32x4x2_t x6 = load4(input + 6*stride4, stride);
+    const float32x4x2_t x22 = load4(input + 22*stride4, stride);
+    const float32x4_t t145 = vaddq_f32(x6.val[0], x22.val[0]);
+    const float32x4x2_t x14 = load4(input + 14*stride4, stride);
+    const float32x4x2_t x30 = load4(input + 30*stride4, stride);
+    const float32x4_t t149 = vaddq_f32(x14.val[0], x30.val[0]);
+    const float32x4_t t153 = vaddq_f32(t145, t149);
+    const float32x4_t t162 = vaddq_f32(t136, t153);
+    const float32x4_t t166 = vaddq_f32(t94, t162);
+    const float32x4x2_t x1 = load4(input + 1*stride4, stride);
+    const float32x4x2_t x17 = load4(input + 17*stride4, stride);
+    const float32x4_t t260 = vaddq_f32(x1.val[0], x17.val[0]);
+    const float32x4x2_t x9 = load4(input + 9*stride4, stride);
+    const float32x4x2_t x25 = load4(input + 25*stride4, stride);
+    const float32x4_t t264 = vaddq_f32(x9.val[0], x25.val[0]);
+    const float32x4_t t268 = vaddq_f32(t260, t264);
+    const float32x4x2_t x5 = load4(input + 5*stride4, stride);
+    const float32x4x2_t x21 = load4(input + 21*stride4, stride);
+    const float32x4_t t277 = vaddq_f32(x5.val[0], x21.val[0]);
+    const float32x4x2_t x13 = load4(input + 13*stride4, stride);
+    const float32x4x2_t x29 = load4(input + 29*stride4, stride);
+    const float32x4_t t281 = vaddq_f32(x13.val[0], x29.val[0]);
+    const float32x4_t t285 = vaddq_f32(t277, t281);
+    const float32x4_t t289 = vaddq_f32(t268, t285);
+    const float32x4x2_t x3 = load4(input + 3*stride4, stride);
+    const float32x4x2_t x19 = load4(input + 19*stride4, stride);
+    const float32x4_t t322 = vaddq_f32(x3.val[0], x19.val[0]);
+    const float32x4x2_t x11 = load4(input + 11*stride4, stride);
+    const float32x4x2_t x27 = load4(input + 27*stride4, stride);
+    const float32x4_t t326 = vaddq_f32(x11.val[0], x27.val[0]);
+    const float32x4_t t330 = vaddq_f32(t322, t326);
+    const float32x4x2_t x7 = load4(input + 7*stride4, stride);
+    const float32x4x2_t x23 = load4(input + 23*stride4, stride);
+    const float32x4_t t339 = vaddq_f32(x7.val[0], x23.val[0]);
+    const float32x4x2_t x15 = load4(input + 15*stride4, stride);
+    const float32x4x2_t x31 = load4(input + 31*stride4, stride);
+    const float32x4_t t343 = vaddq_f32(x15.val[0], x31.val[0]);
+    const float32x4_t t347 = vaddq_f32(t339, t343);
+    const float32x4_t t351 = vaddq_f32(t330, t347);
+    const float32x4_t t384 = vaddq_f32(t289, t351);
+    const float32x4_t t388 = vaddq_f32(t166, t384);
+    const float32x4_t t66 = vaddq_f32(x0.val[1], x16.val[1]);
+    const float32x4_t t70 = vaddq_f32(x8.val[1], x24.val[1]);
+    const float32x4_t t74 = vaddq_f32(t66, t70);
+    const float32x4_t t83 = vaddq_f32(x4.val[1], x20.val[1]);
+    const float32x4_t t87 = vaddq_f32(x12.val[1], x28.val[1]);
+    const float32x4_t t91 = vaddq_f32(t83, t87);
+    const float32x4_t t95 = vaddq_f32(t74, t91);
+    const float32x4_t t129 = vaddq_f32(x2.val[1], x18.val[1]);
+    const float32x4_t t133 = vaddq_f32(x10.val[1], x26.val[1]);
+    const float32x4_t t137 = vaddq_f32(t129, t133);
+    const float32x4_t t146 = vaddq_f32(x6.val[1], x22.val[1]);
+    const float32x4_t t150 = vaddq_f32(x14.val[1], x30.val[1]);
+    const float32x4_t t154 = vaddq_f32(t146, t150);
+    const float32x4_t t163 = vaddq_f32(t137, t154);
+    const float32x4_t t167 = vaddq_f32(t95, t163);
+    const float32x4_t t261 = vaddq_f32(x1.val[1], x17.val[1]);
+    const float32x4_t t265 = vaddq_f32(x9.val[1], x25.val[1]);
+    const float32x4_t t269 = vaddq_f32(t261, t265);
+    const float32x4_t t278 = vaddq_f32(x5.val[1], x21.val[1]);
+    const float32x4_t t282 = vaddq_f32(x13.val[1], x29.val[1]);
+    const float32x4_t t286 = vaddq_f32(t278, t282);
+    const float32x4_t t290 = vaddq_f32(t269, t286);
+    const float32x4_t t323 = vaddq_f32(x3.val[1], x19.val[1]);
+    const float32x4_t t327 = vaddq_f32(x11.val[1], x27.val[1]);
+    const float32x4_t t331 = vaddq_f32(t323, t327);
+    const float32x4_t t340 = vaddq_f32(x7.val[1], x23.val[1]);
+    const float32x4_t t344 = vaddq_f32(x15.val[1], x31.val[1]);
+    const float32x4_t t348 = vaddq_f32(t340, t344);
+    const float32x4_t t352 = vaddq_f32(t331, t348);
+    const float32x4_t t385 = vaddq_f32(t290, t352);
+    const float32x4_t t389 = vaddq_f32(t167, t385);
+    const float32x4_t t67 = vsubq_f32(x0.val[0], x16.val[0]);
+    const float32x4_t t72 = vsubq_f32(x8.val[1], x24.val[1]);
+    const float32x4_t t78 = vsubq_f32(t67, t72);
+    const float32x4_t t84 = vsubq_f32(x4.val[0], x20.val[0]);
+    const float32x4_t t85 = vsubq_f32(x4.val[1], x20.val[1]);
+    const float32x4_t t103 = vsubq_f32(t84, t85);
+    const float32x4_t t105 = vmulq_n_f32(t103, 0.707106781f);
+    const float32x4_t t88 = vsubq_f32(x12.val[0], x28.val[0]);
+    const float32x4_t t89 = vsubq_f32(x12.val[1], x28.val[1]);
+    const float32x4_t t108 = vaddq_f32(t88, t89);
+    const float32x4_t t109 = vmulq_n_f32(t108, 0.707106781f);
+    const float32x4_t t115 = vsubq_f32(t105, t109);
+    const float32x4_t t119 = vaddq_f32(t78, t115);
+    const float32x4_t t130 = vsubq_f32(x2.val[0], x18.val[0]);
+    const float32x4_t t135 = vsubq_f32(x10.val[1], x26.val[1]);
+    const float32x4_t t141 = vsubq_f32(t130, t135);
+    const float32x4_t t176 = vmulq_n_f32(t141, 0.923879533f);
+    const float32x4_t t131 = vsubq_f32(x2.val[1], x18.val[1]);
+    const float32x4_t t134 = vsubq_f32(x10.val[0], x26.val[0]);
+    const float32x4_t t142 = vaddq_f32(t131, t134);
+    const float32x4_t t178 = vmulq_n_f32(t142, 0.382683432f);
+    const float32x4_t t179 = vsubq_f32(t176, t178);
+    const float32x4_t t147 = vsubq_f32(x6.val[0], x22.val[0]);
+    const float32x4_t t152 = vsubq_f32(x14.val[1], x30.val[1]);
+    const float32x4_t t158 = vsubq_f32(t147, t152);
+    const float32x4_t t184 = vmulq_n_f32(t158, 0.382683432f);
+    const float32x4_t t148 = vsubq_f32(x6.val[1], x22.val[1]);
+    const float32x4_t t151 = vsubq_f32(x14.val[0], x30.val[0]);
+    const float32x4_t t159 = vaddq_f32(t148, t151);
+    const float32x4_t t185 = vmulq_n_f32(t159, 0.923879533f);
+    const float32x4_t t186 = vsubq_f32(t184, t185);
+    const float32x4_t t190 = vaddq_f32(t179, t186);
+    const float32x4_t t194 = vaddq_f32(t119, t190);
+    const float32x4_t t262 = vsubq_f32(x1.val[0], x17.val[0]);
+    const float32x4_t t267 = vsubq_f32(x9.val[1], x25.val[1]);
+    const float32x4_t t273 = vsubq_f32(t262, t267);
+    const float32x4_t t279 = vsubq_f32(x5.val[0], x21.val[0]);
+    const float32x4_t t280 = vsubq_f32(x5.val[1], x21.val[1]);
+    const float32x4_t t298 = vsubq_f32(t279, t280);
+    const float32x4_t t299 = vmulq_n_f32(t298, 0.707106781f);
+    const float32x4_t t283 = vsubq_f32(x13.val[0], x29.val[0]);
+    const float32x4_t t284 = vsubq_f32(x13.val[1], x29.val[1]);
+    const float32x4_t t302 = vaddq_f32(t283, t284);
+    const float32x4_t t303 = vmulq_n_f32(t302, 0.707106781f);
+    const float32x4_t t309 = vsubq_f32(t299, t303);
+    const float32x4_t t313 = vaddq_f32(t273, t309);
+    const float32x4_t t398 = vmulq_n_f32(t313, 0.980785280f);
+    const float32x4_t t263 = vsubq_f32(x1.val[1], x17.val[1]);
+    const float32x4_t t266 = vsubq_f32(x9.val[0], x25.val[0]);
+    const float32x4_t t274 = vaddq_f32(t263, t266);
+    const float32x4_t t300 = vaddq_f32(t279, t280);
+    const float32x4_t t301 = vmulq_n_f32(t300, 0.707106781f);
+    const float32x4_t t305 = vsubq_f32(t283, t284);
+    const float32x4_t t307 = vmulq_n_f32(t305, 0.707106781f);
+    const float32x4_t t310 = vaddq_f32(t301, t307);
+    const float32x4_t t314 = vaddq_f32(t274, t310);
+    const float32x4_t t400 = vmulq_n_f32(t314, 0.195090322f);
+    const float32x4_t t401 = vsubq_f32(t398, t400);
+    const float32x4_t t324 = vsubq_f32(x3.val[0], x19.val[0]);
+    const float32x4_t t329 = vsubq_f32(x11.val[1], x27.val[1]);
+    const float32x4_t t335 = vsubq_f32(t324, t329);
+    const float32x4_t t341 = vsubq_f32(x7.val[0], x23.val[0]);
+    const float32x4_t t342 = vsubq_f32(x7.val[1], x23.val[1]);
+    const float32x4_t t360 = vsubq_f32(t341, t342);
+    const float32x4_t t361 = vmulq_n_f32(t360, 0.707106781f);
+    const float32x4_t t345 = vsubq_f32(x15.val[0], x31.val[0]);
+    const float32x4_t t346 = vsubq_f32(x15.val[1], x31.val[1]);
+    const float32x4_t t364 = vaddq_f32(t345, t346);
+    const float32x4_t t365 = vmulq_n_f32(t364, 0.707106781f);
+    const float32x4_t t371 = vsubq_f32(t361, t365);
+    const float32x4_t t375 = vaddq_f32(t335, t371);
+    const float32x4_t t406 = vmulq_n_f32(t375, 0.831469612f);
+    const float32x4_t t325 = vsubq_f32(x3.val[1], x19.val[1]);
+    const float32x4_t t328 = vsubq_f32(x11.val[0], x27.val[0]);
+    const float32x4_t t336 = vaddq_f32(t325, t328);
+    const float32x4_t t362 = vaddq_f32(t341, t342);
+    const float32x4_t t363 = vmulq_n_f32(t362, 0.707106781f);
+    const float32x4_t t367 = vsubq_f32(t345, t346);
+    const float32x4_t t369 = vmulq_n_f32(t367, 0.707106781f);
+    const float32x4_t t372 = vaddq_f32(t363, t369);
+    const float32x4_t t376 = vaddq_f32(t336, t372);
+    const float32x4_t t408 = vmulq_n_f32(t376, 0.555570233f);
+    const float32x4_t t409 = vsubq_f32(t406, t408);
+    const float32x4_t t413 = vaddq_f32(t401, t409);
+    const float32x4_t t417 = vaddq_f32(t194, t413);
+    const float32x4_t t68 = vsubq_f32(x0.val[1], x16.val[1]);
+    const float32x4_t t71 = vsubq_f32(x8.val[0], x24.val[0]);
+    const float32x4_t t79 = vaddq_f32(t68, t71);
+    const float32x4_t t106 = vaddq_f32(t84, t85);
+    const float32x4_t t107 = vmulq_n_f32(t106, 0.707106781f);
+    const float32x4_t t111 = vsubq_f32(t88, t89);
+    const float32x4_t t113 = vmulq_n_f32(t111, 0.707106781f);
+    const float32x4_t t116 = vaddq_f32(t107, t113);
+    const float32x4_t t120 = vaddq_f32(t79, t116);
+    const float32x4_t t180 = vmulq_n_f32(t141, 0.382683432f);
+    const float32x4_t t181 = vmulq_n_f32(t142, 0.923879533f);
+    const float32x4_t t182 = vaddq_f32(t180, t181);
+    const float32x4_t t187 = vmulq_n_f32(t158, 0.923879533f);
+    const float32x4_t t188 = vmulq_n_f32(t159, 0.382683432f);
+    const float32x4_t t189 = vaddq_f32(t187, t188);
+    const float32x4_t t191 = vaddq_f32(t182, t189);
+    const float32x4_t t195 = vaddq_f32(t120, t191);
+    const float32x4_t t402 = vmulq_n_f32(t313, 0.195090322f);
+    const float32x4_t t403 = vmulq_n_f32(t314, 0.980785280f);
+    const float32x4_t t404 = vaddq_f32(t402, t403);
+    const float32x4_t t410 = vmulq_n_f32(t375, 0.555570233f);
+    const float32x4_t t411 = vmulq_n_f32(t376, 0.831469612f);
+    const float32x4_t t412 = vaddq_f32(t410, t411);
+    const float32x4_t t414 = vaddq_f32(t404, t412);
+    const float32x4_t t418 = vaddq_f32(t195, t414);
+    const float32x4_t t75 = vsubq_f32(t65, t69);
+    const float32x4_t t93 = vsubq_f32(t83, t87);
+    const float32x4_t t99 = vsubq_f32(t75, t93);
+    const float32x4_t t138 = vsubq_f32(t128, t132);
+    const float32x4_t t139 = vsubq_f32(t129, t133);
+    const float32x4_t t203 = vsubq_f32(t138, t139);
+    const float32x4_t t204 = vmulq_n_f32(t203, 0.707106781f);
+    const float32x4_t t155 = vsubq_f32(t145, t149);
+    const float32x4_t t156 = vsubq_f32(t146, t150);
+    const float32x4_t t207 = vaddq_f32(t155, t156);
+    const float32x4_t t208 = vmulq_n_f32(t207, 0.707106781f);
+    const float32x4_t t214 = vsubq_f32(t204, t208);
+    const float32x4_t t218 = vaddq_f32(t99, t214);
+    const float32x4_t t270 = vsubq_f32(t260, t264);
+    const float32x4_t t288 = vsubq_f32(t278, t282);
+    const float32x4_t t294 = vsubq_f32(t270, t288);
+    const float32x4_t t426 = vmulq_n_f32(t294, 0.923879533f);
+    const float32x4_t t271 = vsubq_f32(t261, t265);
+    const float32x4_t t287 = vsubq_f32(t277, t281);
+    const float32x4_t t295 = vaddq_f32(t271, t287);
+    const float32x4_t t427 = vmulq_n_f32(t295, 0.382683432f);
+    const float32x4_t t428 = vsubq_f32(t426, t427);
+    const float32x4_t t332 = vsubq_f32(t322, t326);
+    const float32x4_t t350 = vsubq_f32(t340, t344);
+    const float32x4_t t356 = vsubq_f32(t332, t350);
+    const float32x4_t t432 = vmulq_n_f32(t356, 0.382683432f);
+    const float32x4_t t333 = vsubq_f32(t323, t327);
+    const float32x4_t t349 = vsubq_f32(t339, t343);
+    const float32x4_t t357 = vaddq_f32(t333, t349);
+    const float32x4_t t433 = vmulq_n_f32(t357, 0.923879533f);
+    const float32x4_t t434 = vsubq_f32(t432, t433);
+    const float32x4_t t438 = vaddq_f32(t428, t434);
+    const float32x4_t t442 = vaddq_f32(t218, t438);
+    const float32x4_t t76 = vsubq_f32(t66, t70);
+    const float32x4_t t92 = vsubq_f32(t82, t86);
+    const float32x4_t t100 = vaddq_f32(t76, t92);
+    const float32x4_t t205 = vaddq_f32(t138, t139);
+    const float32x4_t t206 = vmulq_n_f32(t205, 0.707106781f);
+    const float32x4_t t210 = vsubq_f32(t155, t156);
+    const float32x4_t t212 = vmulq_n_f32(t210, 0.707106781f);
+    const float32x4_t t215 = vaddq_f32(t206, t212);
+    const float32x4_t t219 = vaddq_f32(t100, t215);
+    const float32x4_t t429 = vmulq_n_f32(t294, 0.382683432f);
+    const float32x4_t t430 = vmulq_n_f32(t295, 0.923879533f);
+    const float32x4_t t431 = vaddq_f32(t429, t430);
+    const float32x4_t t435 = vmulq_n_f32(t356, 0.923879533f);
+    const float32x4_t t436 = vmulq_n_f32(t357, 0.382683432f);
+    const float32x4_t t437 = vaddq_f32(t435, t436);
+    const float32x4_t t439 = vaddq_f32(t431, t437);
+    const float32x4_t t443 = vaddq_f32(t219, t439);
+    const float32x4_t t80 = vaddq_f32(t67, t72);
+    const float32x4_t t118 = vsubq_f32(t107, t113);
+    const float32x4_t t124 = vsubq_f32(t80, t118);
+    const float32x4_t t143 = vaddq_f32(t130, t135);
+    const float32x4_t t227 = vmulq_n_f32(t143, 0.382683432f);
+    const float32x4_t t144 = vsubq_f32(t131, t134);
+    const float32x4_t t228 = vmulq_n_f32(t144, 0.923879533f);
+    const float32x4_t t229 = vsubq_f32(t227, t228);
+    const float32x4_t t160 = vaddq_f32(t147, t152);
+    const float32x4_t t234 = vmulq_n_f32(t160, 0.923879533f);
+    const float32x4_t t161 = vsubq_f32(t148, t151);
+    const float32x4_t t237 = vmulq_n_f32(t161, 0.382683432f);
+    const float32x4_t t239 = vsubq_f32(t234, t237);
+    const float32x4_t t247 = vsubq_f32(t229, t239);
+    const float32x4_t t251 = vaddq_f32(t124, t247);
+    const float32x4_t t275 = vaddq_f32(t262, t267);
+    const float32x4_t t312 = vsubq_f32(t301, t307);
+    const float32x4_t t318 = vsubq_f32(t275, t312);
+    const float32x4_t t451 = vmulq_n_f32(t318, 0.831469612f);
+    const float32x4_t t276 = vsubq_f32(t263, t266);
+    const float32x4_t t311 = vaddq_f32(t299, t303);
+    const float32x4_t t319 = vaddq_f32(t276, t311);
+    const float32x4_t t452 = vmulq_n_f32(t319, 0.555570233f);
+    const float32x4_t t453 = vsubq_f32(t451, t452);
+    const float32x4_t t337 = vaddq_f32(t324, t329);
+    const float32x4_t t374 = vsubq_f32(t363, t369);
+    const float32x4_t t380 = vsubq_f32(t337, t374);
+    const float32x4_t t458 = vmulq_n_f32(t380, 0.195090322f);
+    const float32x4_t t338 = vsubq_f32(t325, t328);
+    const float32x4_t t373 = vaddq_f32(t361, t365);
+    const float32x4_t t381 = vaddq_f32(t338, t373);
+    const float32x4_t t460 = vmulq_n_f32(t381, 0.980785280f);
+    const float32x4_t t461 = vaddq_f32(t458, t460);
+    const float32x4_t t467 = vsubq_f32(t453, t461);
+    const float32x4_t t471 = vaddq_f32(t251, t467);
+    const float32x4_t t81 = vsubq_f32(t68, t71);
+    const float32x4_t t117 = vaddq_f32(t105, t109);
+    const float32x4_t t125 = vaddq_f32(t81, t117);
+    const float32x4_t t230 = vmulq_n_f32(t143, 0.923879533f);
+    const float32x4_t t231 = vmulq_n_f32(t144, 0.382683432f);
+    const float32x4_t t232 = vaddq_f32(t230, t231);
+    const float32x4_t t241 = vmulq_n_f32(t160, 0.382683432f);
+    const float32x4_t t243 = vmulq_n_f32(t161, 0.923879533f);
+    const float32x4_t t245 = vaddq_f32(t241, t243);
+    const float32x4_t t248 = vsubq_f32(t232, t245);
+    const float32x4_t t252 = vaddq_f32(t125, t248);
+    const float32x4_t t454 = vmulq_n_f32(t318, 0.555570233f);
+    const float32x4_t t455 = vmulq_n_f32(t319, 0.831469612f);
+    const float32x4_t t456 = vaddq_f32(t454, t455);
+    const float32x4_t t463 = vmulq_n_f32(t380, 0.980785280f);
+    const float32x4_t t464 = vmulq_n_f32(t381, 0.195090322f);
+    const float32x4_t t466 = vsubq_f32(t463, t464);
+    const float32x4_t t468 = vaddq_f32(t456, t466);
+    const float32x4_t t472 = vaddq_f32(t252, t468);
+    const float32x4_t t96 = vsubq_f32(t73, t90);
+    const float32x4_t t165 = vsubq_f32(t137, t154);
+    const float32x4_t t171 = vsubq_f32(t96, t165);
+    const float32x4_t t291 = vsubq_f32(t268, t285);
+    const float32x4_t t292 = vsubq_f32(t269, t286);
+    const float32x4_t t480 = vsubq_f32(t291, t292);
+    const float32x4_t t481 = vmulq_n_f32(t480, 0.707106781f);
+    const float32x4_t t353 = vsubq_f32(t330, t347);
+    const float32x4_t t354 = vsubq_f32(t331, t348);
+    const float32x4_t t484 = vaddq_f32(t353, t354);
+    const float32x4_t t485 = vmulq_n_f32(t484, 0.707106781f);
+    const float32x4_t t491 = vsubq_f32(t481, t485);
+    const float32x4_t t495 = vaddq_f32(t171, t491);
+    const float32x4_t t97 = vsubq_f32(t74, t91);
+    const float32x4_t t164 = vsubq_f32(t136, t153);
+    const float32x4_t t172 = vaddq_f32(t97, t164);
+    const float32x4_t t482 = vaddq_f32(t291, t292);
+    const float32x4_t t483 = vmulq_n_f32(t482, 0.707106781f);
+    const float32x4_t t487 = vsubq_f32(t353, t354);
+    const float32x4_t t489 = vmulq_n_f32(t487, 0.707106781f);
+    const float32x4_t t492 = vaddq_f32(t483, t489);
+    const float32x4_t t496 = vaddq_f32(t172, t492);
+    const float32x4_t t121 = vsubq_f32(t78, t115);
+    const float32x4_t t193 = vsubq_f32(t182, t189);
+    const float32x4_t t199 = vsubq_f32(t121, t193);
+    const float32x4_t t315 = vsubq_f32(t273, t309);
+    const float32x4_t t505 = vmulq_n_f32(t315, 0.555570233f);
+    const float32x4_t t316 = vsubq_f32(t274, t310);
+    const float32x4_t t506 = vmulq_n_f32(t316, 0.831469612f);
+    const float32x4_t t507 = vsubq_f32(t505, t506);
+    const float32x4_t t377 = vsubq_f32(t335, t371);
+    const float32x4_t t511 = vmulq_n_f32(t377, 0.980785280f);
+    const float32x4_t t378 = vsubq_f32(t336, t372);
+    const float32x4_t t514 = vmulq_n_f32(t378, 0.195090322f);
+    const float32x4_t t515 = vaddq_f32(t511, t514);
+    const float32x4_t t521 = vsubq_f32(t507, t515);
+    const float32x4_t t525 = vaddq_f32(t199, t521);
+    const float32x4_t t122 = vsubq_f32(t79, t116);
+    const float32x4_t t192 = vsubq_f32(t179, t186);
+    const float32x4_t t200 = vaddq_f32(t122, t192);
+    const float32x4_t t508 = vmulq_n_f32(t315, 0.831469612f);
+    const float32x4_t t509 = vmulq_n_f32(t316, 0.555570233f);
+    const float32x4_t t510 = vaddq_f32(t508, t509);
+    const float32x4_t t517 = vmulq_n_f32(t377, 0.195090322f);
+    const float32x4_t t518 = vmulq_n_f32(t378, 0.980785280f);
+    const float32x4_t t520 = vsubq_f32(t517, t518);
+    const float32x4_t t522 = vaddq_f32(t510, t520);
+    const float32x4_t t526 = vaddq_f32(t200, t522);
+    const float32x4_t t101 = vaddq_f32(t75, t93);
+    const float32x4_t t217 = vsubq_f32(t206, t212);
+    const float32x4_t t223 = vsubq_f32(t101, t217);
+    const float32x4_t t296 = vaddq_f32(t270, t288);
+    const float32x4_t t534 = vmulq_n_f32(t296, 0.382683432f);
+    const float32x4_t t297 = vsubq_f32(t271, t287);
+    const float32x4_t t535 = vmulq_n_f32(t297, 0.923879533f);
+    const float32x4_t t536 = vsubq_f32(t534, t535);
+    const float32x4_t t358 = vaddq_f32(t332, t350);
+    const float32x4_t t540 = vmulq_n_f32(t358, 0.923879533f);
+    const float32x4_t t359 = vsubq_f32(t333, t349);
+    const float32x4_t t542 = vmulq_n_f32(t359, 0.382683432f);
+    const float32x4_t t544 = vsubq_f32(t540, t542);
+    const float32x4_t t552 = vsubq_f32(t536, t544);
+    const float32x4_t t556 = vaddq_f32(t223, t552);
+    const float32x4_t t102 = vsubq_f32(t76, t92);
+    const float32x4_t t216 = vaddq_f32(t204, t208);
+    const float32x4_t t224 = vaddq_f32(t102, t216);
+    const float32x4_t t537 = vmulq_n_f32(t296, 0.923879533f);
+    const float32x4_t t538 = vmulq_n_f32(t297, 0.382683432f);
+    const float32x4_t t539 = vaddq_f32(t537, t538);
+    const float32x4_t t546 = vmulq_n_f32(t358, 0.382683432f);
+    const float32x4_t t548 = vmulq_n_f32(t359, 0.923879533f);
+    const float32x4_t t550 = vaddq_f32(t546, t548);
+    const float32x4_t t553 = vsubq_f32(t539, t550);
+    const float32x4_t t557 = vaddq_f32(t224, t553);
+    const float32x4_t t126 = vaddq_f32(t80, t118);
+    const float32x4_t t250 = vaddq_f32(t232, t245);
+    const float32x4_t t256 = vsubq_f32(t126, t250);
+    const float32x4_t t320 = vaddq_f32(t275, t312);
+    const float32x4_t t566 = vmulq_n_f32(t320, 0.195090322f);
+    const float32x4_t t321 = vsubq_f32(t276, t311);
+    const float32x4_t t567 = vmulq_n_f32(t321, 0.980785280f);
+    const float32x4_t t568 = vsubq_f32(t566, t567);
+    const float32x4_t t382 = vaddq_f32(t337, t374);
+    const float32x4_t t572 = vmulq_n_f32(t382, 0.555570233f);
+    const float32x4_t t383 = vsubq_f32(t338, t373);
+    const float32x4_t t574 = vmulq_n_f32(t383, 0.831469612f);
+    const float32x4_t t576 = vsubq_f32(t572, t574);
+    const float32x4_t t584 = vsubq_f32(t568, t576);
+    const float32x4_t t588 = vaddq_f32(t256, t584);
+    const float32x4_t t127 = vsubq_f32(t81, t117);
+    const float32x4_t t249 = vaddq_f32(t229, t239);
+    const float32x4_t t257 = vaddq_f32(t127, t249);
+    const float32x4_t t569 = vmulq_n_f32(t320, 0.980785280f);
+    const float32x4_t t570 = vmulq_n_f32(t321, 0.195090322f);
+    const float32x4_t t571 = vaddq_f32(t569, t570);
+    const float32x4_t t578 = vmulq_n_f32(t382, 0.831469612f);
+    const float32x4_t t580 = vmulq_n_f32(t383, 0.555570233f);
+    const float32x4_t t582 = vaddq_f32(t578, t580);
+    const float32x4_t t585 = vsubq_f32(t571, t582);
+    const float32x4_t t589 = vaddq_f32(t257, t585);
+    const float32x4_t t168 = vsubq_f32(t94, t162);
+    const float32x4_t t387 = vsubq_f32(t290, t352);
+    const float32x4_t t393 = vsubq_f32(t168, t387);
+    const float32x4_t t169 = vsubq_f32(t95, t163);
+    const float32x4_t t386 = vsubq_f32(t289, t351);
+    const float32x4_t t394 = vaddq_f32(t169, t386);
+    const float32x4_t t196 = vsubq_f32(t119, t190);
+    const float32x4_t t416 = vsubq_f32(t404, t412);
+    const float32x4_t t422 = vsubq_f32(t196, t416);
+    const float32x4_t t197 = vsubq_f32(t120, t191);
+    const float32x4_t t415 = vsubq_f32(t401, t409);
+    const float32x4_t t423 = vaddq_f32(t197, t415);
+    const float32x4_t t220 = vsubq_f32(t99, t214);
+    const float32x4_t t441 = vsubq_f32(t431, t437);
+    const float32x4_t t447 = vsubq_f32(t220, t441);
+    const float32x4_t t221 = vsubq_f32(t100, t215);
+    const float32x4_t t440 = vsubq_f32(t428, t434);
+    const float32x4_t t448 = vaddq_f32(t221, t440);
+    const float32x4_t t253 = vsubq_f32(t124, t247);
+    const float32x4_t t470 = vsubq_f32(t456, t466);
+    const float32x4_t t476 = vsubq_f32(t253, t470);
+    const float32x4_t t254 = vsubq_f32(t125, t248);
+    const float32x4_t t469 = vaddq_f32(t453, t461);
+    const float32x4_t t477 = vaddq_f32(t254, t469);
+    const float32x4_t t173 = vaddq_f32(t96, t165);
+    const float32x4_t t494 = vsubq_f32(t483, t489);
+    const float32x4_t t500 = vsubq_f32(t173, t494);
+    const float32x4_t t174 = vsubq_f32(t97, t164);
+    const float32x4_t t493 = vaddq_f32(t481, t485);
+    const float32x4_t t501 = vaddq_f32(t174, t493);
+    const float32x4_t t201 = vaddq_f32(t121, t193);
+    const float32x4_t t524 = vsubq_f32(t510, t520);
+    const float32x4_t t530 = vsubq_f32(t201, t524);
+    const float32x4_t t202 = vsubq_f32(t122, t192);
+    const float32x4_t t523 = vaddq_f32(t507, t515);
+    const float32x4_t t531 = vaddq_f32(t202, t523);
+    const float32x4_t t225 = vaddq_f32(t101, t217);
+    const float32x4_t t555 = vaddq_f32(t539, t550);
+    const float32x4_t t561 = vsubq_f32(t225, t555);
+    const float32x4_t t226 = vsubq_f32(t102, t216);
+    const float32x4_t t554 = vaddq_f32(t536, t544);
+    const float32x4_t t562 = vaddq_f32(t226, t554);
+    const float32x4_t t258 = vaddq_f32(t126, t250);
+    const float32x4_t t587 = vaddq_f32(t571, t582);
+    const float32x4_t t593 = vsubq_f32(t258, t587);
+    const float32x4_t t259 = vsubq_f32(t127, t249);
+    const float32x4_t t586 = vaddq_f32(t568, t576);
+    const float32x4_t t594 = vaddq_f32(t259, t586);
+    const float32x4_t t390 = vsubq_f32(t166, t384);
+    const float32x4_t t391 = vsubq_f32(t167, t385);
+    const float32x4_t t419 = vsubq_f32(t194, t413);
+    const float32x4_t t420 = vsubq_f32(t195, t414);
+    const float32x4_t t444 = vsubq_f32(t218, t438);
+    const float32x4_t t445 = vsubq_f32(t219, t439);
+    const float32x4_t t473 = vsubq_f32(t251, t467);
+    const float32x4_t t474 = vsubq_f32(t252, t468);
+    const float32x4_t t497 = vsubq_f32(t171, t491);
+    const float32x4_t t498 = vsubq_f32(t172, t492);
+    const float32x4_t t527 = vsubq_f32(t199, t521);
+    const float32x4_t t528 = vsubq_f32(t200, t522);
+    const float32x4_t t558 = vsubq_f32(t223, t552);
+    const float32x4_t t559 = vsubq_f32(t224, t553);
+    const float32x4_t t590 = vsubq_f32(t256, t584);
+    const float32x4_t t591 = vsubq_f32(t257, t585);
+    const float32x4_t t395 = vaddq_f32(t168, t387);
+    const float32x4_t t396 = vsubq_f32(t169, t386);
+    const float32x4_t t424 = vaddq_f32(t196, t416);
+    const float32x4_t t425 = vsubq_f32(t197, t415);
+    const float32x4_t t449 = vaddq_f32(t220, t441);
+    const float32x4_t t450 = vsubq_f32(t221, t440);
+    const float32x4_t t478 = vaddq_f32(t253, t470);
+    const float32x4_t t479 = vsubq_f32(t254, t469);
+    const float32x4_t t502 = vaddq_f32(t173, t494);
+    const float32x4_t t503 = vsubq_f32(t174, t493);
+    const float32x4_t t532 = vaddq_f32(t201, t524);
+    const float32x4_t t533 = vsubq_f32(t202, t523);
+    const float32x4_t t563 = vaddq_f32(t225, t555);
+    const float32x4_t t564 = vsubq_f32(t226, t554);
+    const float32x4_t t595 = vaddq_f32(t258, t587);
+    const float32x4_t t596 = vsubq_f32(t259, t586);
+    store4(output + 0, 32, t388, t389, t417, t418, t442, t443, t471, t472);
+    store4(output + 4, 32, t495, t496, t525, t526, t556, t557, t588, t589);
+    store4(output + 8, 32, t393, t394, t422, t423, t447, t448, t476, t477);
+    store4(output + 12, 32, t500, t501, t530, t531, t561, t562, t593, t594);
+    store4(output + 16, 32, t390, t391, t419, t420, t444, t445, t473, t474);
+    store4(output + 20, 32, t497, t498, t527, t528, t558, t559, t590, t591);
+    store4(output + 24, 32, t395, t396, t424, t425, t449, t450, t478, t479);
+    store4(output + 28, 32, t502, t503, t532, t533, t563, t564, t595, t596);
+}
+
+// 912 additions, 248 multiplications (x4)
+void codelet_64_fwd_x4(const CkFftComplex* input, CkFftComplex* output, CkFftSize stride)
+{
+    CkFftSize stride4 = stride * 4;
+    const float32x4x2_t x0 = load4(input + 0*stride4, stride);
+    const float32x4x2_t x32 = load4(input + 32*stride4, stride);
+    const float32x4_t t129 = vaddq_f32(x0.val[0], x32.val[0]);
+    const float32x4x2_t x16 = load4(input + 16*stride4, stride);
+    const float32x4x2_t x48 = load4(input + 48*stride4, stride);
+    const float32x4_t t133 = vaddq_f32(x16.val[0], x48.val[0]);
+    const float32x4_t t137 = vaddq_f32(t129, t133);
+    const float32x4x2_t x8 = load4(input + 8*stride4, stride);
+    const float32x4x2_t x40 = load4(input + 40*stride4, stride);
+    const float32x4_t t146 = vaddq_f32(x8.val[0], x40.val[0]);
+    const float32x4x2_t x24 = load4(input + 24*stride4, stride);
+    const float32x4x2_t x56 = load4(input + 56*stride4, stride);
+    const float32x4_t t150 = vaddq_f32(x24.val[0], x56.val[0]);
+    const float32x4_t t154 = vaddq_f32(t146, t150);
+    const float32x4_t t158 = vaddq_f32(t137, t154);
+    const float32x4x2_t x4 = load4(input + 4*stride4, stride);
+    const float32x4x2_t x36 = load4(input + 36*stride4, stride);
+    const float32x4_t t195 = vaddq_f32(x4.val[0], x36.val[0]);
+    const float32x4x2_t x20 = load4(input + 20*stride4, stride);
+    const float32x4x2_t x52 = load4(input + 52*stride4, stride);
+    const float32x4_t t199 = vaddq_f32(x20.val[0], x52.val[0]);
+    const float32x4_t t203 = vaddq_f32(t195, t199);
+    const float32x4x2_t x12 = load4(input + 12*stride4, stride);
+    const float32x4x2_t x44 = load4(input + 44*stride4, stride);
+    const float32x4_t t212 = vaddq_f32(x12.val[0], x44.val[0]);
+    const float32x4x2_t x28 = load4(input + 28*stride4, stride);
+    const float32x4x2_t x60 = load4(input + 60*stride4, stride);
+    const float32x4_t t216 = vaddq_f32(x28.val[0], x60.val[0]);
+    const float32x4_t t220 = vaddq_f32(t212, t216);
+    const float32x4_t t229 = vaddq_f32(t203, t220);
+    const float32x4_t t233 = vaddq_f32(t158, t229);
+    const float32x4x2_t x2 = load4(input + 2*stride4, stride);
+    const float32x4x2_t x34 = load4(input + 34*stride4, stride);
+    const float32x4_t t340 = vaddq_f32(x2.val[0], x34.val[0]);
+    const float32x4x2_t x18 = load4(input + 18*stride4, stride);
+    const float32x4x2_t x50 = load4(input + 50*stride4, stride);
+    const float32x4_t t344 = vaddq_f32(x18.val[0], x50.val[0]);
+    const float32x4_t t348 = vaddq_f32(t340, t344);
+    const float32x4x2_t x10 = load4(input + 10*stride4, stride);
+    const float32x4x2_t x42 = load4(input + 42*stride4, stride);
+    const float32x4_t t357 = vaddq_f32(x10.val[0], x42.val[0]);
+    const float32x4x2_t x26 = load4(input + 26*stride4, stride);
+    const float32x4x2_t x58 = load4(input + 58*stride4, stride);
+    const float32x4_t t361 = vaddq_f32(x26.val[0], x58.val[0]);
+    const float32x4_t t365 = vaddq_f32(t357, t361);
+    const float32x4_t t369 = vaddq_f32(t348, t365);
+    const float32x4x2_t x6 = load4(input + 6*stride4, stride);
+    const float32x4x2_t x38 = load4(input + 38*stride4, stride);
+    const float32x4_t t405 = vaddq_f32(x6.val[0], x38.val[0]);
+    const float32x4x2_t x22 = load4(input + 22*stride4, stride);
+    const float32x4x2_t x54 = load4(input + 54*stride4, stride);
+    const float32x4_t t409 = vaddq_f32(x22.val[0], x54.val[0]);
+    const float32x4_t t413 = vaddq_f32(t405, t409);
+    const float32x4x2_t x14 = load4(input + 14*stride4, stride);
+    const float32x4x2_t x46 = load4(input + 46*stride4, stride);
+    const float32x4_t t422 = vaddq_f32(x14.val[0], x46.val[0]);
+    const float32x4x2_t x30 = load4(input + 30*stride4, stride);
+    const float32x4x2_t x62 = load4(input + 62*stride4, stride);
+    const float32x4_t t426 = vaddq_f32(x30.val[0], x62.val[0]);
+    const float32x4_t t430 = vaddq_f32(t422, t426);
+    const float32x4_t t434 = vaddq_f32(t413, t430);
+    const float32x4_t t470 = vaddq_f32(t369, t434);
+    const float32x4_t t474 = vaddq_f32(t233, t470);
+    const float32x4x2_t x1 = load4(input + 1*stride4, stride);
+    const float32x4x2_t x33 = load4(input + 33*stride4, stride);
+    const float32x4_t t722 = vaddq_f32(x1.val[0], x33.val[0]);
+    const float32x4x2_t x17 = load4(input + 17*stride4, stride);
+    const float32x4x2_t x49 = load4(input + 49*stride4, stride);
+    const float32x4_t t726 = vaddq_f32(x17.val[0], x49.val[0]);
+    const float32x4_t t730 = vaddq_f32(t722, t726);
+    const float32x4x2_t x9 = load4(input + 9*stride4, stride);
+    const float32x4x2_t x41 = load4(input + 41*stride4, stride);
+    const float32x4_t t739 = vaddq_f32(x9.val[0], x41.val[0]);
+    const float32x4x2_t x25 = load4(input + 25*stride4, stride);
+    const float32x4x2_t x57 = load4(input + 57*stride4, stride);
+    const float32x4_t t743 = vaddq_f32(x25.val[0], x57.val[0]);
+    const float32x4_t t747 = vaddq_f32(t739, t743);
+    const float32x4_t t751 = vaddq_f32(t730, t747);
+    const float32x4x2_t x5 = load4(input + 5*stride4, stride);
+    const float32x4x2_t x37 = load4(input + 37*stride4, stride);
+    const float32x4_t t787 = vaddq_f32(x5.val[0], x37.val[0]);
+    const float32x4x2_t x21 = load4(input + 21*stride4, stride);
+    const float32x4x2_t x53 = load4(input + 53*stride4, stride);
+    const float32x4_t t791 = vaddq_f32(x21.val[0], x53.val[0]);
+    const float32x4_t t795 = vaddq_f32(t787, t791);
+    const float32x4x2_t x13 = load4(input + 13*stride4, stride);
+    const float32x4x2_t x45 = load4(input + 45*stride4, stride);
+    const float32x4_t t804 = vaddq_f32(x13.val[0], x45.val[0]);
+    const float32x4x2_t x29 = load4(input + 29*stride4, stride);
+    const float32x4x2_t x61 = load4(input + 61*stride4, stride);
+    const float32x4_t t808 = vaddq_f32(x29.val[0], x61.val[0]);
+    const float32x4_t t812 = vaddq_f32(t804, t808);
+    const float32x4_t t821 = vaddq_f32(t795, t812);
+    const float32x4_t t825 = vaddq_f32(t751, t821);
+    const float32x4x2_t x3 = load4(input + 3*stride4, stride);
+    const float32x4x2_t x35 = load4(input + 35*stride4, stride);
+    const float32x4_t t927 = vaddq_f32(x3.val[0], x35.val[0]);
+    const float32x4x2_t x19 = load4(input + 19*stride4, stride);
+    const float32x4x2_t x51 = load4(input + 51*stride4, stride);
+    const float32x4_t t931 = vaddq_f32(x19.val[0], x51.val[0]);
+    const float32x4_t t935 = vaddq_f32(t927, t931);
+    const float32x4x2_t x11 = load4(input + 11*stride4, stride);
+    const float32x4x2_t x43 = load4(input + 43*stride4, stride);
+    const float32x4_t t944 = vaddq_f32(x11.val[0], x43.val[0]);
+    const float32x4x2_t x27 = load4(input + 27*stride4, stride);
+    const float32x4x2_t x59 = load4(input + 59*stride4, stride);
+    const float32x4_t t948 = vaddq_f32(x27.val[0], x59.val[0]);
+    const float32x4_t t952 = vaddq_f32(t944, t948);
+    const float32x4_t t956 = vaddq_f32(t935, t952);
+    const float32x4x2_t x7 = load4(input + 7*stride4, stride);
+    const float32x4x2_t x39 = load4(input + 39*stride4, stride);
+    const float32x4_t t992 = vaddq_f32(x7.val[0], x39.val[0]);
+    const float32x4x2_t x23 = load4(input + 23*stride4, stride);
+    const float32x4x2_t x55 = load4(input + 55*stride4, stride);
+    const float32x4_t t996 = vaddq_f32(x23.val[0], x55.val[0]);
+    const float32x4_t t1000 = vaddq_f32(t992, t996);
+    const float32x4x2_t x15 = load4(input + 15*stride4, stride);
+    const float32x4x2_t x47 = load4(input + 47*stride4, stride);
+    const float32x4_t t1009 = vaddq_f32(x15.val[0], x47.val[0]);
+    const float32x4x2_t x31 = load4(input + 31*stride4, stride);
+    const float32x4x2_t x63 = load4(input + 63*stride4, stride);
+    const float32x4_t t1013 = vaddq_f32(x31.val[0], x63.val[0]);
+    const float32x4_t t1017 = vaddq_f32(t1009, t1013);
+    const float32x4_t t1026 = vaddq_f32(t1000, t1017);
+    const float32x4_t t1030 = vaddq_f32(t956, t1026);
+    const float32x4_t t1132 = vaddq_f32(t825, t1030);
+    const float32x4_t t1136 = vaddq_f32(t474, t1132);
+    const float32x4_t t130 = vaddq_f32(x0.val[1], x32.val[1]);
+    const float32x4_t t134 = vaddq_f32(x16.val[1], x48.val[1]);
+    const float32x4_t t138 = vaddq_f32(t130, t134);
+    const float32x4_t t147 = vaddq_f32(x8.val[1], x40.val[1]);
+    const float32x4_t t151 = vaddq_f32(x24.val[1], x56.val[1]);
+    const float32x4_t t155 = vaddq_f32(t147, t151);
+    const float32x4_t t159 = vaddq_f32(t138, t155);
+    const float32x4_t t196 = vaddq_f32(x4.val[1], x36.val[1]);
+    const float32x4_t t200 = vaddq_f32(x20.val[1], x52.val[1]);
+    const float32x4_t t204 = vaddq_f32(t196, t200);
+    const float32x4_t t213 = vaddq_f32(x12.val[1], x44.val[1]);
+    const float32x4_t t217 = vaddq_f32(x28.val[1], x60.val[1]);
+    const float32x4_t t221 = vaddq_f32(t213, t217);
+    const float32x4_t t230 = vaddq_f32(t204, t221);
+    const float32x4_t t234 = vaddq_f32(t159, t230);
+    const float32x4_t t341 = vaddq_f32(x2.val[1], x34.val[1]);
+    const float32x4_t t345 = vaddq_f32(x18.val[1], x50.val[1]);
+    const float32x4_t t349 = vaddq_f32(t341, t345);
+    const float32x4_t t358 = vaddq_f32(x10.val[1], x42.val[1]);
+    const float32x4_t t362 = vaddq_f32(x26.val[1], x58.val[1]);
+    const float32x4_t t366 = vaddq_f32(t358, t362);
+    const float32x4_t t370 = vaddq_f32(t349, t366);
+    const float32x4_t t406 = vaddq_f32(x6.val[1], x38.val[1]);
+    const float32x4_t t410 = vaddq_f32(x22.val[1], x54.val[1]);
+    const float32x4_t t414 = vaddq_f32(t406, t410);
+    const float32x4_t t423 = vaddq_f32(x14.val[1], x46.val[1]);
+    const float32x4_t t427 = vaddq_f32(x30.val[1], x62.val[1]);
+    const float32x4_t t431 = vaddq_f32(t423, t427);
+    const float32x4_t t435 = vaddq_f32(t414, t431);
+    const float32x4_t t471 = vaddq_f32(t370, t435);
+    const float32x4_t t475 = vaddq_f32(t234, t471);
+    const float32x4_t t723 = vaddq_f32(x1.val[1], x33.val[1]);
+    const float32x4_t t727 = vaddq_f32(x17.val[1], x49.val[1]);
+    const float32x4_t t731 = vaddq_f32(t723, t727);
+    const float32x4_t t740 = vaddq_f32(x9.val[1], x41.val[1]);
+    const float32x4_t t744 = vaddq_f32(x25.val[1], x57.val[1]);
+    const float32x4_t t748 = vaddq_f32(t740, t744);
+    const float32x4_t t752 = vaddq_f32(t731, t748);
+    const float32x4_t t788 = vaddq_f32(x5.val[1], x37.val[1]);
+    const float32x4_t t792 = vaddq_f32(x21.val[1], x53.val[1]);
+    const float32x4_t t796 = vaddq_f32(t788, t792);
+    const float32x4_t t805 = vaddq_f32(x13.val[1], x45.val[1]);
+    const float32x4_t t809 = vaddq_f32(x29.val[1], x61.val[1]);
+    const float32x4_t t813 = vaddq_f32(t805, t809);
+    const float32x4_t t822 = vaddq_f32(t796, t813);
+    const float32x4_t t826 = vaddq_f32(t752, t822);
+    const float32x4_t t928 = vaddq_f32(x3.val[1], x35.val[1]);
+    const float32x4_t t932 = vaddq_f32(x19.val[1], x51.val[1]);
+    const float32x4_t t936 = vaddq_f32(t928, t932);
+    const float32x4_t t945 = vaddq_f32(x11.val[1], x43.val[1]);
+    const float32x4_t t949 = vaddq_f32(x27.val[1], x59.val[1]);
+    const float32x4_t t953 = vaddq_f32(t945, t949);
+    const float32x4_t t957 = vaddq_f32(t936, t953);
+    const float32x4_t t993 = vaddq_f32(x7.val[1], x39.val[1]);
+    const float32x4_t t997 = vaddq_f32(x23.val[1], x55.val[1]);
+    const float32x4_t t1001 = vaddq_f32(t993, t997);
+    const float32x4_t t1010 = vaddq_f32(x15.val[1], x47.val[1]);
+    const float32x4_t t1014 = vaddq_f32(x31.val[1], x63.val[1]);
+    const float32x4_t t1018 = vaddq_f32(t1010, t1014);
+    const float32x4_t t1027 = vaddq_f32(t1001, t1018);
+    const float32x4_t t1031 = vaddq_f32(t957, t1027);
+    const float32x4_t t1133 = vaddq_f32(t826, t1031);
+    const float32x4_t t1137 = vaddq_f32(t475, t1133);
+    const float32x4_t t131 = vsubq_f32(x0.val[0], x32.val[0]);
+    const float32x4_t t136 = vsubq_f32(x16.val[1], x48.val[1]);
+    const float32x4_t t142 = vaddq_f32(t131, t136);
+    const float32x4_t t148 = vsubq_f32(x8.val[0], x40.val[0]);
+    const float32x4_t t149 = vsubq_f32(x8.val[1], x40.val[1]);
+    const float32x4_t t167 = vaddq_f32(t148, t149);
+    const float32x4_t t169 = vmulq_n_f32(t167, 0.707106781f);
+    const float32x4_t t152 = vsubq_f32(x24.val[0], x56.val[0]);
+    const float32x4_t t153 = vsubq_f32(x24.val[1], x56.val[1]);
+    const float32x4_t t174 = vsubq_f32(t152, t153);
+    const float32x4_t t175 = vmulq_n_f32(t174, 0.707106781f);
+    const float32x4_t t180 = vsubq_f32(t169, t175);
+    const float32x4_t t186 = vaddq_f32(t142, t180);
+    const float32x4_t t197 = vsubq_f32(x4.val[0], x36.val[0]);
+    const float32x4_t t202 = vsubq_f32(x20.val[1], x52.val[1]);
+    const float32x4_t t208 = vaddq_f32(t197, t202);
+    const float32x4_t t243 = vmulq_n_f32(t208, 0.923879533f);
+    const float32x4_t t198 = vsubq_f32(x4.val[1], x36.val[1]);
+    const float32x4_t t201 = vsubq_f32(x20.val[0], x52.val[0]);
+    const float32x4_t t209 = vsubq_f32(t198, t201);
+    const float32x4_t t245 = vmulq_n_f32(t209, 0.382683432f);
+    const float32x4_t t247 = vaddq_f32(t243, t245);
+    const float32x4_t t214 = vsubq_f32(x12.val[0], x44.val[0]);
+    const float32x4_t t219 = vsubq_f32(x28.val[1], x60.val[1]);
+    const float32x4_t t225 = vaddq_f32(t214, t219);
+    const float32x4_t t254 = vmulq_n_f32(t225, 0.382683432f);
+    const float32x4_t t215 = vsubq_f32(x12.val[1], x44.val[1]);
+    const float32x4_t t218 = vsubq_f32(x28.val[0], x60.val[0]);
+    const float32x4_t t226 = vsubq_f32(t215, t218);
+    const float32x4_t t255 = vmulq_n_f32(t226, 0.923879533f);
+    const float32x4_t t257 = vaddq_f32(t254, t255);
+    const float32x4_t t263 = vaddq_f32(t247, t257);
+    const float32x4_t t269 = vaddq_f32(t186, t263);
+    const float32x4_t t342 = vsubq_f32(x2.val[0], x34.val[0]);
+    const float32x4_t t347 = vsubq_f32(x18.val[1], x50.val[1]);
+    const float32x4_t t353 = vaddq_f32(t342, t347);
+    const float32x4_t t359 = vsubq_f32(x10.val[0], x42.val[0]);
+    const float32x4_t t360 = vsubq_f32(x10.val[1], x42.val[1]);
+    const float32x4_t t378 = vaddq_f32(t359, t360);
+    const float32x4_t t379 = vmulq_n_f32(t378, 0.707106781f);
+    const float32x4_t t363 = vsubq_f32(x26.val[0], x58.val[0]);
+    const float32x4_t t364 = vsubq_f32(x26.val[1], x58.val[1]);
+    const float32x4_t t384 = vsubq_f32(t363, t364);
+    const float32x4_t t385 = vmulq_n_f32(t384, 0.707106781f);
+    const float32x4_t t390 = vsubq_f32(t379, t385);
+    const float32x4_t t396 = vaddq_f32(t353, t390);
+    const float32x4_t t484 = vmulq_n_f32(t396, 0.980785280f);
+    const float32x4_t t343 = vsubq_f32(x2.val[1], x34.val[1]);
+    const float32x4_t t346 = vsubq_f32(x18.val[0], x50.val[0]);
+    const float32x4_t t354 = vsubq_f32(t343, t346);
+    const float32x4_t t380 = vsubq_f32(t359, t360);
+    const float32x4_t t382 = vmulq_n_f32(t380, 0.707106781f);
+    const float32x4_t t387 = vaddq_f32(t363, t364);
+    const float32x4_t t388 = vmulq_n_f32(t387, 0.707106781f);
+    const float32x4_t t391 = vaddq_f32(t382, t388);
+    const float32x4_t t397 = vsubq_f32(t354, t391);
+    const float32x4_t t486 = vmulq_n_f32(t397, 0.195090322f);
+    const float32x4_t t488 = vaddq_f32(t484, t486);
+    const float32x4_t t407 = vsubq_f32(x6.val[0], x38.val[0]);
+    const float32x4_t t412 = vsubq_f32(x22.val[1], x54.val[1]);
+    const float32x4_t t418 = vaddq_f32(t407, t412);
+    const float32x4_t t424 = vsubq_f32(x14.val[0], x46.val[0]);
+    const float32x4_t t425 = vsubq_f32(x14.val[1], x46.val[1]);
+    const float32x4_t t443 = vaddq_f32(t424, t425);
+    const float32x4_t t444 = vmulq_n_f32(t443, 0.707106781f);
+    const float32x4_t t428 = vsubq_f32(x30.val[0], x62.val[0]);
+    const float32x4_t t429 = vsubq_f32(x30.val[1], x62.val[1]);
+    const float32x4_t t449 = vsubq_f32(t428, t429);
+    const float32x4_t t450 = vmulq_n_f32(t449, 0.707106781f);
+    const float32x4_t t455 = vsubq_f32(t444, t450);
+    const float32x4_t t461 = vaddq_f32(t418, t455);
+    const float32x4_t t495 = vmulq_n_f32(t461, 0.831469612f);
+    const float32x4_t t408 = vsubq_f32(x6.val[1], x38.val[1]);
+    const float32x4_t t411 = vsubq_f32(x22.val[0], x54.val[0]);
+    const float32x4_t t419 = vsubq_f32(t408, t411);
+    const float32x4_t t445 = vsubq_f32(t424, t425);
+    const float32x4_t t447 = vmulq_n_f32(t445, 0.707106781f);
+    const float32x4_t t452 = vaddq_f32(t428, t429);
+    const float32x4_t t453 = vmulq_n_f32(t452, 0.707106781f);
+    const float32x4_t t456 = vaddq_f32(t447, t453);
+    const float32x4_t t462 = vsubq_f32(t419, t456);
+    const float32x4_t t497 = vmulq_n_f32(t462, 0.555570233f);
+    const float32x4_t t499 = vaddq_f32(t495, t497);
+    const float32x4_t t505 = vaddq_f32(t488, t499);
+    const float32x4_t t511 = vaddq_f32(t269, t505);
+    const float32x4_t t724 = vsubq_f32(x1.val[0], x33.val[0]);
+    const float32x4_t t729 = vsubq_f32(x17.val[1], x49.val[1]);
+    const float32x4_t t735 = vaddq_f32(t724, t729);
+    const float32x4_t t741 = vsubq_f32(x9.val[0], x41.val[0]);
+    const float32x4_t t742 = vsubq_f32(x9.val[1], x41.val[1]);
+    const float32x4_t t760 = vaddq_f32(t741, t742);
+    const float32x4_t t761 = vmulq_n_f32(t760, 0.707106781f);
+    const float32x4_t t745 = vsubq_f32(x25.val[0], x57.val[0]);
+    const float32x4_t t746 = vsubq_f32(x25.val[1], x57.val[1]);
+    const float32x4_t t766 = vsubq_f32(t745, t746);
+    const float32x4_t t767 = vmulq_n_f32(t766, 0.707106781f);
+    const float32x4_t t772 = vsubq_f32(t761, t767);
+    const float32x4_t t778 = vaddq_f32(t735, t772);
+    const float32x4_t t789 = vsubq_f32(x5.val[0], x37.val[0]);
+    const float32x4_t t794 = vsubq_f32(x21.val[1], x53.val[1]);
+    const float32x4_t t800 = vaddq_f32(t789, t794);
+    const float32x4_t t834 = vmulq_n_f32(t800, 0.923879533f);
+    const float32x4_t t790 = vsubq_f32(x5.val[1], x37.val[1]);
+    const float32x4_t t793 = vsubq_f32(x21.val[0], x53.val[0]);
+    const float32x4_t t801 = vsubq_f32(t790, t793);
+    const float32x4_t t835 = vmulq_n_f32(t801, 0.382683432f);
+    const float32x4_t t837 = vaddq_f32(t834, t835);
+    const float32x4_t t806 = vsubq_f32(x13.val[0], x45.val[0]);
+    const float32x4_t t811 = vsubq_f32(x29.val[1], x61.val[1]);
+    const float32x4_t t817 = vaddq_f32(t806, t811);
+    const float32x4_t t843 = vmulq_n_f32(t817, 0.382683432f);
+    const float32x4_t t807 = vsubq_f32(x13.val[1], x45.val[1]);
+    const float32x4_t t810 = vsubq_f32(x29.val[0], x61.val[0]);
+    const float32x4_t t818 = vsubq_f32(t807, t810);
+    const float32x4_t t844 = vmulq_n_f32(t818, 0.923879533f);
+    const float32x4_t t846 = vaddq_f32(t843, t844);
+    const float32x4_t t852 = vaddq_f32(t837, t846);
+    const float32x4_t t858 = vaddq_f32(t778, t852);
+    const float32x4_t t1146 = vmulq_n_f32(t858, 0.995184727f);
+    const float32x4_t t725 = vsubq_f32(x1.val[1], x33.val[1]);
+    const float32x4_t t728 = vsubq_f32(x17.val[0], x49.val[0]);
+    const float32x4_t t736 = vsubq_f32(t725, t728);
+    const float32x4_t t762 = vsubq_f32(t741, t742);
+    const float32x4_t t764 = vmulq_n_f32(t762, 0.707106781f);
+    const float32x4_t t769 = vaddq_f32(t745, t746);
+    const float32x4_t t770 = vmulq_n_f32(t769, 0.707106781f);
+    const float32x4_t t773 = vaddq_f32(t764, t770);
+    const float32x4_t t779 = vsubq_f32(t736, t773);
+    const float32x4_t t838 = vmulq_n_f32(t800, 0.382683432f);
+    const float32x4_t t840 = vmulq_n_f32(t801, 0.923879533f);
+    const float32x4_t t841 = vsubq_f32(t838, t840);
+    const float32x4_t t847 = vmulq_n_f32(t817, 0.923879533f);
+    const float32x4_t t849 = vmulq_n_f32(t818, 0.382683432f);
+    const float32x4_t t850 = vsubq_f32(t847, t849);
+    const float32x4_t t853 = vaddq_f32(t841, t850);
+    const float32x4_t t859 = vsubq_f32(t779, t853);
+    const float32x4_t t1148 = vmulq_n_f32(t859, 0.098017140f);
+    const float32x4_t t1150 = vaddq_f32(t1146, t1148);
+    const float32x4_t t929 = vsubq_f32(x3.val[0], x35.val[0]);
+    const float32x4_t t934 = vsubq_f32(x19.val[1], x51.val[1]);
+    const float32x4_t t940 = vaddq_f32(t929, t934);
+    const float32x4_t t946 = vsubq_f32(x11.val[0], x43.val[0]);
+    const float32x4_t t947 = vsubq_f32(x11.val[1], x43.val[1]);
+    const float32x4_t t965 = vaddq_f32(t946, t947);
+    const float32x4_t t966 = vmulq_n_f32(t965, 0.707106781f);
+    const float32x4_t t950 = vsubq_f32(x27.val[0], x59.val[0]);
+    const float32x4_t t951 = vsubq_f32(x27.val[1], x59.val[1]);
+    const float32x4_t t971 = vsubq_f32(t950, t951);
+    const float32x4_t t972 = vmulq_n_f32(t971, 0.707106781f);
+    const float32x4_t t977 = vsubq_f32(t966, t972);
+    const float32x4_t t983 = vaddq_f32(t940, t977);
+    const float32x4_t t994 = vsubq_f32(x7.val[0], x39.val[0]);
+    const float32x4_t t999 = vsubq_f32(x23.val[1], x55.val[1]);
+    const float32x4_t t1005 = vaddq_f32(t994, t999);
+    const float32x4_t t1039 = vmulq_n_f32(t1005, 0.923879533f);
+    const float32x4_t t995 = vsubq_f32(x7.val[1], x39.val[1]);
+    const float32x4_t t998 = vsubq_f32(x23.val[0], x55.val[0]);
+    const float32x4_t t1006 = vsubq_f32(t995, t998);
+    const float32x4_t t1040 = vmulq_n_f32(t1006, 0.382683432f);
+    const float32x4_t t1042 = vaddq_f32(t1039, t1040);
+    const float32x4_t t1011 = vsubq_f32(x15.val[0], x47.val[0]);
+    const float32x4_t t1016 = vsubq_f32(x31.val[1], x63.val[1]);
+    const float32x4_t t1022 = vaddq_f32(t1011, t1016);
+    const float32x4_t t1048 = vmulq_n_f32(t1022, 0.382683432f);
+    const float32x4_t t1012 = vsubq_f32(x15.val[1], x47.val[1]);
+    const float32x4_t t1015 = vsubq_f32(x31.val[0], x63.val[0]);
+    const float32x4_t t1023 = vsubq_f32(t1012, t1015);
+    const float32x4_t t1049 = vmulq_n_f32(t1023, 0.923879533f);
+    const float32x4_t t1051 = vaddq_f32(t1048, t1049);
+    const float32x4_t t1057 = vaddq_f32(t1042, t1051);
+    const float32x4_t t1063 = vaddq_f32(t983, t1057);
+    const float32x4_t t1157 = vmulq_n_f32(t1063, 0.956940336f);
+    const float32x4_t t930 = vsubq_f32(x3.val[1], x35.val[1]);
+    const float32x4_t t933 = vsubq_f32(x19.val[0], x51.val[0]);
+    const float32x4_t t941 = vsubq_f32(t930, t933);
+    const float32x4_t t967 = vsubq_f32(t946, t947);
+    const float32x4_t t969 = vmulq_n_f32(t967, 0.707106781f);
+    const float32x4_t t974 = vaddq_f32(t950, t951);
+    const float32x4_t t975 = vmulq_n_f32(t974, 0.707106781f);
+    const float32x4_t t978 = vaddq_f32(t969, t975);
+    const float32x4_t t984 = vsubq_f32(t941, t978);
+    const float32x4_t t1043 = vmulq_n_f32(t1005, 0.382683432f);
+    const float32x4_t t1045 = vmulq_n_f32(t1006, 0.923879533f);
+    const float32x4_t t1046 = vsubq_f32(t1043, t1045);
+    const float32x4_t t1052 = vmulq_n_f32(t1022, 0.923879533f);
+    const float32x4_t t1054 = vmulq_n_f32(t1023, 0.382683432f);
+    const float32x4_t t1055 = vsubq_f32(t1052, t1054);
+    const float32x4_t t1058 = vaddq_f32(t1046, t1055);
+    const float32x4_t t1064 = vsubq_f32(t984, t1058);
+    const float32x4_t t1159 = vmulq_n_f32(t1064, 0.290284677f);
+    const float32x4_t t1161 = vaddq_f32(t1157, t1159);
+    const float32x4_t t1167 = vaddq_f32(t1150, t1161);
+    const float32x4_t t1173 = vaddq_f32(t511, t1167);
+    const float32x4_t t132 = vsubq_f32(x0.val[1], x32.val[1]);
+    const float32x4_t t135 = vsubq_f32(x16.val[0], x48.val[0]);
+    const float32x4_t t143 = vsubq_f32(t132, t135);
+    const float32x4_t t170 = vsubq_f32(t148, t149);
+    const float32x4_t t172 = vmulq_n_f32(t170, 0.707106781f);
+    const float32x4_t t177 = vaddq_f32(t152, t153);
+    const float32x4_t t178 = vmulq_n_f32(t177, 0.707106781f);
+    const float32x4_t t181 = vaddq_f32(t172, t178);
+    const float32x4_t t187 = vsubq_f32(t143, t181);
+    const float32x4_t t248 = vmulq_n_f32(t208, 0.382683432f);
+    const float32x4_t t250 = vmulq_n_f32(t209, 0.923879533f);
+    const float32x4_t t251 = vsubq_f32(t248, t250);
+    const float32x4_t t258 = vmulq_n_f32(t225, 0.923879533f);
+    const float32x4_t t260 = vmulq_n_f32(t226, 0.382683432f);
+    const float32x4_t t261 = vsubq_f32(t258, t260);
+    const float32x4_t t264 = vaddq_f32(t251, t261);
+    const float32x4_t t270 = vsubq_f32(t187, t264);
+    const float32x4_t t489 = vmulq_n_f32(t396, 0.195090322f);
+    const float32x4_t t491 = vmulq_n_f32(t397, 0.980785280f);
+    const float32x4_t t492 = vsubq_f32(t489, t491);
+    const float32x4_t t500 = vmulq_n_f32(t461, 0.555570233f);
+    const float32x4_t t502 = vmulq_n_f32(t462, 0.831469612f);
+    const float32x4_t t503 = vsubq_f32(t500, t502);
+    const float32x4_t t506 = vaddq_f32(t492, t503);
+    const float32x4_t t512 = vsubq_f32(t270, t506);
+    const float32x4_t t1151 = vmulq_n_f32(t858, 0.098017140f);
+    const float32x4_t t1153 = vmulq_n_f32(t859, 0.995184727f);
+    const float32x4_t t1154 = vsubq_f32(t1151, t1153);
+    const float32x4_t t1162 = vmulq_n_f32(t1063, 0.290284677f);
+    const float32x4_t t1164 = vmulq_n_f32(t1064, 0.956940336f);
+    const float32x4_t t1165 = vsubq_f32(t1162, t1164);
+    const float32x4_t t1168 = vaddq_f32(t1154, t1165);
+    const float32x4_t t1174 = vsubq_f32(t512, t1168);
+    const float32x4_t t139 = vsubq_f32(t129, t133);
+    const float32x4_t t157 = vsubq_f32(t147, t151);
+    const float32x4_t t163 = vaddq_f32(t139, t157);
+    const float32x4_t t205 = vsubq_f32(t195, t199);
+    const float32x4_t t206 = vsubq_f32(t196, t200);
+    const float32x4_t t278 = vaddq_f32(t205, t206);
+    const float32x4_t t279 = vmulq_n_f32(t278, 0.707106781f);
+    const float32x4_t t222 = vsubq_f32(t212, t216);
+    const float32x4_t t223 = vsubq_f32(t213, t217);
+    const float32x4_t t284 = vsubq_f32(t222, t223);
+    const float32x4_t t285 = vmulq_n_f32(t284, 0.707106781f);
+    const float32x4_t t290 = vsubq_f32(t279, t285);
+    const float32x4_t t296 = vaddq_f32(t163, t290);
+    const float32x4_t t350 = vsubq_f32(t340, t344);
+    const float32x4_t t368 = vsubq_f32(t358, t362);
+    const float32x4_t t374 = vaddq_f32(t350, t368);
+    const float32x4_t t520 = vmulq_n_f32(t374, 0.923879533f);
+    const float32x4_t t351 = vsubq_f32(t341, t345);
+    const float32x4_t t367 = vsubq_f32(t357, t361);
+    const float32x4_t t375 = vsubq_f32(t351, t367);
+    const float32x4_t t521 = vmulq_n_f32(t375, 0.382683432f);
+    const float32x4_t t523 = vaddq_f32(t520, t521);
+    const float32x4_t t415 = vsubq_f32(t405, t409);
+    const float32x4_t t433 = vsubq_f32(t423, t427);
+    const float32x4_t t439 = vaddq_f32(t415, t433);
+    const float32x4_t t529 = vmulq_n_f32(t439, 0.382683432f);
+    const float32x4_t t416 = vsubq_f32(t406, t410);
+    const float32x4_t t432 = vsubq_f32(t422, t426);
+    const float32x4_t t440 = vsubq_f32(t416, t432);
+    const float32x4_t t530 = vmulq_n_f32(t440, 0.923879533f);
+    const float32x4_t t532 = vaddq_f32(t529, t530);
+    const float32x4_t t538 = vaddq_f32(t523, t532);
+    const float32x4_t t544 = vaddq_f32(t296, t538);
+    const float32x4_t t732 = vsubq_f32(t722, t726);
+    const float32x4_t t750 = vsubq_f32(t740, t744);
+    const float32x4_t t756 = vaddq_f32(t732, t750);
+    const float32x4_t t797 = vsubq_f32(t787, t791);
+    const float32x4_t t798 = vsubq_f32(t788, t792);
+    const float32x4_t t867 = vaddq_f32(t797, t798);
+    const float32x4_t t868 = vmulq_n_f32(t867, 0.707106781f);
+    const float32x4_t t814 = vsubq_f32(t804, t808);
+    const float32x4_t t815 = vsubq_f32(t805, t809);
+    const float32x4_t t873 = vsubq_f32(t814, t815);
+    const float32x4_t t874 = vmulq_n_f32(t873, 0.707106781f);
+    const float32x4_t t879 = vsubq_f32(t868, t874);
+    const float32x4_t t885 = vaddq_f32(t756, t879);
+    const float32x4_t t1182 = vmulq_n_f32(t885, 0.980785280f);
+    const float32x4_t t733 = vsubq_f32(t723, t727);
+    const float32x4_t t749 = vsubq_f32(t739, t743);
+    const float32x4_t t757 = vsubq_f32(t733, t749);
+    const float32x4_t t869 = vsubq_f32(t797, t798);
+    const float32x4_t t871 = vmulq_n_f32(t869, 0.707106781f);
+    const float32x4_t t876 = vaddq_f32(t814, t815);
+    const float32x4_t t877 = vmulq_n_f32(t876, 0.707106781f);
+    const float32x4_t t880 = vaddq_f32(t871, t877);
+    const float32x4_t t886 = vsubq_f32(t757, t880);
+    const float32x4_t t1183 = vmulq_n_f32(t886, 0.195090322f);
+    const float32x4_t t1185 = vaddq_f32(t1182, t1183);
+    const float32x4_t t937 = vsubq_f32(t927, t931);
+    const float32x4_t t955 = vsubq_f32(t945, t949);
+    const float32x4_t t961 = vaddq_f32(t937, t955);
+    const float32x4_t t1002 = vsubq_f32(t992, t996);
+    const float32x4_t t1003 = vsubq_f32(t993, t997);
+    const float32x4_t t1072 = vaddq_f32(t1002, t1003);
+    const float32x4_t t1073 = vmulq_n_f32(t1072, 0.707106781f);
+    const float32x4_t t1019 = vsubq_f32(t1009, t1013);
+    const float32x4_t t1020 = vsubq_f32(t1010, t1014);
+    const float32x4_t t1078 = vsubq_f32(t1019, t1020);
+    const float32x4_t t1079 = vmulq_n_f32(t1078, 0.707106781f);
+    const float32x4_t t1084 = vsubq_f32(t1073, t1079);
+    const float32x4_t t1090 = vaddq_f32(t961, t1084);
+    const float32x4_t t1191 = vmulq_n_f32(t1090, 0.831469612f);
+    const float32x4_t t938 = vsubq_f32(t928, t932);
+    const float32x4_t t954 = vsubq_f32(t944, t948);
+    const float32x4_t t962 = vsubq_f32(t938, t954);
+    const float32x4_t t1074 = vsubq_f32(t1002, t1003);
+    const float32x4_t t1076 = vmulq_n_f32(t1074, 0.707106781f);
+    const float32x4_t t1081 = vaddq_f32(t1019, t1020);
+    const float32x4_t t1082 = vmulq_n_f32(t1081, 0.707106781f);
+    const float32x4_t t1085 = vaddq_f32(t1076, t1082);
+    const float32x4_t t1091 = vsubq_f32(t962, t1085);
+    const float32x4_t t1192 = vmulq_n_f32(t1091, 0.555570233f);
+    const float32x4_t t1194 = vaddq_f32(t1191, t1192);
+    const float32x4_t t1200 = vaddq_f32(t1185, t1194);
+    const float32x4_t t1206 = vaddq_f32(t544, t1200);
+    const float32x4_t t140 = vsubq_f32(t130, t134);
+    const float32x4_t t156 = vsubq_f32(t146, t150);
+    const float32x4_t t164 = vsubq_f32(t140, t156);
+    const float32x4_t t280 = vsubq_f32(t205, t206);
+    const float32x4_t t282 = vmulq_n_f32(t280, 0.707106781f);
+    const float32x4_t t287 = vaddq_f32(t222, t223);
+    const float32x4_t t288 = vmulq_n_f32(t287, 0.707106781f);
+    const float32x4_t t291 = vaddq_f32(t282, t288);
+    const float32x4_t t297 = vsubq_f32(t164, t291);
+    const float32x4_t t524 = vmulq_n_f32(t374, 0.382683432f);
+    const float32x4_t t526 = vmulq_n_f32(t375, 0.923879533f);
+    const float32x4_t t527 = vsubq_f32(t524, t526);
+    const float32x4_t t533 = vmulq_n_f32(t439, 0.923879533f);
+    const float32x4_t t535 = vmulq_n_f32(t440, 0.382683432f);
+    const float32x4_t t536 = vsubq_f32(t533, t535);
+    const float32x4_t t539 = vaddq_f32(t527, t536);
+    const float32x4_t t545 = vsubq_f32(t297, t539);
+    const float32x4_t t1186 = vmulq_n_f32(t885, 0.195090322f);
+    const float32x4_t t1188 = vmulq_n_f32(t886, 0.980785280f);
+    const float32x4_t t1189 = vsubq_f32(t1186, t1188);
+    const float32x4_t t1195 = vmulq_n_f32(t1090, 0.555570233f);
+    const float32x4_t t1197 = vmulq_n_f32(t1091, 0.831469612f);
+    const float32x4_t t1198 = vsubq_f32(t1195, t1197);
+    const float32x4_t t1201 = vaddq_f32(t1189, t1198);
+    const float32x4_t t1207 = vsubq_f32(t545, t1201);
+    const float32x4_t t144 = vsubq_f32(t131, t136);
+    const float32x4_t t184 = vsubq_f32(t172, t178);
+    const float32x4_t t191 = vsubq_f32(t144, t184);
+    const float32x4_t t210 = vsubq_f32(t197, t202);
+    const float32x4_t t305 = vmulq_n_f32(t210, 0.382683432f);
+    const float32x4_t t211 = vaddq_f32(t198, t201);
+    const float32x4_t t306 = vmulq_n_f32(t211, 0.923879533f);
+    const float32x4_t t308 = vaddq_f32(t305, t306);
+    const float32x4_t t227 = vsubq_f32(t214, t219);
+    const float32x4_t t315 = vmulq_n_f32(t227, 0.923879533f);
+    const float32x4_t t228 = vaddq_f32(t215, t218);
+    const float32x4_t t318 = vmulq_n_f32(t228, 0.382683432f);
+    const float32x4_t t319 = vaddq_f32(t315, t318);
+    const float32x4_t t325 = vsubq_f32(t308, t319);
+    const float32x4_t t331 = vaddq_f32(t191, t325);
+    const float32x4_t t355 = vsubq_f32(t342, t347);
+    const float32x4_t t394 = vsubq_f32(t382, t388);
+    const float32x4_t t401 = vsubq_f32(t355, t394);
+    const float32x4_t t553 = vmulq_n_f32(t401, 0.831469612f);
+    const float32x4_t t356 = vaddq_f32(t343, t346);
+    const float32x4_t t393 = vaddq_f32(t379, t385);
+    const float32x4_t t402 = vsubq_f32(t356, t393);
+    const float32x4_t t554 = vmulq_n_f32(t402, 0.555570233f);
+    const float32x4_t t556 = vaddq_f32(t553, t554);
+    const float32x4_t t420 = vsubq_f32(t407, t412);
+    const float32x4_t t459 = vsubq_f32(t447, t453);
+    const float32x4_t t466 = vsubq_f32(t420, t459);
+    const float32x4_t t563 = vmulq_n_f32(t466, 0.195090322f);
+    const float32x4_t t421 = vaddq_f32(t408, t411);
+    const float32x4_t t458 = vaddq_f32(t444, t450);
+    const float32x4_t t467 = vsubq_f32(t421, t458);
+    const float32x4_t t565 = vmulq_n_f32(t467, 0.980785280f);
+    const float32x4_t t567 = vsubq_f32(t563, t565);
+    const float32x4_t t575 = vsubq_f32(t556, t567);
+    const float32x4_t t581 = vaddq_f32(t331, t575);
+    const float32x4_t t737 = vsubq_f32(t724, t729);
+    const float32x4_t t776 = vsubq_f32(t764, t770);
+    const float32x4_t t783 = vsubq_f32(t737, t776);
+    const float32x4_t t802 = vsubq_f32(t789, t794);
+    const float32x4_t t894 = vmulq_n_f32(t802, 0.382683432f);
+    const float32x4_t t803 = vaddq_f32(t790, t793);
+    const float32x4_t t895 = vmulq_n_f32(t803, 0.923879533f);
+    const float32x4_t t897 = vaddq_f32(t894, t895);
+    const float32x4_t t819 = vsubq_f32(t806, t811);
+    const float32x4_t t903 = vmulq_n_f32(t819, 0.923879533f);
+    const float32x4_t t820 = vaddq_f32(t807, t810);
+    const float32x4_t t905 = vmulq_n_f32(t820, 0.382683432f);
+    const float32x4_t t906 = vaddq_f32(t903, t905);
+    const float32x4_t t912 = vsubq_f32(t897, t906);
+    const float32x4_t t918 = vaddq_f32(t783, t912);
+    const float32x4_t t1215 = vmulq_n_f32(t918, 0.956940336f);
+    const float32x4_t t738 = vaddq_f32(t725, t728);
+    const float32x4_t t775 = vaddq_f32(t761, t767);
+    const float32x4_t t784 = vsubq_f32(t738, t775);
+    const float32x4_t t898 = vmulq_n_f32(t802, 0.923879533f);
+    const float32x4_t t900 = vmulq_n_f32(t803, 0.382683432f);
+    const float32x4_t t901 = vsubq_f32(t898, t900);
+    const float32x4_t t908 = vmulq_n_f32(t819, 0.382683432f);
+    const float32x4_t t909 = vmulq_n_f32(t820, 0.923879533f);
+    const float32x4_t t911 = vsubq_f32(t908, t909);
+    const float32x4_t t913 = vsubq_f32(t901, t911);
+    const float32x4_t t919 = vsubq_f32(t784, t913);
+    const float32x4_t t1216 = vmulq_n_f32(t919, 0.290284677f);
+    const float32x4_t t1218 = vaddq_f32(t1215, t1216);
+    const float32x4_t t942 = vsubq_f32(t929, t934);
+    const float32x4_t t981 = vsubq_f32(t969, t975);
+    const float32x4_t t988 = vsubq_f32(t942, t981);
+    const float32x4_t t1007 = vsubq_f32(t994, t999);
+    const float32x4_t t1099 = vmulq_n_f32(t1007, 0.382683432f);
+    const float32x4_t t1008 = vaddq_f32(t995, t998);
+    const float32x4_t t1100 = vmulq_n_f32(t1008, 0.923879533f);
+    const float32x4_t t1102 = vaddq_f32(t1099, t1100);
+    const float32x4_t t1024 = vsubq_f32(t1011, t1016);
+    const float32x4_t t1108 = vmulq_n_f32(t1024, 0.923879533f);
+    const float32x4_t t1025 = vaddq_f32(t1012, t1015);
+    const float32x4_t t1110 = vmulq_n_f32(t1025, 0.382683432f);
+    const float32x4_t t1111 = vaddq_f32(t1108, t1110);
+    const float32x4_t t1117 = vsubq_f32(t1102, t1111);
+    const float32x4_t t1123 = vaddq_f32(t988, t1117);
+    const float32x4_t t1225 = vmulq_n_f32(t1123, 0.634393284f);
+    const float32x4_t t943 = vaddq_f32(t930, t933);
+    const float32x4_t t980 = vaddq_f32(t966, t972);
+    const float32x4_t t989 = vsubq_f32(t943, t980);
+    const float32x4_t t1103 = vmulq_n_f32(t1007, 0.923879533f);
+    const float32x4_t t1105 = vmulq_n_f32(t1008, 0.382683432f);
+    const float32x4_t t1106 = vsubq_f32(t1103, t1105);
+    const float32x4_t t1113 = vmulq_n_f32(t1024, 0.382683432f);
+    const float32x4_t t1114 = vmulq_n_f32(t1025, 0.923879533f);
+    const float32x4_t t1116 = vsubq_f32(t1113, t1114);
+    const float32x4_t t1118 = vsubq_f32(t1106, t1116);
+    const float32x4_t t1124 = vsubq_f32(t989, t1118);
+    const float32x4_t t1227 = vmulq_n_f32(t1124, 0.773010453f);
+    const float32x4_t t1229 = vaddq_f32(t1225, t1227);
+    const float32x4_t t1235 = vaddq_f32(t1218, t1229);
+    const float32x4_t t1241 = vaddq_f32(t581, t1235);
+    const float32x4_t t145 = vaddq_f32(t132, t135);
+    const float32x4_t t183 = vaddq_f32(t169, t175);
+    const float32x4_t t192 = vsubq_f32(t145, t183);
+    const float32x4_t t309 = vmulq_n_f32(t210, 0.923879533f);
+    const float32x4_t t311 = vmulq_n_f32(t211, 0.382683432f);
+    const float32x4_t t312 = vsubq_f32(t309, t311);
+    const float32x4_t t321 = vmulq_n_f32(t227, 0.382683432f);
+    const float32x4_t t322 = vmulq_n_f32(t228, 0.923879533f);
+    const float32x4_t t324 = vsubq_f32(t321, t322);
+    const float32x4_t t326 = vsubq_f32(t312, t324);
+    const float32x4_t t332 = vsubq_f32(t192, t326);
+    const float32x4_t t557 = vmulq_n_f32(t401, 0.555570233f);
+    const float32x4_t t559 = vmulq_n_f32(t402, 0.831469612f);
+    const float32x4_t t560 = vsubq_f32(t557, t559);
+    const float32x4_t t569 = vmulq_n_f32(t466, 0.980785280f);
+    const float32x4_t t571 = vmulq_n_f32(t467, 0.195090322f);
+    const float32x4_t t573 = vaddq_f32(t569, t571);
+    const float32x4_t t576 = vaddq_f32(t560, t573);
+    const float32x4_t t582 = vsubq_f32(t332, t576);
+    const float32x4_t t1219 = vmulq_n_f32(t918, 0.290284677f);
+    const float32x4_t t1221 = vmulq_n_f32(t919, 0.956940336f);
+    const float32x4_t t1222 = vsubq_f32(t1219, t1221);
+    const float32x4_t t1230 = vmulq_n_f32(t1123, 0.773010453f);
+    const float32x4_t t1232 = vmulq_n_f32(t1124, 0.634393284f);
+    const float32x4_t t1233 = vsubq_f32(t1230, t1232);
+    const float32x4_t t1236 = vaddq_f32(t1222, t1233);
+    const float32x4_t t1242 = vsubq_f32(t582, t1236);
+    const float32x4_t t160 = vsubq_f32(t137, t154);
+    const float32x4_t t232 = vsubq_f32(t204, t221);
+    const float32x4_t t238 = vaddq_f32(t160, t232);
+    const float32x4_t t371 = vsubq_f32(t348, t365);
+    const float32x4_t t372 = vsubq_f32(t349, t366);
+    const float32x4_t t590 = vaddq_f32(t371, t372);
+    const float32x4_t t591 = vmulq_n_f32(t590, 0.707106781f);
+    const float32x4_t t436 = vsubq_f32(t413, t430);
+    const float32x4_t t437 = vsubq_f32(t414, t431);
+    const float32x4_t t596 = vsubq_f32(t436, t437);
+    const float32x4_t t597 = vmulq_n_f32(t596, 0.707106781f);
+    const float32x4_t t602 = vsubq_f32(t591, t597);
+    const float32x4_t t608 = vaddq_f32(t238, t602);
+    const float32x4_t t753 = vsubq_f32(t730, t747);
+    const float32x4_t t824 = vsubq_f32(t796, t813);
+    const float32x4_t t830 = vaddq_f32(t753, t824);
+    const float32x4_t t1250 = vmulq_n_f32(t830, 0.923879533f);
+    const float32x4_t t754 = vsubq_f32(t731, t748);
+    const float32x4_t t823 = vsubq_f32(t795, t812);
+    const float32x4_t t831 = vsubq_f32(t754, t823);
+    const float32x4_t t1251 = vmulq_n_f32(t831, 0.382683432f);
+    const float32x4_t t1253 = vaddq_f32(t1250, t1251);
+    const float32x4_t t958 = vsubq_f32(t935, t952);
+    const float32x4_t t1029 = vsubq_f32(t1001, t1018);
+    const float32x4_t t1035 = vaddq_f32(t958, t1029);
+    const float32x4_t t1259 = vmulq_n_f32(t1035, 0.382683432f);
+    const float32x4_t t959 = vsubq_f32(t936, t953);
+    const float32x4_t t1028 = vsubq_f32(t1000, t1017);
+    const float32x4_t t1036 = vsubq_f32(t959, t1028);
+    const float32x4_t t1260 = vmulq_n_f32(t1036, 0.923879533f);
+    const float32x4_t t1262 = vaddq_f32(t1259, t1260);
+    const float32x4_t t1268 = vaddq_f32(t1253, t1262);
+    const float32x4_t t1274 = vaddq_f32(t608, t1268);
+    const float32x4_t t161 = vsubq_f32(t138, t155);
+    const float32x4_t t231 = vsubq_f32(t203, t220);
+    const float32x4_t t239 = vsubq_f32(t161, t231);
+    const float32x4_t t592 = vsubq_f32(t371, t372);
+    const float32x4_t t594 = vmulq_n_f32(t592, 0.707106781f);
+    const float32x4_t t599 = vaddq_f32(t436, t437);
+    const float32x4_t t600 = vmulq_n_f32(t599, 0.707106781f);
+    const float32x4_t t603 = vaddq_f32(t594, t600);
+    const float32x4_t t609 = vsubq_f32(t239, t603);
+    const float32x4_t t1254 = vmulq_n_f32(t830, 0.382683432f);
+    const float32x4_t t1256 = vmulq_n_f32(t831, 0.923879533f);
+    const float32x4_t t1257 = vsubq_f32(t1254, t1256);
+    const float32x4_t t1263 = vmulq_n_f32(t1035, 0.923879533f);
+    const float32x4_t t1265 = vmulq_n_f32(t1036, 0.382683432f);
+    const float32x4_t t1266 = vsubq_f32(t1263, t1265);
+    const float32x4_t t1269 = vaddq_f32(t1257, t1266);
+    const float32x4_t t1275 = vsubq_f32(t609, t1269);
+    const float32x4_t t188 = vsubq_f32(t142, t180);
+    const float32x4_t t267 = vsubq_f32(t251, t261);
+    const float32x4_t t274 = vsubq_f32(t188, t267);
+    const float32x4_t t398 = vsubq_f32(t353, t390);
+    const float32x4_t t618 = vmulq_n_f32(t398, 0.555570233f);
+    const float32x4_t t399 = vaddq_f32(t354, t391);
+    const float32x4_t t619 = vmulq_n_f32(t399, 0.831469612f);
+    const float32x4_t t621 = vaddq_f32(t618, t619);
+    const float32x4_t t463 = vsubq_f32(t418, t455);
+    const float32x4_t t627 = vmulq_n_f32(t463, 0.980785280f);
+    const float32x4_t t464 = vaddq_f32(t419, t456);
+    const float32x4_t t630 = vmulq_n_f32(t464, 0.195090322f);
+    const float32x4_t t632 = vsubq_f32(t627, t630);
+    const float32x4_t t640 = vsubq_f32(t621, t632);
+    const float32x4_t t646 = vaddq_f32(t274, t640);
+    const float32x4_t t780 = vsubq_f32(t735, t772);
+    const float32x4_t t856 = vsubq_f32(t841, t850);
+    const float32x4_t t863 = vsubq_f32(t780, t856);
+    const float32x4_t t1284 = vmulq_n_f32(t863, 0.881921264f);
+    const float32x4_t t781 = vaddq_f32(t736, t773);
+    const float32x4_t t855 = vsubq_f32(t837, t846);
+    const float32x4_t t864 = vsubq_f32(t781, t855);
+    const float32x4_t t1286 = vmulq_n_f32(t864, 0.471396737f);
+    const float32x4_t t1288 = vaddq_f32(t1284, t1286);
+    const float32x4_t t985 = vsubq_f32(t940, t977);
+    const float32x4_t t1061 = vsubq_f32(t1046, t1055);
+    const float32x4_t t1068 = vsubq_f32(t985, t1061);
+    const float32x4_t t1295 = vmulq_n_f32(t1068, 0.098017140f);
+    const float32x4_t t986 = vaddq_f32(t941, t978);
+    const float32x4_t t1060 = vsubq_f32(t1042, t1051);
+    const float32x4_t t1069 = vsubq_f32(t986, t1060);
+    const float32x4_t t1297 = vmulq_n_f32(t1069, 0.995184727f);
+    const float32x4_t t1299 = vaddq_f32(t1295, t1297);
+    const float32x4_t t1305 = vaddq_f32(t1288, t1299);
+    const float32x4_t t1311 = vaddq_f32(t646, t1305);
+    const float32x4_t t189 = vaddq_f32(t143, t181);
+    const float32x4_t t266 = vsubq_f32(t247, t257);
+    const float32x4_t t275 = vsubq_f32(t189, t266);
+    const float32x4_t t622 = vmulq_n_f32(t398, 0.831469612f);
+    const float32x4_t t624 = vmulq_n_f32(t399, 0.555570233f);
+    const float32x4_t t625 = vsubq_f32(t622, t624);
+    const float32x4_t t634 = vmulq_n_f32(t463, 0.195090322f);
+    const float32x4_t t636 = vmulq_n_f32(t464, 0.980785280f);
+    const float32x4_t t638 = vaddq_f32(t634, t636);
+    const float32x4_t t641 = vaddq_f32(t625, t638);
+    const float32x4_t t647 = vsubq_f32(t275, t641);
+    const float32x4_t t1289 = vmulq_n_f32(t863, 0.471396737f);
+    const float32x4_t t1291 = vmulq_n_f32(t864, 0.881921264f);
+    const float32x4_t t1292 = vsubq_f32(t1289, t1291);
+    const float32x4_t t1300 = vmulq_n_f32(t1068, 0.995184727f);
+    const float32x4_t t1302 = vmulq_n_f32(t1069, 0.098017140f);
+    const float32x4_t t1303 = vsubq_f32(t1300, t1302);
+    const float32x4_t t1306 = vaddq_f32(t1292, t1303);
+    const float32x4_t t1312 = vsubq_f32(t647, t1306);
+    const float32x4_t t165 = vsubq_f32(t139, t157);
+    const float32x4_t t294 = vsubq_f32(t282, t288);
+    const float32x4_t t301 = vsubq_f32(t165, t294);
+    const float32x4_t t376 = vsubq_f32(t350, t368);
+    const float32x4_t t655 = vmulq_n_f32(t376, 0.382683432f);
+    const float32x4_t t377 = vaddq_f32(t351, t367);
+    const float32x4_t t656 = vmulq_n_f32(t377, 0.923879533f);
+    const float32x4_t t658 = vaddq_f32(t655, t656);
+    const float32x4_t t441 = vsubq_f32(t415, t433);
+    const float32x4_t t664 = vmulq_n_f32(t441, 0.923879533f);
+    const float32x4_t t442 = vaddq_f32(t416, t432);
+    const float32x4_t t666 = vmulq_n_f32(t442, 0.382683432f);
+    const float32x4_t t667 = vaddq_f32(t664, t666);
+    const float32x4_t t673 = vsubq_f32(t658, t667);
+    const float32x4_t t679 = vaddq_f32(t301, t673);
+    const float32x4_t t758 = vsubq_f32(t732, t750);
+    const float32x4_t t883 = vsubq_f32(t871, t877);
+    const float32x4_t t890 = vsubq_f32(t758, t883);
+    const float32x4_t t1320 = vmulq_n_f32(t890, 0.831469612f);
+    const float32x4_t t759 = vaddq_f32(t733, t749);
+    const float32x4_t t882 = vaddq_f32(t868, t874);
+    const float32x4_t t891 = vsubq_f32(t759, t882);
+    const float32x4_t t1321 = vmulq_n_f32(t891, 0.555570233f);
+    const float32x4_t t1323 = vaddq_f32(t1320, t1321);
+    const float32x4_t t963 = vsubq_f32(t937, t955);
+    const float32x4_t t1088 = vsubq_f32(t1076, t1082);
+    const float32x4_t t1095 = vsubq_f32(t963, t1088);
+    const float32x4_t t1329 = vmulq_n_f32(t1095, 0.195090322f);
+    const float32x4_t t964 = vaddq_f32(t938, t954);
+    const float32x4_t t1087 = vaddq_f32(t1073, t1079);
+    const float32x4_t t1096 = vsubq_f32(t964, t1087);
+    const float32x4_t t1331 = vmulq_n_f32(t1096, 0.980785280f);
+    const float32x4_t t1333 = vsubq_f32(t1329, t1331);
+    const float32x4_t t1341 = vsubq_f32(t1323, t1333);
+    const float32x4_t t1347 = vaddq_f32(t679, t1341);
+    const float32x4_t t166 = vaddq_f32(t140, t156);
+    const float32x4_t t293 = vaddq_f32(t279, t285);
+    const float32x4_t t302 = vsubq_f32(t166, t293);
+    const float32x4_t t659 = vmulq_n_f32(t376, 0.923879533f);
+    const float32x4_t t661 = vmulq_n_f32(t377, 0.382683432f);
+    const float32x4_t t662 = vsubq_f32(t659, t661);
+    const float32x4_t t669 = vmulq_n_f32(t441, 0.382683432f);
+    const float32x4_t t670 = vmulq_n_f32(t442, 0.923879533f);
+    const float32x4_t t672 = vsubq_f32(t669, t670);
+    const float32x4_t t674 = vsubq_f32(t662, t672);
+    const float32x4_t t680 = vsubq_f32(t302, t674);
+    const float32x4_t t1324 = vmulq_n_f32(t890, 0.555570233f);
+    const float32x4_t t1326 = vmulq_n_f32(t891, 0.831469612f);
+    const float32x4_t t1327 = vsubq_f32(t1324, t1326);
+    const float32x4_t t1335 = vmulq_n_f32(t1095, 0.980785280f);
+    const float32x4_t t1337 = vmulq_n_f32(t1096, 0.195090322f);
+    const float32x4_t t1339 = vaddq_f32(t1335, t1337);
+    const float32x4_t t1342 = vaddq_f32(t1327, t1339);
+    const float32x4_t t1348 = vsubq_f32(t680, t1342);
+    const float32x4_t t193 = vaddq_f32(t144, t184);
+    const float32x4_t t329 = vaddq_f32(t312, t324);
+    const float32x4_t t336 = vsubq_f32(t193, t329);
+    const float32x4_t t403 = vaddq_f32(t355, t394);
+    const float32x4_t t689 = vmulq_n_f32(t403, 0.195090322f);
+    const float32x4_t t404 = vaddq_f32(t356, t393);
+    const float32x4_t t690 = vmulq_n_f32(t404, 0.980785280f);
+    const float32x4_t t692 = vaddq_f32(t689, t690);
+    const float32x4_t t468 = vaddq_f32(t420, t459);
+    const float32x4_t t698 = vmulq_n_f32(t468, 0.555570233f);
+    const float32x4_t t469 = vaddq_f32(t421, t458);
+    const float32x4_t t700 = vmulq_n_f32(t469, 0.831469612f);
+    const float32x4_t t701 = vaddq_f32(t698, t700);
+    const float32x4_t t707 = vsubq_f32(t692, t701);
+    const float32x4_t t713 = vaddq_f32(t336, t707);
+    const float32x4_t t785 = vaddq_f32(t737, t776);
+    const float32x4_t t916 = vaddq_f32(t901, t911);
+    const float32x4_t t923 = vsubq_f32(t785, t916);
+    const float32x4_t t1356 = vmulq_n_f32(t923, 0.773010453f);
+    const float32x4_t t786 = vaddq_f32(t738, t775);
+    const float32x4_t t915 = vaddq_f32(t897, t906);
+    const float32x4_t t924 = vsubq_f32(t786, t915);
+    const float32x4_t t1357 = vmulq_n_f32(t924, 0.634393284f);
+    const float32x4_t t1359 = vaddq_f32(t1356, t1357);
+    const float32x4_t t990 = vaddq_f32(t942, t981);
+    const float32x4_t t1121 = vaddq_f32(t1106, t1116);
+    const float32x4_t t1128 = vsubq_f32(t990, t1121);
+    const float32x4_t t1366 = vmulq_n_f32(t1128, 0.471396737f);
+    const float32x4_t t991 = vaddq_f32(t943, t980);
+    const float32x4_t t1120 = vaddq_f32(t1102, t1111);
+    const float32x4_t t1129 = vsubq_f32(t991, t1120);
+    const float32x4_t t1368 = vmulq_n_f32(t1129, 0.881921264f);
+    const float32x4_t t1370 = vsubq_f32(t1366, t1368);
+    const float32x4_t t1378 = vsubq_f32(t1359, t1370);
+    const float32x4_t t1384 = vaddq_f32(t713, t1378);
+    const float32x4_t t194 = vaddq_f32(t145, t183);
+    const float32x4_t t328 = vaddq_f32(t308, t319);
+    const float32x4_t t337 = vsubq_f32(t194, t328);
+    const float32x4_t t693 = vmulq_n_f32(t403, 0.980785280f);
+    const float32x4_t t695 = vmulq_n_f32(t404, 0.195090322f);
+    const float32x4_t t696 = vsubq_f32(t693, t695);
+    const float32x4_t t703 = vmulq_n_f32(t468, 0.831469612f);
+    const float32x4_t t704 = vmulq_n_f32(t469, 0.555570233f);
+    const float32x4_t t706 = vsubq_f32(t703, t704);
+    const float32x4_t t708 = vsubq_f32(t696, t706);
+    const float32x4_t t714 = vsubq_f32(t337, t708);
+    const float32x4_t t1360 = vmulq_n_f32(t923, 0.634393284f);
+    const float32x4_t t1362 = vmulq_n_f32(t924, 0.773010453f);
+    const float32x4_t t1363 = vsubq_f32(t1360, t1362);
+    const float32x4_t t1372 = vmulq_n_f32(t1128, 0.881921264f);
+    const float32x4_t t1374 = vmulq_n_f32(t1129, 0.471396737f);
+    const float32x4_t t1376 = vaddq_f32(t1372, t1374);
+    const float32x4_t t1379 = vaddq_f32(t1363, t1376);
+    const float32x4_t t1385 = vsubq_f32(t714, t1379);
+    const float32x4_t t235 = vsubq_f32(t158, t229);
+    const float32x4_t t473 = vsubq_f32(t370, t435);
+    const float32x4_t t479 = vaddq_f32(t235, t473);
+    const float32x4_t t827 = vsubq_f32(t751, t821);
+    const float32x4_t t828 = vsubq_f32(t752, t822);
+    const float32x4_t t1393 = vaddq_f32(t827, t828);
+    const float32x4_t t1394 = vmulq_n_f32(t1393, 0.707106781f);
+    const float32x4_t t1032 = vsubq_f32(t956, t1026);
+    const float32x4_t t1033 = vsubq_f32(t957, t1027);
+    const float32x4_t t1399 = vsubq_f32(t1032, t1033);
+    const float32x4_t t1400 = vmulq_n_f32(t1399, 0.707106781f);
+    const float32x4_t t1405 = vsubq_f32(t1394, t1400);
+    const float32x4_t t1411 = vaddq_f32(t479, t1405);
+    const float32x4_t t236 = vsubq_f32(t159, t230);
+    const float32x4_t t472 = vsubq_f32(t369, t434);
+    const float32x4_t t480 = vsubq_f32(t236, t472);
+    const float32x4_t t1395 = vsubq_f32(t827, t828);
+    const float32x4_t t1397 = vmulq_n_f32(t1395, 0.707106781f);
+    const float32x4_t t1402 = vaddq_f32(t1032, t1033);
+    const float32x4_t t1403 = vmulq_n_f32(t1402, 0.707106781f);
+    const float32x4_t t1406 = vaddq_f32(t1397, t1403);
+    const float32x4_t t1412 = vsubq_f32(t480, t1406);
+    const float32x4_t t271 = vsubq_f32(t186, t263);
+    const float32x4_t t509 = vsubq_f32(t492, t503);
+    const float32x4_t t516 = vsubq_f32(t271, t509);
+    const float32x4_t t860 = vsubq_f32(t778, t852);
+    const float32x4_t t1420 = vmulq_n_f32(t860, 0.634393284f);
+    const float32x4_t t861 = vaddq_f32(t779, t853);
+    const float32x4_t t1421 = vmulq_n_f32(t861, 0.773010453f);
+    const float32x4_t t1423 = vaddq_f32(t1420, t1421);
+    const float32x4_t t1065 = vsubq_f32(t983, t1057);
+    const float32x4_t t1430 = vmulq_n_f32(t1065, 0.881921264f);
+    const float32x4_t t1066 = vaddq_f32(t984, t1058);
+    const float32x4_t t1433 = vmulq_n_f32(t1066, 0.471396737f);
+    const float32x4_t t1435 = vsubq_f32(t1430, t1433);
+    const float32x4_t t1443 = vsubq_f32(t1423, t1435);
+    const float32x4_t t1449 = vaddq_f32(t516, t1443);
+    const float32x4_t t272 = vaddq_f32(t187, t264);
+    const float32x4_t t508 = vsubq_f32(t488, t499);
+    const float32x4_t t517 = vsubq_f32(t272, t508);
+    const float32x4_t t1424 = vmulq_n_f32(t860, 0.773010453f);
+    const float32x4_t t1426 = vmulq_n_f32(t861, 0.634393284f);
+    const float32x4_t t1427 = vsubq_f32(t1424, t1426);
+    const float32x4_t t1437 = vmulq_n_f32(t1065, 0.471396737f);
+    const float32x4_t t1439 = vmulq_n_f32(t1066, 0.881921264f);
+    const float32x4_t t1441 = vaddq_f32(t1437, t1439);
+    const float32x4_t t1444 = vaddq_f32(t1427, t1441);
+    const float32x4_t t1450 = vsubq_f32(t517, t1444);
+    const float32x4_t t298 = vsubq_f32(t163, t290);
+    const float32x4_t t542 = vsubq_f32(t527, t536);
+    const float32x4_t t549 = vsubq_f32(t298, t542);
+    const float32x4_t t887 = vsubq_f32(t756, t879);
+    const float32x4_t t1458 = vmulq_n_f32(t887, 0.555570233f);
+    const float32x4_t t888 = vaddq_f32(t757, t880);
+    const float32x4_t t1459 = vmulq_n_f32(t888, 0.831469612f);
+    const float32x4_t t1461 = vaddq_f32(t1458, t1459);
+    const float32x4_t t1092 = vsubq_f32(t961, t1084);
+    const float32x4_t t1467 = vmulq_n_f32(t1092, 0.980785280f);
+    const float32x4_t t1093 = vaddq_f32(t962, t1085);
+    const float32x4_t t1469 = vmulq_n_f32(t1093, 0.195090322f);
+    const float32x4_t t1471 = vsubq_f32(t1467, t1469);
+    const float32x4_t t1479 = vsubq_f32(t1461, t1471);
+    const float32x4_t t1485 = vaddq_f32(t549, t1479);
+    const float32x4_t t299 = vaddq_f32(t164, t291);
+    const float32x4_t t541 = vsubq_f32(t523, t532);
+    const float32x4_t t550 = vsubq_f32(t299, t541);
+    const float32x4_t t1462 = vmulq_n_f32(t887, 0.831469612f);
+    const float32x4_t t1464 = vmulq_n_f32(t888, 0.555570233f);
+    const float32x4_t t1465 = vsubq_f32(t1462, t1464);
+    const float32x4_t t1473 = vmulq_n_f32(t1092, 0.195090322f);
+    const float32x4_t t1475 = vmulq_n_f32(t1093, 0.980785280f);
+    const float32x4_t t1477 = vaddq_f32(t1473, t1475);
+    const float32x4_t t1480 = vaddq_f32(t1465, t1477);
+    const float32x4_t t1486 = vsubq_f32(t550, t1480);
+    const float32x4_t t333 = vsubq_f32(t191, t325);
+    const float32x4_t t579 = vsubq_f32(t560, t573);
+    const float32x4_t t586 = vsubq_f32(t333, t579);
+    const float32x4_t t920 = vsubq_f32(t783, t912);
+    const float32x4_t t1495 = vmulq_n_f32(t920, 0.471396737f);
+    const float32x4_t t921 = vaddq_f32(t784, t913);
+    const float32x4_t t1496 = vmulq_n_f32(t921, 0.881921264f);
+    const float32x4_t t1498 = vaddq_f32(t1495, t1496);
+    const float32x4_t t1125 = vsubq_f32(t988, t1117);
+    const float32x4_t t1504 = vmulq_n_f32(t1125, 0.995184727f);
+    const float32x4_t t1126 = vaddq_f32(t989, t1118);
+    const float32x4_t t1507 = vmulq_n_f32(t1126, 0.098017140f);
+    const float32x4_t t1508 = vaddq_f32(t1504, t1507);
+    const float32x4_t t1514 = vsubq_f32(t1498, t1508);
+    const float32x4_t t1520 = vaddq_f32(t586, t1514);
+    const float32x4_t t334 = vaddq_f32(t192, t326);
+    const float32x4_t t578 = vaddq_f32(t556, t567);
+    const float32x4_t t587 = vsubq_f32(t334, t578);
+    const float32x4_t t1499 = vmulq_n_f32(t920, 0.881921264f);
+    const float32x4_t t1501 = vmulq_n_f32(t921, 0.471396737f);
+    const float32x4_t t1502 = vsubq_f32(t1499, t1501);
+    const float32x4_t t1510 = vmulq_n_f32(t1125, 0.098017140f);
+    const float32x4_t t1511 = vmulq_n_f32(t1126, 0.995184727f);
+    const float32x4_t t1513 = vsubq_f32(t1510, t1511);
+    const float32x4_t t1515 = vsubq_f32(t1502, t1513);
+    const float32x4_t t1521 = vsubq_f32(t587, t1515);
+    const float32x4_t t240 = vsubq_f32(t160, t232);
+    const float32x4_t t606 = vsubq_f32(t594, t600);
+    const float32x4_t t613 = vsubq_f32(t240, t606);
+    const float32x4_t t832 = vsubq_f32(t753, t824);
+    const float32x4_t t1529 = vmulq_n_f32(t832, 0.382683432f);
+    const float32x4_t t833 = vaddq_f32(t754, t823);
+    const float32x4_t t1530 = vmulq_n_f32(t833, 0.923879533f);
+    const float32x4_t t1532 = vaddq_f32(t1529, t1530);
+    const float32x4_t t1037 = vsubq_f32(t958, t1029);
+    const float32x4_t t1538 = vmulq_n_f32(t1037, 0.923879533f);
+    const float32x4_t t1038 = vaddq_f32(t959, t1028);
+    const float32x4_t t1540 = vmulq_n_f32(t1038, 0.382683432f);
+    const float32x4_t t1541 = vaddq_f32(t1538, t1540);
+    const float32x4_t t1547 = vsubq_f32(t1532, t1541);
+    const float32x4_t t1553 = vaddq_f32(t613, t1547);
+    const float32x4_t t241 = vaddq_f32(t161, t231);
+    const float32x4_t t605 = vaddq_f32(t591, t597);
+    const float32x4_t t614 = vsubq_f32(t241, t605);
+    const float32x4_t t1533 = vmulq_n_f32(t832, 0.923879533f);
+    const float32x4_t t1535 = vmulq_n_f32(t833, 0.382683432f);
+    const float32x4_t t1536 = vsubq_f32(t1533, t1535);
+    const float32x4_t t1543 = vmulq_n_f32(t1037, 0.382683432f);
+    const float32x4_t t1544 = vmulq_n_f32(t1038, 0.923879533f);
+    const float32x4_t t1546 = vsubq_f32(t1543, t1544);
+    const float32x4_t t1548 = vsubq_f32(t1536, t1546);
+    const float32x4_t t1554 = vsubq_f32(t614, t1548);
+    const float32x4_t t276 = vaddq_f32(t188, t267);
+    const float32x4_t t644 = vsubq_f32(t625, t638);
+    const float32x4_t t651 = vsubq_f32(t276, t644);
+    const float32x4_t t865 = vaddq_f32(t780, t856);
+    const float32x4_t t1562 = vmulq_n_f32(t865, 0.290284677f);
+    const float32x4_t t866 = vaddq_f32(t781, t855);
+    const float32x4_t t1564 = vmulq_n_f32(t866, 0.956940336f);
+    const float32x4_t t1566 = vaddq_f32(t1562, t1564);
+    const float32x4_t t1070 = vaddq_f32(t985, t1061);
+    const float32x4_t t1573 = vmulq_n_f32(t1070, 0.773010453f);
+    const float32x4_t t1071 = vaddq_f32(t986, t1060);
+    const float32x4_t t1576 = vmulq_n_f32(t1071, 0.634393284f);
+    const float32x4_t t1577 = vaddq_f32(t1573, t1576);
+    const float32x4_t t1583 = vsubq_f32(t1566, t1577);
+    const float32x4_t t1589 = vaddq_f32(t651, t1583);
+    const float32x4_t t277 = vaddq_f32(t189, t266);
+    const float32x4_t t643 = vaddq_f32(t621, t632);
+    const float32x4_t t652 = vsubq_f32(t277, t643);
+    const float32x4_t t1567 = vmulq_n_f32(t865, 0.956940336f);
+    const float32x4_t t1569 = vmulq_n_f32(t866, 0.290284677f);
+    const float32x4_t t1570 = vsubq_f32(t1567, t1569);
+    const float32x4_t t1579 = vmulq_n_f32(t1070, 0.634393284f);
+    const float32x4_t t1580 = vmulq_n_f32(t1071, 0.773010453f);
+    const float32x4_t t1582 = vsubq_f32(t1579, t1580);
+    const float32x4_t t1584 = vsubq_f32(t1570, t1582);
+    const float32x4_t t1590 = vsubq_f32(t652, t1584);
+    const float32x4_t t303 = vaddq_f32(t165, t294);
+    const float32x4_t t677 = vaddq_f32(t662, t672);
+    const float32x4_t t684 = vsubq_f32(t303, t677);
+    const float32x4_t t892 = vaddq_f32(t758, t883);
+    const float32x4_t t1598 = vmulq_n_f32(t892, 0.195090322f);
+    const float32x4_t t893 = vaddq_f32(t759, t882);
+    const float32x4_t t1599 = vmulq_n_f32(t893, 0.980785280f);
+    const float32x4_t t1601 = vaddq_f32(t1598, t1599);
+    const float32x4_t t1097 = vaddq_f32(t963, t1088);
+    const float32x4_t t1607 = vmulq_n_f32(t1097, 0.555570233f);
+    const float32x4_t t1098 = vaddq_f32(t964, t1087);
+    const float32x4_t t1609 = vmulq_n_f32(t1098, 0.831469612f);
+    const float32x4_t t1610 = vaddq_f32(t1607, t1609);
+    const float32x4_t t1616 = vsubq_f32(t1601, t1610);
+    const float32x4_t t1622 = vaddq_f32(t684, t1616);
+    const float32x4_t t304 = vaddq_f32(t166, t293);
+    const float32x4_t t676 = vaddq_f32(t658, t667);
+    const float32x4_t t685 = vsubq_f32(t304, t676);
+    const float32x4_t t1602 = vmulq_n_f32(t892, 0.980785280f);
+    const float32x4_t t1604 = vmulq_n_f32(t893, 0.195090322f);
+    const float32x4_t t1605 = vsubq_f32(t1602, t1604);
+    const float32x4_t t1612 = vmulq_n_f32(t1097, 0.831469612f);
+    const float32x4_t t1613 = vmulq_n_f32(t1098, 0.555570233f);
+    const float32x4_t t1615 = vsubq_f32(t1612, t1613);
+    const float32x4_t t1617 = vsubq_f32(t1605, t1615);
+    const float32x4_t t1623 = vsubq_f32(t685, t1617);
+    const float32x4_t t338 = vaddq_f32(t193, t329);
+    const float32x4_t t711 = vaddq_f32(t696, t706);
+    const float32x4_t t718 = vsubq_f32(t338, t711);
+    const float32x4_t t925 = vaddq_f32(t785, t916);
+    const float32x4_t t1631 = vmulq_n_f32(t925, 0.098017140f);
+    const float32x4_t t926 = vaddq_f32(t786, t915);
+    const float32x4_t t1632 = vmulq_n_f32(t926, 0.995184727f);
+    const float32x4_t t1634 = vaddq_f32(t1631, t1632);
+    const float32x4_t t1130 = vaddq_f32(t990, t1121);
+    const float32x4_t t1641 = vmulq_n_f32(t1130, 0.290284677f);
+    const float32x4_t t1131 = vaddq_f32(t991, t1120);
+    const float32x4_t t1643 = vmulq_n_f32(t1131, 0.956940336f);
+    const float32x4_t t1644 = vaddq_f32(t1641, t1643);
+    const float32x4_t t1650 = vsubq_f32(t1634, t1644);
+    const float32x4_t t1656 = vaddq_f32(t718, t1650);
+    const float32x4_t t339 = vaddq_f32(t194, t328);
+    const float32x4_t t710 = vaddq_f32(t692, t701);
+    const float32x4_t t719 = vsubq_f32(t339, t710);
+    const float32x4_t t1635 = vmulq_n_f32(t925, 0.995184727f);
+    const float32x4_t t1637 = vmulq_n_f32(t926, 0.098017140f);
+    const float32x4_t t1638 = vsubq_f32(t1635, t1637);
+    const float32x4_t t1646 = vmulq_n_f32(t1130, 0.956940336f);
+    const float32x4_t t1647 = vmulq_n_f32(t1131, 0.290284677f);
+    const float32x4_t t1649 = vsubq_f32(t1646, t1647);
+    const float32x4_t t1651 = vsubq_f32(t1638, t1649);
+    const float32x4_t t1657 = vsubq_f32(t719, t1651);
+    const float32x4_t t476 = vsubq_f32(t233, t470);
+    const float32x4_t t1135 = vsubq_f32(t826, t1031);
+    const float32x4_t t1141 = vaddq_f32(t476, t1135);
+    const float32x4_t t477 = vsubq_f32(t234, t471);
+    const float32x4_t t1134 = vsubq_f32(t825, t1030);
+    const float32x4_t t1142 = vsubq_f32(t477, t1134);
+    const float32x4_t t513 = vsubq_f32(t269, t505);
+    const float32x4_t t1171 = vsubq_f32(t1154, t1165);
+    const float32x4_t t1178 = vsubq_f32(t513, t1171);
+    const float32x4_t t514 = vaddq_f32(t270, t506);
+    const float32x4_t t1170 = vsubq_f32(t1150, t1161);
+    const float32x4_t t1179 = vsubq_f32(t514, t1170);
+    const float32x4_t t546 = vsubq_f32(t296, t538);
+    const float32x4_t t1204 = vsubq_f32(t1189, t1198);
+    const float32x4_t t1211 = vsubq_f32(t546, t1204);
+    const float32x4_t t547 = vaddq_f32(t297, t539);
+    const float32x4_t t1203 = vsubq_f32(t1185, t1194);
+    const float32x4_t t1212 = vsubq_f32(t547, t1203);
+    const float32x4_t t583 = vsubq_f32(t331, t575);
+    const float32x4_t t1239 = vsubq_f32(t1222, t1233);
+    const float32x4_t t1246 = vsubq_f32(t583, t1239);
+    const float32x4_t t584 = vaddq_f32(t332, t576);
+    const float32x4_t t1238 = vsubq_f32(t1218, t1229);
+    const float32x4_t t1247 = vsubq_f32(t584, t1238);
+    const float32x4_t t610 = vsubq_f32(t238, t602);
+    const float32x4_t t1272 = vsubq_f32(t1257, t1266);
+    const float32x4_t t1279 = vsubq_f32(t610, t1272);
+    const float32x4_t t611 = vaddq_f32(t239, t603);
+    const float32x4_t t1271 = vsubq_f32(t1253, t1262);
+    const float32x4_t t1280 = vsubq_f32(t611, t1271);
+    const float32x4_t t648 = vsubq_f32(t274, t640);
+    const float32x4_t t1309 = vsubq_f32(t1292, t1303);
+    const float32x4_t t1316 = vsubq_f32(t648, t1309);
+    const float32x4_t t649 = vaddq_f32(t275, t641);
+    const float32x4_t t1308 = vsubq_f32(t1288, t1299);
+    const float32x4_t t1317 = vsubq_f32(t649, t1308);
+    const float32x4_t t681 = vsubq_f32(t301, t673);
+    const float32x4_t t1345 = vsubq_f32(t1327, t1339);
+    const float32x4_t t1352 = vsubq_f32(t681, t1345);
+    const float32x4_t t682 = vaddq_f32(t302, t674);
+    const float32x4_t t1344 = vaddq_f32(t1323, t1333);
+    const float32x4_t t1353 = vsubq_f32(t682, t1344);
+    const float32x4_t t715 = vsubq_f32(t336, t707);
+    const float32x4_t t1382 = vsubq_f32(t1363, t1376);
+    const float32x4_t t1389 = vsubq_f32(t715, t1382);
+    const float32x4_t t716 = vaddq_f32(t337, t708);
+    const float32x4_t t1381 = vaddq_f32(t1359, t1370);
+    const float32x4_t t1390 = vsubq_f32(t716, t1381);
+    const float32x4_t t481 = vsubq_f32(t235, t473);
+    const float32x4_t t1409 = vsubq_f32(t1397, t1403);
+    const float32x4_t t1416 = vsubq_f32(t481, t1409);
+    const float32x4_t t482 = vaddq_f32(t236, t472);
+    const float32x4_t t1408 = vaddq_f32(t1394, t1400);
+    const float32x4_t t1417 = vsubq_f32(t482, t1408);
+    const float32x4_t t518 = vaddq_f32(t271, t509);
+    const float32x4_t t1447 = vsubq_f32(t1427, t1441);
+    const float32x4_t t1454 = vsubq_f32(t518, t1447);
+    const float32x4_t t519 = vaddq_f32(t272, t508);
+    const float32x4_t t1446 = vaddq_f32(t1423, t1435);
+    const float32x4_t t1455 = vsubq_f32(t519, t1446);
+    const float32x4_t t551 = vaddq_f32(t298, t542);
+    const float32x4_t t1483 = vsubq_f32(t1465, t1477);
+    const float32x4_t t1490 = vsubq_f32(t551, t1483);
+    const float32x4_t t552 = vaddq_f32(t299, t541);
+    const float32x4_t t1482 = vaddq_f32(t1461, t1471);
+    const float32x4_t t1491 = vsubq_f32(t552, t1482);
+    const float32x4_t t588 = vaddq_f32(t333, t579);
+    const float32x4_t t1518 = vaddq_f32(t1502, t1513);
+    const float32x4_t t1525 = vsubq_f32(t588, t1518);
+    const float32x4_t t589 = vaddq_f32(t334, t578);
+    const float32x4_t t1517 = vaddq_f32(t1498, t1508);
+    const float32x4_t t1526 = vsubq_f32(t589, t1517);
+    const float32x4_t t615 = vaddq_f32(t240, t606);
+    const float32x4_t t1551 = vaddq_f32(t1536, t1546);
+    const float32x4_t t1558 = vsubq_f32(t615, t1551);
+    const float32x4_t t616 = vaddq_f32(t241, t605);
+    const float32x4_t t1550 = vaddq_f32(t1532, t1541);
+    const float32x4_t t1559 = vsubq_f32(t616, t1550);
+    const float32x4_t t653 = vaddq_f32(t276, t644);
+    const float32x4_t t1587 = vaddq_f32(t1570, t1582);
+    const float32x4_t t1594 = vsubq_f32(t653, t1587);
+    const float32x4_t t654 = vaddq_f32(t277, t643);
+    const float32x4_t t1586 = vaddq_f32(t1566, t1577);
+    const float32x4_t t1595 = vsubq_f32(t654, t1586);
+    const float32x4_t t686 = vaddq_f32(t303, t677);
+    const float32x4_t t1620 = vaddq_f32(t1605, t1615);
+    const float32x4_t t1627 = vsubq_f32(t686, t1620);
+    const float32x4_t t687 = vaddq_f32(t304, t676);
+    const float32x4_t t1619 = vaddq_f32(t1601, t1610);
+    const float32x4_t t1628 = vsubq_f32(t687, t1619);
+    const float32x4_t t720 = vaddq_f32(t338, t711);
+    const float32x4_t t1654 = vaddq_f32(t1638, t1649);
+    const float32x4_t t1661 = vsubq_f32(t720, t1654);
+    const float32x4_t t721 = vaddq_f32(t339, t710);
+    const float32x4_t t1653 = vaddq_f32(t1634, t1644);
+    const float32x4_t t1662 = vsubq_f32(t721, t1653);
+    const float32x4_t t1138 = vsubq_f32(t474, t1132);
+    const float32x4_t t1139 = vsubq_f32(t475, t1133);
+    const float32x4_t t1175 = vsubq_f32(t511, t1167);
+    const float32x4_t t1176 = vaddq_f32(t512, t1168);
+    const float32x4_t t1208 = vsubq_f32(t544, t1200);
+    const float32x4_t t1209 = vaddq_f32(t545, t1201);
+    const float32x4_t t1243 = vsubq_f32(t581, t1235);
+    const float32x4_t t1244 = vaddq_f32(t582, t1236);
+    const float32x4_t t1276 = vsubq_f32(t608, t1268);
+    const float32x4_t t1277 = vaddq_f32(t609, t1269);
+    const float32x4_t t1313 = vsubq_f32(t646, t1305);
+    const float32x4_t t1314 = vaddq_f32(t647, t1306);
+    const float32x4_t t1349 = vsubq_f32(t679, t1341);
+    const float32x4_t t1350 = vaddq_f32(t680, t1342);
+    const float32x4_t t1386 = vsubq_f32(t713, t1378);
+    const float32x4_t t1387 = vaddq_f32(t714, t1379);
+    const float32x4_t t1413 = vsubq_f32(t479, t1405);
+    const float32x4_t t1414 = vaddq_f32(t480, t1406);
+    const float32x4_t t1451 = vsubq_f32(t516, t1443);
+    const float32x4_t t1452 = vaddq_f32(t517, t1444);
+    const float32x4_t t1487 = vsubq_f32(t549, t1479);
+    const float32x4_t t1488 = vaddq_f32(t550, t1480);
+    const float32x4_t t1522 = vsubq_f32(t586, t1514);
+    const float32x4_t t1523 = vaddq_f32(t587, t1515);
+    const float32x4_t t1555 = vsubq_f32(t613, t1547);
+    const float32x4_t t1556 = vaddq_f32(t614, t1548);
+    const float32x4_t t1591 = vsubq_f32(t651, t1583);
+    const float32x4_t t1592 = vaddq_f32(t652, t1584);
+    const float32x4_t t1624 = vsubq_f32(t684, t1616);
+    const float32x4_t t1625 = vaddq_f32(t685, t1617);
+    const float32x4_t t1658 = vsubq_f32(t718, t1650);
+    const float32x4_t t1659 = vaddq_f32(t719, t1651);
+    const float32x4_t t1143 = vsubq_f32(t476, t1135);
+    const float32x4_t t1144 = vaddq_f32(t477, t1134);
+    const float32x4_t t1180 = vaddq_f32(t513, t1171);
+    const float32x4_t t1181 = vaddq_f32(t514, t1170);
+    const float32x4_t t1213 = vaddq_f32(t546, t1204);
+    const float32x4_t t1214 = vaddq_f32(t547, t1203);
+    const float32x4_t t1248 = vaddq_f32(t583, t1239);
+    const float32x4_t t1249 = vaddq_f32(t584, t1238);
+    const float32x4_t t1281 = vaddq_f32(t610, t1272);
+    const float32x4_t t1282 = vaddq_f32(t611, t1271);
+    const float32x4_t t1318 = vaddq_f32(t648, t1309);
+    const float32x4_t t1319 = vaddq_f32(t649, t1308);
+    const float32x4_t t1354 = vaddq_f32(t681, t1345);
+    const float32x4_t t1355 = vaddq_f32(t682, t1344);
+    const float32x4_t t1391 = vaddq_f32(t715, t1382);
+    const float32x4_t t1392 = vaddq_f32(t716, t1381);
+    const float32x4_t t1418 = vaddq_f32(t481, t1409);
+    const float32x4_t t1419 = vaddq_f32(t482, t1408);
+    const float32x4_t t1456 = vaddq_f32(t518, t1447);
+    const float32x4_t t1457 = vaddq_f32(t519, t1446);
+    const float32x4_t t1492 = vaddq_f32(t551, t1483);
+    const float32x4_t t1493 = vaddq_f32(t552, t1482);
+    const float32x4_t t1527 = vaddq_f32(t588, t1518);
+    const float32x4_t t1528 = vaddq_f32(t589, t1517);
+    const float32x4_t t1560 = vaddq_f32(t615, t1551);
+    const float32x4_t t1561 = vaddq_f32(t616, t1550);
+    const float32x4_t t1596 = vaddq_f32(t653, t1587);
+    const float32x4_t t1597 = vaddq_f32(t654, t1586);
+    const float32x4_t t1629 = vaddq_f32(t686, t1620);
+    const float32x4_t t1630 = vaddq_f32(t687, t1619);
+    const float32x4_t t1663 = vaddq_f32(t720, t1654);
+    const float32x4_t t1664 = vaddq_f32(t721, t1653);
+    store4(output + 0, 64, t1136, t1137, t1173, t1174, t1206, t1207, t1241, t1242);
+    store4(output + 4, 64, t1274, t1275, t1311, t1312, t1347, t1348, t1384, t1385);
+    store4(output + 8, 64, t1411, t1412, t1449, t1450, t1485, t1486, t1520, t1521);
+    store4(output + 12, 64, t1553, t1554, t1589, t1590, t1622, t1623, t1656, t1657);
+    store4(output + 16, 64, t1141, t1142, t1178, t1179, t1211, t1212, t1246, t1247);
+    store4(output + 20, 64, t1279, t1280, t1316, t1317, t1352, t1353, t1389, t1390);
+    store4(output + 24, 64, t1416, t1417, t1454, t1455, t1490, t1491, t1525, t1526);
+    store4(output + 28, 64, t1558, t1559, t1594, t1595, t1627, t1628, t1661, t1662);
+    store4(output + 32, 64, t1138, t1139, t1175, t1176, t1208, t1209, t1243, t1244);
+    store4(output + 36, 64, t1276, t1277, t1313, t1314, t1349, t1350, t1386, t1387);
+    store4(output + 40, 64, t1413, t1414, t1451, t1452, t1487, t1488, t1522, t1523);
+    store4(output + 44, 64, t1555, t1556, t1591, t1592, t1624, t1625, t1658, t1659);
+    store4(output + 48, 64, t1143, t1144, t1180, t1181, t1213, t1214, t1248, t1249);
+    store4(output + 52, 64, t1281, t1282, t1318, t1319, t1354, t1355, t1391, t1392);
+    store4(output + 56, 64, t1418, t1419, t1456, t1457, t1492, t1493, t1527, t1528);
+    store4(output + 60, 64, t1560, t1561, t1596, t1597, t1629, t1630, t1663, t1664);
+}
+
+// 912 additions, 248 multiplications (x4)
+void codelet_64_inv_x4(const CkFftComplex* input, CkFftComplex* output, CkFftSize stride)
+{
+    CkFftSize stride4 = stride * 4;
+    const float32x4x2_t x0 = load4(input + 0*stride4, stride);
+    const float32x4x2_t x32 = load4(input + 32*stride4, stride);
+    const float32x4_t t129 = vaddq_f32(x0.val[0], x32.val[0]);
+    const float32x4x2_t x16 = load4(input + 16*stride4, stride);
+    const float32x4x2_t x48 = load4(input + 48*stride4, stride);
+    const float32x4_t t133 = vaddq_f32(x16.val[0], x48.val[0]);
+    const float32x4_t t137 = vaddq_f32(t129, t133);
+    const float32x4x2_t x8 = load4(input + 8*stride4, stride);
+    const float32x4x2_t x40 = load4(input + 40*stride4, stride);
+    const float32x4_t t146 = vaddq_f32(x8.val[0], x40.val[0]);
+    const float32x4x2_t x24 = load4(input + 24*stride4, stride);
+    const float32x4x2_t x56 = load4(input + 56*stride4, stride);
+    const float32x4_t t150 = vaddq_f32(x24.val[0], x56.val[0]);
+    const float32x4_t t154 = vaddq_f32(t146, t150);
+    const float32x4_t t158 = vaddq_f32(t137, t154);
+    const float32x4x2_t x4 = load4(input + 4*stride4, stride);
+    const float32x4x2_t x36 = load4(input + 36*stride4, stride);
+    const float32x4_t t192 = vaddq_f32(x4.val[0], x36.val[0]);
+    const float32x4x2_t x20 = load4(input + 20*stride4, stride);
+    const float32x4x2_t x52 = load4(input + 52*stride4, stride);
+    const float32x4_t t196 = vaddq_f32(x20.val[0], x52.val[0]);
+    const float32x4_t t200 = vaddq_f32(t192, t196);
+    const float32x4x2_t x12 = load4(input + 12*stride4, stride);
+    const float32x4x2_t x44 = load4(input + 44*stride4, stride);
+    const float32x4_t t209 = vaddq_f32(x12.val[0], x44.val[0]);
+    const float32x4x2_t x28 = load4(input + 28*stride4, stride);
+    const float32x4x2_t x60 = load4(input + 60*stride4, stride);
+    const float32x4_t t213 = vaddq_f32(x28.val[0], x60.val[0]);
+    const float32x4_t t217 = vaddq_f32(t209, t213);
+    const float32x4_t t226 = vaddq_f32(t200, t217);
+    const float32x4_t t230 = vaddq_f32(t158, t226);
+    const float32x4x2_t x2 = load4(input + 2*stride4, stride);
+    const float32x4x2_t x34 = load4(input + 34*stride4, stride);
+    const float32x4_t t324 = vaddq_f32(x2.val[0], x34.val[0]);
+    const float32x4x2_t x18 = load4(input + 18*stride4, stride);
+    const float32x4x2_t x50 = load4(input + 50*stride4, stride);
+    const float32x4_t t328 = vaddq_f32(x18.val[0], x50.val[0]);
+    const float32x4_t t332 = vaddq_f32(t324, t328);
+    const float32x4x2_t x10 = load4(input + 10*stride4, stride);
+    const float32x4x2_t x42 = load4(input + 42*stride4, stride);
+    const float32x4_t t341 = vaddq_f32(x10.val[0], x42.val[0]);
+    const float32x4x2_t x26 = load4(input + 26*stride4, stride);
+    const float32x4x2_t x58 = load4(input + 58*stride4, stride);
+    const float32x4_t t345 = vaddq_f32(x26.val[0], x58.val[0]);
+    const float32x4_t t349 = vaddq_f32(t341, t345);
+    const float32x4_t t353 = vaddq_f32(t332, t349);
+    const float32x4x2_t x6 = load4(input + 6*stride4, stride);
+    const float32x4x2_t x38 = load4(input + 38*stride4, stride);
+    const float32x4_t t386 = vaddq_f32(x6.val[0], x38.val[0]);
+    const float32x4x2_t x22 = load4(input + 22*stride4, stride);
+    const float32x4x2_t x54 = load4(input + 54*stride4, stride);
+    const float32x4_t t390 = vaddq_f32(x22.val[0], x54.val[0]);
+    const float32x4_t t394 = vaddq_f32(t386, t390);
+    const float32x4x2_t x14 = load4(input + 14*stride4, stride);
+    const float32x4x2_t x46 = load4(input + 46*stride4, stride);
+    const float32x4_t t403 = vaddq_f32(x14.val[0], x46.val[0]);
+    const float32x4x2_t x30 = load4(input + 30*stride4, stride);
+    const float32x4x2_t x62 = load4(input + 62*stride4, stride);
+    const float32x4_t t407 = vaddq_f32(x30.val[0], x62.val[0]);
+    const float32x4_t t411 = vaddq_f32(t403, t407);
+    const float32x4_t t415 = vaddq_f32(t394, t411);
+    const float32x4_t t448 = vaddq_f32(t353, t415);
+    const float32x4_t t452 = vaddq_f32(t230, t448);
+    const float32x4x2_t x1 = load4(input + 1*stride4, stride);
+    const float32x4x2_t x33 = load4(input + 33*stride4, stride);
+    const float32x4_t t661 = vaddq_f32(x1.val[0], x33.val[0]);
+    const float32x4x2_t x17 = load4(input + 17*stride4, stride);
+    const float32x4x2_t x49 = load4(input + 49*stride4, stride);
+    const float32x4_t t665 = vaddq_f32(x17.val[0], x49.val[0]);
+    const float32x4_t t669 = vaddq_f32(t661, t665);
+    const float32x4x2_t x9 = load4(input + 9*stride4, stride);
+    const float32x4x2_t x41 = load4(input + 41*stride4, stride);
+    const float32x4_t t678 = vaddq_f32(x9.val[0], x41.val[0]);
+    const float32x4x2_t x25 = load4(input + 25*stride4, stride);
+    const float32x4x2_t x57 = load4(input + 57*stride4, stride);
+    const float32x4_t t682 = vaddq_f32(x25.val[0], x57.val[0]);
+    const float32x4_t t686 = vaddq_f32(t678, t682);
+    const float32x4_t t690 = vaddq_f32(t669, t686);
+    const float32x4x2_t x5 = load4(input + 5*stride4, stride);
+    const float32x4x2_t x37 = load4(input + 37*stride4, stride);
+    const float32x4_t t723 = vaddq_f32(x5.val[0], x37.val[0]);
+    const float32x4x2_t x21 = load4(input + 21*stride4, stride);
+    const float32x4x2_t x53 = load4(input + 53*stride4, stride);
+    const float32x4_t t727 = vaddq_f32(x21.val[0], x53.val[0]);
+    const float32x4_t t731 = vaddq_f32(t723, t727);
+    const float32x4x2_t x13 = load4(input + 13*stride4, stride);
+    const float32x4x2_t x45 = load4(input + 45*stride4, stride);
+    const float32x4_t t740 = vaddq_f32(x13.val[0], x45.val[0]);
+    const float32x4x2_t x29 = load4(input + 29*stride4, stride);
+    const float32x4x2_t x61 = load4(input + 61*stride4, stride);
+    const float32x4_t t744 = vaddq_f32(x29.val[0], x61.val[0]);
+    const float32x4_t t748 = vaddq_f32(t740, t744);
+    const float32x4_t t757 = vaddq_f32(t731, t748);
+    const float32x4_t t761 = vaddq_f32(t690, t757);
+    const float32x4x2_t x3 = load4(input + 3*stride4, stride);
+    const float32x4x2_t x35 = load4(input + 35*stride4, stride);
+    const float32x4_t t850 = vaddq_f32(x3.val[0], x35.val[0]);
+    const float32x4x2_t x19 = load4(input + 19*stride4, stride);
+    const float32x4x2_t x51 = load4(input + 51*stride4, stride);
+    const float32x4_t t854 = vaddq_f32(x19.val[0], x51.val[0]);
+    const float32x4_t t858 = vaddq_f32(t850, t854);
+    const float32x4x2_t x11 = load4(input + 11*stride4, stride);
+    const float32x4x2_t x43 = load4(input + 43*stride4, stride);
+    const float32x4_t t867 = vaddq_f32(x11.val[0], x43.val[0]);
+    const float32x4x2_t x27 = load4(input + 27*stride4, stride);
+    const float32x4x2_t x59 = load4(input + 59*stride4, stride);
+    const float32x4_t t871 = vaddq_f32(x27.val[0], x59.val[0]);
+    const float32x4_t t875 = vaddq_f32(t867, t871);
+    const float32x4_t t879 = vaddq_f32(t858, t875);
+    const float32x4x2_t x7 = load4(input + 7*stride4, stride);
+    const float32x4x2_t x39 = load4(input + 39*stride4, stride);
+    const float32x4_t t912 = vaddq_f32(x7.val[0], x39.val[0]);
+    const float32x4x2_t x23 = load4(input + 23*stride4, stride);
+    const float32x4x2_t x55 = load4(input + 55*stride4, stride);
+    const float32x4_t t916 = vaddq_f32(x23.val[0], x55.val[0]);
+    const float32x4_t t920 = vaddq_f32(t912, t916);
+    const float32x4x2_t x15 = load4(input + 15*stride4, stride);
+    const float32x4x2_t x47 = load4(input + 47*stride4, stride);
+    const float32x4_t t929 = vaddq_f32(x15.val[0], x47.val[0]);
+    const float32x4x2_t x31 = load4(input + 31*stride4, stride);
+    const float32x4x2_t x63 = load4(input + 63*stride4, stride);
+    const float32x4_t t933 = vaddq_f32(x31.val[0], x63.val[0]);
+    const float32x4_t t937 = vaddq_f32(t929, t933);
+    const float32x4_t t946 = vaddq_f32(t920, t937);
+    const float32x4_t t950 = vaddq_f32(t879, t946);
+    const float32x4_t t1039 = vaddq_f32(t761, t950);
+    const float32x4_t t1043 = vaddq_f32(t452, t1039);
+    const float32x4_t t130 = vaddq_f32(x0.val[1], x32.val[1]);
+    const float32x4_t t134 = vaddq_f32(x16.val[1], x48.val[1]);
+    const float32x4_t t138 = vaddq_f32(t130, t134);
+    const float32x4_t t147 = vaddq_f32(x8.val[1], x40.val[1]);
+    const float32x4_t t151 = vaddq_f32(x24.val[1], x56.val[1]);
+    const float32x4_t t155 = vaddq_f32(t147, t151);
+    const float32x4_t t159 = vaddq_f32(t138, t155);
+    const float32x4_t t193 = vaddq_f32(x4.val[1], x36.val[1]);
+    const float32x4_t t197 = vaddq_f32(x20.val[1], x52.val[1]);
+    const float32x4_t t201 = vaddq_f32(t193, t197);
+    const float32x4_t t210 = vaddq_f32(x12.val[1], x44.val[1]);
+    const float32x4_t t214 = vaddq_f32(x28.val[1], x60.val[1]);
+    const float32x4_t t218 = vaddq_f32(t210, t214);
+    const float32x4_t t227 = vaddq_f32(t201, t218);
+    const float32x4_t t231 = vaddq_f32(t159, t227);
+    const float32x4_t t325 = vaddq_f32(x2.val[1], x34.val[1]);
+    const float32x4_t t329 = vaddq_f32(x18.val[1], x50.val[1]);
+    const float32x4_t t333 = vaddq_f32(t325, t329);
+    const float32x4_t t342 = vaddq_f32(x10.val[1], x42.val[1]);
+    const float32x4_t t346 = vaddq_f32(x26.val[1], x58.val[1]);
+    const float32x4_t t350 = vaddq_f32(t342, t346);
+    const float32x4_t t354 = vaddq_f32(t333, t350);
+    const float32x4_t t387 = vaddq_f32(x6.val[1], x38.val[1]);
+    const float32x4_t t391 = vaddq_f32(x22.val[1], x54.val[1]);
+    const float32x4_t t395 = vaddq_f32(t387, t391);
+    const float32x4_t t404 = vaddq_f32(x14.val[1], x46.val[1]);
+    const float32x4_t t408 = vaddq_f32(x30.val[1], x62.val[1]);
+    const float32x4_t t412 = vaddq_f32(t404, t408);
+    const float32x4_t t416 = vaddq_f32(t395, t412);
+    const float32x4_t t449 = vaddq_f32(t354, t416);
+    const float32x4_t t453 = vaddq_f32(t231, t449);
+    const float32x4_t t662 = vaddq_f32(x1.val[1], x33.val[1]);
+    const float32x4_t t666 = vaddq_f32(x17.val[1], x49.val[1]);
+    const float32x4_t t670 = vaddq_f32(t662, t666);
+    const float32x4_t t679 = vaddq_f32(x9.val[1], x41.val[1]);
+    const float32x4_t t683 = vaddq_f32(x25.val[1], x57.val[1]);
+    const float32x4_t t687 = vaddq_f32(t679, t683);
+    const float32x4_t t691 = vaddq_f32(t670, t687);
+    const float32x4_t t724 = vaddq_f32(x5.val[1], x37.val[1]);
+    const float32x4_t t728 = vaddq_f32(x21.val[1], x53.val[1]);
+    const float32x4_t t732 = vaddq_f32(t724, t728);
+    const float32x4_t t741 = vaddq_f32(x13.val[1], x45.val[1]);
+    const float32x4_t t745 = vaddq_f32(x29.val[1], x61.val[1]);
+    const float32x4_t t749 = vaddq_f32(t741, t745);
+    const float32x4_t t758 = vaddq_f32(t732, t749);
+    const float32x4_t t762 = vaddq_f32(t691, t758);
+    const float32x4_t t851 = vaddq_f32(x3.val[1], x35.val[1]);
+    const float32x4_t t855 = vaddq_f32(x19.val[1], x51.val[1]);
+    const float32x4_t t859 = vaddq_f32(t851, t855);
+    const float32x4_t t868 = vaddq_f32(x11.val[1], x43.val[1]);
+    const float32x4_t t872 = vaddq_f32(x27.val[1], x59.val[1]);
+    const float32x4_t t876 = vaddq_f32(t868, t872);
+    const float32x4_t t880 = vaddq_f32(t859, t876);
+    const float32x4_t t913 = vaddq_f32(x7.val[1], x39.val[1]);
+    const float32x4_t t917 = vaddq_f32(x23.val[1], x55.val[1]);
+    const float32x4_t t921 = vaddq_f32(t913, t917);
+    const float32x4_t t930 = vaddq_f32(x15.val[1], x47.val[1]);
+    const float32x4_t t934 = vaddq_f32(x31.val[1], x63.val[1]);
+    const float32x4_t t938 = vaddq_f32(t930, t934);
+    const float32x4_t t947 = vaddq_f32(t921, t938);
+    const float32x4_t t951 = vaddq_f32(t880, t947);
+    const float32x4_t t1040 = vaddq_f32(t762, t951);
+    const float32x4_t t1044 = vaddq_f32(t453, t1040);
+    const float32x4_t t131 = vsubq_f32(x0.val[0], x32.val[0]);
+    const float32x4_t t136 = vsubq_f32(x16.val[1], x48.val[1]);
+    const float32x4_t t142 = vsubq_f32(t131, t136);
+    const float32x4_t t148 = vsubq_f32(x8.val[0], x40.val[0]);
+    const float32x4_t t149 = vsubq_f32(x8.val[1], x40.val[1]);
+    const float32x4_t t167 = vsubq_f32(t148, t149);
+    const float32x4_t t169 = vmulq_n_f32(t167, 0.707106781f);
+    const float32x4_t t152 = vsubq_f32(x24.val[0], x56.val[0]);
+    const float32x4_t t153 = vsubq_f32(x24.val[1], x56.val[1]);
+    const float32x4_t t172 = vaddq_f32(t152, t153);
+    const float32x4_t t173 = vmulq_n_f32(t172, 0.707106781f);
+    const float32x4_t t179 = vsubq_f32(t169, t173);
+    const float32x4_t t183 = vaddq_f32(t142, t179);
+    const float32x4_t t194 = vsubq_f32(x4.val[0], x36.val[0]);
+    const float32x4_t t199 = vsubq_f32(x20.val[1], x52.val[1]);
+    const float32x4_t t205 = vsubq_f32(t194, t199);
+    const float32x4_t t240 = vmulq_n_f32(t205, 0.923879533f);
+    const float32x4_t t195 = vsubq_f32(x4.val[1], x36.val[1]);
+    const float32x4_t t198 = vsubq_f32(x20.val[0], x52.val[0]);
+    const float32x4_t t206 = vaddq_f32(t195, t198);
+    const float32x4_t t242 = vmulq_n_f32(t206, 0.382683432f);
+    const float32x4_t t243 = vsubq_f32(t240, t242);
+    const float32x4_t t211 = vsubq_f32(x12.val[0], x44.val[0]);
+    const float32x4_t t216 = vsubq_f32(x28.val[1], x60.val[1]);
+    const float32x4_t t222 = vsubq_f32(t211, t216);
+    const float32x4_t t248 = vmulq_n_f32(t222, 0.382683432f);
+    const float32x4_t t212 = vsubq_f32(x12.val[1], x44.val[1]);
+    const float32x4_t t215 = vsubq_f32(x28.val[0], x60.val[0]);
+    const float32x4_t t223 = vaddq_f32(t212, t215);
+    const float32x4_t t249 = vmulq_n_f32(t223, 0.923879533f);
+    const float32x4_t t250 = vsubq_f32(t248, t249);
+    const float32x4_t t254 = vaddq_f32(t243, t250);
+    const float32x4_t t258 = vaddq_f32(t183, t254);
+    const float32x4_t t326 = vsubq_f32(x2.val[0], x34.val[0]);
+    const float32x4_t t331 = vsubq_f32(x18.val[1], x50.val[1]);
+    const float32x4_t t337 = vsubq_f32(t326, t331);
+    const float32x4_t t343 = vsubq_f32(x10.val[0], x42.val[0]);
+    const float32x4_t t344 = vsubq_f32(x10.val[1], x42.val[1]);
+    const float32x4_t t362 = vsubq_f32(t343, t344);
+    const float32x4_t t363 = vmulq_n_f32(t362, 0.707106781f);
+    const float32x4_t t347 = vsubq_f32(x26.val[0], x58.val[0]);
+    const float32x4_t t348 = vsubq_f32(x26.val[1], x58.val[1]);
+    const float32x4_t t366 = vaddq_f32(t347, t348);
+    const float32x4_t t367 = vmulq_n_f32(t366, 0.707106781f);
+    const float32x4_t t373 = vsubq_f32(t363, t367);
+    const float32x4_t t377 = vaddq_f32(t337, t373);
+    const float32x4_t t462 = vmulq_n_f32(t377, 0.980785280f);
+    const float32x4_t t327 = vsubq_f32(x2.val[1], x34.val[1]);
+    const float32x4_t t330 = vsubq_f32(x18.val[0], x50.val[0]);
+    const float32x4_t t338 = vaddq_f32(t327, t330);
+    const float32x4_t t364 = vaddq_f32(t343, t344);
+    const float32x4_t t365 = vmulq_n_f32(t364, 0.707106781f);
+    const float32x4_t t369 = vsubq_f32(t347, t348);
+    const float32x4_t t371 = vmulq_n_f32(t369, 0.707106781f);
+    const float32x4_t t374 = vaddq_f32(t365, t371);
+    const float32x4_t t378 = vaddq_f32(t338, t374);
+    const float32x4_t t464 = vmulq_n_f32(t378, 0.195090322f);
+    const float32x4_t t465 = vsubq_f32(t462, t464);
+    const float32x4_t t388 = vsubq_f32(x6.val[0], x38.val[0]);
+    const float32x4_t t393 = vsubq_f32(x22.val[1], x54.val[1]);
+    const float32x4_t t399 = vsubq_f32(t388, t393);
+    const float32x4_t t405 = vsubq_f32(x14.val[0], x46.val[0]);
+    const float32x4_t t406 = vsubq_f32(x14.val[1], x46.val[1]);
+    const float32x4_t t424 = vsubq_f32(t405, t406);
+    const float32x4_t t425 = vmulq_n_f32(t424, 0.707106781f);
+    const float32x4_t t409 = vsubq_f32(x30.val[0], x62.val[0]);
+    const float32x4_t t410 = vsubq_f32(x30.val[1], x62.val[1]);
+    const float32x4_t t428 = vaddq_f32(t409, t410);
+    const float32x4_t t429 = vmulq_n_f32(t428, 0.707106781f);
+    const float32x4_t t435 = vsubq_f32(t425, t429);
+    const float32x4_t t439 = vaddq_f32(t399, t435);
+    const float32x4_t t470 = vmulq_n_f32(t439, 0.831469612f);
+    const float32x4_t t389 = vsubq_f32(x6.val[1], x38.val[1]);
+    const float32x4_t t392 = vsubq_f32(x22.val[0], x54.val[0]);
+    const float32x4_t t400 = vaddq_f32(t389, t392);
+    const float32x4_t t426 = vaddq_f32(t405, t406);
+    const float32x4_t t427 = vmulq_n_f32(t426, 0.707106781f);
+    const float32x4_t t431 = vsubq_f32(t409, t410);
+    const float32x4_t t433 = vmulq_n_f32(t431, 0.707106781f);
+    const float32x4_t t436 = vaddq_f32(t427, t433);
+    const float32x4_t t440 = vaddq_f32(t400, t436);
+    const float32x4_t t472 = vmulq_n_f32(t440, 0.555570233f);
+    const float32x4_t t473 = vsubq_f32(t470, t472);
+    const float32x4_t t477 = vaddq_f32(t465, t473);
+    const float32x4_t t481 = vaddq_f32(t258, t477);
+    const float32x4_t t663 = vsubq_f32(x1.val[0], x33.val[0]);
+    const float32x4_t t668 = vsubq_f32(x17.val[1], x49.val[1]);
+    const float32x4_t t674 = vsubq_f32(t663, t668);
+    const float32x4_t t680 = vsubq_f32(x9.val[0], x41.val[0]);
+    const float32x4_t t681 = vsubq_f32(x9.val[1], x41.val[1]);
+    const float32x4_t t699 = vsubq_f32(t680, t681);
+    const float32x4_t t700 = vmulq_n_f32(t699, 0.707106781f);
+    const float32x4_t t684 = vsubq_f32(x25.val[0], x57.val[0]);
+    const float32x4_t t685 = vsubq_f32(x25.val[1], x57.val[1]);
+    const float32x4_t t703 = vaddq_f32(t684, t685);
+    const float32x4_t t704 = vmulq_n_f32(t703, 0.707106781f);
+    const float32x4_t t710 = vsubq_f32(t700, t704);
+    const float32x4_t t714 = vaddq_f32(t674, t710);
+    const float32x4_t t725 = vsubq_f32(x5.val[0], x37.val[0]);
+    const float32x4_t t730 = vsubq_f32(x21.val[1], x53.val[1]);
+    const float32x4_t t736 = vsubq_f32(t725, t730);
+    const float32x4_t t770 = vmulq_n_f32(t736, 0.923879533f);
+    const float32x4_t t726 = vsubq_f32(x5.val[1], x37.val[1]);
+    const float32x4_t t729 = vsubq_f32(x21.val[0], x53.val[0]);
+    const float32x4_t t737 = vaddq_f32(t726, t729);
+    const float32x4_t t771 = vmulq_n_f32(t737, 0.382683432f);
+    const float32x4_t t772 = vsubq_f32(t770, t771);
+    const float32x4_t t742 = vsubq_f32(x13.val[0], x45.val[0]);
+    const float32x4_t t747 = vsubq_f32(x29.val[1], x61.val[1]);
+    const float32x4_t t753 = vsubq_f32(t742, t747);
+    const float32x4_t t776 = vmulq_n_f32(t753, 0.382683432f);
+    const float32x4_t t743 = vsubq_f32(x13.val[1], x45.val[1]);
+    const float32x4_t t746 = vsubq_f32(x29.val[0], x61.val[0]);
+    const float32x4_t t754 = vaddq_f32(t743, t746);
+    const float32x4_t t777 = vmulq_n_f32(t754, 0.923879533f);
+    const float32x4_t t778 = vsubq_f32(t776, t777);
+    const float32x4_t t782 = vaddq_f32(t772, t778);
+    const float32x4_t t786 = vaddq_f32(t714, t782);
+    const float32x4_t t1053 = vmulq_n_f32(t786, 0.995184727f);
+    const float32x4_t t664 = vsubq_f32(x1.val[1], x33.val[1]);
+    const float32x4_t t667 = vsubq_f32(x17.val[0], x49.val[0]);
+    const float32x4_t t675 = vaddq_f32(t664, t667);
+    const float32x4_t t701 = vaddq_f32(t680, t681);
+    const float32x4_t t702 = vmulq_n_f32(t701, 0.707106781f);
+    const float32x4_t t706 = vsubq_f32(t684, t685);
+    const float32x4_t t708 = vmulq_n_f32(t706, 0.707106781f);
+    const float32x4_t t711 = vaddq_f32(t702, t708);
+    const float32x4_t t715 = vaddq_f32(t675, t711);
+    const float32x4_t t773 = vmulq_n_f32(t736, 0.382683432f);
+    const float32x4_t t774 = vmulq_n_f32(t737, 0.923879533f);
+    const float32x4_t t775 = vaddq_f32(t773, t774);
+    const float32x4_t t779 = vmulq_n_f32(t753, 0.923879533f);
+    const float32x4_t t780 = vmulq_n_f32(t754, 0.382683432f);
+    const float32x4_t t781 = vaddq_f32(t779, t780);
+    const float32x4_t t783 = vaddq_f32(t775, t781);
+    const float32x4_t t787 = vaddq_f32(t715, t783);
+    const float32x4_t t1055 = vmulq_n_f32(t787, 0.098017140f);
+    const float32x4_t t1056 = vsubq_f32(t1053, t1055);
+    const float32x4_t t852 = vsubq_f32(x3.val[0], x35.val[0]);
+    const float32x4_t t857 = vsubq_f32(x19.val[1], x51.val[1]);
+    const float32x4_t t863 = vsubq_f32(t852, t857);
+    const float32x4_t t869 = vsubq_f32(x11.val[0], x43.val[0]);
+    const float32x4_t t870 = vsubq_f32(x11.val[1], x43.val[1]);
+    const float32x4_t t888 = vsubq_f32(t869, t870);
+    const float32x4_t t889 = vmulq_n_f32(t888, 0.707106781f);
+    const float32x4_t t873 = vsubq_f32(x27.val[0], x59.val[0]);
+    const float32x4_t t874 = vsubq_f32(x27.val[1], x59.val[1]);
+    const float32x4_t t892 = vaddq_f32(t873, t874);
+    const float32x4_t t893 = vmulq_n_f32(t892, 0.707106781f);
+    const float32x4_t t899 = vsubq_f32(t889, t893);
+    const float32x4_t t903 = vaddq_f32(t863, t899);
+    const float32x4_t t914 = vsubq_f32(x7.val[0], x39.val[0]);
+    const float32x4_t t919 = vsubq_f32(x23.val[1], x55.val[1]);
+    const float32x4_t t925 = vsubq_f32(t914, t919);
+    const float32x4_t t959 = vmulq_n_f32(t925, 0.923879533f);
+    const float32x4_t t915 = vsubq_f32(x7.val[1], x39.val[1]);
+    const float32x4_t t918 = vsubq_f32(x23.val[0], x55.val[0]);
+    const float32x4_t t926 = vaddq_f32(t915, t918);
+    const float32x4_t t960 = vmulq_n_f32(t926, 0.382683432f);
+    const float32x4_t t961 = vsubq_f32(t959, t960);
+    const float32x4_t t931 = vsubq_f32(x15.val[0], x47.val[0]);
+    const float32x4_t t936 = vsubq_f32(x31.val[1], x63.val[1]);
+    const float32x4_t t942 = vsubq_f32(t931, t936);
+    const float32x4_t t965 = vmulq_n_f32(t942, 0.382683432f);
+    const float32x4_t t932 = vsubq_f32(x15.val[1], x47.val[1]);
+    const float32x4_t t935 = vsubq_f32(x31.val[0], x63.val[0]);
+    const float32x4_t t943 = vaddq_f32(t932, t935);
+    const float32x4_t t966 = vmulq_n_f32(t943, 0.923879533f);
+    const float32x4_t t967 = vsubq_f32(t965, t966);
+    const float32x4_t t971 = vaddq_f32(t961, t967);
+    const float32x4_t t975 = vaddq_f32(t903, t971);
+    const float32x4_t t1061 = vmulq_n_f32(t975, 0.956940336f);
+    const float32x4_t t853 = vsubq_f32(x3.val[1], x35.val[1]);
+    const float32x4_t t856 = vsubq_f32(x19.val[0], x51.val[0]);
+    const float32x4_t t864 = vaddq_f32(t853, t856);
+    const float32x4_t t890 = vaddq_f32(t869, t870);
+    const float32x4_t t891 = vmulq_n_f32(t890, 0.707106781f);
+    const float32x4_t t895 = vsubq_f32(t873, t874);
+    const float32x4_t t897 = vmulq_n_f32(t895, 0.707106781f);
+    const float32x4_t t900 = vaddq_f32(t891, t897);
+    const float32x4_t t904 = vaddq_f32(t864, t900);
+    const float32x4_t t962 = vmulq_n_f32(t925, 0.382683432f);
+    const float32x4_t t963 = vmulq_n_f32(t926, 0.923879533f);
+    const float32x4_t t964 = vaddq_f32(t962, t963);
+    const float32x4_t t968 = vmulq_n_f32(t942, 0.923879533f);
+    const float32x4_t t969 = vmulq_n_f32(t943, 0.382683432f);
+    const float32x4_t t970 = vaddq_f32(t968, t969);
+    const float32x4_t t972 = vaddq_f32(t964, t970);
+    const float32x4_t t976 = vaddq_f32(t904, t972);
+    const float32x4_t t1063 = vmulq_n_f32(t976, 0.290284677f);
+    const float32x4_t t1064 = vsubq_f32(t1061, t1063);
+    const float32x4_t t1068 = vaddq_f32(t1056, t1064);
+    const float32x4_t t1072 = vaddq_f32(t481, t1068);
+    const float32x4_t t132 = vsubq_f32(x0.val[1], x32.val[1]);
+    const float32x4_t t135 = vsubq_f32(x16.val[0], x48.val[0]);
+    const float32x4_t t143 = vaddq_f32(t132, t135);
+    const float32x4_t t170 = vaddq_f32(t148, t149);
+    const float32x4_t t171 = vmulq_n_f32(t170, 0.707106781f);
+    const float32x4_t t175 = vsubq_f32(t152, t153);
+    const float32x4_t t177 = vmulq_n_f32(t175, 0.707106781f);
+    const float32x4_t t180 = vaddq_f32(t171, t177);
+    const float32x4_t t184 = vaddq_f32(t143, t180);
+    const float32x4_t t244 = vmulq_n_f32(t205, 0.382683432f);
+    const float32x4_t t245 = vmulq_n_f32(t206, 0.923879533f);
+    const float32x4_t t246 = vaddq_f32(t244, t245);
+    const float32x4_t t251 = vmulq_n_f32(t222, 0.923879533f);
+    const float32x4_t t252 = vmulq_n_f32(t223, 0.382683432f);
+    const float32x4_t t253 = vaddq_f32(t251, t252);
+    const float32x4_t t255 = vaddq_f32(t246, t253);
+    const float32x4_t t259 = vaddq_f32(t184, t255);
+    const float32x4_t t466 = vmulq_n_f32(t377, 0.195090322f);
+    const float32x4_t t467 = vmulq_n_f32(t378, 0.980785280f);
+    const float32x4_t t468 = vaddq_f32(t466, t467);
+    const float32x4_t t474 = vmulq_n_f32(t439, 0.555570233f);
+    const float32x4_t t475 = vmulq_n_f32(t440, 0.831469612f);
+    const float32x4_t t476 = vaddq_f32(t474, t475);
+    const float32x4_t t478 = vaddq_f32(t468, t476);
+    const float32x4_t t482 = vaddq_f32(t259, t478);
+    const float32x4_t t1057 = vmulq_n_f32(t786, 0.098017140f);
+    const float32x4_t t1058 = vmulq_n_f32(t787, 0.995184727f);
+    const float32x4_t t1059 = vaddq_f32(t1057, t1058);
+    const float32x4_t t1065 = vmulq_n_f32(t975, 0.290284677f);
+    const float32x4_t t1066 = vmulq_n_f32(t976, 0.956940336f);
+    const float32x4_t t1067 = vaddq_f32(t1065, t1066);
+    const float32x4_t t1069 = vaddq_f32(t1059, t1067);
+    const float32x4_t t1073 = vaddq_f32(t482, t1069);
+    const float32x4_t t139 = vsubq_f32(t129, t133);
+    const float32x4_t t157 = vsubq_f32(t147, t151);
+    const float32x4_t t163 = vsubq_f32(t139, t157);
+    const float32x4_t t202 = vsubq_f32(t192, t196);
+    const float32x4_t t203 = vsubq_f32(t193, t197);
+    const float32x4_t t267 = vsubq_f32(t202, t203);
+    const float32x4_t t268 = vmulq_n_f32(t267, 0.707106781f);
+    const float32x4_t t219 = vsubq_f32(t209, t213);
+    const float32x4_t t220 = vsubq_f32(t210, t214);
+    const float32x4_t t271 = vaddq_f32(t219, t220);
+    const float32x4_t t272 = vmulq_n_f32(t271, 0.707106781f);
+    const float32x4_t t278 = vsubq_f32(t268, t272);
+    const float32x4_t t282 = vaddq_f32(t163, t278);
+    const float32x4_t t334 = vsubq_f32(t324, t328);
+    const float32x4_t t352 = vsubq_f32(t342, t346);
+    const float32x4_t t358 = vsubq_f32(t334, t352);
+    const float32x4_t t490 = vmulq_n_f32(t358, 0.923879533f);
+    const float32x4_t t335 = vsubq_f32(t325, t329);
+    const float32x4_t t351 = vsubq_f32(t341, t345);
+    const float32x4_t t359 = vaddq_f32(t335, t351);
+    const float32x4_t t491 = vmulq_n_f32(t359, 0.382683432f);
+    const float32x4_t t492 = vsubq_f32(t490, t491);
+    const float32x4_t t396 = vsubq_f32(t386, t390);
+    const float32x4_t t414 = vsubq_f32(t404, t408);
+    const float32x4_t t420 = vsubq_f32(t396, t414);
+    const float32x4_t t496 = vmulq_n_f32(t420, 0.382683432f);
+    const float32x4_t t397 = vsubq_f32(t387, t391);
+    const float32x4_t t413 = vsubq_f32(t403, t407);
+    const float32x4_t t421 = vaddq_f32(t397, t413);
+    const float32x4_t t497 = vmulq_n_f32(t421, 0.923879533f);
+    const float32x4_t t498 = vsubq_f32(t496, t497);
+    const float32x4_t t502 = vaddq_f32(t492, t498);
+    const float32x4_t t506 = vaddq_f32(t282, t502);
+    const float32x4_t t671 = vsubq_f32(t661, t665);
+    const float32x4_t t689 = vsubq_f32(t679, t683);
+    const float32x4_t t695 = vsubq_f32(t671, t689);
+    const float32x4_t t733 = vsubq_f32(t723, t727);
+    const float32x4_t t734 = vsubq_f32(t724, t728);
+    const float32x4_t t795 = vsubq_f32(t733, t734);
+    const float32x4_t t796 = vmulq_n_f32(t795, 0.707106781f);
+    const float32x4_t t750 = vsubq_f32(t740, t744);
+    const float32x4_t t751 = vsubq_f32(t741, t745);
+    const float32x4_t t799 = vaddq_f32(t750, t751);
+    const float32x4_t t800 = vmulq_n_f32(t799, 0.707106781f);
+    const float32x4_t t806 = vsubq_f32(t796, t800);
+    const float32x4_t t810 = vaddq_f32(t695, t806);
+    const float32x4_t t1081 = vmulq_n_f32(t810, 0.980785280f);
+    const float32x4_t t672 = vsubq_f32(t662, t666);
+    const float32x4_t t688 = vsubq_f32(t678, t682);
+    const float32x4_t t696 = vaddq_f32(t672, t688);
+    const float32x4_t t797 = vaddq_f32(t733, t734);
+    const float32x4_t t798 = vmulq_n_f32(t797, 0.707106781f);
+    const float32x4_t t802 = vsubq_f32(t750, t751);
+    const float32x4_t t804 = vmulq_n_f32(t802, 0.707106781f);
+    const float32x4_t t807 = vaddq_f32(t798, t804);
+    const float32x4_t t811 = vaddq_f32(t696, t807);
+    const float32x4_t t1082 = vmulq_n_f32(t811, 0.195090322f);
+    const float32x4_t t1083 = vsubq_f32(t1081, t1082);
+    const float32x4_t t860 = vsubq_f32(t850, t854);
+    const float32x4_t t878 = vsubq_f32(t868, t872);
+    const float32x4_t t884 = vsubq_f32(t860, t878);
+    const float32x4_t t922 = vsubq_f32(t912, t916);
+    const float32x4_t t923 = vsubq_f32(t913, t917);
+    const float32x4_t t984 = vsubq_f32(t922, t923);
+    const float32x4_t t985 = vmulq_n_f32(t984, 0.707106781f);
+    const float32x4_t t939 = vsubq_f32(t929, t933);
+    const float32x4_t t940 = vsubq_f32(t930, t934);
+    const float32x4_t t988 = vaddq_f32(t939, t940);
+    const float32x4_t t989 = vmulq_n_f32(t988, 0.707106781f);
+    const float32x4_t t995 = vsubq_f32(t985, t989);
+    const float32x4_t t999 = vaddq_f32(t884, t995);
+    const float32x4_t t1087 = vmulq_n_f32(t999, 0.831469612f);
+    const float32x4_t t861 = vsubq_f32(t851, t855);
+    const float32x4_t t877 = vsubq_f32(t867, t871);
+    const float32x4_t t885 = vaddq_f32(t861, t877);
+    const float32x4_t t986 = vaddq_f32(t922, t923);
+    const float32x4_t t987 = vmulq_n_f32(t986, 0.707106781f);
+    const float32x4_t t991 = vsubq_f32(t939, t940);
+    const float32x4_t t993 = vmulq_n_f32(t991, 0.707106781f);
+    const float32x4_t t996 = vaddq_f32(t987, t993);
+    const float32x4_t t1000 = vaddq_f32(t885, t996);
+    const float32x4_t t1088 = vmulq_n_f32(t1000, 0.555570233f);
+    const float32x4_t t1089 = vsubq_f32(t1087, t1088);
+    const float32x4_t t1093 = vaddq_f32(t1083, t1089);
+    const float32x4_t t1097 = vaddq_f32(t506, t1093);
+    const float32x4_t t140 = vsubq_f32(t130, t134);
+    const float32x4_t t156 = vsubq_f32(t146, t150);
+    const float32x4_t t164 = vaddq_f32(t140, t156);
+    const float32x4_t t269 = vaddq_f32(t202, t203);
+    const float32x4_t t270 = vmulq_n_f32(t269, 0.707106781f);
+    const float32x4_t t274 = vsubq_f32(t219, t220);
+    const float32x4_t t276 = vmulq_n_f32(t274, 0.707106781f);
+    const float32x4_t t279 = vaddq_f32(t270, t276);
+    const float32x4_t t283 = vaddq_f32(t164, t279);
+    const float32x4_t t493 = vmulq_n_f32(t358, 0.382683432f);
+    const float32x4_t t494 = vmulq_n_f32(t359, 0.923879533f);
+    const float32x4_t t495 = vaddq_f32(t493, t494);
+    const float32x4_t t499 = vmulq_n_f32(t420, 0.923879533f);
+    const float32x4_t t500 = vmulq_n_f32(t421, 0.382683432f);
+    const float32x4_t t501 = vaddq_f32(t499, t500);
+    const float32x4_t t503 = vaddq_f32(t495, t501);
+    const float32x4_t t507 = vaddq_f32(t283, t503);
+    const float32x4_t t1084 = vmulq_n_f32(t810, 0.195090322f);
+    const float32x4_t t1085 = vmulq_n_f32(t811, 0.980785280f);
+    const float32x4_t t1086 = vaddq_f32(t1084, t1085);
+    const float32x4_t t1090 = vmulq_n_f32(t999, 0.555570233f);
+    const float32x4_t t1091 = vmulq_n_f32(t1000, 0.831469612f);
+    const float32x4_t t1092 = vaddq_f32(t1090, t1091);
+    const float32x4_t t1094 = vaddq_f32(t1086, t1092);
+    const float32x4_t t1098 = vaddq_f32(t507, t1094);
+    const float32x4_t t144 = vaddq_f32(t131, t136);
+    const float32x4_t t182 = vsubq_f32(t171, t177);
+    const float32x4_t t188 = vsubq_f32(t144, t182);
+    const float32x4_t t207 = vaddq_f32(t194, t199);
+    const float32x4_t t291 = vmulq_n_f32(t207, 0.382683432f);
+    const float32x4_t t208 = vsubq_f32(t195, t198);
+    const float32x4_t t292 = vmulq_n_f32(t208, 0.923879533f);
+    const float32x4_t t293 = vsubq_f32(t291, t292);
+    const float32x4_t t224 = vaddq_f32(t211, t216);
+    const float32x4_t t298 = vmulq_n_f32(t224, 0.923879533f);
+    const float32x4_t t225 = vsubq_f32(t212, t215);
+    const float32x4_t t301 = vmulq_n_f32(t225, 0.382683432f);
+    const float32x4_t t303 = vsubq_f32(t298, t301);
+    const float32x4_t t311 = vsubq_f32(t293, t303);
+    const float32x4_t t315 = vaddq_f32(t188, t311);
+    const float32x4_t t339 = vaddq_f32(t326, t331);
+    const float32x4_t t376 = vsubq_f32(t365, t371);
+    const float32x4_t t382 = vsubq_f32(t339, t376);
+    const float32x4_t t515 = vmulq_n_f32(t382, 0.831469612f);
+    const float32x4_t t340 = vsubq_f32(t327, t330);
+    const float32x4_t t375 = vaddq_f32(t363, t367);
+    const float32x4_t t383 = vaddq_f32(t340, t375);
+    const float32x4_t t516 = vmulq_n_f32(t383, 0.555570233f);
+    const float32x4_t t517 = vsubq_f32(t515, t516);
+    const float32x4_t t401 = vaddq_f32(t388, t393);
+    const float32x4_t t438 = vsubq_f32(t427, t433);
+    const float32x4_t t444 = vsubq_f32(t401, t438);
+    const float32x4_t t522 = vmulq_n_f32(t444, 0.195090322f);
+    const float32x4_t t402 = vsubq_f32(t389, t392);
+    const float32x4_t t437 = vaddq_f32(t425, t429);
+    const float32x4_t t445 = vaddq_f32(t402, t437);
+    const float32x4_t t524 = vmulq_n_f32(t445, 0.980785280f);
+    const float32x4_t t525 = vaddq_f32(t522, t524);
+    const float32x4_t t531 = vsubq_f32(t517, t525);
+    const float32x4_t t535 = vaddq_f32(t315, t531);
+    const float32x4_t t676 = vaddq_f32(t663, t668);
+    const float32x4_t t713 = vsubq_f32(t702, t708);
+    const float32x4_t t719 = vsubq_f32(t676, t713);
+    const float32x4_t t738 = vaddq_f32(t725, t730);
+    const float32x4_t t819 = vmulq_n_f32(t738, 0.382683432f);
+    const float32x4_t t739 = vsubq_f32(t726, t729);
+    const float32x4_t t820 = vmulq_n_f32(t739, 0.923879533f);
+    const float32x4_t t821 = vsubq_f32(t819, t820);
+    const float32x4_t t755 = vaddq_f32(t742, t747);
+    const float32x4_t t825 = vmulq_n_f32(t755, 0.923879533f);
+    const float32x4_t t756 = vsubq_f32(t743, t746);
+    const float32x4_t t827 = vmulq_n_f32(t756, 0.382683432f);
+    const float32x4_t t829 = vsubq_f32(t825, t827);
+    const float32x4_t t837 = vsubq_f32(t821, t829);
+    const float32x4_t t841 = vaddq_f32(t719, t837);
+    const float32x4_t t1106 = vmulq_n_f32(t841, 0.956940336f);
+    const float32x4_t t677 = vsubq_f32(t664, t667);
+    const float32x4_t t712 = vaddq_f32(t700, t704);
+    const float32x4_t t720 = vaddq_f32(t677, t712);
+    const float32x4_t t822 = vmulq_n_f32(t738, 0.923879533f);
+    const float32x4_t t823 = vmulq_n_f32(t739, 0.382683432f);
+    const float32x4_t t824 = vaddq_f32(t822, t823);
+    const float32x4_t t831 = vmulq_n_f32(t755, 0.382683432f);
+    const float32x4_t t833 = vmulq_n_f32(t756, 0.923879533f);
+    const float32x4_t t835 = vaddq_f32(t831, t833);
+    const float32x4_t t838 = vsubq_f32(t824, t835);
+    const float32x4_t t842 = vaddq_f32(t720, t838);
+    const float32x4_t t1107 = vmulq_n_f32(t842, 0.290284677f);
+    const float32x4_t t1108 = vsubq_f32(t1106, t1107);
+    const float32x4_t t865 = vaddq_f32(t852, t857);
+    const float32x4_t t902 = vsubq_f32(t891, t897);
+    const float32x4_t t908 = vsubq_f32(t865, t902);
+    const float32x4_t t927 = vaddq_f32(t914, t919);
+    const float32x4_t t1008 = vmulq_n_f32(t927, 0.382683432f);
+    const float32x4_t t928 = vsubq_f32(t915, t918);
+    const float32x4_t t1009 = vmulq_n_f32(t928, 0.923879533f);
+    const float32x4_t t1010 = vsubq_f32(t1008, t1009);
+    const float32x4_t t944 = vaddq_f32(t931, t936);
+    const float32x4_t t1014 = vmulq_n_f32(t944, 0.923879533f);
+    const float32x4_t t945 = vsubq_f32(t932, t935);
+    const float32x4_t t1016 = vmulq_n_f32(t945, 0.382683432f);
+    const float32x4_t t1018 = vsubq_f32(t1014, t1016);
+    const float32x4_t t1026 = vsubq_f32(t1010, t1018);
+    const float32x4_t t1030 = vaddq_f32(t908, t1026);
+    const float32x4_t t1113 = vmulq_n_f32(t1030, 0.634393284f);
+    const float32x4_t t866 = vsubq_f32(t853, t856);
+    const float32x4_t t901 = vaddq_f32(t889, t893);
+    const float32x4_t t909 = vaddq_f32(t866, t901);
+    const float32x4_t t1011 = vmulq_n_f32(t927, 0.923879533f);
+    const float32x4_t t1012 = vmulq_n_f32(t928, 0.382683432f);
+    const float32x4_t t1013 = vaddq_f32(t1011, t1012);
+    const float32x4_t t1020 = vmulq_n_f32(t944, 0.382683432f);
+    const float32x4_t t1022 = vmulq_n_f32(t945, 0.923879533f);
+    const float32x4_t t1024 = vaddq_f32(t1020, t1022);
+    const float32x4_t t1027 = vsubq_f32(t1013, t1024);
+    const float32x4_t t1031 = vaddq_f32(t909, t1027);
+    const float32x4_t t1115 = vmulq_n_f32(t1031, 0.773010453f);
+    const float32x4_t t1116 = vsubq_f32(t1113, t1115);
+    const float32x4_t t1120 = vaddq_f32(t1108, t1116);
+    const float32x4_t t1124 = vaddq_f32(t535, t1120);
+    const float32x4_t t145 = vsubq_f32(t132, t135);
+    const float32x4_t t181 = vaddq_f32(t169, t173);
+    const float32x4_t t189 = vaddq_f32(t145, t181);
+    const float32x4_t t294 = vmulq_n_f32(t207, 0.923879533f);
+    const float32x4_t t295 = vmulq_n_f32(t208, 0.382683432f);
+    const float32x4_t t296 = vaddq_f32(t294, t295);
+    const float32x4_t t305 = vmulq_n_f32(t224, 0.382683432f);
+    const float32x4_t t307 = vmulq_n_f32(t225, 0.923879533f);
+    const float32x4_t t309 = vaddq_f32(t305, t307);
+    const float32x4_t t312 = vsubq_f32(t296, t309);
+    const float32x4_t t316 = vaddq_f32(t189, t312);
+    const float32x4_t t518 = vmulq_n_f32(t382, 0.555570233f);
+    const float32x4_t t519 = vmulq_n_f32(t383, 0.831469612f);
+    const float32x4_t t520 = vaddq_f32(t518, t519);
+    const float32x4_t t527 = vmulq_n_f32(t444, 0.980785280f);
+    const float32x4_t t528 = vmulq_n_f32(t445, 0.195090322f);
+    const float32x4_t t530 = vsubq_f32(t527, t528);
+    const float32x4_t t532 = vaddq_f32(t520, t530);
+    const float32x4_t t536 = vaddq_f32(t316, t532);
+    const float32x4_t t1109 = vmulq_n_f32(t841, 0.290284677f);
+    const float32x4_t t1110 = vmulq_n_f32(t842, 0.956940336f);
+    const float32x4_t t1111 = vaddq_f32(t1109, t1110);
+    const float32x4_t t1117 = vmulq_n_f32(t1030, 0.773010453f);
+    const float32x4_t t1118 = vmulq_n_f32(t1031, 0.634393284f);
+    const float32x4_t t1119 = vaddq_f32(t1117, t1118);
+    const float32x4_t t1121 = vaddq_f32(t1111, t1119);
+    const float32x4_t t1125 = vaddq_f32(t536, t1121);
+    const float32x4_t t160 = vsubq_f32(t137, t154);
+    const float32x4_t t229 = vsubq_f32(t201, t218);
+    const float32x4_t t235 = vsubq_f32(t160, t229);
+    const float32x4_t t355 = vsubq_f32(t332, t349);
+    const float32x4_t t356 = vsubq_f32(t333, t350);
+    const float32x4_t t544 = vsubq_f32(t355, t356);
+    const float32x4_t t545 = vmulq_n_f32(t544, 0.707106781f);
+    const float32x4_t t417 = vsubq_f32(t394, t411);
+    const float32x4_t t418 = vsubq_f32(t395, t412);
+    const float32x4_t t548 = vaddq_f32(t417, t418);
+    const float32x4_t t549 = vmulq_n_f32(t548, 0.707106781f);
+    const float32x4_t t555 = vsubq_f32(t545, t549);
+    const float32x4_t t559 = vaddq_f32(t235, t555);
+    const float32x4_t t692 = vsubq_f32(t669, t686);
+    const float32x4_t t760 = vsubq_f32(t732, t749);
+    const float32x4_t t766 = vsubq_f32(t692, t760);
+    const float32x4_t t1133 = vmulq_n_f32(t766, 0.923879533f);
+    const float32x4_t t693 = vsubq_f32(t670, t687);
+    const float32x4_t t759 = vsubq_f32(t731, t748);
+    const float32x4_t t767 = vaddq_f32(t693, t759);
+    const float32x4_t t1134 = vmulq_n_f32(t767, 0.382683432f);
+    const float32x4_t t1135 = vsubq_f32(t1133, t1134);
+    const float32x4_t t881 = vsubq_f32(t858, t875);
+    const float32x4_t t949 = vsubq_f32(t921, t938);
+    const float32x4_t t955 = vsubq_f32(t881, t949);
+    const float32x4_t t1139 = vmulq_n_f32(t955, 0.382683432f);
+    const float32x4_t t882 = vsubq_f32(t859, t876);
+    const float32x4_t t948 = vsubq_f32(t920, t937);
+    const float32x4_t t956 = vaddq_f32(t882, t948);
+    const float32x4_t t1140 = vmulq_n_f32(t956, 0.923879533f);
+    const float32x4_t t1141 = vsubq_f32(t1139, t1140);
+    const float32x4_t t1145 = vaddq_f32(t1135, t1141);
+    const float32x4_t t1149 = vaddq_f32(t559, t1145);
+    const float32x4_t t161 = vsubq_f32(t138, t155);
+    const float32x4_t t228 = vsubq_f32(t200, t217);
+    const float32x4_t t236 = vaddq_f32(t161, t228);
+    const float32x4_t t546 = vaddq_f32(t355, t356);
+    const float32x4_t t547 = vmulq_n_f32(t546, 0.707106781f);
+    const float32x4_t t551 = vsubq_f32(t417, t418);
+    const float32x4_t t553 = vmulq_n_f32(t551, 0.707106781f);
+    const float32x4_t t556 = vaddq_f32(t547, t553);
+    const float32x4_t t560 = vaddq_f32(t236, t556);
+    const float32x4_t t1136 = vmulq_n_f32(t766, 0.382683432f);
+    const float32x4_t t1137 = vmulq_n_f32(t767, 0.923879533f);
+    const float32x4_t t1138 = vaddq_f32(t1136, t1137);
+    const float32x4_t t1142 = vmulq_n_f32(t955, 0.923879533f);
+    const float32x4_t t1143 = vmulq_n_f32(t956, 0.382683432f);
+    const float32x4_t t1144 = vaddq_f32(t1142, t1143);
+    const float32x4_t t1146 = vaddq_f32(t1138, t1144);
+    const float32x4_t t1150 = vaddq_f32(t560, t1146);
+    const float32x4_t t185 = vsubq_f32(t142, t179);
+    const float32x4_t t257 = vsubq_f32(t246, t253);
+    const float32x4_t t263 = vsubq_f32(t185, t257);
+    const float32x4_t t379 = vsubq_f32(t337, t373);
+    const float32x4_t t569 = vmulq_n_f32(t379, 0.555570233f);
+    const float32x4_t t380 = vsubq_f32(t338, t374);
+    const float32x4_t t570 = vmulq_n_f32(t380, 0.831469612f);
+    const float32x4_t t571 = vsubq_f32(t569, t570);
+    const float32x4_t t441 = vsubq_f32(t399, t435);
+    const float32x4_t t575 = vmulq_n_f32(t441, 0.980785280f);
+    const float32x4_t t442 = vsubq_f32(t400, t436);
+    const float32x4_t t578 = vmulq_n_f32(t442, 0.195090322f);
+    const float32x4_t t579 = vaddq_f32(t575, t578);
+    const float32x4_t t585 = vsubq_f32(t571, t579);
+    const float32x4_t t589 = vaddq_f32(t263, t585);
+    const float32x4_t t716 = vsubq_f32(t674, t710);
+    const float32x4_t t785 = vsubq_f32(t775, t781);
+    const float32x4_t t791 = vsubq_f32(t716, t785);
+    const float32x4_t t1159 = vmulq_n_f32(t791, 0.881921264f);
+    const float32x4_t t717 = vsubq_f32(t675, t711);
+    const float32x4_t t784 = vsubq_f32(t772, t778);
+    const float32x4_t t792 = vaddq_f32(t717, t784);
+    const float32x4_t t1161 = vmulq_n_f32(t792, 0.471396737f);
+    const float32x4_t t1162 = vsubq_f32(t1159, t1161);
+    const float32x4_t t905 = vsubq_f32(t863, t899);
+    const float32x4_t t974 = vsubq_f32(t964, t970);
+    const float32x4_t t980 = vsubq_f32(t905, t974);
+    const float32x4_t t1167 = vmulq_n_f32(t980, 0.098017140f);
+    const float32x4_t t906 = vsubq_f32(t864, t900);
+    const float32x4_t t973 = vsubq_f32(t961, t967);
+    const float32x4_t t981 = vaddq_f32(t906, t973);
+    const float32x4_t t1169 = vmulq_n_f32(t981, 0.995184727f);
+    const float32x4_t t1170 = vsubq_f32(t1167, t1169);
+    const float32x4_t t1174 = vaddq_f32(t1162, t1170);
+    const float32x4_t t1178 = vaddq_f32(t589, t1174);
+    const float32x4_t t186 = vsubq_f32(t143, t180);
+    const float32x4_t t256 = vsubq_f32(t243, t250);
+    const float32x4_t t264 = vaddq_f32(t186, t256);
+    const float32x4_t t572 = vmulq_n_f32(t379, 0.831469612f);
+    const float32x4_t t573 = vmulq_n_f32(t380, 0.555570233f);
+    const float32x4_t t574 = vaddq_f32(t572, t573);
+    const float32x4_t t581 = vmulq_n_f32(t441, 0.195090322f);
+    const float32x4_t t582 = vmulq_n_f32(t442, 0.980785280f);
+    const float32x4_t t584 = vsubq_f32(t581, t582);
+    const float32x4_t t586 = vaddq_f32(t574, t584);
+    const float32x4_t t590 = vaddq_f32(t264, t586);
+    const float32x4_t t1163 = vmulq_n_f32(t791, 0.471396737f);
+    const float32x4_t t1164 = vmulq_n_f32(t792, 0.881921264f);
+    const float32x4_t t1165 = vaddq_f32(t1163, t1164);
+    const float32x4_t t1171 = vmulq_n_f32(t980, 0.995184727f);
+    const float32x4_t t1172 = vmulq_n_f32(t981, 0.098017140f);
+    const float32x4_t t1173 = vaddq_f32(t1171, t1172);
+    const float32x4_t t1175 = vaddq_f32(t1165, t1173);
+    const float32x4_t t1179 = vaddq_f32(t590, t1175);
+    const float32x4_t t165 = vaddq_f32(t139, t157);
+    const float32x4_t t281 = vsubq_f32(t270, t276);
+    const float32x4_t t287 = vsubq_f32(t165, t281);
+    const float32x4_t t360 = vaddq_f32(t334, t352);
+    const float32x4_t t598 = vmulq_n_f32(t360, 0.382683432f);
+    const float32x4_t t361 = vsubq_f32(t335, t351);
+    const float32x4_t t599 = vmulq_n_f32(t361, 0.923879533f);
+    const float32x4_t t600 = vsubq_f32(t598, t599);
+    const float32x4_t t422 = vaddq_f32(t396, t414);
+    const float32x4_t t604 = vmulq_n_f32(t422, 0.923879533f);
+    const float32x4_t t423 = vsubq_f32(t397, t413);
+    const float32x4_t t606 = vmulq_n_f32(t423, 0.382683432f);
+    const float32x4_t t608 = vsubq_f32(t604, t606);
+    const float32x4_t t616 = vsubq_f32(t600, t608);
+    const float32x4_t t620 = vaddq_f32(t287, t616);
+    const float32x4_t t697 = vaddq_f32(t671, t689);
+    const float32x4_t t809 = vsubq_f32(t798, t804);
+    const float32x4_t t815 = vsubq_f32(t697, t809);
+    const float32x4_t t1187 = vmulq_n_f32(t815, 0.831469612f);
+    const float32x4_t t698 = vsubq_f32(t672, t688);
+    const float32x4_t t808 = vaddq_f32(t796, t800);
+    const float32x4_t t816 = vaddq_f32(t698, t808);
+    const float32x4_t t1188 = vmulq_n_f32(t816, 0.555570233f);
+    const float32x4_t t1189 = vsubq_f32(t1187, t1188);
+    const float32x4_t t886 = vaddq_f32(t860, t878);
+    const float32x4_t t998 = vsubq_f32(t987, t993);
+    const float32x4_t t1004 = vsubq_f32(t886, t998);
+    const float32x4_t t1193 = vmulq_n_f32(t1004, 0.195090322f);
+    const float32x4_t t887 = vsubq_f32(t861, t877);
+    const float32x4_t t997 = vaddq_f32(t985, t989);
+    const float32x4_t t1005 = vaddq_f32(t887, t997);
+    const float32x4_t t1195 = vmulq_n_f32(t1005, 0.980785280f);
+    const float32x4_t t1196 = vaddq_f32(t1193, t1195);
+    const float32x4_t t1202 = vsubq_f32(t1189, t1196);
+    const float32x4_t t1206 = vaddq_f32(t620, t1202);
+    const float32x4_t t166 = vsubq_f32(t140, t156);
+    const float32x4_t t280 = vaddq_f32(t268, t272);
+    const float32x4_t t288 = vaddq_f32(t166, t280);
+    const float32x4_t t601 = vmulq_n_f32(t360, 0.923879533f);
+    const float32x4_t t602 = vmulq_n_f32(t361, 0.382683432f);
+    const float32x4_t t603 = vaddq_f32(t601, t602);
+    const float32x4_t t610 = vmulq_n_f32(t422, 0.382683432f);
+    const float32x4_t t612 = vmulq_n_f32(t423, 0.923879533f);
+    const float32x4_t t614 = vaddq_f32(t610, t612);
+    const float32x4_t t617 = vsubq_f32(t603, t614);
+    const float32x4_t t621 = vaddq_f32(t288, t617);
+    const float32x4_t t1190 = vmulq_n_f32(t815, 0.555570233f);
+    const float32x4_t t1191 = vmulq_n_f32(t816, 0.831469612f);
+    const float32x4_t t1192 = vaddq_f32(t1190, t1191);
+    const float32x4_t t1198 = vmulq_n_f32(t1004, 0.980785280f);
+    const float32x4_t t1199 = vmulq_n_f32(t1005, 0.195090322f);
+    const float32x4_t t1201 = vsubq_f32(t1198, t1199);
+    const float32x4_t t1203 = vaddq_f32(t1192, t1201);
+    const float32x4_t t1207 = vaddq_f32(t621, t1203);
+    const float32x4_t t190 = vaddq_f32(t144, t182);
+    const float32x4_t t314 = vaddq_f32(t296, t309);
+    const float32x4_t t320 = vsubq_f32(t190, t314);
+    const float32x4_t t384 = vaddq_f32(t339, t376);
+    const float32x4_t t630 = vmulq_n_f32(t384, 0.195090322f);
+    const float32x4_t t385 = vsubq_f32(t340, t375);
+    const float32x4_t t631 = vmulq_n_f32(t385, 0.980785280f);
+    const float32x4_t t632 = vsubq_f32(t630, t631);
+    const float32x4_t t446 = vaddq_f32(t401, t438);
+    const float32x4_t t636 = vmulq_n_f32(t446, 0.555570233f);
+    const float32x4_t t447 = vsubq_f32(t402, t437);
+    const float32x4_t t638 = vmulq_n_f32(t447, 0.831469612f);
+    const float32x4_t t640 = vsubq_f32(t636, t638);
+    const float32x4_t t648 = vsubq_f32(t632, t640);
+    const float32x4_t t652 = vaddq_f32(t320, t648);
+    const float32x4_t t721 = vaddq_f32(t676, t713);
+    const float32x4_t t840 = vaddq_f32(t824, t835);
+    const float32x4_t t846 = vsubq_f32(t721, t840);
+    const float32x4_t t1215 = vmulq_n_f32(t846, 0.773010453f);
+    const float32x4_t t722 = vsubq_f32(t677, t712);
+    const float32x4_t t839 = vaddq_f32(t821, t829);
+    const float32x4_t t847 = vaddq_f32(t722, t839);
+    const float32x4_t t1216 = vmulq_n_f32(t847, 0.634393284f);
+    const float32x4_t t1217 = vsubq_f32(t1215, t1216);
+    const float32x4_t t910 = vaddq_f32(t865, t902);
+    const float32x4_t t1029 = vaddq_f32(t1013, t1024);
+    const float32x4_t t1035 = vsubq_f32(t910, t1029);
+    const float32x4_t t1222 = vmulq_n_f32(t1035, 0.471396737f);
+    const float32x4_t t911 = vsubq_f32(t866, t901);
+    const float32x4_t t1028 = vaddq_f32(t1010, t1018);
+    const float32x4_t t1036 = vaddq_f32(t911, t1028);
+    const float32x4_t t1224 = vmulq_n_f32(t1036, 0.881921264f);
+    const float32x4_t t1225 = vaddq_f32(t1222, t1224);
+    const float32x4_t t1231 = vsubq_f32(t1217, t1225);
+    const float32x4_t t1235 = vaddq_f32(t652, t1231);
+    const float32x4_t t191 = vsubq_f32(t145, t181);
+    const float32x4_t t313 = vaddq_f32(t293, t303);
+    const float32x4_t t321 = vaddq_f32(t191, t313);
+    const float32x4_t t633 = vmulq_n_f32(t384, 0.980785280f);
+    const float32x4_t t634 = vmulq_n_f32(t385, 0.195090322f);
+    const float32x4_t t635 = vaddq_f32(t633, t634);
+    const float32x4_t t642 = vmulq_n_f32(t446, 0.831469612f);
+    const float32x4_t t644 = vmulq_n_f32(t447, 0.555570233f);
+    const float32x4_t t646 = vaddq_f32(t642, t644);
+    const float32x4_t t649 = vsubq_f32(t635, t646);
+    const float32x4_t t653 = vaddq_f32(t321, t649);
+    const float32x4_t t1218 = vmulq_n_f32(t846, 0.634393284f);
+    const float32x4_t t1219 = vmulq_n_f32(t847, 0.773010453f);
+    const float32x4_t t1220 = vaddq_f32(t1218, t1219);
+    const float32x4_t t1227 = vmulq_n_f32(t1035, 0.881921264f);
+    const float32x4_t t1228 = vmulq_n_f32(t1036, 0.471396737f);
+    const float32x4_t t1230 = vsubq_f32(t1227, t1228);
+    const float32x4_t t1232 = vaddq_f32(t1220, t1230);
+    const float32x4_t t1236 = vaddq_f32(t653, t1232);
+    const float32x4_t t232 = vsubq_f32(t158, t226);
+    const float32x4_t t451 = vsubq_f32(t354, t416);
+    const float32x4_t t457 = vsubq_f32(t232, t451);
+    const float32x4_t t763 = vsubq_f32(t690, t757);
+    const float32x4_t t764 = vsubq_f32(t691, t758);
+    const float32x4_t t1244 = vsubq_f32(t763, t764);
+    const float32x4_t t1245 = vmulq_n_f32(t1244, 0.707106781f);
+    const float32x4_t t952 = vsubq_f32(t879, t946);
+    const float32x4_t t953 = vsubq_f32(t880, t947);
+    const float32x4_t t1248 = vaddq_f32(t952, t953);
+    const float32x4_t t1249 = vmulq_n_f32(t1248, 0.707106781f);
+    const float32x4_t t1255 = vsubq_f32(t1245, t1249);
+    const float32x4_t t1259 = vaddq_f32(t457, t1255);
+    const float32x4_t t233 = vsubq_f32(t159, t227);
+    const float32x4_t t450 = vsubq_f32(t353, t415);
+    const float32x4_t t458 = vaddq_f32(t233, t450);
+    const float32x4_t t1246 = vaddq_f32(t763, t764);
+    const float32x4_t t1247 = vmulq_n_f32(t1246, 0.707106781f);
+    const float32x4_t t1251 = vsubq_f32(t952, t953);
+    const float32x4_t t1253 = vmulq_n_f32(t1251, 0.707106781f);
+    const float32x4_t t1256 = vaddq_f32(t1247, t1253);
+    const float32x4_t t1260 = vaddq_f32(t458, t1256);
+    const float32x4_t t260 = vsubq_f32(t183, t254);
+    const float32x4_t t480 = vsubq_f32(t468, t476);
+    const float32x4_t t486 = vsubq_f32(t260, t480);
+    const float32x4_t t788 = vsubq_f32(t714, t782);
+    const float32x4_t t1268 = vmulq_n_f32(t788, 0.634393284f);
+    const float32x4_t t789 = vsubq_f32(t715, t783);
+    const float32x4_t t1269 = vmulq_n_f32(t789, 0.773010453f);
+    const float32x4_t t1270 = vsubq_f32(t1268, t1269);
+    const float32x4_t t977 = vsubq_f32(t903, t971);
+    const float32x4_t t1275 = vmulq_n_f32(t977, 0.881921264f);
+    const float32x4_t t978 = vsubq_f32(t904, t972);
+    const float32x4_t t1278 = vmulq_n_f32(t978, 0.471396737f);
+    const float32x4_t t1279 = vaddq_f32(t1275, t1278);
+    const float32x4_t t1285 = vsubq_f32(t1270, t1279);
+    const float32x4_t t1289 = vaddq_f32(t486, t1285);
+    const float32x4_t t261 = vsubq_f32(t184, t255);
+    const float32x4_t t479 = vsubq_f32(t465, t473);
+    const float32x4_t t487 = vaddq_f32(t261, t479);
+    const float32x4_t t1271 = vmulq_n_f32(t788, 0.773010453f);
+    const float32x4_t t1272 = vmulq_n_f32(t789, 0.634393284f);
+    const float32x4_t t1273 = vaddq_f32(t1271, t1272);
+    const float32x4_t t1281 = vmulq_n_f32(t977, 0.471396737f);
+    const float32x4_t t1282 = vmulq_n_f32(t978, 0.881921264f);
+    const float32x4_t t1284 = vsubq_f32(t1281, t1282);
+    const float32x4_t t1286 = vaddq_f32(t1273, t1284);
+    const float32x4_t t1290 = vaddq_f32(t487, t1286);
+    const float32x4_t t284 = vsubq_f32(t163, t278);
+    const float32x4_t t505 = vsubq_f32(t495, t501);
+    const float32x4_t t511 = vsubq_f32(t284, t505);
+    const float32x4_t t812 = vsubq_f32(t695, t806);
+    const float32x4_t t1298 = vmulq_n_f32(t812, 0.555570233f);
+    const float32x4_t t813 = vsubq_f32(t696, t807);
+    const float32x4_t t1299 = vmulq_n_f32(t813, 0.831469612f);
+    const float32x4_t t1300 = vsubq_f32(t1298, t1299);
+    const float32x4_t t1001 = vsubq_f32(t884, t995);
+    const float32x4_t t1304 = vmulq_n_f32(t1001, 0.980785280f);
+    const float32x4_t t1002 = vsubq_f32(t885, t996);
+    const float32x4_t t1306 = vmulq_n_f32(t1002, 0.195090322f);
+    const float32x4_t t1307 = vaddq_f32(t1304, t1306);
+    const float32x4_t t1313 = vsubq_f32(t1300, t1307);
+    const float32x4_t t1317 = vaddq_f32(t511, t1313);
+    const float32x4_t t285 = vsubq_f32(t164, t279);
+    const float32x4_t t504 = vsubq_f32(t492, t498);
+    const float32x4_t t512 = vaddq_f32(t285, t504);
+    const float32x4_t t1301 = vmulq_n_f32(t812, 0.831469612f);
+    const float32x4_t t1302 = vmulq_n_f32(t813, 0.555570233f);
+    const float32x4_t t1303 = vaddq_f32(t1301, t1302);
+    const float32x4_t t1309 = vmulq_n_f32(t1001, 0.195090322f);
+    const float32x4_t t1310 = vmulq_n_f32(t1002, 0.980785280f);
+    const float32x4_t t1312 = vsubq_f32(t1309, t1310);
+    const float32x4_t t1314 = vaddq_f32(t1303, t1312);
+    const float32x4_t t1318 = vaddq_f32(t512, t1314);
+    const float32x4_t t317 = vsubq_f32(t188, t311);
+    const float32x4_t t534 = vsubq_f32(t520, t530);
+    const float32x4_t t540 = vsubq_f32(t317, t534);
+    const float32x4_t t843 = vsubq_f32(t719, t837);
+    const float32x4_t t1327 = vmulq_n_f32(t843, 0.471396737f);
+    const float32x4_t t844 = vsubq_f32(t720, t838);
+    const float32x4_t t1328 = vmulq_n_f32(t844, 0.881921264f);
+    const float32x4_t t1329 = vsubq_f32(t1327, t1328);
+    const float32x4_t t1032 = vsubq_f32(t908, t1026);
+    const float32x4_t t1333 = vmulq_n_f32(t1032, 0.995184727f);
+    const float32x4_t t1033 = vsubq_f32(t909, t1027);
+    const float32x4_t t1336 = vmulq_n_f32(t1033, 0.098017140f);
+    const float32x4_t t1338 = vsubq_f32(t1333, t1336);
+    const float32x4_t t1346 = vsubq_f32(t1329, t1338);
+    const float32x4_t t1350 = vaddq_f32(t540, t1346);
+    const float32x4_t t318 = vsubq_f32(t189, t312);
+    const float32x4_t t533 = vaddq_f32(t517, t525);
+    const float32x4_t t541 = vaddq_f32(t318, t533);
+    const float32x4_t t1330 = vmulq_n_f32(t843, 0.881921264f);
+    const float32x4_t t1331 = vmulq_n_f32(t844, 0.471396737f);
+    const float32x4_t t1332 = vaddq_f32(t1330, t1331);
+    const float32x4_t t1340 = vmulq_n_f32(t1032, 0.098017140f);
+    const float32x4_t t1342 = vmulq_n_f32(t1033, 0.995184727f);
+    const float32x4_t t1344 = vaddq_f32(t1340, t1342);
+    const float32x4_t t1347 = vsubq_f32(t1332, t1344);
+    const float32x4_t t1351 = vaddq_f32(t541, t1347);
+    const float32x4_t t237 = vaddq_f32(t160, t229);
+    const float32x4_t t558 = vsubq_f32(t547, t553);
+    const float32x4_t t564 = vsubq_f32(t237, t558);
+    const float32x4_t t768 = vaddq_f32(t692, t760);
+    const float32x4_t t1359 = vmulq_n_f32(t768, 0.382683432f);
+    const float32x4_t t769 = vsubq_f32(t693, t759);
+    const float32x4_t t1360 = vmulq_n_f32(t769, 0.923879533f);
+    const float32x4_t t1361 = vsubq_f32(t1359, t1360);
+    const float32x4_t t957 = vaddq_f32(t881, t949);
+    const float32x4_t t1365 = vmulq_n_f32(t957, 0.923879533f);
+    const float32x4_t t958 = vsubq_f32(t882, t948);
+    const float32x4_t t1367 = vmulq_n_f32(t958, 0.382683432f);
+    const float32x4_t t1369 = vsubq_f32(t1365, t1367);
+    const float32x4_t t1377 = vsubq_f32(t1361, t1369);
+    const float32x4_t t1381 = vaddq_f32(t564, t1377);
+    const float32x4_t t238 = vsubq_f32(t161, t228);
+    const float32x4_t t557 = vaddq_f32(t545, t549);
+    const float32x4_t t565 = vaddq_f32(t238, t557);
+    const float32x4_t t1362 = vmulq_n_f32(t768, 0.923879533f);
+    const float32x4_t t1363 = vmulq_n_f32(t769, 0.382683432f);
+    const float32x4_t t1364 = vaddq_f32(t1362, t1363);
+    const float32x4_t t1371 = vmulq_n_f32(t957, 0.382683432f);
+    const float32x4_t t1373 = vmulq_n_f32(t958, 0.923879533f);
+    const float32x4_t t1375 = vaddq_f32(t1371, t1373);
+    const float32x4_t t1378 = vsubq_f32(t1364, t1375);
+    const float32x4_t t1382 = vaddq_f32(t565, t1378);
+    const float32x4_t t265 = vaddq_f32(t185, t257);
+    const float32x4_t t588 = vsubq_f32(t574, t584);
+    const float32x4_t t594 = vsubq_f32(t265, t588);
+    const float32x4_t t793 = vaddq_f32(t716, t785);
+    const float32x4_t t1390 = vmulq_n_f32(t793, 0.290284677f);
+    const float32x4_t t794 = vsubq_f32(t717, t784);
+    const float32x4_t t1392 = vmulq_n_f32(t794, 0.956940336f);
+    const float32x4_t t1393 = vsubq_f32(t1390, t1392);
+    const float32x4_t t982 = vaddq_f32(t905, t974);
+    const float32x4_t t1398 = vmulq_n_f32(t982, 0.773010453f);
+    const float32x4_t t983 = vsubq_f32(t906, t973);
+    const float32x4_t t1401 = vmulq_n_f32(t983, 0.634393284f);
+    const float32x4_t t1403 = vsubq_f32(t1398, t1401);
+    const float32x4_t t1411 = vsubq_f32(t1393, t1403);
+    const float32x4_t t1415 = vaddq_f32(t594, t1411);
+    const float32x4_t t266 = vsubq_f32(t186, t256);
+    const float32x4_t t587 = vaddq_f32(t571, t579);
+    const float32x4_t t595 = vaddq_f32(t266, t587);
+    const float32x4_t t1394 = vmulq_n_f32(t793, 0.956940336f);
+    const float32x4_t t1395 = vmulq_n_f32(t794, 0.290284677f);
+    const float32x4_t t1396 = vaddq_f32(t1394, t1395);
+    const float32x4_t t1405 = vmulq_n_f32(t982, 0.634393284f);
+    const float32x4_t t1407 = vmulq_n_f32(t983, 0.773010453f);
+    const float32x4_t t1409 = vaddq_f32(t1405, t1407);
+    const float32x4_t t1412 = vsubq_f32(t1396, t1409);
+    const float32x4_t t1416 = vaddq_f32(t595, t1412);
+    const float32x4_t t289 = vaddq_f32(t165, t281);
+    const float32x4_t t619 = vaddq_f32(t603, t614);
+    const float32x4_t t625 = vsubq_f32(t289, t619);
+    const float32x4_t t817 = vaddq_f32(t697, t809);
+    const float32x4_t t1424 = vmulq_n_f32(t817, 0.195090322f);
+    const float32x4_t t818 = vsubq_f32(t698, t808);
+    const float32x4_t t1425 = vmulq_n_f32(t818, 0.980785280f);
+    const float32x4_t t1426 = vsubq_f32(t1424, t1425);
+    const float32x4_t t1006 = vaddq_f32(t886, t998);
+    const float32x4_t t1430 = vmulq_n_f32(t1006, 0.555570233f);
+    const float32x4_t t1007 = vsubq_f32(t887, t997);
+    const float32x4_t t1432 = vmulq_n_f32(t1007, 0.831469612f);
+    const float32x4_t t1434 = vsubq_f32(t1430, t1432);
+    const float32x4_t t1442 = vsubq_f32(t1426, t1434);
+    const float32x4_t t1446 = vaddq_f32(t625, t1442);
+    const float32x4_t t290 = vsubq_f32(t166, t280);
+    const float32x4_t t618 = vaddq_f32(t600, t608);
+    const float32x4_t t626 = vaddq_f32(t290, t618);
+    const float32x4_t t1427 = vmulq_n_f32(t817, 0.980785280f);
+    const float32x4_t t1428 = vmulq_n_f32(t818, 0.195090322f);
+    const float32x4_t t1429 = vaddq_f32(t1427, t1428);
+    const float32x4_t t1436 = vmulq_n_f32(t1006, 0.831469612f);
+    const float32x4_t t1438 = vmulq_n_f32(t1007, 0.555570233f);
+    const float32x4_t t1440 = vaddq_f32(t1436, t1438);
+    const float32x4_t t1443 = vsubq_f32(t1429, t1440);
+    const float32x4_t t1447 = vaddq_f32(t626, t1443);
+    const float32x4_t t322 = vaddq_f32(t190, t314);
+    const float32x4_t t651 = vaddq_f32(t635, t646);
+    const float32x4_t t657 = vsubq_f32(t322, t651);
+    const float32x4_t t848 = vaddq_f32(t721, t840);
+    const float32x4_t t1455 = vmulq_n_f32(t848, 0.098017140f);
+    const float32x4_t t849 = vsubq_f32(t722, t839);
+    const float32x4_t t1456 = vmulq_n_f32(t849, 0.995184727f);
+    const float32x4_t t1457 = vsubq_f32(t1455, t1456);
+    const float32x4_t t1037 = vaddq_f32(t910, t1029);
+    const float32x4_t t1462 = vmulq_n_f32(t1037, 0.290284677f);
+    const float32x4_t t1038 = vsubq_f32(t911, t1028);
+    const float32x4_t t1464 = vmulq_n_f32(t1038, 0.956940336f);
+    const float32x4_t t1466 = vsubq_f32(t1462, t1464);
+    const float32x4_t t1474 = vsubq_f32(t1457, t1466);
+    const float32x4_t t1478 = vaddq_f32(t657, t1474);
+    const float32x4_t t323 = vsubq_f32(t191, t313);
+    const float32x4_t t650 = vaddq_f32(t632, t640);
+    const float32x4_t t658 = vaddq_f32(t323, t650);
+    const float32x4_t t1458 = vmulq_n_f32(t848, 0.995184727f);
+    const float32x4_t t1459 = vmulq_n_f32(t849, 0.098017140f);
+    const float32x4_t t1460 = vaddq_f32(t1458, t1459);
+    const float32x4_t t1468 = vmulq_n_f32(t1037, 0.956940336f);
+    const float32x4_t t1470 = vmulq_n_f32(t1038, 0.290284677f);
+    const float32x4_t t1472 = vaddq_f32(t1468, t1470);
+    const float32x4_t t1475 = vsubq_f32(t1460, t1472);
+    const float32x4_t t1479 = vaddq_f32(t658, t1475);
+    const float32x4_t t454 = vsubq_f32(t230, t448);
+    const float32x4_t t1042 = vsubq_f32(t762, t951);
+    const float32x4_t t1048 = vsubq_f32(t454, t1042);
+    const float32x4_t t455 = vsubq_f32(t231, t449);
+    const float32x4_t t1041 = vsubq_f32(t761, t950);
+    const float32x4_t t1049 = vaddq_f32(t455, t1041);
+    const float32x4_t t483 = vsubq_f32(t258, t477);
+    const float32x4_t t1071 = vsubq_f32(t1059, t1067);
+    const float32x4_t t1077 = vsubq_f32(t483, t1071);
+    const float32x4_t t484 = vsubq_f32(t259, t478);
+    const float32x4_t t1070 = vsubq_f32(t1056, t1064);
+    const float32x4_t t1078 = vaddq_f32(t484, t1070);
+    const float32x4_t t508 = vsubq_f32(t282, t502);
+    const float32x4_t t1096 = vsubq_f32(t1086, t1092);
+    const float32x4_t t1102 = vsubq_f32(t508, t1096);
+    const float32x4_t t509 = vsubq_f32(t283, t503);
+    const float32x4_t t1095 = vsubq_f32(t1083, t1089);
+    const float32x4_t t1103 = vaddq_f32(t509, t1095);
+    const float32x4_t t537 = vsubq_f32(t315, t531);
+    const float32x4_t t1123 = vsubq_f32(t1111, t1119);
+    const float32x4_t t1129 = vsubq_f32(t537, t1123);
+    const float32x4_t t538 = vsubq_f32(t316, t532);
+    const float32x4_t t1122 = vsubq_f32(t1108, t1116);
+    const float32x4_t t1130 = vaddq_f32(t538, t1122);
+    const float32x4_t t561 = vsubq_f32(t235, t555);
+    const float32x4_t t1148 = vsubq_f32(t1138, t1144);
+    const float32x4_t t1154 = vsubq_f32(t561, t1148);
+    const float32x4_t t562 = vsubq_f32(t236, t556);
+    const float32x4_t t1147 = vsubq_f32(t1135, t1141);
+    const float32x4_t t1155 = vaddq_f32(t562, t1147);
+    const float32x4_t t591 = vsubq_f32(t263, t585);
+    const float32x4_t t1177 = vsubq_f32(t1165, t1173);
+    const float32x4_t t1183 = vsubq_f32(t591, t1177);
+    const float32x4_t t592 = vsubq_f32(t264, t586);
+    const float32x4_t t1176 = vsubq_f32(t1162, t1170);
+    const float32x4_t t1184 = vaddq_f32(t592, t1176);
+    const float32x4_t t622 = vsubq_f32(t287, t616);
+    const float32x4_t t1205 = vsubq_f32(t1192, t1201);
+    const float32x4_t t1211 = vsubq_f32(t622, t1205);
+    const float32x4_t t623 = vsubq_f32(t288, t617);
+    const float32x4_t t1204 = vaddq_f32(t1189, t1196);
+    const float32x4_t t1212 = vaddq_f32(t623, t1204);
+    const float32x4_t t654 = vsubq_f32(t320, t648);
+    const float32x4_t t1234 = vsubq_f32(t1220, t1230);
+    const float32x4_t t1240 = vsubq_f32(t654, t1234);
+    const float32x4_t t655 = vsubq_f32(t321, t649);
+    const float32x4_t t1233 = vaddq_f32(t1217, t1225);
+    const float32x4_t t1241 = vaddq_f32(t655, t1233);
+    const float32x4_t t459 = vaddq_f32(t232, t451);
+    const float32x4_t t1258 = vsubq_f32(t1247, t1253);
+    const float32x4_t t1264 = vsubq_f32(t459, t1258);
+    const float32x4_t t460 = vsubq_f32(t233, t450);
+    const float32x4_t t1257 = vaddq_f32(t1245, t1249);
+    const float32x4_t t1265 = vaddq_f32(t460, t1257);
+    const float32x4_t t488 = vaddq_f32(t260, t480);
+    const float32x4_t t1288 = vsubq_f32(t1273, t1284);
+    const float32x4_t t1294 = vsubq_f32(t488, t1288);
+    const float32x4_t t489 = vsubq_f32(t261, t479);
+    const float32x4_t t1287 = vaddq_f32(t1270, t1279);
+    const float32x4_t t1295 = vaddq_f32(t489, t1287);
+    const float32x4_t t513 = vaddq_f32(t284, t505);
+    const float32x4_t t1316 = vsubq_f32(t1303, t1312);
+    const float32x4_t t1322 = vsubq_f32(t513, t1316);
+    const float32x4_t t514 = vsubq_f32(t285, t504);
+    const float32x4_t t1315 = vaddq_f32(t1300, t1307);
+    const float32x4_t t1323 = vaddq_f32(t514, t1315);
+    const float32x4_t t542 = vaddq_f32(t317, t534);
+    const float32x4_t t1349 = vaddq_f32(t1332, t1344);
+    const float32x4_t t1355 = vsubq_f32(t542, t1349);
+    const float32x4_t t543 = vsubq_f32(t318, t533);
+    const float32x4_t t1348 = vaddq_f32(t1329, t1338);
+    const float32x4_t t1356 = vaddq_f32(t543, t1348);
+    const float32x4_t t566 = vaddq_f32(t237, t558);
+    const float32x4_t t1380 = vaddq_f32(t1364, t1375);
+    const float32x4_t t1386 = vsubq_f32(t566, t1380);
+    const float32x4_t t567 = vsubq_f32(t238, t557);
+    const float32x4_t t1379 = vaddq_f32(t1361, t1369);
+    const float32x4_t t1387 = vaddq_f32(t567, t1379);
+    const float32x4_t t596 = vaddq_f32(t265, t588);
+    const float32x4_t t1414 = vaddq_f32(t1396, t1409);
+    const float32x4_t t1420 = vsubq_f32(t596, t1414);
+    const float32x4_t t597 = vsubq_f32(t266, t587);
+    const float32x4_t t1413 = vaddq_f32(t1393, t1403);
+    const float32x4_t t1421 = vaddq_f32(t597, t1413);
+    const float32x4_t t627 = vaddq_f32(t289, t619);
+    const float32x4_t t1445 = vaddq_f32(t1429, t1440);
+    const float32x4_t t1451 = vsubq_f32(t627, t1445);
+    const float32x4_t t628 = vsubq_f32(t290, t618);
+    const float32x4_t t1444 = vaddq_f32(t1426, t1434);
+    const float32x4_t t1452 = vaddq_f32(t628, t1444);
+    const float32x4_t t659 = vaddq_f32(t322, t651);
+    const float32x4_t t1477 = vaddq_f32(t1460, t1472);
+    const float32x4_t t1483 = vsubq_f32(t659, t1477);
+    const float32x4_t t660 = vsubq_f32(t323, t650);
+    const float32x4_t t1476 = vaddq_f32(t1457, t1466);
+    const float32x4_t t1484 = vaddq_f32(t660, t1476);
+    const float32x4_t t1045 = vsubq_f32(t452, t1039);
+    const float32x4_t t1046 = vsubq_f32(t453, t1040);
+    const float32x4_t t1074 = vsubq_f32(t481, t1068);
+    const float32x4_t t1075 = vsubq_f32(t482, t1069);
+    const float32x4_t t1099 = vsubq_f32(t506, t1093);
+    const float32x4_t t1100 = vsubq_f32(t507, t1094);
+    const float32x4_t t1126 = vsubq_f32(t535, t1120);
+    const float32x4_t t1127 = vsubq_f32(t536, t1121);
+    const float32x4_t t1151 = vsubq_f32(t559, t1145);
+    const float32x4_t t1152 = vsubq_f32(t560, t1146);
+    const float32x4_t t1180 = vsubq_f32(t589, t1174);
+    const float32x4_t t1181 = vsubq_f32(t590, t1175);
+    const float32x4_t t1208 = vsubq_f32(t620, t1202);
+    const float32x4_t t1209 = vsubq_f32(t621, t1203);
+    const float32x4_t t1237 = vsubq_f32(t652, t1231);
+    const float32x4_t t1238 = vsubq_f32(t653, t1232);
+    const float32x4_t t1261 = vsubq_f32(t457, t1255);
+    const float32x4_t t1262 = vsubq_f32(t458, t1256);
+    const float32x4_t t1291 = vsubq_f32(t486, t1285);
+    const float32x4_t t1292 = vsubq_f32(t487, t1286);
+    const float32x4_t t1319 = vsubq_f32(t511, t1313);
+    const float32x4_t t1320 = vsubq_f32(t512, t1314);
+    const float32x4_t t1352 = vsubq_f32(t540, t1346);
+    const float32x4_t t1353 = vsubq_f32(t541, t1347);
+    const float32x4_t t1383 = vsubq_f32(t564, t1377);
+    const float32x4_t t1384 = vsubq_f32(t565, t1378);
+    const float32x4_t t1417 = vsubq_f32(t594, t1411);
+    const float32x4_t t1418 = vsubq_f32(t595, t1412);
+    const float32x4_t t1448 = vsubq_f32(t625, t1442);
+    const float32x4_t t1449 = vsubq_f32(t626, t1443);
+    const float32x4_t t1480 = vsubq_f32(t657, t1474);
+    const float32x4_t t1481 = vsubq_f32(t658, t1475);
+    const float32x4_t t1050 = vaddq_f32(t454, t1042);
+    const float32x4_t t1051 = vsubq_f32(t455, t1041);
+    const float32x4_t t1079 = vaddq_f32(t483, t1071);
+    const float32x4_t t1080 = vsubq_f32(t484, t1070);
+    const float32x4_t t1104 = vaddq_f32(t508, t1096);
+    const float32x4_t t1105 = vsubq_f32(t509, t1095);
+    const float32x4_t t1131 = vaddq_f32(t537, t1123);
+    const float32x4_t t1132 = vsubq_f32(t538, t1122);
+    const float32x4_t t1156 = vaddq_f32(t561, t1148);
+    const float32x4_t t1157 = vsubq_f32(t562, t1147);
+    const float32x4_t t1185 = vaddq_f32(t591, t1177);
+    const float32x4_t t1186 = vsubq_f32(t592, t1176);
+    const float32x4_t t1213 = vaddq_f32(t622, t1205);
+    const float32x4_t t1214 = vsubq_f32(t623, t1204);
+    const float32x4_t t1242 = vaddq_f32(t654, t1234);
+    const float32x4_t t1243 = vsubq_f32(t655, t1233);
+    const float32x4_t t1266 = vaddq_f32(t459, t1258);
+    const float32x4_t t1267 = vsubq_f32(t460, t1257);
+    const float32x4_t t1296 = vaddq_f32(t488, t1288);
+    const float32x4_t t1297 = vsubq_f32(t489, t1287);
+    const float32x4_t t1324 = vaddq_f32(t513, t1316);
+    const float32x4_t t1325 = vsubq_f32(t514, t1315);
+    const float32x4_t t1357 = vaddq_f32(t542, t1349);
+    const float32x4_t t1358 = vsubq_f32(t543, t1348);
+    const float32x4_t t1388 = vaddq_f32(t566, t1380);
+    const float32x4_t t1389 = vsubq_f32(t567, t1379);
+    const float32x4_t t1422 = vaddq_f32(t596, t1414);
+    const float32x4_t t1423 = vsubq_f32(t597, t1413);
+    const float32x4_t t1453 = vaddq_f32(t627, t1445);
+    const float32x4_t t1454 = vsubq_f32(t628, t1444);
+    const float32x4_t t1485 = vaddq_f32(t659, t1477);
+    const float32x4_t t1486 = vsubq_f32(t660, t1476);
+    store4(output + 0, 64, t1043, t1044, t1072, t1073, t1097, t1098, t1124, t1125);
+    store4(output + 4, 64, t1149, t1150, t1178, t1179, t1206, t1207, t1235, t1236);
+    store4(output + 8, 64, t1259, t1260, t1289, t1290, t1317, t1318, t1350, t1351);
+    store4(output + 12, 64, t1381, t1382, t1415, t1416, t1446, t1447, t1478, t1479);
+    store4(output + 16, 64, t1048, t1049, t1077, t1078, t1102, t1103, t1129, t1130);
+    store4(output + 20, 64, t1154, t1155, t1183, t1184, t1211, t1212, t1240, t1241);
+    store4(output + 24, 64, t1264, t1265, t1294, t1295, t1322, t1323, t1355, t1356);
+    store4(output + 28, 64, t1386, t1387, t1420, t1421, t1451, t1452, t1483, t1484);
+    store4(output + 32, 64, t1045, t1046, t1074, t1075, t1099, t1100, t1126, t1127);
+    store4(output + 36, 64, t1151, t1152, t1180, t1181, t1208, t1209, t1237, t1238);
+    store4(output + 40, 64, t1261, t1262, t1291, t1292, t1319, t1320, t1352, t1353);
+    store4(output + 44, 64, t1383, t1384, t1417, t1418, t1448, t1449, t1480, t1481);
+    store4(output + 48, 64, t1050, t1051, t1079, t1080, t1104, t1105, t1131, t1132);
+    store4(output + 52, 64, t1156, t1157, t1185, t1186, t1213, t1214, t1242, t1243);
+    store4(output + 56, 64, t1266, t1267, t1296, t1297, t1324, t1325, t1357, t1358);
+    store4(output + 60, 64, t1388, t1389, t1422, t1423, t1453, t1454, t1485, t1486);
+}
+
+} // anonymous namespace
+
+bool fft_codelet_neon_x4(const CkFftComplex* input, CkFftComplex* output, CkFftSize count, bool inverse, CkFftSize stride)
+{
+    switch (count)
+    {
+        case 8:
+            if (inverse)
+            {
+                codelet_8_inv_x4(input, output, stride);
+            }
+            else
+            {
+                codelet_8_fwd_x4(input, output, stride);
+            }
+            return true;
+
+        case 16:
+            if (inverse)
+            {
+                codelet_16_inv_x4(input, output, stride);
+            }
+            else
+            {
+                codelet_16_fwd_x4(input, output, stride);
+            }
+            return true;
+
+        case 32:
+            if (inverse)
+            {
+                codelet_32_inv_x4(input, output, stride);
+            }
+            else
+            {
+                codelet_32_fwd_x4(input, output, stride);
+            }
+            return true;
+
+        case 64:
+            if (inverse)
+            {
+                codelet_64_inv_x4(input, output, stride);
+            }
+            else
+            {
+                codelet_64_fwd_x4(input, output, stride);
+            }
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+#else // CKFFT_ARM_NEON
+
+bool fft_codelet_neon_x4(const CkFftComplex* input, CkFftComplex* output, CkFftSize count, bool inverse, CkFftSize stride)
+{
+    return false;
+}
+
+#endif // CKFFT_ARM_NEON
+
+} // namespace ckfft
@@ -0,0 +1,23 @@
+#pragma once
+#include "ckfft/ckfft.h"
+
+
+namespace ckfft
+{
+
+// Four straight-line DFTs of size count (8, 16, 32 or 64), as needed by a 
+// radix-4 step of size 4*count: DFT j reads input + j*stride with element 
+// stride 4*stride, and writes count contiguous values to output + j*count.
+// Returns false if there is no codelet for this size.
+//
+// Generated by etc/codelets/gen_codelets.py.
+bool fft_codelet_neon_x4(
+        const CkFftComplex* input, 
+        CkFftComplex* output, 
+        CkFftSize count, 
+        bool inverse,
+        CkFftSize stride);
+
+}
+
+
@@ -1,6 +1,7 @@
 #include "ckfft/platform.h"
 #include "ckfft/debug.h"
 #include "ckfft/fft_default.h"
+#include "ckfft/fft_codelets_default.h"
 #include "ckfft/context.h"
 #include "ckfft/math_util.h"
 #include <assert.h>
@@ -8,23 +9,282 @@
 namespace ckfft
 {
 
+namespace
+{
+
+// Radix-4 butterflies, combining four DFTs of size n (F0..F3) into one DFT of 
+// size 4*n, whose four quarters are written to x0..x3.  Each F value is read
+// before the corresponding outputs are written, so the sub-DFTs may be stored
+// in the output.  The outputs are multiplied by scale.  Complex is CkFftComplex
+// (with Real float), or CkFftComplexD (with Real double) for double-precision FFTs.
+template <typename Complex, typename Real>
+void radix4(
+        const Complex* f0,
+        const Complex* f1,
+        const Complex* f2,
+        const Complex* f3,
+        Complex* x0,
+        Complex* x1,
+        Complex* x2,
+        Complex* x3,
+        CkFftSize n,
+        bool inverse,
+        const Complex* expTable,
+        CkFftSize expTableStride1,
+        Real scale)
+{
+    const Complex* exp1 = expTable;
+    const Complex* exp2 = exp1;
+    const Complex* exp3 = exp1;
+    CkFftSize expTableStride2 = expTableStride1 * 2;
+    CkFftSize expTableStride3 = expTableStride1 * 3;
+
+    Complex f1w, f2w2, f3w3;
+    Complex sum02, diff02, sum13, diff13;
+
+    for (CkFftSize i = 0; i < n; ++i)
+    {
+        /*
+           W = exp(-2*pi*I/N)
+
+           X0 = F0 +   F1*W + F2*W2 +   F3*W3
+           X1 = F0 - I*F1*W - F2*W2 + I*F3*W3
+           X2 = F0 -   F1*W + F2*W2 -   F3*W3
+           X3 = F0 + I*F1*W - F2*W2 - I*F3*W3
+
+           X0 = (F0 + F2*W2) +   (F1*W + F3*W3) = sum02 + sum13
+           X1 = (F0 - F2*W2) - I*(F1*W - F3*W3) = diff02 - I*diff13
+           X2 = (F0 + F2*W2) -   (F1*W + F3*W3) = sum02 - sum13
+           X3 = (F0 - F2*W2) + I*(F1*W - F3*W3) = diff02 + I*diff13
+
+         */
+
+        // f1w = F1*W
+        // f2w2 = F2*W2
+        // f3w3 = F3*W3
+        multiply(*f1, *exp1, f1w);
+        multiply(*f2, *exp2, f2w2);
+        multiply(*f3, *exp3, f3w3);
+
+        // sum02  = F0 + f2w2
+        // diff02 = F0 - f2w2
+        // sum13  = f1w + f3w3
+        // diff13 = f1w - f3w3
+        add(*f0, f2w2, sum02);
+        subtract(*f0, f2w2, diff02);
+        add(f1w, f3w3, sum13);
+        subtract(f1w, f3w3, diff13);
+
+        if (scale != 1.0f)
+        {
+            multiply(sum02, scale, sum02);
+            multiply(diff02, scale, diff02);
+            multiply(sum13, scale, sum13);
+            multiply(diff13, scale, diff13);
+        }
+
+        // x + I*y = (x.real + I*x.imag) + I*(y.real + I*y.imag)
+        //         = x.real + I*x.imag + I*y.real - y.imag
+        //         = (x.real - y.imag) + I*(x.imag + y.real)
+        // x - I*y = (x.real + I*x.imag) - I*(y.real + I*y.imag)
+        //         = x.real + I*x.imag - I*y.real + y.imag
+        //         = (x.real + y.imag) + I*(x.imag - y.real)
+        add(sum02, sum13, *x0);
+        subtract(sum02, sum13, *x2);
+        if (inverse)
+        {
+            x1->real = diff02.real - diff13.imag;
+            x1->imag = diff02.imag + diff13.real;
+            x3->real = diff02.real + diff13.imag;
+            x3->imag = diff02.imag - diff13.real;
+        }
+        else
+        {
+            x1->real = diff02.real + diff13.imag;
+            x1->imag = diff02.imag - diff13.real;
+            x3->real = diff02.real - diff13.imag;
+            x3->imag = diff02.imag + diff13.real;
+        }
+
+        exp1 += expTableStride1;
+        exp2 += expTableStride2;
+        exp3 += expTableStride3;
+
+        ++f0;
+        ++f1;
+        ++f2;
+        ++f3;
+        ++x0;
+        ++x1;
+        ++x2;
+        ++x3;
+    }
+}
+
+// Decimation-in-frequency radix-4 butterflies, splitting a DFT of size 4*n, whose 
+// input quarters are a0..a3, into four DFTs of size n, whose inputs (Y0..Y3) are 
+// written to y0..y3.  As with radix4(), the input may be the same as the output.
+void radix4_dif(
+        const CkFftComplex* a0,
+        const CkFftComplex* a1,
+        const CkFftComplex* a2,
+        const CkFftComplex* a3,
+        CkFftComplex* y0,
+        CkFftComplex* y1,
+        CkFftComplex* y2,
+        CkFftComplex* y3,
+        CkFftSize n,
+        bool inverse,
+        const CkFftComplex* expTable,
+        CkFftSize expTableStride1,
+        float scale)
+{
+    const CkFftComplex* exp1 = expTable;
+    const CkFftComplex* exp2 = exp1;
+    const CkFftComplex* exp3 = exp1;
+    CkFftSize expTableStride2 = expTableStride1 * 2;
+    CkFftSize expTableStride3 = expTableStride1 * 3;
+
+    CkFftComplex sum02, diff02, sum13, diff13, tmp;
+
+    for (CkFftSize i = 0; i < n; ++i)
+    {
+        /*
+           W = exp(-2*pi*I/N)
+
+           Y0 = ((A0 + A2) +   (A1 + A3))
+           Y1 = ((A0 - A2) - I*(A1 - A3)) * W
+           Y2 = ((A0 + A2) -   (A1 + A3)) * W2
+           Y3 = ((A0 - A2) + I*(A1 - A3)) * W3
+         */
+
+        add(*a0, *a2, sum02);
+        subtract(*a0, *a2, diff02);
+        add(*a1, *a3, sum13);
+        subtract(*a1, *a3, diff13);
+
+        if (scale != 1.0f)
+        {
+            multiply(sum02, scale, sum02);
+            multiply(diff02, scale, diff02);
+            multiply(sum13, scale, sum13);
+            multiply(diff13, scale, diff13);
+        }
+
+        add(sum02, sum13, *y0);
+
+        subtract(sum02, sum13, tmp);
+        multiply(tmp, *exp2, *y2);
+
+        if (inverse)
+        {
+            tmp.real = diff02.real - diff13.imag;
+            tmp.imag = diff02.imag + diff13.real;
+            multiply(tmp, *exp1, *y1);
+            tmp.real = diff02.real + diff13.imag;
+            tmp.imag = diff02.imag - diff13.real;
+            multiply(tmp, *exp3, *y3);
+        }
+        else
+        {
+            tmp.real = diff02.real + diff13.imag;
+            tmp.imag = diff02.imag - diff13.real;
+            multiply(tmp, *exp1, *y1);
+            tmp.real = diff02.real - diff13.imag;
+            tmp.imag = diff02.imag + diff13.real;
+            multiply(tmp, *exp3, *y3);
+        }
+
+        exp1 += expTableStride1;
+        exp2 += expTableStride2;
+        exp3 += expTableStride3;
+
+        ++a0;
+        ++a1;
+        ++a2;
+        ++a3;
+        ++y0;
+        ++y1;
+        ++y2;
+        ++y3;
+    }
+}
+
+template <typename Complex, typename Real>
+void radix2Stage(
+        const Complex* input, 
+        Complex* output, 
+        CkFftSize count,
+        Real scale)
+{
+    const Complex* in = input;
+    const Complex* inEnd = input + count;
+    Complex* out = output;
+    Complex in0, in1;
+    while (in < inEnd)
+    {
+        in0 = in[0];
+        in1 = in[1];
+        if (scale != 1.0f)
+        {
+            multiply(in0, scale, in0);
+            multiply(in1, scale, in1);
+        }
+        add(in0, in1, out[0]);
+        subtract(in0, in1, out[1]);
+        in += 2;
+        out += 2;
+    }
+}
+
+template <typename Complex, typename Real>
+void ditStage(
+        const Complex* input, 
+        Complex* output, 
+        CkFftSize count, 
+        CkFftSize n, 
+        bool inverse, 
+        const Complex* expTable, 
+        CkFftSize expTableStride,
+        Real scale)
+{
+    // In bit-reversed order, the four sub-DFTs of each DFT of size 4*n are stored
+    // in the order F0, F2, F1, F3.
+    CkFftSize n4 = n * 4;
+    CkFftSize expTableStride1 = expTableStride * (count / n4);
+    const Complex* in = input;
+    Complex* out = output;
+    Complex* outEnd = output + count;
+    while (out < outEnd)
+    {
+        radix4(in, in + 2*n, in + n, in + 3*n, 
+               out, out + n, out + 2*n, out + 3*n, 
+               n, inverse, expTable, expTableStride1, scale);
+        in += n4;
+        out += n4;
+    }
+}
+
+}
+
 // see http://www.cmlab.csie.ntu.edu.tw/cml/dsp/training/coding/transform/fft.html
 void fft_default(
         CkFftContext* context, 
         const CkFftComplex* input, 
         CkFftComplex* output, 
-        int count, 
+        CkFftSize count, 
         bool inverse, 
-        int stride, 
+        CkFftSize stride, 
         const CkFftComplex* expTable, 
-        int expTableStride)
+        CkFftSize expTableStride,
+        float scale)
 {
     if (count == 4)
     {
         // radix-4 recursion step for count == 4
 
-        // this code will be called at the deepest recursion level for FFT sizes
-        // that are a power of 4.
+        // this code will only be called for FFTs of size 4; the recursion for
+        // larger sizes bottoms out in the codelets below.
 
         const CkFftComplex* in = input;
         CkFftComplex* out = output;
@@ -48,72 +308,14 @@ void fft_default(
         add(*out1, *out3, sum13);
         subtract(*out1, *out3, diff13);
 
-        add(sum02, sum13, *out0);
-        subtract(sum02, sum13, *out2);
-        if (inverse)
-        {
-            out1->real = diff02.real - diff13.imag;
-            out1->imag = diff02.imag + diff13.real;
-            out3->real = diff02.real + diff13.imag;
-            out3->imag = diff02.imag - diff13.real;
-        }
-        else
-        {
-            out1->real = diff02.real + diff13.imag;
-            out1->imag = diff02.imag - diff13.real;
-            out3->real = diff02.real - diff13.imag;
-            out3->imag = diff02.imag + diff13.real;
-        }
-    }
-    else if (count == 8)
-    {
-        // radix-4 recursion step for count == 8, with loop unrolled
-
-        // this code will be called at the deepest recursion level for FFT sizes
-        // that are not a power of 4.
-
-        // Having a special case for count == 8 only speeds things up by a few
-        // percent here. In the NEON implementation, however, this case is required,
-        // since the general case processes 4 elements at a time, and this case only
-        // requires 2 elements.
-
-        // calculate FFT of each 1/4
-        const CkFftComplex* in0 = input;
-        CkFftComplex* out = output;
-        CkFftComplex* outEnd = out + 8;
-        int stride4 = stride * 4;
-        while (out < outEnd)
+        if (scale != 1.0f)
         {
-            // inlined radix-2 recursion step for count == 2
-            const CkFftComplex* in1 = in0 + stride4;
-            add(*in0, *in1, out[0]);
-            subtract(*in0, *in1, out[1]);
-
-            in0 += stride;
-            out += 2;
+            multiply(sum02, scale, sum02);
+            multiply(diff02, scale, diff02);
+            multiply(sum13, scale, sum13);
+            multiply(diff13, scale, diff13);
         }
 
-        int expTableStride1 = stride * expTableStride;
-        const CkFftComplex* exp1 = expTable + expTableStride1;
-        const CkFftComplex* exp2 = exp1 + expTableStride1;
-        const CkFftComplex* exp3 = exp2 + expTableStride1;
-
-        CkFftComplex f1w, f2w2, f3w3;
-        CkFftComplex sum02, diff02, sum13, diff13;
-
-        CkFftComplex* out0 = output;
-        CkFftComplex* out1 = out0 + 2;
-        CkFftComplex* out2 = out1 + 2;
-        CkFftComplex* out3 = out2 + 2;
-
-        ////////////////////////////////////////
-        // unrolled loop i=0
-
-        add(*out0, *out2, sum02);
-        subtract(*out0, *out2, diff02);
-        add(*out1, *out3, sum13);
-        subtract(*out1, *out3, diff13);
-
         add(sum02, sum13, *out0);
         subtract(sum02, sum13, *out2);
         if (inverse)
@@ -130,39 +332,18 @@ void fft_default(
             out3->real = diff02.real - diff13.imag;
             out3->imag = diff02.imag + diff13.real;
         }
+    }
+    else if (count <= 64)
+    {
+        // straight-line codelets for count == 8, 16, 32, 64
 
-        ++out0;
-        ++out1;
-        ++out2;
-        ++out3;
-
-        ////////////////////////////////////////
-        // unrolled loop i=1
-
-        multiply(*out1, *exp1, f1w);
-        multiply(*out2, *exp2, f2w2);
-        multiply(*out3, *exp3, f3w3);
-
-        add(*out0, f2w2, sum02);
-        subtract(*out0, f2w2, diff02);
-        add(f1w, f3w3, sum13);
-        subtract(f1w, f3w3, diff13);
+        // this code will be called at the deepest recursion level for all larger
+        // FFT sizes.  The codelets are generated by etc/codelets/gen_codelets.py.
 
-        add(sum02, sum13, *out0);
-        subtract(sum02, sum13, *out2);
-        if (inverse)
+        fft_codelet_default(input, output, count, inverse, stride);
+        if (scale != 1.0f)
         {
-            out1->real = diff02.real - diff13.imag;
-            out1->imag = diff02.imag + diff13.real;
-            out3->real = diff02.real + diff13.imag;
-            out3->imag = diff02.imag - diff13.real;
-        }
-        else
-        {
-            out1->real = diff02.real + diff13.imag;
-            out1->imag = diff02.imag - diff13.real;
-            out3->real = diff02.real - diff13.imag;
-            out3->imag = diff02.imag + diff13.real;
+            applyScale(output, count, scale);
         }
     }
     else
@@ -170,8 +351,8 @@ void fft_default(
         // radix-4
         assert((count & 0x3) == 0);
 
-        int n = count / 4;
-        int stride4 = stride * 4;
+        CkFftSize n = count / 4;
+        CkFftSize stride4 = stride * 4;
 
         // calculate FFT of each 1/4
         const CkFftComplex* in = input;
@@ -179,91 +360,14 @@ void fft_default(
         CkFftComplex* outEnd = out + count;
         while (out < outEnd)
         {
-            fft_default(context, in, out, n, inverse, stride4, expTable, expTableStride);
+            fft_default(context, in, out, n, inverse, stride4, expTable, expTableStride, 1.0f);
             in += stride;
             out += n;
         }
 
-        const CkFftComplex* exp1 = expTable;
-        const CkFftComplex* exp2 = exp1;
-        const CkFftComplex* exp3 = exp1;
-        int expTableStride1 = stride * expTableStride;
-        int expTableStride2 = expTableStride1 * 2;
-        int expTableStride3 = expTableStride1 * 3;
-
-        CkFftComplex f1w, f2w2, f3w3;
-        CkFftComplex sum02, diff02, sum13, diff13;
-
-        CkFftComplex* out0 = output;
-        CkFftComplex* out1 = out0 + n;
-        CkFftComplex* out2 = out1 + n;
-        CkFftComplex* out3 = out2 + n;
-
-        for (int i = 0; i < n; ++i)
-        {
-            /*
-               W = exp(-2*pi*I/N)
-
-               X0 = F0 +   F1*W + F2*W2 +   F3*W3
-               X1 = F0 - I*F1*W - F2*W2 + I*F3*W3
-               X2 = F0 -   F1*W + F2*W2 -   F3*W3
-               X3 = F0 + I*F1*W - F2*W2 - I*F3*W3
-
-               X0 = (F0 + F2*W2) +   (F1*W + F3*W3) = sum02 + sum13
-               X1 = (F0 - F2*W2) - I*(F1*W - F3*W3) = diff02 - I*diff13
-               X2 = (F0 + F2*W2) -   (F1*W + F3*W3) = sum02 - sum13
-               X3 = (F0 - F2*W2) + I*(F1*W - F3*W3) = diff02 + I*diff13
-
-             */
-
-            // f1w = F1*W
-            // f2w2 = F2*W2
-            // f3w3 = F3*W3
-            multiply(*out1, *exp1, f1w);
-            multiply(*out2, *exp2, f2w2);
-            multiply(*out3, *exp3, f3w3);
-
-            // sum02  = F0 + f2w2
-            // diff02 = F0 - f2w2
-            // sum13  = f1w + f3w3
-            // diff13 = f1w - f3w3
-            add(*out0, f2w2, sum02);
-            subtract(*out0, f2w2, diff02);
-            add(f1w, f3w3, sum13);
-            subtract(f1w, f3w3, diff13);
-
-            // x + I*y = (x.real + I*x.imag) + I*(y.real + I*y.imag)
-            //         = x.real + I*x.imag + I*y.real - y.imag
-            //         = (x.real - y.imag) + I*(x.imag + y.real)
-            // x - I*y = (x.real + I*x.imag) - I*(y.real + I*y.imag)
-            //         = x.real + I*x.imag - I*y.real + y.imag
-            //         = (x.real + y.imag) + I*(x.imag - y.real)
-            add(sum02, sum13, *out0);
-            subtract(sum02, sum13, *out2);
-            if (inverse)
-            {
-                out1->real = diff02.real - diff13.imag;
-                out1->imag = diff02.imag + diff13.real;
-                out3->real = diff02.real + diff13.imag;
-                out3->imag = diff02.imag - diff13.real;
-            }
-            else
-            {
-                out1->real = diff02.real + diff13.imag;
-                out1->imag = diff02.imag - diff13.real;
-                out3->real = diff02.real - diff13.imag;
-                out3->imag = diff02.imag + diff13.real;
-            }
-
-            exp1 += expTableStride1;
-            exp2 += expTableStride2;
-            exp3 += expTableStride3;
-
-            ++out0;
-            ++out1;
-            ++out2;
-            ++out3;
-        }
+        radix4(output, output + n, output + 2*n, output + 3*n, 
+               output, output + n, output + 2*n, output + 3*n, 
+               n, inverse, expTable, stride * expTableStride, scale);
         /*
         else
         {
@@ -272,12 +376,12 @@ void fft_default(
             // This is never actually used, apart from trivial count=2 case in fft(),
             // but is left here for reference.
 
-            int n = count / 2;
-            int stride2 = stride * 2;
+            CkFftSize n = count / 2;
+            CkFftSize stride2 = stride * 2;
 
             // DFT of even and odd elements
-            fft_default(context, input, output, n, inverse, stride2, expTable, expTableStride);
-            fft_default(context, input + stride, output + n, n, inverse, stride2, expTable, expTableStride);
+            fft_default(context, input, output, n, inverse, stride2, expTable, expTableStride, 1.0f);
+            fft_default(context, input + stride, output + n, n, inverse, stride2, expTable, expTableStride, 1.0f);
 
             // combine
             CkFftComplex* out0 = output;
@@ -306,4 +410,163 @@ void fft_default(
     }
 }
 
+void fft_inplace_default(
+        CkFftContext* context, 
+        CkFftComplex* data, 
+        CkFftSize count, 
+        bool inverse, 
+        const CkFftComplex* expTable, 
+        CkFftSize expTableStride,
+        float scale)
+{
+    bitReverse(data, count);
+    fft_dit_default(context, data, data, count, inverse, expTable, expTableStride, scale);
+}
+
+void fft_dit_default(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        CkFftComplex* output, 
+        CkFftSize count, 
+        bool inverse, 
+        const CkFftComplex* expTable, 
+        CkFftSize expTableStride,
+        float scale)
+{
+    // the first step reads from the input; the rest are in place in the output;
+    // the last step applies the scale
+    CkFftSize n = 1;
+    if (!isPowerOfFour(count))
+    {
+        // count is not a power of 4, so start with a radix-2 step
+        fft_radix2_stage_default(input, output, count, (count == 2 ? scale : 1.0f));
+        n = 2;
+    }
+    else
+    {
+        fft_dit_stage_default(input, output, count, 1, inverse, expTable, expTableStride, (count == 4 ? scale : 1.0f));
+        n = 4;
+    }
+
+    fft_dit_steps_default(context, output, count, n, inverse, expTable, expTableStride, scale);
+}
+
+void fft_dit_steps_default(
+        CkFftContext* context, 
+        CkFftComplex* data, 
+        CkFftSize count, 
+        CkFftSize n, 
+        bool inverse, 
+        const CkFftComplex* expTable, 
+        CkFftSize expTableStride,
+        float scale)
+{
+    // the last step applies the scale
+    while (n < count)
+    {
+        fft_dit_stage_default(data, data, count, n, inverse, expTable, expTableStride, (n*4 == count ? scale : 1.0f));
+        n *= 4;
+    }
+}
+
+void fft_dif_default(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        CkFftComplex* output, 
+        CkFftSize count, 
+        bool inverse, 
+        const CkFftComplex* expTable, 
+        CkFftSize expTableStride,
+        float scale)
+{
+    // the first step reads from the input; the rest are in place in the output;
+    // the last step applies the scale
+    bool pow4 = isPowerOfFour(count);
+    const CkFftComplex* in = input;
+    CkFftSize n = count / 4;
+    while (n > 0)
+    {
+        fft_dif_stage_default(in, output, count, n, inverse, expTable, expTableStride, (pow4 && n == 1 ? scale : 1.0f));
+        in = output;
+        n /= 4;
+    }
+
+    if (!pow4)
+    {
+        // count is not a power of 4, so finish with a radix-2 step
+        fft_radix2_stage_default(in, output, count, scale);
+    }
+}
+
+void fft_radix2_stage_default(
+        const CkFftComplex* input, 
+        CkFftComplex* output, 
+        CkFftSize count,
+        float scale)
+{
+    radix2Stage(input, output, count, scale);
+}
+
+void fft_radix2_stage_default(
+        const CkFftComplexD* input, 
+        CkFftComplexD* output, 
+        CkFftSize count,
+        double scale)
+{
+    radix2Stage(input, output, count, scale);
+}
+
+void fft_dit_stage_default(
+        const CkFftComplex* input, 
+        CkFftComplex* output, 
+        CkFftSize count, 
+        CkFftSize n, 
+        bool inverse, 
+        const CkFftComplex* expTable, 
+        CkFftSize expTableStride,
+        float scale)
+{
+    ditStage(input, output, count, n, inverse, expTable, expTableStride, scale);
+}
+
+void fft_dit_stage_default(
+        const CkFftComplexD* input, 
+        CkFftComplexD* output, 
+        CkFftSize count, 
+        CkFftSize n, 
+        bool inverse, 
+        const CkFftComplexD* expTable, 
+        CkFftSize expTableStride,
+        double scale)
+{
+    ditStage(input, output, count, n, inverse, expTable, expTableStride, scale);
+}
+
+void fft_dif_stage_default(
+        const CkFftComplex* input, 
+        CkFftComplex* output, 
+        CkFftSize count, 
+        CkFftSize n, 
+        bool inverse, 
+        const CkFftComplex* expTable, 
+        CkFftSize expTableStride,
+        float scale)
+{
+    // Write the four sub-DFT inputs in the order Y0, Y2, Y1, Y3, so that the 
+    // final output is in bit-reversed order.
+    CkFftSize n4 = n * 4;
+    CkFftSize expTableStride1 = expTableStride * (count / n4);
+    const CkFftComplex* in = input;
+    CkFftComplex* out = output;
+    CkFftComplex* outEnd = output + count;
+    while (out < outEnd)
+    {
+        radix4_dif(in, in + n, in + 2*n, in + 3*n, 
+                   out, out + 2*n, out + n, out + 3*n, 
+                   n, inverse, expTable, expTableStride1, scale);
+        in += n4;
+        out += n4;
+    }
+}
+
 } // namespace ckfft
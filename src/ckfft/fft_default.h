@@ -5,15 +5,115 @@
 namespace ckfft
 {
 
+// The outputs of all of these functions are multiplied by scale.
+
 void fft_default(
         CkFftContext* context, 
         const CkFftComplex* input, 
         CkFftComplex* output, 
-        int count, 
+        CkFftSize count, 
+        bool inverse,
+        CkFftSize stride, 
+        const CkFftComplex* expTable,
+        CkFftSize expTableStride,
+        float scale);
+
+// In-place FFT: bit-reversal permutation followed by fft_dit_default().
+void fft_inplace_default(
+        CkFftContext* context, 
+        CkFftComplex* data, 
+        CkFftSize count, 
+        bool inverse,
+        const CkFftComplex* expTable,
+        CkFftSize expTableStride,
+        float scale);
+
+// Decimation-in-time FFT of input in bit-reversed order; output is in natural order.
+// Radix-4 steps, starting with one radix-2 step if count is not a power of 4.
+// Input and output may be the same buffer.
+void fft_dit_default(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        CkFftComplex* output, 
+        CkFftSize count, 
+        bool inverse,
+        const CkFftComplex* expTable,
+        CkFftSize expTableStride,
+        float scale);
+
+// The steps of fft_dit_default() after the first, in place: data contains sub-DFTs
+// of size n (2 if count is not a power of 4, otherwise 4), which are combined into
+// one DFT of size count.
+void fft_dit_steps_default(
+        CkFftContext* context, 
+        CkFftComplex* data, 
+        CkFftSize count, 
+        CkFftSize n, 
+        bool inverse,
+        const CkFftComplex* expTable,
+        CkFftSize expTableStride,
+        float scale);
+
+// Decimation-in-frequency FFT of input in natural order; output is in bit-reversed
+// order.  Radix-4 steps, ending with one radix-2 step if count is not a power of 4.
+// Input and output may be the same buffer.
+void fft_dif_default(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        CkFftComplex* output, 
+        CkFftSize count, 
+        bool inverse,
+        const CkFftComplex* expTable,
+        CkFftSize expTableStride,
+        float scale);
+
+// Radix-2 butterflies on adjacent pairs (first DIT step or last DIF step).
+void fft_radix2_stage_default(
+        const CkFftComplex* input, 
+        CkFftComplex* output, 
+        CkFftSize count,
+        float scale);
+
+void fft_radix2_stage_default(
+        const CkFftComplexD* input, 
+        CkFftComplexD* output, 
+        CkFftSize count,
+        double scale);
+
+// One decimation-in-time step on data in bit-reversed order, combining sub-DFTs
+// of size n into DFTs of size 4*n.  The double-precision versions of this and 
+// fft_radix2_stage_default() are used by fft_double().
+void fft_dit_stage_default(
+        const CkFftComplex* input, 
+        CkFftComplex* output, 
+        CkFftSize count, 
+        CkFftSize n, 
+        bool inverse,
+        const CkFftComplex* expTable,
+        CkFftSize expTableStride,
+        float scale);
+
+void fft_dit_stage_default(
+        const CkFftComplexD* input, 
+        CkFftComplexD* output, 
+        CkFftSize count, 
+        CkFftSize n, 
+        bool inverse,
+        const CkFftComplexD* expTable,
+        CkFftSize expTableStride,
+        double scale);
+
+// One decimation-in-frequency step, splitting DFTs of size 4*n into sub-DFTs of 
+// size n, which are stored in bit-reversed order.
+void fft_dif_stage_default(
+        const CkFftComplex* input, 
+        CkFftComplex* output, 
+        CkFftSize count, 
+        CkFftSize n, 
         bool inverse,
-        int stride, 
         const CkFftComplex* expTable,
-        int expTableStride);
+        CkFftSize expTableStride,
+        float scale);
 
 }
 
@@ -0,0 +1,122 @@
+#include "ckfft/platform.h"
+#include "ckfft/debug.h"
+#include "ckfft/fft_double.h"
+#include "ckfft/fft_default.h"
+#include "ckfft/fft_real_default.h"
+#include "ckfft/context_double.h"
+#include "ckfft/math_util.h"
+
+
+namespace ckfft
+{
+
+namespace
+{
+
+// FFT of data in bit-reversed order, in place; as fft_dit_default().
+void dit(
+        CkFftContextD* context, 
+        CkFftComplexD* data, 
+        int count, 
+        bool inverse)
+{
+    const CkFftComplexD* expTable = (inverse ? context->invExpTable : context->fwdExpTable);
+    int expTableStride = context->maxCount / count;
+
+    int n = 1;
+    if (!isPowerOfFour(count))
+    {
+        // count is not a power of 4, so start with a radix-2 step
+        fft_radix2_stage_default(data, data, count, 1.0);
+        n = 2;
+    }
+
+    while (n < count)
+    {
+        fft_dit_stage_default(data, data, count, n, inverse, expTable, expTableStride, 1.0);
+        n *= 4;
+    }
+}
+
+}
+
+void fft_double(
+        CkFftContextD* context, 
+        const CkFftComplexD* input, 
+        CkFftComplexD* output, 
+        int count, 
+        bool inverse)
+{
+    if (input == output)
+    {
+        bitReverse(output, count);
+    }
+    else
+    {
+        bitReverse(input, output, count);
+    }
+    dit(context, output, count, inverse);
+}
+
+void fft_real_double(
+        CkFftContextD* context, 
+        const double* input, 
+        CkFftComplexD* output, 
+        int count)
+{
+    // handle trivial cases here; as with fft_real(), the output is scaled by 2
+    if (count == 1)
+    {
+        output->real = *input * 2.0;
+        output->imag = 0.0;
+    }
+    else if (count == 2)
+    {
+        // (input may be the same buffer as output, so read it all first)
+        double sum = (input[0] + input[1]) * 2.0;
+        double diff = (input[0] - input[1]) * 2.0;
+        output[0].real = sum;
+        output[0].imag = 0.0;
+        output[1].real = diff;
+        output[1].imag = 0.0;
+    }
+    else
+    {
+        // complex FFT of pairs of input values, then post-processing
+        int countDiv2 = count / 2;
+        fft_double(context, (const CkFftComplexD*) input, output, countDiv2, false);
+        fft_real_post_default(context, output, count);
+    }
+}
+
+void fft_real_inverse_double(
+        CkFftContextD* context, 
+        const CkFftComplexD* input, 
+        double* output, 
+        int count,
+        CkFftComplexD* tmpBuf)
+{
+    if (count == 1)
+    {
+        *output = input->real;
+    }
+    else if (count == 2)
+    {
+        // (input may be the same buffer as output, so read it all first)
+        double sum = input[0].real + input[1].real;
+        double diff = input[0].real - input[1].real;
+        output[0] = sum;
+        output[1] = diff;
+    }
+    else
+    {
+        // pre-processing, then complex FFT whose output is pairs of output values;
+        // without a temp buffer, both are done in place in the output buffer
+        int countDiv2 = count / 2;
+        CkFftComplexD* buf = (tmpBuf ? tmpBuf : (CkFftComplexD*) output);
+        fft_real_pre_default(context, input, buf, count);
+        fft_double(context, buf, (CkFftComplexD*) output, countDiv2, true);
+    }
+}
+
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include "ckfft/ckfft.h"
+
+
+namespace ckfft
+{
+
+// Double-precision FFTs, using the same radix-4 decimation-in-time steps and real
+// FFT processing as the float FFTs.  Input may be the same as output.
+
+void fft_double(
+        CkFftContextD* context, 
+        const CkFftComplexD* input, 
+        CkFftComplexD* output, 
+        int count, 
+        bool inverse);
+
+void fft_real_double(
+        CkFftContextD* context, 
+        const double* input, 
+        CkFftComplexD* output, 
+        int count);
+
+// tmpBuf is optional, as for fft_real_inverse().
+void fft_real_inverse_double(
+        CkFftContextD* context, 
+        const CkFftComplexD* input, 
+        double* output, 
+        int count,
+        CkFftComplexD* tmpBuf);
+
+}
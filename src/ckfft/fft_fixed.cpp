@@ -0,0 +1,101 @@
+#include "ckfft/platform.h"
+#include "ckfft/debug.h"
+#include "ckfft/fft_fixed.h"
+#include "ckfft/fft_fixed_default.h"
+#include "ckfft/fft_fixed_neon.h"
+#include "ckfft/context_fixed.h"
+#include "ckfft/math_util.h"
+
+namespace ckfft
+{
+
+namespace
+{
+
+// Shift to apply to the input of a pass, given the magnitude bits of its input
+// (see fft_fixed_default.h), so that the output fits in values with the given 
+// number of fractional bits.  The magnitude bits bound the input to a power of 2;
+// a radix-2 pass can double it, so it needs 2 bits of headroom (an output of 
+// exactly 2^bits is saturated), and a radix-4 pass can multiply it by 1 + 3*sqrt(2), 
+// so it needs 3.  The shift is negative if the data can be scaled up.
+int getShift(unsigned int mag, int bits, int headroom)
+{
+    int magBits = 0;
+    while (mag >> magBits)
+    {
+        ++magBits;
+    }
+    return magBits - (bits - headroom);
+}
+
+template <typename Context, typename Complex>
+void fftFixed(
+        Context* context, 
+        const Complex* input, 
+        Complex* output, 
+        int count, 
+        bool inverse,
+        int* exponent, 
+        int bits,
+        int neonLanes)
+{
+    int expTableStride = context->maxCount / count;
+    int totalShift = 0;
+
+    unsigned int mag = fft_fixed_bitreverse_default(input, output, count);
+
+    // as in fft_dit_default(), with the data rescaled before each stage; the
+    // first stages are scalar when they are too small for the NEON kernels
+    int n = 1;
+    if (!isPowerOfFour(count))
+    {
+        // count is not a power of 4, so start with a radix-2 step
+        int shift = getShift(mag, bits, 2);
+        mag = fft_fixed_radix2_stage_default(output, count, shift);
+        totalShift += shift;
+        n = 2;
+    }
+
+    while (n < count)
+    {
+        int shift = getShift(mag, bits, 3);
+        if (context->neon && n >= neonLanes)
+        {
+            mag = fft_fixed_dit_stage_neon(output, count, n, inverse, context->expTable, expTableStride, shift);
+        }
+        else
+        {
+            mag = fft_fixed_dit_stage_default(output, count, n, inverse, context->expTable, expTableStride, shift);
+        }
+        totalShift += shift;
+        n *= 4;
+    }
+
+    *exponent = totalShift;
+}
+
+}
+
+void fft_fixed(
+        CkFftContextQ15* context, 
+        const CkFftComplexQ15* input, 
+        CkFftComplexQ15* output, 
+        int count, 
+        bool inverse,
+        int* exponent)
+{
+    fftFixed(context, input, output, count, inverse, exponent, 15, 8);
+}
+
+void fft_fixed(
+        CkFftContextQ31* context, 
+        const CkFftComplexQ31* input, 
+        CkFftComplexQ31* output, 
+        int count, 
+        bool inverse,
+        int* exponent)
+{
+    fftFixed(context, input, output, count, inverse, exponent, 31, 4);
+}
+
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include "ckfft/ckfft.h"
+
+
+namespace ckfft
+{
+
+// Block-floating-point FFTs; the result is output * 2^exponent.  input may be the 
+// same as output.
+
+void fft_fixed(
+        CkFftContextQ15* context, 
+        const CkFftComplexQ15* input, 
+        CkFftComplexQ15* output, 
+        int count, 
+        bool inverse,
+        int* exponent);
+
+void fft_fixed(
+        CkFftContextQ31* context, 
+        const CkFftComplexQ31* input, 
+        CkFftComplexQ31* output, 
+        int count, 
+        bool inverse,
+        int* exponent);
+
+}
@@ -0,0 +1,340 @@
+#include "ckfft/platform.h"
+#include "ckfft/debug.h"
+#include "ckfft/fft_fixed_default.h"
+
+namespace ckfft
+{
+
+namespace
+{
+
+// Q15 values are computed in 32 bits and Q31 values in 64 bits.
+template <typename Complex> struct FixedTraits {};
+
+template <> struct FixedTraits<CkFftComplexQ15>
+{
+    typedef int16 Value;
+    typedef int32 Wide;
+    enum { kBits = 15 };
+};
+
+template <> struct FixedTraits<CkFftComplexQ31>
+{
+    typedef int32 Value;
+    typedef int64 Wide;
+    enum { kBits = 31 };
+};
+
+// Multiply by 2^-shift, rounding, or by 2^(-shift) exactly if shift is negative.
+template <typename Wide>
+inline Wide shiftRound(Wide x, int shift)
+{
+    if (shift > 0)
+    {
+        return (x + ((Wide) 1 << (shift - 1))) >> shift;
+    }
+    else
+    {
+        return x * ((Wide) 1 << -shift);
+    }
+}
+
+// Product of a value and a twiddle factor component, rounded back to the value's 
+// scale.
+template <typename Complex>
+inline typename FixedTraits<Complex>::Wide multiplyRound(typename FixedTraits<Complex>::Wide x)
+{
+    typedef typename FixedTraits<Complex>::Wide Wide;
+    return (x + ((Wide) 1 << (FixedTraits<Complex>::kBits - 1))) >> FixedTraits<Complex>::kBits;
+}
+
+template <typename Complex>
+inline typename FixedTraits<Complex>::Value saturate(typename FixedTraits<Complex>::Wide x)
+{
+    typedef typename FixedTraits<Complex>::Wide Wide;
+    typedef typename FixedTraits<Complex>::Value Value;
+    const Wide maxValue = ((Wide) 1 << FixedTraits<Complex>::kBits) - 1;
+    const Wide minValue = -maxValue - 1;
+    return (Value) (x > maxValue ? maxValue : (x < minValue ? minValue : x));
+}
+
+inline unsigned int magnitude(int32 x)
+{
+    return (unsigned int) (x ^ (x >> 31));
+}
+
+// A complex value in wide arithmetic.
+template <typename Complex>
+struct WideComplex
+{
+    typename FixedTraits<Complex>::Wide real;
+    typename FixedTraits<Complex>::Wide imag;
+};
+
+template <typename Complex>
+inline void load(const Complex& in, int shift, WideComplex<Complex>& out)
+{
+    out.real = shiftRound<typename FixedTraits<Complex>::Wide>(in.real, shift);
+    out.imag = shiftRound<typename FixedTraits<Complex>::Wide>(in.imag, shift);
+}
+
+template <typename Complex>
+inline void store(const WideComplex<Complex>& in, Complex& out, unsigned int& mag)
+{
+    out.real = saturate<Complex>(in.real);
+    out.imag = saturate<Complex>(in.imag);
+    mag |= magnitude(out.real) | magnitude(out.imag);
+}
+
+// Multiply by a twiddle factor, or by its conjugate if inverse is true.
+template <typename Complex>
+inline void multiply(const WideComplex<Complex>& a, const Complex& w, bool inverse, WideComplex<Complex>& out)
+{
+    if (inverse)
+    {
+        out.real = multiplyRound<Complex>(a.real * w.real + a.imag * w.imag);
+        out.imag = multiplyRound<Complex>(a.imag * w.real - a.real * w.imag);
+    }
+    else
+    {
+        out.real = multiplyRound<Complex>(a.real * w.real - a.imag * w.imag);
+        out.imag = multiplyRound<Complex>(a.imag * w.real + a.real * w.imag);
+    }
+}
+
+template <typename Complex>
+unsigned int bitReverse(
+        const Complex* input, 
+        Complex* output, 
+        int count)
+{
+    unsigned int mag = 0;
+    int j = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        if (input != output)
+        {
+            output[j] = input[i];
+        }
+        else if (i < j)
+        {
+            Complex tmp = output[i];
+            output[i] = output[j];
+            output[j] = tmp;
+        }
+        mag |= magnitude(input[i].real) | magnitude(input[i].imag);
+
+        // increment j in bit-reversed order
+        int bit = count >> 1;
+        while (j & bit)
+        {
+            j ^= bit;
+            bit >>= 1;
+        }
+        j |= bit;
+    }
+    return mag;
+}
+
+template <typename Complex>
+unsigned int radix2Stage(
+        Complex* data, 
+        int count, 
+        int shift)
+{
+    unsigned int mag = 0;
+    WideComplex<Complex> in0, in1, out;
+    Complex* p = data;
+    Complex* end = data + count;
+    while (p < end)
+    {
+        load(p[0], shift, in0);
+        load(p[1], shift, in1);
+        out.real = in0.real + in1.real;
+        out.imag = in0.imag + in1.imag;
+        store(out, p[0], mag);
+        out.real = in0.real - in1.real;
+        out.imag = in0.imag - in1.imag;
+        store(out, p[1], mag);
+        p += 2;
+    }
+    return mag;
+}
+
+// Radix-4 butterflies, in the same arrangement as radix4() in fft_default.cpp.
+template <typename Complex>
+unsigned int radix4(
+        Complex* f0,
+        Complex* f1,
+        Complex* f2,
+        Complex* f3,
+        Complex* x0,
+        Complex* x1,
+        Complex* x2,
+        Complex* x3,
+        int n,
+        bool inverse,
+        const Complex* expTable,
+        int expTableStride1,
+        int shift)
+{
+    const Complex* exp1 = expTable;
+    const Complex* exp2 = exp1;
+    const Complex* exp3 = exp1;
+    int expTableStride2 = expTableStride1 * 2;
+    int expTableStride3 = expTableStride1 * 3;
+
+    unsigned int mag = 0;
+    WideComplex<Complex> in0, in1, in2, in3;
+    WideComplex<Complex> f1w, f2w2, f3w3;
+    WideComplex<Complex> sum02, diff02, sum13, diff13, out;
+
+    for (int i = 0; i < n; ++i)
+    {
+        load(*f0, shift, in0);
+        load(*f1, shift, in1);
+        load(*f2, shift, in2);
+        load(*f3, shift, in3);
+
+        multiply(in1, *exp1, inverse, f1w);
+        multiply(in2, *exp2, inverse, f2w2);
+        multiply(in3, *exp3, inverse, f3w3);
+
+        sum02.real = in0.real + f2w2.real;
+        sum02.imag = in0.imag + f2w2.imag;
+        diff02.real = in0.real - f2w2.real;
+        diff02.imag = in0.imag - f2w2.imag;
+        sum13.real = f1w.real + f3w3.real;
+        sum13.imag = f1w.imag + f3w3.imag;
+        diff13.real = f1w.real - f3w3.real;
+        diff13.imag = f1w.imag - f3w3.imag;
+
+        out.real = sum02.real + sum13.real;
+        out.imag = sum02.imag + sum13.imag;
+        store(out, *x0, mag);
+        out.real = sum02.real - sum13.real;
+        out.imag = sum02.imag - sum13.imag;
+        store(out, *x2, mag);
+        if (inverse)
+        {
+            out.real = diff02.real - diff13.imag;
+            out.imag = diff02.imag + diff13.real;
+            store(out, *x1, mag);
+            out.real = diff02.real + diff13.imag;
+            out.imag = diff02.imag - diff13.real;
+            store(out, *x3, mag);
+        }
+        else
+        {
+            out.real = diff02.real + diff13.imag;
+            out.imag = diff02.imag - diff13.real;
+            store(out, *x1, mag);
+            out.real = diff02.real - diff13.imag;
+            out.imag = diff02.imag + diff13.real;
+            store(out, *x3, mag);
+        }
+
+        exp1 += expTableStride1;
+        exp2 += expTableStride2;
+        exp3 += expTableStride3;
+
+        ++f0;
+        ++f1;
+        ++f2;
+        ++f3;
+        ++x0;
+        ++x1;
+        ++x2;
+        ++x3;
+    }
+
+    return mag;
+}
+
+template <typename Complex>
+unsigned int ditStage(
+        Complex* data, 
+        int count, 
+        int n, 
+        bool inverse, 
+        const Complex* expTable, 
+        int expTableStride,
+        int shift)
+{
+    // sub-DFTs are stored in the order F0, F2, F1, F3 (see fft_dit_stage_default())
+    unsigned int mag = 0;
+    int n4 = n * 4;
+    int expTableStride1 = expTableStride * (count / n4);
+    Complex* p = data;
+    Complex* end = data + count;
+    while (p < end)
+    {
+        mag |= radix4(p, p + 2*n, p + n, p + 3*n, 
+                      p, p + n, p + 2*n, p + 3*n, 
+                      n, inverse, expTable, expTableStride1, shift);
+        p += n4;
+    }
+    return mag;
+}
+
+}
+
+////////////////////////////////////////
+
+unsigned int fft_fixed_bitreverse_default(
+        const CkFftComplexQ15* input, 
+        CkFftComplexQ15* output, 
+        int count)
+{
+    return bitReverse(input, output, count);
+}
+
+unsigned int fft_fixed_bitreverse_default(
+        const CkFftComplexQ31* input, 
+        CkFftComplexQ31* output, 
+        int count)
+{
+    return bitReverse(input, output, count);
+}
+
+unsigned int fft_fixed_radix2_stage_default(
+        CkFftComplexQ15* data, 
+        int count, 
+        int shift)
+{
+    return radix2Stage(data, count, shift);
+}
+
+unsigned int fft_fixed_radix2_stage_default(
+        CkFftComplexQ31* data, 
+        int count, 
+        int shift)
+{
+    return radix2Stage(data, count, shift);
+}
+
+unsigned int fft_fixed_dit_stage_default(
+        CkFftComplexQ15* data, 
+        int count, 
+        int n, 
+        bool inverse, 
+        const CkFftComplexQ15* expTable, 
+        int expTableStride,
+        int shift)
+{
+    return ditStage(data, count, n, inverse, expTable, expTableStride, shift);
+}
+
+unsigned int fft_fixed_dit_stage_default(
+        CkFftComplexQ31* data, 
+        int count, 
+        int n, 
+        bool inverse, 
+        const CkFftComplexQ31* expTable, 
+        int expTableStride,
+        int shift)
+{
+    return ditStage(data, count, n, inverse, expTable, expTableStride, shift);
+}
+
+}
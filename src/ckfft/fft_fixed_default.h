@@ -0,0 +1,56 @@
+#pragma once
+#include "ckfft/ckfft.h"
+
+
+namespace ckfft
+{
+
+// Building blocks for the block-floating-point FFTs in fft_fixed.cpp.  Each pass 
+// works on data in place (except the bit reversal), and returns the bitwise OR of 
+// x ^ (x >> 31) over its output components x, whose highest bit is that of the 
+// largest magnitude; the shift for the next pass is chosen from it.  The input to each stage is multiplied by 2^-shift, 
+// with rounding, before the butterflies.
+
+// Copy input to output in bit-reversed order; input may be the same as output.
+unsigned int fft_fixed_bitreverse_default(
+        const CkFftComplexQ15* input, 
+        CkFftComplexQ15* output, 
+        int count);
+
+unsigned int fft_fixed_bitreverse_default(
+        const CkFftComplexQ31* input, 
+        CkFftComplexQ31* output, 
+        int count);
+
+// Radix-2 stage, combining pairs of elements.
+unsigned int fft_fixed_radix2_stage_default(
+        CkFftComplexQ15* data, 
+        int count, 
+        int shift);
+
+unsigned int fft_fixed_radix2_stage_default(
+        CkFftComplexQ31* data, 
+        int count, 
+        int shift);
+
+// Radix-4 DIT stage, combining DFTs of size n into DFTs of size 4*n (see 
+// fft_dit_stage_default()).
+unsigned int fft_fixed_dit_stage_default(
+        CkFftComplexQ15* data, 
+        int count, 
+        int n, 
+        bool inverse, 
+        const CkFftComplexQ15* expTable, 
+        int expTableStride,
+        int shift);
+
+unsigned int fft_fixed_dit_stage_default(
+        CkFftComplexQ31* data, 
+        int count, 
+        int n, 
+        bool inverse, 
+        const CkFftComplexQ31* expTable, 
+        int expTableStride,
+        int shift);
+
+}
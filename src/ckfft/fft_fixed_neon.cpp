@@ -0,0 +1,345 @@
+#include "ckfft/platform.h"
+#include "ckfft/debug.h"
+#include "ckfft/fft_fixed_neon.h"
+
+#if CKFFT_ARM_NEON
+#  include <arm_neon.h>
+#endif 
+
+namespace ckfft
+{
+
+#if CKFFT_ARM_NEON
+
+namespace
+{
+
+// Saturating operations on vectors of Q15 or Q31 values, so radix4_neon() can be 
+// written once for both.  Products with twiddle factors use vqrdmulh, which 
+// rounds to the scale of the data, as multiplyRound() does in fft_fixed_default.cpp.
+
+struct NeonQ15
+{
+    typedef CkFftComplexQ15 Complex;
+    typedef int16x8_t Vector;
+    typedef int16x8x2_t Vector2;
+    enum { kLanes = 8 };
+
+    static Vector dup(int x) { return vdupq_n_s16((int16_t) x); }
+    static Vector2 load(const Complex* p) { return vld2q_s16((const int16_t*) p); }
+    static void store(Complex* p, const Vector2& v) { vst2q_s16((int16_t*) p, v); }
+    static Vector add(Vector a, Vector b) { return vqaddq_s16(a, b); }
+    static Vector subtract(Vector a, Vector b) { return vqsubq_s16(a, b); }
+    static Vector multiply(Vector a, Vector b) { return vqrdmulhq_s16(a, b); }
+    static Vector shift(Vector a, Vector shift) { return vqrshlq_s16(a, shift); }
+    static Vector magnitude(Vector a) { return veorq_s16(a, vshrq_n_s16(a, 15)); }
+    static Vector bitwiseOr(Vector a, Vector b) { return vorrq_s16(a, b); }
+
+    // gather twiddle factors spaced stride apart
+    static Vector2 loadExp(const Complex*& exp, int stride)
+    {
+        Vector2 v = { { vdupq_n_s16(0), vdupq_n_s16(0) } };
+        v = vld2q_lane_s16((const int16_t*) exp, v, 0);
+        exp += stride;
+        v = vld2q_lane_s16((const int16_t*) exp, v, 1);
+        exp += stride;
+        v = vld2q_lane_s16((const int16_t*) exp, v, 2);
+        exp += stride;
+        v = vld2q_lane_s16((const int16_t*) exp, v, 3);
+        exp += stride;
+        v = vld2q_lane_s16((const int16_t*) exp, v, 4);
+        exp += stride;
+        v = vld2q_lane_s16((const int16_t*) exp, v, 5);
+        exp += stride;
+        v = vld2q_lane_s16((const int16_t*) exp, v, 6);
+        exp += stride;
+        v = vld2q_lane_s16((const int16_t*) exp, v, 7);
+        exp += stride;
+        return v;
+    }
+
+    static unsigned int reduceOr(Vector a)
+    {
+        int16_t values[kLanes];
+        vst1q_s16(values, a);
+        unsigned int result = 0;
+        for (int i = 0; i < kLanes; ++i)
+        {
+            result |= (unsigned int) values[i];
+        }
+        return result;
+    }
+};
+
+struct NeonQ31
+{
+    typedef CkFftComplexQ31 Complex;
+    typedef int32x4_t Vector;
+    typedef int32x4x2_t Vector2;
+    enum { kLanes = 4 };
+
+    static Vector dup(int x) { return vdupq_n_s32((int32_t) x); }
+    static Vector2 load(const Complex* p) { return vld2q_s32((const int32_t*) p); }
+    static void store(Complex* p, const Vector2& v) { vst2q_s32((int32_t*) p, v); }
+    static Vector add(Vector a, Vector b) { return vqaddq_s32(a, b); }
+    static Vector subtract(Vector a, Vector b) { return vqsubq_s32(a, b); }
+    static Vector multiply(Vector a, Vector b) { return vqrdmulhq_s32(a, b); }
+    static Vector shift(Vector a, Vector shift) { return vqrshlq_s32(a, shift); }
+    static Vector magnitude(Vector a) { return veorq_s32(a, vshrq_n_s32(a, 31)); }
+    static Vector bitwiseOr(Vector a, Vector b) { return vorrq_s32(a, b); }
+
+    static Vector2 loadExp(const Complex*& exp, int stride)
+    {
+        Vector2 v = { { vdupq_n_s32(0), vdupq_n_s32(0) } };
+        v = vld2q_lane_s32((const int32_t*) exp, v, 0);
+        exp += stride;
+        v = vld2q_lane_s32((const int32_t*) exp, v, 1);
+        exp += stride;
+        v = vld2q_lane_s32((const int32_t*) exp, v, 2);
+        exp += stride;
+        v = vld2q_lane_s32((const int32_t*) exp, v, 3);
+        exp += stride;
+        return v;
+    }
+
+    static unsigned int reduceOr(Vector a)
+    {
+        int32_t values[kLanes];
+        vst1q_s32(values, a);
+        unsigned int result = 0;
+        for (int i = 0; i < kLanes; ++i)
+        {
+            result |= (unsigned int) values[i];
+        }
+        return result;
+    }
+};
+
+// Multiply by twiddle factors, or by their conjugates if inverse is true.
+template <typename Ops>
+inline void multiply(const typename Ops::Vector2& a, const typename Ops::Vector2& w, bool inverse, typename Ops::Vector2& out)
+{
+    typename Ops::Vector rr = Ops::multiply(a.val[0], w.val[0]);
+    typename Ops::Vector ii = Ops::multiply(a.val[1], w.val[1]);
+    typename Ops::Vector ir = Ops::multiply(a.val[1], w.val[0]);
+    typename Ops::Vector ri = Ops::multiply(a.val[0], w.val[1]);
+    if (inverse)
+    {
+        out.val[0] = Ops::add(rr, ii);
+        out.val[1] = Ops::subtract(ir, ri);
+    }
+    else
+    {
+        out.val[0] = Ops::subtract(rr, ii);
+        out.val[1] = Ops::add(ir, ri);
+    }
+}
+
+template <typename Ops>
+inline void shiftRound(typename Ops::Vector2& a, typename Ops::Vector shift_v)
+{
+    a.val[0] = Ops::shift(a.val[0], shift_v);
+    a.val[1] = Ops::shift(a.val[1], shift_v);
+}
+
+template <typename Ops>
+inline void accumulateMagnitude(const typename Ops::Vector2& a, typename Ops::Vector& mag_v)
+{
+    mag_v = Ops::bitwiseOr(mag_v, Ops::magnitude(a.val[0]));
+    mag_v = Ops::bitwiseOr(mag_v, Ops::magnitude(a.val[1]));
+}
+
+// Radix-4 butterflies (see radix4() in fft_fixed_default.cpp); n must be a multiple
+// of Ops::kLanes.
+template <typename Ops>
+unsigned int radix4_neon(
+        typename Ops::Complex* f0,
+        typename Ops::Complex* f1,
+        typename Ops::Complex* f2,
+        typename Ops::Complex* f3,
+        typename Ops::Complex* x0,
+        typename Ops::Complex* x1,
+        typename Ops::Complex* x2,
+        typename Ops::Complex* x3,
+        int n,
+        bool inverse,
+        const typename Ops::Complex* expTable,
+        int expTableStride1,
+        int shift)
+{
+    typedef typename Ops::Complex Complex;
+    typedef typename Ops::Vector Vector;
+    typedef typename Ops::Vector2 Vector2;
+
+    const Complex* exp1 = expTable;
+    const Complex* exp2 = exp1;
+    const Complex* exp3 = exp1;
+    int expTableStride2 = expTableStride1 * 2;
+    int expTableStride3 = expTableStride1 * 3;
+
+    // vqrshl shifts right, with rounding, by a negative amount
+    Vector shift_v = Ops::dup(-shift);
+    Vector mag_v = Ops::dup(0);
+
+    Vector2 f1w_v, f2w2_v, f3w3_v;
+    Vector2 sum02_v, diff02_v, sum13_v, diff13_v;
+
+    int m = n / Ops::kLanes;
+    for (int i = 0; i < m; ++i)
+    {
+        Vector2 out0_v = Ops::load(f0);
+        Vector2 out1_v = Ops::load(f1);
+        Vector2 out2_v = Ops::load(f2);
+        Vector2 out3_v = Ops::load(f3);
+        if (shift)
+        {
+            shiftRound<Ops>(out0_v, shift_v);
+            shiftRound<Ops>(out1_v, shift_v);
+            shiftRound<Ops>(out2_v, shift_v);
+            shiftRound<Ops>(out3_v, shift_v);
+        }
+
+        Vector2 exp1_v = Ops::loadExp(exp1, expTableStride1);
+        Vector2 exp2_v = Ops::loadExp(exp2, expTableStride2);
+        Vector2 exp3_v = Ops::loadExp(exp3, expTableStride3);
+
+        multiply<Ops>(out1_v, exp1_v, inverse, f1w_v);
+        multiply<Ops>(out2_v, exp2_v, inverse, f2w2_v);
+        multiply<Ops>(out3_v, exp3_v, inverse, f3w3_v);
+
+        sum02_v.val[0] = Ops::add(out0_v.val[0], f2w2_v.val[0]);
+        sum02_v.val[1] = Ops::add(out0_v.val[1], f2w2_v.val[1]);
+        diff02_v.val[0] = Ops::subtract(out0_v.val[0], f2w2_v.val[0]);
+        diff02_v.val[1] = Ops::subtract(out0_v.val[1], f2w2_v.val[1]);
+        sum13_v.val[0] = Ops::add(f1w_v.val[0], f3w3_v.val[0]);
+        sum13_v.val[1] = Ops::add(f1w_v.val[1], f3w3_v.val[1]);
+        diff13_v.val[0] = Ops::subtract(f1w_v.val[0], f3w3_v.val[0]);
+        diff13_v.val[1] = Ops::subtract(f1w_v.val[1], f3w3_v.val[1]);
+
+        out0_v.val[0] = Ops::add(sum02_v.val[0], sum13_v.val[0]);
+        out0_v.val[1] = Ops::add(sum02_v.val[1], sum13_v.val[1]);
+        out2_v.val[0] = Ops::subtract(sum02_v.val[0], sum13_v.val[0]);
+        out2_v.val[1] = Ops::subtract(sum02_v.val[1], sum13_v.val[1]);
+        if (inverse)
+        {
+            out1_v.val[0] = Ops::subtract(diff02_v.val[0], diff13_v.val[1]);
+            out1_v.val[1] = Ops::add(diff02_v.val[1], diff13_v.val[0]);
+            out3_v.val[0] = Ops::add(diff02_v.val[0], diff13_v.val[1]);
+            out3_v.val[1] = Ops::subtract(diff02_v.val[1], diff13_v.val[0]);
+        }
+        else
+        {
+            out1_v.val[0] = Ops::add(diff02_v.val[0], diff13_v.val[1]);
+            out1_v.val[1] = Ops::subtract(diff02_v.val[1], diff13_v.val[0]);
+            out3_v.val[0] = Ops::subtract(diff02_v.val[0], diff13_v.val[1]);
+            out3_v.val[1] = Ops::add(diff02_v.val[1], diff13_v.val[0]);
+        }
+
+        accumulateMagnitude<Ops>(out0_v, mag_v);
+        accumulateMagnitude<Ops>(out1_v, mag_v);
+        accumulateMagnitude<Ops>(out2_v, mag_v);
+        accumulateMagnitude<Ops>(out3_v, mag_v);
+
+        Ops::store(x0, out0_v);
+        Ops::store(x1, out1_v);
+        Ops::store(x2, out2_v);
+        Ops::store(x3, out3_v);
+
+        f0 += Ops::kLanes;
+        f1 += Ops::kLanes;
+        f2 += Ops::kLanes;
+        f3 += Ops::kLanes;
+        x0 += Ops::kLanes;
+        x1 += Ops::kLanes;
+        x2 += Ops::kLanes;
+        x3 += Ops::kLanes;
+    }
+
+    return Ops::reduceOr(mag_v);
+}
+
+template <typename Ops>
+unsigned int ditStage(
+        typename Ops::Complex* data, 
+        int count, 
+        int n, 
+        bool inverse, 
+        const typename Ops::Complex* expTable, 
+        int expTableStride,
+        int shift)
+{
+    typedef typename Ops::Complex Complex;
+
+    // sub-DFTs are stored in the order F0, F2, F1, F3 (see fft_dit_stage_default())
+    unsigned int mag = 0;
+    int n4 = n * 4;
+    int expTableStride1 = expTableStride * (count / n4);
+    Complex* p = data;
+    Complex* end = data + count;
+    while (p < end)
+    {
+        mag |= radix4_neon<Ops>(p, p + 2*n, p + n, p + 3*n, 
+                                p, p + n, p + 2*n, p + 3*n, 
+                                n, inverse, expTable, expTableStride1, shift);
+        p += n4;
+    }
+    return mag;
+}
+
+}
+
+////////////////////////////////////////
+
+unsigned int fft_fixed_dit_stage_neon(
+        CkFftComplexQ15* data, 
+        int count, 
+        int n, 
+        bool inverse, 
+        const CkFftComplexQ15* expTable, 
+        int expTableStride,
+        int shift)
+{
+    return ditStage<NeonQ15>(data, count, n, inverse, expTable, expTableStride, shift);
+}
+
+unsigned int fft_fixed_dit_stage_neon(
+        CkFftComplexQ31* data, 
+        int count, 
+        int n, 
+        bool inverse, 
+        const CkFftComplexQ31* expTable, 
+        int expTableStride,
+        int shift)
+{
+    return ditStage<NeonQ31>(data, count, n, inverse, expTable, expTableStride, shift);
+}
+
+#else // CKFFT_ARM_NEON
+
+unsigned int fft_fixed_dit_stage_neon(
+        CkFftComplexQ15* data, 
+        int count, 
+        int n, 
+        bool inverse, 
+        const CkFftComplexQ15* expTable, 
+        int expTableStride,
+        int shift)
+{
+    return 0;
+}
+
+unsigned int fft_fixed_dit_stage_neon(
+        CkFftComplexQ31* data, 
+        int count, 
+        int n, 
+        bool inverse, 
+        const CkFftComplexQ31* expTable, 
+        int expTableStride,
+        int shift)
+{
+    return 0;
+}
+
+#endif
+
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include "ckfft/ckfft.h"
+
+
+namespace ckfft
+{
+
+// Radix-4 DIT stages with saturating arithmetic; see fft_fixed_dit_stage_default().
+// n must be a multiple of 8 for Q15 data, and of 4 for Q31 data.
+
+unsigned int fft_fixed_dit_stage_neon(
+        CkFftComplexQ15* data, 
+        int count, 
+        int n, 
+        bool inverse, 
+        const CkFftComplexQ15* expTable, 
+        int expTableStride,
+        int shift);
+
+unsigned int fft_fixed_dit_stage_neon(
+        CkFftComplexQ31* data, 
+        int count, 
+        int n, 
+        bool inverse, 
+        const CkFftComplexQ31* expTable, 
+        int expTableStride,
+        int shift);
+
+}
@@ -0,0 +1,123 @@
+#include "ckfft/platform.h"
+#include "ckfft/debug.h"
+#include "ckfft/fft_half.h"
+#include "ckfft/fft.h"
+#include "ckfft/fft_real.h"
+#include "ckfft/fft_default.h"
+#include "ckfft/fft_neon.h"
+#include "ckfft/fft_real_default.h"
+#include "ckfft/fft_real_neon.h"
+#include "ckfft/convert.h"
+#include "ckfft/convert_neon.h"
+#include "ckfft/context.h"
+
+
+namespace ckfft
+{
+
+namespace
+{
+
+void convert_from_half(
+        CkFftContext* context, 
+        const CkFftHalf* input, 
+        bool bfloat16, 
+        float* output, 
+        CkFftSize count)
+{
+    if (context->neon)
+    {
+        convert_from_half_neon(input, bfloat16, output, count);
+    }
+    else
+    {
+        convert_from_half_default(input, bfloat16, output, count);
+    }
+}
+
+void convert_to_half(
+        CkFftContext* context, 
+        const float* input, 
+        bool bfloat16, 
+        CkFftHalf* output, 
+        CkFftSize count)
+{
+    if (context->neon)
+    {
+        convert_to_half_neon(input, bfloat16, output, count);
+    }
+    else
+    {
+        convert_to_half_default(input, bfloat16, output, count);
+    }
+}
+
+}
+
+void fft_half(
+        CkFftContext* context, 
+        const CkFftHalf* input, 
+        CkFftHalf* output, 
+        CkFftSize count, 
+        bool inverse,
+        bool bfloat16,
+        CkFftComplex* tmpBuf)
+{
+    // convert the input directly into bit-reversed order, in place of the 
+    // bit-reversal step of an in-place FFT
+    convert_half(input, bfloat16, tmpBuf, count);
+    fft_dit(context, tmpBuf, tmpBuf, count, inverse);
+    convert_to_half(context, (const float*) tmpBuf, bfloat16, output, count * 2);
+}
+
+void fft_real_half(
+        CkFftContext* context, 
+        const CkFftHalf* input, 
+        CkFftHalf* output, 
+        CkFftSize count, 
+        bool bfloat16,
+        CkFftComplex* tmpBuf)
+{
+    CkFftSize outputCount = count/2 + 1;
+    if (count <= 4)
+    {
+        // small FFTs: convert in order, and transform in place
+        convert_from_half(context, input, bfloat16, (float*) tmpBuf, count);
+        fft_real(context, (const float*) tmpBuf, 1, tmpBuf, count, false);
+    }
+    else
+    {
+        // convert the input directly into bit-reversed order, in place of the 
+        // bit-reversal step of an in-place FFT
+        CkFftSize countDiv2 = count / 2;
+        float scale = context->getScale(count * 2, false);
+        convert_half(input, bfloat16, tmpBuf, countDiv2);
+        if (context->neon)
+        {
+            fft_dit_neon(context, tmpBuf, tmpBuf, countDiv2, false, context->fwdExpTable, context->maxCount / countDiv2, 1.0f);
+            fft_real_post_neon(context, tmpBuf, count, false, scale);
+        }
+        else
+        {
+            fft_dit_default(context, tmpBuf, tmpBuf, countDiv2, false, context->fwdExpTable, context->maxCount / countDiv2, 1.0f);
+            fft_real_post_default(context, tmpBuf, count, false, scale);
+        }
+    }
+    convert_to_half(context, (const float*) tmpBuf, bfloat16, output, outputCount * 2);
+}
+
+void fft_real_inverse_half(
+        CkFftContext* context, 
+        const CkFftHalf* input, 
+        CkFftHalf* output, 
+        CkFftSize count, 
+        bool bfloat16,
+        CkFftComplex* tmpBuf)
+{
+    CkFftSize inputCount = count/2 + 1;
+    convert_from_half(context, input, bfloat16, (float*) tmpBuf, inputCount * 2);
+    fft_real_inverse(context, tmpBuf, (float*) tmpBuf, 1, count, NULL, false);
+    convert_to_half(context, (const float*) tmpBuf, bfloat16, output, count);
+}
+
+} // namespace ckfft
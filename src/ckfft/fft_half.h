@@ -0,0 +1,36 @@
+#pragma once
+#include "ckfft/ckfft.h"
+
+
+namespace ckfft
+{
+
+// FFTs of data stored as fp16 or bfloat16, computed in float in tmpBuf; see 
+// CkFftComplexForwardHalf() etc. for buffer sizes.
+
+void fft_half(
+        CkFftContext* context, 
+        const CkFftHalf* input, 
+        CkFftHalf* output, 
+        CkFftSize count, 
+        bool inverse,
+        bool bfloat16,
+        CkFftComplex* tmpBuf);
+
+void fft_real_half(
+        CkFftContext* context, 
+        const CkFftHalf* input, 
+        CkFftHalf* output, 
+        CkFftSize count, 
+        bool bfloat16,
+        CkFftComplex* tmpBuf);
+
+void fft_real_inverse_half(
+        CkFftContext* context, 
+        const CkFftHalf* input, 
+        CkFftHalf* output, 
+        CkFftSize count, 
+        bool bfloat16,
+        CkFftComplex* tmpBuf);
+
+}
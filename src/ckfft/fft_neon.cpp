@@ -1,6 +1,8 @@
 #include "ckfft/platform.h"
 #include "ckfft/debug.h"
 #include "ckfft/context.h"
+#include "ckfft/fft_codelets_neon.h"
+#include "ckfft/fft_default.h"
 #include "ckfft/math_util.h"
 #include <assert.h>
 
@@ -13,15 +15,257 @@ namespace ckfft
 
 #if CKFFT_ARM_NEON
 
+namespace
+{
+
+// Radix-4 butterflies, combining four DFTs of size n (F0..F3) into one DFT of 
+// size 4*n, whose four quarters are written to x0..x3; n must be a multiple of 4.
+// The sub-DFTs may be stored in the output, and the outputs are multiplied by
+// scale (see radix4() in fft_default.cpp).
+void radix4_neon(
+        const CkFftComplex* f0,
+        const CkFftComplex* f1,
+        const CkFftComplex* f2,
+        const CkFftComplex* f3,
+        CkFftComplex* x0,
+        CkFftComplex* x1,
+        CkFftComplex* x2,
+        CkFftComplex* x3,
+        CkFftSize n,
+        bool inverse,
+        const CkFftComplex* expTable,
+        CkFftSize expTableStride1,
+        float scale)
+{
+    const CkFftComplex* exp1 = expTable;
+    const CkFftComplex* exp2 = exp1;
+    const CkFftComplex* exp3 = exp1;
+    CkFftSize expTableStride2 = expTableStride1 * 2;
+    CkFftSize expTableStride3 = expTableStride1 * 3;
+
+    float32x4x2_t f1w_v, f2w2_v, f3w3_v;
+    float32x4x2_t sum02_v, diff02_v, sum13_v, diff13_v;
+
+    CkFftSize m = n/4;
+    for (CkFftSize i = 0; i < m; ++i)
+    {
+        float32x4x2_t out0_v = vld2q_f32((const float32_t*) f0);
+        float32x4x2_t out1_v = vld2q_f32((const float32_t*) f1);
+        float32x4x2_t out2_v = vld2q_f32((const float32_t*) f2);
+        float32x4x2_t out3_v = vld2q_f32((const float32_t*) f3);
+
+        float32x4x2_t exp1_v;
+        exp1_v = vld2q_lane_f32((const float32_t*) exp1, exp1_v, 0);
+        exp1 += expTableStride1;
+        exp1_v = vld2q_lane_f32((const float32_t*) exp1, exp1_v, 1);
+        exp1 += expTableStride1;
+        exp1_v = vld2q_lane_f32((const float32_t*) exp1, exp1_v, 2);
+        exp1 += expTableStride1;
+        exp1_v = vld2q_lane_f32((const float32_t*) exp1, exp1_v, 3);
+        exp1 += expTableStride1;
+
+        float32x4x2_t exp2_v;
+        exp2_v = vld2q_lane_f32((const float32_t*) exp2, exp2_v, 0);
+        exp2 += expTableStride2;
+        exp2_v = vld2q_lane_f32((const float32_t*) exp2, exp2_v, 1);
+        exp2 += expTableStride2;
+        exp2_v = vld2q_lane_f32((const float32_t*) exp2, exp2_v, 2);
+        exp2 += expTableStride2;
+        exp2_v = vld2q_lane_f32((const float32_t*) exp2, exp2_v, 3);
+        exp2 += expTableStride2;
+
+        float32x4x2_t exp3_v;
+        exp3_v = vld2q_lane_f32((const float32_t*) exp3, exp3_v, 0);
+        exp3 += expTableStride3;
+        exp3_v = vld2q_lane_f32((const float32_t*) exp3, exp3_v, 1);
+        exp3 += expTableStride3;
+        exp3_v = vld2q_lane_f32((const float32_t*) exp3, exp3_v, 2);
+        exp3 += expTableStride3;
+        exp3_v = vld2q_lane_f32((const float32_t*) exp3, exp3_v, 3);
+        exp3 += expTableStride3;
+
+        // TODO use vmla, vmls?
+        // alignment?
+
+        multiply(out1_v, exp1_v, f1w_v);
+        multiply(out2_v, exp2_v, f2w2_v);
+        multiply(out3_v, exp3_v, f3w3_v);
+
+        add(out0_v, f2w2_v, sum02_v);
+        subtract(out0_v, f2w2_v, diff02_v);
+        add(f1w_v, f3w3_v, sum13_v);
+        subtract(f1w_v, f3w3_v, diff13_v);
+
+        if (scale != 1.0f)
+        {
+            multiply(sum02_v, scale, sum02_v);
+            multiply(diff02_v, scale, diff02_v);
+            multiply(sum13_v, scale, sum13_v);
+            multiply(diff13_v, scale, diff13_v);
+        }
+
+        add(sum02_v, sum13_v, out0_v);
+        subtract(sum02_v, sum13_v, out2_v);
+
+        // TODO optimize this?
+        if (inverse)
+        {
+            out1_v.val[0] = vsubq_f32(diff02_v.val[0], diff13_v.val[1]);
+            out1_v.val[1] = vaddq_f32(diff02_v.val[1], diff13_v.val[0]);
+            out3_v.val[0] = vaddq_f32(diff02_v.val[0], diff13_v.val[1]);
+            out3_v.val[1] = vsubq_f32(diff02_v.val[1], diff13_v.val[0]);
+        }
+        else
+        {
+            out1_v.val[0] = vaddq_f32(diff02_v.val[0], diff13_v.val[1]);
+            out1_v.val[1] = vsubq_f32(diff02_v.val[1], diff13_v.val[0]);
+            out3_v.val[0] = vsubq_f32(diff02_v.val[0], diff13_v.val[1]);
+            out3_v.val[1] = vaddq_f32(diff02_v.val[1], diff13_v.val[0]);
+        }
+
+        vst2q_f32((float32_t*) x0, out0_v);
+        vst2q_f32((float32_t*) x1, out1_v);
+        vst2q_f32((float32_t*) x2, out2_v);
+        vst2q_f32((float32_t*) x3, out3_v);
+
+        f0 += 4;
+        f1 += 4;
+        f2 += 4;
+        f3 += 4;
+        x0 += 4;
+        x1 += 4;
+        x2 += 4;
+        x3 += 4;
+    }
+}
+
+// Decimation-in-frequency radix-4 butterflies (see radix4_dif() in fft_default.cpp);
+// n must be a multiple of 4.
+void radix4_dif_neon(
+        const CkFftComplex* a0,
+        const CkFftComplex* a1,
+        const CkFftComplex* a2,
+        const CkFftComplex* a3,
+        CkFftComplex* y0,
+        CkFftComplex* y1,
+        CkFftComplex* y2,
+        CkFftComplex* y3,
+        CkFftSize n,
+        bool inverse,
+        const CkFftComplex* expTable,
+        CkFftSize expTableStride1,
+        float scale)
+{
+    const CkFftComplex* exp1 = expTable;
+    const CkFftComplex* exp2 = exp1;
+    const CkFftComplex* exp3 = exp1;
+    CkFftSize expTableStride2 = expTableStride1 * 2;
+    CkFftSize expTableStride3 = expTableStride1 * 3;
+
+    float32x4x2_t sum02_v, diff02_v, sum13_v, diff13_v, tmp_v;
+
+    CkFftSize m = n/4;
+    for (CkFftSize i = 0; i < m; ++i)
+    {
+        float32x4x2_t in0_v = vld2q_f32((const float32_t*) a0);
+        float32x4x2_t in1_v = vld2q_f32((const float32_t*) a1);
+        float32x4x2_t in2_v = vld2q_f32((const float32_t*) a2);
+        float32x4x2_t in3_v = vld2q_f32((const float32_t*) a3);
+
+        float32x4x2_t exp1_v;
+        exp1_v = vld2q_lane_f32((const float32_t*) exp1, exp1_v, 0);
+        exp1 += expTableStride1;
+        exp1_v = vld2q_lane_f32((const float32_t*) exp1, exp1_v, 1);
+        exp1 += expTableStride1;
+        exp1_v = vld2q_lane_f32((const float32_t*) exp1, exp1_v, 2);
+        exp1 += expTableStride1;
+        exp1_v = vld2q_lane_f32((const float32_t*) exp1, exp1_v, 3);
+        exp1 += expTableStride1;
+
+        float32x4x2_t exp2_v;
+        exp2_v = vld2q_lane_f32((const float32_t*) exp2, exp2_v, 0);
+        exp2 += expTableStride2;
+        exp2_v = vld2q_lane_f32((const float32_t*) exp2, exp2_v, 1);
+        exp2 += expTableStride2;
+        exp2_v = vld2q_lane_f32((const float32_t*) exp2, exp2_v, 2);
+        exp2 += expTableStride2;
+        exp2_v = vld2q_lane_f32((const float32_t*) exp2, exp2_v, 3);
+        exp2 += expTableStride2;
+
+        float32x4x2_t exp3_v;
+        exp3_v = vld2q_lane_f32((const float32_t*) exp3, exp3_v, 0);
+        exp3 += expTableStride3;
+        exp3_v = vld2q_lane_f32((const float32_t*) exp3, exp3_v, 1);
+        exp3 += expTableStride3;
+        exp3_v = vld2q_lane_f32((const float32_t*) exp3, exp3_v, 2);
+        exp3 += expTableStride3;
+        exp3_v = vld2q_lane_f32((const float32_t*) exp3, exp3_v, 3);
+        exp3 += expTableStride3;
+
+        add(in0_v, in2_v, sum02_v);
+        subtract(in0_v, in2_v, diff02_v);
+        add(in1_v, in3_v, sum13_v);
+        subtract(in1_v, in3_v, diff13_v);
+
+        if (scale != 1.0f)
+        {
+            multiply(sum02_v, scale, sum02_v);
+            multiply(diff02_v, scale, diff02_v);
+            multiply(sum13_v, scale, sum13_v);
+            multiply(diff13_v, scale, diff13_v);
+        }
+
+        add(sum02_v, sum13_v, in0_v);
+        subtract(sum02_v, sum13_v, tmp_v);
+        multiply(tmp_v, exp2_v, in2_v);
+
+        if (inverse)
+        {
+            tmp_v.val[0] = vsubq_f32(diff02_v.val[0], diff13_v.val[1]);
+            tmp_v.val[1] = vaddq_f32(diff02_v.val[1], diff13_v.val[0]);
+            multiply(tmp_v, exp1_v, in1_v);
+            tmp_v.val[0] = vaddq_f32(diff02_v.val[0], diff13_v.val[1]);
+            tmp_v.val[1] = vsubq_f32(diff02_v.val[1], diff13_v.val[0]);
+            multiply(tmp_v, exp3_v, in3_v);
+        }
+        else
+        {
+            tmp_v.val[0] = vaddq_f32(diff02_v.val[0], diff13_v.val[1]);
+            tmp_v.val[1] = vsubq_f32(diff02_v.val[1], diff13_v.val[0]);
+            multiply(tmp_v, exp1_v, in1_v);
+            tmp_v.val[0] = vsubq_f32(diff02_v.val[0], diff13_v.val[1]);
+            tmp_v.val[1] = vaddq_f32(diff02_v.val[1], diff13_v.val[0]);
+            multiply(tmp_v, exp3_v, in3_v);
+        }
+
+        vst2q_f32((float32_t*) y0, in0_v);
+        vst2q_f32((float32_t*) y1, in1_v);
+        vst2q_f32((float32_t*) y2, in2_v);
+        vst2q_f32((float32_t*) y3, in3_v);
+
+        a0 += 4;
+        a1 += 4;
+        a2 += 4;
+        a3 += 4;
+        y0 += 4;
+        y1 += 4;
+        y2 += 4;
+        y3 += 4;
+    }
+}
+
+}
+
 void fft_neon(
         CkFftContext* context, 
         const CkFftComplex* input, 
         CkFftComplex* output, 
-        int count, 
+        CkFftSize count, 
         bool inverse,
-        int stride, 
+        CkFftSize stride, 
         const CkFftComplex* expTable,
-        int expTableStride)
+        CkFftSize expTableStride,
+        float scale)
 {
     if (count == 4)
     {
@@ -63,13 +307,18 @@ void fft_neon(
             out3->real = diff02.real - diff13.imag;
             out3->imag = diff02.imag + diff13.real;
         }
+
+        if (scale != 1.0f)
+        {
+            applyScale(output, count, scale);
+        }
     }
     else if (count == 8)
     {
         const CkFftComplex* in0 = input;
         CkFftComplex* out = output;
         CkFftComplex* outEnd = out + 8;
-        int stride4 = stride * 4;
+        CkFftSize stride4 = stride * 4;
         while (out < outEnd)
         {
             const CkFftComplex* in1 = in0 + stride4;
@@ -80,7 +329,7 @@ void fft_neon(
             out += 2;
         }
 
-        int expTableStride1 = stride * expTableStride;
+        CkFftSize expTableStride1 = stride * expTableStride;
         const CkFftComplex* exp = expTable;
 
         CkFftComplex* out0 = output;
@@ -139,119 +388,177 @@ void fft_neon(
         vst2_f32((float32_t*) out1, out1_v);
         vst2_f32((float32_t*) out2, out2_v);
         vst2_f32((float32_t*) out3, out3_v);
+
+        if (scale != 1.0f)
+        {
+            applyScale(output, count, scale);
+        }
     }
     else
     {
         assert((count & 0x3) == 0);
 
-        int n = count / 4;
+        CkFftSize n = count / 4;
 
-        const CkFftComplex* in = input;
-        CkFftComplex* out = output;
-        CkFftComplex* outEnd = out + count;
-        int stride4 = stride * 4;
-        while (out < outEnd)
+        // calculate FFT of each 1/4, all four at once if there is a codelet for
+        // this size (see etc/codelets/gen_codelets.py)
+        if (!fft_codelet_neon_x4(input, output, n, inverse, stride))
         {
-            fft_neon(context, in, out, n, inverse, stride4, expTable, expTableStride);
-            in += stride;
-            out += n;
+            const CkFftComplex* in = input;
+            CkFftComplex* out = output;
+            CkFftComplex* outEnd = out + count;
+            CkFftSize stride4 = stride * 4;
+            while (out < outEnd)
+            {
+                fft_neon(context, in, out, n, inverse, stride4, expTable, expTableStride, 1.0f);
+                in += stride;
+                out += n;
+            }
         }
 
-        const CkFftComplex* exp1 = expTable;
-        const CkFftComplex* exp2 = exp1;
-        const CkFftComplex* exp3 = exp1;
-        int expTableStride1 = stride * expTableStride;
-        int expTableStride2 = expTableStride1 * 2;
-        int expTableStride3 = expTableStride1 * 3;
+        radix4_neon(output, output + n, output + 2*n, output + 3*n, 
+                    output, output + n, output + 2*n, output + 3*n, 
+                    n, inverse, expTable, stride * expTableStride, scale);
+    }
+}
 
-        CkFftComplex* out0 = output;
-        CkFftComplex* out1 = out0 + n;
-        CkFftComplex* out2 = out1 + n;
-        CkFftComplex* out3 = out2 + n;
+void fft_inplace_neon(
+        CkFftContext* context, 
+        CkFftComplex* data, 
+        CkFftSize count, 
+        bool inverse,
+        const CkFftComplex* expTable,
+        CkFftSize expTableStride,
+        float scale)
+{
+    bitReverse(data, count);
+    fft_dit_neon(context, data, data, count, inverse, expTable, expTableStride, scale);
+}
 
-        float32x4x2_t f1w_v, f2w2_v, f3w3_v;
-        float32x4x2_t sum02_v, diff02_v, sum13_v, diff13_v;
+void fft_dit_neon(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        CkFftComplex* output, 
+        CkFftSize count, 
+        bool inverse,
+        const CkFftComplex* expTable,
+        CkFftSize expTableStride,
+        float scale)
+{
+    if (count < 16)
+    {
+        fft_dit_default(context, input, output, count, inverse, expTable, expTableStride, scale);
+        return;
+    }
 
+    // first steps, with sub-DFTs too small to vectorize
+    CkFftSize n = 1;
+    if (!isPowerOfFour(count))
+    {
+        // count is not a power of 4, so start with a radix-2 step
+        fft_radix2_stage_default(input, output, count, 1.0f);
+        n = 2;
+    }
+    else
+    {
+        fft_dit_stage_default(input, output, count, 1, inverse, expTable, expTableStride, 1.0f);
+        n = 4;
+    }
 
-        int m = n/4;
-        for (int i = 0; i < m; ++i)
+    fft_dit_steps_neon(context, output, count, n, inverse, expTable, expTableStride, scale);
+}
+
+void fft_dit_steps_neon(
+        CkFftContext* context, 
+        CkFftComplex* data, 
+        CkFftSize count, 
+        CkFftSize n, 
+        bool inverse,
+        const CkFftComplex* expTable,
+        CkFftSize expTableStride,
+        float scale)
+{
+    if (count < 16)
+    {
+        fft_dit_steps_default(context, data, count, n, inverse, expTable, expTableStride, scale);
+        return;
+    }
+
+    // steps with sub-DFTs too small to vectorize
+    if (n < 4)
+    {
+        fft_dit_stage_default(data, data, count, n, inverse, expTable, expTableStride, 1.0f);
+        n *= 4;
+    }
+
+    // the last step applies the scale
+    while (n < count)
+    {
+        // sub-DFTs are in the order F0, F2, F1, F3 (see fft_dit_stage_default())
+        CkFftSize n4 = n * 4;
+        CkFftSize expTableStride1 = expTableStride * (count / n4);
+        CkFftComplex* p = data;
+        CkFftComplex* pEnd = data + count;
+        while (p < pEnd)
         {
-            float32x4x2_t out0_v = vld2q_f32((const float32_t*) out0);
-            float32x4x2_t out1_v = vld2q_f32((const float32_t*) out1);
-            float32x4x2_t out2_v = vld2q_f32((const float32_t*) out2);
-            float32x4x2_t out3_v = vld2q_f32((const float32_t*) out3);
-
-            float32x4x2_t exp1_v;
-            exp1_v = vld2q_lane_f32((const float32_t*) exp1, exp1_v, 0);
-            exp1 += expTableStride1;
-            exp1_v = vld2q_lane_f32((const float32_t*) exp1, exp1_v, 1);
-            exp1 += expTableStride1;
-            exp1_v = vld2q_lane_f32((const float32_t*) exp1, exp1_v, 2);
-            exp1 += expTableStride1;
-            exp1_v = vld2q_lane_f32((const float32_t*) exp1, exp1_v, 3);
-            exp1 += expTableStride1;
-
-            float32x4x2_t exp2_v;
-            exp2_v = vld2q_lane_f32((const float32_t*) exp2, exp2_v, 0);
-            exp2 += expTableStride2;
-            exp2_v = vld2q_lane_f32((const float32_t*) exp2, exp2_v, 1);
-            exp2 += expTableStride2;
-            exp2_v = vld2q_lane_f32((const float32_t*) exp2, exp2_v, 2);
-            exp2 += expTableStride2;
-            exp2_v = vld2q_lane_f32((const float32_t*) exp2, exp2_v, 3);
-            exp2 += expTableStride2;
-
-            float32x4x2_t exp3_v;
-            exp3_v = vld2q_lane_f32((const float32_t*) exp3, exp3_v, 0);
-            exp3 += expTableStride3;
-            exp3_v = vld2q_lane_f32((const float32_t*) exp3, exp3_v, 1);
-            exp3 += expTableStride3;
-            exp3_v = vld2q_lane_f32((const float32_t*) exp3, exp3_v, 2);
-            exp3 += expTableStride3;
-            exp3_v = vld2q_lane_f32((const float32_t*) exp3, exp3_v, 3);
-            exp3 += expTableStride3;
-
-            // TODO use vmla, vmls?
-            // alignment?
-
-            multiply(out1_v, exp1_v, f1w_v);
-            multiply(out2_v, exp2_v, f2w2_v);
-            multiply(out3_v, exp3_v, f3w3_v);
-
-            add(out0_v, f2w2_v, sum02_v);
-            subtract(out0_v, f2w2_v, diff02_v);
-            add(f1w_v, f3w3_v, sum13_v);
-            subtract(f1w_v, f3w3_v, diff13_v);
-
-            add(sum02_v, sum13_v, out0_v);
-            subtract(sum02_v, sum13_v, out2_v);
-
-            // TODO optimize this?
-            if (inverse)
-            {
-                out1_v.val[0] = vsubq_f32(diff02_v.val[0], diff13_v.val[1]);
-                out1_v.val[1] = vaddq_f32(diff02_v.val[1], diff13_v.val[0]);
-                out3_v.val[0] = vaddq_f32(diff02_v.val[0], diff13_v.val[1]);
-                out3_v.val[1] = vsubq_f32(diff02_v.val[1], diff13_v.val[0]);
-            }
-            else
-            {
-                out1_v.val[0] = vaddq_f32(diff02_v.val[0], diff13_v.val[1]);
-                out1_v.val[1] = vsubq_f32(diff02_v.val[1], diff13_v.val[0]);
-                out3_v.val[0] = vsubq_f32(diff02_v.val[0], diff13_v.val[1]);
-                out3_v.val[1] = vaddq_f32(diff02_v.val[1], diff13_v.val[0]);
-            }
+            radix4_neon(p, p + 2*n, p + n, p + 3*n, 
+                        p, p + n, p + 2*n, p + 3*n, 
+                        n, inverse, expTable, expTableStride1, (n4 == count ? scale : 1.0f));
+            p += n4;
+        }
+        n = n4;
+    }
+}
 
-            vst2q_f32((float32_t*) out0, out0_v);
-            vst2q_f32((float32_t*) out1, out1_v);
-            vst2q_f32((float32_t*) out2, out2_v);
-            vst2q_f32((float32_t*) out3, out3_v);
+void fft_dif_neon(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        CkFftComplex* output, 
+        CkFftSize count, 
+        bool inverse,
+        const CkFftComplex* expTable,
+        CkFftSize expTableStride,
+        float scale)
+{
+    if (count < 16)
+    {
+        fft_dif_default(context, input, output, count, inverse, expTable, expTableStride, scale);
+        return;
+    }
 
-            out0 += 4;
-            out1 += 4;
-            out2 += 4;
-            out3 += 4;
+    // the first step reads from the input; the rest are in place in the output
+    const CkFftComplex* in = input;
+    CkFftSize n = count / 4;
+    while (n >= 4)
+    {
+        // write sub-DFTs in the order Y0, Y2, Y1, Y3 (see fft_dif_stage_default())
+        CkFftSize n4 = n * 4;
+        CkFftSize expTableStride1 = expTableStride * (count / n4);
+        const CkFftComplex* p = in;
+        CkFftComplex* q = output;
+        CkFftComplex* qEnd = output + count;
+        while (q < qEnd)
+        {
+            radix4_dif_neon(p, p + n, p + 2*n, p + 3*n, 
+                            q, q + 2*n, q + n, q + 3*n, 
+                            n, inverse, expTable, expTableStride1, 1.0f);
+            p += n4;
+            q += n4;
         }
+        in = output;
+        n /= 4;
+    }
+
+    // last steps, with sub-DFTs too small to vectorize; the last step applies the scale
+    bool pow4 = isPowerOfFour(count);
+    while (n > 0)
+    {
+        fft_dif_stage_default(output, output, count, n, inverse, expTable, expTableStride, (pow4 && n == 1 ? scale : 1.0f));
+        n /= 4;
+    }
+    if (!pow4)
+    {
+        fft_radix2_stage_default(output, output, count, scale);
     }
 }
 
@@ -261,11 +568,55 @@ void fft_neon(
         CkFftContext* context, 
         const CkFftComplex* input, 
         CkFftComplex* output, 
-        int count, 
+        CkFftSize count, 
+        bool inverse,
+        CkFftSize stride, 
+        const CkFftComplex* expTable,
+        CkFftSize expTableStride,
+        float scale)
+{}
+
+void fft_inplace_neon(
+        CkFftContext* context, 
+        CkFftComplex* data, 
+        CkFftSize count, 
+        bool inverse,
+        const CkFftComplex* expTable,
+        CkFftSize expTableStride,
+        float scale)
+{}
+
+void fft_dit_neon(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        CkFftComplex* output, 
+        CkFftSize count, 
+        bool inverse,
+        const CkFftComplex* expTable,
+        CkFftSize expTableStride,
+        float scale)
+{}
+
+void fft_dit_steps_neon(
+        CkFftContext* context, 
+        CkFftComplex* data, 
+        CkFftSize count, 
+        CkFftSize n, 
+        bool inverse,
+        const CkFftComplex* expTable,
+        CkFftSize expTableStride,
+        float scale)
+{}
+
+void fft_dif_neon(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        CkFftComplex* output, 
+        CkFftSize count, 
         bool inverse,
-        int stride, 
         const CkFftComplex* expTable,
-        int expTableStride)
+        CkFftSize expTableStride,
+        float scale)
 {}
 
 #endif // CKFFT_ARM_NEON
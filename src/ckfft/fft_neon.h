@@ -9,11 +9,54 @@ void fft_neon(
         CkFftContext* context, 
         const CkFftComplex* input, 
         CkFftComplex* output, 
-        int count, 
+        CkFftSize count, 
         bool inverse,
-        int stride, 
+        CkFftSize stride, 
         const CkFftComplex* expTable,
-        int expTableStride);
+        CkFftSize expTableStride,
+        float scale);
+
+// In-place FFT; see fft_inplace_default().
+void fft_inplace_neon(
+        CkFftContext* context, 
+        CkFftComplex* data, 
+        CkFftSize count, 
+        bool inverse,
+        const CkFftComplex* expTable,
+        CkFftSize expTableStride,
+        float scale);
+
+// Unordered FFTs; see fft_dit_default() and fft_dif_default().
+void fft_dit_neon(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        CkFftComplex* output, 
+        CkFftSize count, 
+        bool inverse,
+        const CkFftComplex* expTable,
+        CkFftSize expTableStride,
+        float scale);
+
+// see fft_dit_steps_default()
+void fft_dit_steps_neon(
+        CkFftContext* context, 
+        CkFftComplex* data, 
+        CkFftSize count, 
+        CkFftSize n, 
+        bool inverse,
+        const CkFftComplex* expTable,
+        CkFftSize expTableStride,
+        float scale);
+
+void fft_dif_neon(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        CkFftComplex* output, 
+        CkFftSize count, 
+        bool inverse,
+        const CkFftComplex* expTable,
+        CkFftSize expTableStride,
+        float scale);
 
 }
 
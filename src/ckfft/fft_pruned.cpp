@@ -0,0 +1,310 @@
+#include "ckfft/platform.h"
+
+// before anything includes math.h
+#if CKFFT_PLATFORM_WIN
+#  define _USE_MATH_DEFINES
+#endif
+
+#include "ckfft/debug.h"
+#include "ckfft/fft_pruned.h"
+#include "ckfft/fft_neon.h"
+#include "ckfft/fft_default.h"
+#include "ckfft/math_util.h"
+#include "ckfft/context.h"
+#include <math.h>
+
+namespace ckfft
+{
+
+namespace
+{
+
+CkFftSize getLog2(CkFftSize count)
+{
+    CkFftSize bits = 0;
+    while (count > 1)
+    {
+        count >>= 1;
+        ++bits;
+    }
+    return bits;
+}
+
+// One bin of a DFT of size count, of which the first inputCount input values may be
+// nonzero, with the Goertzel recurrence: s[j] = x[j] + 2*cos(w)*s[j-1] - s[j-2],
+// where W = exp(-I*w) (or exp(I*w) for inverse FFTs) is the twiddle factor for
+// the bin.  Then s[L-1] - W*s[L-2] (where L = inputCount) is the sum of
+// x[j]*W^-(L-1-j), so multiplying it by W^(L-1) gives the bin.  This needs half
+// the multiplications of a direct sum, and no table lookups in the loop.  Errors 
+// in cos(w) and W are multiplied by up to L/sin(w), so they and the recurrence are
+// in double precision, rather than taken from the float table.
+CkFftComplex goertzel(
+        const CkFftComplex* input,
+        CkFftSize inputCount,
+        CkFftSize count,
+        CkFftSize bin,
+        bool inverse,
+        const CkFftComplex* expTable,
+        CkFftSize expTableStride,
+        float scale)
+{
+    double theta = 2.0 * M_PI * (double) bin / (double) count;
+    double wReal = cos(theta);
+    double wImag = (inverse ? sin(theta) : -sin(theta));
+    double coef = 2.0 * wReal;
+    double s1Real = 0.0;
+    double s1Imag = 0.0;
+    double s2Real = 0.0;
+    double s2Imag = 0.0;
+    const CkFftComplex* in = input;
+    const CkFftComplex* inEnd = input + inputCount;
+    while (in < inEnd)
+    {
+        double s0Real = in->real + coef * s1Real - s2Real;
+        double s0Imag = in->imag + coef * s1Imag - s2Imag;
+        s2Real = s1Real;
+        s2Imag = s1Imag;
+        s1Real = s0Real;
+        s1Imag = s0Imag;
+        ++in;
+    }
+
+    // y = s1 - W*s2
+    double yReal = s1Real - (wReal * s2Real - wImag * s2Imag);
+    double yImag = s1Imag - (wReal * s2Imag + wImag * s2Real);
+
+    // W^(L-1)
+    CkFftSize phaseIndex = (CkFftSize) (((unsigned long long) (inputCount - 1) * bin) & (count - 1));
+    const CkFftComplex& phase = expTable[phaseIndex * expTableStride];
+
+    CkFftComplex out;
+    out.real = (float) ((yReal * phase.real - yImag * phase.imag) * scale);
+    out.imag = (float) ((yReal * phase.imag + yImag * phase.real) * scale);
+    return out;
+}
+
+// In-place FFT of the pre-twiddled values, with no scaling.
+void subFft(
+        CkFftContext* context,
+        CkFftComplex* data,
+        CkFftSize count,
+        bool inverse,
+        const CkFftComplex* expTable)
+{
+    if (count == 2)
+    {
+        CkFftComplex in0 = data[0];
+        CkFftComplex in1 = data[1];
+        add(in0, in1, data[0]);
+        subtract(in0, in1, data[1]);
+    }
+    else if (count > 2)
+    {
+        if (context->neon)
+        {
+            fft_inplace_neon(context, data, count, inverse, expTable, context->maxCount / count, 1.0f);
+        }
+        else
+        {
+            fft_inplace_default(context, data, count, inverse, expTable, context->maxCount / count, 1.0f);
+        }
+    }
+}
+
+// In-place FFT of the pre-twiddled values, with no scaling, of which only the 
+// rangeCount outputs starting at first (mod count) are needed; the others are left
+// undefined.  After the bit-reversal permutation, the last decimation-in-time 
+// steps combine pairs of sub-DFTs of size h into DFTs of size 2*h, and only the 
+// butterflies for outputs k with k mod h in the range are needed; so the sub-DFTs
+// are computed in full only up to the smallest size that is at least rangeCount,
+// and each step after that does rangeCount butterflies per pair.
+void subFftRange(
+        CkFftContext* context,
+        CkFftComplex* data,
+        CkFftSize count,
+        CkFftSize first,
+        CkFftSize rangeCount,
+        bool inverse,
+        const CkFftComplex* expTable)
+{
+    CkFftSize fullCount = fft_pruned_buf_count(rangeCount);
+    if (fullCount >= count)
+    {
+        subFft(context, data, count, inverse, expTable);
+        return;
+    }
+
+    bitReverse(data, count);
+    if (fullCount > 1)
+    {
+        for (CkFftComplex* p = data; p < data + count; p += fullCount)
+        {
+            if (context->neon)
+            {
+                fft_dit_neon(context, p, p, fullCount, inverse, expTable, context->maxCount / fullCount, 1.0f);
+            }
+            else
+            {
+                fft_dit_default(context, p, p, fullCount, inverse, expTable, context->maxCount / fullCount, 1.0f);
+            }
+        }
+    }
+
+    // radix-2 steps, for the range only:
+    //   X[k] = E[k] + W^k*O[k]
+    //   X[k+h] = E[k] - W^k*O[k]
+    for (CkFftSize h = fullCount; h < count; h *= 2)
+    {
+        CkFftSize expTableStride = context->maxCount / (h * 2);
+        CkFftSize hMask = h - 1;
+        for (CkFftComplex* e = data; e < data + count; e += h * 2)
+        {
+            CkFftComplex* o = e + h;
+            CkFftSize k = first & hMask;
+            for (CkFftSize i = 0; i < rangeCount; ++i)
+            {
+                CkFftComplex ow;
+                multiply(o[k], expTable[k * expTableStride], ow);
+                CkFftComplex ek = e[k];
+                add(ek, ow, e[k]);
+                subtract(ek, ow, o[k]);
+                k = (k + 1) & hMask;
+            }
+        }
+    }
+}
+
+}
+
+bool fft_pruned_goertzel(CkFftSize count, CkFftSize inputCount, CkFftSize binCount)
+{
+    // Compare the approximate numbers of floating-point operations: 6 per input
+    // value for each bin with the Goertzel recurrence, and 5*m*log2(m) for each
+    // FFT of size m, plus 7*m for the pre-twiddles.
+    CkFftSize subCount = fft_pruned_buf_count(inputCount);
+    CkFftSize subFftCount = count / subCount;
+    if (subFftCount > binCount)
+    {
+        subFftCount = binCount;
+    }
+    double goertzelOps = 6.0 * inputCount * binCount;
+    double fftOps = (double) subFftCount * subCount * (5 * getLog2(subCount) + 7);
+    return goertzelOps < fftOps;
+}
+
+CkFftSize fft_pruned_buf_count(CkFftSize inputCount)
+{
+    CkFftSize subCount = 1;
+    while (subCount < inputCount)
+    {
+        subCount *= 2;
+    }
+    return subCount;
+}
+
+void fft_pruned(
+        CkFftContext* context,
+        const CkFftComplex* input,
+        CkFftSize inputCount,
+        CkFftSize count,
+        CkFftSize firstBin,
+        const CkFftSize* bins,
+        CkFftSize binCount,
+        CkFftComplex* output,
+        bool inverse,
+        CkFftComplex* tmpBuf)
+{
+    const CkFftComplex* expTable = (inverse ? context->invExpTable : context->fwdExpTable);
+    CkFftSize expTableStride = context->maxCount / count;
+    CkFftSize mask = count - 1;
+    float scale = context->getScale(count, inverse);
+
+    if (fft_pruned_goertzel(count, inputCount, binCount))
+    {
+        // few bins: evaluate each separately
+        for (CkFftSize i = 0; i < binCount; ++i)
+        {
+            CkFftSize bin = (bins ? bins[i] : (firstBin + i) & mask);
+            output[i] = goertzel(input, inputCount, count, bin, inverse, expTable, expTableStride, scale);
+        }
+        return;
+    }
+
+    // With only the first subCount inputs nonzero, the first log2(count/subCount)
+    // decimation-in-frequency steps would only twiddle the inputs and copy them
+    // into count/subCount sub-FFTs of size subCount, which give the bins with each
+    // residue r modulo count/subCount:
+    //
+    //   X[r + q*subFftCount] = sum of x[j] * W^(j*r) * Wsub^(j*q), for j < subCount
+    //
+    // So those steps are replaced by one pass of pre-twiddles, and only the
+    // sub-FFTs that give requested bins are computed.
+    CkFftSize subCount = fft_pruned_buf_count(inputCount);
+    CkFftSize subFftCount = count / subCount;
+    CkFftSize residueMask = subFftCount - 1;
+    CkFftSize residueShift = getLog2(subFftCount);
+    for (CkFftSize r = 0; r < subFftCount; ++r)
+    {
+        // first requested bin with this residue, if any
+        CkFftSize first = 0;
+        if (bins)
+        {
+            while (first < binCount && (bins[first] & residueMask) != r)
+            {
+                ++first;
+            }
+        }
+        else
+        {
+            first = (r - firstBin) & residueMask;
+        }
+        if (first >= binCount)
+        {
+            continue;
+        }
+
+        // pre-twiddles, with the scale, and zero-padding
+        CkFftSize expIndex = 0;
+        CkFftSize expStep = r * expTableStride;
+        CkFftSize expMask = context->maxCount - 1;
+        CkFftComplex tmp;
+        for (CkFftSize j = 0; j < inputCount; ++j)
+        {
+            multiply(input[j], expTable[expIndex], tmp);
+            multiply(tmp, scale, tmpBuf[j]);
+            expIndex = (expIndex + expStep) & expMask;
+        }
+        for (CkFftSize j = inputCount; j < subCount; ++j)
+        {
+            tmpBuf[j].real = 0.0f;
+            tmpBuf[j].imag = 0.0f;
+        }
+
+        // copy the requested bins; for a range, they are consecutive in the sub-FFT,
+        // so only those outputs are computed
+        if (bins)
+        {
+            subFft(context, tmpBuf, subCount, inverse, expTable);
+            for (CkFftSize i = first; i < binCount; ++i)
+            {
+                if ((bins[i] & residueMask) == r)
+                {
+                    output[i] = tmpBuf[bins[i] >> residueShift];
+                }
+            }
+        }
+        else
+        {
+            CkFftSize rangeFirst = ((firstBin + first) & mask) >> residueShift;
+            CkFftSize rangeCount = (binCount - first + residueMask) >> residueShift;
+            subFftRange(context, tmpBuf, subCount, rangeFirst, rangeCount, inverse, expTable);
+            for (CkFftSize i = first; i < binCount; i += subFftCount)
+            {
+                output[i] = tmpBuf[((firstBin + i) & mask) >> residueShift];
+            }
+        }
+    }
+}
+
+} // namespace ckfft
+
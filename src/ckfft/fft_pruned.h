@@ -0,0 +1,34 @@
+#pragma once
+#include "ckfft/ckfft.h"
+
+
+namespace ckfft
+{
+
+// FFT of count values, of which only the first inputCount may be nonzero (the rest
+// are taken to be zero, and are not read), computing only some of the output bins:
+// output[i] is bin bins[i], or, if bins is NULL, bin (firstBin + i) mod count, for
+// i from 0 to binCount-1.  The output must not be the same buffer as the input.
+// Unless fft_pruned_goertzel() is true, tmpBuf must contain
+// fft_pruned_buf_count(inputCount) complex values.
+void fft_pruned(
+        CkFftContext* context,
+        const CkFftComplex* input,
+        CkFftSize inputCount,
+        CkFftSize count,
+        CkFftSize firstBin,
+        const CkFftSize* bins,
+        CkFftSize binCount,
+        CkFftComplex* output,
+        bool inverse,
+        CkFftComplex* tmpBuf);
+
+// Whether fft_pruned() will evaluate each bin separately, rather than using FFTs.
+bool fft_pruned_goertzel(CkFftSize count, CkFftSize inputCount, CkFftSize binCount);
+
+// The size of the FFTs used by fft_pruned(): the smallest power of 2 that is at
+// least inputCount.
+CkFftSize fft_pruned_buf_count(CkFftSize inputCount);
+
+}
+
@@ -1,6 +1,9 @@
 #include "ckfft/platform.h"
 #include "ckfft/debug.h"
 #include "ckfft/fft.h"
+#include "ckfft/fft_default.h"
+#include "ckfft/fft_neon.h"
+#include "ckfft/convert.h"
 #include "ckfft/fft_real_default.h"
 #include "ckfft/fft_real_neon.h"
 #include "ckfft/math_util.h"
@@ -12,94 +15,322 @@ namespace ckfft
 
 void fft_real(CkFftContext* context, 
          const float* input, 
+         CkFftSize inputStride,
          CkFftComplex* output, 
-         int count)
+         CkFftSize count,
+         bool packed)
 {
+    if (inputStride != 1 && count <= 4)
+    {
+        // small FFTs with strided input: gather into a local buffer first
+        float buf[4];
+        for (CkFftSize i = 0; i < count; ++i)
+        {
+            buf[i] = input[i * inputStride];
+        }
+        fft_real(context, buf, 1, output, count, packed);
+        return;
+    }
+
+    // (real FFTs of size n are scaled like complex FFTs of size 2*n; see CkFftSetScale())
+    float scale = context->getScale(count * 2, false);
+
     // handle trivial cases here, so we don't have to check for them in fft_real_default
     // scale by 2 to match what fft_real_default would produce
+    float scale2 = 2.0f * scale;
     if (count == 1)
     {
-        output->real = *input * 2.0f;
+        output->real = *input * scale2;
         output->imag = 0.0f;
     }
     else if (count == 2)
     {
         // radix-2
-        output[0].real = (input[0] + input[1]) * 2.0f;
-        output[0].imag = 0.0f;
-        output[1].real = (input[0] - input[1]) * 2.0f;
-        output[1].imag = 0.0f;
+        // (input may be the same buffer as output, so read it all first)
+        float sum = (input[0] + input[1]) * scale2;
+        float diff = (input[0] - input[1]) * scale2;
+        output[0].real = sum;
+        if (packed)
+        {
+            output[0].imag = diff;
+        }
+        else
+        {
+            output[0].imag = 0.0f;
+            output[1].real = diff;
+            output[1].imag = 0.0f;
+        }
     }
     else if (count == 4)
     {
         // radix-4 
-        float sum02 = (input[0] + input[2]) * 2.0f;
-        float diff02 = (input[0] - input[2]) * 2.0f;
-        float sum13 = (input[1] + input[3]) * 2.0f;
-        float diff13 = (input[1] - input[3]) * 2.0f;
+        float sum02 = (input[0] + input[2]) * scale2;
+        float diff02 = (input[0] - input[2]) * scale2;
+        float sum13 = (input[1] + input[3]) * scale2;
+        float diff13 = (input[1] - input[3]) * scale2;
         output[0].real = sum02 + sum13;
-        output[0].imag = 0.0f;
         output[1].real = diff02;
         output[1].imag = -diff13;
-        output[2].real = sum02 - sum13;
-        output[2].imag = 0.0f;
-        output[3].real = diff02;
-        output[3].imag = diff13;
+        if (packed)
+        {
+            output[0].imag = sum02 - sum13;
+        }
+        else
+        {
+            output[0].imag = 0.0f;
+            output[2].real = sum02 - sum13;
+            output[2].imag = 0.0f;
+        }
     }
     else
     {
         if (context->neon)
         {
-            fft_real_neon(context, input, output, count);
+            fft_real_neon(context, input, inputStride, output, count, packed, scale);
+        }
+        else
+        {
+            fft_real_default(context, input, inputStride, output, count, packed, scale);
+        }
+    }
+}
+
+void fft_real_int16(CkFftContext* context, 
+         const short* input, 
+         float inputScale,
+         CkFftComplex* output, 
+         CkFftSize count)
+{
+    if (count <= 4)
+    {
+        // small FFTs: convert into a local buffer first
+        float buf[4];
+        for (CkFftSize i = 0; i < count; ++i)
+        {
+            buf[i] = input[i] * inputScale;
+        }
+        fft_real(context, buf, 1, output, count, false);
+        return;
+    }
+
+    // the first step of the complex FFT reads and converts the input, in place of
+    // the bit-reversal step of an in-place FFT
+    CkFftSize countDiv2 = count / 2;
+    float scale = context->getScale(count * 2, false);
+    CkFftSize n = convert_int16(input, inputScale, output, countDiv2, false);
+    if (context->neon)
+    {
+        fft_dit_steps_neon(context, output, countDiv2, n, false, context->fwdExpTable, context->maxCount / countDiv2, 1.0f);
+        fft_real_post_neon(context, output, count, false, scale);
+    }
+    else
+    {
+        fft_dit_steps_default(context, output, countDiv2, n, false, context->fwdExpTable, context->maxCount / countDiv2, 1.0f);
+        fft_real_post_default(context, output, count, false, scale);
+    }
+}
+
+void fft_real_power(CkFftContext* context, 
+         const float* input, 
+         const float* window,
+         float* output, 
+         CkFftSize count,
+         SpectrumType type,
+         CkFftComplex* tmpBuf)
+{
+    if (count <= 4)
+    {
+        // small FFTs: compute the spectrum in a local buffer first
+        CkFftComplex buf[3];
+        if (window)
+        {
+            fft_real_windowed(context, input, window, buf, count);
+        }
+        else
+        {
+            fft_real(context, input, 1, buf, count, false);
+        }
+        for (CkFftSize i = 0; i <= count/2; ++i)
+        {
+            output[i] = convertPower(buf[i].real * buf[i].real + buf[i].imag * buf[i].imag, type);
+        }
+        return;
+    }
+
+    // complex FFT of the input pairs in tmpBuf, then post-processing straight to 
+    // the output values, so the complex spectrum is never stored; a window is 
+    // applied as the input is read into bit-reversed order, as for 
+    // fft_real_windowed()
+    CkFftSize countDiv2 = count / 2;
+    float scale = context->getScale(count * 2, false);
+    if (window)
+    {
+        convert_windowed(input, window, tmpBuf, countDiv2);
+    }
+    if (context->neon && (window || count >= 16))
+    {
+        if (window)
+        {
+            fft_dit_neon(context, tmpBuf, tmpBuf, countDiv2, false, context->fwdExpTable, context->maxCount / countDiv2, 1.0f);
+        }
+        else
+        {
+            fft_neon(context, (const CkFftComplex*) input, tmpBuf, countDiv2, false, 1, context->fwdExpTable, context->maxCount / countDiv2, 1.0f);
+        }
+        fft_real_post_power_neon(context, tmpBuf, output, count, type, scale);
+    }
+    else
+    {
+        if (window)
+        {
+            fft_dit_default(context, tmpBuf, tmpBuf, countDiv2, false, context->fwdExpTable, context->maxCount / countDiv2, 1.0f);
         }
         else
         {
-            fft_real_default(context, input, output, count);
+            fft_default(context, (const CkFftComplex*) input, tmpBuf, countDiv2, false, 1, context->fwdExpTable, context->maxCount / countDiv2, 1.0f);
         }
+        fft_real_post_power_default(context, tmpBuf, output, count, type, scale);
+    }
+}
+
+void fft_real_windowed(CkFftContext* context, 
+         const float* input, 
+         const float* window,
+         CkFftComplex* output, 
+         CkFftSize count)
+{
+    if (count <= 4)
+    {
+        // small FFTs: apply the window in a local buffer first
+        float buf[4];
+        for (CkFftSize i = 0; i < count; ++i)
+        {
+            buf[i] = input[i] * window[i];
+        }
+        fft_real(context, buf, 1, output, count, false);
+        return;
+    }
+
+    // apply the window as the input is read into bit-reversed order, in place of 
+    // the bit-reversal step of an in-place FFT
+    CkFftSize countDiv2 = count / 2;
+    float scale = context->getScale(count * 2, false);
+    convert_windowed(input, window, output, countDiv2);
+    if (context->neon)
+    {
+        fft_dit_neon(context, output, output, countDiv2, false, context->fwdExpTable, context->maxCount / countDiv2, 1.0f);
+        fft_real_post_neon(context, output, count, false, scale);
+    }
+    else
+    {
+        fft_dit_default(context, output, output, countDiv2, false, context->fwdExpTable, context->maxCount / countDiv2, 1.0f);
+        fft_real_post_default(context, output, count, false, scale);
     }
 }
 
 void fft_real_inverse(CkFftContext* context, 
          const CkFftComplex* input, 
          float* output, 
-         int count,
-         CkFftComplex* tmpBuf)
+         CkFftSize outputStride,
+         CkFftSize count,
+         CkFftComplex* tmpBuf,
+         bool packed)
 {
+    if (outputStride != 1 && count <= 4)
+    {
+        // small FFTs with strided output: compute in a local buffer first
+        float buf[4];
+        fft_real_inverse(context, input, buf, 1, count, NULL, packed);
+        for (CkFftSize i = 0; i < count; ++i)
+        {
+            output[i * outputStride] = buf[i];
+        }
+        return;
+    }
+
+    float scale = context->getScale(count * 2, true);
+
     // handle trivial cases here, so we don't have to check for them in fft_real_default
     if (count == 1)
     {
-        *output = input->real;
+        *output = input->real * scale;
     }
     else if (count == 2)
     {
         // radix-2 
-        output[0] = input[0].real + input[1].real;
-        output[1] = input[0].real - input[1].real;
+        // (input may be the same buffer as output, so read it all first)
+        float nyquist = (packed ? input[0].imag : input[1].real);
+        float sum = (input[0].real + nyquist) * scale;
+        float diff = (input[0].real - nyquist) * scale;
+        output[0] = sum;
+        output[1] = diff;
     }
     else if (count == 4)
     {
         // radix-4
-        // note that input[3] = input[1]*
-        float sum02_r = input[0].real + input[2].real;
-        float sum13_r = 2.0f * input[1].real;
-        CkFftComplex diff02;
-        subtract(input[0], input[2], diff02);
-        float diff13_i = 2.0f * input[1].imag;
+        // note that input[3] = input[1]*, and input[0] and input[2] are real
+        // (input may be the same buffer as output, so read it all first)
+        float nyquist = (packed ? input[0].imag : input[2].real);
+        float sum02_r = (input[0].real + nyquist) * scale;
+        float diff02_r = (input[0].real - nyquist) * scale;
+        float sum13_r = input[1].real * (2.0f * scale);
+        float diff13_i = input[1].imag * (2.0f * scale);
 
         output[0] = sum02_r + sum13_r;
-        output[1] = diff02.real - diff13_i;
+        output[1] = diff02_r - diff13_i;
         output[2] = sum02_r - sum13_r;
-        output[3] = diff02.real + diff13_i;
+        output[3] = diff02_r + diff13_i;
     }
     else
     {
         if (context->neon)
         {
-            fft_real_inverse_neon(context, input, output, count, tmpBuf);
+            fft_real_inverse_neon(context, input, output, outputStride, count, tmpBuf, packed, scale);
+        }
+        else
+        {
+            fft_real_inverse_default(context, input, output, outputStride, count, tmpBuf, packed, scale);
+        }
+    }
+}
+
+void fft_real_inverse_add(CkFftContext* context, 
+         const CkFftComplex* input, 
+         const float* window,
+         float* output0,
+         CkFftSize count0,
+         float* output1,
+         CkFftSize count,
+         CkFftComplex* tmpBuf)
+{
+    if (count >= 8)
+    {
+        // the last step of the complex FFT adds its output directly
+        float scale = context->getScale(count * 2, true);
+        if (context->neon)
+        {
+            fft_real_inverse_add_neon(context, input, window, output0, count0, output1, count, tmpBuf, scale);
+        }
+        else
+        {
+            fft_real_inverse_add_default(context, input, window, output0, count0, output1, count, tmpBuf, scale);
+        }
+        return;
+    }
+
+    // small FFTs: compute in a local buffer first
+    float buf[4];
+    fft_real_inverse(context, input, buf, 1, count, NULL, false);
+    for (CkFftSize i = 0; i < count; ++i)
+    {
+        float value = (window ? buf[i] * window[i] : buf[i]);
+        if (i < count0)
+        {
+            output0[i] += value;
         }
         else
         {
-            fft_real_inverse_default(context, input, output, count, tmpBuf);
+            output1[i - count0] += value;
         }
     }
 }
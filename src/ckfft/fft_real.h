@@ -1,21 +1,92 @@
 #pragma once
 #include "ckfft/ckfft.h"
+#include <math.h>
 
 
 namespace ckfft
 {
 
+// Values computed from each bin of a spectrum, for fft_real_power().
+enum SpectrumType
+{
+    k_spectrumPower,      // |X|^2
+    k_spectrumMagnitude,  // |X|
+    k_spectrumDecibels    // 10*log10(|X|^2)
+};
+
+// Convert a power value; decibels are limited to -200 dB, so silence doesn't 
+// give -infinity.
+inline float convertPower(float power, SpectrumType type)
+{
+    if (type == k_spectrumMagnitude)
+    {
+        return sqrtf(power);
+    }
+    else if (type == k_spectrumDecibels)
+    {
+        return 10.0f * log10f(power > 1.0e-20f ? power : 1.0e-20f);
+    }
+    return power;
+}
+
 void fft_real(
         CkFftContext* context, 
         const float* input, 
+        CkFftSize inputStride,
+        CkFftComplex* output, 
+        CkFftSize count,
+        bool packed);
+
+// Real FFT of 16-bit integer input, multiplied by inputScale.
+void fft_real_int16(
+        CkFftContext* context, 
+        const short* input, 
+        float inputScale,
+        CkFftComplex* output, 
+        CkFftSize count);
+
+// Real FFT of input multiplied by window.
+void fft_real_windowed(
+        CkFftContext* context, 
+        const float* input, 
+        const float* window,
         CkFftComplex* output, 
-        int count);
+        CkFftSize count);
 
 void fft_real_inverse(
         CkFftContext* context, 
         const CkFftComplex* input, 
         float* output, 
-        int count,
+        CkFftSize outputStride,
+        CkFftSize count,
+        CkFftComplex* tmpBuf,
+        bool packed);
+
+// Power spectrum (or magnitude or decibels) of the real FFT of input, multiplied
+// by window if it is not NULL, with count/2+1 values; the intermediate complex 
+// FFT is computed in tmpBuf, which must contain count/2 complex values.
+void fft_real_power(
+        CkFftContext* context, 
+        const float* input, 
+        const float* window,
+        float* output, 
+        CkFftSize count,
+        SpectrumType type,
+        CkFftComplex* tmpBuf);
+
+// Inverse real FFT of input, multiplied by window (if it is not NULL) and added 
+// to output.  So that the output can be a ring buffer, the first count0 values 
+// are added to output0, and the rest to output1.  The last step of the complex FFT
+// (in tmpBuf, which must contain count/2 complex values) adds each output value as
+// it is computed, so the real output is never stored.
+void fft_real_inverse_add(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        const float* window,
+        float* output0,
+        CkFftSize count0,
+        float* output1,
+        CkFftSize count,
         CkFftComplex* tmpBuf);
 
 }
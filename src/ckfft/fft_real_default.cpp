@@ -1,7 +1,9 @@
 #include "ckfft/platform.h"
 #include "ckfft/debug.h"
 #include "ckfft/fft_default.h"
+#include "ckfft/fft_real_default.h"
 #include "ckfft/context.h"
+#include "ckfft/context_double.h"
 #include "ckfft/math_util.h"
 #include <assert.h>
 
@@ -10,107 +12,468 @@ namespace ckfft
 
 // see http://www.engineeringproductivitytools.com/stuff/T0001/PT10.HTM
 
-void fft_real_default(
-        CkFftContext* context, 
-        const float* input, 
-        CkFftComplex* output, 
-        int count)
+namespace
 {
-    int countDiv2 = count / 2;
 
-    fft_default(context, (const CkFftComplex*) input, output, countDiv2, false, 1, context->fwdExpTable, context->maxCount / countDiv2);
+// Writes the results of realPost() as a complex spectrum; output may be the same 
+// buffer as the input.
+template <typename Complex, typename Real>
+struct ComplexWriter
+{
+    Complex* output;
+    bool packed;
+
+    void writeEnds(Real dc, Real nyquist, CkFftSize countDiv2)
+    {
+        output[0].real = dc;
+        if (packed)
+        {
+            output[0].imag = nyquist;
+        }
+        else
+        {
+            output[0].imag = 0;
+            output[countDiv2].real = nyquist;
+            output[countDiv2].imag = 0;
+        }
+    }
+
+    void write(CkFftSize i, const Complex& value)
+    {
+        output[i] = value;
+    }
+};
+
+// Writes the results of realPost() as power, magnitude, or decibels.
+struct PowerWriter
+{
+    float* output;
+    SpectrumType type;
+
+    void writeEnds(float dc, float nyquist, CkFftSize countDiv2)
+    {
+        output[0] = convertPower(dc * dc, type);
+        output[countDiv2] = convertPower(nyquist * nyquist, type);
+    }
+
+    void write(CkFftSize i, const CkFftComplex& value)
+    {
+        output[i] = convertPower(value.real * value.real + value.imag * value.imag, type);
+    }
+};
+
+// Real FFT post-processing (see fft_real_post_default()), for CkFftComplex with
+// Real float, or CkFftComplexD with Real double; the results are passed to writer.
+template <typename Complex, typename Real, typename Writer>
+void realPost(
+        const Complex* expTable, 
+        CkFftSize maxCount,
+        const Complex* input, 
+        Writer& writer,
+        CkFftSize count,
+        Real scale)
+{
+    CkFftSize countDiv2 = count / 2;
 
-    output[countDiv2] = output[0];
+    // first element (exp0 is 1); it gives the real DC and Nyquist values
+    Complex first = input[0];
+    Real scale2 = 2 * scale;
+    Real dc = (first.real + first.imag) * scale2;
+    Real nyquist = (first.real - first.imag) * scale2;
+    writer.writeEnds(dc, nyquist, countDiv2);
 
-    int expTableStride = context->maxCount/count;
-    const CkFftComplex* exp0 = context->fwdExpTable;
-    const CkFftComplex* exp1 = context->fwdExpTable + countDiv2 * expTableStride;
+    CkFftSize expTableStride = maxCount/count;
+    const Complex* exp0 = expTable + expTableStride;
+    const Complex* exp1 = expTable + (countDiv2 - 1) * expTableStride;
 
-    int countDiv4 = count / 4;
-    for (int i = 0; i < countDiv4; ++i)
+    CkFftSize countDiv4 = count / 4;
+    for (CkFftSize i = 1; i < countDiv4; ++i)
     {
-        CkFftComplex z0 = output[i];
-        CkFftComplex z1 = output[countDiv2 - i];
+        Complex z0 = input[i];
+        Complex z1 = input[countDiv2 - i];
 
-        CkFftComplex sum;
-        CkFftComplex diff;
-        CkFftComplex f;
-        CkFftComplex c;
+        Complex sum;
+        Complex diff;
+        Complex f;
+        Complex c;
+        Complex value;
 
         sum.real = z0.real + z1.real;
         sum.imag = z0.imag - z1.imag;
         diff.real = z0.real - z1.real;
         diff.imag = z0.imag + z1.imag;
+        if (scale != 1)
+        {
+            multiply(sum, scale, sum);
+            multiply(diff, scale, diff);
+        }
         f.real = -(exp0->imag);
         f.imag = exp0->real;
         multiply(f, diff, c);
-        subtract(sum, c, output[i]);
+        subtract(sum, c, value);
+        writer.write(i, value);
 
         diff.real = -diff.real;
         sum.imag = -sum.imag;
         f.real = -(exp1->imag);
         f.imag = exp1->real;
         multiply(f, diff, c);
-        subtract(sum, c, output[countDiv2 - i]);
+        subtract(sum, c, value);
+        writer.write(countDiv2 - i, value);
 
         exp0 += expTableStride;
         exp1 -= expTableStride;
     }
 
     // middle:
-    output[countDiv4].real = output[countDiv4].real * 2.0f;
-    output[countDiv4].imag = -output[countDiv4].imag * 2.0f;
+    Complex middle;
+    middle.real = input[countDiv4].real * scale2;
+    middle.imag = -input[countDiv4].imag * scale2;
+    writer.write(countDiv4, middle);
 }
 
-void fft_real_inverse_default(
-        CkFftContext* context, 
-        const CkFftComplex* input, 
-        float* output, 
-        int count,
-        CkFftComplex* tmpBuf)
+// Real inverse FFT pre-processing, writing the input of the complex inverse FFT of 
+// size count/2 to buf, which may be the same as input.
+template <typename Complex, typename Real>
+void realPre(
+        const Complex* expTable, 
+        CkFftSize maxCount,
+        const Complex* input, 
+        Complex* buf, 
+        CkFftSize count,
+        bool packed,
+        Real scale)
 {
-    int countDiv2 = count / 2;
+    CkFftSize countDiv2 = count / 2;
+
+    // first element (exp0 is 1), from the DC and Nyquist values; its mirror, 
+    // buf[countDiv2], is not used by the FFT
+    Complex first0 = input[0];
+    Complex first1;
+    if (packed)
+    {
+        first1.real = first0.imag;
+        first1.imag = 0;
+        first0.imag = 0;
+    }
+    else
+    {
+        first1 = input[countDiv2];
+    }
+    buf[0].real = ((first0.real + first1.real) - (first0.imag + first1.imag)) * scale;
+    buf[0].imag = ((first0.imag - first1.imag) + (first0.real - first1.real)) * scale;
 
-    int expTableStride = context->maxCount/count;
-    const CkFftComplex* exp0 = context->invExpTable;
-    const CkFftComplex* exp1 = context->invExpTable + countDiv2 * expTableStride;
+    CkFftSize expTableStride = maxCount/count;
+    const Complex* exp0 = expTable + expTableStride;
+    const Complex* exp1 = expTable + (countDiv2 - 1) * expTableStride;
 
-    int countDiv4 = count / 4;
-    for (int i = 0; i < countDiv4; ++i)
+    CkFftSize countDiv4 = count / 4;
+    for (CkFftSize i = 1; i < countDiv4; ++i)
     {
-        CkFftComplex z0 = input[i];
-        CkFftComplex z1 = input[countDiv2 - i];
+        Complex z0 = input[i];
+        Complex z1 = input[countDiv2 - i];
 
-        CkFftComplex sum;
-        CkFftComplex diff;
-        CkFftComplex f;
-        CkFftComplex c;
+        Complex sum;
+        Complex diff;
+        Complex f;
+        Complex c;
 
         sum.real = z0.real + z1.real;
         sum.imag = z0.imag - z1.imag;
         diff.real = z0.real - z1.real;
         diff.imag = z0.imag + z1.imag;
+        if (scale != 1)
+        {
+            multiply(sum, scale, sum);
+            multiply(diff, scale, diff);
+        }
         f.real = -(exp0->imag);
         f.imag = exp0->real;
         multiply(f, diff, c);
-        add(sum, c, tmpBuf[i]);
+        add(sum, c, buf[i]);
 
         diff.real = -diff.real;
         sum.imag = -sum.imag;
         f.real = -(exp1->imag);
         f.imag = exp1->real;
         multiply(f, diff, c);
-        add(sum, c, tmpBuf[countDiv2 - i]);
+        add(sum, c, buf[countDiv2 - i]);
 
         exp0 += expTableStride;
         exp1 -= expTableStride;
     }
 
     // middle:
-    tmpBuf[countDiv4].real = input[countDiv4].real * 2.0f;
-    tmpBuf[countDiv4].imag = -input[countDiv4].imag * 2.0f;
+    Complex middle = input[countDiv4];
+    Real scale2 = 2 * scale;
+    buf[countDiv4].real = middle.real * scale2;
+    buf[countDiv4].imag = -middle.imag * scale2;
+}
+
+// Multiplies the real output values of an inverse real FFT by a window (if it is 
+// not NULL), and adds them to a ring buffer: the first count0 values to output0, 
+// and the rest to output1.
+struct RingAdder
+{
+    const float* window;
+    float* output0;
+    CkFftSize count0;
+    float* output1;
+
+    // add output value j
+    void add(CkFftSize j, float value)
+    {
+        if (window)
+        {
+            value *= window[j];
+        }
+        if (j < count0)
+        {
+            output0[j] += value;
+        }
+        else
+        {
+            output1[j - count0] += value;
+        }
+    }
+
+    // add complex output value i of the half-size FFT, which is the pair of real
+    // output values 2*i and 2*i+1
+    void add(CkFftSize i, const CkFftComplex& value)
+    {
+        add(2*i, value.real);
+        add(2*i + 1, value.imag);
+    }
+};
+
+}
+
+void fft_real_default(
+        CkFftContext* context, 
+        const float* input, 
+        CkFftSize inputStride,
+        CkFftComplex* output, 
+        CkFftSize count,
+        bool packed,
+        float scale)
+{
+    CkFftSize countDiv2 = count / 2;
+
+    if (inputStride != 1)
+    {
+        // gather the input directly into bit-reversed order, in place of the 
+        // bit-reversal step of an in-place FFT
+        fft_real_gather_default(input, inputStride, output, countDiv2);
+        fft_dit_default(context, output, output, countDiv2, false, context->fwdExpTable, context->maxCount / countDiv2, 1.0f);
+    }
+    else if ((const void*) input == (void*) output)
+    {
+        fft_inplace_default(context, output, countDiv2, false, context->fwdExpTable, context->maxCount / countDiv2, 1.0f);
+    }
+    else
+    {
+        fft_default(context, (const CkFftComplex*) input, output, countDiv2, false, 1, context->fwdExpTable, context->maxCount / countDiv2, 1.0f);
+    }
+
+    fft_real_post_default(context, output, count, packed, scale);
+}
+
+void fft_real_post_default(
+        CkFftContext* context, 
+        CkFftComplex* output, 
+        CkFftSize count,
+        bool packed,
+        float scale)
+{
+    ComplexWriter<CkFftComplex, float> writer = { output, packed };
+    realPost(context->fwdExpTable, context->maxCount, output, writer, count, scale);
+}
+
+void fft_real_post_power_default(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        float* output, 
+        CkFftSize count,
+        SpectrumType type,
+        float scale)
+{
+    PowerWriter writer = { output, type };
+    realPost(context->fwdExpTable, context->maxCount, input, writer, count, scale);
+}
+
+void fft_real_post_default(
+        CkFftContextD* context, 
+        CkFftComplexD* output, 
+        CkFftSize count)
+{
+    ComplexWriter<CkFftComplexD, double> writer = { output, false };
+    realPost(context->fwdExpTable, context->maxCount, output, writer, count, 1.0);
+}
+
+void fft_real_pre_default(
+        CkFftContextD* context, 
+        const CkFftComplexD* input, 
+        CkFftComplexD* buf, 
+        CkFftSize count)
+{
+    realPre(context->invExpTable, context->maxCount, input, buf, count, false, 1.0);
+}
+
+void fft_real_inverse_default(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        float* output, 
+        CkFftSize outputStride,
+        CkFftSize count,
+        CkFftComplex* tmpBuf,
+        bool packed,
+        float scale)
+{
+    CkFftSize countDiv2 = count / 2;
+
+    // without a temp buffer, the complex FFT is done in place in the output buffer
+    // (which may also be the input buffer)
+    CkFftComplex* buf = (tmpBuf ? tmpBuf : (CkFftComplex*) output);
+
+    realPre(context->invExpTable, context->maxCount, input, buf, count, packed, scale);
+
+    if (outputStride != 1)
+    {
+        // transform in the temp buffer, then write to the strided output
+        assert(tmpBuf);
+        fft_inplace_default(context, tmpBuf, countDiv2, true, context->invExpTable, context->maxCount / countDiv2, 1.0f);
+        fft_real_scatter_default(tmpBuf, output, outputStride, countDiv2);
+    }
+    else if (tmpBuf)
+    {
+        fft_default(context, tmpBuf, (CkFftComplex*) output, countDiv2, true, 1, context->invExpTable, context->maxCount / countDiv2, 1.0f);
+    }
+    else
+    {
+        fft_inplace_default(context, buf, countDiv2, true, context->invExpTable, context->maxCount / countDiv2, 1.0f);
+    }
+}
+
+void fft_real_inverse_add_default(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        const float* window,
+        float* output0,
+        CkFftSize count0,
+        float* output1,
+        CkFftSize count,
+        CkFftComplex* tmpBuf,
+        float scale)
+{
+    CkFftSize countDiv2 = count / 2;
+    CkFftSize n = countDiv2 / 4;
+    const CkFftComplex* expTable = context->invExpTable;
+
+    // After the bit-reversal permutation, the steps of the complex inverse FFT of 
+    // size count/2 before the last are FFTs of size count/8 of each quarter.
+    realPre(expTable, context->maxCount, input, tmpBuf, count, false, scale);
+    bitReverse(tmpBuf, countDiv2);
+    if (n > 1)
+    {
+        for (int q = 0; q < 4; ++q)
+        {
+            fft_dit_default(context, tmpBuf + q*n, tmpBuf + q*n, n, true, expTable, context->maxCount / n, 1.0f);
+        }
+    }
+
+    // The last step: radix-4 butterflies (see radix4() in fft_default.cpp) on the 
+    // quarters, which are in the order F0, F2, F1, F3 (see fft_dit_stage_default()),
+    // passing each output to the adder rather than storing it.
+    RingAdder adder = { window, output0, count0, output1 };
+    const CkFftComplex* f0 = tmpBuf;
+    const CkFftComplex* f1 = tmpBuf + 2*n;
+    const CkFftComplex* f2 = tmpBuf + n;
+    const CkFftComplex* f3 = tmpBuf + 3*n;
+    const CkFftComplex* exp1 = expTable;
+    const CkFftComplex* exp2 = expTable;
+    const CkFftComplex* exp3 = expTable;
+    CkFftSize expTableStride1 = context->maxCount / countDiv2;
+    CkFftSize expTableStride2 = expTableStride1 * 2;
+    CkFftSize expTableStride3 = expTableStride1 * 3;
+
+    CkFftComplex f1w, f2w2, f3w3;
+    CkFftComplex sum02, diff02, sum13, diff13;
+    CkFftComplex x;
+    for (CkFftSize i = 0; i < n; ++i)
+    {
+        multiply(f1[i], *exp1, f1w);
+        multiply(f2[i], *exp2, f2w2);
+        multiply(f3[i], *exp3, f3w3);
+
+        add(f0[i], f2w2, sum02);
+        subtract(f0[i], f2w2, diff02);
+        add(f1w, f3w3, sum13);
+        subtract(f1w, f3w3, diff13);
+
+        add(sum02, sum13, x);
+        adder.add(i, x);
+
+        x.real = diff02.real - diff13.imag;
+        x.imag = diff02.imag + diff13.real;
+        adder.add(i + n, x);
+
+        subtract(sum02, sum13, x);
+        adder.add(i + 2*n, x);
+
+        x.real = diff02.real + diff13.imag;
+        x.imag = diff02.imag - diff13.real;
+        adder.add(i + 3*n, x);
+
+        exp1 += expTableStride1;
+        exp2 += expTableStride2;
+        exp3 += expTableStride3;
+    }
+}
+
+void fft_real_gather_default(
+        const float* input, 
+        CkFftSize inputStride,
+        CkFftComplex* output, 
+        CkFftSize countDiv2)
+{
+    // pairs of input values are the complex values of the half-size FFT
+    CkFftSize inputStride2 = inputStride * 2;
+    const float* in = input;
+    CkFftSize j = 0;
+    for (CkFftSize i = 0; i < countDiv2; ++i)
+    {
+        output[j].real = in[0];
+        output[j].imag = in[inputStride];
+        in += inputStride2;
 
-    fft_default(context, tmpBuf, (CkFftComplex*) output, countDiv2, true, 1, context->invExpTable, context->maxCount / countDiv2);
+        // increment j in bit-reversed order
+        CkFftSize bit = countDiv2 >> 1;
+        while (j & bit)
+        {
+            j ^= bit;
+            bit >>= 1;
+        }
+        j |= bit;
+    }
+}
+
+void fft_real_scatter_default(
+        const CkFftComplex* input, 
+        float* output, 
+        CkFftSize outputStride,
+        CkFftSize countDiv2)
+{
+    CkFftSize outputStride2 = outputStride * 2;
+    const CkFftComplex* in = input;
+    const CkFftComplex* inEnd = input + countDiv2;
+    float* out = output;
+    while (in < inEnd)
+    {
+        out[0] = in->real;
+        out[outputStride] = in->imag;
+        out += outputStride2;
+        ++in;
+    }
 }
 
 } // namespace ckfft
@@ -1,5 +1,6 @@
 #pragma once
 #include "ckfft/ckfft.h"
+#include "ckfft/fft_real.h"
 
 
 namespace ckfft
@@ -8,15 +9,86 @@ namespace ckfft
 void fft_real_default(
         CkFftContext* context, 
         const float* input, 
+        CkFftSize inputStride,
         CkFftComplex* output, 
-        int count);
+        CkFftSize count,
+        bool packed,
+        float scale);
+
+// Post-processing of a real FFT, given the complex FFT of size count/2 of its input
+// (as pairs of real values) in output.
+void fft_real_post_default(
+        CkFftContext* context, 
+        CkFftComplex* output, 
+        CkFftSize count,
+        bool packed,
+        float scale);
+
+// Post-processing of a real FFT, given the complex FFT of size count/2 of its input
+// in input, writing count/2+1 power, magnitude, or decibel values to output.
+void fft_real_post_power_default(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        float* output, 
+        CkFftSize count,
+        SpectrumType type,
+        float scale);
+
+// Double-precision versions of the real FFT post- and pre-processing (unpacked and
+// unscaled), used by fft_real_double() and fft_real_inverse_double(); the pre-
+// processing writes the input of the complex inverse FFT of size count/2 to buf,
+// which may be the same as input.
+void fft_real_post_default(
+        CkFftContextD* context, 
+        CkFftComplexD* output, 
+        CkFftSize count);
+
+void fft_real_pre_default(
+        CkFftContextD* context, 
+        const CkFftComplexD* input, 
+        CkFftComplexD* buf, 
+        CkFftSize count);
 
 void fft_real_inverse_default(
         CkFftContext* context, 
         const CkFftComplex* input, 
         float* output, 
-        int count,
-        CkFftComplex* tmpBuf);
+        CkFftSize outputStride,
+        CkFftSize count,
+        CkFftComplex* tmpBuf,
+        bool packed,
+        float scale);
+
+// Inverse real FFT (see fft_real_inverse_add()), with the window multiplication and
+// addition to the output done by the last step of the complex FFT, as it computes
+// each output value; count must be at least 8, and tmpBuf must contain count/2 
+// complex values.
+void fft_real_inverse_add_default(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        const float* window,
+        float* output0,
+        CkFftSize count0,
+        float* output1,
+        CkFftSize count,
+        CkFftComplex* tmpBuf,
+        float scale);
+
+// Read count/2 complex values, formed from pairs of real input values that are 
+// inputStride floats apart, into bit-reversed order.
+void fft_real_gather_default(
+        const float* input, 
+        CkFftSize inputStride,
+        CkFftComplex* output, 
+        CkFftSize countDiv2);
+
+// Write count/2 complex values as pairs of real output values that are 
+// outputStride floats apart.
+void fft_real_scatter_default(
+        const CkFftComplex* input, 
+        float* output, 
+        CkFftSize outputStride,
+        CkFftSize countDiv2);
 
 }
 
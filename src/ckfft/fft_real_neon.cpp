@@ -1,6 +1,7 @@
 #include "ckfft/platform.h"
 #include "ckfft/debug.h"
 #include "ckfft/fft_neon.h"
+#include "ckfft/fft_real_default.h"
 #include "ckfft/context.h"
 #include "ckfft/math_util.h"
 #include <assert.h>
@@ -17,21 +18,133 @@ namespace ckfft
 void fft_real_neon(
         CkFftContext* context, 
         const float* input, 
+        CkFftSize inputStride,
         CkFftComplex* output, 
-        int count)
+        CkFftSize count,
+        bool packed,
+        float scale)
+{
+    if (count < 16)
+    {
+        fft_real_default(context, input, inputStride, output, count, packed, scale);
+        return;
+    }
+
+    CkFftSize countDiv2 = count/2;
+
+    if (inputStride != 1)
+    {
+        // gather the input directly into bit-reversed order, in place of the 
+        // bit-reversal step of an in-place FFT
+        fft_real_gather_default(input, inputStride, output, countDiv2);
+        fft_dit_neon(context, output, output, countDiv2, false, context->fwdExpTable, context->maxCount / countDiv2, 1.0f);
+    }
+    else if ((const void*) input == (void*) output)
+    {
+        fft_inplace_neon(context, output, countDiv2, false, context->fwdExpTable, context->maxCount / countDiv2, 1.0f);
+    }
+    else
+    {
+        fft_neon(context, (const CkFftComplex*) input, output, countDiv2, false, 1, context->fwdExpTable, context->maxCount / countDiv2, 1.0f);
+    }
+
+    fft_real_post_neon(context, output, count, packed, scale);
+}
+
+namespace
 {
-    int countDiv2 = count/2;
 
-    fft_neon(context, (const CkFftComplex*) input, output, countDiv2, false, 1, context->fwdExpTable, context->maxCount / countDiv2);
+// Writes the results of realPostNeon() as a complex spectrum; output may be the 
+// same buffer as the input.
+struct ComplexWriter
+{
+    CkFftComplex* output;
+    bool packed;
+
+    void writeEnds(float dc, float nyquist, CkFftSize countDiv2)
+    {
+        output[0].real = dc;
+        if (packed)
+        {
+            output[0].imag = nyquist;
+        }
+        else
+        {
+            output[0].imag = 0.0f;
+            output[countDiv2].real = nyquist;
+            output[countDiv2].imag = 0.0f;
+        }
+    }
+
+    void write4(CkFftSize i, const float32x4x2_t& value)
+    {
+        vst2q_f32((float32_t*) (output + i), value);
+    }
+};
 
-    output[countDiv2] = output[0];
+// Writes the results of realPostNeon() as power, magnitude, or decibels.
+struct PowerWriter
+{
+    float* output;
+    SpectrumType type;
 
-    int expTableStride = context->maxCount/count;
-    const CkFftComplex* exp0 = context->fwdExpTable;
-    const CkFftComplex* exp1 = context->fwdExpTable + countDiv2 * expTableStride;
+    void writeEnds(float dc, float nyquist, CkFftSize countDiv2)
+    {
+        output[0] = convertPower(dc * dc, type);
+        output[countDiv2] = convertPower(nyquist * nyquist, type);
+    }
 
-    CkFftComplex* p0 = output;
-    CkFftComplex* p1 = output + countDiv2 - 3;
+    void write4(CkFftSize i, const float32x4x2_t& value)
+    {
+        float32x4_t power_v = vmulq_f32(value.val[0], value.val[0]);
+        power_v = vmlaq_f32(power_v, value.val[1], value.val[1]);
+        if (type == k_spectrumMagnitude)
+        {
+            // sqrt(x) = x/sqrt(x), from the reciprocal square root estimate refined
+            // with 2 Newton-Raphson steps (limited so that 0 gives 0)
+            float32x4_t x_v = vmaxq_f32(power_v, vdupq_n_f32(1.0e-30f));
+            float32x4_t e_v = vrsqrteq_f32(x_v);
+            e_v = vmulq_f32(e_v, vrsqrtsq_f32(vmulq_f32(x_v, e_v), e_v));
+            e_v = vmulq_f32(e_v, vrsqrtsq_f32(vmulq_f32(x_v, e_v), e_v));
+            power_v = vmulq_f32(power_v, e_v);
+        }
+        vst1q_f32(output + i, power_v);
+        if (type == k_spectrumDecibels)
+        {
+            for (int j = 0; j < 4; ++j)
+            {
+                output[i + j] = convertPower(output[i + j], type);
+            }
+        }
+    }
+};
+
+// Real FFT post-processing (see fft_real_post_default()); the results are passed
+// to writer.
+template <typename Writer>
+void realPostNeon(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        Writer& writer,
+        CkFftSize count,
+        float scale)
+{
+    CkFftSize countDiv2 = count/2;
+
+    // first element (exp0 is 1); it gives the real DC and Nyquist values
+    CkFftComplex first = input[0];
+    float dc = (first.real + first.imag) * (2.0f * scale);
+    float nyquist = (first.real - first.imag) * (2.0f * scale);
+    writer.writeEnds(dc, nyquist, countDiv2);
+
+    CkFftSize expTableStride = context->maxCount/count;
+    const CkFftComplex* exp0 = context->fwdExpTable + expTableStride;
+    const CkFftComplex* exp1 = context->fwdExpTable + (countDiv2 - 1) * expTableStride;
+
+    // remaining elements, 4 at a time; the last iteration includes the middle 
+    // element from both ends, which gives the same result for both.
+    const CkFftComplex* p0 = input + 1;
+    const CkFftComplex* p1 = input + countDiv2 - 4;
     const CkFftComplex* pEnd = p0 + count/4;
     while (p0 < pEnd)
     {
@@ -60,6 +173,12 @@ void fft_real_neon(
         diff_v.val[0] = vsubq_f32(z0_v.val[0], z1_v.val[0]);
         diff_v.val[1] = vaddq_f32(z0_v.val[1], z1_v.val[1]);
 
+        if (scale != 1.0f)
+        {
+            multiply(sum_v, scale, sum_v);
+            multiply(diff_v, scale, diff_v);
+        }
+
         float32x4x2_t exp_v;
         exp_v = vld2q_lane_f32((const float32_t*) exp0, exp_v, 0);
         exp0 += expTableStride;
@@ -77,7 +196,7 @@ void fft_real_neon(
         float32x4x2_t c_v;
         multiply(f_v, diff_v, c_v);
         subtract(sum_v, c_v, z0_v);
-        vst2q_f32((float32_t*) p0, z0_v);
+        writer.write4(p0 - input, z0_v);
 
         diff_v.val[0] = vnegq_f32(diff_v.val[0]);
         sum_v.val[1] = vnegq_f32(sum_v.val[1]);
@@ -109,37 +228,53 @@ void fft_real_neon(
         lo = vget_low_f32(z1_v.val[1]);
         z1_v.val[1] = vcombine_f32(hi, lo);
 
-        vst2q_f32((float32_t*) p1, z1_v);
+        writer.write4(p1 - input, z1_v);
 
         p0 += 4;
         p1 -= 4;
     }
-
-    if (count > 8)
-    {
-        // middle:
-        p0->real = p0->real * 2.0f;
-        p0->imag = -p0->imag * 2.0f;
-    }
 }
 
-void fft_real_inverse_neon(
+// Real inverse FFT pre-processing (see realPre() in fft_real_default.cpp), writing
+// the input of the complex inverse FFT of size count/2 to buf, which may be the 
+// same as input; count must be at least 16.
+void realPreNeon(
         CkFftContext* context, 
         const CkFftComplex* input, 
-        float* output, 
-        int count,
-        CkFftComplex* tmpBuf)
+        CkFftComplex* buf, 
+        CkFftSize count,
+        bool packed,
+        float scale)
 {
-    int countDiv2 = count/2;
-
-    int expTableStride = context->maxCount/count;
-    const CkFftComplex* exp0 = context->invExpTable;
-    const CkFftComplex* exp1 = context->invExpTable + countDiv2 * expTableStride;
+    CkFftSize countDiv2 = count/2;
 
-    const CkFftComplex* p0 = input;
-    const CkFftComplex* p1 = input + countDiv2 - 3;
-    CkFftComplex* tmp0 = tmpBuf;
-    CkFftComplex* tmp1 = tmpBuf + countDiv2 - 3;
+    // first element (exp0 is 1), from the DC and Nyquist values; its mirror, 
+    // buf[countDiv2], is not used by the FFT
+    CkFftComplex first0 = input[0];
+    CkFftComplex first1;
+    if (packed)
+    {
+        first1.real = first0.imag;
+        first1.imag = 0.0f;
+        first0.imag = 0.0f;
+    }
+    else
+    {
+        first1 = input[countDiv2];
+    }
+    buf[0].real = ((first0.real + first1.real) - (first0.imag + first1.imag)) * scale;
+    buf[0].imag = ((first0.imag - first1.imag) + (first0.real - first1.real)) * scale;
+
+    CkFftSize expTableStride = context->maxCount/count;
+    const CkFftComplex* exp0 = context->invExpTable + expTableStride;
+    const CkFftComplex* exp1 = context->invExpTable + (countDiv2 - 1) * expTableStride;
+
+    // remaining elements, 4 at a time; the last iteration includes the middle 
+    // element from both ends, which gives the same result for both.
+    const CkFftComplex* p0 = input + 1;
+    const CkFftComplex* p1 = input + countDiv2 - 4;
+    CkFftComplex* tmp0 = buf + 1;
+    CkFftComplex* tmp1 = buf + countDiv2 - 4;
     const CkFftComplex* pEnd = p0 + count/4;
     while (p0 < pEnd)
     {
@@ -168,6 +303,12 @@ void fft_real_inverse_neon(
         diff_v.val[0] = vsubq_f32(z0_v.val[0], z1_v.val[0]);
         diff_v.val[1] = vaddq_f32(z0_v.val[1], z1_v.val[1]);
 
+        if (scale != 1.0f)
+        {
+            multiply(sum_v, scale, sum_v);
+            multiply(diff_v, scale, diff_v);
+        }
+
         float32x4x2_t exp_v;
         exp_v = vld2q_lane_f32((const float32_t*) exp0, exp_v, 0);
         exp0 += expTableStride;
@@ -224,12 +365,249 @@ void fft_real_inverse_neon(
         p1 -= 4;
         tmp1 -= 4;
     }
+}
 
-    // middle:
-    tmp0->real = p0->real * 2.0f;
-    tmp0->imag = -p0->imag * 2.0f;
+// Multiplies the real output values of an inverse real FFT by a window (if it is 
+// not NULL), and adds them to a ring buffer: the first count0 values to output0, 
+// and the rest to output1.
+struct RingAdderNeon
+{
+    const float* window;
+    float* output0;
+    CkFftSize count0;
+    float* output1;
+
+    // add 4 complex output values of the half-size FFT, starting at i, which are
+    // the 8 real output values starting at 2*i
+    void add4(CkFftSize i, const float32x4x2_t& value)
+    {
+        CkFftSize j = 2*i;
+        float32x4x2_t value_v = value;
+        if (window)
+        {
+            float32x4x2_t w_v = vld2q_f32(window + j);
+            value_v.val[0] = vmulq_f32(value_v.val[0], w_v.val[0]);
+            value_v.val[1] = vmulq_f32(value_v.val[1], w_v.val[1]);
+        }
+
+        float* out;
+        if (j + 8 <= count0)
+        {
+            out = output0 + j;
+        }
+        else if (j >= count0)
+        {
+            out = output1 + (j - count0);
+        }
+        else
+        {
+            // split between output0 and output1
+            float buf[8];
+            vst2q_f32(buf, value_v);
+            for (int k = 0; k < 8; ++k)
+            {
+                if (j + k < count0)
+                {
+                    output0[j + k] += buf[k];
+                }
+                else
+                {
+                    output1[j + k - count0] += buf[k];
+                }
+            }
+            return;
+        }
+
+        float32x4x2_t out_v = vld2q_f32(out);
+        add(out_v, value_v, out_v);
+        vst2q_f32(out, out_v);
+    }
+};
 
-    fft_neon(context, tmpBuf, (CkFftComplex*) output, countDiv2, true, 1, context->invExpTable, context->maxCount / countDiv2);
+}
+
+void fft_real_post_neon(
+        CkFftContext* context, 
+        CkFftComplex* output, 
+        CkFftSize count,
+        bool packed,
+        float scale)
+{
+    if (count < 16)
+    {
+        fft_real_post_default(context, output, count, packed, scale);
+        return;
+    }
+
+    ComplexWriter writer = { output, packed };
+    realPostNeon(context, output, writer, count, scale);
+}
+
+void fft_real_post_power_neon(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        float* output, 
+        CkFftSize count,
+        SpectrumType type,
+        float scale)
+{
+    if (count < 16)
+    {
+        fft_real_post_power_default(context, input, output, count, type, scale);
+        return;
+    }
+
+    PowerWriter writer = { output, type };
+    realPostNeon(context, input, writer, count, scale);
+}
+
+void fft_real_inverse_neon(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        float* output, 
+        CkFftSize outputStride,
+        CkFftSize count,
+        CkFftComplex* tmpBuf,
+        bool packed,
+        float scale)
+{
+    if (count < 16)
+    {
+        fft_real_inverse_default(context, input, output, outputStride, count, tmpBuf, packed, scale);
+        return;
+    }
+
+    CkFftSize countDiv2 = count/2;
+
+    // without a temp buffer, the complex FFT is done in place in the output buffer
+    // (which may also be the input buffer)
+    CkFftComplex* buf = (tmpBuf ? tmpBuf : (CkFftComplex*) output);
+
+    realPreNeon(context, input, buf, count, packed, scale);
+
+    if (outputStride != 1)
+    {
+        // transform in the temp buffer, then write to the strided output
+        assert(tmpBuf);
+        fft_inplace_neon(context, tmpBuf, countDiv2, true, context->invExpTable, context->maxCount / countDiv2, 1.0f);
+        fft_real_scatter_default(tmpBuf, output, outputStride, countDiv2);
+    }
+    else if (tmpBuf)
+    {
+        fft_neon(context, tmpBuf, (CkFftComplex*) output, countDiv2, true, 1, context->invExpTable, context->maxCount / countDiv2, 1.0f);
+    }
+    else
+    {
+        fft_inplace_neon(context, buf, countDiv2, true, context->invExpTable, context->maxCount / countDiv2, 1.0f);
+    }
+}
+
+void fft_real_inverse_add_neon(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        const float* window,
+        float* output0,
+        CkFftSize count0,
+        float* output1,
+        CkFftSize count,
+        CkFftComplex* tmpBuf,
+        float scale)
+{
+    if (count < 32)
+    {
+        fft_real_inverse_add_default(context, input, window, output0, count0, output1, count, tmpBuf, scale);
+        return;
+    }
+
+    CkFftSize countDiv2 = count / 2;
+    CkFftSize n = countDiv2 / 4;
+    const CkFftComplex* expTable = context->invExpTable;
+
+    // all but the last step, as in fft_real_inverse_add_default()
+    realPreNeon(context, input, tmpBuf, count, false, scale);
+    bitReverse(tmpBuf, countDiv2);
+    for (int q = 0; q < 4; ++q)
+    {
+        fft_dit_neon(context, tmpBuf + q*n, tmpBuf + q*n, n, true, expTable, context->maxCount / n, 1.0f);
+    }
+
+    // the last step (see radix4_neon() in fft_neon.cpp), 4 butterflies at a time, 
+    // on the quarters in the order F0, F2, F1, F3
+    RingAdderNeon adder = { window, output0, count0, output1 };
+    const CkFftComplex* f0 = tmpBuf;
+    const CkFftComplex* f1 = tmpBuf + 2*n;
+    const CkFftComplex* f2 = tmpBuf + n;
+    const CkFftComplex* f3 = tmpBuf + 3*n;
+    const CkFftComplex* exp1 = expTable;
+    const CkFftComplex* exp2 = expTable;
+    const CkFftComplex* exp3 = expTable;
+    CkFftSize expTableStride1 = context->maxCount / countDiv2;
+    CkFftSize expTableStride2 = expTableStride1 * 2;
+    CkFftSize expTableStride3 = expTableStride1 * 3;
+
+    float32x4x2_t f1w_v, f2w2_v, f3w3_v;
+    float32x4x2_t sum02_v, diff02_v, sum13_v, diff13_v;
+    float32x4x2_t x_v;
+    for (CkFftSize i = 0; i < n; i += 4)
+    {
+        float32x4x2_t in0_v = vld2q_f32((const float32_t*) (f0 + i));
+        float32x4x2_t in1_v = vld2q_f32((const float32_t*) (f1 + i));
+        float32x4x2_t in2_v = vld2q_f32((const float32_t*) (f2 + i));
+        float32x4x2_t in3_v = vld2q_f32((const float32_t*) (f3 + i));
+
+        float32x4x2_t exp1_v;
+        exp1_v = vld2q_lane_f32((const float32_t*) exp1, exp1_v, 0);
+        exp1 += expTableStride1;
+        exp1_v = vld2q_lane_f32((const float32_t*) exp1, exp1_v, 1);
+        exp1 += expTableStride1;
+        exp1_v = vld2q_lane_f32((const float32_t*) exp1, exp1_v, 2);
+        exp1 += expTableStride1;
+        exp1_v = vld2q_lane_f32((const float32_t*) exp1, exp1_v, 3);
+        exp1 += expTableStride1;
+
+        float32x4x2_t exp2_v;
+        exp2_v = vld2q_lane_f32((const float32_t*) exp2, exp2_v, 0);
+        exp2 += expTableStride2;
+        exp2_v = vld2q_lane_f32((const float32_t*) exp2, exp2_v, 1);
+        exp2 += expTableStride2;
+        exp2_v = vld2q_lane_f32((const float32_t*) exp2, exp2_v, 2);
+        exp2 += expTableStride2;
+        exp2_v = vld2q_lane_f32((const float32_t*) exp2, exp2_v, 3);
+        exp2 += expTableStride2;
+
+        float32x4x2_t exp3_v;
+        exp3_v = vld2q_lane_f32((const float32_t*) exp3, exp3_v, 0);
+        exp3 += expTableStride3;
+        exp3_v = vld2q_lane_f32((const float32_t*) exp3, exp3_v, 1);
+        exp3 += expTableStride3;
+        exp3_v = vld2q_lane_f32((const float32_t*) exp3, exp3_v, 2);
+        exp3 += expTableStride3;
+        exp3_v = vld2q_lane_f32((const float32_t*) exp3, exp3_v, 3);
+        exp3 += expTableStride3;
+
+        multiply(in1_v, exp1_v, f1w_v);
+        multiply(in2_v, exp2_v, f2w2_v);
+        multiply(in3_v, exp3_v, f3w3_v);
+
+        add(in0_v, f2w2_v, sum02_v);
+        subtract(in0_v, f2w2_v, diff02_v);
+        add(f1w_v, f3w3_v, sum13_v);
+        subtract(f1w_v, f3w3_v, diff13_v);
+
+        add(sum02_v, sum13_v, x_v);
+        adder.add4(i, x_v);
+
+        x_v.val[0] = vsubq_f32(diff02_v.val[0], diff13_v.val[1]);
+        x_v.val[1] = vaddq_f32(diff02_v.val[1], diff13_v.val[0]);
+        adder.add4(i + n, x_v);
+
+        subtract(sum02_v, sum13_v, x_v);
+        adder.add4(i + 2*n, x_v);
+
+        x_v.val[0] = vaddq_f32(diff02_v.val[0], diff13_v.val[1]);
+        x_v.val[1] = vsubq_f32(diff02_v.val[1], diff13_v.val[0]);
+        adder.add4(i + 3*n, x_v);
+    }
 }
 
 #else
@@ -237,16 +615,51 @@ void fft_real_inverse_neon(
 void fft_real_neon(
         CkFftContext* context, 
         const float* input, 
+        CkFftSize inputStride,
         CkFftComplex* output, 
-        int count)
+        CkFftSize count,
+        bool packed,
+        float scale)
+{}
+
+void fft_real_post_neon(
+        CkFftContext* context, 
+        CkFftComplex* output, 
+        CkFftSize count,
+        bool packed,
+        float scale)
+{}
+
+void fft_real_post_power_neon(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        float* output, 
+        CkFftSize count,
+        SpectrumType type,
+        float scale)
 {}
 
 void fft_real_inverse_neon(
         CkFftContext* context, 
         const CkFftComplex* input, 
         float* output, 
-        int count,
-        CkFftComplex* tmpBuf)
+        CkFftSize outputStride,
+        CkFftSize count,
+        CkFftComplex* tmpBuf,
+        bool packed,
+        float scale)
+{}
+
+void fft_real_inverse_add_neon(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        const float* window,
+        float* output0,
+        CkFftSize count0,
+        float* output1,
+        CkFftSize count,
+        CkFftComplex* tmpBuf,
+        float scale)
 {}
 
 #endif
@@ -1,5 +1,6 @@
 #pragma once
 #include "ckfft/ckfft.h"
+#include "ckfft/fft_real.h"
 
 
 namespace ckfft
@@ -8,15 +9,51 @@ namespace ckfft
 void fft_real_neon(
         CkFftContext* context, 
         const float* input, 
+        CkFftSize inputStride,
         CkFftComplex* output, 
-        int count);
+        CkFftSize count,
+        bool packed,
+        float scale);
+
+// Post-processing of a real FFT, given the complex FFT of size count/2 of its input
+// (as pairs of real values) in output.
+void fft_real_post_neon(
+        CkFftContext* context, 
+        CkFftComplex* output, 
+        CkFftSize count,
+        bool packed,
+        float scale);
+
+// see fft_real_post_power_default()
+void fft_real_post_power_neon(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        float* output, 
+        CkFftSize count,
+        SpectrumType type,
+        float scale);
+
+// see fft_real_inverse_add_default()
+void fft_real_inverse_add_neon(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        const float* window,
+        float* output0,
+        CkFftSize count0,
+        float* output1,
+        CkFftSize count,
+        CkFftComplex* tmpBuf,
+        float scale);
 
 void fft_real_inverse_neon(
         CkFftContext* context, 
         const CkFftComplex* input, 
         float* output, 
-        int count,
-        CkFftComplex* tmpBuf);
+        CkFftSize outputStride,
+        CkFftSize count,
+        CkFftComplex* tmpBuf,
+        bool packed,
+        float scale);
 
 }
 
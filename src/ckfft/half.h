@@ -0,0 +1,119 @@
+#pragma once
+
+#include "ckfft/ckfft.h"
+#include "ckfft/platform.h"
+#include <string.h>
+
+namespace ckfft
+{
+    // conversions between float and 16-bit floating-point formats; conversions
+    // to 16 bits round to nearest even.
+
+    inline float halfToFloat(uint16 h)
+    {
+        uint32 sign = (uint32) (h & 0x8000) << 16;
+        uint32 exponent = (h >> 10) & 0x1f;
+        uint32 mantissa = h & 0x3ff;
+        uint32 bits;
+        if (exponent == 0x1f)
+        {
+            // infinity or NaN
+            bits = sign | 0x7f800000 | (mantissa << 13);
+        }
+        else if (exponent == 0)
+        {
+            if (mantissa == 0)
+            {
+                bits = sign;
+            }
+            else
+            {
+                // subnormal; normalize it
+                exponent = 127 - 15 + 1;
+                while (!(mantissa & 0x400))
+                {
+                    mantissa <<= 1;
+                    --exponent;
+                }
+                mantissa &= 0x3ff;
+                bits = sign | (exponent << 23) | (mantissa << 13);
+            }
+        }
+        else
+        {
+            bits = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+        }
+
+        float f;
+        memcpy(&f, &bits, sizeof(f));
+        return f;
+    }
+
+    inline uint16 floatToHalf(float f)
+    {
+        uint32 bits;
+        memcpy(&bits, &f, sizeof(bits));
+        uint16 sign = (uint16) ((bits >> 16) & 0x8000);
+        uint32 absBits = bits & 0x7fffffff;
+
+        if (absBits >= 0x7f800000)
+        {
+            // infinity or NaN
+            return sign | 0x7c00 | (absBits > 0x7f800000 ? 0x200 : 0);
+        }
+        if (absBits >= 0x477ff000)
+        {
+            // 65520 or more rounds to infinity
+            return sign | 0x7c00;
+        }
+        if (absBits < 0x38800000)
+        {
+            // less than the smallest normal half (2^-14)
+            if (absBits < 0x33000000)
+            {
+                // less than 2^-25 rounds to zero
+                return sign;
+            }
+            uint32 exponent = absBits >> 23;
+            uint32 mantissa = (absBits & 0x7fffff) | 0x800000;
+            uint32 shift = 126 - exponent;
+            uint32 result = mantissa >> shift;
+            uint32 rem = mantissa & ((1u << shift) - 1);
+            uint32 halfway = 1u << (shift - 1);
+            if (rem > halfway || (rem == halfway && (result & 1)))
+            {
+                ++result;
+            }
+            return sign | (uint16) result;
+        }
+
+        uint32 result = (absBits >> 13) - ((127 - 15) << 10);
+        uint32 rem = absBits & 0x1fff;
+        if (rem > 0x1000 || (rem == 0x1000 && (result & 1)))
+        {
+            ++result; // may carry into the exponent, which is correct
+        }
+        return sign | (uint16) result;
+    }
+
+    inline float bfloat16ToFloat(uint16 b)
+    {
+        uint32 bits = (uint32) b << 16;
+        float f;
+        memcpy(&f, &bits, sizeof(f));
+        return f;
+    }
+
+    inline uint16 floatToBfloat16(float f)
+    {
+        uint32 bits;
+        memcpy(&bits, &f, sizeof(bits));
+        if ((bits & 0x7fffffff) > 0x7f800000)
+        {
+            // NaN; keep it quiet, rather than letting rounding turn it into infinity
+            return (uint16) ((bits >> 16) | 0x40);
+        }
+        bits += 0x7fff + ((bits >> 16) & 1);
+        return (uint16) (bits >> 16);
+    }
+}
@@ -0,0 +1,190 @@
+#include "ckfft/platform.h"
+#include "ckfft/debug.h"
+#include "ckfft/istft.h"
+#include "ckfft/context.h"
+#include "ckfft/fft_real.h"
+#include "ckfft/scratch.h"
+#include <new>
+#include <string.h>
+
+using namespace ckfft;
+
+_CkFftIstft::_CkFftIstft() :
+    context(NULL),
+    frameSize(0),
+    hopSize(0),
+    window(NULL),
+    norm(NULL),
+    ring(NULL),
+    ringSize(0),
+    writePos(0),
+    readPos(0),
+    allocBuf(NULL)
+{}
+
+_CkFftIstft* _CkFftIstft::create(CkFftContext* context, CkFftSize frameSize, CkFftSize hopSize, const float* analysisWindow, const float* synthesisWindow, void* userBuf, size_t* userBufSize)
+{
+    CkFftSize ringSize = frameSize * 2;
+
+    // object, followed by the ring buffer, normalization and window, all aligned
+    AlignedBuf alignedBuf(sizeof(_CkFftIstft));
+    alignedBuf.addTable(ringSize * sizeof(float));
+    alignedBuf.addTable(hopSize * sizeof(float));
+    if (synthesisWindow)
+    {
+        alignedBuf.addTable(frameSize * sizeof(float));
+    }
+
+    size_t reqBufSize = alignedBuf.getRequiredSize();
+    if (userBufSize && (!userBuf || *userBufSize < reqBufSize))
+    {
+        *userBufSize = reqBufSize;
+        return NULL;
+    }
+
+    // allocate buffer if needed
+    void* buf = alignedBuf.allocate(userBuf);
+    if (!buf)
+    {
+        return NULL;
+    }
+
+    // initialize
+    _CkFftIstft* istft = new (buf) _CkFftIstft();
+    istft->context = context;
+    istft->frameSize = frameSize;
+    istft->hopSize = hopSize;
+    istft->ring = (float*) alignedBuf.getTable(0);
+    istft->ringSize = ringSize;
+    if (synthesisWindow)
+    {
+        float* windowBuf = (float*) alignedBuf.getTable(2);
+        memcpy(windowBuf, synthesisWindow, frameSize * sizeof(float));
+        istft->window = windowBuf;
+    }
+
+    // Each output sample is the sum of the frames that overlap it, each multiplied
+    // by both windows; the sum of the products of the windows depends only on the 
+    // position of the sample within the hop.  Frame i starts at (i+1)*hopSize - 
+    // frameSize, so sample j of the stream is sample (j + frameSize) % hopSize of 
+    // the frame that ends just after it, and of every hopSize-th sample before that.
+    float* normBuf = (float*) alignedBuf.getTable(1);
+    for (CkFftSize j = 0; j < hopSize; ++j)
+    {
+        double sum = 0.0;
+        for (CkFftSize k = (j + frameSize) % hopSize; k < frameSize; k += hopSize)
+        {
+            double a = (analysisWindow ? analysisWindow[k] : 1.0);
+            double s = (synthesisWindow ? synthesisWindow[k] : 1.0);
+            sum += a * s;
+        }
+        // (samples that no window covers are left unscaled)
+        normBuf[j] = (sum > 1.0e-10 ? (float) (1.0 / sum) : 1.0f);
+    }
+    istft->norm = normBuf;
+
+    istft->allocBuf = alignedBuf.getAllocatedBuf();
+    istft->allocator = alignedBuf.getAllocator();
+    istft->reset();
+
+    return istft;
+}
+
+void _CkFftIstft::destroy(_CkFftIstft* istft)
+{
+    if (istft)
+    {
+        istft->allocator.free(istft->allocBuf);
+    }
+}
+
+void _CkFftIstft::reset()
+{
+    // the first frame ends at the end of the first hop, like that of CkFftStft
+    memset(ring, 0, ringSize * sizeof(float));
+    writePos = hopSize - frameSize;
+    readPos = 0;
+}
+
+CkFftSize _CkFftIstft::getAvailable() const
+{
+    return (writePos > readPos ? writePos - readPos : 0);
+}
+
+CkFftSize _CkFftIstft::process(const CkFftComplex* input, CkFftSize frameCount)
+{
+    ScratchBuf scratch(context, NULL, frameSize/2 + 1);
+    if (!scratch.get())
+    {
+        return -1;
+    }
+
+    LocalContext local(context);
+    CkFftSize spectrumSize = frameSize/2 + 1;
+    CkFftSize ringMask = ringSize - 1;
+    CkFftSize frames = 0;
+    while (frames < frameCount)
+    {
+        // the frame must not overlap samples that have not been read 
+        if (writePos + frameSize - readPos > ringSize)
+        {
+            break;
+        }
+
+        // add the frame, in two parts if it wraps around the end of the ring
+        CkFftSize start = writePos & ringMask;
+        CkFftSize count0 = ringSize - start;
+        if (count0 > frameSize)
+        {
+            count0 = frameSize;
+        }
+        fft_real_inverse_add(local, input, window, ring + start, count0, ring, frameSize, scratch.get());
+
+        // samples before the start of the stream are discarded
+        CkFftSize prevWritePos = writePos;
+        writePos += hopSize;
+        if (prevWritePos < 0)
+        {
+            clear(prevWritePos, (writePos < 0 ? writePos : 0));
+        }
+
+        input += spectrumSize;
+        ++frames;
+    }
+    return frames;
+}
+
+CkFftSize _CkFftIstft::read(float* output, CkFftSize count)
+{
+    CkFftSize available = getAvailable();
+    if (count > available)
+    {
+        count = available;
+    }
+
+    // normalize the samples as they are read, and clear them for later frames
+    CkFftSize ringMask = ringSize - 1;
+    CkFftSize normPos = readPos % hopSize;
+    for (CkFftSize i = 0; i < count; ++i)
+    {
+        float* sample = ring + ((readPos + i) & ringMask);
+        output[i] = *sample * norm[normPos];
+        *sample = 0.0f;
+        if (++normPos == hopSize)
+        {
+            normPos = 0;
+        }
+    }
+    readPos += count;
+    return count;
+}
+
+void _CkFftIstft::clear(CkFftSize start, CkFftSize end)
+{
+    CkFftSize ringMask = ringSize - 1;
+    for (CkFftSize i = start; i < end; ++i)
+    {
+        ring[i & ringMask] = 0.0f;
+    }
+}
+
@@ -0,0 +1,47 @@
+#pragma once
+#include "ckfft/ckfft.h"
+#include "ckfft/alloc.h"
+
+// Streaming inverse short-time Fourier transform (see CkFftIstftInit()).
+
+struct _CkFftIstft
+{
+    CkFftContext* context;
+    CkFftSize frameSize;
+    CkFftSize hopSize;
+    const float* window; // synthesis window; NULL for a rectangular window
+    const float* norm;   // window-sum normalization for each sample position mod hopSize
+
+    // Sums of frames, ringSize samples (a power of 2, at least 2*frameSize); sample
+    // i of the stream is at ring[i & (ringSize-1)].
+    float* ring;
+    CkFftSize ringSize;
+    CkFftSize writePos;  // position in the stream of the start of the next frame 
+    CkFftSize readPos;   // position in the stream of the next sample to be read
+
+    void* allocBuf; // memory allocated by us (NULL if the user's buffer was used)
+    ckfft::Allocator allocator; // allocator for allocBuf
+
+    // number of complete samples not yet read
+    CkFftSize getAvailable() const;
+
+    // add up to frameCount frames, as long as there is room in the ring; returns 
+    // the number of frames added, or -1 if a temporary buffer couldn't be allocated
+    CkFftSize process(const CkFftComplex* input, CkFftSize frameCount);
+
+    // read up to count complete samples; returns the number read
+    CkFftSize read(float* output, CkFftSize count);
+
+    void reset();
+
+    static _CkFftIstft* create(CkFftContext* context, CkFftSize frameSize, CkFftSize hopSize, const float* analysisWindow, const float* synthesisWindow, void* buf, size_t* bufSize);
+    static void destroy(_CkFftIstft*);
+
+private:
+    _CkFftIstft();
+
+    // zero samples from start up to end (positions in the stream)
+    void clear(CkFftSize start, CkFftSize end);
+};
+
+
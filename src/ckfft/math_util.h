@@ -9,9 +9,68 @@
 
 namespace ckfft
 {
-    inline bool isPowerOfTwo(unsigned int x)
+    inline bool isPowerOfTwo(CkFftSize x)
     {
-        return ((x != 0) && !(x & (x - 1)));
+        return ((x > 0) && !(x & (x - 1)));
+    }
+
+    // whether x is a power of 4 (so FFTs of size x need only radix-4 steps); a
+    // constant mask of alternate bits would miss sizes beyond its width
+    inline bool isPowerOfFour(CkFftSize x)
+    {
+        if (!isPowerOfTwo(x))
+        {
+            return false;
+        }
+        while (x > 1)
+        {
+            x >>= 2;
+        }
+        return (x == 1);
+    }
+
+    // reorder data in place so that each element moves to the index whose bits
+    // are those of its own index in reverse order
+    template <typename T>
+    inline void bitReverse(T* data, CkFftSize count)
+    {
+        CkFftSize j = 0;
+        for (CkFftSize i = 0; i < count - 1; ++i)
+        {
+            if (i < j)
+            {
+                T tmp = data[i];
+                data[i] = data[j];
+                data[j] = tmp;
+            }
+
+            CkFftSize bit = count >> 1;
+            while (j & bit)
+            {
+                j ^= bit;
+                bit >>= 1;
+            }
+            j |= bit;
+        }
+    }
+
+    // copy input to output in bit-reversed order
+    template <typename T>
+    inline void bitReverse(const T* input, T* output, CkFftSize count)
+    {
+        CkFftSize j = 0;
+        for (CkFftSize i = 0; i < count; ++i)
+        {
+            output[j] = input[i];
+
+            CkFftSize bit = count >> 1;
+            while (j & bit)
+            {
+                j ^= bit;
+                bit >>= 1;
+            }
+            j |= bit;
+        }
     }
 
     inline void add(const CkFftComplex& a, const CkFftComplex& b, CkFftComplex& out)
@@ -32,6 +91,47 @@ namespace ckfft
         out.imag = a.imag * b.real + a.real * b.imag;
     }
 
+    inline void multiply(const CkFftComplex& a, float b, CkFftComplex& out)
+    {
+        out.real = a.real * b;
+        out.imag = a.imag * b;
+    }
+
+    inline void add(const CkFftComplexD& a, const CkFftComplexD& b, CkFftComplexD& out)
+    {
+        out.real = a.real + b.real;
+        out.imag = a.imag + b.imag;
+    }
+
+    inline void subtract(const CkFftComplexD& a, const CkFftComplexD& b, CkFftComplexD& out)
+    {
+        out.real = a.real - b.real;
+        out.imag = a.imag - b.imag;
+    }
+
+    inline void multiply(const CkFftComplexD& a, const CkFftComplexD& b, CkFftComplexD& out)
+    {
+        out.real = a.real * b.real - a.imag * b.imag;
+        out.imag = a.imag * b.real + a.real * b.imag;
+    }
+
+    inline void multiply(const CkFftComplexD& a, double b, CkFftComplexD& out)
+    {
+        out.real = a.real * b;
+        out.imag = a.imag * b;
+    }
+
+    // multiply count values by scale, in place
+    inline void applyScale(CkFftComplex* data, CkFftSize count, float scale)
+    {
+        CkFftComplex* dataEnd = data + count;
+        while (data < dataEnd)
+        {
+            multiply(*data, scale, *data);
+            ++data;
+        }
+    }
+
 #if CKFFT_ARM_NEON
     inline void multiply(const float32x4x2_t& x, const float32x4x2_t& y, float32x4x2_t& out)
     {
@@ -55,6 +155,12 @@ namespace ckfft
         out.val[1] = vadd_f32(bc, ad);
     }
 
+    inline void multiply(const float32x4x2_t& x, float32_t y, float32x4x2_t& out)
+    {
+        out.val[0] = vmulq_n_f32(x.val[0], y);
+        out.val[1] = vmulq_n_f32(x.val[1], y);
+    }
+
     inline void add(const float32x4x2_t& x, const float32x4x2_t& y, float32x4x2_t& out)
     {
         out.val[0] = vaddq_f32(x.val[0], y.val[0]);
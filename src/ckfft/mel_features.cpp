@@ -0,0 +1,324 @@
+#include "ckfft/platform.h"
+
+// before anything includes math.h
+#if CKFFT_PLATFORM_WIN
+#  define _USE_MATH_DEFINES
+#endif
+
+#include "ckfft/debug.h"
+#include "ckfft/mel_features.h"
+#include "ckfft/context.h"
+#include "ckfft/fft_real.h"
+#include "ckfft/spectral.h"
+#include "ckfft/scratch.h"
+#include <new>
+#include <string.h>
+#include <math.h>
+
+using namespace ckfft;
+
+namespace
+{
+    // log-mel energies are limited to log(k_minEnergy), so silence doesn't give
+    // -infinity
+    const float k_minEnergy = 1.0e-10f;
+
+    // The mel scale (as used by HTK).
+    double hzToMel(double hz)
+    {
+        return 2595.0 * log10(1.0 + hz / 700.0);
+    }
+
+    double melToHz(double mel)
+    {
+        return 700.0 * (pow(10.0, mel / 2595.0) - 1.0);
+    }
+
+    // The edges of the triangular filters, spaced evenly on the mel scale; filter b
+    // rises from edge b to edge b+1 and falls to edge b+2.
+    struct MelEdges
+    {
+        double minMel;
+        double melStep;
+
+        MelEdges(float minFreq, float maxFreq, int bandCount) :
+            minMel(hzToMel(minFreq)),
+            melStep((hzToMel(maxFreq) - hzToMel(minFreq)) / (bandCount + 1))
+        {}
+
+        double operator[](int i) const { return melToHz(minMel + melStep * i); }
+    };
+
+    // The bins of the power spectrum strictly between the edges lo and hi (in Hz),
+    // which are the ones a filter gives nonzero weights.
+    void getBandBins(double lo, double hi, double binHz, CkFftSize spectrumSize, CkFftSize* start, CkFftSize* count)
+    {
+        CkFftSize first = (CkFftSize) floor(lo / binHz) + 1;
+        CkFftSize last = (CkFftSize) ceil(hi / binHz) - 1;
+        if (last > spectrumSize - 1)
+        {
+            last = spectrumSize - 1;
+        }
+        *start = first;
+        *count = (last >= first ? last - first + 1 : 0);
+    }
+
+    // rounded up to a multiple of 4 floats, so that tables start on 16-byte boundaries
+    inline CkFftSize roundUp4(CkFftSize count)
+    {
+        return (count + 3) & ~3;
+    }
+}
+
+_CkFftMelFeatures::_CkFftMelFeatures() :
+    context(NULL),
+    frameSize(0),
+    hopSize(0),
+    window(NULL),
+    bandCount(0),
+    coeffCount(0),
+    channelCount(0),
+    bands(NULL),
+    dct(NULL),
+    dctStride(0),
+    rings(NULL),
+    ringPos(NULL),
+    hopPos(NULL),
+    allocBuf(NULL)
+{}
+
+_CkFftMelFeatures* _CkFftMelFeatures::create(CkFftContext* context, CkFftSize frameSize, CkFftSize hopSize, const float* window, float sampleRate, int bandCount, float minFreq, float maxFreq, int coeffCount, int channelCount, void* userBuf, size_t* userBufSize)
+{
+    CkFftSize spectrumSize = frameSize/2 + 1;
+    if ((size_t) channelCount > ((size_t) -1) / (frameSize * 2 * sizeof(float)))
+    {
+        return NULL;
+    }
+
+    // number of weights in the filterbank, each band padded for alignment
+    MelEdges edges(minFreq, maxFreq, bandCount);
+    double binHz = (double) sampleRate / frameSize;
+    CkFftSize weightCount = 0;
+    for (int b = 0; b < bandCount; ++b)
+    {
+        CkFftSize start, count;
+        getBandBins(edges[b], edges[b+2], binHz, spectrumSize, &start, &count);
+        weightCount += roundUp4(count);
+    }
+
+    // object, followed by the window, filterbank weights and DCT matrix; the band
+    // descriptions; the rings; and their positions, all aligned
+    CkFftSize windowSize = (window ? roundUp4(frameSize) : 0);
+    CkFftSize dctStride = roundUp4(bandCount);
+    AlignedBuf alignedBuf(sizeof(_CkFftMelFeatures));
+    alignedBuf.addTable((windowSize + weightCount + coeffCount * dctStride) * sizeof(float));
+    alignedBuf.addTable(bandCount * sizeof(Band));
+    alignedBuf.addTable(channelCount * frameSize * 2 * sizeof(float));
+    alignedBuf.addTable(channelCount * 2 * sizeof(CkFftSize));
+
+    size_t reqBufSize = alignedBuf.getRequiredSize();
+    if (userBufSize && (!userBuf || *userBufSize < reqBufSize))
+    {
+        *userBufSize = reqBufSize;
+        return NULL;
+    }
+
+    // allocate buffer if needed
+    void* buf = alignedBuf.allocate(userBuf);
+    if (!buf)
+    {
+        return NULL;
+    }
+
+    // initialize
+    _CkFftMelFeatures* mel = new (buf) _CkFftMelFeatures();
+    mel->context = context;
+    mel->frameSize = frameSize;
+    mel->hopSize = hopSize;
+    mel->bandCount = bandCount;
+    mel->coeffCount = coeffCount;
+    mel->channelCount = channelCount;
+    mel->dctStride = dctStride;
+    mel->rings = (float*) alignedBuf.getTable(2);
+    mel->ringPos = (CkFftSize*) alignedBuf.getTable(3);
+    mel->hopPos = mel->ringPos + channelCount;
+    mel->allocBuf = alignedBuf.getAllocatedBuf();
+    mel->allocator = alignedBuf.getAllocator();
+
+    float* tables = (float*) alignedBuf.getTable(0);
+    if (window)
+    {
+        memcpy(tables, window, frameSize * sizeof(float));
+        mel->window = tables;
+    }
+
+    // The filterbank: triangular filters with a peak of 1, evenly spaced on the
+    // mel scale, each overlapping half of the ones next to it.  Only the nonzero
+    // weights are stored.
+    Band* bands = (Band*) alignedBuf.getTable(1);
+    float* weights = tables + windowSize;
+    for (int b = 0; b < bandCount; ++b)
+    {
+        Band& band = bands[b];
+        double lo = edges[b];
+        double center = edges[b+1];
+        double hi = edges[b+2];
+        getBandBins(lo, hi, binHz, spectrumSize, &band.start, &band.count);
+        for (CkFftSize i = 0; i < roundUp4(band.count); ++i)
+        {
+            double w = 0.0;
+            if (i < band.count)
+            {
+                double hz = (band.start + i) * binHz;
+                w = (hz <= center ? (hz - lo) / (center - lo) : (hi - hz) / (hi - center));
+                if (w < 0.0)
+                {
+                    w = 0.0;
+                }
+            }
+            weights[i] = (float) w;
+        }
+        band.weights = weights;
+        weights += roundUp4(band.count);
+    }
+    mel->bands = bands;
+
+    // the orthonormal DCT-II: c[k] = s[k] * sum of x[b]*cos(pi*k*(2b+1)/(2*bandCount)),
+    // where s[0] = sqrt(1/bandCount) and s[k] = sqrt(2/bandCount) otherwise
+    float* dct = weights;
+    for (int k = 0; k < coeffCount; ++k)
+    {
+        float* row = dct + k * dctStride;
+        double s = sqrt((k == 0 ? 1.0 : 2.0) / bandCount);
+        for (int b = 0; b < (int) dctStride; ++b)
+        {
+            row[b] = (b < bandCount ? (float) (s * cos(M_PI * k * (2*b + 1) / (2.0 * bandCount))) : 0.0f);
+        }
+    }
+    mel->dct = dct;
+
+    mel->reset();
+    return mel;
+}
+
+void _CkFftMelFeatures::destroy(_CkFftMelFeatures* mel)
+{
+    if (mel)
+    {
+        mel->allocator.free(mel->allocBuf);
+    }
+}
+
+void _CkFftMelFeatures::reset()
+{
+    // each channel starts as if it were preceded by silence
+    memset(rings, 0, channelCount * frameSize * 2 * sizeof(float));
+    for (int i = 0; i < channelCount; ++i)
+    {
+        ringPos[i] = 0;
+        hopPos[i] = 0;
+    }
+}
+
+CkFftSize _CkFftMelFeatures::getFrameCount(int channel, CkFftSize count) const
+{
+    return (hopPos[channel] + count) / hopSize;
+}
+
+bool _CkFftMelFeatures::process(int channel, const float* input, CkFftSize count, float* output, CkFftSize* frameCount)
+{
+    // get the temporary buffer first (if any frames will be completed), so that 
+    // nothing is changed if it can't be allocated
+    *frameCount = 0;
+    bool anyFrames = (getFrameCount(channel, count) > 0);
+    ScratchBuf scratch(context, NULL, frameSize, anyFrames);
+    if (anyFrames && !scratch.get())
+    {
+        return false;
+    }
+
+    LocalContext local(context);
+    int featureCount = getFeatureCount();
+    float* ring = rings + channel * frameSize * 2;
+    CkFftSize pos = ringPos[channel];
+    CkFftSize hop = hopPos[channel];
+    const float* in = input;
+    const float* inEnd = input + count;
+    while (in < inEnd)
+    {
+        // copy up to the end of the hop or the end of the ring, whichever is first
+        CkFftSize n = inEnd - in;
+        if (n > hopSize - hop)
+        {
+            n = hopSize - hop;
+        }
+        if (n > frameSize - pos)
+        {
+            n = frameSize - pos;
+        }
+        memcpy(ring + pos, in, n * sizeof(float));
+        memcpy(ring + pos + frameSize, in, n * sizeof(float));
+        in += n;
+        pos += n;
+        if (pos == frameSize)
+        {
+            pos = 0;
+        }
+        hop += n;
+
+        if (hop == hopSize)
+        {
+            // the frame is the last frameSize samples, starting with the oldest
+            processFrame(local, ring + pos, scratch.get(), output);
+            output += featureCount;
+            ++*frameCount;
+            hop = 0;
+        }
+    }
+    ringPos[channel] = pos;
+    hopPos[channel] = hop;
+
+    return true;
+}
+
+bool _CkFftMelFeatures::processFrames(const float* input, CkFftSize frameCount, float* output) const
+{
+    ScratchBuf scratch(context, NULL, frameSize);
+    if (!scratch.get())
+    {
+        return false;
+    }
+
+    LocalContext local(context);
+    int featureCount = getFeatureCount();
+    for (CkFftSize i = 0; i < frameCount; ++i)
+    {
+        processFrame(local, input + i * hopSize, scratch.get(), output + i * featureCount);
+    }
+    return true;
+}
+
+void _CkFftMelFeatures::processFrame(CkFftContext* local, const float* frame, CkFftComplex* scratch, float* output) const
+{
+    // The power spectrum, with the window applied as the FFT reads the frame,
+    // goes in the first half of the scratch buffer, and the FFT's temporary buffer
+    // is the second half; the band energies then replace the temporary buffer
+    // (there are at most frameSize/2 bands).
+    float* power = (float*) scratch;
+    CkFftComplex* tmpBuf = scratch + frameSize/2;
+    fft_real_power(local, frame, window, power, frameSize, k_spectrumPower, tmpBuf);
+
+    float* energies = (coeffCount > 0 ? (float*) tmpBuf : output);
+    for (int b = 0; b < bandCount; ++b)
+    {
+        const Band& band = bands[b];
+        float energy = spectral_dot(local, band.weights, power + band.start, band.count);
+        energies[b] = logf(energy > k_minEnergy ? energy : k_minEnergy);
+    }
+
+    for (int k = 0; k < coeffCount; ++k)
+    {
+        output[k] = spectral_dot(local, dct + k * dctStride, energies, bandCount);
+    }
+}
+
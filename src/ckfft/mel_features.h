@@ -0,0 +1,70 @@
+#pragma once
+#include "ckfft/ckfft.h"
+#include "ckfft/alloc.h"
+
+// Log-mel spectrogram and MFCC features (see CkFftMelFeaturesInit()).
+
+struct _CkFftMelFeatures
+{
+    // the nonzero weights of one triangular filter of the filterbank
+    struct Band
+    {
+        CkFftSize start;       // first bin of the power spectrum
+        CkFftSize count;       // number of bins
+        const float* weights;  // count weights, starting on a 16-byte boundary
+    };
+
+    CkFftContext* context;
+    CkFftSize frameSize;
+    CkFftSize hopSize;
+    const float* window; // NULL for a rectangular window
+    int bandCount;
+    int coeffCount;      // number of DCT coefficients, or 0 for log-mel energies
+    int channelCount;
+
+    const Band* bands;   // bandCount bands
+
+    // DCT-II matrix, coeffCount rows of bandCount values, each starting dctStride
+    // values after the one before
+    const float* dct;
+    CkFftSize dctStride;
+
+    // For each channel, the last frameSize samples, each stored twice (at i and
+    // i + frameSize) so that every frame is contiguous; channel c's ring starts at
+    // rings + c*2*frameSize.
+    float* rings;
+    CkFftSize* ringPos;  // for each channel, position of the oldest sample
+    CkFftSize* hopPos;   // for each channel, samples received since the last frame
+
+    void* allocBuf; // memory allocated by us (NULL if the user's buffer was used)
+    ckfft::Allocator allocator; // allocator for allocBuf
+
+    // number of values output for each frame
+    int getFeatureCount() const { return coeffCount > 0 ? coeffCount : bandCount; }
+
+    // number of frames that process() will output for count more samples
+    CkFftSize getFrameCount(int channel, CkFftSize count) const;
+
+    // add count samples to one channel, writing the features of each frame
+    // completed to output; returns false if a temporary buffer couldn't be
+    // allocated (in which case the samples are not added)
+    bool process(int channel, const float* input, CkFftSize count, float* output, CkFftSize* frameCount);
+
+    // features of frameCount frames, frame i starting at input + i*hopSize; returns
+    // false if a temporary buffer couldn't be allocated
+    bool processFrames(const float* input, CkFftSize frameCount, float* output) const;
+
+    void reset();
+
+    static _CkFftMelFeatures* create(CkFftContext* context, CkFftSize frameSize, CkFftSize hopSize, const float* window, float sampleRate, int bandCount, float minFreq, float maxFreq, int coeffCount, int channelCount, void* buf, size_t* bufSize);
+    static void destroy(_CkFftMelFeatures*);
+
+private:
+    _CkFftMelFeatures();
+
+    // features of one frame of frameSize samples, using scratch, which contains
+    // frameSize complex values; local is the context for this thread
+    void processFrame(CkFftContext* local, const float* frame, CkFftComplex* scratch, float* output) const;
+};
+
+
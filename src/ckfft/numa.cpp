@@ -0,0 +1,103 @@
+#include "ckfft/platform.h"
+#include "ckfft/debug.h"
+#include "ckfft/numa.h"
+
+#if CKFFT_PLATFORM_WIN
+#  include <windows.h>
+#elif CKFFT_PLATFORM_ANDROID
+#  include <stdio.h>
+#  include <unistd.h>
+#  include <sys/syscall.h>
+#endif
+
+
+namespace
+{
+
+#if CKFFT_PLATFORM_ANDROID && defined(SYS_getcpu)
+// The node is looked up again (with a system call) only every k_nodeRefresh 
+// calls on each thread; threads rarely move between nodes, and the node is only 
+// a hint anyway.
+const int k_nodeRefresh = 256;
+
+__thread int t_node = 0;
+__thread int t_nodeCalls = 0;
+#endif
+
+}
+
+namespace ckfft
+{
+
+int getNumaNodeCount()
+{
+    int count = 1;
+#if CKFFT_PLATFORM_WIN
+    ULONG highest = 0;
+    if (GetNumaHighestNodeNumber(&highest))
+    {
+        count = (int) highest + 1;
+    }
+#elif CKFFT_PLATFORM_ANDROID
+    // a list of ranges of node numbers, such as "0" or "0-1" or "0,2-3"
+    FILE* file = fopen("/sys/devices/system/node/possible", "r");
+    if (file)
+    {
+        int node = 0;
+        char sep = 0;
+        while (fscanf(file, "%d%c", &node, &sep) >= 1)
+        {
+            if (node + 1 > count)
+            {
+                count = node + 1;
+            }
+            if (sep != ',' && sep != '-')
+            {
+                break;
+            }
+        }
+        fclose(file);
+    }
+#endif
+    return count;
+}
+
+int getNumaNode()
+{
+    int node = 0;
+#if CKFFT_PLATFORM_WIN
+    PROCESSOR_NUMBER processor;
+    USHORT winNode = 0;
+    GetCurrentProcessorNumberEx(&processor);
+    if (GetNumaProcessorNodeEx(&processor, &winNode))
+    {
+        node = winNode;
+    }
+#elif CKFFT_PLATFORM_ANDROID && defined(SYS_getcpu)
+    if (t_nodeCalls == 0)
+    {
+        unsigned int cpu = 0;
+        unsigned int cpuNode = 0;
+        t_node = 0;
+        if (syscall(SYS_getcpu, &cpu, &cpuNode, NULL) == 0)
+        {
+            t_node = (int) cpuNode;
+        }
+        t_nodeCalls = k_nodeRefresh;
+    }
+    --t_nodeCalls;
+    node = t_node;
+#endif
+    return node;
+}
+
+bool compareAndSwap(void* volatile* p, void* oldValue, void* newValue)
+{
+#if CKFFT_PLATFORM_WIN
+    return (InterlockedCompareExchangePointer(p, newValue, oldValue) == oldValue);
+#else
+    return __sync_bool_compare_and_swap(p, oldValue, newValue);
+#endif
+}
+
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include "ckfft/platform.h"
+
+
+namespace ckfft
+{
+
+// Number of NUMA nodes in the system, or 1 if it is not NUMA or this can't be 
+// determined on this platform.
+int getNumaNodeCount();
+
+// NUMA node of the processor the current thread is running on, or 0 if unknown.
+// (The thread may move to another node at any time, so this is only a hint; on 
+// some platforms the node is cached per thread and only looked up occasionally.)
+int getNumaNode();
+
+// Set *p to newValue if it is equal to oldValue, atomically, with a full memory 
+// barrier; returns true if it was set.
+bool compareAndSwap(void* volatile* p, void* oldValue, void* newValue);
+
+}
@@ -0,0 +1,312 @@
+#include "ckfft/platform.h"
+#include "ckfft/debug.h"
+#include "ckfft/partitioned_convolver.h"
+#include "ckfft/context.h"
+#include "ckfft/fft_real.h"
+#include "ckfft/spectral.h"
+#include "ckfft/numa.h"
+#include "ckfft/math_util.h"
+#include <new>
+#include <string.h>
+
+using namespace ckfft;
+
+namespace
+{
+    // task states
+    void* const k_taskDone = (void*) 0;    // no task, or the last task is finished
+    void* const k_taskPending = (void*) 1; // ready to be run
+    void* const k_taskRunning = (void*) 2; // being run by some thread
+}
+
+_CkFftPartitionedConvolver::_CkFftPartitionedConvolver() :
+    context(NULL),
+    filterSize(0),
+    blockSize(0),
+    levelCount(0),
+    ring(NULL),
+    ringSize(0),
+    time(0),
+    missedDeadlines(0),
+    allocBuf(NULL)
+{}
+
+int _CkFftPartitionedConvolver::getLevels(CkFftSize filterSize, CkFftSize blockSize, CkFftSize maxPartitionSize, CkFftSize* sizes, CkFftSize* counts)
+{
+    // Each level has partitions 4 times the size of the level before (up to 
+    // maxPartitionSize), and covers the filter from twice its partition size up to
+    // twice the partition size of the next level; the last level covers the rest.
+    int levelCount = 0;
+    CkFftSize size = blockSize;
+    CkFftSize start = 0;
+    for (;;)
+    {
+        CkFftSize nextSize = (size < maxPartitionSize / 4 ? size * 4 : maxPartitionSize);
+        CkFftSize end = (size < maxPartitionSize && 2 * nextSize < filterSize ? 2 * nextSize : filterSize);
+        sizes[levelCount] = size;
+        counts[levelCount] = (end - start + size - 1) / size;
+        ++levelCount;
+
+        if (end == filterSize)
+        {
+            break;
+        }
+        start = end;
+        size = nextSize;
+    }
+    return levelCount;
+}
+
+_CkFftPartitionedConvolver* _CkFftPartitionedConvolver::create(CkFftContext* context, const float* filter, CkFftSize filterSize, CkFftSize blockSize, CkFftSize maxPartitionSize, void* userBuf, size_t* userBufSize)
+{
+    CkFftSize sizes[k_maxLevels];
+    CkFftSize counts[k_maxLevels];
+    int levelCount = getLevels(filterSize, blockSize, maxPartitionSize, sizes, counts);
+
+    // Each level needs its filter spectra, FDL, accumulator, and output, each 
+    // aligned, all in one table; the ring must hold the last 3 blocks of the
+    // largest level, since a block's task may still be reading the 2 blocks before
+    // the one being written.
+    size_t levelBytes = 0;
+    for (int i = 0; i < levelCount; ++i)
+    {
+        size_t spectrumBytes = (sizes[i] + 1) * sizeof(CkFftComplex);
+        levelBytes += 2 * alignSize(counts[i] * spectrumBytes);
+        levelBytes += alignSize(spectrumBytes);
+        levelBytes += alignSize(2 * sizes[i] * sizeof(float));
+    }
+    CkFftSize ringSize = sizes[levelCount - 1] * 4;
+
+    AlignedBuf alignedBuf(sizeof(_CkFftPartitionedConvolver));
+    alignedBuf.addTable(levelBytes);
+    alignedBuf.addTable(ringSize * 2 * sizeof(float));
+
+    size_t reqBufSize = alignedBuf.getRequiredSize();
+    if (userBufSize && (!userBuf || *userBufSize < reqBufSize))
+    {
+        *userBufSize = reqBufSize;
+        return NULL;
+    }
+
+    // allocate buffer if needed
+    void* buf = alignedBuf.allocate(userBuf);
+    if (!buf)
+    {
+        return NULL;
+    }
+
+    // initialize
+    _CkFftPartitionedConvolver* conv = new (buf) _CkFftPartitionedConvolver();
+    conv->context = context;
+    conv->filterSize = filterSize;
+    conv->blockSize = blockSize;
+    conv->levelCount = levelCount;
+    conv->ring = (float*) alignedBuf.getTable(1);
+    conv->ringSize = ringSize;
+    conv->allocBuf = alignedBuf.getAllocatedBuf();
+    conv->allocator = alignedBuf.getAllocator();
+
+    // The real forward FFT gives 2*fwdScale*DFT(x), and the inverse gives 
+    // n*invScale*IDFT(X) (where IDFT includes 1/n), so the filter spectra are 
+    // divided by 4*n*fwdScale^2*invScale, for an FFT size n.
+    LocalContext local(context);
+    char* p = (char*) alignedBuf.getTable(0);
+    CkFftSize start = 0;
+    for (int i = 0; i < levelCount; ++i)
+    {
+        Level& level = conv->levels[i];
+        CkFftSize size = sizes[i];
+        CkFftSize spectrumSize = size + 1;
+        level.size = size;
+        level.partitionCount = counts[i];
+
+        CkFftComplex* filterSpectra = (CkFftComplex*) p;
+        p += alignSize(counts[i] * spectrumSize * sizeof(CkFftComplex));
+        level.fdl = (CkFftComplex*) p;
+        p += alignSize(counts[i] * spectrumSize * sizeof(CkFftComplex));
+        level.acc = (CkFftComplex*) p;
+        p += alignSize(spectrumSize * sizeof(CkFftComplex));
+        level.output = (float*) p;
+        p += alignSize(2 * size * sizeof(float));
+
+        float fwdScale = context->getScale(size * 4, false);
+        float invScale = context->getScale(size * 4, true);
+        float scale = 1.0f / (8.0f * (float) size * fwdScale * fwdScale * invScale);
+        for (CkFftSize j = 0; j < counts[i]; ++j)
+        {
+            // each partition is zero-padded to twice its size, and transformed in place
+            CkFftComplex* spectrum = filterSpectra + j * spectrumSize;
+            float* padded = (float*) spectrum;
+            CkFftSize count = filterSize - start;
+            if (count > size)
+            {
+                count = size;
+            }
+            memcpy(padded, filter + start, count * sizeof(float));
+            memset(padded + count, 0, (size * 2 - count) * sizeof(float));
+            fft_real(local, padded, 1, spectrum, size * 2, false);
+            applyScale(spectrum, spectrumSize, scale);
+            start += count;
+        }
+        level.filterSpectra = filterSpectra;
+    }
+
+    conv->reset();
+    return conv;
+}
+
+void _CkFftPartitionedConvolver::destroy(_CkFftPartitionedConvolver* conv)
+{
+    if (conv)
+    {
+        conv->allocator.free(conv->allocBuf);
+    }
+}
+
+void _CkFftPartitionedConvolver::reset()
+{
+    // start as if the stream were preceded by silence
+    memset(ring, 0, ringSize * 2 * sizeof(float));
+    for (int i = 0; i < levelCount; ++i)
+    {
+        Level& level = levels[i];
+        memset(level.fdl, 0, level.partitionCount * (level.size + 1) * sizeof(CkFftComplex));
+        memset(level.output, 0, level.size * 2 * sizeof(float));
+        level.fdlPos = 0;
+        level.taskEnd = 0;
+        level.state = k_taskDone;
+    }
+    time = 0;
+    missedDeadlines = 0;
+}
+
+void _CkFftPartitionedConvolver::process(const float* input, float* output)
+{
+    // add the input to the ring (in at most 2 pieces, since it is smaller than the ring)
+    CkFftSize pos = time & (ringSize - 1);
+    CkFftSize count = ringSize - pos;
+    if (count > blockSize)
+    {
+        count = blockSize;
+    }
+    memcpy(ring + pos, input, count * sizeof(float));
+    memcpy(ring + pos + ringSize, input, count * sizeof(float));
+    memcpy(ring, input + count, (blockSize - count) * sizeof(float));
+    memcpy(ring + ringSize, input + count, (blockSize - count) * sizeof(float));
+    time += blockSize;
+
+    // the start of the filter, with no delay
+    runLevel(levels[0], time, output);
+
+    for (int i = 1; i < levelCount; ++i)
+    {
+        Level& level = levels[i];
+        CkFftSize size = level.size;
+
+        // add the output of the level's last task, if it has started yet
+        CkFftSize t = time - blockSize - size * 2;
+        if (t >= 0)
+        {
+            const float* levelOutput = level.output + ((t / size) & 1) * size + (t & (size - 1));
+            for (CkFftSize j = 0; j < blockSize; ++j)
+            {
+                output[j] += levelOutput[j];
+            }
+        }
+
+        // At the end of each block of the level's input, the previous block's
+        // output must be ready for the next call, so it must be finished now; 
+        // then the task for this block can start.
+        if ((time & (size - 1)) == 0)
+        {
+            finishTask(level);
+            level.taskEnd = time;
+            compareAndSwap(&level.state, k_taskDone, k_taskPending);
+        }
+    }
+}
+
+int _CkFftPartitionedConvolver::runTail()
+{
+    // Smaller levels first: since each level's partition size is a multiple of 
+    // the one before, a smaller level's next deadline is never later.
+    int taskCount = 0;
+    int i = 1;
+    while (i < levelCount)
+    {
+        Level& level = levels[i];
+        if (compareAndSwap(&level.state, k_taskPending, k_taskRunning))
+        {
+            CkFftSize block = level.taskEnd / level.size - 1;
+            runLevel(level, level.taskEnd, level.output + (block & 1) * level.size);
+            compareAndSwap(&level.state, k_taskRunning, k_taskDone);
+            ++taskCount;
+
+            // a smaller level's task may have become ready in the meantime
+            i = 1;
+        }
+        else
+        {
+            ++i;
+        }
+    }
+    return taskCount;
+}
+
+void _CkFftPartitionedConvolver::finishTask(Level& level)
+{
+    if (compareAndSwap(&level.state, k_taskDone, k_taskDone))
+    {
+        return;
+    }
+
+    ++missedDeadlines;
+    if (compareAndSwap(&level.state, k_taskPending, k_taskRunning))
+    {
+        CkFftSize block = level.taskEnd / level.size - 1;
+        runLevel(level, level.taskEnd, level.output + (block & 1) * level.size);
+        compareAndSwap(&level.state, k_taskRunning, k_taskDone);
+    }
+    else
+    {
+        // another thread is running it
+        while (!compareAndSwap(&level.state, k_taskDone, k_taskDone))
+        {}
+    }
+}
+
+void _CkFftPartitionedConvolver::runLevel(Level& level, CkFftSize end, float* output)
+{
+    LocalContext local(context);
+    CkFftSize size = level.size;
+    CkFftSize spectrumSize = size + 1;
+
+    // transform the last 2*size input samples into the next slot of the FDL
+    level.fdlPos = (level.fdlPos + 1 < level.partitionCount ? level.fdlPos + 1 : 0);
+    const float* window = ring + ((end - size * 2) & (ringSize - 1));
+    fft_real(local, window, 1, level.fdl + level.fdlPos * spectrumSize, size * 2, false);
+
+    // multiply each partition's spectrum by the spectrum of the input that 
+    // many blocks ago, and add them up
+    CkFftSize fdlPos = level.fdlPos;
+    for (CkFftSize i = 0; i < level.partitionCount; ++i)
+    {
+        const CkFftComplex* filterSpectrum = level.filterSpectra + i * spectrumSize;
+        const CkFftComplex* inputSpectrum = level.fdl + fdlPos * spectrumSize;
+        if (i == 0)
+        {
+            spectral_multiply(local, inputSpectrum, filterSpectrum, level.acc, spectrumSize, false);
+        }
+        else
+        {
+            spectral_multiply_add(local, inputSpectrum, filterSpectrum, level.acc, spectrumSize, false);
+        }
+        fdlPos = (fdlPos > 0 ? fdlPos : level.partitionCount) - 1;
+    }
+
+    // transform back in place; the last size values are the output
+    float* result = (float*) level.acc;
+    fft_real_inverse(local, level.acc, result, 1, size * 2, NULL, false);
+    memcpy(output, result + size, size * sizeof(float));
+}
+
@@ -0,0 +1,79 @@
+#pragma once
+#include "ckfft/ckfft.h"
+#include "ckfft/alloc.h"
+
+// Non-uniform partitioned convolution (see CkFftPartitionedConvolverInit()).
+
+struct _CkFftPartitionedConvolver
+{
+    // A range of the filter divided into partitions of equal size, each filtered 
+    // with real FFTs of twice the partition size, using a frequency-domain delay 
+    // line (FDL) holding the spectra of the last partitionCount input blocks.
+    // Level 0 starts at the start of the filter and is computed in process(); 
+    // level l > 0 starts at twice its partition size, so its output for a block 
+    // isn't needed until one block after the block's input is complete, and it 
+    // can be computed on another thread in the meantime.
+    struct Level
+    {
+        CkFftSize size;            // partition size
+        CkFftSize partitionCount;
+        const CkFftComplex* filterSpectra; // partitionCount spectra of size+1 values
+        CkFftComplex* fdl;         // partitionCount spectra of size+1 values
+        CkFftSize fdlPos;          // index in fdl of the newest spectrum
+        CkFftComplex* acc;         // sum of products, size+1 values
+
+        // Output of the last two tasks (level > 0), size samples each; block j of
+        // this level gives samples (j+2)*size to (j+3)*size - 1, in output + (j&1)*size.
+        float* output;
+
+        // Task for the block of input samples ending at taskEnd (level > 0); state
+        // is one of the k_task values below, and is changed with compareAndSwap().
+        CkFftSize taskEnd;
+        void* volatile state;
+    };
+
+    enum { k_maxLevels = 32 };
+
+    CkFftContext* context;
+    CkFftSize filterSize;
+    CkFftSize blockSize;
+    int levelCount;
+    Level levels[k_maxLevels];
+
+    // Input samples, ringSize (a power of 2) samples stored twice so that any 
+    // range of them is contiguous; sample i of the stream is at 
+    // ring[i & (ringSize-1)] and ring[(i & (ringSize-1)) + ringSize].
+    float* ring;
+    CkFftSize ringSize;
+    CkFftSize time;            // number of samples processed
+    CkFftSize missedDeadlines; // tasks not done by the time their output was needed
+
+    void* allocBuf; // memory allocated by us (NULL if the user's buffer was used)
+    ckfft::Allocator allocator; // allocator for allocBuf
+
+    // filter blockSize samples
+    void process(const float* input, float* output);
+
+    // run tail tasks that are ready and not already running; returns the number run
+    int runTail();
+
+    void reset();
+
+    static _CkFftPartitionedConvolver* create(CkFftContext* context, const float* filter, CkFftSize filterSize, CkFftSize blockSize, CkFftSize maxPartitionSize, void* buf, size_t* bufSize);
+    static void destroy(_CkFftPartitionedConvolver*);
+
+private:
+    _CkFftPartitionedConvolver();
+
+    // partition sizes and counts of each level; returns the number of levels
+    static int getLevels(CkFftSize filterSize, CkFftSize blockSize, CkFftSize maxPartitionSize, CkFftSize* sizes, CkFftSize* counts);
+
+    // Compute the output of a level for the block of input samples ending at end,
+    // writing the last size samples of the inverse FFT to output.
+    void runLevel(Level& level, CkFftSize end, float* output);
+
+    // make sure the task of a level is done, running it if no other thread has started it
+    void finishTask(Level& level);
+};
+
+
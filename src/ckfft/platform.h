@@ -6,6 +6,7 @@
 #undef CKFFT_PLATFORM_MACOS
 #undef CKFFT_PLATFORM_WIN
 #undef CKFFT_ARM_NEON
+#undef CKFFT_ARM_NEON_FP16
 
 #if __APPLE__
 #  include <TargetConditionals.h>
@@ -22,6 +23,10 @@
 
 #if __arm__ && __ARM_NEON__
 #  define CKFFT_ARM_NEON 1
+#  if defined(__ARM_FP) && (__ARM_FP & 2)
+     // half-precision conversion instructions (vcvt.f32.f16)
+#    define CKFFT_ARM_NEON_FP16 1
+#  endif
 #endif
 
 #if !CKFFT_PLATFORM_IOS && !CKFFT_PLATFORM_ANDROID && !CKFFT_PLATFORM_MACOS && !CKFFT_PLATFORM_WIN
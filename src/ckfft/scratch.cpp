@@ -0,0 +1,114 @@
+#include "ckfft/platform.h"
+#include "ckfft/debug.h"
+#include "ckfft/scratch.h"
+#include "ckfft/context.h"
+#include "ckfft/numa.h"
+#include <new>
+#include <assert.h>
+
+
+namespace ckfft
+{
+
+ScratchPool* ScratchPool::create(int count, CkFftSize bufCount)
+{
+    // pool object, followed by the free list, then the buffers, all aligned
+    size_t bufSize = alignSize(bufCount * sizeof(CkFftComplex));
+    if ((size_t) count > ((size_t) -1) / 2 / bufSize)
+    {
+        return NULL;
+    }
+    AlignedBuf alignedBuf(sizeof(ScratchPool));
+    alignedBuf.addTable(count * sizeof(void*));
+    alignedBuf.addTable(count * bufSize);
+
+    ScratchPool* pool = (ScratchPool*) alignedBuf.allocate(NULL);
+    if (!pool)
+    {
+        return NULL;
+    }
+    pool->allocBuf = alignedBuf.getAllocatedBuf();
+    pool->allocator = alignedBuf.getAllocator();
+    pool->count = count;
+    pool->bufCount = bufCount;
+    pool->bufs = (CkFftComplex*) alignedBuf.getTable(1);
+    pool->bufStride = (CkFftSize) (bufSize / sizeof(CkFftComplex));
+    pool->free = (void* volatile*) alignedBuf.getTable(0);
+    pool->prev = NULL;
+    for (int i = 0; i < count; ++i)
+    {
+        pool->free[i] = pool->bufs + i * pool->bufStride;
+    }
+    return pool;
+}
+
+void ScratchPool::destroy(ScratchPool* pool)
+{
+    while (pool)
+    {
+        ScratchPool* prev = pool->prev;
+        pool->allocator.free(pool->allocBuf);
+        pool = prev;
+    }
+}
+
+////////////////////////////////////////
+
+ScratchBuf::ScratchBuf(CkFftContext* context, CkFftComplex* userBuf, CkFftSize count, bool required) :
+    m_buf(userBuf),
+    m_pool(NULL),
+    m_index(-1),
+    m_allocBuf(NULL)
+{
+    if (m_buf)
+    {
+        return;
+    }
+
+    // Take the first free buffer; a thread working alone gets the same buffer every 
+    // time, so it stays in that core's cache.
+    ScratchPool* pool = context->scratchPool;
+    if (pool)
+    {
+        assert(count <= pool->bufCount);
+        for (int i = 0; i < pool->count; ++i)
+        {
+            void* buf = pool->free[i];
+            if (buf && compareAndSwap(&pool->free[i], buf, NULL))
+            {
+                m_buf = (CkFftComplex*) buf;
+                m_pool = pool;
+                m_index = i;
+                return;
+            }
+        }
+
+        // all in use: more threads than were reserved for are using the context,
+        // so fail rather than allocate on what may be a real-time thread
+        return;
+    }
+
+    if (required)
+    {
+        m_allocator = getAllocator();
+        m_allocBuf = m_allocator.allocate(count * sizeof(CkFftComplex) + k_alignment - 1);
+        if (m_allocBuf)
+        {
+            m_buf = (CkFftComplex*) alignPointer(m_allocBuf);
+        }
+    }
+}
+
+ScratchBuf::~ScratchBuf()
+{
+    if (m_pool)
+    {
+        compareAndSwap(&m_pool->free[m_index], NULL, m_buf);
+    }
+    else if (m_allocBuf)
+    {
+        m_allocator.free(m_allocBuf);
+    }
+}
+
+}
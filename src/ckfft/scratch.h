@@ -0,0 +1,50 @@
+#pragma once
+#include "ckfft/ckfft.h"
+#include "ckfft/alloc.h"
+
+
+namespace ckfft
+{
+
+// Temporary buffers reserved for a context (see CkFftReserveScratch()), one for
+// each thread that may use the context at once, each with maxCount complex values.
+struct ScratchPool
+{
+    void* allocBuf;
+    Allocator allocator;
+    int count;
+    CkFftSize bufCount;   // complex values per buffer
+    CkFftComplex* bufs;   // count buffers, each on a k_alignment boundary
+    CkFftSize bufStride;  // distance between buffers, in complex values
+    void* volatile* free; // buffer i, or NULL if it is in use
+    ScratchPool* prev;    // pool this one replaced, which may still be in use
+
+    static ScratchPool* create(int count, CkFftSize bufCount);
+    static void destroy(ScratchPool*);
+};
+
+// A temporary buffer for one FFT: the user's buffer, if one was given, or a buffer
+// from the context's scratch pool, or (if no pool was reserved) one allocated for 
+// the call.  If all the pool's buffers are in use, get() returns NULL, so that 
+// FFTs never allocate once buffers have been reserved.
+class ScratchBuf
+{
+public:
+    // If required is false, get() returns NULL rather than allocating.
+    ScratchBuf(CkFftContext* context, CkFftComplex* userBuf, CkFftSize count, bool required = true);
+    ~ScratchBuf();
+
+    CkFftComplex* get() const { return m_buf; }
+
+private:
+    CkFftComplex* m_buf;
+    ScratchPool* m_pool;
+    int m_index;          // index in pool, or -1
+    void* m_allocBuf;
+    Allocator m_allocator;
+
+    ScratchBuf(const ScratchBuf&);
+    ScratchBuf& operator=(const ScratchBuf&);
+};
+
+}
@@ -0,0 +1,161 @@
+#include "ckfft/platform.h"
+#include "ckfft/debug.h"
+#include "ckfft/spectral.h"
+#include "ckfft/spectral_default.h"
+#include "ckfft/spectral_neon.h"
+#include "ckfft/context.h"
+
+
+namespace ckfft
+{
+
+namespace
+{
+    typedef void (*SpectralFunc)(const CkFftComplex*, const CkFftComplex*, CkFftComplex*, CkFftSize);
+
+    // Apply the default or NEON version of a function; for packed spectra, the 
+    // first element's real and imaginary parts are the real DC and Nyquist values, 
+    // so they are multiplied separately (conjugation doesn't change them), and the
+    // rest are complex.
+    void apply(
+            CkFftContext* context, 
+            SpectralFunc defaultFunc,
+            SpectralFunc neonFunc,
+            bool add,
+            const CkFftComplex* a, 
+            const CkFftComplex* b, 
+            CkFftComplex* output, 
+            CkFftSize count,
+            bool packed)
+    {
+        if (packed && count > 0)
+        {
+            float dc = a->real * b->real;
+            float nyquist = a->imag * b->imag;
+            if (add)
+            {
+                output->real += dc;
+                output->imag += nyquist;
+            }
+            else
+            {
+                output->real = dc;
+                output->imag = nyquist;
+            }
+            ++a;
+            ++b;
+            ++output;
+            --count;
+        }
+
+        if (context->neon)
+        {
+            neonFunc(a, b, output, count);
+        }
+        else
+        {
+            defaultFunc(a, b, output, count);
+        }
+    }
+}
+
+void spectral_multiply(
+        CkFftContext* context, 
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count,
+        bool packed)
+{
+    apply(context, spectral_multiply_default, spectral_multiply_neon, false, a, b, output, count, packed);
+}
+
+void spectral_multiply_add(
+        CkFftContext* context, 
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count,
+        bool packed)
+{
+    apply(context, spectral_multiply_add_default, spectral_multiply_add_neon, true, a, b, output, count, packed);
+}
+
+void spectral_conjugate_multiply(
+        CkFftContext* context, 
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count,
+        bool packed)
+{
+    apply(context, spectral_conjugate_multiply_default, spectral_conjugate_multiply_neon, false, a, b, output, count, packed);
+}
+
+void spectral_conjugate_multiply_add(
+        CkFftContext* context, 
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count,
+        bool packed)
+{
+    apply(context, spectral_conjugate_multiply_add_default, spectral_conjugate_multiply_add_neon, true, a, b, output, count, packed);
+}
+
+void spectral_scale(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        float scale,
+        CkFftComplex* output, 
+        CkFftSize count)
+{
+    if (context->neon)
+    {
+        spectral_scale_neon(input, scale, output, count);
+    }
+    else
+    {
+        spectral_scale_default(input, scale, output, count);
+    }
+}
+
+float spectral_dot(
+        CkFftContext* context, 
+        const float* a, 
+        const float* b, 
+        CkFftSize count)
+{
+    if (context->neon)
+    {
+        return spectral_dot_neon(a, b, count);
+    }
+    else
+    {
+        return spectral_dot_default(a, b, count);
+    }
+}
+
+void spectral_correlate(
+        CkFftContext* context, 
+        const CkFftComplex* x, 
+        const CkFftComplex* y, 
+        CkFftWeighting weighting,
+        float* powerX, 
+        float* powerY, 
+        float smoothing,
+        float scale, 
+        CkFftComplex* output, 
+        CkFftSize count)
+{
+    if (context->neon)
+    {
+        spectral_correlate_neon(x, y, weighting, powerX, powerY, smoothing, scale, output, count);
+    }
+    else
+    {
+        spectral_correlate_default(x, y, weighting, powerX, powerY, smoothing, scale, output, count);
+    }
+}
+
+} // namespace ckfft
@@ -0,0 +1,83 @@
+#pragma once
+#include "ckfft/ckfft.h"
+
+
+namespace ckfft
+{
+
+// These work element by element on arrays of count values.  If packed is true, 
+// the arrays are packed real spectra, whose first element holds the real values 
+// of the DC and Nyquist bins (see CkFftRealForwardPacked()), which are combined 
+// separately.  The output may be the same buffer as any input.
+
+// output[i] = a[i] * b[i]
+void spectral_multiply(
+        CkFftContext* context, 
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count,
+        bool packed);
+
+// output[i] += a[i] * b[i]
+void spectral_multiply_add(
+        CkFftContext* context, 
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count,
+        bool packed);
+
+// output[i] = a[i] * conj(b[i])
+void spectral_conjugate_multiply(
+        CkFftContext* context, 
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count,
+        bool packed);
+
+// output[i] += a[i] * conj(b[i])
+void spectral_conjugate_multiply_add(
+        CkFftContext* context, 
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count,
+        bool packed);
+
+// output[i] = input[i] * scale (the same for packed spectra)
+void spectral_scale(
+        CkFftContext* context, 
+        const CkFftComplex* input, 
+        float scale,
+        CkFftComplex* output, 
+        CkFftSize count);
+
+// Sum of a[i] * b[i] for count real values (such as a band of a power spectrum 
+// and the weights of a filter); the arrays need not be aligned.
+float spectral_dot(
+        CkFftContext* context, 
+        const float* a, 
+        const float* b, 
+        CkFftSize count);
+
+// The cross-spectrum for correlation, in one pass: output[i] = x[i] * conj(y[i]), 
+// weighted as given, multiplied by scale, and negated for odd i (so the inverse 
+// FFT is rotated by half its size, putting lag 0 in the middle).  For 
+// kCkFftWeighting_Scot, powerX and powerY hold the smoothed power spectra, which
+// are updated as powerX[i] = smoothing*powerX[i] + (1 - smoothing)*|x[i]|^2; they 
+// are not used otherwise.  The output may be the same buffer as x or y.
+void spectral_correlate(
+        CkFftContext* context, 
+        const CkFftComplex* x, 
+        const CkFftComplex* y, 
+        CkFftWeighting weighting,
+        float* powerX, 
+        float* powerY, 
+        float smoothing,
+        float scale, 
+        CkFftComplex* output, 
+        CkFftSize count);
+
+}
@@ -0,0 +1,162 @@
+#include "ckfft/platform.h"
+#include "ckfft/debug.h"
+#include "ckfft/spectral_default.h"
+#include "ckfft/math_util.h"
+#include <math.h>
+
+
+namespace ckfft
+{
+
+void spectral_multiply_default(
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count)
+{
+    // output may be the same as a or b, so read both before writing
+    const CkFftComplex* aEnd = a + count;
+    CkFftComplex tmp;
+    while (a < aEnd)
+    {
+        multiply(*a, *b, tmp);
+        *output = tmp;
+        ++a;
+        ++b;
+        ++output;
+    }
+}
+
+void spectral_multiply_add_default(
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count)
+{
+    const CkFftComplex* aEnd = a + count;
+    CkFftComplex tmp;
+    while (a < aEnd)
+    {
+        multiply(*a, *b, tmp);
+        output->real += tmp.real;
+        output->imag += tmp.imag;
+        ++a;
+        ++b;
+        ++output;
+    }
+}
+
+void spectral_conjugate_multiply_default(
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count)
+{
+    // output may be the same as a or b, so read both before writing
+    const CkFftComplex* aEnd = a + count;
+    CkFftComplex tmp;
+    while (a < aEnd)
+    {
+        tmp.real = a->real * b->real + a->imag * b->imag;
+        tmp.imag = a->imag * b->real - a->real * b->imag;
+        *output = tmp;
+        ++a;
+        ++b;
+        ++output;
+    }
+}
+
+void spectral_conjugate_multiply_add_default(
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count)
+{
+    const CkFftComplex* aEnd = a + count;
+    CkFftComplex tmp;
+    while (a < aEnd)
+    {
+        tmp.real = a->real * b->real + a->imag * b->imag;
+        tmp.imag = a->imag * b->real - a->real * b->imag;
+        output->real += tmp.real;
+        output->imag += tmp.imag;
+        ++a;
+        ++b;
+        ++output;
+    }
+}
+
+void spectral_scale_default(
+        const CkFftComplex* input, 
+        float scale, 
+        CkFftComplex* output, 
+        CkFftSize count)
+{
+    const CkFftComplex* inputEnd = input + count;
+    while (input < inputEnd)
+    {
+        multiply(*input, scale, *output);
+        ++input;
+        ++output;
+    }
+}
+
+float spectral_dot_default(
+        const float* a, 
+        const float* b, 
+        CkFftSize count)
+{
+    float sum = 0.0f;
+    const float* aEnd = a + count;
+    while (a < aEnd)
+    {
+        sum += *a * *b;
+        ++a;
+        ++b;
+    }
+    return sum;
+}
+
+void spectral_correlate_default(
+        const CkFftComplex* x, 
+        const CkFftComplex* y, 
+        CkFftWeighting weighting,
+        float* powerX, 
+        float* powerY, 
+        float smoothing,
+        float scale, 
+        CkFftComplex* output, 
+        CkFftSize count)
+{
+    // added to the squared magnitudes, so silent bins don't divide by 0
+    const float k_epsilon = 1.0e-30f;
+
+    float sign = 1.0f;
+    for (CkFftSize i = 0; i < count; ++i)
+    {
+        // x * conj(y)
+        CkFftComplex cross;
+        cross.real = x[i].real * y[i].real + x[i].imag * y[i].imag;
+        cross.imag = x[i].imag * y[i].real - x[i].real * y[i].imag;
+
+        float weight = scale * sign;
+        if (weighting == kCkFftWeighting_Phat)
+        {
+            weight /= sqrtf(cross.real * cross.real + cross.imag * cross.imag + k_epsilon);
+        }
+        else if (weighting == kCkFftWeighting_Scot)
+        {
+            float px = smoothing * powerX[i] + (1.0f - smoothing) * (x[i].real * x[i].real + x[i].imag * x[i].imag);
+            float py = smoothing * powerY[i] + (1.0f - smoothing) * (y[i].real * y[i].real + y[i].imag * y[i].imag);
+            powerX[i] = px;
+            powerY[i] = py;
+            weight /= sqrtf(px * py + k_epsilon);
+        }
+
+        output[i].real = cross.real * weight;
+        output[i].imag = cross.imag * weight;
+        sign = -sign;
+    }
+}
+
+} // namespace ckfft
@@ -0,0 +1,54 @@
+#pragma once
+#include "ckfft/ckfft.h"
+
+
+namespace ckfft
+{
+
+void spectral_multiply_default(
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count);
+
+void spectral_multiply_add_default(
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count);
+
+void spectral_conjugate_multiply_default(
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count);
+
+void spectral_conjugate_multiply_add_default(
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count);
+
+void spectral_scale_default(
+        const CkFftComplex* input, 
+        float scale, 
+        CkFftComplex* output, 
+        CkFftSize count);
+
+float spectral_dot_default(
+        const float* a, 
+        const float* b, 
+        CkFftSize count);
+
+void spectral_correlate_default(
+        const CkFftComplex* x, 
+        const CkFftComplex* y, 
+        CkFftWeighting weighting,
+        float* powerX, 
+        float* powerY, 
+        float smoothing,
+        float scale, 
+        CkFftComplex* output, 
+        CkFftSize count);
+
+}
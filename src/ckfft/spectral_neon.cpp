@@ -0,0 +1,315 @@
+#include "ckfft/platform.h"
+#include "ckfft/debug.h"
+#include "ckfft/spectral_neon.h"
+#include "ckfft/spectral_default.h"
+#include "ckfft/math_util.h"
+
+#if CKFFT_ARM_NEON
+#  include <arm_neon.h>
+#endif 
+
+namespace ckfft
+{
+
+#if CKFFT_ARM_NEON
+
+void spectral_multiply_neon(
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count)
+{
+    const CkFftComplex* aEnd = a + (count & ~3);
+    float32x4x2_t out_v;
+    while (a < aEnd)
+    {
+        float32x4x2_t a_v = vld2q_f32((const float32_t*) a);
+        float32x4x2_t b_v = vld2q_f32((const float32_t*) b);
+        multiply(a_v, b_v, out_v);
+        vst2q_f32((float32_t*) output, out_v);
+
+        a += 4;
+        b += 4;
+        output += 4;
+    }
+
+    // remaining elements
+    spectral_multiply_default(a, b, output, count & 3);
+}
+
+void spectral_multiply_add_neon(
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count)
+{
+    const CkFftComplex* aEnd = a + (count & ~3);
+    while (a < aEnd)
+    {
+        float32x4x2_t a_v = vld2q_f32((const float32_t*) a);
+        float32x4x2_t b_v = vld2q_f32((const float32_t*) b);
+        float32x4x2_t out_v = vld2q_f32((const float32_t*) output);
+
+        // (a + bi)(c + di) = (ac - bd) + (bc + ad)i, accumulated into the output
+        out_v.val[0] = vmlaq_f32(out_v.val[0], a_v.val[0], b_v.val[0]);
+        out_v.val[0] = vmlsq_f32(out_v.val[0], a_v.val[1], b_v.val[1]);
+        out_v.val[1] = vmlaq_f32(out_v.val[1], a_v.val[1], b_v.val[0]);
+        out_v.val[1] = vmlaq_f32(out_v.val[1], a_v.val[0], b_v.val[1]);
+        vst2q_f32((float32_t*) output, out_v);
+
+        a += 4;
+        b += 4;
+        output += 4;
+    }
+
+    // remaining elements
+    spectral_multiply_add_default(a, b, output, count & 3);
+}
+
+void spectral_conjugate_multiply_neon(
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count)
+{
+    const CkFftComplex* aEnd = a + (count & ~3);
+    float32x4x2_t out_v;
+    while (a < aEnd)
+    {
+        float32x4x2_t a_v = vld2q_f32((const float32_t*) a);
+        float32x4x2_t b_v = vld2q_f32((const float32_t*) b);
+
+        // (a + bi)(c - di) = (ac + bd) + (bc - ad)i
+        out_v.val[0] = vmulq_f32(a_v.val[0], b_v.val[0]);
+        out_v.val[0] = vmlaq_f32(out_v.val[0], a_v.val[1], b_v.val[1]);
+        out_v.val[1] = vmulq_f32(a_v.val[1], b_v.val[0]);
+        out_v.val[1] = vmlsq_f32(out_v.val[1], a_v.val[0], b_v.val[1]);
+        vst2q_f32((float32_t*) output, out_v);
+
+        a += 4;
+        b += 4;
+        output += 4;
+    }
+
+    // remaining elements
+    spectral_conjugate_multiply_default(a, b, output, count & 3);
+}
+
+void spectral_conjugate_multiply_add_neon(
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count)
+{
+    const CkFftComplex* aEnd = a + (count & ~3);
+    while (a < aEnd)
+    {
+        float32x4x2_t a_v = vld2q_f32((const float32_t*) a);
+        float32x4x2_t b_v = vld2q_f32((const float32_t*) b);
+        float32x4x2_t out_v = vld2q_f32((const float32_t*) output);
+
+        // (a + bi)(c - di) = (ac + bd) + (bc - ad)i, accumulated into the output
+        out_v.val[0] = vmlaq_f32(out_v.val[0], a_v.val[0], b_v.val[0]);
+        out_v.val[0] = vmlaq_f32(out_v.val[0], a_v.val[1], b_v.val[1]);
+        out_v.val[1] = vmlaq_f32(out_v.val[1], a_v.val[1], b_v.val[0]);
+        out_v.val[1] = vmlsq_f32(out_v.val[1], a_v.val[0], b_v.val[1]);
+        vst2q_f32((float32_t*) output, out_v);
+
+        a += 4;
+        b += 4;
+        output += 4;
+    }
+
+    // remaining elements
+    spectral_conjugate_multiply_add_default(a, b, output, count & 3);
+}
+
+void spectral_scale_neon(
+        const CkFftComplex* input, 
+        float scale, 
+        CkFftComplex* output, 
+        CkFftSize count)
+{
+    // the real and imaginary parts are scaled the same, so treat them as floats
+    const CkFftComplex* inputEnd = input + (count & ~1);
+    while (input < inputEnd)
+    {
+        float32x4_t in_v = vld1q_f32((const float32_t*) input);
+        vst1q_f32((float32_t*) output, vmulq_n_f32(in_v, scale));
+
+        input += 2;
+        output += 2;
+    }
+
+    // remaining element
+    spectral_scale_default(input, scale, output, count & 1);
+}
+
+float spectral_dot_neon(
+        const float* a, 
+        const float* b, 
+        CkFftSize count)
+{
+    // two accumulators, to hide the latency of the multiply-accumulates
+    const float* aEnd = a + (count & ~7);
+    float32x4_t sum0_v = vdupq_n_f32(0.0f);
+    float32x4_t sum1_v = vdupq_n_f32(0.0f);
+    while (a < aEnd)
+    {
+        sum0_v = vmlaq_f32(sum0_v, vld1q_f32(a), vld1q_f32(b));
+        sum1_v = vmlaq_f32(sum1_v, vld1q_f32(a + 4), vld1q_f32(b + 4));
+
+        a += 8;
+        b += 8;
+    }
+    if (count & 4)
+    {
+        sum0_v = vmlaq_f32(sum0_v, vld1q_f32(a), vld1q_f32(b));
+
+        a += 4;
+        b += 4;
+    }
+    sum0_v = vaddq_f32(sum0_v, sum1_v);
+    float32x2_t sum_v = vadd_f32(vget_low_f32(sum0_v), vget_high_f32(sum0_v));
+    float sum = vget_lane_f32(vpadd_f32(sum_v, sum_v), 0);
+
+    // remaining elements
+    return sum + spectral_dot_default(a, b, count & 3);
+}
+
+namespace
+{
+    // 1/sqrt(x), from the estimate refined with 2 Newton-Raphson steps
+    inline float32x4_t reciprocalSqrt(float32x4_t x)
+    {
+        float32x4_t e = vrsqrteq_f32(x);
+        e = vmulq_f32(e, vrsqrtsq_f32(vmulq_f32(x, e), e));
+        e = vmulq_f32(e, vrsqrtsq_f32(vmulq_f32(x, e), e));
+        return e;
+    }
+}
+
+void spectral_correlate_neon(
+        const CkFftComplex* x, 
+        const CkFftComplex* y, 
+        CkFftWeighting weighting,
+        float* powerX, 
+        float* powerY, 
+        float smoothing,
+        float scale, 
+        CkFftComplex* output, 
+        CkFftSize count)
+{
+    const float k_epsilon = 1.0e-30f;
+    const float32x4_t epsilon_v = vdupq_n_f32(k_epsilon);
+
+    // alternating signs, starting with + (each group of 4 starts at an even index)
+    const float signs[4] = { scale, -scale, scale, -scale };
+    const float32x4_t scale_v = vld1q_f32(signs);
+
+    CkFftSize count4 = count & ~3;
+    for (CkFftSize i = 0; i < count4; i += 4)
+    {
+        float32x4x2_t x_v = vld2q_f32((const float32_t*) (x + i));
+        float32x4x2_t y_v = vld2q_f32((const float32_t*) (y + i));
+
+        // (a + bi)(c - di) = (ac + bd) + (bc - ad)i
+        float32x4x2_t cross_v;
+        cross_v.val[0] = vmulq_f32(x_v.val[0], y_v.val[0]);
+        cross_v.val[0] = vmlaq_f32(cross_v.val[0], x_v.val[1], y_v.val[1]);
+        cross_v.val[1] = vmulq_f32(x_v.val[1], y_v.val[0]);
+        cross_v.val[1] = vmlsq_f32(cross_v.val[1], x_v.val[0], y_v.val[1]);
+
+        float32x4_t weight_v = scale_v;
+        if (weighting == kCkFftWeighting_Phat)
+        {
+            float32x4_t mag2_v = vmlaq_f32(epsilon_v, cross_v.val[0], cross_v.val[0]);
+            mag2_v = vmlaq_f32(mag2_v, cross_v.val[1], cross_v.val[1]);
+            weight_v = vmulq_f32(weight_v, reciprocalSqrt(mag2_v));
+        }
+        else if (weighting == kCkFftWeighting_Scot)
+        {
+            float32x4_t px_v = vmulq_f32(x_v.val[0], x_v.val[0]);
+            px_v = vmlaq_f32(px_v, x_v.val[1], x_v.val[1]);
+            float32x4_t py_v = vmulq_f32(y_v.val[0], y_v.val[0]);
+            py_v = vmlaq_f32(py_v, y_v.val[1], y_v.val[1]);
+            px_v = vmulq_n_f32(px_v, 1.0f - smoothing);
+            py_v = vmulq_n_f32(py_v, 1.0f - smoothing);
+            px_v = vmlaq_n_f32(px_v, vld1q_f32(powerX + i), smoothing);
+            py_v = vmlaq_n_f32(py_v, vld1q_f32(powerY + i), smoothing);
+            vst1q_f32(powerX + i, px_v);
+            vst1q_f32(powerY + i, py_v);
+            weight_v = vmulq_f32(weight_v, reciprocalSqrt(vmlaq_f32(epsilon_v, px_v, py_v)));
+        }
+
+        cross_v.val[0] = vmulq_f32(cross_v.val[0], weight_v);
+        cross_v.val[1] = vmulq_f32(cross_v.val[1], weight_v);
+        vst2q_f32((float32_t*) (output + i), cross_v);
+    }
+
+    // remaining elements
+    spectral_correlate_default(x + count4, y + count4, weighting, 
+            powerX ? powerX + count4 : NULL, powerY ? powerY + count4 : NULL, 
+            smoothing, scale, output + count4, count & 3);
+}
+
+#else // CKFFT_ARM_NEON
+
+void spectral_multiply_neon(
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count)
+{}
+
+void spectral_multiply_add_neon(
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count)
+{}
+
+void spectral_conjugate_multiply_neon(
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count)
+{}
+
+void spectral_conjugate_multiply_add_neon(
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count)
+{}
+
+void spectral_scale_neon(
+        const CkFftComplex* input, 
+        float scale, 
+        CkFftComplex* output, 
+        CkFftSize count)
+{}
+
+float spectral_dot_neon(
+        const float* a, 
+        const float* b, 
+        CkFftSize count)
+{
+    return 0.0f;
+}
+
+void spectral_correlate_neon(
+        const CkFftComplex* x, 
+        const CkFftComplex* y, 
+        CkFftWeighting weighting,
+        float* powerX, 
+        float* powerY, 
+        float smoothing,
+        float scale, 
+        CkFftComplex* output, 
+        CkFftSize count)
+{}
+
+#endif // CKFFT_ARM_NEON
+
+} // namespace ckfft
@@ -0,0 +1,54 @@
+#pragma once
+#include "ckfft/ckfft.h"
+
+
+namespace ckfft
+{
+
+void spectral_multiply_neon(
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count);
+
+void spectral_multiply_add_neon(
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count);
+
+void spectral_conjugate_multiply_neon(
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count);
+
+void spectral_conjugate_multiply_add_neon(
+        const CkFftComplex* a, 
+        const CkFftComplex* b, 
+        CkFftComplex* output, 
+        CkFftSize count);
+
+void spectral_scale_neon(
+        const CkFftComplex* input, 
+        float scale, 
+        CkFftComplex* output, 
+        CkFftSize count);
+
+float spectral_dot_neon(
+        const float* a, 
+        const float* b, 
+        CkFftSize count);
+
+void spectral_correlate_neon(
+        const CkFftComplex* x, 
+        const CkFftComplex* y, 
+        CkFftWeighting weighting,
+        float* powerX, 
+        float* powerY, 
+        float smoothing,
+        float scale, 
+        CkFftComplex* output, 
+        CkFftSize count);
+
+}
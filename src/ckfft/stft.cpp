@@ -0,0 +1,134 @@
+#include "ckfft/platform.h"
+#include "ckfft/debug.h"
+#include "ckfft/stft.h"
+#include "ckfft/context.h"
+#include "ckfft/fft_real.h"
+#include <new>
+#include <string.h>
+
+using namespace ckfft;
+
+_CkFftStft::_CkFftStft() :
+    context(NULL),
+    frameSize(0),
+    hopSize(0),
+    window(NULL),
+    ring(NULL),
+    ringPos(0),
+    hopPos(0),
+    allocBuf(NULL)
+{}
+
+_CkFftStft* _CkFftStft::create(CkFftContext* context, CkFftSize frameSize, CkFftSize hopSize, const float* window, void* userBuf, size_t* userBufSize)
+{
+    // object, followed by the ring buffer and the window, all aligned
+    AlignedBuf alignedBuf(sizeof(_CkFftStft));
+    alignedBuf.addTable(frameSize * 2 * sizeof(float));
+    if (window)
+    {
+        alignedBuf.addTable(frameSize * sizeof(float));
+    }
+
+    size_t reqBufSize = alignedBuf.getRequiredSize();
+    if (userBufSize && (!userBuf || *userBufSize < reqBufSize))
+    {
+        *userBufSize = reqBufSize;
+        return NULL;
+    }
+
+    // allocate buffer if needed
+    void* buf = alignedBuf.allocate(userBuf);
+    if (!buf)
+    {
+        return NULL;
+    }
+
+    // initialize
+    _CkFftStft* stft = new (buf) _CkFftStft();
+    stft->context = context;
+    stft->frameSize = frameSize;
+    stft->hopSize = hopSize;
+    stft->ring = (float*) alignedBuf.getTable(0);
+    if (window)
+    {
+        float* windowBuf = (float*) alignedBuf.getTable(1);
+        memcpy(windowBuf, window, frameSize * sizeof(float));
+        stft->window = windowBuf;
+    }
+    stft->allocBuf = alignedBuf.getAllocatedBuf();
+    stft->allocator = alignedBuf.getAllocator();
+    stft->reset();
+
+    return stft;
+}
+
+void _CkFftStft::destroy(_CkFftStft* stft)
+{
+    if (stft)
+    {
+        stft->allocator.free(stft->allocBuf);
+    }
+}
+
+void _CkFftStft::reset()
+{
+    // the stream starts as if it were preceded by silence
+    memset(ring, 0, frameSize * 2 * sizeof(float));
+    ringPos = 0;
+    hopPos = 0;
+}
+
+CkFftSize _CkFftStft::getFrameCount(CkFftSize count) const
+{
+    return (hopPos + count) / hopSize;
+}
+
+CkFftSize _CkFftStft::process(const float* input, CkFftSize count, CkFftComplex* output)
+{
+    LocalContext local(context);
+    CkFftSize frames = 0;
+    CkFftSize spectrumSize = frameSize/2 + 1;
+    const float* in = input;
+    const float* inEnd = input + count;
+    while (in < inEnd)
+    {
+        // copy up to the end of the hop or the end of the ring, whichever is first
+        CkFftSize n = inEnd - in;
+        if (n > hopSize - hopPos)
+        {
+            n = hopSize - hopPos;
+        }
+        if (n > frameSize - ringPos)
+        {
+            n = frameSize - ringPos;
+        }
+        memcpy(ring + ringPos, in, n * sizeof(float));
+        memcpy(ring + ringPos + frameSize, in, n * sizeof(float));
+        in += n;
+        ringPos += n;
+        if (ringPos == frameSize)
+        {
+            ringPos = 0;
+        }
+        hopPos += n;
+
+        if (hopPos == hopSize)
+        {
+            // the frame is the last frameSize samples, starting with the oldest
+            const float* frame = ring + ringPos;
+            if (window)
+            {
+                fft_real_windowed(local, frame, window, output, frameSize);
+            }
+            else
+            {
+                fft_real(local, frame, 1, output, frameSize, false);
+            }
+            output += spectrumSize;
+            ++frames;
+            hopPos = 0;
+        }
+    }
+    return frames;
+}
+
@@ -0,0 +1,39 @@
+#pragma once
+#include "ckfft/ckfft.h"
+#include "ckfft/alloc.h"
+
+// Streaming short-time Fourier transform (see CkFftStftInit()).
+
+struct _CkFftStft
+{
+    CkFftContext* context;
+    CkFftSize frameSize;
+    CkFftSize hopSize;
+    const float* window; // NULL for a rectangular window
+
+    // The last frameSize samples, each stored twice (at i and i + frameSize), so 
+    // that every frame is contiguous.
+    float* ring;
+    CkFftSize ringPos;   // position of the oldest sample (the next to be replaced)
+    CkFftSize hopPos;    // samples received since the last frame
+
+    void* allocBuf; // memory allocated by us (NULL if the user's buffer was used)
+    ckfft::Allocator allocator; // allocator for allocBuf
+
+    // number of frames that process() will output for count more samples
+    CkFftSize getFrameCount(CkFftSize count) const;
+
+    // add count samples, writing the spectrum of each frame completed to output;
+    // returns the number of frames
+    CkFftSize process(const float* input, CkFftSize count, CkFftComplex* output);
+
+    void reset();
+
+    static _CkFftStft* create(CkFftContext* context, CkFftSize frameSize, CkFftSize hopSize, const float* window, void* buf, size_t* bufSize);
+    static void destroy(_CkFftStft*);
+
+private:
+    _CkFftStft();
+};
+
+
@@ -0,0 +1,50 @@
+#include "ckfft/platform.h"
+#include "ckfft/debug.h"
+#include "ckfft/window.h"
+
+#if CKFFT_PLATFORM_WIN
+#  define _USE_MATH_DEFINES
+#endif
+
+#include <math.h>
+
+
+namespace ckfft
+{
+
+void makeWindow(CkFftWindowType type, CkFftSize count, float* window)
+{
+    // generalized cosine windows: a0 - a1*cos(2*pi*i/n) + a2*cos(4*pi*i/n)
+    double a0 = 1.0;
+    double a1 = 0.0;
+    double a2 = 0.0;
+    switch (type)
+    {
+        case kCkFftWindow_Hann:
+            a0 = 0.5;
+            a1 = 0.5;
+            break;
+
+        case kCkFftWindow_Hamming:
+            a0 = 0.54;
+            a1 = 0.46;
+            break;
+
+        case kCkFftWindow_Blackman:
+            a0 = 0.42;
+            a1 = 0.5;
+            a2 = 0.08;
+            break;
+
+        default:
+            break;
+    }
+
+    for (CkFftSize i = 0; i < count; ++i)
+    {
+        double theta = 2.0 * M_PI * (double) i / (double) count;
+        window[i] = (float) (a0 - a1 * cos(theta) + a2 * cos(2.0 * theta));
+    }
+}
+
+}
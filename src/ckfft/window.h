@@ -0,0 +1,11 @@
+#pragma once
+#include "ckfft/ckfft.h"
+
+
+namespace ckfft
+{
+
+// Fill window with count values of a periodic window function (see CkFftWindow()).
+void makeWindow(CkFftWindowType type, CkFftSize count, float* window);
+
+}
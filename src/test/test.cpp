@@ -1,6 +1,7 @@
 #include <assert.h>
 #include <math.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sys/stat.h>
 
 #include <iostream>
@@ -13,7 +14,12 @@
 #include "ckfft/ckfft.h"
 #include "ckfft/platform.h"
 #include "ckfft/context.h"
+#include "ckfft/context_fixed.h"
+#include "ckfft/context_double.h"
 #include "ckfft/debug.h"
+#include "ckfft/half.h"
+#include "ckfft/scratch.h"
+#include "ckfft/math_util.h"
 
 #include "timer.h"
 #include "stats.h"
@@ -237,11 +243,19 @@ public:
         FftTester(), 
         m_context(NULL), 
         m_maxCount(-1),
+        m_inPlace(false),
+        m_noTmpBuf(false),
         m_tmpBuf(NULL)
     {}
 
     void setMaxCount(int maxCount) { m_maxCount = maxCount; }
 
+    // copy input to output buffer and transform it there
+    void setInPlace(bool inPlace) { m_inPlace = inPlace; }
+
+    // don't pass a temp buffer to CkFftRealInverse()
+    void setNoTmpBuf(bool noTmpBuf) { m_noTmpBuf = noTmpBuf; }
+
     static void setNoNeon(bool noNeon) { s_noNeon = noNeon; }
     static bool isNeonEnabled()
     {
@@ -268,26 +282,38 @@ protected:
 
     virtual void runSub()
     {
+        const CkFftComplex* input = m_input;
+        if (m_inPlace)
+        {
+            size_t inputSize = m_count * sizeof(CkFftComplex);
+            if (m_real)
+            {
+                inputSize = (m_inverse ? (m_count/2 + 1) * sizeof(CkFftComplex) : m_count * sizeof(float));
+            }
+            memcpy(m_output, m_input, inputSize);
+            input = m_output;
+        }
+
         if (m_real)
         {
             if (m_inverse)
             {
-                CkFftVerify( CkFftRealInverse(m_context, m_count, m_input, (float*) m_output, m_tmpBuf) );
+                CkFftVerify( CkFftRealInverse(m_context, m_count, input, (float*) m_output, (m_noTmpBuf ? NULL : m_tmpBuf)) );
             }
             else
             {
-                CkFftVerify( CkFftRealForward(m_context, m_count, (float*) m_input, m_output) );
+                CkFftVerify( CkFftRealForward(m_context, m_count, (float*) input, m_output) );
             }
         }
         else
         {
             if (m_inverse)
             {
-                CkFftVerify( CkFftComplexInverse(m_context, m_count, m_input, m_output) );
+                CkFftVerify( CkFftComplexInverse(m_context, m_count, input, m_output) );
             }
             else
             {
-                CkFftVerify( CkFftComplexForward(m_context, m_count, m_input, m_output) );
+                CkFftVerify( CkFftComplexForward(m_context, m_count, input, m_output) );
             }
         }
     }
@@ -303,6 +329,8 @@ protected:
 private:
     CkFftContext* m_context;
     int m_maxCount;
+    bool m_inPlace;
+    bool m_noTmpBuf;
     CkFftComplex* m_tmpBuf;
 
     static bool s_noNeon;
@@ -785,6 +813,63 @@ bool regressionTestComplex(const CkFftComplex* input, int count, int maxCount, b
     return success;
 }
 
+// compare power, magnitude, and decibel spectra with values computed from the 
+// output of real FFTs
+bool regressionTestPowerSpectrum(const float* input, int count, int maxCount, bool inPlace)
+{
+    CkFftContext* context = CkFftInit(maxCount, kCkFftDirection_Forward, NULL, NULL);
+    if (!CkFftTester::isNeonEnabled())
+    {
+        context->neon = false;
+    }
+    CkFftVerify( CkFftSetScale(context, kCkFftDirection_Forward, kCkFftScale_1OverSqrtN, 1.0f) );
+
+    vector<CkFftComplex> spectrum;
+    spectrum.resize(count/2 + 1);
+    CkFftVerify( CkFftRealForward(context, count, input, &spectrum[0]) );
+
+    typedef int (*Func)(CkFftContext*, CkFftSize, const float*, float*, CkFftComplex*);
+    const Func k_funcs[] = { CkFftRealPowerSpectrum, CkFftRealMagnitude, CkFftRealPowerSpectrumDb };
+
+    float err = 0.0f;
+    vector<float> output;
+    for (int f = 0; f < 3; ++f)
+    {
+        // in place, or out of place using the scratch buffer
+        output.assign(input, input + count);
+        const float* in = (inPlace ? &output[0] : input);
+        if (!inPlace)
+        {
+            output.assign(count/2 + 1, 0.0f);
+        }
+        CkFftVerify( k_funcs[f](context, count, in, &output[0], NULL) );
+
+        float sumSq = 0.0f;
+        for (int i = 0; i <= count/2; ++i)
+        {
+            float power = spectrum[i].real * spectrum[i].real + spectrum[i].imag * spectrum[i].imag;
+            float expected = (f == 0 ? power : (f == 1 ? sqrtf(power) : 10.0f * log10f(max(power, 1.0e-20f))));
+            float diff = output[i] - expected;
+            sumSq += diff * diff;
+        }
+        err = max(err, sqrtf(sumSq / (count/2 + 1)));
+    }
+    CkFftShutdown(context);
+
+    bool success = true;
+    const float k_thresh = 0.0001f; // threshold for RMS comparison
+    CKFFT_PRINTF("count=%-5d, maxCount=%-5d, neon=%d, inPlace=%d: err %f", 
+            count, maxCount, CkFftTester::isNeonEnabled(), inPlace, err);
+    if (err > k_thresh)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
+    CKFFT_PRINTF("\n");
+
+    return success;
+}
+
 bool regressionTestReal(const CkFftComplex* realInput, const float* floatInput, int count, int maxCount)
 {
     bool success = true;
@@ -863,59 +948,2340 @@ bool regressionTestReal(const CkFftComplex* realInput, const float* floatInput,
     return success;
 }
 
-bool regressionTest()
+// compare in-place FFT, or real inverse FFT without temp buffer, against regular FFT
+bool regressionTestInPlace(const CkFftComplex* input, int count, int maxCount, bool inverse, bool real, bool inPlace, bool noTmpBuf)
 {
-    // read input
-    vector<CkFftComplex> input;
-    string path;
-    getInputDir(path);
-    path += "/input.txt";
-    read(input, path.c_str());
-    int count = (int) input.size();
+    CkFftTester ckfft;
+    ckfft.setMaxCount(maxCount);
+
+    vector<CkFftComplex> refOutput;
+    refOutput.resize(count);
+    ckfft.init(input, &refOutput[0], count, inverse, real);
+    ckfft.run();
+    ckfft.shutdown();
+
+    vector<CkFftComplex> output;
+    output.resize(count);
+    ckfft.setInPlace(inPlace);
+    ckfft.setNoTmpBuf(noTmpBuf);
+    ckfft.init(input, &output[0], count, inverse, real);
+    ckfft.run();
+    ckfft.shutdown();
+
+    int outputCount = count;
+    if (real)
+    {
+        // real inverse: count floats; real forward: count/2+1 complex values
+        outputCount = (inverse ? (count+1)/2 : count/2 + 1);
+    }
 
     bool success = true;
+    float err = compare(&output[0], &refOutput[0], outputCount);
+    const float k_thresh = 0.001f; // threshold for RMS comparison
+    CKFFT_PRINTF("count=%-5d, maxCount=%-5d, inverse=%d, real=%d, neon=%d, inPlace=%d, noTmpBuf=%d: err %f", 
+            count, maxCount, inverse, real, CkFftTester::isNeonEnabled(), inPlace, noTmpBuf, err);
+    if (err > k_thresh)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
+    CKFFT_PRINTF("\n");
 
-    // compare complex forward & inverse against kiss_fft
-    CKFFT_PRINTF("complex FFTs:\n");
-    int maxCount = count*2;
-    while (count > 0)
+    return success;
+}
+
+// compare unordered FFTs with ordered FFTs, including a convolution via the 
+// pointwise product of unordered spectra
+bool regressionTestUnordered(const CkFftComplex* input, int count, int maxCount, bool inPlace)
+{
+    CkFftContext* context = CkFftInit(maxCount, kCkFftDirection_Both, NULL, NULL);
+    if (!CkFftTester::isNeonEnabled())
     {
-        // complex forward
-        success &= regressionTestComplex(&input[0], count, count, false);
-        // same with maxCount > count
-        success &= regressionTestComplex(&input[0], count, maxCount, false);
+        context->neon = false;
+    }
 
-        // complex inverse
-        success &= regressionTestComplex(&input[0], count, count, true);
-        // same with maxCount > count
-        success &= regressionTestComplex(&input[0], count, maxCount, true);
+    vector<CkFftComplex> ordered;
+    ordered.resize(count);
+    CkFftVerify( CkFftComplexForward(context, count, input, &ordered[0]) );
 
-        count /= 2;
+    vector<CkFftComplex> unordered;
+    unordered.resize(count);
+    if (inPlace)
+    {
+        memcpy(&unordered[0], input, count * sizeof(CkFftComplex));
+        CkFftVerify( CkFftComplexForwardUnordered(context, count, &unordered[0], &unordered[0]) );
+    }
+    else
+    {
+        CkFftVerify( CkFftComplexForwardUnordered(context, count, input, &unordered[0]) );
     }
 
+    vector<CkFftComplex> reordered;
+    reordered.resize(count);
+    for (int i = 0; i < count; ++i)
+    {
+        reordered[i] = unordered[CkFftUnorderedIndex(count, i)];
+    }
 
-    // compare results of real fft with results of complex fft on real input
+    bool success = true;
+    float err = compare(&reordered[0], &ordered[0], count);
+    const float k_thresh = 0.001f; // threshold for RMS comparison
+    CKFFT_PRINTF("count=%-5d, maxCount=%-5d, neon=%d, inPlace=%d, forward unordered: err %f", 
+            count, maxCount, CkFftTester::isNeonEnabled(), inPlace, err);
+    if (err > k_thresh)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
     CKFFT_PRINTF("\n");
-    CKFFT_PRINTF("real FFTs:\n");
-    vector<CkFftComplex> realInput = input;
-    vector<float> floatInput;
-    floatInput.resize(realInput.size());
-    for (int i = 0; i < (int) realInput.size(); ++i)
+
+    // circular convolution of input with itself
+    vector<CkFftComplex> refOutput;
+    refOutput.resize(count);
+    CkFftVerify( CkFftComplexMultiply(context, count, &ordered[0], &ordered[0], &ordered[0]) );
+    CkFftVerify( CkFftComplexInverse(context, count, &ordered[0], &refOutput[0]) );
+
+    vector<CkFftComplex> output;
+    output.resize(count);
+    CkFftVerify( CkFftComplexMultiply(context, count, &unordered[0], &unordered[0], &unordered[0]) );
+    if (inPlace)
     {
-        realInput[i].imag = 0.0f;
-        floatInput[i] = realInput[i].real;
+        CkFftVerify( CkFftComplexInverseUnordered(context, count, &unordered[0], &unordered[0]) );
+        output = unordered;
+    }
+    else
+    {
+        CkFftVerify( CkFftComplexInverseUnordered(context, count, &unordered[0], &output[0]) );
     }
 
-    count = (int) realInput.size();
-    while (count > 0)
+    // remove the scale factor of count from the inverse FFT
+    float scale = 1.0f / count;
+    for (int i = 0; i < count; ++i)
     {
-        // real forward and inverse
-        success &= regressionTestReal(&realInput[0], &floatInput[0], count, count);
-        // same with maxCount > count
-        success &= regressionTestReal(&realInput[0], &floatInput[0], count, maxCount);
+        output[i].real *= scale;
+        output[i].imag *= scale;
+        refOutput[i].real *= scale;
+        refOutput[i].imag *= scale;
+    }
 
-        count /= 2;
+    err = compare(&output[0], &refOutput[0], count);
+    CKFFT_PRINTF("count=%-5d, maxCount=%-5d, neon=%d, inPlace=%d, unordered convolution: err %f", 
+            count, maxCount, CkFftTester::isNeonEnabled(), inPlace, err);
+    if (err > k_thresh)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
+    CKFFT_PRINTF("\n");
+
+    CkFftShutdown(context);
+
+    return success;
+}
+
+// compare the spectral arithmetic functions with scalar arithmetic, on the input
+// and the input in reverse order; if packed, the first element is treated as two
+// real values.
+bool regressionTestSpectral(const CkFftComplex* input, int count, int maxCount, bool inPlace, bool packed)
+{
+    CkFftContext* context = CkFftInit(maxCount, kCkFftDirection_Forward, NULL, NULL);
+    if (!CkFftTester::isNeonEnabled())
+    {
+        context->neon = false;
+    }
+
+    vector<CkFftComplex> b;
+    b.resize(count);
+    for (int i = 0; i < count; ++i)
+    {
+        b[i] = input[count - 1 - i];
+    }
+
+    typedef int (*Func)(CkFftContext*, CkFftSize, const CkFftComplex*, const CkFftComplex*, CkFftComplex*);
+    const Func k_complexFuncs[] = { CkFftComplexMultiply, CkFftComplexMultiplyAdd, CkFftComplexConjugateMultiply, CkFftComplexConjugateMultiplyAdd };
+    const Func k_packedFuncs[] = { CkFftPackedMultiply, CkFftPackedMultiplyAdd, CkFftPackedConjugateMultiply, CkFftPackedConjugateMultiplyAdd };
+
+    // each function, then scaling
+    float err = 0.0f;
+    vector<CkFftComplex> output;
+    vector<CkFftComplex> expected;
+    expected.resize(count);
+    for (int f = 0; f <= 4; ++f)
+    {
+        bool conjugate = (f == 2 || f == 3);
+        bool add = (f == 1 || f == 3);
+
+        // output starts as a copy of the input (which is the first operand in place)
+        output.assign(input, input + count);
+        const CkFftComplex* a = (inPlace ? &output[0] : input);
+        if (f < 4)
+        {
+            Func func = (packed ? k_packedFuncs[f] : k_complexFuncs[f]);
+            CkFftVerify( func(context, count, a, &b[0], &output[0]) );
+        }
+        else
+        {
+            CkFftVerify( CkFftComplexScale(context, count, a, -0.5f, &output[0]) );
+        }
+
+        for (int i = 0; i < count; ++i)
+        {
+            const CkFftComplex& x = input[i];
+            CkFftComplex y = b[i];
+            CkFftComplex product;
+            if (f == 4)
+            {
+                product.real = x.real * -0.5f;
+                product.imag = x.imag * -0.5f;
+            }
+            else if (packed && i == 0)
+            {
+                product.real = x.real * y.real;
+                product.imag = x.imag * y.imag;
+            }
+            else
+            {
+                if (conjugate)
+                {
+                    y.imag = -y.imag;
+                }
+                product.real = x.real * y.real - x.imag * y.imag;
+                product.imag = x.real * y.imag + x.imag * y.real;
+            }
+            expected[i].real = product.real + (add ? x.real : 0.0f);
+            expected[i].imag = product.imag + (add ? x.imag : 0.0f);
+        }
+        err = max(err, compare(&output[0], &expected[0], count));
+    }
+    CkFftShutdown(context);
+
+    bool success = true;
+    const float k_thresh = 0.0001f; // threshold for RMS comparison
+    CKFFT_PRINTF("count=%-5d, neon=%d, inPlace=%d, packed=%d: err %f", 
+            count, CkFftTester::isNeonEnabled(), inPlace, packed, err);
+    if (err > k_thresh)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
+    CKFFT_PRINTF("\n");
+
+    return success;
+}
+
+// compare pruned FFTs of zero-padded input with the same bins of full FFTs; if 
+// binStep is not 0, a list of bins firstBin + i*binStep (mod count) is used instead 
+// of a range
+bool regressionTestPruned(const CkFftComplex* input, int count, int inputCount, int firstBin, int binCount, int binStep, bool inverse, int maxCount)
+{
+    CkFftContext* context = CkFftInit(maxCount, kCkFftDirection_Both, NULL, NULL);
+    if (!CkFftTester::isNeonEnabled())
+    {
+        context->neon = false;
+    }
+    CkFftDirection direction = (inverse ? kCkFftDirection_Inverse : kCkFftDirection_Forward);
+    CkFftVerify( CkFftSetScale(context, direction, kCkFftScale_1OverSqrtN, 1.0f) );
+
+    vector<CkFftComplex> padded;
+    padded.resize(count);
+    copy(input, input + inputCount, padded.begin());
+    vector<CkFftComplex> full;
+    full.resize(count);
+    if (inverse)
+    {
+        CkFftVerify( CkFftComplexInverse(context, count, &padded[0], &full[0]) );
+    }
+    else
+    {
+        CkFftVerify( CkFftComplexForward(context, count, &padded[0], &full[0]) );
+    }
+
+    vector<CkFftSize> bins;
+    vector<CkFftComplex> expected;
+    for (int i = 0; i < binCount; ++i)
+    {
+        int bin = (firstBin + i * (binStep ? binStep : 1)) & (count - 1);
+        bins.push_back(bin);
+        expected.push_back(full[bin]);
+    }
+    vector<CkFftComplex> output;
+    output.resize(binCount);
+    if (binStep)
+    {
+        if (inverse)
+        {
+            CkFftVerify( CkFftComplexInversePrunedBins(context, count, input, inputCount, &bins[0], binCount, &output[0], NULL) );
+        }
+        else
+        {
+            CkFftVerify( CkFftComplexForwardPrunedBins(context, count, input, inputCount, &bins[0], binCount, &output[0], NULL) );
+        }
+    }
+    else
+    {
+        if (inverse)
+        {
+            CkFftVerify( CkFftComplexInversePruned(context, count, input, inputCount, firstBin, binCount, &output[0], NULL) );
+        }
+        else
+        {
+            CkFftVerify( CkFftComplexForwardPruned(context, count, input, inputCount, firstBin, binCount, &output[0], NULL) );
+        }
+    }
+    CkFftShutdown(context);
+
+    float err = compare(&output[0], &expected[0], binCount);
+
+    bool success = true;
+    const float k_thresh = 0.0001f; // threshold for RMS comparison
+    CKFFT_PRINTF("count=%-5d, inputCount=%-5d, firstBin=%-5d, binCount=%-5d, binStep=%-3d, inverse=%d, neon=%d: err %f", 
+            count, inputCount, firstBin, binCount, binStep, inverse, CkFftTester::isNeonEnabled(), err);
+    if (err > k_thresh)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
+    CKFFT_PRINTF("\n");
+
+    return success;
+}
+
+// compare packed real FFTs with unpacked real FFTs
+bool regressionTestPacked(const float* input, int count, int maxCount, bool inPlace)
+{
+    CkFftContext* context = CkFftInit(maxCount, kCkFftDirection_Both, NULL, NULL);
+    if (!CkFftTester::isNeonEnabled())
+    {
+        context->neon = false;
+    }
+
+    int countDiv2 = count/2;
+
+    vector<CkFftComplex> refSpectrum;
+    refSpectrum.resize(countDiv2 + 1);
+    CkFftVerify( CkFftRealForward(context, count, input, &refSpectrum[0]) );
+
+    // packed spectrum; real input needs count floats, i.e. countDiv2 complex values
+    vector<CkFftComplex> spectrum;
+    spectrum.resize(countDiv2);
+    if (inPlace)
+    {
+        memcpy(&spectrum[0], input, count * sizeof(float));
+        CkFftVerify( CkFftRealForwardPacked(context, count, (const float*) &spectrum[0], &spectrum[0]) );
+    }
+    else
+    {
+        CkFftVerify( CkFftRealForwardPacked(context, count, input, &spectrum[0]) );
+    }
+
+    vector<CkFftComplex> unpacked = spectrum;
+    unpacked.resize(countDiv2 + 1);
+    unpacked[countDiv2].real = spectrum[0].imag;
+    unpacked[countDiv2].imag = 0.0f;
+    unpacked[0].imag = 0.0f;
+
+    bool success = true;
+    float err = compare(&unpacked[0], &refSpectrum[0], countDiv2 + 1);
+    const float k_thresh = 0.001f; // threshold for RMS comparison
+    CKFFT_PRINTF("count=%-5d, maxCount=%-5d, neon=%d, inPlace=%d, forward packed: err %f", 
+            count, maxCount, CkFftTester::isNeonEnabled(), inPlace, err);
+    if (err > k_thresh)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
+    CKFFT_PRINTF("\n");
+
+    vector<float> refOutput;
+    refOutput.resize(count);
+    CkFftVerify( CkFftRealInverse(context, count, &refSpectrum[0], &refOutput[0], NULL) );
+
+    vector<float> output;
+    output.resize(count);
+    if (inPlace)
+    {
+        CkFftVerify( CkFftRealInversePacked(context, count, &spectrum[0], (float*) &spectrum[0], NULL) );
+        memcpy(&output[0], &spectrum[0], count * sizeof(float));
+    }
+    else
+    {
+        vector<CkFftComplex> tmpBuf;
+        tmpBuf.resize(countDiv2);
+        CkFftVerify( CkFftRealInversePacked(context, count, &spectrum[0], &output[0], &tmpBuf[0]) );
+    }
+
+    // compare at the scale of the input
+    float scale = 0.5f / count;
+    for (int i = 0; i < count; ++i)
+    {
+        output[i] *= scale;
+        refOutput[i] *= scale;
+    }
+
+    err = compare((const CkFftComplex*) &output[0], (const CkFftComplex*) &refOutput[0], countDiv2);
+    CKFFT_PRINTF("count=%-5d, maxCount=%-5d, neon=%d, inPlace=%d, inverse packed: err %f", 
+            count, maxCount, CkFftTester::isNeonEnabled(), inPlace, err);
+    if (err > k_thresh)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
     }
+    CKFFT_PRINTF("\n");
+
+    CkFftShutdown(context);
+
+    return success;
+}
+
+// check that FFTs with scaling set on the context match unscaled FFTs, scaled 
+// afterwards, and that the 1/n scaling gives round trips without scaling
+bool regressionTestScale(const CkFftComplex* input, const float* floatInput, int count, int maxCount)
+{
+    CkFftContext* refContext = CkFftInit(maxCount, kCkFftDirection_Both, NULL, NULL);
+    CkFftContext* context = CkFftInit(maxCount, kCkFftDirection_Both, NULL, NULL);
+    if (!CkFftTester::isNeonEnabled())
+    {
+        refContext->neon = false;
+        context->neon = false;
+    }
+
+    bool success = true;
+    const float k_thresh = 0.001f; // threshold for RMS comparison
+
+    // forward complex, unitary scaling with an extra factor, out-of-place and in-place
+    const float k_factor = 0.75f;
+    CkFftVerify( CkFftSetScale(context, kCkFftDirection_Forward, kCkFftScale_1OverSqrtN, k_factor) );
+
+    vector<CkFftComplex> refOutput;
+    refOutput.resize(count);
+    CkFftVerify( CkFftComplexForward(refContext, count, input, &refOutput[0]) );
+    float scale = k_factor / sqrtf((float) count);
+    for (int i = 0; i < count; ++i)
+    {
+        refOutput[i].real *= scale;
+        refOutput[i].imag *= scale;
+    }
+
+    vector<CkFftComplex> output;
+    output.resize(count);
+    CkFftVerify( CkFftComplexForward(context, count, input, &output[0]) );
+    float err = compare(&output[0], &refOutput[0], count);
+
+    memcpy(&output[0], input, count * sizeof(CkFftComplex));
+    CkFftVerify( CkFftComplexForward(context, count, &output[0], &output[0]) );
+    err = max(err, compare(&output[0], &refOutput[0], count));
+
+    CKFFT_PRINTF("count=%-5d, maxCount=%-5d, neon=%d, scaled complex forward: err %f", count, maxCount, CkFftTester::isNeonEnabled(), err);
+    if (err > k_thresh)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
+    CKFFT_PRINTF("\n");
+
+    // round trips with 1/n scaling on the inverse; these should return the input
+    CkFftVerify( CkFftSetScale(context, kCkFftDirection_Forward, kCkFftScale_None, 1.0f) );
+    CkFftVerify( CkFftSetScale(context, kCkFftDirection_Inverse, kCkFftScale_1OverN, 1.0f) );
+
+    vector<CkFftComplex> spectrum;
+    spectrum.resize(count);
+    CkFftVerify( CkFftComplexForward(context, count, input, &spectrum[0]) );
+    CkFftVerify( CkFftComplexInverse(context, count, &spectrum[0], &output[0]) );
+    err = compare(&output[0], input, count);
+
+    CkFftVerify( CkFftComplexInverse(context, count, &spectrum[0], &spectrum[0]) );
+    err = max(err, compare(&spectrum[0], input, count));
+
+    CkFftVerify( CkFftComplexForwardUnordered(context, count, input, &spectrum[0]) );
+    CkFftVerify( CkFftComplexInverseUnordered(context, count, &spectrum[0], &output[0]) );
+    err = max(err, compare(&output[0], input, count));
+
+    CKFFT_PRINTF("count=%-5d, maxCount=%-5d, neon=%d, scaled complex round trip: err %f", count, maxCount, CkFftTester::isNeonEnabled(), err);
+    if (err > k_thresh)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
+    CKFFT_PRINTF("\n");
+
+    // real round trip, with and without a temp buffer
+    vector<float> floatOutput;
+    floatOutput.resize(count);
+    vector<CkFftComplex> tmpBuf;
+    tmpBuf.resize(count/2 + 1);
+
+    CkFftVerify( CkFftRealForward(context, count, floatInput, &spectrum[0]) );
+    CkFftVerify( CkFftRealInverse(context, count, &spectrum[0], &floatOutput[0], &tmpBuf[0]) );
+    err = compare((const CkFftComplex*) &floatOutput[0], (const CkFftComplex*) floatInput, count/2);
+
+    CkFftVerify( CkFftRealForward(context, count, floatInput, &spectrum[0]) );
+    CkFftVerify( CkFftRealInverse(context, count, &spectrum[0], &floatOutput[0], NULL) );
+    err = max(err, compare((const CkFftComplex*) &floatOutput[0], (const CkFftComplex*) floatInput, count/2));
+
+    // real forward with 1/n scaling should match complex forward with 1/n scaling
+    CkFftVerify( CkFftSetScale(context, kCkFftDirection_Forward, kCkFftScale_1OverN, 1.0f) );
+    CkFftVerify( CkFftRealForward(context, count, floatInput, &spectrum[0]) );
+    vector<CkFftComplex> realInput;
+    realInput.resize(count);
+    for (int i = 0; i < count; ++i)
+    {
+        realInput[i].real = floatInput[i];
+        realInput[i].imag = 0.0f;
+    }
+    CkFftVerify( CkFftComplexForward(context, count, &realInput[0], &output[0]) );
+    err = max(err, compare(&spectrum[0], &output[0], count/2 + 1));
+
+    CKFFT_PRINTF("count=%-5d, maxCount=%-5d, neon=%d, scaled real: err %f", count, maxCount, CkFftTester::isNeonEnabled(), err);
+    if (err > k_thresh)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
+    CKFFT_PRINTF("\n");
+
+    CkFftShutdown(context);
+    CkFftShutdown(refContext);
+
+    return success;
+}
+
+// compare strided real FFTs (one channel of interleaved data) with contiguous real FFTs
+bool regressionTestStrided(const float* input, int count, int maxCount, int stride)
+{
+    CkFftContext* context = CkFftInit(maxCount, kCkFftDirection_Both, NULL, NULL);
+    if (!CkFftTester::isNeonEnabled())
+    {
+        context->neon = false;
+    }
+
+    // interleave input with other channels, in channel 1
+    vector<float> interleaved;
+    interleaved.resize(count * stride);
+    for (int i = 0; i < count * stride; ++i)
+    {
+        interleaved[i] = -1.0f;
+    }
+    for (int i = 0; i < count; ++i)
+    {
+        interleaved[i * stride + 1] = input[i];
+    }
+
+    vector<CkFftComplex> refSpectrum;
+    refSpectrum.resize(count/2 + 1);
+    CkFftVerify( CkFftRealForward(context, count, input, &refSpectrum[0]) );
+
+    vector<CkFftComplex> spectrum;
+    spectrum.resize(count/2 + 1);
+    CkFftVerify( CkFftRealForwardStrided(context, count, &interleaved[1], stride, &spectrum[0]) );
+
+    bool success = true;
+    float err = compare(&spectrum[0], &refSpectrum[0], count/2 + 1);
+    const float k_thresh = 0.001f; // threshold for RMS comparison
+    CKFFT_PRINTF("count=%-5d, maxCount=%-5d, neon=%d, stride=%d, forward strided: err %f", 
+            count, maxCount, CkFftTester::isNeonEnabled(), stride, err);
+    if (err > k_thresh)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
+    CKFFT_PRINTF("\n");
+
+    // inverse into channel 2; other channels should be unchanged
+    vector<float> refOutput;
+    refOutput.resize(count);
+    CkFftVerify( CkFftRealInverse(context, count, &refSpectrum[0], &refOutput[0], NULL) );
+
+    vector<CkFftComplex> tmpBuf;
+    tmpBuf.resize(count/2 + 1);
+    int outChannel = 2 % stride;
+    CkFftVerify( CkFftRealInverseStrided(context, count, &refSpectrum[0], &interleaved[outChannel], stride, &tmpBuf[0]) );
+
+    float sumSq = 0.0f;
+    for (int i = 0; i < count * stride; ++i)
+    {
+        int channel = i % stride;
+        float expected = -1.0f;
+        if (channel == outChannel)
+        {
+            expected = refOutput[i / stride] / (2.0f * count);
+        }
+        else if (channel == 1)
+        {
+            expected = input[i / stride];
+        }
+        float value = interleaved[i];
+        if (channel == outChannel)
+        {
+            value /= 2.0f * count;
+        }
+        float diff = value - expected;
+        sumSq += diff * diff;
+    }
+    err = sqrtf(sumSq / (count * stride));
+
+    CKFFT_PRINTF("count=%-5d, maxCount=%-5d, neon=%d, stride=%d, inverse strided: err %f", 
+            count, maxCount, CkFftTester::isNeonEnabled(), stride, err);
+    if (err > k_thresh)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
+    CKFFT_PRINTF("\n");
+
+    CkFftShutdown(context);
+
+    return success;
+}
+
+// compare streaming STFTs, with input passed in blocks of various sizes, with 
+// real FFTs of each windowed frame
+bool regressionTestStft(const float* input, int inputCount, int frameSize, int hopSize, bool window, int maxCount)
+{
+    CkFftContext* context = CkFftInit(maxCount, kCkFftDirection_Forward, NULL, NULL);
+    if (!CkFftTester::isNeonEnabled())
+    {
+        context->neon = false;
+    }
+
+    vector<float> windowBuf;
+    windowBuf.resize(frameSize);
+    CkFftVerify( CkFftWindow(kCkFftWindow_Hann, frameSize, &windowBuf[0]) );
+    CkFftStft* stft = CkFftStftInit(context, frameSize, hopSize, (window ? &windowBuf[0] : NULL), NULL, NULL);
+
+    int spectrumSize = frameSize/2 + 1;
+    int frameCount = inputCount / hopSize;
+    vector<CkFftComplex> output;
+    output.resize(frameCount * spectrumSize);
+    const int k_blockSizes[] = { 1, 7, 100, 1000, 2 };
+    int pos = 0;
+    int frame = 0;
+    for (int i = 0; pos < inputCount; ++i)
+    {
+        int blockSize = min(k_blockSizes[i % 5], inputCount - pos);
+        CkFftSize frames = 0;
+        if (CkFftStftGetFrameCount(stft, blockSize) > frameCount - frame)
+        {
+            break;
+        }
+        CkFftVerify( CkFftStftProcess(stft, input + pos, blockSize, &output[frame * spectrumSize], &frames) );
+        pos += blockSize;
+        frame += (int) frames;
+    }
+    CkFftStftShutdown(stft);
+
+    // frame i ends at sample (i+1)*hopSize - 1, preceded by silence
+    vector<float> frameBuf;
+    frameBuf.resize(frameSize);
+    vector<CkFftComplex> refOutput;
+    refOutput.resize(frameCount * spectrumSize);
+    for (int i = 0; i < frameCount; ++i)
+    {
+        int start = (i + 1) * hopSize - frameSize;
+        for (int j = 0; j < frameSize; ++j)
+        {
+            float value = (start + j >= 0 ? input[start + j] : 0.0f);
+            frameBuf[j] = value * (window ? windowBuf[j] : 1.0f);
+        }
+        CkFftVerify( CkFftRealForward(context, frameSize, &frameBuf[0], &refOutput[i * spectrumSize]) );
+    }
+    CkFftShutdown(context);
+
+    bool success = true;
+    float err = (frame == frameCount ? compare(&output[0], &refOutput[0], frameCount * spectrumSize) : 1.0f);
+    const float k_thresh = 0.001f; // threshold for RMS comparison
+    CKFFT_PRINTF("frameSize=%-5d, hopSize=%-5d, neon=%d, window=%d, frames=%d: err %f", 
+            frameSize, hopSize, CkFftTester::isNeonEnabled(), window, frame, err);
+    if (err > k_thresh)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
+    CKFFT_PRINTF("\n");
+
+    return success;
+}
+
+// check that an STFT followed by an ISTFT reproduces the input
+bool regressionTestIstft(const float* input, int inputCount, int frameSize, int hopSize, CkFftWindowType windowType, int maxCount)
+{
+    CkFftContext* context = CkFftInit(maxCount, kCkFftDirection_Both, NULL, NULL);
+    if (!CkFftTester::isNeonEnabled())
+    {
+        context->neon = false;
+    }
+    CkFftVerify( CkFftSetScale(context, kCkFftDirection_Inverse, kCkFftScale_1OverN, 1.0f) );
+
+    vector<float> window;
+    window.resize(frameSize);
+    CkFftVerify( CkFftWindow(windowType, frameSize, &window[0]) );
+    CkFftStft* stft = CkFftStftInit(context, frameSize, hopSize, &window[0], NULL, NULL);
+    CkFftIstft* istft = CkFftIstftInit(context, frameSize, hopSize, &window[0], &window[0], NULL, NULL);
+
+    int spectrumSize = frameSize/2 + 1;
+    int frameCount = inputCount / hopSize;
+    vector<CkFftComplex> spectra;
+    spectra.resize(frameCount * spectrumSize);
+    CkFftVerify( CkFftStftProcess(stft, input, inputCount, &spectra[0], NULL) );
+    CkFftStftShutdown(stft);
+
+    // pass all the frames at once, which won't all fit, and read in small blocks
+    vector<float> output;
+    output.resize(inputCount);
+    int frame = 0;
+    int outputCount = 0;
+    for (int i = 0; frame < frameCount; ++i)
+    {
+        CkFftSize processed = 0;
+        CkFftVerify( CkFftIstftProcess(istft, &spectra[frame * spectrumSize], frameCount - frame, &processed) );
+        frame += (int) processed;
+
+        CkFftSize readCount = 0;
+        do
+        {
+            CkFftVerify( CkFftIstftRead(istft, &output[outputCount], min(inputCount - outputCount, 1 + (i % 5) * 50), &readCount) );
+            outputCount += (int) readCount;
+        }
+        while (readCount > 0);
+    }
+    CkFftIstftShutdown(istft);
+    CkFftShutdown(context);
+
+    bool success = true;
+    int expectedCount = frameCount * hopSize - (frameSize - hopSize);
+    float err = (outputCount == max(expectedCount, 0) && outputCount > 0 ? 
+            compare((const CkFftComplex*) &output[0], (const CkFftComplex*) input, outputCount/2) : 1.0f);
+    const float k_thresh = 0.0001f; // threshold for RMS comparison
+    CKFFT_PRINTF("frameSize=%-5d, hopSize=%-5d, neon=%d, window=%d, samples=%d: err %f", 
+            frameSize, hopSize, CkFftTester::isNeonEnabled(), windowType, outputCount, err);
+    if (err > k_thresh)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
+    CKFFT_PRINTF("\n");
+
+    return success;
+}
+
+// compare a convolver's output for two channels with direct convolution
+bool regressionTestConvolver(const float* input, int inputCount, int filterSize, int blockSize, int maxCount)
+{
+    CkFftContext* context = CkFftInit(maxCount, kCkFftDirection_Both, NULL, NULL);
+    if (!CkFftTester::isNeonEnabled())
+    {
+        context->neon = false;
+    }
+    // the output shouldn't depend on the scale
+    CkFftVerify( CkFftSetScale(context, kCkFftDirection_Forward, kCkFftScale_1OverSqrtN, 3.0f) );
+
+    // decaying filter, from the end of the input
+    vector<float> filter;
+    filter.resize(filterSize);
+    for (int i = 0; i < filterSize; ++i)
+    {
+        filter[i] = input[inputCount - 1 - i] / (1.0f + i * 0.01f);
+    }
+
+    CkFftConvolver* conv = CkFftConvolverInit(context, &filter[0], filterSize, blockSize, 2, NULL, NULL);
+
+    // channel 0 out of place; channel 1 (input scaled by -0.5) in place
+    int count = (inputCount / blockSize) * blockSize;
+    vector<float> output0;
+    output0.resize(count);
+    vector<float> output1;
+    output1.resize(count);
+    for (int i = 0; i < count; ++i)
+    {
+        output1[i] = input[i] * -0.5f;
+    }
+    for (int i = 0; i < count; i += blockSize)
+    {
+        CkFftVerify( CkFftConvolverProcess(conv, 0, input + i, &output0[i]) );
+        CkFftVerify( CkFftConvolverProcess(conv, 1, &output1[i], &output1[i]) );
+    }
+    CkFftConvolverShutdown(conv);
+    CkFftShutdown(context);
+
+    vector<float> expected0;
+    expected0.resize(count);
+    vector<float> expected1;
+    expected1.resize(count);
+    for (int i = 0; i < count; ++i)
+    {
+        double sum = 0.0;
+        for (int j = 0; j < filterSize && j <= i; ++j)
+        {
+            sum += (double) filter[j] * input[i - j];
+        }
+        expected0[i] = (float) sum;
+        expected1[i] = (float) (sum * -0.5);
+    }
+
+    bool success = true;
+    float err = max(compare((const CkFftComplex*) &output0[0], (const CkFftComplex*) &expected0[0], count/2),
+                    compare((const CkFftComplex*) &output1[0], (const CkFftComplex*) &expected1[0], count/2));
+    const float k_thresh = 0.0001f; // threshold for RMS comparison
+    CKFFT_PRINTF("filterSize=%-5d, blockSize=%-5d, neon=%d: err %f", filterSize, blockSize, CkFftTester::isNeonEnabled(), err);
+    if (err > k_thresh)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
+    CKFFT_PRINTF("\n");
+
+    return success;
+}
+
+// Compare a partitioned convolver's output with direct convolution; the tail 
+// tasks are run after every workerInterval blocks (or never, if it is 0).
+bool regressionTestPartitionedConvolver(const float* input, int inputCount, int filterSize, int blockSize, int maxPartitionSize, int workerInterval, int maxCount)
+{
+    CkFftContext* context = CkFftInit(maxCount, kCkFftDirection_Both, NULL, NULL);
+    if (!CkFftTester::isNeonEnabled())
+    {
+        context->neon = false;
+    }
+
+    // decaying filter, from the end of the input
+    vector<float> filter;
+    filter.resize(filterSize);
+    for (int i = 0; i < filterSize; ++i)
+    {
+        filter[i] = input[inputCount - 1 - (i % inputCount)] / (1.0f + i * 0.01f);
+    }
+
+    CkFftPartitionedConvolver* conv = CkFftPartitionedConvolverInit(context, &filter[0], filterSize, blockSize, maxPartitionSize, NULL, NULL);
+
+    int count = (inputCount / blockSize) * blockSize;
+    vector<float> output;
+    output.resize(count);
+    int taskCount = 0;
+    for (int i = 0; i < count; i += blockSize)
+    {
+        CkFftVerify( CkFftPartitionedConvolverProcess(conv, input + i, &output[i]) );
+        if (workerInterval > 0 && (i / blockSize) % workerInterval == 0)
+        {
+            int tasks = 0;
+            CkFftVerify( CkFftPartitionedConvolverRunTail(conv, &tasks) );
+            taskCount += tasks;
+        }
+    }
+    int missed = (int) CkFftPartitionedConvolverGetMissedDeadlines(conv);
+    CkFftPartitionedConvolverShutdown(conv);
+    CkFftShutdown(context);
+
+    vector<float> expected;
+    expected.resize(count);
+    for (int i = 0; i < count; ++i)
+    {
+        double sum = 0.0;
+        for (int j = 0; j < filterSize && j <= i; ++j)
+        {
+            sum += (double) filter[j] * input[i - j];
+        }
+        expected[i] = (float) sum;
+    }
+
+    // with a worker after every block, no deadlines should be missed; with no 
+    // worker, every tail task is
+    bool success = true;
+    float err = compare((const CkFftComplex*) &output[0], (const CkFftComplex*) &expected[0], count/2);
+    const float k_thresh = 0.0001f; // threshold for RMS comparison
+    CKFFT_PRINTF("filterSize=%-5d, blockSize=%-4d, maxPartitionSize=%-5d, worker=%d, neon=%d: %d tasks, %d missed, err %f", 
+            filterSize, blockSize, maxPartitionSize, workerInterval, CkFftTester::isNeonEnabled(), taskCount, missed, err);
+    if (err > k_thresh || (workerInterval == 1 && missed > 0) || (workerInterval == 0 && taskCount > 0))
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
+    CKFFT_PRINTF("\n");
+
+    return success;
+}
+
+// Compare a convolver matrix's outputs with direct convolution; the inputs are 
+// parts of the input, and the filter from input i to output o is missing if 
+// (i + o) % 4 == 3.
+bool regressionTestConvolverMatrix(const float* input, int inputCount, int filterSize, int blockSize, int channelInputs, int channelOutputs, int maxCount)
+{
+    CkFftContext* context = CkFftInit(maxCount, kCkFftDirection_Both, NULL, NULL);
+    if (!CkFftTester::isNeonEnabled())
+    {
+        context->neon = false;
+    }
+
+    int count = (inputCount / 2 / blockSize) * blockSize;
+    vector<float> filterData;
+    filterData.resize(channelInputs * channelOutputs * filterSize);
+    vector<const float*> filters;
+    filters.resize(channelInputs * channelOutputs);
+    for (int i = 0; i < channelInputs * channelOutputs; ++i)
+    {
+        float* filter = &filterData[i * filterSize];
+        for (int j = 0; j < filterSize; ++j)
+        {
+            filter[j] = input[inputCount - 1 - ((i * 37 + j) % inputCount)] / (1.0f + j * 0.01f);
+        }
+        int in = i % channelInputs;
+        int out = i / channelInputs;
+        filters[i] = ((in + out) % 4 == 3 ? NULL : filter);
+    }
+
+    CkFftConvolverMatrix* matrix = CkFftConvolverMatrixInit(context, &filters[0], filterSize, channelInputs, channelOutputs, blockSize, NULL, NULL);
+
+    vector<float> output;
+    output.resize(channelOutputs * count);
+    vector<const float*> inputs;
+    inputs.resize(channelInputs);
+    vector<float*> outputs;
+    outputs.resize(channelOutputs);
+    for (int i = 0; i < count; i += blockSize)
+    {
+        for (int j = 0; j < channelInputs; ++j)
+        {
+            inputs[j] = input + j * 100 + i;
+        }
+        for (int j = 0; j < channelOutputs; ++j)
+        {
+            outputs[j] = &output[j * count + i];
+        }
+        CkFftVerify( CkFftConvolverMatrixProcess(matrix, &inputs[0], &outputs[0]) );
+    }
+    CkFftConvolverMatrixShutdown(matrix);
+    CkFftShutdown(context);
+
+    vector<float> expected;
+    expected.resize(channelOutputs * count);
+    for (int out = 0; out < channelOutputs; ++out)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            double sum = 0.0;
+            for (int in = 0; in < channelInputs; ++in)
+            {
+                const float* filter = filters[out * channelInputs + in];
+                for (int j = 0; filter && j < filterSize && j <= i; ++j)
+                {
+                    sum += (double) filter[j] * input[in * 100 + i - j];
+                }
+            }
+            expected[out * count + i] = (float) sum;
+        }
+    }
+
+    bool success = true;
+    float err = compare((const CkFftComplex*) &output[0], (const CkFftComplex*) &expected[0], channelOutputs * count / 2);
+    const float k_thresh = 0.0001f; // threshold for RMS comparison
+    CKFFT_PRINTF("filterSize=%-5d, blockSize=%-5d, %dx%d, neon=%d: err %f", 
+            filterSize, blockSize, channelInputs, channelOutputs, CkFftTester::isNeonEnabled(), err);
+    if (err > k_thresh)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
+    CKFFT_PRINTF("\n");
+
+    return success;
+}
+
+// Correlate part of the input (y) with a delayed copy of it (x), and check the lag
+// of the peak; for a fractional delay, x is the average of y delayed by 
+// delay - 0.5 and delay + 0.5.  For unweighted correlation, also compare with 
+// direct correlation.
+bool regressionTestCorrelator(const float* input, int count, CkFftWeighting weighting, float delay, int maxCount)
+{
+    CkFftContext* context = CkFftInit(maxCount, kCkFftDirection_Both, NULL, NULL);
+    if (!CkFftTester::isNeonEnabled())
+    {
+        context->neon = false;
+    }
+    CkFftVerify( CkFftSetScale(context, kCkFftDirection_Forward, kCkFftScale_1OverN, 1.0f) );
+
+    int n = count * 2;
+    CkFftCorrelator* corr = CkFftCorrelatorInit(context, n, weighting, 0.5f, NULL, NULL);
+
+    const float* y = input + 100;
+    vector<float> x;
+    x.resize(count);
+    int intDelay = (int) delay;
+    for (int i = 0; i < count; ++i)
+    {
+        x[i] = (delay == (float) intDelay ? y[i - intDelay] : 0.5f * (y[i - intDelay] + y[i - intDelay - 1]));
+    }
+
+    // a few frames, so SCOT smoothing is used
+    vector<float> output;
+    output.resize(n);
+    for (int i = 0; i < 3; ++i)
+    {
+        CkFftVerify( CkFftCorrelatorProcess(corr, &x[0], y, count, &output[0]) );
+    }
+    float lag = 0.0f;
+    float value = 0.0f;
+    CkFftVerify( CkFftCorrelatorFindPeak(corr, &output[0], 50, &lag, &value) );
+    CkFftCorrelatorShutdown(corr);
+    CkFftShutdown(context);
+
+    float err = 0.0f;
+    if (weighting == kCkFftWeighting_None)
+    {
+        // relative to the number of samples
+        vector<float> expected;
+        expected.resize(n);
+        for (int k = -n/2; k < n/2; ++k)
+        {
+            double sum = 0.0;
+            for (int i = max(0, -k); i < count && i + k < count; ++i)
+            {
+                sum += (double) x[i + k] * y[i];
+            }
+            expected[n/2 + k] = (float) (sum / count);
+            output[n/2 + k] /= count;
+        }
+        err = compare((const CkFftComplex*) &output[0], (const CkFftComplex*) &expected[0], n/2);
+    }
+
+    bool success = true;
+    const float k_thresh = 0.0001f; // threshold for RMS comparison
+    const float k_lagThresh = 0.05f; // threshold for lag error, in samples
+    CKFFT_PRINTF("count=%-5d, weighting=%d, delay=%.1f, neon=%d: lag %f, peak %f, err %f", 
+            count, weighting, delay, CkFftTester::isNeonEnabled(), lag, value, err);
+    if (err > k_thresh || fabsf(lag - delay) > k_lagThresh)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
+    CKFFT_PRINTF("\n");
+
+    return success;
+}
+
+// compare log-mel energies and MFCCs, streamed and in batches, with values 
+// computed directly from real FFTs
+bool regressionTestMelFeatures(const float* input, int inputCount, int frameSize, int hopSize, int bandCount, int coeffCount, int maxCount)
+{
+    CkFftContext* context = CkFftInit(maxCount, kCkFftDirection_Forward, NULL, NULL);
+    if (!CkFftTester::isNeonEnabled())
+    {
+        context->neon = false;
+    }
+    CkFftVerify( CkFftSetScale(context, kCkFftDirection_Forward, kCkFftScale_1OverN, 1.0f) );
+
+    const float k_sampleRate = 16000.0f;
+    const float k_minFreq = 20.0f;
+    const float k_maxFreq = 8000.0f;
+    vector<float> window;
+    window.resize(frameSize);
+    CkFftVerify( CkFftWindow(kCkFftWindow_Hann, frameSize, &window[0]) );
+    CkFftMelFeatures* mel = CkFftMelFeaturesInit(context, frameSize, hopSize, &window[0], k_sampleRate, bandCount, k_minFreq, k_maxFreq, coeffCount, 2, NULL, NULL);
+
+    int featureCount = (coeffCount > 0 ? coeffCount : bandCount);
+    int frameCount = inputCount / hopSize;
+    int total = frameCount * featureCount;
+
+    // channel 0 in odd-sized blocks, channel 1 all at once
+    vector<float> output0;
+    output0.resize(total + 1);
+    int frames = 0;
+    const int k_blockSize = 37;
+    for (int i = 0; i < inputCount; i += k_blockSize)
+    {
+        int n = min(k_blockSize, inputCount - i);
+        CkFftSize blockFrames = 0;
+        CkFftVerify( CkFftMelFeaturesProcess(mel, 0, input + i, n, &output0[frames * featureCount], &blockFrames) );
+        frames += blockFrames;
+    }
+    CkFftVerify( frames == frameCount );
+    vector<float> output1;
+    output1.resize(total + 1);
+    CkFftVerify( CkFftMelFeaturesGetFrameCount(mel, 1, inputCount) == frameCount );
+    CkFftVerify( CkFftMelFeaturesProcess(mel, 1, input, inputCount, &output1[0], NULL) );
+
+    // in a batch, with the silence that precedes the streams
+    vector<float> padded;
+    padded.resize(frameSize - hopSize + inputCount);
+    copy(input, input + inputCount, padded.begin() + (frameSize - hopSize));
+    vector<float> batchOutput;
+    batchOutput.resize(total + 1);
+    CkFftVerify( CkFftMelFeaturesProcessFrames(mel, &padded[0], frameCount, &batchOutput[0]) );
+
+    // reference: power spectra of the windowed frames, dense triangular filters,
+    // log, and DCT
+    double melMin = 2595.0 * log10(1.0 + k_minFreq / 700.0);
+    double melMax = 2595.0 * log10(1.0 + k_maxFreq / 700.0);
+    vector<double> edges;
+    for (int b = 0; b < bandCount + 2; ++b)
+    {
+        double m = melMin + (melMax - melMin) * b / (bandCount + 1);
+        edges.push_back(700.0 * (pow(10.0, m / 2595.0) - 1.0));
+    }
+    vector<float> expected;
+    expected.resize(total + 1);
+    vector<float> frame;
+    frame.resize(frameSize);
+    vector<CkFftComplex> spectrum;
+    spectrum.resize(frameSize/2 + 1);
+    vector<double> energies;
+    energies.resize(bandCount);
+    for (int f = 0; f < frameCount; ++f)
+    {
+        for (int i = 0; i < frameSize; ++i)
+        {
+            frame[i] = padded[f * hopSize + i] * window[i];
+        }
+        CkFftVerify( CkFftRealForward(context, frameSize, &frame[0], &spectrum[0]) );
+        for (int b = 0; b < bandCount; ++b)
+        {
+            double sum = 0.0;
+            for (int k = 0; k <= frameSize/2; ++k)
+            {
+                double hz = k * k_sampleRate / frameSize;
+                double w = min((hz - edges[b]) / (edges[b+1] - edges[b]), (edges[b+2] - hz) / (edges[b+2] - edges[b+1]));
+                if (w > 0.0)
+                {
+                    sum += w * (spectrum[k].real * spectrum[k].real + spectrum[k].imag * spectrum[k].imag);
+                }
+            }
+            energies[b] = log(max(sum, 1.0e-10));
+        }
+        float* out = &expected[f * featureCount];
+        if (coeffCount > 0)
+        {
+            for (int k = 0; k < coeffCount; ++k)
+            {
+                double sum = 0.0;
+                for (int b = 0; b < bandCount; ++b)
+                {
+                    sum += energies[b] * cos(M_PI * k * (2*b + 1) / (2.0 * bandCount));
+                }
+                out[k] = (float) (sum * sqrt((k == 0 ? 1.0 : 2.0) / bandCount));
+            }
+        }
+        else
+        {
+            for (int b = 0; b < bandCount; ++b)
+            {
+                out[b] = (float) energies[b];
+            }
+        }
+    }
+    CkFftMelFeaturesShutdown(mel);
+    CkFftShutdown(context);
+
+    int compareCount = (total + 1) / 2;
+    float err = compare((const CkFftComplex*) &output0[0], (const CkFftComplex*) &expected[0], compareCount);
+    err = max(err, compare((const CkFftComplex*) &output1[0], (const CkFftComplex*) &expected[0], compareCount));
+    err = max(err, compare((const CkFftComplex*) &batchOutput[0], (const CkFftComplex*) &expected[0], compareCount));
+
+    bool success = true;
+    const float k_thresh = 0.001f; // threshold for RMS comparison
+    CKFFT_PRINTF("frameSize=%-4d, hopSize=%-4d, bands=%-3d, coeffs=%-3d, neon=%d: err %f", 
+            frameSize, hopSize, bandCount, coeffCount, CkFftTester::isNeonEnabled(), err);
+    if (err > k_thresh)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
+    CKFFT_PRINTF("\n");
+
+    return success;
+}
+
+// compare FFTs of integer input with FFTs of the same input converted to float
+bool regressionTestInteger(const CkFftComplex* input, int count, int maxCount)
+{
+    CkFftContext* context = CkFftInit(maxCount, kCkFftDirection_Forward, NULL, NULL);
+    if (!CkFftTester::isNeonEnabled())
+    {
+        context->neon = false;
+    }
+
+    // quantize input (which is in the range [-1, 1])
+    const float k_scale16 = 1.0f / 32767.0f;
+    const float k_scale8 = 1.0f / 127.0f;
+    vector<short> input16;
+    input16.resize(count * 2);
+    vector<signed char> input8;
+    input8.resize(count * 2);
+    vector<CkFftComplex> floatInput16;
+    floatInput16.resize(count);
+    vector<CkFftComplex> floatInput8;
+    floatInput8.resize(count);
+    for (int i = 0; i < count; ++i)
+    {
+        input16[i*2] = (short) (input[i].real * 32767.0f);
+        input16[i*2 + 1] = (short) (input[i].imag * 32767.0f);
+        floatInput16[i].real = input16[i*2] * k_scale16;
+        floatInput16[i].imag = input16[i*2 + 1] * k_scale16;
+
+        input8[i*2] = (signed char) (input[i].real * 127.0f);
+        input8[i*2 + 1] = (signed char) (input[i].imag * 127.0f);
+        floatInput8[i].real = input8[i*2] * k_scale8;
+        floatInput8[i].imag = input8[i*2 + 1] * k_scale8;
+    }
+
+    vector<CkFftComplex> refOutput;
+    refOutput.resize(count);
+    vector<CkFftComplex> output;
+    output.resize(count);
+
+    // complex int16
+    CkFftVerify( CkFftComplexForward(context, count, &floatInput16[0], &refOutput[0]) );
+    CkFftVerify( CkFftComplexForwardInt16(context, count, &input16[0], k_scale16, &output[0]) );
+    float err = compare(&output[0], &refOutput[0], count);
+
+    // complex int8
+    CkFftVerify( CkFftComplexForward(context, count, &floatInput8[0], &refOutput[0]) );
+    CkFftVerify( CkFftComplexForwardInt8(context, count, &input8[0], k_scale8, &output[0]) );
+    err = max(err, compare(&output[0], &refOutput[0], count));
+
+    // real int16 (first count values of the int16 data)
+    vector<float> realInput16;
+    realInput16.resize(count);
+    for (int i = 0; i < count; ++i)
+    {
+        realInput16[i] = input16[i] * k_scale16;
+    }
+    CkFftVerify( CkFftRealForward(context, count, &realInput16[0], &refOutput[0]) );
+    CkFftVerify( CkFftRealForwardInt16(context, count, &input16[0], k_scale16, &output[0]) );
+    err = max(err, compare(&output[0], &refOutput[0], count/2 + 1));
+
+    bool success = true;
+    const float k_thresh = 0.001f; // threshold for RMS comparison
+    CKFFT_PRINTF("count=%-5d, maxCount=%-5d, neon=%d, integer input: err %f", count, maxCount, CkFftTester::isNeonEnabled(), err);
+    if (err > k_thresh)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
+    CKFFT_PRINTF("\n");
+
+    CkFftShutdown(context);
+
+    return success;
+}
+
+// check conversions between float and 16-bit formats
+bool regressionTestHalfConversion()
+{
+    bool success = true;
+
+    // every fp16 value except NaNs should survive a round trip
+    int errors = 0;
+    for (int i = 0; i < 0x10000; ++i)
+    {
+        ckfft::uint16 h = (ckfft::uint16) i;
+        bool nan = ((h & 0x7c00) == 0x7c00 && (h & 0x3ff));
+        if (!nan && ckfft::floatToHalf(ckfft::halfToFloat(h)) != h)
+        {
+            ++errors;
+        }
+    }
+
+    // rounding to nearest even
+    if (ckfft::floatToHalf(1.0f) != 0x3c00 ||
+        ckfft::floatToHalf(1.0f + 1.0f/2048.0f) != 0x3c00 ||    // halfway, rounds down to even
+        ckfft::floatToHalf(1.0f + 3.0f/2048.0f) != 0x3c02 ||    // halfway, rounds up to even
+        ckfft::floatToHalf(65504.0f) != 0x7bff ||
+        ckfft::floatToHalf(65520.0f) != 0x7c00 ||
+        ckfft::floatToHalf(-1.0f/16777216.0f) != 0x8001 ||      // smallest subnormal
+        ckfft::floatToBfloat16(1.0f) != 0x3f80 ||
+        ckfft::floatToBfloat16(1.0f + 1.0f/256.0f) != 0x3f80 || // halfway, rounds down to even
+        ckfft::bfloat16ToFloat(0xc040) != -3.0f)
+    {
+        ++errors;
+    }
+
+    CKFFT_PRINTF("half conversion: %d errors", errors);
+    if (errors)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
+    CKFFT_PRINTF("\n");
+
+    return success;
+}
+
+// compare FFTs of 16-bit floating-point data with float FFTs of the same data
+bool regressionTestHalf(const CkFftComplex* input, int count, int maxCount, CkFftHalfFormat format)
+{
+    CkFftContext* context = CkFftInit(maxCount, kCkFftDirection_Both, NULL, NULL);
+    if (!CkFftTester::isNeonEnabled())
+    {
+        context->neon = false;
+    }
+
+    bool bfloat16 = (format == kCkFftHalfFormat_BFloat16);
+
+    // input, rounded to 16 bits, and its float value
+    vector<CkFftHalf> halfInput;
+    halfInput.resize(count * 2);
+    vector<CkFftComplex> floatInput;
+    floatInput.resize(count);
+    for (int i = 0; i < count; ++i)
+    {
+        halfInput[i*2] = (bfloat16 ? ckfft::floatToBfloat16(input[i].real) : ckfft::floatToHalf(input[i].real));
+        halfInput[i*2 + 1] = (bfloat16 ? ckfft::floatToBfloat16(input[i].imag) : ckfft::floatToHalf(input[i].imag));
+        floatInput[i].real = (bfloat16 ? ckfft::bfloat16ToFloat(halfInput[i*2]) : ckfft::halfToFloat(halfInput[i*2]));
+        floatInput[i].imag = (bfloat16 ? ckfft::bfloat16ToFloat(halfInput[i*2 + 1]) : ckfft::halfToFloat(halfInput[i*2 + 1]));
+    }
+
+    vector<CkFftComplex> tmpBuf;
+    tmpBuf.resize(count);
+    vector<CkFftHalf> halfOutput;
+    halfOutput.resize(count * 2 + 2);
+    vector<CkFftComplex> refOutput;
+    refOutput.resize(count);
+    vector<CkFftComplex> output;
+    output.resize(count);
+
+    // errors are relative to the RMS of the reference output
+    float err = 0.0f;
+    vector<CkFftComplex> zeros;
+    zeros.resize(count);
+    zero(zeros);
+
+    for (int test = 0; test < 4; ++test)
+    {
+        int outputCount = 0; // number of complex values to compare
+        if (test == 0 || test == 1)
+        {
+            bool inverse = (test == 1);
+            outputCount = count;
+            if (inverse)
+            {
+                CkFftVerify( CkFftComplexInverse(context, count, &floatInput[0], &refOutput[0]) );
+                CkFftVerify( CkFftComplexInverseHalf(context, count, format, &halfInput[0], &halfOutput[0], &tmpBuf[0]) );
+            }
+            else
+            {
+                CkFftVerify( CkFftComplexForward(context, count, &floatInput[0], &refOutput[0]) );
+                CkFftVerify( CkFftComplexForwardHalf(context, count, format, &halfInput[0], &halfOutput[0], &tmpBuf[0]) );
+            }
+        }
+        else if (test == 2)
+        {
+            // real forward of the first count values
+            outputCount = count/2 + 1;
+            CkFftVerify( CkFftRealForward(context, count, (const float*) &floatInput[0], &refOutput[0]) );
+            CkFftVerify( CkFftRealForwardHalf(context, count, format, &halfInput[0], &halfOutput[0], &tmpBuf[0]) );
+        }
+        else
+        {
+            // real inverse of the spectrum from the previous test
+            if (count < 2)
+            {
+                continue;
+            }
+            outputCount = count/2;
+            vector<CkFftHalf> halfSpectrum(halfOutput.begin(), halfOutput.begin() + count + 2);
+            vector<CkFftComplex> spectrum;
+            spectrum.resize(count/2 + 1);
+            for (int i = 0; i < count/2 + 1; ++i)
+            {
+                spectrum[i].real = (bfloat16 ? ckfft::bfloat16ToFloat(halfSpectrum[i*2]) : ckfft::halfToFloat(halfSpectrum[i*2]));
+                spectrum[i].imag = (bfloat16 ? ckfft::bfloat16ToFloat(halfSpectrum[i*2 + 1]) : ckfft::halfToFloat(halfSpectrum[i*2 + 1]));
+            }
+            CkFftVerify( CkFftRealInverse(context, count, &spectrum[0], (float*) &refOutput[0], NULL) );
+            CkFftVerify( CkFftRealInverseHalf(context, count, format, &halfSpectrum[0], &halfOutput[0], &tmpBuf[0]) );
+        }
+
+        float* outputValues = (float*) &output[0];
+        for (int i = 0; i < outputCount * 2; ++i)
+        {
+            outputValues[i] = (bfloat16 ? ckfft::bfloat16ToFloat(halfOutput[i]) : ckfft::halfToFloat(halfOutput[i]));
+        }
+
+        float rms = compare(&refOutput[0], &zeros[0], outputCount);
+        if (rms > 0.0f)
+        {
+            err = max(err, compare(&output[0], &refOutput[0], outputCount) / rms);
+        }
+    }
+
+    bool success = true;
+    const float k_thresh = (bfloat16 ? 0.005f : 0.001f); // threshold for relative RMS comparison
+    CKFFT_PRINTF("count=%-5d, maxCount=%-5d, neon=%d, bfloat16=%d, 16-bit float data: err %f", 
+            count, maxCount, CkFftTester::isNeonEnabled(), bfloat16, err);
+    if (err > k_thresh)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
+    CKFFT_PRINTF("\n");
+
+    CkFftShutdown(context);
+
+    return success;
+}
+
+// compare block-floating-point FFTs with float FFTs of the same data
+bool regressionTestFixed(const CkFftComplex* input, int count, int maxCount)
+{
+    CkFftContext* context = CkFftInit(maxCount, kCkFftDirection_Both, NULL, NULL);
+    CkFftContextQ15* contextQ15 = CkFftInitQ15(maxCount, NULL, NULL);
+    CkFftContextQ31* contextQ31 = CkFftInitQ31(maxCount, NULL, NULL);
+    if (!CkFftTester::isNeonEnabled())
+    {
+        context->neon = false;
+        contextQ15->neon = false;
+        contextQ31->neon = false;
+    }
+
+    vector<CkFftComplexQ15> inputQ15;
+    inputQ15.resize(count);
+    vector<CkFftComplexQ15> outputQ15;
+    outputQ15.resize(count);
+    vector<CkFftComplexQ31> inputQ31;
+    inputQ31.resize(count);
+    vector<CkFftComplexQ31> outputQ31;
+    outputQ31.resize(count);
+    vector<CkFftComplex> floatInput;
+    floatInput.resize(count);
+    vector<CkFftComplex> refOutput;
+    refOutput.resize(count);
+    vector<CkFftComplex> output;
+    output.resize(count);
+    vector<CkFftComplex> zeros;
+    zeros.resize(count);
+    zero(zeros);
+
+    // errors are relative to the RMS of the reference output
+    float errQ15 = 0.0f;
+    float errQ31 = 0.0f;
+
+    // full-scale input, and small input (which the first stage should scale up)
+    for (int test = 0; test < 4; ++test)
+    {
+        bool inverse = (test & 1);
+        float amplitude = (test < 2 ? 1.0f : 1.0f/256.0f);
+
+        for (int q31 = 0; q31 <= 1; ++q31)
+        {
+            double one = (q31 ? 2147483647.0 : 32767.0);
+            for (int i = 0; i < count; ++i)
+            {
+                double real = floor(input[i].real * amplitude * one + 0.5);
+                double imag = floor(input[i].imag * amplitude * one + 0.5);
+                if (q31)
+                {
+                    inputQ31[i].real = (int) real;
+                    inputQ31[i].imag = (int) imag;
+                }
+                else
+                {
+                    inputQ15[i].real = (short) real;
+                    inputQ15[i].imag = (short) imag;
+                }
+                floatInput[i].real = (float) (real / one);
+                floatInput[i].imag = (float) (imag / one);
+            }
+
+            int exponent = 0;
+            if (inverse)
+            {
+                CkFftVerify( CkFftComplexInverse(context, count, &floatInput[0], &refOutput[0]) );
+                if (q31)
+                {
+                    CkFftVerify( CkFftComplexInverseQ31(contextQ31, count, &inputQ31[0], &outputQ31[0], &exponent) );
+                }
+                else
+                {
+                    CkFftVerify( CkFftComplexInverseQ15(contextQ15, count, &inputQ15[0], &outputQ15[0], &exponent) );
+                }
+            }
+            else
+            {
+                CkFftVerify( CkFftComplexForward(context, count, &floatInput[0], &refOutput[0]) );
+                if (q31)
+                {
+                    CkFftVerify( CkFftComplexForwardQ31(contextQ31, count, &inputQ31[0], &outputQ31[0], &exponent) );
+                }
+                else
+                {
+                    CkFftVerify( CkFftComplexForwardQ15(contextQ15, count, &inputQ15[0], &outputQ15[0], &exponent) );
+                }
+            }
+
+            double outputScale = ldexp(1.0, exponent) / one;
+            for (int i = 0; i < count; ++i)
+            {
+                output[i].real = (float) ((q31 ? outputQ31[i].real : outputQ15[i].real) * outputScale);
+                output[i].imag = (float) ((q31 ? outputQ31[i].imag : outputQ15[i].imag) * outputScale);
+            }
+
+            float rms = compare(&refOutput[0], &zeros[0], count);
+            float err = compare(&output[0], &refOutput[0], count) / rms;
+            if (q31)
+            {
+                errQ31 = max(errQ31, err);
+            }
+            else
+            {
+                errQ15 = max(errQ15, err);
+            }
+        }
+    }
+
+    bool success = true;
+    const float k_threshQ15 = 0.003f; // thresholds for relative RMS comparison
+    const float k_threshQ31 = 0.00001f;
+    CKFFT_PRINTF("count=%-5d, maxCount=%-5d, neon=%d, fixed-point: Q15 err %f, Q31 err %f", 
+            count, maxCount, CkFftTester::isNeonEnabled(), errQ15, errQ31);
+    if (errQ15 > k_threshQ15 || errQ31 > k_threshQ31)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
+    CKFFT_PRINTF("\n");
+
+    CkFftShutdown(context);
+    CkFftShutdownQ15(contextQ15);
+    CkFftShutdownQ31(contextQ31);
+
+    return success;
+}
+
+// relative RMS difference between double-precision values
+double compareDouble(const CkFftComplexD* values, const CkFftComplexD* refValues, int count)
+{
+    double sumSqDiff = 0.0;
+    double sumSqRef = 0.0;
+    for (int i = 0; i < count; ++i)
+    {
+        double diffReal = values[i].real - refValues[i].real;
+        double diffImag = values[i].imag - refValues[i].imag;
+        sumSqDiff += diffReal*diffReal + diffImag*diffImag;
+        sumSqRef += refValues[i].real*refValues[i].real + refValues[i].imag*refValues[i].imag;
+    }
+    return (sumSqRef > 0.0 ? sqrt(sumSqDiff / sumSqRef) : sqrt(sumSqDiff));
+}
+
+// compare double-precision FFTs with a direct DFT
+bool regressionTestDouble(const CkFftComplex* input, int count, int maxCount)
+{
+    CkFftContextD* context = CkFftInitD(maxCount, kCkFftDirection_Both, NULL, NULL);
+    const double k_pi = 3.14159265358979323846;
+
+    vector<CkFftComplexD> inputD;
+    inputD.resize(count);
+    for (int i = 0; i < count; ++i)
+    {
+        inputD[i].real = input[i].real;
+        inputD[i].imag = input[i].imag;
+    }
+
+    vector<CkFftComplexD> output;
+    output.resize(count + 1);
+    vector<CkFftComplexD> refOutput;
+    refOutput.resize(count + 1);
+    double err = 0.0;
+
+    for (int inverse = 0; inverse <= 1; ++inverse)
+    {
+        // direct DFT (exponent index reduced mod count, for accurate twiddles)
+        double sign = (inverse ? 1.0 : -1.0);
+        for (int k = 0; k < count; ++k)
+        {
+            double real = 0.0;
+            double imag = 0.0;
+            for (int j = 0; j < count; ++j)
+            {
+                double theta = sign * 2.0 * k_pi * (double) (((long long) j * k) % count) / count;
+                double c = cos(theta);
+                double s = sin(theta);
+                real += inputD[j].real * c - inputD[j].imag * s;
+                imag += inputD[j].imag * c + inputD[j].real * s;
+            }
+            refOutput[k].real = real;
+            refOutput[k].imag = imag;
+        }
+
+        if (inverse)
+        {
+            CkFftVerify( CkFftComplexInverseD(context, count, &inputD[0], &output[0]) );
+        }
+        else
+        {
+            CkFftVerify( CkFftComplexForwardD(context, count, &inputD[0], &output[0]) );
+        }
+        err = max(err, compareDouble(&output[0], &refOutput[0], count));
+
+        // in place
+        vector<CkFftComplexD> data(inputD);
+        if (inverse)
+        {
+            CkFftVerify( CkFftComplexInverseD(context, count, &data[0], &data[0]) );
+        }
+        else
+        {
+            CkFftVerify( CkFftComplexForwardD(context, count, &data[0], &data[0]) );
+        }
+        err = max(err, compareDouble(&data[0], &refOutput[0], count));
+    }
+
+    // real forward, of the first count values of the input; the output is scaled by 2
+    const double* realInput = (const double*) &inputD[0];
+    for (int k = 0; k <= count/2; ++k)
+    {
+        double real = 0.0;
+        double imag = 0.0;
+        for (int j = 0; j < count; ++j)
+        {
+            double theta = -2.0 * k_pi * (double) (((long long) j * k) % count) / count;
+            real += realInput[j] * cos(theta);
+            imag += realInput[j] * sin(theta);
+        }
+        refOutput[k].real = real * 2.0;
+        refOutput[k].imag = imag * 2.0;
+    }
+    CkFftVerify( CkFftRealForwardD(context, count, realInput, &output[0]) );
+    err = max(err, compareDouble(&output[0], &refOutput[0], count/2 + 1));
+
+    // real inverse should give back the input, scaled by 2*count
+    vector<double> realOutput;
+    realOutput.resize(count);
+    vector<CkFftComplexD> tmpBuf;
+    tmpBuf.resize(count/2 + 1);
+    CkFftVerify( CkFftRealInverseD(context, count, &output[0], &realOutput[0], &tmpBuf[0]) );
+    double sumSqDiff = 0.0;
+    double sumSqRef = 0.0;
+    for (int i = 0; i < count; ++i)
+    {
+        double diff = realOutput[i] / (2.0 * count) - realInput[i];
+        sumSqDiff += diff * diff;
+        sumSqRef += realInput[i] * realInput[i];
+    }
+    err = max(err, sqrt(sumSqDiff / sumSqRef));
+
+    bool success = true;
+    const double k_thresh = 1.0e-12; // threshold for relative RMS comparison
+    CKFFT_PRINTF("count=%-5d, maxCount=%-5d, double precision: err %g", count, maxCount, err);
+    if (err > k_thresh)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
+    CKFFT_PRINTF("\n");
+
+    CkFftShutdownD(context);
+
+    return success;
+}
+
+// allocator that counts outstanding allocations
+struct AllocCount
+{
+    int allocs;
+    int frees;
+};
+
+void* countingAlloc(size_t size, void* userData)
+{
+    ++((AllocCount*) userData)->allocs;
+    return malloc(size);
+}
+
+void countingFree(void* p, void* userData)
+{
+    ++((AllocCount*) userData)->frees;
+    free(p);
+}
+
+bool isAligned(const void* p)
+{
+    return ((size_t) p % 64) == 0;
+}
+
+// check that contexts use the allocator (or huge pages), and that their tables are 
+// aligned
+bool regressionTestAllocator(const CkFftComplex* input, int count, int maxCount)
+{
+    int errors = 0;
+
+    AllocCount allocCount = { 0, 0 };
+    CkFftVerify( CkFftSetAllocator(countingAlloc, countingFree, &allocCount) );
+    if (CkFftSetAllocator(countingAlloc, NULL, &allocCount))
+    {
+        ++errors;
+    }
+
+    CkFftContext* context = CkFftInit(maxCount, kCkFftDirection_Both, NULL, NULL);
+    CkFftContextD* contextD = CkFftInitD(maxCount, kCkFftDirection_Inverse, NULL, NULL);
+    CkFftContextQ15* contextQ15 = CkFftInitQ15(maxCount, NULL, NULL);
+    if (allocCount.allocs != 3 ||
+        !isAligned(context) || !isAligned(context->fwdExpTable) || !isAligned(context->invExpTable) ||
+        !isAligned(contextD) || !isAligned(contextD->invExpTable) ||
+        !isAligned(contextQ15) || !isAligned(contextQ15->expTable))
+    {
+        ++errors;
+    }
+
+    // restoring the default allocator should not affect existing contexts
+    CkFftVerify( CkFftSetAllocator(NULL, NULL, NULL) );
+    CkFftShutdown(context);
+    CkFftShutdownD(contextD);
+    CkFftShutdownQ15(contextQ15);
+    if (allocCount.frees != 3)
+    {
+        ++errors;
+    }
+
+    // a user buffer needn't be aligned
+    size_t bufSize = 0;
+    CkFftInit(maxCount, kCkFftDirection_Forward, NULL, &bufSize);
+    vector<char> buf;
+    buf.resize(bufSize + 1);
+    context = CkFftInit(maxCount, kCkFftDirection_Forward, &buf[1], &bufSize);
+    if (!context || !isAligned(context) || !isAligned(context->fwdExpTable) ||
+        (const char*) context->fwdExpTable + maxCount * sizeof(CkFftComplex) > &buf[0] + buf.size())
+    {
+        ++errors;
+    }
+    else
+    {
+        // compare with FFT using an allocated context
+        CkFftContext* refContext = CkFftInit(maxCount, kCkFftDirection_Forward, NULL, NULL);
+        vector<CkFftComplex> output;
+        output.resize(count);
+        vector<CkFftComplex> refOutput;
+        refOutput.resize(count);
+        CkFftVerify( CkFftComplexForward(context, count, input, &output[0]) );
+        CkFftVerify( CkFftComplexForward(refContext, count, input, &refOutput[0]) );
+        if (compare(&output[0], &refOutput[0], count) != 0.0f)
+        {
+            ++errors;
+        }
+        CkFftShutdown(refContext);
+    }
+    CkFftShutdown(context);
+    if (allocCount.allocs != 3 || allocCount.frees != 3)
+    {
+        ++errors;
+    }
+
+    // a large context with huge pages (if they can't be allocated, normal allocation 
+    // is used) should give the same results as one without
+    const int k_largeCount = 1 << 20;
+    CkFftContext* refContext = CkFftInit(k_largeCount, kCkFftDirection_Forward, NULL, NULL);
+    CkFftSetHugePages(1);
+    context = CkFftInit(k_largeCount, kCkFftDirection_Forward, NULL, NULL);
+    CkFftSetHugePages(0);
+    if (!context || !isAligned(context->fwdExpTable))
+    {
+        ++errors;
+    }
+    else
+    {
+        vector<CkFftComplex> output;
+        output.resize(count);
+        vector<CkFftComplex> refOutput;
+        refOutput.resize(count);
+        CkFftVerify( CkFftComplexForward(context, count, input, &output[0]) );
+        CkFftVerify( CkFftComplexForward(refContext, count, input, &refOutput[0]) );
+        if (compare(&output[0], &refOutput[0], count) != 0.0f)
+        {
+            ++errors;
+        }
+    }
+    CkFftShutdown(context);
+    CkFftShutdown(refContext);
+
+    bool success = true;
+    CKFFT_PRINTF("allocator and alignment: %d errors", errors);
+    if (errors)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
+    CKFFT_PRINTF("\n");
+
+    return success;
+}
+
+// check that FFTs using per-node copies of the tables give the same results; 
+// since this may not be a NUMA system, the context is told there are 2 nodes
+bool regressionTestNuma(const CkFftComplex* input, int count, int maxCount)
+{
+    int errors = 0;
+
+    CkFftContext* refContext = CkFftInit(maxCount, kCkFftDirection_Both, NULL, NULL);
+    CkFftContext* context = CkFftInit(maxCount, kCkFftDirection_Both, NULL, NULL);
+    if (!context->enableNumaReplicas(2))
+    {
+        ++errors;
+    }
+
+    vector<CkFftComplex> output;
+    output.resize(count);
+    vector<CkFftComplex> refOutput;
+    refOutput.resize(count);
+
+    CkFftVerify( CkFftComplexForward(context, count, input, &output[0]) );
+    CkFftVerify( CkFftComplexForward(refContext, count, input, &refOutput[0]) );
+    if (compare(&output[0], &refOutput[0], count) != 0.0f)
+    {
+        ++errors;
+    }
+    CkFftVerify( CkFftRealInverse(context, count, input, (float*) &output[0], NULL) );
+    CkFftVerify( CkFftRealInverse(refContext, count, input, (float*) &refOutput[0], NULL) );
+    if (compare(&output[0], &refOutput[0], count/2) != 0.0f)
+    {
+        ++errors;
+    }
+
+    // the FFTs should have used a copy for the current node
+    ckfft::LocalContext local(context);
+    const CkFftContext* localContext = local;
+    if (localContext->fwdExpTable == context->fwdExpTable || 
+        localContext->invExpTable == context->invExpTable ||
+        !isAligned(localContext->fwdExpTable) ||
+        !isAligned(localContext->invExpTable))
+    {
+        ++errors;
+    }
+
+    CkFftShutdown(context);
+    CkFftShutdown(refContext);
+
+    bool success = true;
+    CKFFT_PRINTF("NUMA replicas: %d errors", errors);
+    if (errors)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
+    CKFFT_PRINTF("\n");
+
+    return success;
+}
+
+// check that FFTs without a tmpBuf use the context's scratch buffers, or allocate 
+// one if none were reserved
+bool regressionTestScratch(const CkFftComplex* input, int count, int maxCount)
+{
+    int errors = 0;
+
+    AllocCount allocCount = { 0, 0 };
+    CkFftVerify( CkFftSetAllocator(countingAlloc, countingFree, &allocCount) );
+    CkFftContext* context = CkFftInit(maxCount, kCkFftDirection_Both, NULL, NULL);
+
+    vector<CkFftComplex> tmpBuf;
+    tmpBuf.resize(count);
+    vector<float> output;
+    output.resize(count * 2);
+    vector<float> refOutput;
+    refOutput.resize(count * 2);
+    vector<CkFftHalf> halfInput;
+    halfInput.resize(count * 2);
+    for (int i = 0; i < count; ++i)
+    {
+        halfInput[i*2] = ckfft::floatToHalf(input[i].real);
+        halfInput[i*2 + 1] = ckfft::floatToHalf(input[i].imag);
+    }
+    vector<CkFftHalf> halfOutput;
+    halfOutput.resize(count * 2);
+    vector<CkFftHalf> refHalfOutput;
+    refHalfOutput.resize(count * 2);
+
+    CkFftVerify( CkFftRealInverseStrided(context, count, input, &refOutput[0], 2, &tmpBuf[0]) );
+    CkFftVerify( CkFftComplexForwardHalf(context, count, kCkFftHalfFormat_Float16, &halfInput[0], &refHalfOutput[0], &tmpBuf[0]) );
+
+    for (int reserved = 0; reserved < 2; ++reserved)
+    {
+        if (reserved)
+        {
+            CkFftVerify( CkFftReserveScratch(context, 2) );
+            if (!isAligned(context->scratchPool->bufs) || 
+                !isAligned(context->scratchPool->bufs + context->scratchPool->bufStride))
+            {
+                ++errors;
+            }
+        }
+
+        // without reserved buffers, each call allocates one; with them, none do
+        int allocs = allocCount.allocs;
+        output.assign(output.size(), 0.0f);
+        CkFftVerify( CkFftRealInverseStrided(context, count, input, &output[0], 2, NULL) );
+        CkFftVerify( CkFftComplexForwardHalf(context, count, kCkFftHalfFormat_Float16, &halfInput[0], &halfOutput[0], NULL) );
+        if (allocCount.allocs - allocs != (reserved ? 0 : 2) || allocCount.allocs - allocCount.frees != (reserved ? 2 : 1))
+        {
+            ++errors;
+        }
+        if (output != refOutput || halfOutput != refHalfOutput)
+        {
+            ++errors;
+        }
+    }
+
+    // a buffer is not shared by two users at once, and when all are in use, FFTs 
+    // that need one fail rather than allocating
+    {
+        int allocs = allocCount.allocs;
+        ckfft::ScratchBuf buf0(context, NULL, maxCount);
+        ckfft::ScratchBuf buf1(context, NULL, maxCount);
+        ckfft::ScratchBuf buf2(context, NULL, maxCount);
+        if (buf0.get() != context->scratchPool->bufs || 
+            buf1.get() != context->scratchPool->bufs + context->scratchPool->bufStride ||
+            buf2.get() || allocCount.allocs != allocs)
+        {
+            ++errors;
+        }
+        if (CkFftComplexForwardHalf(context, count, kCkFftHalfFormat_Float16, &halfInput[0], &halfOutput[0], NULL) ||
+            allocCount.allocs != allocs)
+        {
+            ++errors;
+        }
+    }
+    {
+        // reserving more buffers while one is in use keeps it valid until shutdown
+        ckfft::ScratchBuf buf0(context, NULL, maxCount);
+        ckfft::ScratchPool* oldPool = context->scratchPool;
+        CkFftVerify( CkFftReserveScratch(context, 3) );
+        if (context->scratchPool == oldPool || context->scratchPool->prev != oldPool || 
+            buf0.get() != oldPool->bufs)
+        {
+            ++errors;
+        }
+        memset(buf0.get(), 0, maxCount * sizeof(CkFftComplex));
+    }
+    {
+        // released buffers can be used again
+        ckfft::ScratchBuf buf(context, NULL, maxCount);
+        if (buf.get() != context->scratchPool->bufs)
+        {
+            ++errors;
+        }
+    }
+
+    CkFftShutdown(context);
+    CkFftVerify( CkFftSetAllocator(NULL, NULL, NULL) );
+    if (allocCount.allocs != allocCount.frees)
+    {
+        ++errors;
+    }
+
+    bool success = true;
+    CKFFT_PRINTF("scratch buffers: %d errors", errors);
+    if (errors)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
+    CKFFT_PRINTF("\n");
+
+    return success;
+}
+
+// check size limits, and the accuracy of a large FFT (sizes beyond 2^31 need too
+// much memory to test here)
+bool regressionTestLargeSize()
+{
+    int errors = 0;
+
+    // sizes whose context would overflow size_t, and negative sizes, are rejected
+    CkFftSize hugeCount = (CkFftSize) 1 << (sizeof(CkFftSize) * 8 - 2);
+    if (CkFftInit(hugeCount, kCkFftDirection_Both, NULL, NULL) || 
+        CkFftInit(-hugeCount * 2, kCkFftDirection_Both, NULL, NULL))
+    {
+        ++errors;
+    }
+    CkFftContext* context = CkFftInit(16, kCkFftDirection_Both, NULL, NULL);
+    CkFftComplex buf[16] = { { 0.0f, 0.0f } };
+    if (CkFftComplexForward(context, -hugeCount * 2, buf, buf) ||
+        CkFftUnorderedIndex(hugeCount, hugeCount / 2) != 1 ||
+        CkFftUnorderedIndex(hugeCount, 1) != hugeCount / 2)
+    {
+        ++errors;
+    }
+    CkFftShutdown(context);
+
+    // sizes that choose between radix-2 and radix-4 first steps, including those 
+    // beyond 32 bits
+    if (!ckfft::isPowerOfFour(4) || ckfft::isPowerOfFour(8) || 
+        !ckfft::isPowerOfFour((CkFftSize) 1 << 30) || ckfft::isPowerOfFour((CkFftSize) 1 << 31))
+    {
+        ++errors;
+    }
+    if (sizeof(CkFftSize) >= 8)
+    {
+        CkFftSize pow32 = (CkFftSize) 1 << (sizeof(CkFftSize) * 4);
+        if (!ckfft::isPowerOfFour(pow32) || !ckfft::isPowerOfFour(pow32 * 4) || 
+            ckfft::isPowerOfFour(pow32 * 2) || ckfft::isPowerOfFour(pow32 * 8))
+        {
+            ++errors;
+        }
+    }
+
+    // a single tone at an odd frequency gives a single nonzero bin
+    const CkFftSize k_count = 1 << 22;
+    const CkFftSize k_freq = k_count / 2 + 12345;
+    const double k_pi = 3.14159265358979323846;
+    context = CkFftInit(k_count, kCkFftDirection_Forward, NULL, NULL);
+    vector<CkFftComplex> input;
+    input.resize(k_count);
+    for (CkFftSize i = 0; i < k_count; ++i)
+    {
+        double theta = 2.0 * k_pi * (double) ((i * k_freq) % k_count) / k_count;
+        input[i].real = (float) cos(theta);
+        input[i].imag = (float) sin(theta);
+    }
+    vector<CkFftComplex> output;
+    output.resize(k_count);
+    CkFftVerify( CkFftComplexForward(context, k_count, &input[0], &output[0]) );
+    CkFftShutdown(context);
+
+    double sumSq = 0.0;
+    for (CkFftSize i = 0; i < k_count; ++i)
+    {
+        double real = output[i].real - (i == k_freq ? (double) k_count : 0.0);
+        double imag = output[i].imag;
+        sumSq += real * real + imag * imag;
+    }
+    // RMS error relative to the RMS output value
+    float err = (float) sqrt(sumSq / k_count / k_count);
+
+    bool success = true;
+    const float k_thresh = 1e-6f;
+    CKFFT_PRINTF("count=%d: %d errors, err %g", (int) k_count, errors, err);
+    if (errors || err > k_thresh)
+    {
+        CKFFT_PRINTF("   ****** FAILED ******");
+        success = false;
+    }
+    CKFFT_PRINTF("\n");
+
+    return success;
+}
+
+bool regressionTest()
+{
+    // read input
+    vector<CkFftComplex> input;
+    string path;
+    getInputDir(path);
+    path += "/input.txt";
+    read(input, path.c_str());
+    int count = (int) input.size();
+
+    bool success = true;
+
+    // compare complex forward & inverse against kiss_fft
+    CKFFT_PRINTF("complex FFTs:\n");
+    int maxCount = count*2;
+    while (count > 0)
+    {
+        // complex forward
+        success &= regressionTestComplex(&input[0], count, count, false);
+        // same with maxCount > count
+        success &= regressionTestComplex(&input[0], count, maxCount, false);
+
+        // complex inverse
+        success &= regressionTestComplex(&input[0], count, count, true);
+        // same with maxCount > count
+        success &= regressionTestComplex(&input[0], count, maxCount, true);
+
+        count /= 2;
+    }
+
+
+    // compare results of real fft with results of complex fft on real input
+    CKFFT_PRINTF("\n");
+    CKFFT_PRINTF("real FFTs:\n");
+    vector<CkFftComplex> realInput = input;
+    vector<float> floatInput;
+    floatInput.resize(realInput.size());
+    for (int i = 0; i < (int) realInput.size(); ++i)
+    {
+        realInput[i].imag = 0.0f;
+        floatInput[i] = realInput[i].real;
+    }
+
+    count = (int) realInput.size();
+    while (count > 0)
+    {
+        // real forward and inverse
+        success &= regressionTestReal(&realInput[0], &floatInput[0], count, count);
+        // same with maxCount > count
+        success &= regressionTestReal(&realInput[0], &floatInput[0], count, maxCount);
+
+        count /= 2;
+    }
+
+
+    // compare in-place FFTs with out-of-place FFTs
+    CKFFT_PRINTF("\n");
+    CKFFT_PRINTF("in-place FFTs:\n");
+    vector<CkFftComplex> spectrum;
+    spectrum.resize(realInput.size());
+    count = (int) realInput.size();
+    while (count > 0)
+    {
+        success &= regressionTestInPlace(&input[0], count, maxCount, false, false, true, false);
+        success &= regressionTestInPlace(&input[0], count, maxCount, true, false, true, false);
+
+        // real inverse input is the spectrum of real data
+        CkFftTester ckfft;
+        ckfft.init((CkFftComplex*) &floatInput[0], &spectrum[0], count, false, true);
+        ckfft.run();
+        ckfft.shutdown();
+
+        success &= regressionTestInPlace((CkFftComplex*) &floatInput[0], count, maxCount, false, true, true, false);
+        success &= regressionTestInPlace(&spectrum[0], count, maxCount, true, true, true, false);
+        success &= regressionTestInPlace(&spectrum[0], count, maxCount, true, true, false, true);
+        success &= regressionTestInPlace(&spectrum[0], count, maxCount, true, true, true, true);
+
+        count /= 2;
+    }
+
+
+    // compare unordered FFTs with ordered FFTs
+    CKFFT_PRINTF("\n");
+    CKFFT_PRINTF("unordered FFTs:\n");
+    count = (int) input.size();
+    while (count > 0)
+    {
+        success &= regressionTestUnordered(&input[0], count, maxCount, false);
+        success &= regressionTestUnordered(&input[0], count, maxCount, true);
+
+        count /= 2;
+    }
+
+
+    // compare pruned FFTs with full FFTs
+    CKFFT_PRINTF("\n");
+    CKFFT_PRINTF("pruned FFTs:\n");
+    for (int inverse = 0; inverse < 2; ++inverse)
+    {
+        success &= regressionTestPruned(&input[0], 8192, 256, 1000, 410, 0, inverse != 0, maxCount);
+        success &= regressionTestPruned(&input[0], 8192, 256, 8000, 400, 0, inverse != 0, maxCount);
+        success &= regressionTestPruned(&input[0], 8192, 200, 17, 3, 0, inverse != 0, maxCount);
+        success &= regressionTestPruned(&input[0], 8192, 256, 5, 500, 37, inverse != 0, maxCount);
+        success &= regressionTestPruned(&input[0], 8192, 4096, 4095, 7, 1001, inverse != 0, maxCount);
+        success &= regressionTestPruned(&input[0], 4096, 4096, 3000, 300, 0, inverse != 0, maxCount);
+        success &= regressionTestPruned(&input[0], 4096, 3000, 3900, 517, 0, inverse != 0, maxCount);
+        success &= regressionTestPruned(&input[0], 1024, 1024, 0, 1024, 0, inverse != 0, maxCount);
+        success &= regressionTestPruned(&input[0], 64, 5, 60, 64, 0, inverse != 0, maxCount);
+        success &= regressionTestPruned(&input[0], 2, 1, 1, 2, 0, inverse != 0, maxCount);
+        success &= regressionTestPruned(&input[0], 1, 1, 0, 1, 0, inverse != 0, maxCount);
+    }
+
+
+    // compare spectral arithmetic with scalar arithmetic
+    CKFFT_PRINTF("\n");
+    CKFFT_PRINTF("spectral arithmetic:\n");
+    for (count = 1; count <= 9; ++count)
+    {
+        success &= regressionTestSpectral(&input[0], count, maxCount, false, (count & 1) != 0);
+    }
+    count = (int) input.size();
+    while (count > 0)
+    {
+        success &= regressionTestSpectral(&input[0], count, maxCount, false, false);
+        success &= regressionTestSpectral(&input[0], count, maxCount, true, true);
+
+        count /= 8;
+    }
+
+
+    // compare packed real FFTs with unpacked real FFTs
+    CKFFT_PRINTF("\n");
+    CKFFT_PRINTF("packed real FFTs:\n");
+    count = (int) floatInput.size();
+    while (count > 1)
+    {
+        success &= regressionTestPacked(&floatInput[0], count, maxCount, false);
+        success &= regressionTestPacked(&floatInput[0], count, maxCount, true);
+
+        count /= 2;
+    }
+
+
+    // compare power spectra with real FFTs
+    CKFFT_PRINTF("\n");
+    CKFFT_PRINTF("power spectra:\n");
+    count = (int) floatInput.size();
+    while (count > 0)
+    {
+        success &= regressionTestPowerSpectrum(&floatInput[0], count, maxCount, false);
+        success &= regressionTestPowerSpectrum(&floatInput[0], count, maxCount, true);
+
+        count /= 2;
+    }
+
+
+    // compare FFTs scaled by the context with unscaled FFTs
+    CKFFT_PRINTF("\n");
+    CKFFT_PRINTF("scaled FFTs:\n");
+    count = (int) input.size();
+    while (count > 1)
+    {
+        success &= regressionTestScale(&input[0], &floatInput[0], count, maxCount);
+
+        count /= 2;
+    }
+
+
+    // compare strided real FFTs with contiguous real FFTs
+    CKFFT_PRINTF("\n");
+    CKFFT_PRINTF("strided real FFTs:\n");
+    count = (int) floatInput.size();
+    while (count > 0)
+    {
+        success &= regressionTestStrided(&floatInput[0], count, maxCount, 2);
+        success &= regressionTestStrided(&floatInput[0], count, maxCount, 8);
+
+        count /= 2;
+    }
+
+
+    // compare streaming STFTs with FFTs of each frame
+    CKFFT_PRINTF("\n");
+    CKFFT_PRINTF("STFTs:\n");
+    count = (int) floatInput.size();
+    while (count > 0)
+    {
+        success &= regressionTestStft(&floatInput[0], (int) floatInput.size(), count, max(count/4, 1), true, maxCount);
+        success &= regressionTestStft(&floatInput[0], (int) floatInput.size(), count, min(count, 3), false, maxCount);
+
+        count /= 2;
+    }
+
+
+    // check that ISTFTs reproduce the input of STFTs
+    CKFFT_PRINTF("\n");
+    CKFFT_PRINTF("ISTFTs:\n");
+    count = (int) floatInput.size() / 2;
+    while (count > 2)
+    {
+        success &= regressionTestIstft(&floatInput[0], (int) floatInput.size(), count, count/4, kCkFftWindow_Hann, maxCount);
+        success &= regressionTestIstft(&floatInput[0], (int) floatInput.size(), count, count/2, kCkFftWindow_Hamming, maxCount);
+        success &= regressionTestIstft(&floatInput[0], (int) floatInput.size(), count, count, kCkFftWindow_Rectangular, maxCount);
+
+        count /= 2;
+    }
+
+
+    // compare convolvers with direct convolution
+    CKFFT_PRINTF("\n");
+    CKFFT_PRINTF("convolvers:\n");
+    count = (int) floatInput.size() / 4;
+    while (count > 0)
+    {
+        success &= regressionTestConvolver(&floatInput[0], (int) floatInput.size(), count, count, maxCount);
+        success &= regressionTestConvolver(&floatInput[0], (int) floatInput.size(), count, 100, maxCount);
+        success &= regressionTestConvolver(&floatInput[0], (int) floatInput.size(), count + 3, 1, maxCount);
+
+        count /= 4;
+    }
+
+
+    // compare partitioned convolvers with direct convolution
+    CKFFT_PRINTF("\n");
+    CKFFT_PRINTF("partitioned convolvers:\n");
+    for (int worker = 0; worker <= 3; ++worker)
+    {
+        success &= regressionTestPartitionedConvolver(&floatInput[0], (int) floatInput.size(), 6000, 16, 256, worker, maxCount);
+    }
+    success &= regressionTestPartitionedConvolver(&floatInput[0], (int) floatInput.size(), 3001, 32, 4096, 1, maxCount);
+    success &= regressionTestPartitionedConvolver(&floatInput[0], (int) floatInput.size(), 500, 64, 64, 1, maxCount);
+    success &= regressionTestPartitionedConvolver(&floatInput[0], (int) floatInput.size(), 1, 1, 1, 0, maxCount);
+
+
+    // compare convolver matrices with direct convolution
+    CKFFT_PRINTF("\n");
+    CKFFT_PRINTF("convolver matrices:\n");
+    success &= regressionTestConvolverMatrix(&floatInput[0], (int) floatInput.size(), 512, 512, 4, 2, maxCount);
+    success &= regressionTestConvolverMatrix(&floatInput[0], (int) floatInput.size(), 300, 64, 2, 5, maxCount);
+    success &= regressionTestConvolverMatrix(&floatInput[0], (int) floatInput.size(), 17, 1, 1, 1, maxCount);
+
+
+    // check the peaks of correlations of delayed signals
+    CKFFT_PRINTF("\n");
+    CKFFT_PRINTF("correlators:\n");
+    count = (int) floatInput.size() / 2;
+    while (count >= 64)
+    {
+        for (int weighting = kCkFftWeighting_None; weighting <= kCkFftWeighting_Scot; ++weighting)
+        {
+            success &= regressionTestCorrelator(&floatInput[0], count, (CkFftWeighting) weighting, 7.0f, maxCount);
+            success &= regressionTestCorrelator(&floatInput[0], count, (CkFftWeighting) weighting, 3.5f, maxCount);
+        }
+
+        count /= 8;
+    }
+
+
+    // compare mel features with values computed from real FFTs
+    CKFFT_PRINTF("\n");
+    CKFFT_PRINTF("mel features:\n");
+    success &= regressionTestMelFeatures(&floatInput[0], (int) floatInput.size(), 512, 160, 80, 0, maxCount);
+    success &= regressionTestMelFeatures(&floatInput[0], (int) floatInput.size(), 512, 160, 40, 13, maxCount);
+    success &= regressionTestMelFeatures(&floatInput[0], (int) floatInput.size(), 64, 64, 8, 8, maxCount);
+
+
+    // compare FFTs of integer input with FFTs of float input
+    CKFFT_PRINTF("\n");
+    CKFFT_PRINTF("integer input FFTs:\n");
+    count = (int) input.size();
+    while (count > 0)
+    {
+        success &= regressionTestInteger(&input[0], count, maxCount);
+
+        count /= 2;
+    }
+
+
+    // compare FFTs of 16-bit floating-point data with float FFTs
+    CKFFT_PRINTF("\n");
+    CKFFT_PRINTF("16-bit floating-point FFTs:\n");
+    success &= regressionTestHalfConversion();
+    count = (int) input.size();
+    while (count > 0)
+    {
+        success &= regressionTestHalf(&input[0], count, maxCount, kCkFftHalfFormat_Float16);
+        success &= regressionTestHalf(&input[0], count, maxCount, kCkFftHalfFormat_BFloat16);
+
+        count /= 2;
+    }
+
+
+    // compare fixed-point FFTs with float FFTs
+    CKFFT_PRINTF("\n");
+    CKFFT_PRINTF("fixed-point FFTs:\n");
+    count = (int) input.size();
+    while (count > 0)
+    {
+        success &= regressionTestFixed(&input[0], count, maxCount);
+
+        count /= 2;
+    }
+
+
+    // compare double-precision FFTs with a direct DFT
+    CKFFT_PRINTF("\n");
+    CKFFT_PRINTF("double-precision FFTs:\n");
+    count = (int) input.size();
+    while (count > 0)
+    {
+        success &= regressionTestDouble(&input[0], count, maxCount);
+
+        count /= 2;
+    }
+
+
+    // check allocation
+    CKFFT_PRINTF("\n");
+    CKFFT_PRINTF("allocation:\n");
+    success &= regressionTestAllocator(&input[0], (int) input.size(), maxCount);
+    success &= regressionTestNuma(&input[0], (int) input.size(), maxCount);
+    success &= regressionTestScratch(&input[0], (int) input.size(), maxCount);
+
+    // check large sizes
+    CKFFT_PRINTF("\n");
+    CKFFT_PRINTF("large sizes:\n");
+    success &= regressionTestLargeSize();
 
     return success;
 }